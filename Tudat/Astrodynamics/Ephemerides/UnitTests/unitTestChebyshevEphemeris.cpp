@@ -0,0 +1,140 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cstdio>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/Ephemerides/chebyshevEphemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/keplerEphemeris.h"
+#include "Tudat/Basics/parallelization.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::ephemerides;
+
+BOOST_AUTO_TEST_SUITE( test_chebyshev_ephemeris )
+
+//! Test fitting of Chebyshev ephemeris to Kepler ephemeris, and evaluation of fitted ephemeris.
+BOOST_AUTO_TEST_CASE( testChebyshevEphemerisFit )
+{
+    // Create Kepler ephemeris of eccentric Earth orbit.
+    const double gravitationalParameter = 3.986004418E14;
+    const Eigen::Vector6d keplerElements =
+            ( Eigen::Vector6d( ) << 12000.0E3, 0.3, 0.8, 1.2, 0.4, 2.0 ).finished( );
+    std::shared_ptr< Ephemeris > keplerEphemeris = std::make_shared< KeplerEphemeris >(
+                keplerElements, 0.0, gravitationalParameter, "Earth", "J2000" );
+
+    const double startTime = 1.0E4;
+    const double endTime = 5.0 * 86400.0;
+    const double positionTolerance = 1.0E-3;
+    const double velocityTolerance = 1.0E-6;
+
+    std::shared_ptr< ChebyshevEphemeris > chebyshevEphemeris = fitChebyshevEphemeris(
+                keplerEphemeris, startTime, endTime, positionTolerance, velocityTolerance, 14 );
+
+    BOOST_CHECK_EQUAL( chebyshevEphemeris->getReferenceFrameOrigin( ), "Earth" );
+    BOOST_CHECK_EQUAL( chebyshevEphemeris->getReferenceFrameOrientation( ), "J2000" );
+    BOOST_CHECK_EQUAL( chebyshevEphemeris->getPolynomialDegree( ), 14 );
+    BOOST_CHECK( chebyshevEphemeris->getNumberOfSegments( ) > 1 );
+    BOOST_CHECK_CLOSE_FRACTION( chebyshevEphemeris->getStartTime( ), startTime, 1.0E-15 );
+    BOOST_CHECK_CLOSE_FRACTION( chebyshevEphemeris->getEndTime( ), endTime, 1.0E-15 );
+
+    // Check fitted ephemeris at times not used for fitting (and at interval boundaries).
+    const int numberOfTestTimes = 5001;
+    double maximumPositionError = 0.0, maximumVelocityError = 0.0;
+    for( int i = 0; i < numberOfTestTimes; i++ )
+    {
+        const double testTime = startTime + ( endTime - startTime ) * static_cast< double >( i ) /
+                static_cast< double >( numberOfTestTimes - 1 );
+        const Eigen::Vector6d stateDifference =
+                chebyshevEphemeris->getCartesianState( testTime ) - keplerEphemeris->getCartesianState( testTime );
+        maximumPositionError = std::max( maximumPositionError, stateDifference.segment( 0, 3 ).norm( ) );
+        maximumVelocityError = std::max( maximumVelocityError, stateDifference.segment( 3, 3 ).norm( ) );
+    }
+    BOOST_CHECK_SMALL( maximumPositionError, 2.0 * positionTolerance );
+    BOOST_CHECK_SMALL( maximumVelocityError, 2.0 * velocityTolerance );
+
+    // Check that ephemeris cannot be evaluated outside of interval.
+    BOOST_CHECK_THROW( chebyshevEphemeris->getCartesianState( startTime - 1.0 ), std::runtime_error );
+    BOOST_CHECK_THROW( chebyshevEphemeris->getCartesianState( endTime + 1.0 ), std::runtime_error );
+
+    // Check that unreachable tolerance is detected.
+    BOOST_CHECK_THROW( fitChebyshevEphemeris( keplerEphemeris, startTime, endTime, 1.0E-3, 1.0E-6, 2, 8 ),
+                       std::runtime_error );
+}
+
+//! Test concurrent evaluation, and writing to and reading from binary file.
+BOOST_AUTO_TEST_CASE( testChebyshevEphemerisConcurrencyAndFileIo )
+{
+    // Create Chebyshev ephemeris from Kepler ephemeris of near-circular orbit.
+    const Eigen::Vector6d keplerElements =
+            ( Eigen::Vector6d( ) << 7000.0E3, 0.01, 0.5, 0.1, 0.2, 0.3 ).finished( );
+    std::shared_ptr< Ephemeris > keplerEphemeris = std::make_shared< KeplerEphemeris >(
+                keplerElements, 0.0, 3.986004418E14, "Earth", "J2000" );
+    std::shared_ptr< ChebyshevEphemeris > chebyshevEphemeris = fitChebyshevEphemeris(
+                keplerEphemeris, 0.0, 86400.0, 1.0E-2, 1.0E-5 );
+
+    // Evaluate ephemeris serially and from multiple threads, and check that results are identical.
+    const int numberOfTestTimes = 1000;
+    std::vector< Eigen::Vector6d > serialStates( numberOfTestTimes ), parallelStates( numberOfTestTimes );
+    for( int i = 0; i < numberOfTestTimes; i++ )
+    {
+        serialStates[ i ] = chebyshevEphemeris->getCartesianState( 86.4 * static_cast< double >( i ) );
+    }
+    utilities::executeParallelLoop(
+                numberOfTestTimes, 4, [ & ]( const int i )
+    {
+        parallelStates[ i ] = chebyshevEphemeris->getCartesianState( 86.4 * static_cast< double >( i ) );
+    } );
+    for( int i = 0; i < numberOfTestTimes; i++ )
+    {
+        BOOST_CHECK_EQUAL( ( serialStates[ i ] - parallelStates[ i ] ).norm( ), 0.0 );
+    }
+
+    // Write ephemeris to file, read it back, and check that it is identical.
+    const std::string fileName =
+            ( boost::filesystem::temp_directory_path( ) / boost::filesystem::unique_path(
+                  "tudat_chebyshev_%%%%-%%%%.bin" ) ).string( );
+    writeChebyshevEphemerisToBinaryFile( chebyshevEphemeris, fileName );
+    std::shared_ptr< ChebyshevEphemeris > readEphemeris = readChebyshevEphemerisFromBinaryFile( fileName );
+    std::remove( fileName.c_str( ) );
+
+    BOOST_CHECK_EQUAL( readEphemeris->getReferenceFrameOrigin( ), "Earth" );
+    BOOST_CHECK_EQUAL( readEphemeris->getReferenceFrameOrientation( ), "J2000" );
+    BOOST_CHECK_EQUAL( readEphemeris->getStartTime( ), chebyshevEphemeris->getStartTime( ) );
+    BOOST_CHECK_EQUAL( readEphemeris->getSegmentLength( ), chebyshevEphemeris->getSegmentLength( ) );
+    BOOST_CHECK_EQUAL( readEphemeris->getNumberOfSegments( ), chebyshevEphemeris->getNumberOfSegments( ) );
+    BOOST_CHECK_EQUAL( readEphemeris->getPolynomialDegree( ), chebyshevEphemeris->getPolynomialDegree( ) );
+    BOOST_CHECK( readEphemeris->getChebyshevCoefficients( ) == chebyshevEphemeris->getChebyshevCoefficients( ) );
+    BOOST_CHECK_EQUAL( readEphemeris->getPositionTolerance( ), 1.0E-2 );
+    BOOST_CHECK_EQUAL( readEphemeris->getVelocityTolerance( ), 1.0E-5 );
+
+    // Check that invalid files are rejected.
+    BOOST_CHECK_THROW( readChebyshevEphemerisFromBinaryFile( fileName ), std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
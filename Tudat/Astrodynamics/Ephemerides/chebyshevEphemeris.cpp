@@ -0,0 +1,335 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#include "Tudat/Astrodynamics/Ephemerides/chebyshevEphemeris.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Identifier at start of binary Chebyshev ephemeris files.
+static const char chebyshevEphemerisFileIdentifier[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'C', 'H', 'B' };
+
+//! Version of binary Chebyshev ephemeris file format.
+static const std::int32_t chebyshevEphemerisFileVersion = 2;
+
+//! Constructor
+ChebyshevEphemeris::ChebyshevEphemeris( const double startTime,
+                                        const double segmentLength,
+                                        const int numberOfSegments,
+                                        const int polynomialDegree,
+                                        const std::vector< double >& chebyshevCoefficients,
+                                        const std::string& referenceFrameOrigin,
+                                        const std::string& referenceFrameOrientation,
+                                        const double positionTolerance,
+                                        const double velocityTolerance ):
+    Ephemeris( referenceFrameOrigin, referenceFrameOrientation ),
+    startTime_( startTime ), segmentLength_( segmentLength ), inverseSegmentLength_( 1.0 / segmentLength ),
+    numberOfSegments_( numberOfSegments ), polynomialDegree_( polynomialDegree ),
+    chebyshevCoefficients_( chebyshevCoefficients ),
+    positionTolerance_( positionTolerance ), velocityTolerance_( velocityTolerance )
+{
+    if( !( segmentLength_ > 0.0 ) || numberOfSegments_ < 1 || polynomialDegree_ < 0 )
+    {
+        throw std::runtime_error( "Error when creating Chebyshev ephemeris, segment length, number of segments or "
+                                  "polynomial degree is invalid" );
+    }
+
+    if( chebyshevCoefficients_.size( ) !=
+            static_cast< unsigned int >( 6 * numberOfSegments_ * ( polynomialDegree_ + 1 ) ) )
+    {
+        throw std::runtime_error( "Error when creating Chebyshev ephemeris, number of coefficients is inconsistent" );
+    }
+}
+
+//! Get cartesian state from ephemeris.
+Eigen::Vector6d ChebyshevEphemeris::getCartesianState( const double secondsSinceEpoch )
+{
+    if( secondsSinceEpoch < startTime_ || secondsSinceEpoch > getEndTime( ) )
+    {
+        throw std::runtime_error( "Error when evaluating Chebyshev ephemeris, requested time " +
+                                  std::to_string( secondsSinceEpoch ) + " is outside interval [" +
+                                  std::to_string( startTime_ ) + ", " + std::to_string( getEndTime( ) ) + "]" );
+    }
+
+    // Determine segment, and scaled time in [-1, 1] in segment (end of interval is assigned to last segment).
+    const double segmentTime = ( secondsSinceEpoch - startTime_ ) * inverseSegmentLength_;
+    const int segmentIndex = std::min( std::max( static_cast< int >( segmentTime ), 0 ), numberOfSegments_ - 1 );
+    const double scaledTime = 2.0 * ( segmentTime - static_cast< double >( segmentIndex ) ) - 1.0;
+
+    // Evaluate Chebyshev series for all state components with Clenshaw's recurrence.
+    typedef Eigen::Map< const Eigen::Vector6d > ConstCoefficientMap;
+    const double* segmentCoefficients =
+            chebyshevCoefficients_.data( ) + 6 * segmentIndex * ( polynomialDegree_ + 1 );
+
+    Eigen::Vector6d currentSum = Eigen::Vector6d::Zero( );
+    Eigen::Vector6d previousSum = Eigen::Vector6d::Zero( );
+    for( int degree = polynomialDegree_; degree > 0; degree-- )
+    {
+        const Eigen::Vector6d nextSum = ConstCoefficientMap( segmentCoefficients + 6 * degree ) +
+                2.0 * scaledTime * currentSum - previousSum;
+        previousSum = currentSum;
+        currentSum = nextSum;
+    }
+
+    return ConstCoefficientMap( segmentCoefficients ) + scaledTime * currentSum - previousSum;
+}
+
+//! Function to compute the Chebyshev coefficients that interpolate a state function on a single segment.
+void computeSegmentChebyshevCoefficients(
+        const std::function< Eigen::Vector6d( const double ) >& stateFunction,
+        const double segmentStartTime,
+        const double segmentLength,
+        const int polynomialDegree,
+        double* chebyshevCoefficients )
+{
+    const int numberOfNodes = polynomialDegree + 1;
+    std::fill( chebyshevCoefficients, chebyshevCoefficients + 6 * numberOfNodes, 0.0 );
+
+    // Sum state at Chebyshev nodes, weighted by Chebyshev polynomials (discrete cosine transform).
+    for( int node = 0; node < numberOfNodes; node++ )
+    {
+        const double nodeAngle = mathematical_constants::PI * ( static_cast< double >( node ) + 0.5 ) /
+                static_cast< double >( numberOfNodes );
+        const Eigen::Vector6d nodeState = stateFunction(
+                    segmentStartTime + 0.5 * segmentLength * ( std::cos( nodeAngle ) + 1.0 ) );
+
+        for( int degree = 0; degree < numberOfNodes; degree++ )
+        {
+            const double weight = std::cos( static_cast< double >( degree ) * nodeAngle );
+            for( int component = 0; component < 6; component++ )
+            {
+                chebyshevCoefficients[ 6 * degree + component ] += weight * nodeState( component );
+            }
+        }
+    }
+
+    // Normalize coefficients (with half weight for degree 0, so that series is a plain sum of coefficients).
+    for( int degree = 0; degree < numberOfNodes; degree++ )
+    {
+        const double normalization = ( ( degree == 0 ) ? 1.0 : 2.0 ) / static_cast< double >( numberOfNodes );
+        for( int component = 0; component < 6; component++ )
+        {
+            chebyshevCoefficients[ 6 * degree + component ] *= normalization;
+        }
+    }
+}
+
+//! Function to create a Chebyshev ephemeris by fitting an existing ephemeris on a given time interval.
+std::shared_ptr< ChebyshevEphemeris > fitChebyshevEphemeris(
+        const std::shared_ptr< Ephemeris > originalEphemeris,
+        const double startTime,
+        const double endTime,
+        const double positionTolerance,
+        const double velocityTolerance,
+        const int polynomialDegree,
+        const int maximumNumberOfSegments )
+{
+    if( !( endTime > startTime ) )
+    {
+        throw std::runtime_error( "Error when fitting Chebyshev ephemeris, end time must be larger than start time" );
+    }
+
+    if( polynomialDegree < 1 )
+    {
+        throw std::runtime_error( "Error when fitting Chebyshev ephemeris, polynomial degree must be at least 1" );
+    }
+
+    const std::function< Eigen::Vector6d( const double ) > stateFunction =
+            std::bind( &Ephemeris::getCartesianState, originalEphemeris, std::placeholders::_1 );
+    const int coefficientsPerSegment = 6 * ( polynomialDegree + 1 );
+
+    std::shared_ptr< ChebyshevEphemeris > chebyshevEphemeris;
+    int numberOfSegments = 1;
+    while( chebyshevEphemeris == nullptr )
+    {
+        if( numberOfSegments > maximumNumberOfSegments )
+        {
+            throw std::runtime_error( "Error when fitting Chebyshev ephemeris, tolerances not met with maximum number of "
+                                      "segments (" + std::to_string( maximumNumberOfSegments ) + ")" );
+        }
+
+        const double segmentLength = ( endTime - startTime ) / static_cast< double >( numberOfSegments );
+        std::vector< double > chebyshevCoefficients( coefficientsPerSegment * numberOfSegments );
+
+        // Fit all segments, and check accuracy of each segment halfway between nodes and at its boundaries.
+        bool isToleranceMet = true;
+        for( int segment = 0; ( segment < numberOfSegments ) && isToleranceMet; segment++ )
+        {
+            const double segmentStartTime = startTime + segmentLength * static_cast< double >( segment );
+            double* segmentCoefficients = chebyshevCoefficients.data( ) + coefficientsPerSegment * segment;
+            computeSegmentChebyshevCoefficients(
+                        stateFunction, segmentStartTime, segmentLength, polynomialDegree, segmentCoefficients );
+
+            ChebyshevEphemeris segmentEphemeris(
+                        segmentStartTime, segmentLength, 1, polynomialDegree,
+                        std::vector< double >( segmentCoefficients, segmentCoefficients + coefficientsPerSegment ) );
+            for( int testPoint = 0; ( testPoint <= polynomialDegree + 1 ) && isToleranceMet; testPoint++ )
+            {
+                const double testTime = std::min(
+                            segmentStartTime + 0.5 * segmentLength * ( 1.0 - std::cos(
+                                mathematical_constants::PI * static_cast< double >( testPoint ) /
+                                static_cast< double >( polynomialDegree + 1 ) ) ),
+                            segmentEphemeris.getEndTime( ) );
+                const Eigen::Vector6d stateDifference =
+                        segmentEphemeris.getCartesianState( testTime ) - stateFunction( testTime );
+                if( stateDifference.segment( 0, 3 ).norm( ) > positionTolerance ||
+                        stateDifference.segment( 3, 3 ).norm( ) > velocityTolerance )
+                {
+                    isToleranceMet = false;
+                }
+            }
+        }
+
+        if( isToleranceMet )
+        {
+            chebyshevEphemeris = std::make_shared< ChebyshevEphemeris >(
+                        startTime, segmentLength, numberOfSegments, polynomialDegree, chebyshevCoefficients,
+                        originalEphemeris->getReferenceFrameOrigin( ),
+                        originalEphemeris->getReferenceFrameOrientation( ),
+                        positionTolerance, velocityTolerance );
+        }
+        else
+        {
+            numberOfSegments *= 2;
+        }
+    }
+
+    return chebyshevEphemeris;
+}
+
+//! Function to write a string to a binary file, preceded by its length.
+static void writeStringToBinaryFile( std::ofstream& outputFile, const std::string& stringToWrite )
+{
+    const std::uint32_t stringLength = static_cast< std::uint32_t >( stringToWrite.size( ) );
+    outputFile.write( reinterpret_cast< const char* >( &stringLength ), sizeof( stringLength ) );
+    outputFile.write( stringToWrite.data( ), stringLength );
+}
+
+//! Function to read a string from a binary file, preceded by its length.
+static std::string readStringFromBinaryFile( std::ifstream& inputFile )
+{
+    std::uint32_t stringLength = 0;
+    inputFile.read( reinterpret_cast< char* >( &stringLength ), sizeof( stringLength ) );
+    std::string readString( stringLength, ' ' );
+    if( stringLength > 0 )
+    {
+        inputFile.read( &readString[ 0 ], stringLength );
+    }
+    return readString;
+}
+
+//! Function to write a Chebyshev ephemeris to a binary file.
+void writeChebyshevEphemerisToBinaryFile(
+        const std::shared_ptr< ChebyshevEphemeris > chebyshevEphemeris,
+        const std::string& fileName )
+{
+    std::ofstream outputFile( fileName.c_str( ), std::ios::binary | std::ios::trunc );
+    if( !outputFile.is_open( ) )
+    {
+        throw std::runtime_error( "Error when writing Chebyshev ephemeris, could not open file " + fileName );
+    }
+
+    const double startTime = chebyshevEphemeris->getStartTime( );
+    const double segmentLength = chebyshevEphemeris->getSegmentLength( );
+    const std::int32_t numberOfSegments = chebyshevEphemeris->getNumberOfSegments( );
+    const std::int32_t polynomialDegree = chebyshevEphemeris->getPolynomialDegree( );
+    const double positionTolerance = chebyshevEphemeris->getPositionTolerance( );
+    const double velocityTolerance = chebyshevEphemeris->getVelocityTolerance( );
+
+    outputFile.write( chebyshevEphemerisFileIdentifier, sizeof( chebyshevEphemerisFileIdentifier ) );
+    outputFile.write( reinterpret_cast< const char* >( &chebyshevEphemerisFileVersion ),
+                      sizeof( chebyshevEphemerisFileVersion ) );
+    outputFile.write( reinterpret_cast< const char* >( &startTime ), sizeof( startTime ) );
+    outputFile.write( reinterpret_cast< const char* >( &segmentLength ), sizeof( segmentLength ) );
+    outputFile.write( reinterpret_cast< const char* >( &numberOfSegments ), sizeof( numberOfSegments ) );
+    outputFile.write( reinterpret_cast< const char* >( &polynomialDegree ), sizeof( polynomialDegree ) );
+    outputFile.write( reinterpret_cast< const char* >( &positionTolerance ), sizeof( positionTolerance ) );
+    outputFile.write( reinterpret_cast< const char* >( &velocityTolerance ), sizeof( velocityTolerance ) );
+    writeStringToBinaryFile( outputFile, chebyshevEphemeris->getReferenceFrameOrigin( ) );
+    writeStringToBinaryFile( outputFile, chebyshevEphemeris->getReferenceFrameOrientation( ) );
+
+    const std::vector< double >& chebyshevCoefficients = chebyshevEphemeris->getChebyshevCoefficients( );
+    outputFile.write( reinterpret_cast< const char* >( chebyshevCoefficients.data( ) ),
+                      sizeof( double ) * chebyshevCoefficients.size( ) );
+
+    if( !outputFile.good( ) )
+    {
+        throw std::runtime_error( "Error when writing Chebyshev ephemeris to file " + fileName );
+    }
+}
+
+//! Function to read a Chebyshev ephemeris from a binary file.
+std::shared_ptr< ChebyshevEphemeris > readChebyshevEphemerisFromBinaryFile(
+        const std::string& fileName )
+{
+    std::ifstream inputFile( fileName.c_str( ), std::ios::binary );
+    if( !inputFile.is_open( ) )
+    {
+        throw std::runtime_error( "Error when reading Chebyshev ephemeris, could not open file " + fileName );
+    }
+
+    // Check file identifier and version.
+    char fileIdentifier[ sizeof( chebyshevEphemerisFileIdentifier ) ];
+    std::int32_t fileVersion = 0;
+    inputFile.read( fileIdentifier, sizeof( fileIdentifier ) );
+    inputFile.read( reinterpret_cast< char* >( &fileVersion ), sizeof( fileVersion ) );
+    if( !inputFile.good( ) ||
+            std::memcmp( fileIdentifier, chebyshevEphemerisFileIdentifier, sizeof( fileIdentifier ) ) != 0 ||
+            fileVersion != chebyshevEphemerisFileVersion )
+    {
+        throw std::runtime_error( "Error when reading Chebyshev ephemeris, file " + fileName +
+                                  " is not a (compatible) Chebyshev ephemeris file" );
+    }
+
+    double startTime = TUDAT_NAN, segmentLength = TUDAT_NAN;
+    std::int32_t numberOfSegments = 0, polynomialDegree = -1;
+    double positionTolerance = TUDAT_NAN, velocityTolerance = TUDAT_NAN;
+    inputFile.read( reinterpret_cast< char* >( &startTime ), sizeof( startTime ) );
+    inputFile.read( reinterpret_cast< char* >( &segmentLength ), sizeof( segmentLength ) );
+    inputFile.read( reinterpret_cast< char* >( &numberOfSegments ), sizeof( numberOfSegments ) );
+    inputFile.read( reinterpret_cast< char* >( &polynomialDegree ), sizeof( polynomialDegree ) );
+    inputFile.read( reinterpret_cast< char* >( &positionTolerance ), sizeof( positionTolerance ) );
+    inputFile.read( reinterpret_cast< char* >( &velocityTolerance ), sizeof( velocityTolerance ) );
+    const std::string referenceFrameOrigin = readStringFromBinaryFile( inputFile );
+    const std::string referenceFrameOrientation = readStringFromBinaryFile( inputFile );
+
+    if( !inputFile.good( ) || numberOfSegments < 1 || polynomialDegree < 0 )
+    {
+        throw std::runtime_error( "Error when reading Chebyshev ephemeris, header of file " + fileName + " is invalid" );
+    }
+
+    std::vector< double > chebyshevCoefficients( 6 * numberOfSegments * ( polynomialDegree + 1 ) );
+    inputFile.read( reinterpret_cast< char* >( chebyshevCoefficients.data( ) ),
+                    sizeof( double ) * chebyshevCoefficients.size( ) );
+    if( !inputFile.good( ) )
+    {
+        throw std::runtime_error( "Error when reading Chebyshev ephemeris, file " + fileName + " is truncated" );
+    }
+
+    return std::make_shared< ChebyshevEphemeris >(
+                startTime, segmentLength, numberOfSegments, polynomialDegree, chebyshevCoefficients,
+                referenceFrameOrigin, referenceFrameOrientation, positionTolerance, velocityTolerance );
+}
+
+} // namespace ephemerides
+
+} // namespace tudat
@@ -0,0 +1,273 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Newhall, X X. Numerical representation of planetary ephemerides. Celestial Mechanics, 45, 1989.
+ *      Press, W.H., et al. Numerical Recipes in C++: The Art of Scientific Computing. Cambridge University Press, 2002.
+ *
+ */
+
+#ifndef TUDAT_CHEBYSHEV_EPHEMERIS_H
+#define TUDAT_CHEBYSHEV_EPHEMERIS_H
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/Ephemerides/ephemeris.h"
+#include "Tudat/Basics/basicTypedefs.h"
+
+namespace tudat
+{
+
+namespace ephemerides
+{
+
+//! Class that determines an ephemeris from piecewise Chebyshev polynomials.
+/*!
+ *  Class that determines an ephemeris from piecewise Chebyshev polynomials, in the manner of the JPL DE ephemerides
+ *  (Newhall, 1989). The time interval is divided into segments of equal length, and each of the six Cartesian state
+ *  components is represented by a Chebyshev series of fixed degree on each segment. Since all segments have the same
+ *  length, the segment containing a given time is found by a single division (no search), and the series are evaluated
+ *  by Clenshaw's recurrence for all state components simultaneously, without data-dependent branches.
+ *  The coefficients of all segments are stored in a single contiguous array. The object is not modified when
+ *  evaluating the state, so that it may be used concurrently from multiple threads (e.g. by parallel propagations).
+ *  Objects of this class are typically created by fitting an existing ephemeris (see fitChebyshevEphemeris), and may be
+ *  saved to, and loaded from, a binary file (see writeChebyshevEphemerisToBinaryFile and
+ *  readChebyshevEphemerisFromBinaryFile).
+ */
+class ChebyshevEphemeris: public Ephemeris
+{
+public:
+
+    using Ephemeris::getCartesianState;
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param startTime Start time of first segment.
+     *  \param segmentLength Length (in time) of each segment.
+     *  \param numberOfSegments Number of segments.
+     *  \param polynomialDegree Degree of the Chebyshev series of each segment.
+     *  \param chebyshevCoefficients Chebyshev coefficients, contiguous per segment. For each segment, the coefficients
+     *  of the six state components are stored contiguously for each degree, in order of increasing degree (so that the
+     *  entry of segment i, degree k and component j is at index (i * (polynomialDegree + 1) + k) * 6 + j).
+     *  \param referenceFrameOrigin Origin of reference frame in which state is defined.
+     *  \param referenceFrameOrientation Orientation of reference frame in which state is defined.
+     *  \param positionTolerance Position tolerance w.r.t. the original ephemeris with which the coefficients were fitted
+     *  (NaN if unknown).
+     *  \param velocityTolerance Velocity tolerance w.r.t. the original ephemeris with which the coefficients were fitted
+     *  (NaN if unknown).
+     */
+    ChebyshevEphemeris( const double startTime,
+                        const double segmentLength,
+                        const int numberOfSegments,
+                        const int polynomialDegree,
+                        const std::vector< double >& chebyshevCoefficients,
+                        const std::string& referenceFrameOrigin = "SSB",
+                        const std::string& referenceFrameOrientation = "ECLIPJ2000",
+                        const double positionTolerance = TUDAT_NAN,
+                        const double velocityTolerance = TUDAT_NAN );
+
+    //! Destructor
+    ~ChebyshevEphemeris( ){ }
+
+    //! Get cartesian state from ephemeris.
+    /*!
+     * Returns cartesian state from ephemeris, as evaluated from the Chebyshev series of the segment containing the
+     * requested time.
+     * \param secondsSinceEpoch Seconds since epoch.
+     * \return State in Cartesian elements from ephemeris.
+     */
+    Eigen::Vector6d getCartesianState( const double secondsSinceEpoch );
+
+    //! Function to retrieve the start time of the first segment.
+    /*!
+     * Function to retrieve the start time of the first segment.
+     * \return Start time of the first segment.
+     */
+    double getStartTime( ) const
+    {
+        return startTime_;
+    }
+
+    //! Function to retrieve the end time of the last segment.
+    /*!
+     * Function to retrieve the end time of the last segment.
+     * \return End time of the last segment.
+     */
+    double getEndTime( ) const
+    {
+        return startTime_ + segmentLength_ * static_cast< double >( numberOfSegments_ );
+    }
+
+    //! Function to retrieve the length (in time) of each segment.
+    /*!
+     * Function to retrieve the length (in time) of each segment.
+     * \return Length (in time) of each segment.
+     */
+    double getSegmentLength( ) const
+    {
+        return segmentLength_;
+    }
+
+    //! Function to retrieve the number of segments.
+    /*!
+     * Function to retrieve the number of segments.
+     * \return Number of segments.
+     */
+    int getNumberOfSegments( ) const
+    {
+        return numberOfSegments_;
+    }
+
+    //! Function to retrieve the degree of the Chebyshev series of each segment.
+    /*!
+     * Function to retrieve the degree of the Chebyshev series of each segment.
+     * \return Degree of the Chebyshev series of each segment.
+     */
+    int getPolynomialDegree( ) const
+    {
+        return polynomialDegree_;
+    }
+
+    //! Function to retrieve the Chebyshev coefficients of all segments.
+    /*!
+     * Function to retrieve the Chebyshev coefficients of all segments (see constructor for ordering).
+     * \return Chebyshev coefficients of all segments.
+     */
+    const std::vector< double >& getChebyshevCoefficients( ) const
+    {
+        return chebyshevCoefficients_;
+    }
+
+    //! Function to retrieve the position tolerance with which the coefficients were fitted.
+    /*!
+     * Function to retrieve the position tolerance w.r.t. the original ephemeris with which the coefficients were fitted.
+     * \return Position tolerance with which the coefficients were fitted (NaN if unknown).
+     */
+    double getPositionTolerance( ) const
+    {
+        return positionTolerance_;
+    }
+
+    //! Function to retrieve the velocity tolerance with which the coefficients were fitted.
+    /*!
+     * Function to retrieve the velocity tolerance w.r.t. the original ephemeris with which the coefficients were fitted.
+     * \return Velocity tolerance with which the coefficients were fitted (NaN if unknown).
+     */
+    double getVelocityTolerance( ) const
+    {
+        return velocityTolerance_;
+    }
+
+private:
+
+    //! Start time of first segment.
+    double startTime_;
+
+    //! Length (in time) of each segment.
+    double segmentLength_;
+
+    //! Inverse of segmentLength_.
+    double inverseSegmentLength_;
+
+    //! Number of segments.
+    int numberOfSegments_;
+
+    //! Degree of the Chebyshev series of each segment.
+    int polynomialDegree_;
+
+    //! Chebyshev coefficients, contiguous per segment (see constructor for ordering).
+    std::vector< double > chebyshevCoefficients_;
+
+    //! Position tolerance w.r.t. the original ephemeris with which the coefficients were fitted (NaN if unknown).
+    double positionTolerance_;
+
+    //! Velocity tolerance w.r.t. the original ephemeris with which the coefficients were fitted (NaN if unknown).
+    double velocityTolerance_;
+};
+
+//! Function to compute the Chebyshev coefficients that interpolate a state function on a single segment.
+/*!
+ * Function to compute the Chebyshev coefficients that interpolate a state function at the Chebyshev nodes (roots of the
+ * Chebyshev polynomial of degree polynomialDegree + 1) on a single segment (Press et al., 2002).
+ * \param stateFunction Function returning the state as a function of time.
+ * \param segmentStartTime Start time of segment.
+ * \param segmentLength Length (in time) of segment.
+ * \param polynomialDegree Degree of the Chebyshev series.
+ * \param chebyshevCoefficients Chebyshev coefficients, stored contiguously per degree (returned by reference,
+ * must be pre-allocated with size 6 * ( polynomialDegree + 1 )).
+ */
+void computeSegmentChebyshevCoefficients(
+        const std::function< Eigen::Vector6d( const double ) >& stateFunction,
+        const double segmentStartTime,
+        const double segmentLength,
+        const int polynomialDegree,
+        double* chebyshevCoefficients );
+
+//! Function to create a Chebyshev ephemeris by fitting an existing ephemeris on a given time interval.
+/*!
+ * Function to create a Chebyshev ephemeris by fitting an existing ephemeris on a given time interval. The time interval
+ * is divided into segments of equal length, on each of which the ephemeris is interpolated at the Chebyshev nodes. The
+ * number of segments is determined automatically: starting from a single segment, the number of segments is doubled
+ * until the difference between the Chebyshev ephemeris and the original ephemeris, evaluated at the segment boundaries
+ * and halfway between consecutive nodes of each segment, is below the given tolerances.
+ * The original ephemeris is only evaluated from the calling thread.
+ * \param originalEphemeris Ephemeris that is to be fitted.
+ * \param startTime Start of time interval on which the ephemeris is to be fitted.
+ * \param endTime End of time interval on which the ephemeris is to be fitted.
+ * \param positionTolerance Maximum allowed position difference (norm) w.r.t. original ephemeris.
+ * \param velocityTolerance Maximum allowed velocity difference (norm) w.r.t. original ephemeris.
+ * \param polynomialDegree Degree of the Chebyshev series of each segment.
+ * \param maximumNumberOfSegments Maximum number of segments, an exception is thrown if the tolerances cannot be met with
+ * this number of segments.
+ * \return Chebyshev ephemeris fitted to original ephemeris, with frame origin and orientation of original ephemeris, and
+ * the tolerances with which it was fitted.
+ */
+std::shared_ptr< ChebyshevEphemeris > fitChebyshevEphemeris(
+        const std::shared_ptr< Ephemeris > originalEphemeris,
+        const double startTime,
+        const double endTime,
+        const double positionTolerance,
+        const double velocityTolerance,
+        const int polynomialDegree = 12,
+        const int maximumNumberOfSegments = 1000000 );
+
+//! Function to write a Chebyshev ephemeris to a binary file.
+/*!
+ * Function to write a Chebyshev ephemeris to a binary file, which can be read by readChebyshevEphemerisFromBinaryFile.
+ * The file stores the coefficients in native byte order, and is therefore not portable between platforms of different
+ * endianness. The header of the file contains the time interval, segment length, polynomial degree, frame origin and
+ * orientation, and fit tolerances of the ephemeris, so that a user of the file can check whether it is consistent with
+ * the required settings.
+ * \param chebyshevEphemeris Ephemeris that is to be written to file.
+ * \param fileName Name of file to which ephemeris is to be written.
+ */
+void writeChebyshevEphemerisToBinaryFile(
+        const std::shared_ptr< ChebyshevEphemeris > chebyshevEphemeris,
+        const std::string& fileName );
+
+//! Function to read a Chebyshev ephemeris from a binary file.
+/*!
+ * Function to read a Chebyshev ephemeris from a binary file, as written by writeChebyshevEphemerisToBinaryFile.
+ * \param fileName Name of file from which ephemeris is to be read.
+ * \return Chebyshev ephemeris read from file.
+ */
+std::shared_ptr< ChebyshevEphemeris > readChebyshevEphemerisFromBinaryFile(
+        const std::string& fileName );
+
+} // namespace ephemerides
+
+} // namespace tudat
+
+#endif // TUDAT_CHEBYSHEV_EPHEMERIS_H
@@ -328,6 +328,79 @@ BOOST_AUTO_TEST_CASE( testSphericalGravitationalTorque )
     }
 }
 
+//! Test to check that spherical harmonic torque and acceleration due to the same field share the Legendre recursion.
+BOOST_AUTO_TEST_CASE( testSharedSphericalHarmonicTorqueAndAccelerationKernel )
+{
+    using namespace tudat::simulation_setup;
+    using namespace tudat::basic_astrodynamics;
+    using namespace tudat::gravitation;
+
+    // Load Spice kernels.
+    spice_interface::loadStandardSpiceKernels( );
+
+    // Create bodies.
+    std::vector< std::string > bodiesToCreate;
+    bodiesToCreate.push_back( "Earth" );
+    bodiesToCreate.push_back( "Moon" );
+    std::map< std::string, std::shared_ptr< BodySettings > > bodySettings =
+            getDefaultBodySettings( bodiesToCreate );
+    NamedBodyMap bodyMap = createBodies( bodySettings );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+
+    // Create spherical harmonic acceleration of Moon on Earth, and spherical harmonic torque of Earth on Moon, which
+    // both use the Moon's gravity field at the position of the Earth.
+    SelectedAccelerationMap accelerationSettingsMap;
+    accelerationSettingsMap[ "Earth" ][ "Moon" ].push_back(
+                std::make_shared< SphericalHarmonicAccelerationSettings >( 2, 2 ) );
+    AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodyMap, accelerationSettingsMap, { { "Earth", "SSB" } } );
+    std::shared_ptr< SphericalHarmonicsGravitationalAccelerationModel > sphericalHarmonicAcceleration =
+            std::dynamic_pointer_cast< SphericalHarmonicsGravitationalAccelerationModel >(
+                accelerationModelMap.at( "Earth" ).at( "Moon" ).at( 0 ) );
+
+    SelectedTorqueMap selectedTorqueModelMap;
+    selectedTorqueModelMap[ "Moon" ][ "Earth" ].push_back(
+                std::make_shared< SphericalHarmonicTorqueSettings >( 2, 2 ) );
+    selectedTorqueModelMap[ "Moon" ][ "Earth" ].push_back(
+                std::make_shared< TorqueSettings >( second_order_gravitational_torque ) );
+    basic_astrodynamics::TorqueModelMap torqueModelMap = createTorqueModelsMap(
+                bodyMap, selectedTorqueModelMap, { "Moon" } );
+    std::shared_ptr< SphericalHarmonicGravitationalTorqueModel > sphericalHarmonicTorque =
+            std::dynamic_pointer_cast< SphericalHarmonicGravitationalTorqueModel >(
+                torqueModelMap.at( "Moon" ).at( "Earth" ).at( 0 ) );
+    std::shared_ptr< TorqueModel > secondDegreeGravitationalTorque = torqueModelMap.at( "Moon" ).at( "Earth" ).at( 1 );
+    bodyMap.at( "Moon" )->setBodyInertiaTensorFromGravityField( 0.0 );
+
+    // Check that torque (which does not use the degree zero term) and acceleration share a kernel.
+    std::shared_ptr< SphericalHarmonicsAccelerationKernel > sharedKernel =
+            sphericalHarmonicAcceleration->getAccelerationKernel( );
+    BOOST_CHECK_EQUAL( sharedKernel, sphericalHarmonicTorque->getSphericalHarmonicAcceleration( )->getAccelerationKernel( ) );
+
+    // Check that the sums are evaluated once per epoch for both models
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        double evaluationTime = static_cast< double >( i ) * tudat::physical_constants::JULIAN_DAY / 2.0;
+        bodyMap.at( "Earth" )->setStateFromEphemeris( evaluationTime );
+        bodyMap.at( "Earth" )->setCurrentRotationalStateToLocalFrameFromEphemeris( evaluationTime );
+        bodyMap.at( "Moon" )->setStateFromEphemeris( evaluationTime );
+        bodyMap.at( "Moon" )->setCurrentRotationalStateToLocalFrameFromEphemeris( evaluationTime );
+
+        int numberOfEvaluations = sharedKernel->getNumberOfEvaluations( );
+        sphericalHarmonicAcceleration->updateMembers( evaluationTime );
+        sphericalHarmonicTorque->updateMembers( evaluationTime );
+        BOOST_CHECK_EQUAL( sharedKernel->getNumberOfEvaluations( ), numberOfEvaluations + 1 );
+
+        // Check torque computed with shared kernel against explicit second degree torque.
+        secondDegreeGravitationalTorque->updateMembers( evaluationTime );
+        Eigen::Vector3d expectedTorque = secondDegreeGravitationalTorque->getTorque( );
+        Eigen::Vector3d currentTorque = sphericalHarmonicTorque->getTorque( );
+        for( unsigned int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK_SMALL( std::fabs( currentTorque( j ) - expectedTorque( j ) ), 1.0E-14 * expectedTorque.norm( ) );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
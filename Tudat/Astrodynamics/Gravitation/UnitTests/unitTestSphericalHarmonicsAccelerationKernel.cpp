@@ -0,0 +1,315 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/Gravitation/sphericalHarmonicsAccelerationKernel.h"
+#include "Tudat/Astrodynamics/Gravitation/sphericalHarmonicsGravityModel.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::gravitation;
+
+//! Generate random geodesy-normalized coefficients, with magnitude following Kaula's rule.
+void getRandomSphericalHarmonicCoefficients( const int maximumDegree, const int maximumOrder,
+                                             Eigen::MatrixXd& cosineCoefficients, Eigen::MatrixXd& sineCoefficients )
+{
+    std::mt19937 randomNumberGenerator( maximumDegree * 1000 + maximumOrder );
+    std::normal_distribution< double > distribution( 0.0, 1.0 );
+
+    cosineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumOrder + 1 );
+    sineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumOrder + 1 );
+    cosineCoefficients( 0, 0 ) = 1.0;
+    for( int degree = 1; degree <= maximumDegree; degree++ )
+    {
+        for( int order = 0; ( order <= degree ) && ( order <= maximumOrder ); order++ )
+        {
+            cosineCoefficients( degree, order ) = 1.0E-3 / ( degree * degree ) * distribution( randomNumberGenerator );
+            if( order > 0 )
+            {
+                sineCoefficients( degree, order ) = 1.0E-3 / ( degree * degree ) * distribution( randomNumberGenerator );
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE( test_spherical_harmonics_acceleration_kernel )
+
+//! Test kernel (generic, compile-time specialized and Clenshaw implementation) against existing acceleration function.
+BOOST_AUTO_TEST_CASE( testSphericalHarmonicsAccelerationKernel )
+{
+    const double gravitationalParameter = 3.986004418E14;
+    const double referenceRadius = 6378137.0;
+
+    std::vector< Eigen::Vector3d > positions;
+    positions.push_back( Eigen::Vector3d( 7.0E6, -1.2E6, 3.1E6 ) );
+    positions.push_back( Eigen::Vector3d( -2.0E6, 5.0E6, -6.5E6 ) );
+    positions.push_back( Eigen::Vector3d( 1.0E5, 2.0E5, 7.2E6 ) );
+    positions.push_back( Eigen::Vector3d( -6.9E6, 0.0, 0.0 ) );
+
+    std::vector< std::pair< int, int > > degreesAndOrders =
+    { { 0, 0 }, { 2, 0 }, { 3, 3 }, { 4, 0 }, { 6, 6 }, { 7, 5 }, { 8, 8 }, { 20, 20 }, { 50, 13 }, { 70, 70 } };
+
+    for( unsigned int i = 0; i < degreesAndOrders.size( ); i++ )
+    {
+        const int maximumDegree = degreesAndOrders.at( i ).first;
+        const int maximumOrder = degreesAndOrders.at( i ).second;
+
+        Eigen::MatrixXd cosineCoefficients, sineCoefficients;
+        getRandomSphericalHarmonicCoefficients( maximumDegree, maximumOrder, cosineCoefficients, sineCoefficients );
+
+        std::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache =
+                std::make_shared< basic_mathematics::SphericalHarmonicsCache >( maximumDegree + 1, maximumOrder + 2 );
+        std::map< std::pair< int, int >, Eigen::Vector3d > accelerationPerTerm;
+
+        SphericalHarmonicsAccelerationKernel accelerationKernel( cosineCoefficients, sineCoefficients );
+        BOOST_CHECK_EQUAL( accelerationKernel.getMaximumDegree( ), maximumDegree );
+        BOOST_CHECK_EQUAL( accelerationKernel.getMaximumOrder( ), maximumOrder );
+
+        for( unsigned int j = 0; j < positions.size( ); j++ )
+        {
+            Eigen::Vector3d expectedAcceleration = computeGeodesyNormalizedGravitationalAccelerationSum(
+                        positions.at( j ), gravitationalParameter, referenceRadius, cosineCoefficients, sineCoefficients,
+                        sphericalHarmonicsCache, accelerationPerTerm );
+
+            // Check (where available) compile-time specialized, generic and Clenshaw implementation.
+            for( unsigned int k = 0; k < 3; k++ )
+            {
+                accelerationKernel.setUseFixedSizeEvaluation( k == 0 );
+                accelerationKernel.setSummationMethod( ( k == 2 ) ? clenshaw_summation : forward_recursion_summation );
+                Eigen::Vector3d computedAcceleration = accelerationKernel.computeAcceleration(
+                            positions.at( j ), gravitationalParameter, referenceRadius );
+                for( int l = 0; l < 3; l++ )
+                {
+                    BOOST_CHECK_SMALL( computedAcceleration( l ) - expectedAcceleration( l ),
+                                       1.0E-14 * expectedAcceleration.norm( ) );
+                }
+            }
+        }
+    }
+
+    // Check whether compile-time specialized implementation is used for small fields only.
+    Eigen::MatrixXd cosineCoefficients, sineCoefficients;
+    getRandomSphericalHarmonicCoefficients( 4, 4, cosineCoefficients, sineCoefficients );
+    SphericalHarmonicsAccelerationKernel accelerationKernel( cosineCoefficients, sineCoefficients );
+    BOOST_CHECK_EQUAL( accelerationKernel.isFixedSizeEvaluationUsed( ), true );
+    accelerationKernel.setUseFixedSizeEvaluation( false );
+    BOOST_CHECK_EQUAL( accelerationKernel.isFixedSizeEvaluationUsed( ), false );
+    accelerationKernel.setUseFixedSizeEvaluation( true );
+    accelerationKernel.setSummationMethod( clenshaw_summation );
+    BOOST_CHECK_EQUAL( accelerationKernel.isFixedSizeEvaluationUsed( ), false );
+    accelerationKernel.setSummationMethod( forward_recursion_summation );
+
+    getRandomSphericalHarmonicCoefficients( 30, 30, cosineCoefficients, sineCoefficients );
+    accelerationKernel.resetCoefficients( cosineCoefficients, sineCoefficients );
+    BOOST_CHECK_EQUAL( accelerationKernel.isFixedSizeEvaluationUsed( ), false );
+
+    // Check that coefficients are only reset when changed.
+    BOOST_CHECK_EQUAL( accelerationKernel.updateCoefficients( cosineCoefficients, sineCoefficients ), false );
+    cosineCoefficients( 5, 3 ) += 1.0E-10;
+    BOOST_CHECK_EQUAL( accelerationKernel.updateCoefficients( cosineCoefficients, sineCoefficients ), true );
+    BOOST_CHECK_EQUAL( accelerationKernel.updateCoefficients( cosineCoefficients.block( 0, 0, 10, 10 ),
+                                                              sineCoefficients.block( 0, 0, 10, 10 ) ), true );
+    BOOST_CHECK_EQUAL( accelerationKernel.getMaximumDegree( ), 9 );
+
+    // Check that inconsistent input is rejected.
+    BOOST_CHECK_THROW( accelerationKernel.resetCoefficients( cosineCoefficients, sineCoefficients.block( 0, 0, 10, 10 ) ),
+                       std::runtime_error );
+}
+
+//! Test kernel for high-degree field, and consistency with acceleration model computing separate terms.
+BOOST_AUTO_TEST_CASE( testHighDegreeSphericalHarmonicsAcceleration )
+{
+    const double gravitationalParameter = 3.986004418E14;
+    const double referenceRadius = 6378137.0;
+    const int maximumDegree = 360;
+
+    Eigen::MatrixXd cosineCoefficients, sineCoefficients;
+    getRandomSphericalHarmonicCoefficients( maximumDegree, maximumDegree, cosineCoefficients, sineCoefficients );
+
+    Eigen::Vector3d position( 4.0E6, 3.0E6, 4.5E6 );
+    Eigen::Quaterniond rotationToInertialFrame =
+            Eigen::Quaterniond( Eigen::AngleAxisd( 0.3, Eigen::Vector3d::UnitZ( ) ) );
+
+    // Create acceleration model, and compute acceleration both with and without saving separate terms.
+    SphericalHarmonicsGravitationalAccelerationModel accelerationModel(
+                [ = ]( ){ return position; }, gravitationalParameter, referenceRadius,
+                cosineCoefficients, sineCoefficients, [ ]( ){ return Eigen::Vector3d::Zero( ); },
+                [ = ]( ){ return rotationToInertialFrame; } );
+    Eigen::Vector3d kernelAcceleration = accelerationModel.getAcceleration( );
+
+    accelerationModel.setSphericalHarmonicsSummationMethod( clenshaw_summation );
+    accelerationModel.resetTime( TUDAT_NAN );
+    accelerationModel.updateMembers( 0.0 );
+    Eigen::Vector3d clenshawAcceleration = accelerationModel.getAcceleration( );
+
+    accelerationModel.setSaveSphericalHarmonicTermsSeparately( true );
+    accelerationModel.resetTime( TUDAT_NAN );
+    accelerationModel.updateMembers( 0.0 );
+    Eigen::Vector3d referenceAcceleration = accelerationModel.getAcceleration( );
+
+    for( int i = 0; i < 3; i++ )
+    {
+        BOOST_CHECK_SMALL( kernelAcceleration( i ) - referenceAcceleration( i ), 1.0E-13 * referenceAcceleration.norm( ) );
+        BOOST_CHECK_SMALL( clenshawAcceleration( i ) - referenceAcceleration( i ), 1.0E-13 * referenceAcceleration.norm( ) );
+    }
+}
+
+//! Test sharing of kernel between acceleration models for the same pair of bodies.
+BOOST_AUTO_TEST_CASE( testSharedSphericalHarmonicsAccelerationKernel )
+{
+    const double gravitationalParameter = 3.986004418E14;
+    const double referenceRadius = 6378137.0;
+
+    Eigen::MatrixXd cosineCoefficients, sineCoefficients;
+    getRandomSphericalHarmonicCoefficients( 20, 20, cosineCoefficients, sineCoefficients );
+
+    Eigen::Vector3d position( 4.0E6, 3.0E6, 4.5E6 );
+    std::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sharedCache =
+            std::make_shared< basic_mathematics::SphericalHarmonicsCache >( );
+    std::shared_ptr< SphericalHarmonicsAccelerationKernel > sharedKernel =
+            std::make_shared< SphericalHarmonicsAccelerationKernel >( );
+
+    // Create two models sharing cache and kernel, and one model with its own cache and kernel.
+    std::vector< std::shared_ptr< SphericalHarmonicsGravitationalAccelerationModel > > accelerationModels;
+    for( int i = 0; i < 3; i++ )
+    {
+        accelerationModels.push_back(
+                    std::make_shared< SphericalHarmonicsGravitationalAccelerationModel >(
+                        [ & ]( ){ return position; }, gravitationalParameter, referenceRadius,
+                        cosineCoefficients, sineCoefficients, [ ]( ){ return Eigen::Vector3d::Zero( ); },
+                        [ ]( ){ return Eigen::Quaterniond( Eigen::Matrix3d::Identity( ) ); }, false,
+                        ( i < 2 ) ? sharedCache : std::make_shared< basic_mathematics::SphericalHarmonicsCache >( ),
+                        ( i < 2 ) ? sharedKernel : nullptr ) );
+    }
+    BOOST_CHECK_EQUAL( accelerationModels.at( 0 )->getAccelerationKernel( ), sharedKernel );
+    BOOST_CHECK_EQUAL( accelerationModels.at( 1 )->getSphericalHarmonicsCache( ), sharedCache );
+    BOOST_CHECK( accelerationModels.at( 2 )->getAccelerationKernel( ) != sharedKernel );
+
+    // Check that size of shared cache is not increased by additional models.
+    BOOST_CHECK_EQUAL( sharedCache->getMaximumDegree( ),
+                       accelerationModels.at( 2 )->getSphericalHarmonicsCache( )->getMaximumDegree( ) );
+    BOOST_CHECK_EQUAL( sharedCache->getMaximumOrder( ),
+                       accelerationModels.at( 2 )->getSphericalHarmonicsCache( )->getMaximumOrder( ) );
+
+    // Check that models give identical results, also when position changes.
+    for( int i = 0; i < 2; i++ )
+    {
+        for( unsigned int j = 0; j < accelerationModels.size( ); j++ )
+        {
+            accelerationModels.at( j )->resetTime( TUDAT_NAN );
+            accelerationModels.at( j )->updateMembers( static_cast< double >( i ) );
+        }
+        for( int k = 0; k < 3; k++ )
+        {
+            BOOST_CHECK_EQUAL( accelerationModels.at( 0 )->getAcceleration( )( k ),
+                               accelerationModels.at( 1 )->getAcceleration( )( k ) );
+            BOOST_CHECK_EQUAL( accelerationModels.at( 0 )->getAcceleration( )( k ),
+                               accelerationModels.at( 2 )->getAcceleration( )( k ) );
+        }
+        position *= 1.1;
+    }
+
+    // Check that repeated evaluation with identical input returns identical result, and changed coefficients are used.
+    const Eigen::Vector3d acceleration = sharedKernel->computeAcceleration(
+                position, gravitationalParameter, referenceRadius );
+    BOOST_CHECK_EQUAL( ( sharedKernel->computeAcceleration( position, gravitationalParameter, referenceRadius ) -
+                         acceleration ).norm( ), 0.0 );
+    cosineCoefficients( 2, 0 ) += 1.0E-3;
+    sharedKernel->updateCoefficients( cosineCoefficients, sineCoefficients );
+    BOOST_CHECK( ( sharedKernel->computeAcceleration( position, gravitationalParameter, referenceRadius ) -
+                   acceleration ).norm( ) > 0.0 );
+}
+
+//! Test sharing of kernel between models with different degree zero term, gravitational parameter and summation method.
+BOOST_AUTO_TEST_CASE( testSharedSphericalHarmonicsAccelerationKernelSettings )
+{
+    const double gravitationalParameter = 3.986004418E14;
+    const double referenceRadius = 6378137.0;
+
+    Eigen::MatrixXd cosineCoefficients, sineCoefficients;
+    getRandomSphericalHarmonicCoefficients( 20, 20, cosineCoefficients, sineCoefficients );
+    Eigen::MatrixXd cosineCoefficientsWithoutDegreeZero = cosineCoefficients;
+    cosineCoefficientsWithoutDegreeZero( 0, 0 ) = 0.0;
+
+    Eigen::Vector3d position( 4.0E6, 3.0E6, 4.5E6 );
+    std::shared_ptr< SphericalHarmonicsAccelerationKernel > sharedKernel =
+            std::make_shared< SphericalHarmonicsAccelerationKernel >( );
+
+    // Create models sharing kernel: with and without degree zero term, and with different gravitational parameter.
+    std::shared_ptr< SphericalHarmonicsGravitationalAccelerationModel > fullModel =
+            std::make_shared< SphericalHarmonicsGravitationalAccelerationModel >(
+                [ & ]( ){ return position; }, gravitationalParameter, referenceRadius,
+                cosineCoefficients, sineCoefficients, [ ]( ){ return Eigen::Vector3d::Zero( ); },
+                [ ]( ){ return Eigen::Quaterniond( Eigen::Matrix3d::Identity( ) ); }, false,
+                std::make_shared< basic_mathematics::SphericalHarmonicsCache >( ), sharedKernel );
+    std::shared_ptr< SphericalHarmonicsGravitationalAccelerationModel > truncatedModel =
+            std::make_shared< SphericalHarmonicsGravitationalAccelerationModel >(
+                [ & ]( ){ return position; }, 2.0 * gravitationalParameter, referenceRadius,
+                cosineCoefficientsWithoutDegreeZero, sineCoefficients, [ ]( ){ return Eigen::Vector3d::Zero( ); },
+                [ ]( ){ return Eigen::Quaterniond( Eigen::Matrix3d::Identity( ) ); }, false,
+                std::make_shared< basic_mathematics::SphericalHarmonicsCache >( ), sharedKernel );
+
+    // Check that both models are evaluated with a single evaluation of the sums, and that results are consistent.
+    position *= 1.1;
+    int numberOfEvaluations = sharedKernel->getNumberOfEvaluations( );
+    fullModel->updateMembers( 1.0 );
+    truncatedModel->updateMembers( 1.0 );
+    BOOST_CHECK_EQUAL( sharedKernel->getNumberOfEvaluations( ), numberOfEvaluations + 1 );
+
+    const Eigen::Vector3d centralAcceleration =
+            -gravitationalParameter * position / ( position.norm( ) * position.norm( ) * position.norm( ) );
+    for( int i = 0; i < 3; i++ )
+    {
+        BOOST_CHECK_SMALL( truncatedModel->getAcceleration( )( i ) -
+                           2.0 * ( fullModel->getAcceleration( )( i ) - centralAcceleration( i ) ),
+                           1.0E-14 * centralAcceleration.norm( ) );
+    }
+
+    // Check that coefficients are not reset if only degree zero term differs.
+    BOOST_CHECK_EQUAL( sharedKernel->updateCoefficients( cosineCoefficients, sineCoefficients ), false );
+    BOOST_CHECK_EQUAL( sharedKernel->updateCoefficients( cosineCoefficientsWithoutDegreeZero, sineCoefficients ), false );
+
+    // Check that summation method is set per model, and not for the shared kernel.
+    truncatedModel->setSphericalHarmonicsSummationMethod( clenshaw_summation );
+    BOOST_CHECK_EQUAL( fullModel->getSphericalHarmonicsSummationMethod( ), forward_recursion_summation );
+    BOOST_CHECK_EQUAL( sharedKernel->getSummationMethod( ), forward_recursion_summation );
+
+    position *= 1.1;
+    numberOfEvaluations = sharedKernel->getNumberOfEvaluations( );
+    fullModel->updateMembers( 2.0 );
+    const Eigen::Vector3d forwardRecursionAcceleration = sharedKernel->computeAcceleration(
+                position, gravitationalParameter, referenceRadius, forward_recursion_summation );
+    truncatedModel->updateMembers( 2.0 );
+    BOOST_CHECK_EQUAL( sharedKernel->getNumberOfEvaluations( ), numberOfEvaluations + 2 );
+    for( int i = 0; i < 3; i++ )
+    {
+        BOOST_CHECK_EQUAL( fullModel->getAcceleration( )( i ), forwardRecursionAcceleration( i ) );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
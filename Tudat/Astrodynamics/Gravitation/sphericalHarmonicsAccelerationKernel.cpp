@@ -0,0 +1,495 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "Tudat/Astrodynamics/Gravitation/sphericalHarmonicsAccelerationKernel.h"
+
+namespace tudat
+{
+
+namespace gravitation
+{
+
+const int SphericalHarmonicsAccelerationKernel::orderBlockSize;
+
+//! Function to compute the coefficients of the column-wise recursion of geodesy-normalized Legendre polynomials.
+void getGeodesyNormalizedLegendreRecursionCoefficients(
+        const int degree, const int order,
+        double& firstRecursionCoefficient, double& secondRecursionCoefficient, double& derivativeCoefficient )
+{
+    const double doubleDegree = static_cast< double >( degree );
+    const double doubleOrder = static_cast< double >( order );
+
+    firstRecursionCoefficient = 0.0;
+    secondRecursionCoefficient = 0.0;
+    derivativeCoefficient = 0.0;
+
+    if( degree > order )
+    {
+        firstRecursionCoefficient = std::sqrt(
+                    ( 2.0 * doubleDegree + 1.0 ) * ( 2.0 * doubleDegree - 1.0 ) /
+                    ( ( doubleDegree - doubleOrder ) * ( doubleDegree + doubleOrder ) ) );
+        derivativeCoefficient = std::sqrt(
+                    ( 2.0 * doubleDegree + 1.0 ) * ( doubleDegree + doubleOrder ) * ( doubleDegree - doubleOrder ) /
+                    ( 2.0 * doubleDegree - 1.0 ) );
+    }
+
+    if( degree > order + 1 )
+    {
+        secondRecursionCoefficient = std::sqrt(
+                    ( 2.0 * doubleDegree + 1.0 ) * ( doubleDegree + doubleOrder - 1.0 ) *
+                    ( doubleDegree - doubleOrder - 1.0 ) /
+                    ( ( 2.0 * doubleDegree - 3.0 ) * ( doubleDegree + doubleOrder ) *
+                      ( doubleDegree - doubleOrder ) ) );
+    }
+}
+
+//! Function to compute the sectoral geodesy-normalized Legendre polynomial, divided by cos(latitude)^order
+double getScaledSectoralGeodesyLegendrePolynomial( const int order )
+{
+    double sectoralPolynomial = 1.0;
+    if( order > 0 )
+    {
+        sectoralPolynomial = std::sqrt( 3.0 );
+    }
+
+    for( int currentOrder = 2; currentOrder <= order; currentOrder++ )
+    {
+        sectoralPolynomial *= std::sqrt( ( 2.0 * static_cast< double >( currentOrder ) + 1.0 ) /
+                                         ( 2.0 * static_cast< double >( currentOrder ) ) );
+    }
+    return sectoralPolynomial;
+}
+
+//! Function to retrieve the compile-time specialized acceleration function for a given field size (nullptr if none).
+SphericalHarmonicsAccelerationKernel::FixedSizeAccelerationFunction getFixedSizeAccelerationFunction(
+        const int maximumDegree, const int maximumOrder )
+{
+    SphericalHarmonicsAccelerationKernel::FixedSizeAccelerationFunction accelerationFunction = nullptr;
+    if( maximumOrder == 0 )
+    {
+        switch( maximumDegree )
+        {
+        case 2:
+            accelerationFunction = &computeFixedSizeGeodesyNormalizedGravitationalAcceleration< 2, 0 >;
+            break;
+        case 3:
+            accelerationFunction = &computeFixedSizeGeodesyNormalizedGravitationalAcceleration< 3, 0 >;
+            break;
+        case 4:
+            accelerationFunction = &computeFixedSizeGeodesyNormalizedGravitationalAcceleration< 4, 0 >;
+            break;
+        case 5:
+            accelerationFunction = &computeFixedSizeGeodesyNormalizedGravitationalAcceleration< 5, 0 >;
+            break;
+        case 6:
+            accelerationFunction = &computeFixedSizeGeodesyNormalizedGravitationalAcceleration< 6, 0 >;
+            break;
+        default:
+            break;
+        }
+    }
+    else if( maximumOrder == maximumDegree )
+    {
+        switch( maximumDegree )
+        {
+        case 2:
+            accelerationFunction = &computeFixedSizeGeodesyNormalizedGravitationalAcceleration< 2, 2 >;
+            break;
+        case 3:
+            accelerationFunction = &computeFixedSizeGeodesyNormalizedGravitationalAcceleration< 3, 3 >;
+            break;
+        case 4:
+            accelerationFunction = &computeFixedSizeGeodesyNormalizedGravitationalAcceleration< 4, 4 >;
+            break;
+        case 5:
+            accelerationFunction = &computeFixedSizeGeodesyNormalizedGravitationalAcceleration< 5, 5 >;
+            break;
+        case 6:
+            accelerationFunction = &computeFixedSizeGeodesyNormalizedGravitationalAcceleration< 6, 6 >;
+            break;
+        case 8:
+            accelerationFunction = &computeFixedSizeGeodesyNormalizedGravitationalAcceleration< 8, 8 >;
+            break;
+        default:
+            break;
+        }
+    }
+    return accelerationFunction;
+}
+
+//! Function to reset the spherical harmonic coefficients, and (re)compute the packed coefficients.
+void SphericalHarmonicsAccelerationKernel::resetCoefficients(
+        const Eigen::MatrixXd& cosineHarmonicCoefficients,
+        const Eigen::MatrixXd& sineHarmonicCoefficients )
+{
+    if( cosineHarmonicCoefficients.rows( ) != sineHarmonicCoefficients.rows( ) ||
+            cosineHarmonicCoefficients.cols( ) != sineHarmonicCoefficients.cols( ) )
+    {
+        throw std::runtime_error( "Error when setting spherical harmonic acceleration kernel, coefficient sizes are inconsistent" );
+    }
+
+    if( cosineHarmonicCoefficients.rows( ) == 0 || cosineHarmonicCoefficients.cols( ) == 0 )
+    {
+        throw std::runtime_error( "Error when setting spherical harmonic acceleration kernel, no coefficients provided" );
+    }
+
+    // Degree zero term is added separately, and not included in sums.
+    cosineHarmonicCoefficients_ = cosineHarmonicCoefficients;
+    cosineHarmonicCoefficients_( 0, 0 ) = 0.0;
+    degreeZeroCosineCoefficient_ = cosineHarmonicCoefficients( 0, 0 );
+    sineHarmonicCoefficients_ = sineHarmonicCoefficients;
+
+    maximumDegree_ = static_cast< int >( cosineHarmonicCoefficients.rows( ) ) - 1;
+    maximumOrder_ = std::min( static_cast< int >( cosineHarmonicCoefficients.cols( ) ) - 1, maximumDegree_ );
+    numberOfOrderBlocks_ = ( maximumOrder_ + orderBlockSize ) / orderBlockSize;
+
+    const int paddedNumberOfOrders = numberOfOrderBlocks_ * orderBlockSize;
+
+    // Pack coefficients per block of orders.
+    orderBlockStartIndices_.resize( numberOfOrderBlocks_ );
+    packedCoefficients_.clear( );
+    for( int block = 0; block < numberOfOrderBlocks_; block++ )
+    {
+        orderBlockStartIndices_[ block ] = static_cast< int >( packedCoefficients_.size( ) );
+
+        const int firstOrder = block * orderBlockSize;
+        for( int degree = firstOrder; degree <= maximumDegree_; degree++ )
+        {
+            const int currentIndex = static_cast< int >( packedCoefficients_.size( ) );
+            packedCoefficients_.resize( currentIndex + 5 * orderBlockSize, 0.0 );
+
+            for( int i = 0; i < orderBlockSize; i++ )
+            {
+                const int order = firstOrder + i;
+                if( order <= maximumOrder_ )
+                {
+                    getGeodesyNormalizedLegendreRecursionCoefficients(
+                                degree, order,
+                                packedCoefficients_[ currentIndex + i ],
+                                packedCoefficients_[ currentIndex + orderBlockSize + i ],
+                                packedCoefficients_[ currentIndex + 2 * orderBlockSize + i ] );
+                    if( degree >= order )
+                    {
+                        packedCoefficients_[ currentIndex + 3 * orderBlockSize + i ] =
+                                cosineHarmonicCoefficients_( degree, order );
+                        packedCoefficients_[ currentIndex + 4 * orderBlockSize + i ] =
+                                sineHarmonicCoefficients( degree, order );
+                    }
+                }
+            }
+        }
+    }
+
+    scaledSectoralPolynomials_.resize( paddedNumberOfOrders );
+    for( int order = 0; order < paddedNumberOfOrders; order++ )
+    {
+        scaledSectoralPolynomials_[ order ] =
+                ( order <= maximumOrder_ ) ? getScaledSectoralGeodesyLegendrePolynomial( order ) : 0.0;
+    }
+
+    // Allocate scratch memory used during evaluation.
+    radiusRatioPowers_.resize( maximumDegree_ + 1 );
+    cosinesOfOrderLongitude_.resize( paddedNumberOfOrders );
+    sinesOfOrderLongitude_.resize( paddedNumberOfOrders );
+    cosineOfLatitudePowers_.resize( paddedNumberOfOrders );
+
+    fixedSizeAccelerationFunction_ = getFixedSizeAccelerationFunction( maximumDegree_, maximumOrder_ );
+
+    resetLastEvaluation( );
+}
+
+//! Function to reset the spherical harmonic coefficients, only if they differ from the current coefficients.
+bool SphericalHarmonicsAccelerationKernel::updateCoefficients(
+        const Eigen::MatrixXd& cosineHarmonicCoefficients,
+        const Eigen::MatrixXd& sineHarmonicCoefficients )
+{
+    bool coefficientsChanged = false;
+    if( cosineHarmonicCoefficients.rows( ) != cosineHarmonicCoefficients_.rows( ) ||
+            cosineHarmonicCoefficients.cols( ) != cosineHarmonicCoefficients_.cols( ) ||
+            sineHarmonicCoefficients.rows( ) != sineHarmonicCoefficients_.rows( ) ||
+            sineHarmonicCoefficients.cols( ) != sineHarmonicCoefficients_.cols( ) )
+    {
+        coefficientsChanged = true;
+    }
+    else
+    {
+        // Compare all coefficients, except degree zero cosine coefficient.
+        const int numberOfRows = static_cast< int >( cosineHarmonicCoefficients.rows( ) );
+        const int numberOfColumns = static_cast< int >( cosineHarmonicCoefficients.cols( ) );
+        if( sineHarmonicCoefficients != sineHarmonicCoefficients_ ||
+                cosineHarmonicCoefficients.bottomRows( numberOfRows - 1 ) !=
+                cosineHarmonicCoefficients_.bottomRows( numberOfRows - 1 ) ||
+                cosineHarmonicCoefficients.row( 0 ).tail( numberOfColumns - 1 ) !=
+                cosineHarmonicCoefficients_.row( 0 ).tail( numberOfColumns - 1 ) )
+        {
+            coefficientsChanged = true;
+        }
+    }
+
+    if( coefficientsChanged )
+    {
+        resetCoefficients( cosineHarmonicCoefficients, sineHarmonicCoefficients );
+    }
+    else
+    {
+        degreeZeroCosineCoefficient_ = cosineHarmonicCoefficients( 0, 0 );
+    }
+    return coefficientsChanged;
+}
+
+//! Function to compute the gravitational acceleration in the body-fixed frame of the field.
+Eigen::Vector3d SphericalHarmonicsAccelerationKernel::computeAcceleration(
+        const Eigen::Vector3d& positionOfBodySubjectToAcceleration,
+        const double gravitationalParameter,
+        const double referenceRadius,
+        const SphericalHarmonicsSummationMethod summationMethod )
+{
+    if( maximumDegree_ < 0 )
+    {
+        throw std::runtime_error( "Error when computing spherical harmonic acceleration with kernel, no coefficients set" );
+    }
+
+    // Check if sums need to be recomputed.
+    if( !( positionOfBodySubjectToAcceleration == lastPosition_ ) ||
+            !( referenceRadius == lastReferenceRadius_ ) ||
+            !( summationMethod == lastSummationMethod_ ) )
+    {
+        lastUnitAcceleration_ = evaluateAcceleration(
+                    positionOfBodySubjectToAcceleration, 1.0, referenceRadius, summationMethod );
+        lastPosition_ = positionOfBodySubjectToAcceleration;
+        lastReferenceRadius_ = referenceRadius;
+        lastSummationMethod_ = summationMethod;
+        numberOfEvaluations_++;
+    }
+
+    // Add degree zero term, and scale with gravitational parameter.
+    const double distance = positionOfBodySubjectToAcceleration.norm( );
+    return gravitationalParameter * ( lastUnitAcceleration_ - degreeZeroCosineCoefficient_ /
+                                      ( distance * distance * distance ) * positionOfBodySubjectToAcceleration );
+}
+
+//! Function to evaluate the gravitational acceleration in the body-fixed frame of the field.
+Eigen::Vector3d SphericalHarmonicsAccelerationKernel::evaluateAcceleration(
+        const Eigen::Vector3d& positionOfBodySubjectToAcceleration,
+        const double gravitationalParameter,
+        const double referenceRadius,
+        const SphericalHarmonicsSummationMethod summationMethod )
+{
+    if( isFixedSizeEvaluationUsed( summationMethod ) )
+    {
+        return fixedSizeAccelerationFunction_(
+                    positionOfBodySubjectToAcceleration, gravitationalParameter, referenceRadius,
+                    cosineHarmonicCoefficients_, sineHarmonicCoefficients_ );
+    }
+
+    // Compute (trigonometric functions of) spherical coordinates.
+    const double xyDistance = std::sqrt( positionOfBodySubjectToAcceleration( 0 ) * positionOfBodySubjectToAcceleration( 0 ) +
+                                         positionOfBodySubjectToAcceleration( 1 ) * positionOfBodySubjectToAcceleration( 1 ) );
+    const double distance = positionOfBodySubjectToAcceleration.norm( );
+    const double sineOfLatitude = positionOfBodySubjectToAcceleration( 2 ) / distance;
+    const double cosineOfLatitude = xyDistance / distance;
+    const double cosineOfLongitude = ( xyDistance > 0.0 ) ? positionOfBodySubjectToAcceleration( 0 ) / xyDistance : 1.0;
+    const double sineOfLongitude = ( xyDistance > 0.0 ) ? positionOfBodySubjectToAcceleration( 1 ) / xyDistance : 0.0;
+
+    // Compute degree- and order-dependent terms.
+    radiusRatioPowers_[ 0 ] = referenceRadius / distance;
+    for( int degree = 1; degree <= maximumDegree_; degree++ )
+    {
+        radiusRatioPowers_[ degree ] = radiusRatioPowers_[ degree - 1 ] * radiusRatioPowers_[ 0 ];
+    }
+
+    cosinesOfOrderLongitude_[ 0 ] = 1.0;
+    sinesOfOrderLongitude_[ 0 ] = 0.0;
+    cosineOfLatitudePowers_[ 0 ] = 1.0;
+    for( int order = 1; order <= maximumOrder_; order++ )
+    {
+        cosinesOfOrderLongitude_[ order ] = cosinesOfOrderLongitude_[ order - 1 ] * cosineOfLongitude -
+                sinesOfOrderLongitude_[ order - 1 ] * sineOfLongitude;
+        sinesOfOrderLongitude_[ order ] = sinesOfOrderLongitude_[ order - 1 ] * cosineOfLongitude +
+                cosinesOfOrderLongitude_[ order - 1 ] * sineOfLongitude;
+        cosineOfLatitudePowers_[ order ] = cosineOfLatitudePowers_[ order - 1 ] * cosineOfLatitude;
+    }
+
+    Eigen::Vector3d sphericalGradient = Eigen::Vector3d::Zero( );
+    OrderBlockSums orderBlockSums;
+    for( int block = 0; block < numberOfOrderBlocks_; block++ )
+    {
+        const int firstOrder = block * orderBlockSize;
+        if( summationMethod == clenshaw_summation )
+        {
+            computeOrderBlockSumsWithClenshawSummation( block, sineOfLatitude, orderBlockSums );
+        }
+        else
+        {
+            computeOrderBlockSumsWithForwardRecursion( block, sineOfLatitude, orderBlockSums );
+        }
+
+        // Add contributions of orders in block to gradient.
+        for( int i = 0; ( i < orderBlockSize ) && ( firstOrder + i <= maximumOrder_ ); i++ )
+        {
+            const int order = firstOrder + i;
+            const double cosineOfLatitudeDerivativePower =
+                    ( order == 0 ) ? ( 1.0 / cosineOfLatitude ) : cosineOfLatitudePowers_[ order - 1 ];
+
+            sphericalGradient( 0 ) += cosineOfLatitudePowers_[ order ] * (
+                        orderBlockSums( i, 0 ) * cosinesOfOrderLongitude_[ order ] +
+                        orderBlockSums( i, 1 ) * sinesOfOrderLongitude_[ order ] );
+            sphericalGradient( 1 ) += cosineOfLatitudeDerivativePower * (
+                        orderBlockSums( i, 2 ) * cosinesOfOrderLongitude_[ order ] +
+                        orderBlockSums( i, 3 ) * sinesOfOrderLongitude_[ order ] );
+            sphericalGradient( 2 ) += static_cast< double >( order ) * cosineOfLatitudePowers_[ order ] * (
+                        orderBlockSums( i, 5 ) * cosinesOfOrderLongitude_[ order ] -
+                        orderBlockSums( i, 4 ) * sinesOfOrderLongitude_[ order ] );
+        }
+    }
+
+    const double preMultiplier = gravitationalParameter / referenceRadius;
+    sphericalGradient( 0 ) *= -preMultiplier / distance;
+    sphericalGradient( 1 ) *= preMultiplier;
+    sphericalGradient( 2 ) *= preMultiplier;
+
+    return coordinate_conversions::getSphericalToCartesianGradientMatrix( positionOfBodySubjectToAcceleration ) *
+            sphericalGradient;
+}
+
+//! Function to compute the sums over degree, for a single block of orders, using forward column-wise recursion.
+void SphericalHarmonicsAccelerationKernel::computeOrderBlockSumsWithForwardRecursion(
+        const int block, const double sineOfLatitude, OrderBlockSums& orderBlockSums )
+{
+    const int firstOrder = block * orderBlockSize;
+    const double* currentCoefficients = packedCoefficients_.data( ) + orderBlockStartIndices_[ block ];
+
+    OrderBlockArray radialCosineSum = OrderBlockArray::Zero( ), radialSineSum = OrderBlockArray::Zero( );
+    OrderBlockArray latitudeCosineSum = OrderBlockArray::Zero( ), latitudeSineSum = OrderBlockArray::Zero( );
+    OrderBlockArray cosineSum = OrderBlockArray::Zero( ), sineSum = OrderBlockArray::Zero( );
+
+    // Sum contributions over degree for all orders in block, using column-wise recursion of Legendre polynomials.
+    OrderBlockArray previousLegendrePolynomials = OrderBlockArray::Zero( );
+    OrderBlockArray secondPreviousLegendrePolynomials = OrderBlockArray::Zero( );
+    for( int degree = firstOrder; degree <= maximumDegree_; degree++ )
+    {
+        const ConstOrderBlockMap firstRecursionCoefficients( currentCoefficients );
+        const ConstOrderBlockMap secondRecursionCoefficients( currentCoefficients + orderBlockSize );
+        const ConstOrderBlockMap derivativeCoefficients( currentCoefficients + 2 * orderBlockSize );
+        const ConstOrderBlockMap cosineCoefficients( currentCoefficients + 3 * orderBlockSize );
+        const ConstOrderBlockMap sineCoefficients( currentCoefficients + 4 * orderBlockSize );
+
+        OrderBlockArray legendrePolynomials =
+                firstRecursionCoefficients * ( sineOfLatitude * previousLegendrePolynomials ) -
+                secondRecursionCoefficients * secondPreviousLegendrePolynomials;
+        if( degree < firstOrder + orderBlockSize )
+        {
+            legendrePolynomials( degree - firstOrder ) = scaledSectoralPolynomials_[ degree ];
+        }
+
+        const OrderBlockArray legendreDerivatives =
+                derivativeCoefficients * previousLegendrePolynomials -
+                ( static_cast< double >( degree ) * sineOfLatitude ) * legendrePolynomials;
+
+        const OrderBlockArray scaledLegendrePolynomials = radiusRatioPowers_[ degree ] * legendrePolynomials;
+        const OrderBlockArray scaledRadialLegendrePolynomials =
+                static_cast< double >( degree + 1 ) * scaledLegendrePolynomials;
+        const OrderBlockArray scaledLegendreDerivatives = radiusRatioPowers_[ degree ] * legendreDerivatives;
+
+        cosineSum += scaledLegendrePolynomials * cosineCoefficients;
+        sineSum += scaledLegendrePolynomials * sineCoefficients;
+        radialCosineSum += scaledRadialLegendrePolynomials * cosineCoefficients;
+        radialSineSum += scaledRadialLegendrePolynomials * sineCoefficients;
+        latitudeCosineSum += scaledLegendreDerivatives * cosineCoefficients;
+        latitudeSineSum += scaledLegendreDerivatives * sineCoefficients;
+
+        secondPreviousLegendrePolynomials = previousLegendrePolynomials;
+        previousLegendrePolynomials = legendrePolynomials;
+        currentCoefficients += 5 * orderBlockSize;
+    }
+
+    orderBlockSums.col( 0 ) = radialCosineSum;
+    orderBlockSums.col( 1 ) = radialSineSum;
+    orderBlockSums.col( 2 ) = latitudeCosineSum;
+    orderBlockSums.col( 3 ) = latitudeSineSum;
+    orderBlockSums.col( 4 ) = cosineSum;
+    orderBlockSums.col( 5 ) = sineSum;
+}
+
+//! Function to compute the sums over degree, for a single block of orders, using Clenshaw summation.
+void SphericalHarmonicsAccelerationKernel::computeOrderBlockSumsWithClenshawSummation(
+        const int block, const double sineOfLatitude, OrderBlockSums& orderBlockSums )
+{
+    const int firstOrder = block * orderBlockSize;
+    const double* currentCoefficients = packedCoefficients_.data( ) + orderBlockStartIndices_[ block ] +
+            5 * orderBlockSize * ( maximumDegree_ - firstOrder );
+
+    // Clenshaw sums at degree k + 1 and k + 2, for the six sums in orderBlockSums.
+    OrderBlockSums previousClenshawSums = OrderBlockSums::Zero( );
+    OrderBlockSums secondPreviousClenshawSums = OrderBlockSums::Zero( );
+    OrderBlockSums currentClenshawSums;
+
+    // Recursion coefficients at degree k + 1 and k + 2.
+    OrderBlockArray previousFirstRecursionCoefficients = OrderBlockArray::Zero( );
+    OrderBlockArray previousSecondRecursionCoefficients = OrderBlockArray::Zero( );
+    OrderBlockArray secondPreviousSecondRecursionCoefficients = OrderBlockArray::Zero( );
+
+    // Contribution of polynomial at degree k + 1 to derivative at degree k, multiplied by coefficients.
+    OrderBlockArray previousDerivativeCosineTerms = OrderBlockArray::Zero( );
+    OrderBlockArray previousDerivativeSineTerms = OrderBlockArray::Zero( );
+
+    for( int degree = maximumDegree_; degree >= firstOrder; degree-- )
+    {
+        const ConstOrderBlockMap firstRecursionCoefficients( currentCoefficients );
+        const ConstOrderBlockMap secondRecursionCoefficients( currentCoefficients + orderBlockSize );
+        const ConstOrderBlockMap derivativeCoefficients( currentCoefficients + 2 * orderBlockSize );
+        const ConstOrderBlockMap cosineCoefficients( currentCoefficients + 3 * orderBlockSize );
+        const ConstOrderBlockMap sineCoefficients( currentCoefficients + 4 * orderBlockSize );
+
+        // Compute weights of Legendre polynomials at current degree in the six sums.
+        const OrderBlockArray scaledCosineCoefficients = radiusRatioPowers_[ degree ] * cosineCoefficients;
+        const OrderBlockArray scaledSineCoefficients = radiusRatioPowers_[ degree ] * sineCoefficients;
+        const double derivativeMultiplier = -static_cast< double >( degree ) * sineOfLatitude;
+
+        currentClenshawSums.col( 0 ) = static_cast< double >( degree + 1 ) * scaledCosineCoefficients;
+        currentClenshawSums.col( 1 ) = static_cast< double >( degree + 1 ) * scaledSineCoefficients;
+        currentClenshawSums.col( 2 ) = previousDerivativeCosineTerms + derivativeMultiplier * scaledCosineCoefficients;
+        currentClenshawSums.col( 3 ) = previousDerivativeSineTerms + derivativeMultiplier * scaledSineCoefficients;
+        currentClenshawSums.col( 4 ) = scaledCosineCoefficients;
+        currentClenshawSums.col( 5 ) = scaledSineCoefficients;
+
+        // Perform Clenshaw step.
+        currentClenshawSums += ( sineOfLatitude * previousFirstRecursionCoefficients ).replicate< 1, 6 >( ) *
+                previousClenshawSums -
+                secondPreviousSecondRecursionCoefficients.replicate< 1, 6 >( ) * secondPreviousClenshawSums;
+
+        // Retrieve sums for order that is equal to current degree (sectoral polynomial is start of recursion).
+        if( degree < firstOrder + orderBlockSize )
+        {
+            orderBlockSums.row( degree - firstOrder ) =
+                    scaledSectoralPolynomials_[ degree ] * currentClenshawSums.row( degree - firstOrder );
+        }
+
+        secondPreviousClenshawSums = previousClenshawSums;
+        previousClenshawSums = currentClenshawSums;
+
+        secondPreviousSecondRecursionCoefficients = previousSecondRecursionCoefficients;
+        previousSecondRecursionCoefficients = secondRecursionCoefficients;
+        previousFirstRecursionCoefficients = firstRecursionCoefficients;
+
+        previousDerivativeCosineTerms = derivativeCoefficients * scaledCosineCoefficients;
+        previousDerivativeSineTerms = derivativeCoefficients * scaledSineCoefficients;
+
+        currentCoefficients -= 5 * orderBlockSize;
+    }
+}
+
+} // namespace gravitation
+
+} // namespace tudat
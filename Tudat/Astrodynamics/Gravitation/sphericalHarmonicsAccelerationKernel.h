@@ -0,0 +1,558 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Holmes, S.A., Featherstone, W.E. A unified approach to the Clenshaw summation and the recursive computation of
+ *          very high degree and order normalised associated Legendre functions. Journal of Geodesy, 76, 2002.
+ *
+ */
+
+#ifndef TUDAT_SPHERICAL_HARMONICS_ACCELERATION_KERNEL_H
+#define TUDAT_SPHERICAL_HARMONICS_ACCELERATION_KERNEL_H
+
+#include <cmath>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "Tudat/Mathematics/BasicMathematics/coordinateConversions.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+
+namespace tudat
+{
+
+namespace gravitation
+{
+
+//! Function to compute the coefficients of the column-wise recursion of geodesy-normalized Legendre polynomials.
+/*!
+ * Function to compute the coefficients of the fixed-order (column-wise) recursion of geodesy-normalized associated
+ * Legendre polynomials, and of the fixed-order expression for their derivative w.r.t. latitude:
+ * \f{eqnarray*}{
+ *     \bar{P}_{n,m} &=& a_{n,m} \sin\phi \bar{P}_{n-1,m} - b_{n,m} \bar{P}_{n-2,m} \\
+ *     \cos\phi \frac{ d\bar{P}_{n,m} }{ d\phi } &=& c_{n,m} \bar{P}_{n-1,m} - n \sin\phi \bar{P}_{n,m}
+ * \f}
+ * All coefficients are set to zero for degree <= order, so that the recursion may be started from zero-valued
+ * polynomials, and the sectoral terms added at degree = order.
+ * \param degree Degree of polynomial
+ * \param order Order of polynomial
+ * \param firstRecursionCoefficient Coefficient a_{n,m} of recursion (returned by reference)
+ * \param secondRecursionCoefficient Coefficient b_{n,m} of recursion (returned by reference)
+ * \param derivativeCoefficient Coefficient c_{n,m} of derivative (returned by reference)
+ */
+void getGeodesyNormalizedLegendreRecursionCoefficients(
+        const int degree, const int order,
+        double& firstRecursionCoefficient, double& secondRecursionCoefficient, double& derivativeCoefficient );
+
+//! Function to compute the sectoral geodesy-normalized Legendre polynomial, divided by cos(latitude)^order
+/*!
+ * Function to compute the sectoral geodesy-normalized Legendre polynomial, divided by cos(latitude)^order. Evaluating
+ * the polynomials without this factor, and applying it only after summation over degree, prevents underflow of
+ * the polynomials at high order and latitude (Holmes & Featherstone, 2002).
+ * \param order Order (and degree) of polynomial
+ * \return Sectoral geodesy-normalized Legendre polynomial, divided by cos(latitude)^order
+ */
+double getScaledSectoralGeodesyLegendrePolynomial( const int order );
+
+//! Recursion coefficients for geodesy-normalized Legendre polynomials, for use in fixed-size acceleration evaluation.
+template< int MaximumDegree, int MaximumOrder >
+struct FixedSizeLegendreRecursionCoefficients
+{
+    //! Constructor, computes all recursion coefficients up to given degree and order.
+    FixedSizeLegendreRecursionCoefficients( )
+    {
+        for( int order = 0; order <= MaximumOrder; order++ )
+        {
+            scaledSectoralPolynomials[ order ] = getScaledSectoralGeodesyLegendrePolynomial( order );
+            for( int degree = 0; degree <= MaximumDegree; degree++ )
+            {
+                getGeodesyNormalizedLegendreRecursionCoefficients(
+                            degree, order, firstRecursionCoefficients[ degree ][ order ],
+                            secondRecursionCoefficients[ degree ][ order ], derivativeCoefficients[ degree ][ order ] );
+            }
+        }
+    }
+
+    //! Coefficients a_{n,m} (see getGeodesyNormalizedLegendreRecursionCoefficients).
+    double firstRecursionCoefficients[ MaximumDegree + 1 ][ MaximumOrder + 1 ];
+
+    //! Coefficients b_{n,m} (see getGeodesyNormalizedLegendreRecursionCoefficients).
+    double secondRecursionCoefficients[ MaximumDegree + 1 ][ MaximumOrder + 1 ];
+
+    //! Coefficients c_{n,m} (see getGeodesyNormalizedLegendreRecursionCoefficients).
+    double derivativeCoefficients[ MaximumDegree + 1 ][ MaximumOrder + 1 ];
+
+    //! Sectoral polynomials, divided by cos(latitude)^order (see getScaledSectoralGeodesyLegendrePolynomial).
+    double scaledSectoralPolynomials[ MaximumOrder + 1 ];
+};
+
+//! Compute body-fixed gravitational acceleration due to a geodesy-normalized spherical harmonic field of fixed size.
+/*!
+ * Compute body-fixed gravitational acceleration due to a geodesy-normalized spherical harmonic field, with degree and
+ * order known at compile time. The Legendre recursion is fused with the summation of the potential gradient, and all
+ * loops have compile-time bounds, so that they may be fully unrolled by the compiler. The result is identical (up to
+ * rounding) to that of computeGeodesyNormalizedGravitationalAccelerationSum, but no cache object is used or updated.
+ * \tparam MaximumDegree Maximum degree of spherical harmonic field
+ * \tparam MaximumOrder Maximum order of spherical harmonic field
+ * \param positionOfBodySubjectToAcceleration Cartesian position vector in body-fixed frame of field.
+ * \param gravitationalParameter Gravitational parameter associated with the spherical harmonics.
+ * \param referenceRadius Reference radius of the spherical harmonics.
+ * \param cosineHarmonicCoefficients Geodesy-normalized cosine coefficients (degree as row, order as column), of at least
+ * size ( MaximumDegree + 1 ) x ( MaximumOrder + 1 ).
+ * \param sineHarmonicCoefficients Geodesy-normalized sine coefficients (degree as row, order as column), of at least
+ * size ( MaximumDegree + 1 ) x ( MaximumOrder + 1 ).
+ * \return Cartesian acceleration vector in body-fixed frame of field.
+ */
+template< int MaximumDegree, int MaximumOrder >
+Eigen::Vector3d computeFixedSizeGeodesyNormalizedGravitationalAcceleration(
+        const Eigen::Vector3d& positionOfBodySubjectToAcceleration,
+        const double gravitationalParameter,
+        const double referenceRadius,
+        const Eigen::MatrixXd& cosineHarmonicCoefficients,
+        const Eigen::MatrixXd& sineHarmonicCoefficients )
+{
+    static const FixedSizeLegendreRecursionCoefficients< MaximumDegree, MaximumOrder > recursionCoefficients;
+
+    // Compute (trigonometric functions of) spherical coordinates.
+    const double xyDistance = std::sqrt( positionOfBodySubjectToAcceleration( 0 ) * positionOfBodySubjectToAcceleration( 0 ) +
+                                         positionOfBodySubjectToAcceleration( 1 ) * positionOfBodySubjectToAcceleration( 1 ) );
+    const double distance = positionOfBodySubjectToAcceleration.norm( );
+    const double sineOfLatitude = positionOfBodySubjectToAcceleration( 2 ) / distance;
+    const double cosineOfLatitude = xyDistance / distance;
+    const double cosineOfLongitude = ( xyDistance > 0.0 ) ? positionOfBodySubjectToAcceleration( 0 ) / xyDistance : 1.0;
+    const double sineOfLongitude = ( xyDistance > 0.0 ) ? positionOfBodySubjectToAcceleration( 1 ) / xyDistance : 0.0;
+
+    // Compute powers of radius ratio.
+    double radiusRatioPowers[ MaximumDegree + 1 ];
+    radiusRatioPowers[ 0 ] = referenceRadius / distance;
+    for( int degree = 1; degree <= MaximumDegree; degree++ )
+    {
+        radiusRatioPowers[ degree ] = radiusRatioPowers[ degree - 1 ] * radiusRatioPowers[ 0 ];
+    }
+
+    Eigen::Vector3d sphericalGradient = Eigen::Vector3d::Zero( );
+    double cosineOfOrderLongitude = 1.0;
+    double sineOfOrderLongitude = 0.0;
+    double cosineOfLatitudePower = 1.0;
+    double cosineOfLatitudeDerivativePower = 1.0 / cosineOfLatitude;
+    for( int order = 0; order <= MaximumOrder; order++ )
+    {
+        double radialCosineSum = 0.0, radialSineSum = 0.0;
+        double latitudeCosineSum = 0.0, latitudeSineSum = 0.0;
+        double cosineSum = 0.0, sineSum = 0.0;
+
+        // Sum contributions over degree at current order, using column-wise recursion of Legendre polynomials.
+        double previousLegendrePolynomial = 0.0;
+        double secondPreviousLegendrePolynomial = 0.0;
+        for( int degree = order; degree <= MaximumDegree; degree++ )
+        {
+            const double legendrePolynomial = ( degree == order ) ?
+                        recursionCoefficients.scaledSectoralPolynomials[ order ] :
+                        recursionCoefficients.firstRecursionCoefficients[ degree ][ order ] *
+                        sineOfLatitude * previousLegendrePolynomial -
+                        recursionCoefficients.secondRecursionCoefficients[ degree ][ order ] *
+                        secondPreviousLegendrePolynomial;
+            const double legendreDerivative =
+                    recursionCoefficients.derivativeCoefficients[ degree ][ order ] * previousLegendrePolynomial -
+                    static_cast< double >( degree ) * sineOfLatitude * legendrePolynomial;
+
+            const double scaledLegendrePolynomial = radiusRatioPowers[ degree ] * legendrePolynomial;
+            const double scaledLegendreDerivative = radiusRatioPowers[ degree ] * legendreDerivative;
+            const double cosineCoefficient = cosineHarmonicCoefficients( degree, order );
+            const double sineCoefficient = sineHarmonicCoefficients( degree, order );
+
+            cosineSum += scaledLegendrePolynomial * cosineCoefficient;
+            sineSum += scaledLegendrePolynomial * sineCoefficient;
+            radialCosineSum += static_cast< double >( degree + 1 ) * scaledLegendrePolynomial * cosineCoefficient;
+            radialSineSum += static_cast< double >( degree + 1 ) * scaledLegendrePolynomial * sineCoefficient;
+            latitudeCosineSum += scaledLegendreDerivative * cosineCoefficient;
+            latitudeSineSum += scaledLegendreDerivative * sineCoefficient;
+
+            secondPreviousLegendrePolynomial = previousLegendrePolynomial;
+            previousLegendrePolynomial = legendrePolynomial;
+        }
+
+        // Add contributions of current order to gradient.
+        sphericalGradient( 0 ) += cosineOfLatitudePower * (
+                    radialCosineSum * cosineOfOrderLongitude + radialSineSum * sineOfOrderLongitude );
+        sphericalGradient( 1 ) += cosineOfLatitudeDerivativePower * (
+                    latitudeCosineSum * cosineOfOrderLongitude + latitudeSineSum * sineOfOrderLongitude );
+        sphericalGradient( 2 ) += static_cast< double >( order ) * cosineOfLatitudePower * (
+                    sineSum * cosineOfOrderLongitude - cosineSum * sineOfOrderLongitude );
+
+        // Update order-dependent terms.
+        const double previousCosineOfOrderLongitude = cosineOfOrderLongitude;
+        cosineOfOrderLongitude = cosineOfOrderLongitude * cosineOfLongitude - sineOfOrderLongitude * sineOfLongitude;
+        sineOfOrderLongitude = sineOfOrderLongitude * cosineOfLongitude + previousCosineOfOrderLongitude * sineOfLongitude;
+        cosineOfLatitudeDerivativePower = cosineOfLatitudePower;
+        cosineOfLatitudePower *= cosineOfLatitude;
+    }
+
+    const double preMultiplier = gravitationalParameter / referenceRadius;
+    sphericalGradient( 0 ) *= -preMultiplier / distance;
+    sphericalGradient( 1 ) *= preMultiplier;
+    sphericalGradient( 2 ) *= preMultiplier;
+
+    return coordinate_conversions::getSphericalToCartesianGradientMatrix( positionOfBodySubjectToAcceleration ) *
+            sphericalGradient;
+}
+
+//! Enum defining the method by which the sums over degree are evaluated in SphericalHarmonicsAccelerationKernel.
+enum SphericalHarmonicsSummationMethod
+{
+    //! Legendre polynomials are computed by forward column-wise recursion, and summed as they are computed.
+    forward_recursion_summation,
+
+    //! Sums are evaluated by Clenshaw summation (backward recursion), without computing the polynomials themselves.
+    clenshaw_summation
+};
+
+//! Kernel for the evaluation of the gravitational acceleration due to a geodesy-normalized spherical harmonic field.
+/*!
+ * Kernel for the evaluation of the gravitational acceleration due to a geodesy-normalized spherical harmonic field,
+ * designed for efficient evaluation of (very) high degree fields. It produces the same results (up to rounding) as the
+ * computeGeodesyNormalizedGravitationalAccelerationSum function, but:
+ *  - The coefficients, together with the Legendre recursion coefficients, are stored order-major, in blocks of
+ *    a fixed number of consecutive orders, with the values for all orders in a block contiguous per degree.
+ *  - The column-wise Legendre recursion is fused with the summation of the potential gradient, so that no polynomials
+ *    are stored, and the recursion and summation are performed simultaneously for all orders in a block, using
+ *    fixed-size Eigen arrays (vectorized by Eigen where SIMD instructions are available).
+ *  - The polynomials are evaluated with the cos(latitude)^order factor removed, preventing underflow at high degree
+ *    (see getScaledSectoralGeodesyLegendrePolynomial).
+ *  - All scratch memory is allocated when (re)setting the coefficients, so that evaluation does not allocate memory.
+ *  - For fields with small, fixed degree and order, a compile-time specialized implementation is used (see
+ *    computeFixedSizeGeodesyNormalizedGravitationalAcceleration).
+ *  - Alternatively to the forward recursion, the sums over degree may be evaluated by Clenshaw summation (Holmes and
+ *    Featherstone, 2002), in which the polynomials at each order are never formed explicitly (see
+ *    SphericalHarmonicsSummationMethod). The compile-time specialized implementation is not used in this case.
+ *  - The degree zero term is not included in the sums, but is added to the result using the degree zero cosine
+ *    coefficient of the last call to updateCoefficients/resetCoefficients. Models that differ only in this
+ *    coefficient (e.g. a spherical harmonic acceleration and torque, where the latter does not use the degree zero term)
+ *    can therefore share a kernel, and its (cached) sums.
+ * Unlike computeGeodesyNormalizedGravitationalAccelerationSum, the kernel does not update a SphericalHarmonicsCache.
+ */
+class SphericalHarmonicsAccelerationKernel
+{
+public:
+
+    //! Typedef for function computing acceleration for a field of fixed size.
+    typedef Eigen::Vector3d ( *FixedSizeAccelerationFunction )(
+            const Eigen::Vector3d&, const double, const double, const Eigen::MatrixXd&, const Eigen::MatrixXd& );
+
+    //! Number of consecutive orders that are processed simultaneously.
+    static const int orderBlockSize = 4;
+
+    //! Typedef for array of values for all orders in a block.
+    typedef Eigen::Array< double, orderBlockSize, 1 > OrderBlockArray;
+
+    //! Typedef for read-only view on packed coefficients for all orders in a block.
+    typedef Eigen::Map< const OrderBlockArray > ConstOrderBlockMap;
+
+    //! Typedef for sums over degree for all orders in a block.
+    /*!
+     *  Typedef for sums over degree for all orders in a block. Rows denote the order in the block, and columns denote
+     *  (in order) the radial cosine and sine sums, latitude cosine and sine sums, and cosine and sine sums.
+     */
+    typedef Eigen::Array< double, orderBlockSize, 6 > OrderBlockSums;
+
+    //! Default constructor, coefficients must be set by resetCoefficients before evaluating the acceleration.
+    SphericalHarmonicsAccelerationKernel( ):
+        maximumDegree_( -1 ), maximumOrder_( -1 ), numberOfOrderBlocks_( 0 ),
+        useFixedSizeEvaluation_( true ), fixedSizeAccelerationFunction_( nullptr ),
+        summationMethod_( forward_recursion_summation ), degreeZeroCosineCoefficient_( 0.0 ),
+        lastPosition_( Eigen::Vector3d::Constant( TUDAT_NAN ) ), lastReferenceRadius_( TUDAT_NAN ),
+        lastSummationMethod_( forward_recursion_summation ),
+        lastUnitAcceleration_( Eigen::Vector3d::Constant( TUDAT_NAN ) ), numberOfEvaluations_( 0 ){ }
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param cosineHarmonicCoefficients Geodesy-normalized cosine coefficients (degree as row, order as column).
+     * \param sineHarmonicCoefficients Geodesy-normalized sine coefficients (degree as row, order as column).
+     */
+    SphericalHarmonicsAccelerationKernel( const Eigen::MatrixXd& cosineHarmonicCoefficients,
+                                          const Eigen::MatrixXd& sineHarmonicCoefficients ):
+        maximumDegree_( -1 ), maximumOrder_( -1 ), numberOfOrderBlocks_( 0 ),
+        useFixedSizeEvaluation_( true ), fixedSizeAccelerationFunction_( nullptr ),
+        summationMethod_( forward_recursion_summation ), degreeZeroCosineCoefficient_( 0.0 ),
+        lastPosition_( Eigen::Vector3d::Constant( TUDAT_NAN ) ), lastReferenceRadius_( TUDAT_NAN ),
+        lastSummationMethod_( forward_recursion_summation ),
+        lastUnitAcceleration_( Eigen::Vector3d::Constant( TUDAT_NAN ) ), numberOfEvaluations_( 0 )
+    {
+        resetCoefficients( cosineHarmonicCoefficients, sineHarmonicCoefficients );
+    }
+
+    //! Function to reset the spherical harmonic coefficients, and (re)compute the packed coefficients.
+    /*!
+     * Function to reset the spherical harmonic coefficients, and (re)compute the packed coefficients. As in
+     * computeGeodesyNormalizedGravitationalAccelerationSum, the maximum degree is the number of rows minus one, and
+     * the maximum order the number of columns minus one (limited to the maximum degree).
+     * \param cosineHarmonicCoefficients Geodesy-normalized cosine coefficients (degree as row, order as column).
+     * \param sineHarmonicCoefficients Geodesy-normalized sine coefficients (degree as row, order as column).
+     */
+    void resetCoefficients( const Eigen::MatrixXd& cosineHarmonicCoefficients,
+                            const Eigen::MatrixXd& sineHarmonicCoefficients );
+
+    //! Function to reset the spherical harmonic coefficients, only if they differ from the current coefficients.
+    /*!
+     * Function to reset the spherical harmonic coefficients (see resetCoefficients), only if they differ from the current
+     * coefficients. The degree zero cosine coefficient is not included in the comparison: it is always updated, without
+     * resetting the kernel, as it is not included in the (cached) sums.
+     * \param cosineHarmonicCoefficients Geodesy-normalized cosine coefficients (degree as row, order as column).
+     * \param sineHarmonicCoefficients Geodesy-normalized sine coefficients (degree as row, order as column).
+     * \return True if the coefficients (other than the degree zero cosine coefficient) were changed, false otherwise.
+     */
+    bool updateCoefficients( const Eigen::MatrixXd& cosineHarmonicCoefficients,
+                             const Eigen::MatrixXd& sineHarmonicCoefficients );
+
+    //! Function to compute the gravitational acceleration in the body-fixed frame of the field.
+    /*!
+     * Function to compute the gravitational acceleration in the body-fixed frame of the field, using the summation
+     * method set by setSummationMethod.
+     * \param positionOfBodySubjectToAcceleration Cartesian position vector in body-fixed frame of field.
+     * \param gravitationalParameter Gravitational parameter associated with the spherical harmonics.
+     * \param referenceRadius Reference radius of the spherical harmonics.
+     * \return Cartesian acceleration vector in body-fixed frame of field.
+     */
+    Eigen::Vector3d computeAcceleration( const Eigen::Vector3d& positionOfBodySubjectToAcceleration,
+                                         const double gravitationalParameter,
+                                         const double referenceRadius )
+    {
+        return computeAcceleration( positionOfBodySubjectToAcceleration, gravitationalParameter, referenceRadius,
+                                    summationMethod_ );
+    }
+
+    //! Function to compute the gravitational acceleration in the body-fixed frame of the field, with given summation.
+    /*!
+     * Function to compute the gravitational acceleration in the body-fixed frame of the field, with given summation
+     * method. The sums (excluding the degree zero term, per unit gravitational parameter) are only re-evaluated if the
+     * position, reference radius or summation method differ from those of the previous evaluation (or the
+     * coefficients have been reset). A kernel shared by several models for the same pair of bodies (see
+     * SphericalHarmonicsGravityField::getBodyPairAccelerationKernel) is therefore evaluated once per epoch, also when
+     * the models use a different gravitational parameter or degree zero coefficient.
+     * \param positionOfBodySubjectToAcceleration Cartesian position vector in body-fixed frame of field.
+     * \param gravitationalParameter Gravitational parameter associated with the spherical harmonics.
+     * \param referenceRadius Reference radius of the spherical harmonics.
+     * \param summationMethod Method by which the sums over degree are evaluated.
+     * \return Cartesian acceleration vector in body-fixed frame of field.
+     */
+    Eigen::Vector3d computeAcceleration( const Eigen::Vector3d& positionOfBodySubjectToAcceleration,
+                                         const double gravitationalParameter,
+                                         const double referenceRadius,
+                                         const SphericalHarmonicsSummationMethod summationMethod );
+
+    //! Function to set whether the compile-time specialized implementation is to be used (if available for field size).
+    /*!
+     * Function to set whether the compile-time specialized implementation is to be used (if available for field size).
+     * \param useFixedSizeEvaluation Boolean denoting whether the compile-time specialized implementation is to be used.
+     */
+    void setUseFixedSizeEvaluation( const bool useFixedSizeEvaluation )
+    {
+        useFixedSizeEvaluation_ = useFixedSizeEvaluation;
+        resetLastEvaluation( );
+    }
+
+    //! Function to retrieve whether the compile-time specialized implementation is used for the current field.
+    /*!
+     * Function to retrieve whether the compile-time specialized implementation is used for the current field.
+     * \return True if the compile-time specialized implementation is used for the current field.
+     */
+    bool isFixedSizeEvaluationUsed( )
+    {
+        return isFixedSizeEvaluationUsed( summationMethod_ );
+    }
+
+    //! Function to set the default method by which the sums over degree are evaluated.
+    /*!
+     * Function to set the method by which the sums over degree are evaluated, if none is provided to
+     * computeAcceleration.
+     * \param summationMethod Method by which the sums over degree are evaluated.
+     */
+    void setSummationMethod( const SphericalHarmonicsSummationMethod summationMethod )
+    {
+        summationMethod_ = summationMethod;
+    }
+
+    //! Function to retrieve the default method by which the sums over degree are evaluated.
+    /*!
+     * Function to retrieve the method by which the sums over degree are evaluated, if none is provided to
+     * computeAcceleration.
+     * \return Method by which the sums over degree are evaluated.
+     */
+    SphericalHarmonicsSummationMethod getSummationMethod( )
+    {
+        return summationMethod_;
+    }
+
+    //! Function to retrieve maximum degree of spherical harmonic field.
+    /*!
+     * Function to retrieve maximum degree of spherical harmonic field.
+     * \return Maximum degree of spherical harmonic field.
+     */
+    int getMaximumDegree( )
+    {
+        return maximumDegree_;
+    }
+
+    //! Function to retrieve maximum order of spherical harmonic field.
+    /*!
+     * Function to retrieve maximum order of spherical harmonic field.
+     * \return Maximum order of spherical harmonic field.
+     */
+    int getMaximumOrder( )
+    {
+        return maximumOrder_;
+    }
+
+    //! Function to retrieve the number of times the sums have been evaluated since the kernel was created.
+    /*!
+     * Function to retrieve the number of times the sums have been evaluated since the kernel was created (calls to
+     * computeAcceleration that return the previously computed sums are not counted).
+     * \return Number of times the sums have been evaluated.
+     */
+    int getNumberOfEvaluations( )
+    {
+        return numberOfEvaluations_;
+    }
+
+    //! Function to reset the input of the last evaluation, so that the acceleration is recomputed at the next call.
+    void resetLastEvaluation( )
+    {
+        lastReferenceRadius_ = TUDAT_NAN;
+    }
+
+private:
+
+    //! Function to retrieve whether the compile-time specialized implementation is used for given summation method.
+    /*!
+     * Function to retrieve whether the compile-time specialized implementation is used for the current field, and the
+     * given summation method.
+     * \param summationMethod Method by which the sums over degree are evaluated.
+     * \return True if the compile-time specialized implementation is used.
+     */
+    bool isFixedSizeEvaluationUsed( const SphericalHarmonicsSummationMethod summationMethod )
+    {
+        return useFixedSizeEvaluation_ && ( fixedSizeAccelerationFunction_ != nullptr ) &&
+                ( summationMethod == forward_recursion_summation );
+    }
+
+    //! Function to evaluate the gravitational acceleration in the body-fixed frame of the field.
+    /*!
+     * Function to evaluate the gravitational acceleration in the body-fixed frame of the field (without checking
+     * whether input is identical to that of the previous call), excluding the degree zero term.
+     * \param positionOfBodySubjectToAcceleration Cartesian position vector in body-fixed frame of field.
+     * \param gravitationalParameter Gravitational parameter associated with the spherical harmonics.
+     * \param referenceRadius Reference radius of the spherical harmonics.
+     * \param summationMethod Method by which the sums over degree are evaluated.
+     * \return Cartesian acceleration vector in body-fixed frame of field.
+     */
+    Eigen::Vector3d evaluateAcceleration( const Eigen::Vector3d& positionOfBodySubjectToAcceleration,
+                                          const double gravitationalParameter,
+                                          const double referenceRadius,
+                                          const SphericalHarmonicsSummationMethod summationMethod );
+
+    //! Function to compute the sums over degree for a single block of orders, using forward recursion.
+    /*!
+     * Function to compute the sums over degree for a single block of orders, using forward column-wise recursion of the
+     * Legendre polynomials. The sums are those of the polynomials and their latitude derivatives (multiplied by
+     * cos(latitude)), all divided by cos(latitude)^order, times the radius ratio powers and coefficients.
+     * \param block Index of block of orders.
+     * \param sineOfLatitude Sine of latitude of evaluation point.
+     * \param orderBlockSums Sums over degree for all orders in block (returned by reference, see OrderBlockSums).
+     */
+    void computeOrderBlockSumsWithForwardRecursion(
+            const int block, const double sineOfLatitude, OrderBlockSums& orderBlockSums );
+
+    //! Function to compute the sums over degree for a single block of orders, using Clenshaw summation.
+    /*!
+     * Function to compute the sums over degree for a single block of orders, using Clenshaw summation, from the maximum
+     * degree down to the order. Results are identical (up to rounding) to computeOrderBlockSumsWithForwardRecursion.
+     * \param block Index of block of orders.
+     * \param sineOfLatitude Sine of latitude of evaluation point.
+     * \param orderBlockSums Sums over degree for all orders in block (returned by reference, see OrderBlockSums).
+     */
+    void computeOrderBlockSumsWithClenshawSummation(
+            const int block, const double sineOfLatitude, OrderBlockSums& orderBlockSums );
+
+    //! Maximum degree of spherical harmonic field.
+    int maximumDegree_;
+
+    //! Maximum order of spherical harmonic field.
+    int maximumOrder_;
+
+    //! Number of blocks of consecutive orders into which the coefficients are packed.
+    int numberOfOrderBlocks_;
+
+    //! Geodesy-normalized cosine coefficients (degree as row, order as column), as set by last call to resetCoefficients
+    //! (with degree zero coefficient set to zero).
+    Eigen::MatrixXd cosineHarmonicCoefficients_;
+
+    //! Geodesy-normalized sine coefficients (degree as row, order as column), as set by last call to resetCoefficients.
+    Eigen::MatrixXd sineHarmonicCoefficients_;
+
+    //! Packed recursion and harmonic coefficients.
+    /*!
+     *  Packed recursion and harmonic coefficients. For each block of orders, and each degree from the lowest order in
+     *  the block to the maximum degree, the coefficients a_{n,m}, b_{n,m}, c_{n,m} (see
+     *  getGeodesyNormalizedLegendreRecursionCoefficients), cosine and sine coefficients are stored consecutively, each
+     *  for all orders in the block. Entries for orders above the maximum order are zero.
+     */
+    std::vector< double > packedCoefficients_;
+
+    //! Index in packedCoefficients_ at which the entries of each block of orders starts.
+    std::vector< int > orderBlockStartIndices_;
+
+    //! Sectoral polynomials, divided by cos(latitude)^order (see getScaledSectoralGeodesyLegendrePolynomial), per order.
+    std::vector< double > scaledSectoralPolynomials_;
+
+    //! Pre-allocated list of powers of reference radius over distance (power = degree + 1), per degree.
+    std::vector< double > radiusRatioPowers_;
+
+    //! Pre-allocated list of cosines of order times longitude, per order.
+    std::vector< double > cosinesOfOrderLongitude_;
+
+    //! Pre-allocated list of sines of order times longitude, per order.
+    std::vector< double > sinesOfOrderLongitude_;
+
+    //! Pre-allocated list of powers of cosine of latitude (power = order), per order.
+    std::vector< double > cosineOfLatitudePowers_;
+
+    //! Boolean denoting whether the compile-time specialized implementation is to be used (if available for field size).
+    bool useFixedSizeEvaluation_;
+
+    //! Compile-time specialized implementation for current field size (nullptr if none available).
+    FixedSizeAccelerationFunction fixedSizeAccelerationFunction_;
+
+    //! Method by which the sums over degree are evaluated, if none is provided to computeAcceleration.
+    SphericalHarmonicsSummationMethod summationMethod_;
+
+    //! Geodesy-normalized degree zero cosine coefficient, as set by last call to updateCoefficients/resetCoefficients.
+    double degreeZeroCosineCoefficient_;
+
+    //! Position at which acceleration was last evaluated.
+    Eigen::Vector3d lastPosition_;
+
+    //! Reference radius with which acceleration was last evaluated (NaN if no valid evaluation).
+    double lastReferenceRadius_;
+
+    //! Summation method with which acceleration was last evaluated.
+    SphericalHarmonicsSummationMethod lastSummationMethod_;
+
+    //! Acceleration per unit gravitational parameter, excluding the degree zero term, computed at last evaluation.
+    Eigen::Vector3d lastUnitAcceleration_;
+
+    //! Number of times the sums have been evaluated since the kernel was created.
+    int numberOfEvaluations_;
+};
+
+} // namespace gravitation
+
+} // namespace tudat
+
+#endif // TUDAT_SPHERICAL_HARMONICS_ACCELERATION_KERNEL_H
@@ -18,6 +18,10 @@
 #define TUDAT_SPHERICAL_HARMONICS_GRAVITY_FIELD_H
 
 #include <functional>
+#include <map>
+#include <string>
+#include <tuple>
+
 #include <boost/lambda/lambda.hpp>
 #include <boost/make_shared.hpp>
 
@@ -285,6 +289,54 @@ public:
                     sineCoefficients_.block( 0, 0, maximumDegree, maximumOrder ), sphericalHarmonicsCache_, dummyMap );
     }
 
+    //! Function to retrieve the spherical harmonics cache shared by all models of this field acting on a given body.
+    /*!
+     *  Function to retrieve the spherical harmonics cache (Legendre polynomials, trigonometric functions of longitude and
+     *  powers of radius ratio) shared by all models (accelerations, torques and their partials) of this field that act on
+     *  the given body. Since the cache is only updated when its input changes, the terms are computed once per
+     *  evaluation epoch, regardless of the number of models using it. The total accelerations (and torques) are computed
+     *  without the cache, by the kernel of getBodyPairAccelerationKernel, which is shared in the same manner; the cache
+     *  is used by the partials, and by models that save the separate spherical harmonic terms. A new cache is created at
+     *  the first call for a given body.
+     *  \param nameOfBodyUndergoingAcceleration Name of body on which the models act.
+     *  \return Spherical harmonics cache for the pair of bodies.
+     */
+    std::shared_ptr< basic_mathematics::SphericalHarmonicsCache > getBodyPairSphericalHarmonicsCache(
+            const std::string& nameOfBodyUndergoingAcceleration )
+    {
+        if( bodyPairSphericalHarmonicsCaches_.count( nameOfBodyUndergoingAcceleration ) == 0 )
+        {
+            bodyPairSphericalHarmonicsCaches_[ nameOfBodyUndergoingAcceleration ] =
+                    std::make_shared< basic_mathematics::SphericalHarmonicsCache >( );
+        }
+        return bodyPairSphericalHarmonicsCaches_.at( nameOfBodyUndergoingAcceleration );
+    }
+
+    //! Function to retrieve the acceleration kernel shared by all models of this field acting on a given body.
+    /*!
+     *  Function to retrieve the acceleration kernel shared by all models (accelerations and torques) of this field that
+     *  act on the given body, with the same maximum degree and order. Models that do not use the degree zero term
+     *  (torques) share the kernel with those that do (accelerations), since the degree zero term is added outside of the
+     *  kernel's sums. The kernel only re-evaluates the sums when their input changes (see
+     *  SphericalHarmonicsAccelerationKernel::computeAcceleration), so that the Legendre recursion is performed once per
+     *  evaluation epoch for all these models. A new kernel is created at the first call for a given combination of input.
+     *  \param nameOfBodyUndergoingAcceleration Name of body on which the models act.
+     *  \param maximumDegree Maximum degree of the coefficients used by the models.
+     *  \param maximumOrder Maximum order of the coefficients used by the models.
+     *  \return Acceleration kernel for the pair of bodies and maximum degree and order.
+     */
+    std::shared_ptr< SphericalHarmonicsAccelerationKernel > getBodyPairAccelerationKernel(
+            const std::string& nameOfBodyUndergoingAcceleration, const int maximumDegree, const int maximumOrder )
+    {
+        const std::tuple< std::string, int, int > kernelKey =
+                std::make_tuple( nameOfBodyUndergoingAcceleration, maximumDegree, maximumOrder );
+        if( bodyPairAccelerationKernels_.count( kernelKey ) == 0 )
+        {
+            bodyPairAccelerationKernels_[ kernelKey ] = std::make_shared< SphericalHarmonicsAccelerationKernel >( );
+        }
+        return bodyPairAccelerationKernels_.at( kernelKey );
+    }
+
     //! Function to retrieve the tdentifier for body-fixed reference frame
     /*!
      *  Function to retrieve the tdentifier for body-fixed reference frame
@@ -343,6 +395,15 @@ protected:
 
     //! Cache object for potential calculations.
     std::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache_;
+
+    //! Spherical harmonics caches shared by models of this field, per name of body on which the models act.
+    std::map< std::string, std::shared_ptr< basic_mathematics::SphericalHarmonicsCache > >
+    bodyPairSphericalHarmonicsCaches_;
+
+    //! Acceleration kernels shared by models of this field, per name of body on which the models act, maximum degree and
+    //! maximum order.
+    std::map< std::tuple< std::string, int, int >, std::shared_ptr< SphericalHarmonicsAccelerationKernel > >
+    bodyPairAccelerationKernels_;
 };
 
 //! Function to determine a body's inertia tensor from its degree two unnormalized gravity field coefficients
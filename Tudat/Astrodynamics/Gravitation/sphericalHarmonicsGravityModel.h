@@ -25,6 +25,7 @@
 #include <Eigen/Geometry>
 
 #include "Tudat/Astrodynamics/BasicAstrodynamics/accelerationModel.h"
+#include "Tudat/Astrodynamics/Gravitation/sphericalHarmonicsAccelerationKernel.h"
 #include "Tudat/Astrodynamics/Gravitation/sphericalHarmonicsGravityModelBase.h"
 #include "Tudat/Mathematics/BasicMathematics/sphericalHarmonics.h"
 
@@ -194,6 +195,9 @@ public:
      * if the variable is true.
      * \param sphericalHarmonicsCache Cache object for computing/retrieving repeated terms in spherical harmonics potential
      *          gradient calculation.
+     * \param accelerationKernel Kernel used to compute the total acceleration (if separate terms are not saved). May be
+     * shared between models for the same pair of bodies, and the same coefficients up to the degree zero term (new kernel
+     * created if nullptr).
      */
     SphericalHarmonicsGravitationalAccelerationModel(
             const StateFunction positionOfBodySubjectToAccelerationFunction,
@@ -208,7 +212,8 @@ public:
             [ ]( ){ return Eigen::Quaterniond( Eigen::Matrix3d::Identity( ) ); },
             const bool isMutualAttractionUsed = 0,
             std::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache =
-            std::make_shared< basic_mathematics::SphericalHarmonicsCache >( ) )
+            std::make_shared< basic_mathematics::SphericalHarmonicsCache >( ),
+            std::shared_ptr< SphericalHarmonicsAccelerationKernel > accelerationKernel = nullptr )
         : Base( positionOfBodySubjectToAccelerationFunction,
                 aGravitationalParameter,
                 positionOfBodyExertingAccelerationFunction,
@@ -220,15 +225,22 @@ public:
               rotationFromBodyFixedToIntegrationFrameFunction ),
           sphericalHarmonicsCache_( sphericalHarmonicsCache ),
           currentAcceleration_( Eigen::Vector3d::Zero( ) ),
+          accelerationKernel_( accelerationKernel ),
+          summationMethod_( forward_recursion_summation ),
           saveSphericalHarmonicTermsSeparately_( false )
     {
+        if( accelerationKernel_ == nullptr )
+        {
+            accelerationKernel_ = std::make_shared< SphericalHarmonicsAccelerationKernel >( );
+        }
+
         maximumDegree_ = static_cast< int >( getCosineHarmonicsCoefficients( ).rows( ) );
         maximumOrder_ = static_cast< int >( getCosineHarmonicsCoefficients( ).cols( ) );
         sphericalHarmonicsCache_->resetMaximumDegreeAndOrder(
                     std::max< int >( maximumDegree_,
                                      sphericalHarmonicsCache_->getMaximumDegree( ) ),
-                    std::max< int >( maximumOrder_,
-                                     sphericalHarmonicsCache_->getMaximumOrder( ) ) + 1 );
+                    std::max< int >( maximumOrder_ + 1,
+                                     sphericalHarmonicsCache_->getMaximumOrder( ) ) );
         this->updateMembers( );
     }
 
@@ -258,6 +270,10 @@ public:
      * of the body exerting the acceleration, if variable is false, or the sum of the gravitational parameters,
      * if the variable is true.
      * \param sphericalHarmonicsCache Cache object for computing/retrieving repeated terms in spherical harmonics potential
+     *          gradient calculation.
+     * \param accelerationKernel Kernel used to compute the total acceleration (if separate terms are not saved). May be
+     * shared between models for the same pair of bodies, and the same coefficients up to the degree zero term (new kernel
+     * created if nullptr).
      */
     SphericalHarmonicsGravitationalAccelerationModel(
             const StateFunction positionOfBodySubjectToAccelerationFunction,
@@ -272,7 +288,8 @@ public:
             [ ]( ){ return Eigen::Quaterniond( Eigen::Matrix3d::Identity( ) ); },
             const bool isMutualAttractionUsed = 0,
             std::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache
-            = std::make_shared< basic_mathematics::SphericalHarmonicsCache >( ) )
+            = std::make_shared< basic_mathematics::SphericalHarmonicsCache >( ),
+            std::shared_ptr< SphericalHarmonicsAccelerationKernel > accelerationKernel = nullptr )
         : Base( positionOfBodySubjectToAccelerationFunction,
                 aGravitationalParameterFunction,
                 positionOfBodyExertingAccelerationFunction,
@@ -283,15 +300,22 @@ public:
           rotationFromBodyFixedToIntegrationFrameFunction_( rotationFromBodyFixedToIntegrationFrameFunction ),
           sphericalHarmonicsCache_( sphericalHarmonicsCache ),
           currentAcceleration_( Eigen::Vector3d::Zero( ) ),
+          accelerationKernel_( accelerationKernel ),
+          summationMethod_( forward_recursion_summation ),
           saveSphericalHarmonicTermsSeparately_( false )
     {
+        if( accelerationKernel_ == nullptr )
+        {
+            accelerationKernel_ = std::make_shared< SphericalHarmonicsAccelerationKernel >( );
+        }
+
         maximumDegree_ = static_cast< int >( getCosineHarmonicsCoefficients( ).rows( ) );
         maximumOrder_ = static_cast< int >( getCosineHarmonicsCoefficients( ).cols( ) );
         sphericalHarmonicsCache_->resetMaximumDegreeAndOrder(
                     std::max< int >( maximumDegree_,
                                      sphericalHarmonicsCache_->getMaximumDegree( ) ),
-                    std::max< int >( maximumOrder_,
-                                     sphericalHarmonicsCache_->getMaximumOrder( ) ) + 1 );
+                    std::max< int >( maximumOrder_ + 1,
+                                     sphericalHarmonicsCache_->getMaximumOrder( ) ) );
 
 
         this->updateMembers( );
@@ -341,16 +365,26 @@ public:
             currentRelativePosition_ = rotationToIntegrationFrame_.inverse( ) * (
                         currentInertialRelativePosition_ );
 
-            currentAcceleration_ =
-                    computeGeodesyNormalizedGravitationalAccelerationSum(
-                        currentRelativePosition_,
-                        gravitationalParameter,
-                        equatorialRadius,
-                        cosineHarmonicCoefficients,
-                        sineHarmonicCoefficients, sphericalHarmonicsCache_,
-                        accelerationPerTerm_,
-                        saveSphericalHarmonicTermsSeparately_,
-                        rotationToIntegrationFrame_.toRotationMatrix( ) );
+            if( saveSphericalHarmonicTermsSeparately_ )
+            {
+                currentAcceleration_ =
+                        computeGeodesyNormalizedGravitationalAccelerationSum(
+                            currentRelativePosition_,
+                            gravitationalParameter,
+                            equatorialRadius,
+                            cosineHarmonicCoefficients,
+                            sineHarmonicCoefficients, sphericalHarmonicsCache_,
+                            accelerationPerTerm_,
+                            saveSphericalHarmonicTermsSeparately_,
+                            rotationToIntegrationFrame_.toRotationMatrix( ) );
+            }
+            else
+            {
+                // Compute total acceleration with dedicated kernel (coefficients only repacked if changed).
+                accelerationKernel_->updateCoefficients( cosineHarmonicCoefficients, sineHarmonicCoefficients );
+                currentAcceleration_ = rotationToIntegrationFrame_ * accelerationKernel_->computeAcceleration(
+                            currentRelativePosition_, gravitationalParameter, equatorialRadius, summationMethod_ );
+            }
             currentAccelerationInBodyFixedFrame_ = rotationToIntegrationFrame_.inverse( ) * currentAcceleration_;
         }
     }
@@ -422,6 +456,16 @@ public:
         return sphericalHarmonicsCache_;
     }
 
+    //! Function to retrieve the kernel used to compute the total acceleration, if the separate terms are not saved.
+    /*!
+     *  Function to retrieve the kernel used to compute the total acceleration, if the separate terms are not saved.
+     *  \return Kernel used to compute the total acceleration
+     */
+    std::shared_ptr< SphericalHarmonicsAccelerationKernel > getAccelerationKernel( )
+    {
+        return accelerationKernel_;
+    }
+
     //! Function to return current position vector from body exerting acceleration to body undergoing acceleration, in frame
     //! fixed to body undergoing acceleration
     /*!
@@ -507,6 +551,29 @@ public:
         saveSphericalHarmonicTermsSeparately_ = saveSphericalHarmonicTermsSeparately;
     }
 
+    //! Function to set the method by which the sums over degree are evaluated (if terms are not saved separately)
+    /*!
+     * Function to set the method by which the sums over degree are evaluated by the acceleration kernel, which is used
+     * if the separate spherical harmonic terms are not saved. The setting only applies to this model, not to other models
+     * sharing its kernel.
+     * \param summationMethod Method by which the sums over degree are evaluated.
+     */
+    void setSphericalHarmonicsSummationMethod( const SphericalHarmonicsSummationMethod summationMethod )
+    {
+        summationMethod_ = summationMethod;
+    }
+
+    //! Function to retrieve the method by which the sums over degree are evaluated (if terms are not saved separately)
+    /*!
+     * Function to retrieve the method by which the sums over degree are evaluated by the acceleration kernel, which is
+     * used if the separate spherical harmonic terms are not saved.
+     * \return Method by which the sums over degree are evaluated.
+     */
+    SphericalHarmonicsSummationMethod getSphericalHarmonicsSummationMethod( )
+    {
+        return summationMethod_;
+    }
+
     //! Function to retrieve the contributions of separate degrees/ordesr to the acceleration, concatenated in a single vector
     /*!
      * Function to retrieve the contributions of specific separate degree/order to the acceleration, concatenated in a single
@@ -608,6 +675,12 @@ private:
     //! Current acceleration in frame fixed to body undergoing acceleration, as computed by last call to updateMembers function
     Eigen::Vector3d currentAccelerationInBodyFixedFrame_;
 
+    //! Kernel used to compute the total acceleration, if the separate terms are not saved.
+    std::shared_ptr< SphericalHarmonicsAccelerationKernel > accelerationKernel_;
+
+    //! Method by which the sums over degree are evaluated by accelerationKernel_.
+    SphericalHarmonicsSummationMethod summationMethod_;
+
     //! List of contributions to accelerations at given degrees/orders, represented by first/second entry of map key pair.
     std::map< std::pair< int, int >, Eigen::Vector3d > accelerationPerTerm_;
 
@@ -0,0 +1,188 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Basics/testMacros.h"
+
+#include "Tudat/Astrodynamics/ObservationModels/oneWayRangeObservationModel.h"
+#include "Tudat/Astrodynamics/ObservationModels/simulateObservations.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::observation_models;
+
+BOOST_AUTO_TEST_SUITE( test_observation_visibility_windows )
+
+//! Function returning the state of a point on a circular orbit in the xy-plane.
+Eigen::Vector6d getCircularOrbitState( const double time, const double orbitRadius, const double meanMotion )
+{
+    return ( Eigen::Vector6d( ) << orbitRadius * std::cos( meanMotion * time ), orbitRadius * std::sin( meanMotion * time ),
+             0.0, -orbitRadius * meanMotion * std::sin( meanMotion * time ),
+             orbitRadius * meanMotion * std::cos( meanMotion * time ), 0.0 ).finished( );
+}
+
+//! Test whether the visibility windows of a link, and the observations simulated inside them, are correctly computed.
+BOOST_AUTO_TEST_CASE( testVisibilityWindowObservationSimulation )
+{
+    // Define station on (non-rotating) central body at (R,0,0), and target on circular orbit with radius 2R. The elevation
+    // angle is then positive when the orbit angle is within 60 degrees of the x-axis.
+    const double bodyRadius = 6378.0E3;
+    const double meanMotion = 2.0 * mathematical_constants::PI / 10000.0;
+    const double minimumElevationAngle = 0.0;
+
+    std::function< Eigen::Vector6d( const double ) > stationStateFunction =
+            [ = ]( const double ){ return ( Eigen::Vector6d( ) << bodyRadius, 0.0, 0.0, 0.0, 0.0, 0.0 ).finished( ); };
+    std::function< Eigen::Vector6d( const double ) > targetStateFunction =
+            std::bind( &getCircularOrbitState, std::placeholders::_1, 2.0 * bodyRadius, meanMotion );
+
+    std::shared_ptr< OneWayRangeObservationModel< double, double > > observationModel =
+            std::make_shared< OneWayRangeObservationModel< double, double > >(
+                std::make_shared< LightTimeCalculator< double, double > >( stationStateFunction, targetStateFunction ) );
+
+    // Topocentric frame at station, with local z-axis along inertial x-axis.
+    std::shared_ptr< ground_stations::PointingAnglesCalculator > pointingAnglesCalculator =
+            std::make_shared< ground_stations::PointingAnglesCalculator >(
+                [ ]( const double ){ return Eigen::Quaterniond::Identity( ); },
+                [ ]( const double ){ return Eigen::Quaterniond(
+                        Eigen::AngleAxisd( -mathematical_constants::PI / 2.0, Eigen::Vector3d::UnitY( ) ) ); } );
+    std::vector< std::shared_ptr< ObservationViabilityCalculator > > viabilityCalculators;
+    viabilityCalculators.push_back(
+                std::make_shared< MinimumElevationAngleCalculator >(
+                    std::vector< std::pair< int, int > >( { std::make_pair( 0, 1 ) } ), minimumElevationAngle,
+                    pointingAnglesCalculator ) );
+
+    // Compute windows over three orbital periods
+    const double startTime = 1000.0;
+    const double endTime = 31000.0;
+    std::vector< std::pair< double, double > > visibilityWindows =
+            computeObservationVisibilityWindows< 1, double, double >(
+                observationModel, receiver, viabilityCalculators, startTime, endTime, 300.0 );
+
+    // Check windows against analytical rise/set times (up to light-time effect).
+    const double orbitalPeriod = 2.0 * mathematical_constants::PI / meanMotion;
+    std::vector< std::pair< double, double > > expectedWindows;
+    for( int i = 0; i < 4; i++ )
+    {
+        double windowStart = std::max( static_cast< double >( i ) * orbitalPeriod - orbitalPeriod / 6.0, startTime );
+        double windowEnd = std::min( static_cast< double >( i ) * orbitalPeriod + orbitalPeriod / 6.0, endTime );
+        if( windowEnd > windowStart )
+        {
+            expectedWindows.push_back( std::make_pair( windowStart, windowEnd ) );
+        }
+    }
+
+    BOOST_CHECK_EQUAL( visibilityWindows.size( ), expectedWindows.size( ) );
+    for( unsigned int i = 0; i < visibilityWindows.size( ); i++ )
+    {
+        BOOST_CHECK_SMALL( visibilityWindows.at( i ).first - expectedWindows.at( i ).first, 0.1 );
+        BOOST_CHECK_SMALL( visibilityWindows.at( i ).second - expectedWindows.at( i ).second, 0.1 );
+    }
+
+    // Simulate observations at 10 s cadence, both with and without precomputation of windows.
+    std::vector< double > observationTimes;
+    double currentTime = startTime;
+    while( currentTime <= endTime )
+    {
+        observationTimes.push_back( currentTime );
+        currentTime += 10.0;
+    }
+
+    std::pair< Eigen::VectorXd, std::pair< std::vector< double >, LinkEndType > > tabulatedObservations =
+            simulateSingleObservationSet< double, double, 1 >(
+                std::make_shared< TabulatedObservationSimulationTimeSettings< double > >( receiver, observationTimes ),
+                observationModel, viabilityCalculators );
+    std::pair< Eigen::VectorXd, std::pair< std::vector< double >, LinkEndType > > windowedObservations =
+            simulateSingleObservationSet< double, double, 1 >(
+                std::make_shared< VisibilityWindowObservationSimulationTimeSettings< double > >(
+                    receiver, startTime, endTime, 10.0, 300.0 ),
+                observationModel, viabilityCalculators );
+
+    // Check whether the same observations are obtained
+    BOOST_CHECK_EQUAL( windowedObservations.first.rows( ), tabulatedObservations.first.rows( ) );
+    BOOST_CHECK_EQUAL( windowedObservations.second.first.size( ), tabulatedObservations.second.first.size( ) );
+    for( unsigned int i = 0; i < tabulatedObservations.second.first.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( windowedObservations.second.first.at( i ), tabulatedObservations.second.first.at( i ) );
+        BOOST_CHECK_EQUAL( windowedObservations.first( i ), tabulatedObservations.first( i ) );
+    }
+    BOOST_CHECK( tabulatedObservations.second.first.size( ) < observationTimes.size( ) / 2 );
+}
+
+//! Test whether the sign of the viability margin is consistent with the viability check.
+BOOST_AUTO_TEST_CASE( testObservationViabilityMargins )
+{
+    std::shared_ptr< ground_stations::PointingAnglesCalculator > pointingAnglesCalculator =
+            std::make_shared< ground_stations::PointingAnglesCalculator >(
+                [ ]( const double ){ return Eigen::Quaterniond::Identity( ); },
+                [ ]( const double ){ return Eigen::Quaterniond::Identity( ); } );
+
+    const std::vector< std::pair< int, int > > linkEndIndices = { std::make_pair( 0, 1 ) };
+    std::vector< std::shared_ptr< ObservationViabilityCalculator > > viabilityCalculators;
+    viabilityCalculators.push_back(
+                std::make_shared< MinimumElevationAngleCalculator >( linkEndIndices, 0.2, pointingAnglesCalculator ) );
+    viabilityCalculators.push_back(
+                std::make_shared< MaximumElevationAngleCalculator >( linkEndIndices, 1.2, pointingAnglesCalculator ) );
+    viabilityCalculators.push_back(
+                std::make_shared< BodyAvoidanceAngleCalculator >(
+                    linkEndIndices, 0.5, [ ]( const double ){ return Eigen::Vector6d::Zero( ).eval( ); }, "Sun" ) );
+    viabilityCalculators.push_back(
+                std::make_shared< OccultationCalculator >(
+                    linkEndIndices, [ ]( const double ){ return Eigen::Vector6d::Zero( ).eval( ); }, 1.0 ) );
+
+    std::mt19937 randomNumberGenerator( 42 );
+    std::uniform_real_distribution< double > distribution( -3.0, 3.0 );
+    int numberOfViableObservations = 0;
+    for( int i = 0; i < 1000; i++ )
+    {
+        std::vector< Eigen::Vector6d > linkEndStates;
+        for( int j = 0; j < 2; j++ )
+        {
+            Eigen::Vector6d currentState = Eigen::Vector6d::Zero( );
+            do
+            {
+                currentState.segment( 0, 3 ) << distribution( randomNumberGenerator ),
+                        distribution( randomNumberGenerator ), distribution( randomNumberGenerator );
+            } while( currentState.segment( 0, 3 ).norm( ) < 1.0 );
+            linkEndStates.push_back( currentState );
+        }
+        std::vector< double > linkEndTimes = { 0.0, 0.0 };
+
+        for( unsigned int j = 0; j < viabilityCalculators.size( ); j++ )
+        {
+            BOOST_CHECK_EQUAL( viabilityCalculators.at( j )->isObservationViable( linkEndStates, linkEndTimes ),
+                               viabilityCalculators.at( j )->getObservationViabilityMargin( linkEndStates, linkEndTimes ) > 0.0 );
+        }
+
+        bool isViable = isObservationViable( linkEndStates, linkEndTimes, viabilityCalculators );
+        BOOST_CHECK_EQUAL( isViable,
+                           getObservationViabilityMargin( linkEndStates, linkEndTimes, viabilityCalculators ) > 0.0 );
+        if( isViable )
+        {
+            numberOfViableObservations++;
+        }
+    }
+    BOOST_CHECK( numberOfViableObservations > 0 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+}
+
+}
@@ -281,103 +281,80 @@ public:
             const ObservationScalarType tolerance =
             ( getDefaultLightTimeTolerance< ObservationScalarType >( ) ) )
     {
-        // Initialize reception and transmission times and states to initial guess (zero light time)
-        TimeType receptionTime = time;
-        TimeType transmissionTime = time;
-        StateType receiverState = stateFunctionOfReceivingBody_( receptionTime );
-        StateType transmitterState =
-                stateFunctionOfTransmittingBody_( transmissionTime );
-
-        // Set initial light-time correction.
-        setTotalLightTimeCorrection(
-                    transmitterState, receiverState, transmissionTime, receptionTime );
-
-        // Calculate light-time solution assuming infinte speed of signal as initial estimate.
-        ObservationScalarType previousLightTimeCalculation =
-                calculateNewLightTimeEstime( receiverState, transmitterState );
-
-        // Set variables for iteration
-        ObservationScalarType newLightTimeCalculation = 0.0;
-        bool isToleranceReached = false;
-
-        // Recalculate light-time solution until tolerance is reached.
-        int counter = 0;
+        // Compute state of link end at which time is fixed.
+        StateType fixedLinkEndState = isTimeAtReception ?
+                    stateFunctionOfReceivingBody_( time ) : stateFunctionOfTransmittingBody_( time );
+
+        // Iterate light time from initial guess of zero (infinite speed of signal).
+        return iterateLightTime(
+                    receiverStateOutput, transmitterStateOutput, time, fixedLinkEndState,
+                    mathematical_constants::getFloatingInteger< ObservationScalarType >( 0 ), isTimeAtReception, tolerance );
+    }
 
-        // Set variable determining whether to update the light time each iteration.
-        bool updateLightTimeCorrections = false;
-        if( iterateCorrections_ )
+    //! Function to calculate the light times and link-ends states for a list of observation times.
+    /*!
+     *  Function to calculate the transmitter states at transmission time, the receiver states at reception time, and the
+     *  light times, for a list of times at the same link end (typically all observations in a single tracking pass).
+     *  The states of the link end at which the time is fixed are first computed for all times. Subsequently, the light time
+     *  of each observation is iterated from an initial guess extrapolated from the converged light times of the preceding
+     *  observation(s), which reduces the number of iterations (and state function evaluations) for densely spaced
+     *  observations. Times should therefore be provided in chronological order, although this is not required.
+     *  \param receiverStatesOutput Output by reference of receiver states.
+     *  \param transmitterStatesOutput Output by reference of transmitter states.
+     *  \param times Times at reception or transmission.
+     *  \param isTimeAtReception True if input times are at reception, false if at transmission.
+     *  \param tolerance Maximum allowed light-time difference between two subsequent iterations
+     *  for which solution is accepted.
+     *  \return The values of the light time between the reciever states and the transmitter states.
+     */
+    std::vector< ObservationScalarType > calculateLightTimesWithLinkEndsStates(
+            std::vector< StateType >& receiverStatesOutput,
+            std::vector< StateType >& transmitterStatesOutput,
+            const std::vector< TimeType >& times,
+            const bool isTimeAtReception = 1,
+            const ObservationScalarType tolerance =
+            ( getDefaultLightTimeTolerance< ObservationScalarType >( ) ) )
+    {
+        const unsigned int numberOfTimes = times.size( );
+        std::vector< ObservationScalarType > lightTimes( numberOfTimes );
+        receiverStatesOutput.resize( numberOfTimes );
+        transmitterStatesOutput.resize( numberOfTimes );
+
+        // Compute states of link end at which times are fixed.
+        std::vector< StateType > fixedLinkEndStates( numberOfTimes );
+        for( unsigned int i = 0; i < numberOfTimes; i++ )
         {
-            updateLightTimeCorrections = true;
+            fixedLinkEndStates[ i ] = isTimeAtReception ?
+                        stateFunctionOfReceivingBody_( times[ i ] ) : stateFunctionOfTransmittingBody_( times[ i ] );
         }
 
-        // Iterate until tolerance reached.
-        while( !isToleranceReached )
+        ObservationScalarType initialLightTimeGuess;
+        for( unsigned int i = 0; i < numberOfTimes; i++ )
         {
-            // Update light-time corrections, if necessary.
-            if( updateLightTimeCorrections )
-            {
-                setTotalLightTimeCorrection(
-                            transmitterState, receiverState, transmissionTime, receptionTime );
-            }
-
-            // Update light-time estimate for this iteration.
-            if( isTimeAtReception )
+            // Set initial guess from light time(s) of preceding observations (zero for first observation)
+            initialLightTimeGuess = mathematical_constants::getFloatingInteger< ObservationScalarType >( 0 );
+            if( i > 0 )
             {
-                receptionTime = time;
-                transmissionTime = time - previousLightTimeCalculation;
-                transmitterState = ( stateFunctionOfTransmittingBody_( transmissionTime ) );
+                initialLightTimeGuess = lightTimes[ i - 1 ];
             }
-            else
+            if( i > 1 && !( times[ i - 1 ] == times[ i - 2 ] ) )
             {
-                receptionTime = time + previousLightTimeCalculation;
-                transmissionTime = time;
-                receiverState = ( stateFunctionOfReceivingBody_( receptionTime ) );
-            }
-            newLightTimeCalculation = calculateNewLightTimeEstime( receiverState, transmitterState );
-
-            // Check for convergence.
-            if( std::fabs( newLightTimeCalculation - previousLightTimeCalculation ) < tolerance )
-            {
-                // If convergence reached, but light-time corrections not iterated,
-                // perform 1 more iteration to check for change in correction.
-                if( !updateLightTimeCorrections )
-                {
-                    updateLightTimeCorrections = true;
-                }
-                else
-                {
-                    isToleranceReached = true;
-                }
-            }
-            else
-            {
-                // Get out of infinite loop (for instance due to low accuracy state functions,
-                // to stringent tolerance or limit case for trop. corrections).
-                if( counter == 50 )
+                ObservationScalarType extrapolatedLightTime = lightTimes[ i - 1 ] +
+                        ( lightTimes[ i - 1 ] - lightTimes[ i - 2 ] ) *
+                        static_cast< ObservationScalarType >( times[ i ] - times[ i - 1 ] ) /
+                        static_cast< ObservationScalarType >( times[ i - 1 ] - times[ i - 2 ] );
+                if( extrapolatedLightTime > mathematical_constants::getFloatingInteger< ObservationScalarType >( 0 ) )
                 {
-                    isToleranceReached = true;
-                    std::string errorMessage  =
-                            "Warning, light time unconverged at level " +
-                            std::to_string(
-                                std::fabs( newLightTimeCalculation - previousLightTimeCalculation ) ) +
-                            "; current light-time corrections are: "  +
-                            std::to_string( currentCorrection_ ) + " and input time was " +
-                            std::to_string( static_cast< double >( time ) );
-                   std::cerr << errorMessage << std::endl;
+                    initialLightTimeGuess = extrapolatedLightTime;
                 }
-
-                // Update light time for new iteration.
-                previousLightTimeCalculation = newLightTimeCalculation;
             }
 
-            counter++;
+            lightTimes[ i ] = iterateLightTime(
+                        receiverStatesOutput[ i ], transmitterStatesOutput[ i ], times[ i ], fixedLinkEndStates[ i ],
+                        initialLightTimeGuess, isTimeAtReception, tolerance );
         }
 
-        // Set output variables and return the light time.
-        receiverStateOutput = receiverState;
-        transmitterStateOutput = transmitterState;
-
-        return newLightTimeCalculation;
+        return lightTimes;
     }
 
     //! Function to get the part wrt linkend position
@@ -471,6 +448,140 @@ protected:
                 physical_constants::getSpeedOfLight< ObservationScalarType >( ) + currentCorrection_;
     }
 
+    //! Function to iterate the light time from a given initial guess.
+    /*!
+     *  Function to iterate the light time from a given initial guess, until the difference between two subsequent
+     *  iterations is below the tolerance.
+     *  \param receiverStateOutput Output by reference of receiver state.
+     *  \param transmitterStateOutput Output by reference of transmitter state.
+     *  \param time Time at reception or transmission.
+     *  \param fixedLinkEndState State of the link end at which the time is fixed (receiver if isTimeAtReception is true,
+     *  transmitter otherwise), evaluated at the input time.
+     *  \param initialLightTimeGuess Initial guess of light time.
+     *  \param isTimeAtReception True if input time is at reception, false if at transmission.
+     *  \param tolerance Maximum allowed light-time difference between two subsequent iterations
+     *  for which solution is accepted.
+     *  \return The value of the light time between the reciever state and the transmitter state.
+     */
+    ObservationScalarType iterateLightTime(
+            StateType& receiverStateOutput,
+            StateType& transmitterStateOutput,
+            const TimeType time,
+            const StateType& fixedLinkEndState,
+            const ObservationScalarType initialLightTimeGuess,
+            const bool isTimeAtReception,
+            const ObservationScalarType tolerance )
+    {
+        // Initialize reception and transmission times and states to initial guess
+        TimeType receptionTime, transmissionTime;
+        StateType receiverState, transmitterState;
+        if( isTimeAtReception )
+        {
+            receptionTime = time;
+            transmissionTime = time - initialLightTimeGuess;
+            receiverState = fixedLinkEndState;
+            transmitterState = stateFunctionOfTransmittingBody_( transmissionTime );
+        }
+        else
+        {
+            receptionTime = time + initialLightTimeGuess;
+            transmissionTime = time;
+            receiverState = stateFunctionOfReceivingBody_( receptionTime );
+            transmitterState = fixedLinkEndState;
+        }
+
+        // Set initial light-time correction.
+        setTotalLightTimeCorrection(
+                    transmitterState, receiverState, transmissionTime, receptionTime );
+
+        // Calculate light-time solution from initial states as initial estimate.
+        ObservationScalarType previousLightTimeCalculation =
+                calculateNewLightTimeEstime( receiverState, transmitterState );
+
+        // Set variables for iteration
+        ObservationScalarType newLightTimeCalculation = 0.0;
+        bool isToleranceReached = false;
+
+        // Recalculate light-time solution until tolerance is reached.
+        int counter = 0;
+
+        // Set variable determining whether to update the light time each iteration.
+        bool updateLightTimeCorrections = false;
+        if( iterateCorrections_ )
+        {
+            updateLightTimeCorrections = true;
+        }
+
+        // Iterate until tolerance reached.
+        while( !isToleranceReached )
+        {
+            // Update light-time corrections, if necessary.
+            if( updateLightTimeCorrections )
+            {
+                setTotalLightTimeCorrection(
+                            transmitterState, receiverState, transmissionTime, receptionTime );
+            }
+
+            // Update light-time estimate for this iteration.
+            if( isTimeAtReception )
+            {
+                receptionTime = time;
+                transmissionTime = time - previousLightTimeCalculation;
+                transmitterState = ( stateFunctionOfTransmittingBody_( transmissionTime ) );
+            }
+            else
+            {
+                receptionTime = time + previousLightTimeCalculation;
+                transmissionTime = time;
+                receiverState = ( stateFunctionOfReceivingBody_( receptionTime ) );
+            }
+            newLightTimeCalculation = calculateNewLightTimeEstime( receiverState, transmitterState );
+
+            // Check for convergence.
+            if( std::fabs( newLightTimeCalculation - previousLightTimeCalculation ) < tolerance )
+            {
+                // If convergence reached, but light-time corrections not iterated,
+                // perform 1 more iteration to check for change in correction.
+                if( !updateLightTimeCorrections )
+                {
+                    updateLightTimeCorrections = true;
+                }
+                else
+                {
+                    isToleranceReached = true;
+                }
+            }
+            else
+            {
+                // Get out of infinite loop (for instance due to low accuracy state functions,
+                // to stringent tolerance or limit case for trop. corrections).
+                if( counter == 50 )
+                {
+                    isToleranceReached = true;
+                    std::string errorMessage  =
+                            "Warning, light time unconverged at level " +
+                            std::to_string(
+                                std::fabs( newLightTimeCalculation - previousLightTimeCalculation ) ) +
+                            "; current light-time corrections are: "  +
+                            std::to_string( currentCorrection_ ) + " and input time was " +
+                            std::to_string( static_cast< double >( time ) );
+                   std::cerr << errorMessage << std::endl;
+                }
+
+                // Update light time for new iteration.
+                previousLightTimeCalculation = newLightTimeCalculation;
+            }
+
+            counter++;
+        }
+
+        // Set output variables and return the light time.
+        receiverStateOutput = receiverState;
+        transmitterStateOutput = transmitterState;
+
+        return newLightTimeCalculation;
+    }
+
     //! Function to reset the currentCorrection_ variable during current iteration.
     /*!
      *  Function to reset the currentCorrection_ variable during current iteration, representing
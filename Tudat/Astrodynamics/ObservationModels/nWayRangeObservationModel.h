@@ -208,6 +208,144 @@ public:
                      ) << totalLightTime * physical_constants::getSpeedOfLight< ObservationScalarType >( ) ).finished( );
     }
 
+    //! Function to compute n-way range observables without any corrections at a list of times.
+    /*!
+     *  Function to compute n-way range observables without any corrections at a list of times. The legs of the n-way link
+     *  are solved one after the other (in the same order as in computeIdealObservationsWithLinkEndData), each for all
+     *  observations together, using a batch solution of the light times (see
+     *  LightTimeCalculator::calculateLightTimesWithLinkEndsStates). Times should be provided in chronological order.
+     *  \param times Times at which observable is to be evaluated.
+     *  \param linkEndAssociatedWithTime Link end at which given times are valid, i.e. link end for which associated time
+     *  is kept constant (to input value)
+     *  \param linkEndTimes List of times at each link end during each observation.
+     *  \param linkEndStates List of states at each link end during each observation.
+     *  \return Ideal n-way range observables.
+     */
+    std::vector< Eigen::Matrix< ObservationScalarType, 1, 1 > > computeIdealObservationsWithLinkEndDataAtTimes(
+            const std::vector< TimeType >& times,
+            const LinkEndType linkEndAssociatedWithTime,
+            std::vector< std::vector< double > >& linkEndTimes,
+            std::vector< std::vector< Eigen::Matrix< double, 6, 1 > > >& linkEndStates )
+    {
+        const unsigned int numberOfTimes = times.size( );
+
+        // Initialize total light-times, and resize link-end states/times
+        std::vector< ObservationScalarType > totalLightTimes(
+                    numberOfTimes, mathematical_constants::getFloatingInteger< ObservationScalarType >( 0 ) );
+        linkEndTimes.resize( numberOfTimes );
+        linkEndStates.resize( numberOfTimes );
+        for( unsigned int i = 0; i < numberOfTimes; i++ )
+        {
+            linkEndTimes[ i ].clear( );
+            linkEndStates[ i ].clear( );
+            linkEndTimes[ i ].resize( 2 * ( numberOfLinkEnds_ - 1 ) );
+            linkEndStates[ i ].resize( 2 * ( numberOfLinkEnds_ - 1 ) );
+        }
+
+        // Retrieve retransmission delays
+        std::vector< std::vector< double > > retransmissionDelays( numberOfTimes );
+        for( unsigned int i = 0; i < numberOfTimes; i++ )
+        {
+            if( !( retransmissionDelays_ == nullptr ) )
+            {
+                retransmissionDelays[ i ] = retransmissionDelays_( times[ i ] );
+                if( retransmissionDelays[ i ].size( ) != static_cast< unsigned int >( numberOfLinkEnds_ - 2 ) )
+                {
+                    throw std::runtime_error(
+                                "Error when calculating n-way range, retransmission delay vector size is inconsistent" );
+                }
+            }
+            else
+            {
+                retransmissionDelays[ i ].resize( numberOfLinkEnds_, 0.0 );
+            }
+        }
+
+        // Retrieve index of link end where to start.
+        int startLinkEndIndex = getNWayLinkIndexFromLinkEndType( linkEndAssociatedWithTime, numberOfLinkEnds_ );
+        int currentDownIndex = startLinkEndIndex;
+
+        // Define 'current times'
+        std::vector< TimeType > currentLinkEndStartTimes = times;
+        std::vector< ObservationScalarType > currentLightTimes;
+        std::vector< StateType > currentReceiverStates, currentTransmitterStates;
+
+        // Move 'backwards' from reference link end to transmitter.
+        while( currentDownIndex > 0 )
+        {
+            currentLightTimes = lightTimeCalculators_.at( currentDownIndex - 1 )->calculateLightTimesWithLinkEndsStates(
+                        currentReceiverStates, currentTransmitterStates, currentLinkEndStartTimes, 1 );
+
+            for( unsigned int i = 0; i < numberOfTimes; i++ )
+            {
+                // Add link-end times/states for current leg.
+                linkEndStates[ i ][ 2 * ( currentDownIndex - 1 ) + 1 ] = currentReceiverStates[ i ].template cast< double >( );
+                linkEndStates[ i ][ 2 * ( currentDownIndex - 1 ) ] = currentTransmitterStates[ i ].template cast< double >( );
+                linkEndTimes[ i ][ 2 * ( currentDownIndex - 1 ) + 1 ] = currentLinkEndStartTimes[ i ];
+                linkEndTimes[ i ][ 2 * ( currentDownIndex - 1 )] = currentLinkEndStartTimes[ i ] - currentLightTimes[ i ];
+
+                // If an additional leg is required, retrieve retransmission delay and update current time
+                currentLinkEndStartTimes[ i ] -= currentLightTimes[ i ];
+                if( currentDownIndex > 1 )
+                {
+                    currentLightTimes[ i ] += retransmissionDelays[ i ].at( currentDownIndex - 2 );
+                }
+
+                // Add computed light-time to total time
+                totalLightTimes[ i ] += currentLightTimes[ i ];
+            }
+            currentDownIndex--;
+        }
+
+        int currentUpIndex = startLinkEndIndex;
+
+        // If start is not at transmitter, compute and add retransmission delay.
+        if( ( startLinkEndIndex != 0 ) && ( startLinkEndIndex != numberOfLinkEnds_ - 1 ) )
+        {
+            for( unsigned int i = 0; i < numberOfTimes; i++ )
+            {
+                currentLinkEndStartTimes[ i ] = times[ i ] + retransmissionDelays[ i ].at( startLinkEndIndex - 1 );
+                totalLightTimes[ i ] += retransmissionDelays[ i ].at( startLinkEndIndex - 1 );
+            }
+        }
+
+        // Move 'forwards' from reference link end to receiver.
+        while( currentUpIndex < static_cast< int >( lightTimeCalculators_.size( ) ) )
+        {
+            currentLightTimes = lightTimeCalculators_.at( currentUpIndex )->calculateLightTimesWithLinkEndsStates(
+                        currentReceiverStates, currentTransmitterStates, currentLinkEndStartTimes, 0 );
+
+            for( unsigned int i = 0; i < numberOfTimes; i++ )
+            {
+                // Add link-end times/states for current leg.
+                linkEndStates[ i ][ 2 * currentUpIndex + 1 ] = currentReceiverStates[ i ].template cast< double >( );
+                linkEndStates[ i ][ 2 * currentUpIndex ] = currentTransmitterStates[ i ].template cast< double >( );
+                linkEndTimes[ i ][ 2 * currentUpIndex + 1 ] = currentLinkEndStartTimes[ i ] + currentLightTimes[ i ];
+                linkEndTimes[ i ][ 2 * currentUpIndex ] = currentLinkEndStartTimes[ i ];
+
+                // If an additional leg is required, retrieve retransmission delay and update current time
+                currentLinkEndStartTimes[ i ] += currentLightTimes[ i ];
+                if( currentUpIndex < static_cast< int >( lightTimeCalculators_.size( ) ) - 1 )
+                {
+                    currentLightTimes[ i ] += retransmissionDelays[ i ].at( currentUpIndex );
+                }
+
+                // Add computed light-time to total time
+                totalLightTimes[ i ] += currentLightTimes[ i ];
+            }
+            currentUpIndex++;
+        }
+
+        // Return total range observations.
+        std::vector< Eigen::Matrix< ObservationScalarType, 1, 1 > > observations( numberOfTimes );
+        for( unsigned int i = 0; i < numberOfTimes; i++ )
+        {
+            observations[ i ] = ( Eigen::Matrix< ObservationScalarType, 1, 1 >( ) <<
+                                  totalLightTimes[ i ] * physical_constants::getSpeedOfLight< ObservationScalarType >( ) ).finished( );
+        }
+        return observations;
+    }
+
     std::vector< std::shared_ptr< LightTimeCalculator< ObservationScalarType, TimeType > > > getLightTimeCalculators( )
     {
         return lightTimeCalculators_;
@@ -112,6 +112,21 @@ protected:
         return stateTransitionMatrixInterface_->getFullCombinedStateTransitionAndSensitivityMatrix( evaluationTime );
     }
 
+    //! Function to get the state transition and sensitivity matrix, into existing storage.
+    /*!
+     *  Function to get the state transition matrix Phi and sensitivity matrix S at a given time as a single matrix [Phi;S],
+     *  into existing storage (without memory allocation if the matrix has the correct size, and the interface supports it).
+     *  \param evaluationTime Time at which matrices are to be evaluated
+     *  \param combinedStateTransitionMatrix Concatenated state transition and sensitivity matrices at given time (returned
+     *  by reference).
+     */
+    void getCombinedStateTransitionAndSensitivityMatrix( const double evaluationTime,
+                                                         Eigen::MatrixXd& combinedStateTransitionMatrix )
+    {
+        stateTransitionMatrixInterface_->getFullCombinedStateTransitionAndSensitivityMatrix(
+                    evaluationTime, combinedStateTransitionMatrix );
+    }
+
 
     //! Type of observable for which the instance of this class will compute observations/observation partials
     ObservableType observableType_;
@@ -350,11 +365,21 @@ protected:
         // Perform updates of dependent variables used by (subset of) observation partials.
         updatePartials( states, times, linkEnds, linkEndAssociatedWithTime, currentObservation );
 
-        currentLinkEndPartials = observationPartials_[ linkEnds ];
+        // Retrieve partials of current link ends (without modifying member variables, so that different link ends may be
+        // processed concurrently)
+        typename std::map< LinkEnds, std::map< std::pair< int, int >, std::shared_ptr<
+                observation_partials::ObservationPartial< ObservationSize > > > >::const_iterator linkEndPartialsIterator =
+                observationPartials_.find( linkEnds );
+        if( linkEndPartialsIterator == observationPartials_.end( ) )
+        {
+            return partialMatrix;
+        }
+        const std::map< std::pair< int, int >, std::shared_ptr< observation_partials::ObservationPartial< ObservationSize > > >&
+                currentLinkEndPartials = linkEndPartialsIterator->second;
 
         // Iterate over all observation partials associated with given link ends.
         for( typename std::map< std::pair< int, int >, std::shared_ptr<
-             observation_partials::ObservationPartial< ObservationSize > > >::iterator
+             observation_partials::ObservationPartial< ObservationSize > > >::const_iterator
              partialIterator = currentLinkEndPartials.begin( );
              partialIterator != currentLinkEndPartials.end( ); partialIterator++ )
         {
@@ -375,16 +400,20 @@ protected:
             {
                 for( unsigned int i = 0; i < singlePartialSet.size( ); i++ )
                 {
-                    // Evaluate [Phi;S] matrix at each time instant associated with partial, if not yet evaluated.
-                    if( combinedStateTransitionMatrices.count( singlePartialSet[ i ].second ) == 0 )
+                    // Evaluate [Phi;S] matrix at each time instant associated with partial (directly into map entry),
+                    // if not yet evaluated.
+                    std::map< double, Eigen::MatrixXd >::iterator matrixIterator =
+                            combinedStateTransitionMatrices.find( singlePartialSet[ i ].second );
+                    if( matrixIterator == combinedStateTransitionMatrices.end( ) )
                     {
-                        combinedStateTransitionMatrices[ singlePartialSet[ i ].second ] =
-                                this->getCombinedStateTransitionAndSensitivityMatrix( singlePartialSet[ i ].second );
+                        matrixIterator = combinedStateTransitionMatrices.insert(
+                                    std::make_pair( singlePartialSet[ i ].second, Eigen::MatrixXd( ) ) ).first;
+                        this->getCombinedStateTransitionAndSensitivityMatrix(
+                                    singlePartialSet[ i ].second, matrixIterator->second );
                     }
 
                     // Add partial of observation h w.r.t. initial state x_{0} (dh/dx_{0}=dh/dx*dx/dx_{0})
-                    partialMatrix += ( singlePartialSet[ i ].first ) *
-                            combinedStateTransitionMatrices[ singlePartialSet[ i ].second ].block
+                    partialMatrix.noalias( ) += ( singlePartialSet[ i ].first ) * matrixIterator->second.block
                             ( currentIndexInfo.first, 0, currentIndexInfo.second, fullParameterVector );
                 }
             }
@@ -415,10 +444,6 @@ protected:
     std::map< LinkEnds, std::map< std::pair< int, int >, std::shared_ptr<
     observation_partials::ObservationPartial< ObservationSize > > > > observationPartials_;
 
-    //! Pre-declared map used in computation of partials.
-    std::map< std::pair< int, int >, std::shared_ptr< observation_partials::ObservationPartial< ObservationSize > > >
-    currentLinkEndPartials;
-
 };
 
 extern template class ObservationManagerBase< double, double >;
@@ -151,6 +151,73 @@ public:
         }
     }
 
+    //! Function to compute the observable without any corrections at a list of times.
+    /*!
+     *  Function to compute the observable without any corrections at a list of times (typically all observations in a
+     *  single tracking pass), returning the times and states of the link ends of each observation by reference. This base
+     *  class implementation calls computeIdealObservationsWithLinkEndData for each time. Derived classes may redefine this
+     *  function to solve the observations of the complete list together (e.g. with a batch light-time solution), for which
+     *  the times should be provided in chronological order.
+     *  \param times Times at which observable is to be evaluated.
+     *  \param linkEndAssociatedWithTime Link end at which given times are valid, i.e. link end for which associated time
+     *  is kept constant (to input value)
+     *  \param linkEndTimes List of times at each link end during each observation (returned by reference).
+     *  \param linkEndStates List of states at each link end during each observation (returned by reference).
+     *  \return Ideal observables at each of the input times.
+     */
+    virtual std::vector< Eigen::Matrix< ObservationScalarType, ObservationSize, 1 > >
+    computeIdealObservationsWithLinkEndDataAtTimes(
+            const std::vector< TimeType >& times,
+            const LinkEndType linkEndAssociatedWithTime,
+            std::vector< std::vector< double > >& linkEndTimes,
+            std::vector< std::vector< Eigen::Matrix< double, 6, 1 > > >& linkEndStates )
+    {
+        std::vector< Eigen::Matrix< ObservationScalarType, ObservationSize, 1 > > observations( times.size( ) );
+        linkEndTimes.resize( times.size( ) );
+        linkEndStates.resize( times.size( ) );
+        for( unsigned int i = 0; i < times.size( ); i++ )
+        {
+            observations[ i ] = computeIdealObservationsWithLinkEndData(
+                        times[ i ], linkEndAssociatedWithTime, linkEndTimes[ i ], linkEndStates[ i ] );
+        }
+        return observations;
+    }
+
+    //! Function to compute full observations at a list of times.
+    /*!
+     *  Function to compute observations at a list of times (include any defined non-ideal corrections), using the
+     *  computeIdealObservationsWithLinkEndDataAtTimes function. The times and states of the link ends of each observation are
+     *  returned by reference.
+     *  \param times Times at which observations are to be simulated
+     *  \param linkEndAssociatedWithTime Link end at which current times are measured, i.e. reference
+     *  link end for observable.
+     *  \param linkEndTimes List of times at each link end during each observation (returned by reference).
+     *  \param linkEndStates List of states at each link end during each observation (returned by reference).
+     *  \return Calculated observables at each of the input times.
+     */
+    std::vector< Eigen::Matrix< ObservationScalarType, ObservationSize, 1 > > computeObservationsWithLinkEndDataAtTimes(
+                const std::vector< TimeType >& times,
+                const LinkEndType linkEndAssociatedWithTime,
+                std::vector< std::vector< double > >& linkEndTimes,
+                std::vector< std::vector< Eigen::Matrix< double, 6, 1 > > >& linkEndStates )
+    {
+        std::vector< Eigen::Matrix< ObservationScalarType, ObservationSize, 1 > > observations =
+                computeIdealObservationsWithLinkEndDataAtTimes(
+                    times, linkEndAssociatedWithTime, linkEndTimes, linkEndStates );
+
+        // Add correction, if any non-ideal models are set.
+        if( !isBiasnullptr_ )
+        {
+            for( unsigned int i = 0; i < observations.size( ); i++ )
+            {
+                observations[ i ] += this->observationBiasCalculator_->getObservationBias(
+                            linkEndTimes[ i ], linkEndStates[ i ], observations[ i ].template cast< double >( ) ).
+                        template cast< ObservationScalarType >( );
+            }
+        }
+        return observations;
+    }
+
     //! Function to compute the observable without any corrections.
     /*!
      * Function to compute the observable without any corrections, i.e. the ideal physical observable as computed
@@ -11,6 +11,8 @@
 #ifndef TUDAT_OBSERVATIONSIMULATOR_H
 #define TUDAT_OBSERVATIONSIMULATOR_H
 
+#include <algorithm>
+
 #include "Tudat/Basics/utilities.h"
 #include "Tudat/Astrodynamics/ObservationModels/observableTypes.h"
 #include "Tudat/Astrodynamics/ObservationModels/observationModel.h"
@@ -80,18 +82,31 @@ simulateObservationsWithCheck(
         std::vector< std::shared_ptr< ObservationViabilityCalculator > >( ) )
 {
     std::map< TimeType, Eigen::Matrix< ObservationScalarType, ObservationSize, 1 > > observations;
-    std::pair< Eigen::Matrix< ObservationScalarType, ObservationSize, 1 >, bool > simulatedObservation;
 
-    for( unsigned int i = 0; i < observationTimes.size( ); i++ )
+    // Compute observations in blocks, so that observation models can solve consecutive observations together, without
+    // storing the link end states of all observations at once.
+    const unsigned int maximumBlockSize = 1000;
+    std::vector< TimeType > currentObservationTimes;
+    std::vector< std::vector< double > > vectorsOfTimes;
+    std::vector< std::vector< Eigen::Vector6d > > vectorsOfStates;
+    std::vector< Eigen::Matrix< ObservationScalarType, ObservationSize, 1 > > calculatedObservations;
+    for( unsigned int blockStartIndex = 0; blockStartIndex < observationTimes.size( ); blockStartIndex += maximumBlockSize )
     {
-        simulatedObservation = simulateObservationWithCheck< ObservationSize, ObservationScalarType, TimeType >(
-                    observationTimes.at( i ), observationModel, linkEndAssociatedWithTime, linkViabilityCalculators );
-
-        // Check if receiving station can view transmitting station.
-        if( simulatedObservation.second )
+        currentObservationTimes.assign(
+                    observationTimes.begin( ) + blockStartIndex,
+                    observationTimes.begin( ) + std::min(
+                        blockStartIndex + maximumBlockSize, static_cast< unsigned int >( observationTimes.size( ) ) ) );
+        calculatedObservations = observationModel->computeObservationsWithLinkEndDataAtTimes(
+                    currentObservationTimes, linkEndAssociatedWithTime, vectorsOfTimes, vectorsOfStates );
+
+        for( unsigned int i = 0; i < currentObservationTimes.size( ); i++ )
         {
-            // If viable, add observable and time to vector of simulated data.
-            observations[ observationTimes[ i ]  ] = simulatedObservation.first;
+            // Check if receiving station can view transmitting station.
+            if( isObservationViable( vectorsOfStates[ i ], vectorsOfTimes[ i ], linkViabilityCalculators ) )
+            {
+                // If viable, add observable and time to vector of simulated data.
+                observations[ currentObservationTimes[ i ] ] = calculatedObservations[ i ];
+            }
         }
     }
 
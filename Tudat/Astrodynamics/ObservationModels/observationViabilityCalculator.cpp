@@ -8,6 +8,9 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include <algorithm>
+#include <limits>
+
 #include "Tudat/Astrodynamics/ObservationModels/observationViabilityCalculator.h"
 
 namespace tudat
@@ -50,6 +53,25 @@ bool isObservationViable(
     return isObservationFeasible;
 }
 
+//! Function to compute the margin by which an observation is viable
+double getObservationViabilityMargin(
+        const std::vector< Eigen::Vector6d >& states, const std::vector< double >& times,
+        const std::vector< std::shared_ptr< ObservationViabilityCalculator > >& viabilityCalculators )
+{
+    double viabilityMargin = 1.0;
+
+    for( unsigned int i = 0; i < viabilityCalculators.size( ); i++ )
+    {
+        double currentMargin = viabilityCalculators.at( i )->getObservationViabilityMargin( states, times );
+        if( i == 0 || currentMargin < viabilityMargin )
+        {
+            viabilityMargin = currentMargin;
+        }
+    }
+
+    return viabilityMargin;
+}
+
 //! Function for determining whether the elevation angle at station is sufficient to allow observation
 bool MinimumElevationAngleCalculator::isObservationViable(
         const std::vector< Eigen::Vector6d >& linkEndStates,
@@ -73,6 +95,25 @@ bool MinimumElevationAngleCalculator::isObservationViable(
     return isObservationPossible;
 }
 
+//! Function for computing the margin between the elevation angle at station and the minimum elevation angle.
+double MinimumElevationAngleCalculator::getObservationViabilityMargin(
+        const std::vector< Eigen::Vector6d >& linkEndStates,
+        const std::vector< double >& linkEndTimes )
+{
+    double viabilityMargin = std::numeric_limits< double >::max( );
+
+    // Iterate over all sets of entries of input vector for which elvation angle is to be checked.
+    for( unsigned int i = 0; i < linkEndIndices_.size( ); i++ )
+    {
+        double elevationAngle = pointingAngleCalculator_->calculateElevationAngle(
+                    ( linkEndStates.at( linkEndIndices_.at( i ).second ) - linkEndStates.at( linkEndIndices_.at( i ).first ) )
+                    .segment( 0, 3 ), linkEndTimes.at( linkEndIndices_.at( i ).first ) );
+        viabilityMargin = std::min( viabilityMargin, elevationAngle - minimumElevationAngle_ );
+    }
+
+    return viabilityMargin;
+}
+
 //! Function for determining whether the elevation angle at station is below the constraint to allow observation
 bool MaximumElevationAngleCalculator::isObservationViable(
         const std::vector< Eigen::Vector6d >& linkEndStates,
@@ -96,6 +137,25 @@ bool MaximumElevationAngleCalculator::isObservationViable(
     return isObservationPossible;
 }
 
+//! Function for computing the margin between the maximum elevation angle and the elevation angle at station.
+double MaximumElevationAngleCalculator::getObservationViabilityMargin(
+        const std::vector< Eigen::Vector6d >& linkEndStates,
+        const std::vector< double >& linkEndTimes )
+{
+    double viabilityMargin = std::numeric_limits< double >::max( );
+
+    // Iterate over all sets of entries of input vector for which elvation angle is to be checked.
+    for( unsigned int i = 0; i < linkEndIndices_.size( ); i++ )
+    {
+        double elevationAngle = pointingAngleCalculator_->calculateElevationAngle(
+                    ( linkEndStates.at( linkEndIndices_.at( i ).second ) - linkEndStates.at( linkEndIndices_.at( i ).first ) )
+                    .segment( 0, 3 ), linkEndTimes.at( linkEndIndices_.at( i ).first ) );
+        viabilityMargin = std::min( viabilityMargin, maximumElevationAngle_ - elevationAngle );
+    }
+
+    return viabilityMargin;
+}
+
 //! Function for determining whether the avoidance angle to a given body at station is sufficient to allow observation.
 bool BodyAvoidanceAngleCalculator::isObservationViable( const std::vector< Eigen::Vector6d >& linkEndStates,
                                                         const std::vector< double >& linkEndTimes )
@@ -127,6 +187,29 @@ bool BodyAvoidanceAngleCalculator::isObservationViable( const std::vector< Eigen
     return isObservationPossible;
 }
 
+//! Function for computing the margin between the angle to the avoided body and the minimum avoidance angle.
+double BodyAvoidanceAngleCalculator::getObservationViabilityMargin( const std::vector< Eigen::Vector6d >& linkEndStates,
+                                                                    const std::vector< double >& linkEndTimes )
+{
+    double viabilityMargin = std::numeric_limits< double >::max( );
+    Eigen::Vector3d positionOfBodyToAvoid;
+
+    // Iterate over all sets of entries of input vector for which avoidance angle is to be checked.
+    for( unsigned int i = 0; i < linkEndIndices_.size( ); i++ )
+    {
+        positionOfBodyToAvoid = stateFunctionOfBodyToAvoid_(
+                    ( linkEndTimes.at( linkEndIndices_.at( i ).first ) + linkEndTimes.at( linkEndIndices_.at( i ).second ) ) / 2.0 )
+                .segment( 0, 3 );
+        double currentAngle = linear_algebra::computeAngleBetweenVectors(
+                    positionOfBodyToAvoid - ( linkEndStates.at( linkEndIndices_.at( i ).first ) ).segment( 0, 3 ),
+                    linkEndStates.at( linkEndIndices_.at( i ).second ).segment( 0, 3 ) -
+                    linkEndStates.at( linkEndIndices_.at( i ).first ).segment( 0, 3 ) );
+        viabilityMargin = std::min( viabilityMargin, currentAngle - bodyAvoidanceAngle_ );
+    }
+
+    return viabilityMargin;
+}
+
 //! Function for determining whether the link is occulted during the observataion.
 bool OccultationCalculator::isObservationViable( const std::vector< Eigen::Vector6d >& linkEndStates,
                                                  const std::vector< double >& linkEndTimes )
@@ -158,6 +241,37 @@ bool OccultationCalculator::isObservationViable( const std::vector< Eigen::Vecto
     return isObservationPossible;
 }
 
+//! Function for computing the margin between the line of sight and the limb of the occulting body.
+double OccultationCalculator::getObservationViabilityMargin( const std::vector< Eigen::Vector6d >& linkEndStates,
+                                                             const std::vector< double >& linkEndTimes )
+{
+    double viabilityMargin = std::numeric_limits< double >::max( );
+    Eigen::Vector3d positionOfOccultingBody;
+    Eigen::Vector3d occultingBodyRelativePosition;
+
+    // Iterate over all sets of entries of input vector for which occultation is to be checked.
+    for( unsigned int i = 0; i < linkEndIndices_.size( ); i++ )
+    {
+        positionOfOccultingBody = stateFunctionOfOccultingBody_(
+                    ( linkEndTimes.at( linkEndIndices_.at( i ).first ) +
+                      linkEndTimes.at( linkEndIndices_.at( i ).second ) ) / 2.0 ).segment( 0, 3 );
+
+        // Compute apparent separation of occulting body and line of sight, and apparent radius of occulting body (as
+        // in mission_geometry::computeShadowFunction, with an occulted body of zero radius).
+        occultingBodyRelativePosition =
+                positionOfOccultingBody - linkEndStates.at( linkEndIndices_.at( i ).second ).segment( 0, 3 );
+        double apparentSeparation = linear_algebra::computeAngleBetweenVectors(
+                    occultingBodyRelativePosition,
+                    linkEndStates.at( linkEndIndices_.at( i ).first ).segment( 0, 3 ) -
+                    linkEndStates.at( linkEndIndices_.at( i ).second ).segment( 0, 3 ) );
+        double occultingBodyApparentRadius = std::asin( radiusOfOccultingBody_ / occultingBodyRelativePosition.norm( ) );
+
+        viabilityMargin = std::min( viabilityMargin, apparentSeparation - occultingBodyApparentRadius );
+    }
+
+    return viabilityMargin;
+}
+
 
 
 }
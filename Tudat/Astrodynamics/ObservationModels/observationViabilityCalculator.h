@@ -60,6 +60,24 @@ public:
      */
     virtual bool isObservationViable( const std::vector< Eigen::Vector6d >& linkEndStates,
                                       const std::vector< double >& linkEndTimes ) = 0;
+
+    //! Function for computing the margin by which the viability condition is met.
+    /*!
+     *  Function for computing the margin by which the viability condition is met, used for finding the epochs at which
+     *  an observation becomes (non-)viable by root finding. A positive value denotes a viable observation, a non-positive value
+     *  a non-viable observation. Derived classes that check a continuous quantity redefine this function, so that the margin
+     *  is continuous in time. The default implementation returns 1.0 for a viable observation and -1.0 otherwise.
+     *  \param linkEndStates Vector of states of the link ends involved in the observation, in the order as provided by the
+     *  function computeObservationsAndLinkEndData of the associated ObservationModel.
+     *  \param linkEndTimes Vector of times of the link ends involved in the observation, in the order as provided by the
+     *  function computeObservationsAndLinkEndData of the associated ObservationModel.
+     *  \return Margin by which viability condition is met (positive if observation is viable).
+     */
+    virtual double getObservationViabilityMargin( const std::vector< Eigen::Vector6d >& linkEndStates,
+                                                  const std::vector< double >& linkEndTimes )
+    {
+        return isObservationViable( linkEndStates, linkEndTimes ) ? 1.0 : -1.0;
+    }
 };
 
 //! Function to check whether an observation is viable
@@ -94,6 +112,22 @@ bool isObservationViable(
         const std::vector< Eigen::Vector6d >& states, const std::vector< double >& times,
         const std::vector< std::shared_ptr< ObservationViabilityCalculator > >& viabilityCalculators );
 
+//! Function to compute the margin by which an observation is viable
+/*!
+ * Function to compute the margin by which an observation is viable, taken as the minimum margin over all viability
+ * calculators (see ObservationViabilityCalculator::getObservationViabilityMargin). Note that the margins of different types
+ * of checks have different units, so that only the sign of the output is generally meaningful.
+ * \param states Vector of states of the link ends involved in the observation, in the order as provided by the
+ * function computeObservationsAndLinkEndData of the associated ObservationModel.
+ * \param times Vector of times of the link ends involved in the observation, in the order as provided by the
+ * function computeObservationsAndLinkEndData of the associated ObservationModel.
+ * \param viabilityCalculators List of viability calculators
+ * \return Minimum viability margin (positive if observation is viable; 1.0 if no viability calculators are provided).
+ */
+double getObservationViabilityMargin(
+        const std::vector< Eigen::Vector6d >& states, const std::vector< double >& times,
+        const std::vector< std::shared_ptr< ObservationViabilityCalculator > >& viabilityCalculators );
+
 
 //! Function to check whether an observation is possible based on minimum elevation angle criterion at one link end.
 class MinimumElevationAngleCalculator: public ObservationViabilityCalculator
@@ -133,6 +167,17 @@ public:
      */
     bool isObservationViable( const std::vector< Eigen::Vector6d >& linkEndStates,
                               const std::vector< double >& linkEndTimes );
+    //! Function for computing the margin between the elevation angle at station and the minimum elevation angle.
+    /*!
+     *  Function for computing the margin between the elevation angle at station and the minimum elevation angle, taken as
+     *  the minimum over all link end combinations that are checked.
+     *  \param linkEndStates Vector of states of the link ends involved in the observation.
+     *  \param linkEndTimes Vector of times of the link ends involved in the observation.
+     *  \return Elevation angle margin (positive if observation is viable).
+     */
+    double getObservationViabilityMargin( const std::vector< Eigen::Vector6d >& linkEndStates,
+                                          const std::vector< double >& linkEndTimes );
+
 private:
 
     //! Vector of indices denoting which combinations of entries of vectors are to be used in isObservationViable  function
@@ -190,6 +235,17 @@ public:
      */
     bool isObservationViable( const std::vector< Eigen::Vector6d >& linkEndStates,
                               const std::vector< double >& linkEndTimes );
+    //! Function for computing the margin between the maximum elevation angle and the elevation angle at station.
+    /*!
+     *  Function for computing the margin between the maximum elevation angle and the elevation angle at station, taken as
+     *  the minimum over all link end combinations that are checked.
+     *  \param linkEndStates Vector of states of the link ends involved in the observation.
+     *  \param linkEndTimes Vector of times of the link ends involved in the observation.
+     *  \return Elevation angle margin (positive if observation is viable).
+     */
+    double getObservationViabilityMargin( const std::vector< Eigen::Vector6d >& linkEndStates,
+                                          const std::vector< double >& linkEndTimes );
+
 private:
 
     //! Vector of indices denoting which combinations of entries of vectors are to be used in isObservationViable  function
@@ -261,6 +317,17 @@ public:
     bool isObservationViable( const std::vector< Eigen::Vector6d >& linkEndStates,
                               const std::vector< double >& linkEndTimes );
 
+    //! Function for computing the margin between the angle to the avoided body and the minimum avoidance angle.
+    /*!
+     *  Function for computing the margin between the angle to the avoided body and the minimum avoidance angle, taken as
+     *  the minimum over all link end combinations that are checked.
+     *  \param linkEndStates Vector of states of the link ends involved in the observation.
+     *  \param linkEndTimes Vector of times of the link ends involved in the observation.
+     *  \return Avoidance angle margin (positive if observation is viable).
+     */
+    double getObservationViabilityMargin( const std::vector< Eigen::Vector6d >& linkEndStates,
+                                          const std::vector< double >& linkEndTimes );
+
 private:
 
     //! Vector of indices denoting which combinations of entries of vectors to isObservationViable are to be used.
@@ -315,6 +382,19 @@ public:
     bool isObservationViable( const std::vector< Eigen::Vector6d >& linkEndStates,
                               const std::vector< double >& linkEndTimes );
 
+    //! Function for computing the margin between the line of sight and the limb of the occulting body.
+    /*!
+     *  Function for computing the margin between the line of sight and the limb of the occulting body, as the angular
+     *  separation between the line of sight and the direction to the occulting body, minus the apparent radius of the
+     *  occulting body (both as seen from the second link end of each combination that is checked). The minimum over all link
+     *  end combinations is returned.
+     *  \param linkEndStates Vector of states of the link ends involved in the observation.
+     *  \param linkEndTimes Vector of times of the link ends involved in the observation.
+     *  \return Occultation margin (positive if link is not occulted).
+     */
+    double getObservationViabilityMargin( const std::vector< Eigen::Vector6d >& linkEndStates,
+                                          const std::vector< double >& linkEndTimes );
+
 private:
 
     //! Vector of indices denoting which combinations of entries of vectors to isObservationViable are to be used.
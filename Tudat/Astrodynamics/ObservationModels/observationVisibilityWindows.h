@@ -0,0 +1,206 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_OBSERVATIONVISIBILITYWINDOWS_H
+#define TUDAT_OBSERVATIONVISIBILITYWINDOWS_H
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "Tudat/Mathematics/BasicMathematics/functionProxy.h"
+#include "Tudat/Mathematics/RootFinders/bisection.h"
+#include "Tudat/Mathematics/RootFinders/terminationConditions.h"
+#include "Tudat/Astrodynamics/ObservationModels/observationModel.h"
+#include "Tudat/Astrodynamics/ObservationModels/observationViabilityCalculator.h"
+
+namespace tudat
+{
+
+namespace observation_models
+{
+
+//! Function to compute the margin by which an observation at a given time is viable
+/*!
+ *  Function to compute the margin by which an observation at a given time is viable, from the link end states and times that
+ *  are computed by the (ideal) observation model (see getObservationViabilityMargin).
+ *  \param observationTime Time at which observable is to be evaluated
+ *  \param observationModel Model used to compute observable (and associated link end states and times)
+ *  \param linkEndAssociatedWithTime Reference link end for observable
+ *  \param linkViabilityCalculators List of observation viability calculators to be evaluated
+ *  \return Minimum viability margin (positive if observation is viable).
+ */
+template< int ObservationSize = 1, typename ObservationScalarType = double, typename TimeType = double >
+double computeObservationViabilityMarginAtTime(
+        const TimeType& observationTime,
+        const std::shared_ptr< ObservationModel< ObservationSize, ObservationScalarType, TimeType > > observationModel,
+        const LinkEndType linkEndAssociatedWithTime,
+        const std::vector< std::shared_ptr< ObservationViabilityCalculator > >& linkViabilityCalculators )
+{
+    std::vector< Eigen::Vector6d > vectorOfStates;
+    std::vector< double > vectorOfTimes;
+
+    observationModel->computeIdealObservationsWithLinkEndData(
+                observationTime, linkEndAssociatedWithTime, vectorOfTimes, vectorOfStates );
+
+    return getObservationViabilityMargin( vectorOfStates, vectorOfTimes, linkViabilityCalculators );
+}
+
+//! Function to compute the time intervals in which observations of a single link are viable
+/*!
+ *  Function to compute the time intervals (visibility windows) in which observations of a single link are viable, according
+ *  to a list of viability calculators. The viability margin (see getObservationViabilityMargin) is sampled at a fixed (coarse)
+ *  step, and the rise/set times are refined by a bisection root finder on the margin function, wherever its sign changes
+ *  between two samples. Since the margin is computed from the full observation model, the link end states and times (including
+ *  light time) are identical to those used in the viability check during observation simulation.
+ *  NOTE: Windows (or gaps between windows) that are shorter than the sampling step may be missed.
+ *  \param observationModel Model used to compute observable (and associated link end states and times)
+ *  \param linkEndAssociatedWithTime Reference link end for observable
+ *  \param linkViabilityCalculators List of observation viability calculators that define the windows
+ *  \param startTime Start time of interval in which windows are to be found
+ *  \param endTime End time of interval in which windows are to be found
+ *  \param samplingStep Step size with which viability margin is sampled before refinement of rise/set times
+ *  \param rootFinderTolerance Absolute tolerance (in s) of rise/set times
+ *  \param maximumNumberOfIterations Maximum number of iterations of root finder for single rise/set time
+ *  \return List of visibility windows (start and end time of each window), in chronological order.
+ */
+template< int ObservationSize = 1, typename ObservationScalarType = double, typename TimeType = double >
+std::vector< std::pair< TimeType, TimeType > > computeObservationVisibilityWindows(
+        const std::shared_ptr< ObservationModel< ObservationSize, ObservationScalarType, TimeType > > observationModel,
+        const LinkEndType linkEndAssociatedWithTime,
+        const std::vector< std::shared_ptr< ObservationViabilityCalculator > >& linkViabilityCalculators,
+        const TimeType startTime,
+        const TimeType endTime,
+        const double samplingStep,
+        const double rootFinderTolerance = 1.0E-3,
+        const unsigned int maximumNumberOfIterations = 100 )
+{
+    if( !( samplingStep > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when computing observation visibility windows, sampling step must be positive" );
+    }
+
+    std::vector< std::pair< TimeType, TimeType > > visibilityWindows;
+    if( endTime < startTime )
+    {
+        return visibilityWindows;
+    }
+
+    // If no viability conditions are imposed, the full interval is viable.
+    if( linkViabilityCalculators.size( ) == 0 )
+    {
+        visibilityWindows.push_back( std::make_pair( startTime, endTime ) );
+        return visibilityWindows;
+    }
+
+    std::function< double( const TimeType& ) > viabilityMarginFunction =
+            std::bind( &computeObservationViabilityMarginAtTime< ObservationSize, ObservationScalarType, TimeType >,
+                       std::placeholders::_1, observationModel, linkEndAssociatedWithTime,
+                       linkViabilityCalculators );
+
+    // Sample viability margin, and refine times at which its sign changes.
+    TimeType previousTime = startTime;
+    bool isPreviousTimeViable = ( viabilityMarginFunction( previousTime ) > 0.0 );
+
+    TimeType windowStartTime = startTime;
+    while( previousTime < endTime )
+    {
+        double currentStep = std::min( samplingStep, static_cast< double >( endTime - previousTime ) );
+        TimeType currentTime = previousTime + currentStep;
+        bool isCurrentTimeViable = ( viabilityMarginFunction( currentTime ) > 0.0 );
+
+        if( isCurrentTimeViable != isPreviousTimeViable )
+        {
+            // Find time (as offset from previous sample) at which viability changes.
+            root_finders::BisectionCore< double > rootFinder(
+                        std::bind( &root_finders::termination_conditions::RootAbsoluteToleranceTerminationCondition< double >::
+                                   checkTerminationCondition,
+                                   std::make_shared< root_finders::termination_conditions::
+                                   RootAbsoluteToleranceTerminationCondition< double > >(
+                                       rootFinderTolerance, maximumNumberOfIterations ),
+                                   std::placeholders::_1, std::placeholders::_2, std::placeholders::_3,
+                                   std::placeholders::_4, std::placeholders::_5 ), 0.0, currentStep );
+            double crossingOffset = rootFinder.execute(
+                        std::make_shared< basic_mathematics::FunctionProxy< double, double > >(
+                            [ & ]( const double timeOffset ){ return viabilityMarginFunction( previousTime + timeOffset ); } ) );
+
+            if( isCurrentTimeViable )
+            {
+                // Pad window by root finder tolerance, so that no viable observation is discarded.
+                windowStartTime = previousTime + std::max( crossingOffset - rootFinderTolerance, 0.0 );
+            }
+            else
+            {
+                visibilityWindows.push_back(
+                            std::make_pair( windowStartTime,
+                                            previousTime + std::min( crossingOffset + rootFinderTolerance, currentStep ) ) );
+            }
+        }
+
+        previousTime = currentTime;
+        isPreviousTimeViable = isCurrentTimeViable;
+    }
+
+    // Close window that is open at end of interval.
+    if( isPreviousTimeViable )
+    {
+        visibilityWindows.push_back( std::make_pair( windowStartTime, endTime ) );
+    }
+
+    return visibilityWindows;
+}
+
+//! Function to create a list of equispaced observation times that lie inside a set of visibility windows
+/*!
+ *  Function to create a list of observation times, with a fixed interval starting from a given reference time, retaining only
+ *  those times that lie inside one of a set of visibility windows.
+ *  \param visibilityWindows List of visibility windows (start and end time of each window), in chronological order.
+ *  \param referenceTime Reference time of the grid of observation times.
+ *  \param observationInterval Interval between two subsequent observation times.
+ *  \return Observation times inside the visibility windows.
+ */
+template< typename TimeType = double >
+std::vector< TimeType > createObservationTimesInVisibilityWindows(
+        const std::vector< std::pair< TimeType, TimeType > >& visibilityWindows,
+        const TimeType referenceTime,
+        const double observationInterval )
+{
+    if( !( observationInterval > 0.0 ) )
+    {
+        throw std::runtime_error( "Error when creating observation times in visibility windows, interval must be positive" );
+    }
+
+    std::vector< TimeType > observationTimes;
+    for( unsigned int i = 0; i < visibilityWindows.size( ); i++ )
+    {
+        // Find first grid point in current window.
+        int currentTimeIndex = static_cast< int >(
+                    std::ceil( static_cast< double >( visibilityWindows.at( i ).first - referenceTime ) /
+                               observationInterval ) );
+        TimeType currentTime = referenceTime + static_cast< double >( currentTimeIndex ) * observationInterval;
+        while( currentTime <= visibilityWindows.at( i ).second )
+        {
+            if( observationTimes.size( ) == 0 || observationTimes.back( ) < currentTime )
+            {
+                observationTimes.push_back( currentTime );
+            }
+            currentTimeIndex++;
+            currentTime = referenceTime + static_cast< double >( currentTimeIndex ) * observationInterval;
+        }
+    }
+
+    return observationTimes;
+}
+
+} // namespace observation_models
+
+} // namespace tudat
+
+#endif // TUDAT_OBSERVATIONVISIBILITYWINDOWS_H
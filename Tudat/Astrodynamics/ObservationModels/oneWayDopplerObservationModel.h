@@ -575,6 +575,118 @@ public:
                         "Error when calculating one way Doppler observation, link end is not transmitter or receiver" );
         }
 
+        return computeDopplerFromLinkEndStates( transmissionTime, receptionTime, linkEndTimes, linkEndStates );
+    }
+
+    //! Function to compute one-way Doppler observables without any corrections at a list of times.
+    /*!
+     *  Function to compute one-way Doppler observables without any corrections at a list of times, using a batch solution of
+     *  the light times (see LightTimeCalculator::calculateLightTimesWithLinkEndsStates), in which each light time is
+     *  iterated from the solution of the preceding observation. Times should therefore be provided in chronological order.
+     *  \param times Times at which observable is to be evaluated.
+     *  \param linkEndAssociatedWithTime Link end at which given times are valid, i.e. link end for which associated time
+     *  is kept constant (to input value)
+     *  \param linkEndTimes List of times at each link end during each observation.
+     *  \param linkEndStates List of states at each link end during each observation.
+     *  \return Ideal one-way Doppler observables.
+     */
+    std::vector< Eigen::Matrix< ObservationScalarType, 1, 1 > > computeIdealObservationsWithLinkEndDataAtTimes(
+            const std::vector< TimeType >& times,
+            const LinkEndType linkEndAssociatedWithTime,
+            std::vector< std::vector< double > >& linkEndTimes,
+            std::vector< std::vector< Eigen::Matrix< double, 6, 1 > > >& linkEndStates )
+    {
+        bool isTimeAtReception;
+        switch( linkEndAssociatedWithTime )
+        {
+        case receiver:
+            isTimeAtReception = true;
+            break;
+        case transmitter:
+            isTimeAtReception = false;
+            break;
+        default:
+            throw std::runtime_error(
+                        "Error when calculating one way Doppler observation, link end is not transmitter or receiver" );
+        }
+
+        // Compute light times of all observations.
+        std::vector< StateType > receiverStates, transmitterStates;
+        std::vector< ObservationScalarType > lightTimes = lightTimeCalculator_->calculateLightTimesWithLinkEndsStates(
+                    receiverStates, transmitterStates, times, isTimeAtReception );
+
+        std::vector< Eigen::Matrix< ObservationScalarType, 1, 1 > > observations( times.size( ) );
+        linkEndTimes.resize( times.size( ) );
+        linkEndStates.resize( times.size( ) );
+        for( unsigned int i = 0; i < times.size( ); i++ )
+        {
+            receiverState_ = receiverStates[ i ];
+            transmitterState_ = transmitterStates[ i ];
+            if( isTimeAtReception )
+            {
+                observations[ i ] = computeDopplerFromLinkEndStates(
+                            times[ i ] - lightTimes[ i ], times[ i ], linkEndTimes[ i ], linkEndStates[ i ] );
+            }
+            else
+            {
+                observations[ i ] = computeDopplerFromLinkEndStates(
+                            times[ i ], times[ i ] + lightTimes[ i ], linkEndTimes[ i ], linkEndStates[ i ] );
+            }
+        }
+
+        return observations;
+    }
+
+    //! Function to return the object to calculate light time.
+    /*!
+     * Function to return the object to calculate light time.
+     * \return Object to calculate light time.
+     */
+    std::shared_ptr< observation_models::LightTimeCalculator< ObservationScalarType, TimeType > > getLightTimeCalculator( )
+    {
+        return lightTimeCalculator_;
+    }
+
+    //! Function to retrieve object to compute derivative of deviation between proper and coordinate time at transmitter
+    /*!
+     *  Function to retrieve object to compute derivative of deviation between proper and coordinate time at transmitter
+     * \return Object to compute derivative of deviation between proper and coordinate time at transmitter
+     */
+    std::shared_ptr< DopplerProperTimeRateInterface > getTransmitterProperTimeRateCalculator( )
+    {
+        return transmitterProperTimeRateCalculator_;
+    }
+
+    //! Function to retrieve object to compute derivative of deviation between proper and coordinate time at receiver
+    /*!
+     *  Function to retrieve object to compute derivative of deviation between proper and coordinate time at receiver
+     * \return Object to compute derivative of deviation between proper and coordinate time at receiver
+     */
+    std::shared_ptr< DopplerProperTimeRateInterface > getReceiverProperTimeRateCalculator( )
+    {
+        return receiverProperTimeRateCalculator_;
+    }
+
+
+
+private:
+
+    //! Function to compute one-way Doppler observable from converged light-time solution.
+    /*!
+     *  Function to compute one-way Doppler observable from converged light-time solution, with the link end states set in
+     *  the transmitterState_ and receiverState_ member variables.
+     *  \param transmissionTime Time of signal transmission
+     *  \param receptionTime Time of signal reception
+     *  \param linkEndTimes List of times at each link end during observation (returned by reference).
+     *  \param linkEndStates List of states at each link end during observation (returned by reference).
+     *  \return Ideal one-way Doppler observable.
+     */
+    Eigen::Matrix< ObservationScalarType, 1, 1 > computeDopplerFromLinkEndStates(
+            const TimeType transmissionTime,
+            const TimeType receptionTime,
+            std::vector< double >& linkEndTimes,
+            std::vector< Eigen::Matrix< double, 6, 1 > >& linkEndStates )
+    {
         linkEndTimes.clear( );
         linkEndStates.clear( );
 
@@ -629,39 +741,6 @@ public:
         return ( Eigen::Matrix<  ObservationScalarType, 1, 1  >( ) << totalDopplerObservable ).finished( );
     }
 
-    //! Function to return the object to calculate light time.
-    /*!
-     * Function to return the object to calculate light time.
-     * \return Object to calculate light time.
-     */
-    std::shared_ptr< observation_models::LightTimeCalculator< ObservationScalarType, TimeType > > getLightTimeCalculator( )
-    {
-        return lightTimeCalculator_;
-    }
-
-    //! Function to retrieve object to compute derivative of deviation between proper and coordinate time at transmitter
-    /*!
-     *  Function to retrieve object to compute derivative of deviation between proper and coordinate time at transmitter
-     * \return Object to compute derivative of deviation between proper and coordinate time at transmitter
-     */
-    std::shared_ptr< DopplerProperTimeRateInterface > getTransmitterProperTimeRateCalculator( )
-    {
-        return transmitterProperTimeRateCalculator_;
-    }
-
-    //! Function to retrieve object to compute derivative of deviation between proper and coordinate time at receiver
-    /*!
-     *  Function to retrieve object to compute derivative of deviation between proper and coordinate time at receiver
-     * \return Object to compute derivative of deviation between proper and coordinate time at receiver
-     */
-    std::shared_ptr< DopplerProperTimeRateInterface > getReceiverProperTimeRateCalculator( )
-    {
-        return receiverProperTimeRateCalculator_;
-    }
-
-
-
-private:
 
     //! Object to calculate light time, including possible corrections from troposphere, relativistic corrections, etc.
     std::shared_ptr< observation_models::LightTimeCalculator< ObservationScalarType, TimeType > > lightTimeCalculator_;
@@ -161,6 +161,73 @@ public:
         return ( Eigen::Matrix< ObservationScalarType, 1, 1 >( ) << observation ).finished( );
     }
 
+    //! Function to compute one-way range observables without any corrections at a list of times.
+    /*!
+     *  Function to compute one-way range observables without any corrections at a list of times, using a batch solution of
+     *  the light times (see LightTimeCalculator::calculateLightTimesWithLinkEndsStates), in which each light time is
+     *  iterated from the solution of the preceding observation. Times should therefore be provided in chronological order.
+     *  \param times Times at which observable is to be evaluated.
+     *  \param linkEndAssociatedWithTime Link end at which given times are valid, i.e. link end for which associated time
+     *  is kept constant (to input value)
+     *  \param linkEndTimes List of times at each link end during each observation.
+     *  \param linkEndStates List of states at each link end during each observation.
+     *  \return Ideal one-way range observables.
+     */
+    std::vector< Eigen::Matrix< ObservationScalarType, 1, 1 > > computeIdealObservationsWithLinkEndDataAtTimes(
+            const std::vector< TimeType >& times,
+            const LinkEndType linkEndAssociatedWithTime,
+            std::vector< std::vector< double > >& linkEndTimes,
+            std::vector< std::vector< Eigen::Matrix< double, 6, 1 > > >& linkEndStates )
+    {
+        bool isTimeAtReception;
+        switch( linkEndAssociatedWithTime )
+        {
+        case receiver:
+            isTimeAtReception = true;
+            break;
+        case transmitter:
+            isTimeAtReception = false;
+            break;
+        default:
+            std::string errorMessage = "Error, cannot have link end type: " +
+                    std::to_string( linkEndAssociatedWithTime ) + "for one-way range";
+            throw std::runtime_error( errorMessage );
+        }
+
+        // Compute light times of all observations.
+        std::vector< StateType > receiverStates, transmitterStates;
+        std::vector< ObservationScalarType > lightTimes = lightTimeCalculator_->calculateLightTimesWithLinkEndsStates(
+                    receiverStates, transmitterStates, times, isTimeAtReception );
+
+        std::vector< Eigen::Matrix< ObservationScalarType, 1, 1 > > observations( times.size( ) );
+        linkEndTimes.resize( times.size( ) );
+        linkEndStates.resize( times.size( ) );
+        for( unsigned int i = 0; i < times.size( ); i++ )
+        {
+            // Set link end states and times.
+            linkEndTimes[ i ].clear( );
+            linkEndStates[ i ].clear( );
+            if( isTimeAtReception )
+            {
+                linkEndTimes[ i ].push_back( static_cast< double >( times[ i ] - lightTimes[ i ] ) );
+                linkEndTimes[ i ].push_back( static_cast< double >( times[ i ] ) );
+            }
+            else
+            {
+                linkEndTimes[ i ].push_back( static_cast< double >( times[ i ] ) );
+                linkEndTimes[ i ].push_back( static_cast< double >( times[ i ] + lightTimes[ i ] ) );
+            }
+            linkEndStates[ i ].push_back( transmitterStates[ i ].template cast< double >( ) );
+            linkEndStates[ i ].push_back( receiverStates[ i ].template cast< double >( ) );
+
+            // Convert light time to range.
+            observations[ i ] = ( Eigen::Matrix< ObservationScalarType, 1, 1 >( ) <<
+                                  lightTimes[ i ] * physical_constants::getSpeedOfLight< ObservationScalarType >( ) ).finished( );
+        }
+
+        return observations;
+    }
+
     //! Function to get the object to calculate light time.
     /*!
      * Function to get the object to calculate light time.
@@ -15,6 +15,7 @@
 #include <boost/bind.hpp>
 
 #include "Tudat/Astrodynamics/ObservationModels/observationSimulator.h"
+#include "Tudat/Astrodynamics/ObservationModels/observationVisibilityWindows.h"
 
 namespace tudat
 {
@@ -24,7 +25,8 @@ namespace observation_models
 
 enum ObservationSimulationTimesTypes
 {
-    tabulated_observation_simulation_times
+    tabulated_observation_simulation_times,
+    visibility_window_observation_simulation_times
 };
 
 //! Base struct for defining times at which observations are to be simulated.
@@ -62,6 +64,52 @@ struct TabulatedObservationSimulationTimeSettings: public ObservationSimulationT
     std::vector< TimeType > simulationTimes_;
 };
 
+//! Struct for defining equispaced observation times, restricted to the windows in which observations are viable.
+/*!
+ *  Struct for defining equispaced observation times, restricted to the windows in which observations are viable. Prior to
+ *  simulating the observations, the visibility windows of the link are computed from the observation viability calculators
+ *  (see computeObservationVisibilityWindows), so that observations are only computed inside these windows, instead of being
+ *  computed at all times and subsequently rejected. The full viability check is still performed for each observation.
+ */
+template< typename TimeType >
+struct VisibilityWindowObservationSimulationTimeSettings: public ObservationSimulationTimeSettings< TimeType >
+{
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param linkEndType Link end type from which observations are to be simulated.
+     *  \param startTime Start time of observations (and reference time of the grid of observation times).
+     *  \param endTime End time of observations.
+     *  \param observationInterval Interval between two subsequent observation times.
+     *  \param windowSamplingStep Step size with which viability is sampled when computing the visibility windows.
+     *  \param windowRootFinderTolerance Absolute tolerance (in s) of the window rise/set times.
+     */
+    VisibilityWindowObservationSimulationTimeSettings(
+            const LinkEndType linkEndType, const TimeType startTime, const TimeType endTime,
+            const double observationInterval, const double windowSamplingStep,
+            const double windowRootFinderTolerance = 1.0E-3 ):
+        ObservationSimulationTimeSettings< TimeType >( linkEndType ),
+        startTime_( startTime ), endTime_( endTime ), observationInterval_( observationInterval ),
+        windowSamplingStep_( windowSamplingStep ), windowRootFinderTolerance_( windowRootFinderTolerance ){ }
+
+    ~VisibilityWindowObservationSimulationTimeSettings( ){ }
+
+    //! Start time of observations (and reference time of the grid of observation times).
+    TimeType startTime_;
+
+    //! End time of observations.
+    TimeType endTime_;
+
+    //! Interval between two subsequent observation times.
+    double observationInterval_;
+
+    //! Step size with which viability is sampled when computing the visibility windows.
+    double windowSamplingStep_;
+
+    //! Absolute tolerance (in s) of the window rise/set times.
+    double windowRootFinderTolerance_;
+};
+
 //! Function to compute observations at times defined by settings object using a given observation model
 /*!
  *  Function to compute observations at times defined by settings object using a given observation model
@@ -97,6 +145,27 @@ simulateSingleObservationSet(
                     currentObservationViabilityCalculators );
 
     }
+    // Simulate observations at equispaced times inside visibility windows.
+    else if( std::dynamic_pointer_cast< VisibilityWindowObservationSimulationTimeSettings< TimeType > >(
+                 observationsToSimulate ) != nullptr )
+    {
+        std::shared_ptr< VisibilityWindowObservationSimulationTimeSettings< TimeType > > windowObservationSettings =
+                std::dynamic_pointer_cast< VisibilityWindowObservationSimulationTimeSettings< TimeType > >(
+                    observationsToSimulate );
+
+        std::vector< std::pair< TimeType, TimeType > > visibilityWindows =
+                computeObservationVisibilityWindows< ObservationSize, ObservationScalarType, TimeType >(
+                    observationModel, observationsToSimulate->linkEndType_, currentObservationViabilityCalculators,
+                    windowObservationSettings->startTime_, windowObservationSettings->endTime_,
+                    windowObservationSettings->windowSamplingStep_, windowObservationSettings->windowRootFinderTolerance_ );
+
+        simulatedObservations = simulateObservationsWithCheckAndLinkEndIdOutput<
+                ObservationSize, ObservationScalarType, TimeType >(
+                    createObservationTimesInVisibilityWindows(
+                        visibilityWindows, windowObservationSettings->startTime_,
+                        windowObservationSettings->observationInterval_ ),
+                    observationModel, observationsToSimulate->linkEndType_, currentObservationViabilityCalculators );
+    }
 
     return simulatedObservations;
 }
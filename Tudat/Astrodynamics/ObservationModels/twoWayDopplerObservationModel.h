@@ -156,6 +156,101 @@ public:
                  downlinkDoppler( 0 ) + uplinkDoppler( 0 ) ).finished( );
     }
 
+    //! Function to compute two-way Doppler observables without any corrections at a list of times.
+    /*!
+     *  Function to compute two-way Doppler observables without any corrections at a list of times. The uplink and downlink
+     *  are each solved for all observations together (see OneWayDopplerObservationModel::
+     *  computeIdealObservationsWithLinkEndDataAtTimes). Times should be provided in chronological order.
+     *  \param times Times at which observable is to be evaluated.
+     *  \param linkEndAssociatedWithTime Link end at which given times are valid, i.e. link end for which associated time
+     *  is kept constant (to input value)
+     *  \param linkEndTimes List of times at each link end during each observation.
+     *  \param linkEndStates List of states at each link end during each observation.
+     *  \return Ideal two-way Doppler observables.
+     */
+    std::vector< Eigen::Matrix< ObservationScalarType, 1, 1 > > computeIdealObservationsWithLinkEndDataAtTimes(
+            const std::vector< TimeType >& times,
+            const LinkEndType linkEndAssociatedWithTime,
+            std::vector< std::vector< double > >& linkEndTimes,
+            std::vector< std::vector< Eigen::Matrix< double, 6, 1 > > >& linkEndStates )
+    {
+        const unsigned int numberOfTimes = times.size( );
+
+        std::vector< std::vector< double > > uplinkLinkEndTimes;
+        std::vector< std::vector< Eigen::Matrix< double, 6, 1 > > > uplinkLinkEndStates;
+
+        std::vector< std::vector< double > > downlinkLinkEndTimes;
+        std::vector< std::vector< Eigen::Matrix< double, 6, 1 > > > downlinkLinkEndStates;
+
+        std::vector< Eigen::Matrix< ObservationScalarType, 1, 1 > > uplinkDopplers, downlinkDopplers;
+        std::vector< TimeType > intermediateTimes( numberOfTimes );
+
+        switch( linkEndAssociatedWithTime )
+        {
+        case receiver:
+
+            downlinkDopplers = downlinkDopplerCalculator_->computeIdealObservationsWithLinkEndDataAtTimes(
+                        times, receiver, downlinkLinkEndTimes, downlinkLinkEndStates );
+            for( unsigned int i = 0; i < numberOfTimes; i++ )
+            {
+                intermediateTimes[ i ] = downlinkLinkEndTimes[ i ].at( 0 );
+            }
+            uplinkDopplers = uplinkDopplerCalculator_->computeIdealObservationsWithLinkEndDataAtTimes(
+                        intermediateTimes, receiver, uplinkLinkEndTimes, uplinkLinkEndStates );
+
+            break;
+        case reflector1:
+
+            uplinkDopplers = uplinkDopplerCalculator_->computeIdealObservationsWithLinkEndDataAtTimes(
+                        times, receiver, uplinkLinkEndTimes, uplinkLinkEndStates );
+            downlinkDopplers = downlinkDopplerCalculator_->computeIdealObservationsWithLinkEndDataAtTimes(
+                        times, transmitter, downlinkLinkEndTimes, downlinkLinkEndStates );
+
+            break;
+        case transmitter:
+            uplinkDopplers = uplinkDopplerCalculator_->computeIdealObservationsWithLinkEndDataAtTimes(
+                        times, transmitter, uplinkLinkEndTimes, uplinkLinkEndStates );
+            for( unsigned int i = 0; i < numberOfTimes; i++ )
+            {
+                intermediateTimes[ i ] = uplinkLinkEndTimes[ i ].at( 1 );
+            }
+            downlinkDopplers = downlinkDopplerCalculator_->computeIdealObservationsWithLinkEndDataAtTimes(
+                        intermediateTimes, transmitter, downlinkLinkEndTimes, downlinkLinkEndStates );
+            break;
+        default:
+            throw std::runtime_error(
+                        "Error when calculating two way Doppler observation, link end is not transmitter or receiver" );
+        }
+
+        std::vector< Eigen::Matrix< ObservationScalarType, 1, 1 > > observations( numberOfTimes );
+        linkEndTimes.resize( numberOfTimes );
+        linkEndStates.resize( numberOfTimes );
+        for( unsigned int i = 0; i < numberOfTimes; i++ )
+        {
+            linkEndTimes[ i ].clear( );
+            linkEndStates[ i ].clear( );
+
+            linkEndTimes[ i ].resize( 4 );
+            linkEndStates[ i ].resize( 4 );
+
+            linkEndTimes[ i ][ 0 ] = uplinkLinkEndTimes[ i ].at( 0 );
+            linkEndTimes[ i ][ 1 ] = uplinkLinkEndTimes[ i ].at( 1 );
+            linkEndTimes[ i ][ 2 ] = downlinkLinkEndTimes[ i ].at( 0 );
+            linkEndTimes[ i ][ 3 ] = downlinkLinkEndTimes[ i ].at( 1 );
+
+            linkEndStates[ i ][ 0 ] = uplinkLinkEndStates[ i ].at( 0 );
+            linkEndStates[ i ][ 1 ] = uplinkLinkEndStates[ i ].at( 1 );
+            linkEndStates[ i ][ 2 ] = downlinkLinkEndStates[ i ].at( 0 );
+            linkEndStates[ i ][ 3 ] = downlinkLinkEndStates[ i ].at( 1 );
+
+            observations[ i ] = ( Eigen::Matrix< ObservationScalarType, 1, 1 >( ) <<
+                                  downlinkDopplers[ i ]( 0 ) * uplinkDopplers[ i ]( 0 ) +
+                                  downlinkDopplers[ i ]( 0 ) + uplinkDopplers[ i ]( 0 ) ).finished( );
+        }
+
+        return observations;
+    }
+
     //! Function to retrieve the object that computes the one-way Doppler observable for the uplink
     /*!
      * Function to retrieve the object that computes the one-way Doppler observable for the uplink
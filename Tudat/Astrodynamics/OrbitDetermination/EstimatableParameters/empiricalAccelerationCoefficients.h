@@ -393,6 +393,16 @@ public:
         return singleArcParameterSize_;
     }
 
+    //! Function to retrieve start times for arcs in which empirical accelerations are defined
+    /*!
+     *  Function to retrieve start times for arcs in which empirical accelerations are defined
+     *  \return Start times for arcs in which empirical accelerations are defined
+     */
+    std::vector< double > getArcStartTimes( )
+    {
+        return std::vector< double >( arcStartTimeList_.begin( ), arcStartTimeList_.end( ) - 1 );
+    }
+
     std::map< basic_astrodynamics::EmpiricalAccelerationFunctionalShapes, std::vector< int > > getIndices( )
     {
         return accelerationIndices_;
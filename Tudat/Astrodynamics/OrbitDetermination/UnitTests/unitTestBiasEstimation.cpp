@@ -11,6 +11,8 @@
 #define BOOST_TEST_MAIN
 
 
+#include <algorithm>
+#include <functional>
 #include <limits>
 
 #include <boost/test/unit_test.hpp>
@@ -85,6 +87,184 @@ BOOST_AUTO_TEST_CASE( test_EstimationFromPosition )
     BOOST_CHECK_EQUAL( executeEarthOrbiterBiasEstimation( true, false, true, true, true ).second, true );
 }
 
+//! Test whether the least squares solution by Householder transformations is consistent with the solution of the normal
+//! equations, and whether process noise on arc-wise biases is correctly added to the estimation
+BOOST_AUTO_TEST_CASE( test_HouseholderLeastSquaresEstimation )
+{
+    typedef std::map< EstimatebleParametersEnum, std::shared_ptr< ArcWiseProcessNoiseSettings > > ProcessNoiseSettingsMap;
+
+    // Estimate state and arc-wise range biases from normal equations, and with Householder transformations
+    std::shared_ptr< PodOutput< double > > podOutputFromNormalEquations;
+    Eigen::VectorXd errorFromNormalEquations = executeEarthOrbiterBiasEstimation< double, double >(
+                true, false, true, true, false, true, false, ProcessNoiseSettingsMap( ),
+                &podOutputFromNormalEquations ).first;
+
+    std::shared_ptr< PodOutput< double > > podOutputFromHouseholder;
+    Eigen::VectorXd errorFromHouseholder = executeEarthOrbiterBiasEstimation< double, double >(
+                true, false, true, true, false, true, true, ProcessNoiseSettingsMap( ),
+                &podOutputFromHouseholder ).first;
+
+    // Check consistency of estimated parameters
+    for( unsigned int j = 0; j < 3; j++ )
+    {
+        BOOST_CHECK_SMALL( std::fabs( errorFromNormalEquations( j ) - errorFromHouseholder( j ) ), 1.0E-6 );
+        BOOST_CHECK_SMALL( std::fabs( errorFromNormalEquations( j + 3 ) - errorFromHouseholder( j + 3 ) ), 1.0E-9 );
+    }
+    for( unsigned int j = 6; j < errorFromNormalEquations.rows( ); j++ )
+    {
+        BOOST_CHECK_SMALL( std::fabs( errorFromNormalEquations( j ) - errorFromHouseholder( j ) ), 1.0E-8 );
+    }
+
+    // Check consistency of inverse covariance, scaled by its diagonal
+    Eigen::MatrixXd inverseCovarianceFromNormalEquations =
+            podOutputFromNormalEquations->getUnnormalizedInverseCovarianceMatrix( );
+    Eigen::MatrixXd inverseCovarianceFromHouseholder = podOutputFromHouseholder->getUnnormalizedInverseCovarianceMatrix( );
+    for( int i = 0; i < inverseCovarianceFromNormalEquations.rows( ); i++ )
+    {
+        for( int j = 0; j < inverseCovarianceFromNormalEquations.cols( ); j++ )
+        {
+            BOOST_CHECK_SMALL( std::fabs( inverseCovarianceFromNormalEquations( i, j ) - inverseCovarianceFromHouseholder( i, j ) ),
+                               1.0E-10 * std::sqrt( inverseCovarianceFromNormalEquations( i, i ) *
+                                                    inverseCovarianceFromNormalEquations( j, j ) ) );
+        }
+    }
+
+    // Estimate with process noise on arc-wise range biases
+    double processNoiseStandardDeviation = 1.0;
+    double processNoiseCorrelationTime = 86400.0;
+    ProcessNoiseSettingsMap processNoiseSettings;
+    processNoiseSettings[ arcwise_constant_additive_observation_bias ] = std::make_shared< ArcWiseProcessNoiseSettings >(
+                processNoiseStandardDeviation, processNoiseCorrelationTime );
+
+    std::shared_ptr< PodOutput< double > > podOutputWithProcessNoise;
+    Eigen::VectorXd errorWithProcessNoise = executeEarthOrbiterBiasEstimation< double, double >(
+                true, false, true, true, false, true, true, processNoiseSettings, &podOutputWithProcessNoise ).first;
+
+    // Check that biases (equal in all arcs) are still correctly estimated
+    for( unsigned int j = 0; j < 3; j++ )
+    {
+        BOOST_CHECK_SMALL( std::fabs( errorWithProcessNoise( j ) ), 1.0E-5 );
+        BOOST_CHECK_SMALL( std::fabs( errorWithProcessNoise( j + 3 ) ), 1.0E-8 );
+    }
+    for( unsigned int j = 6; j < errorWithProcessNoise.rows( ); j++ )
+    {
+        BOOST_CHECK_SMALL( std::fabs( errorWithProcessNoise( j ) ), 1.0E-7 );
+    }
+
+    // Compute expected contribution of process noise to inverse covariance: four arc-wise biases, each with three arcs
+    std::vector< double > biasArcStartTimes = { 1.0E7, 1.0E7 + 4.0 * 3600.0, 1.0E7 + 12.0 * 3600.0 };
+    int numberOfBiasArcs = biasArcStartTimes.size( );
+    int numberOfParameters = errorWithProcessNoise.rows( );
+    BOOST_CHECK_EQUAL( numberOfParameters, 6 + 4 * numberOfBiasArcs );
+
+    Eigen::MatrixXd expectedProcessNoiseInformation = Eigen::MatrixXd::Zero( numberOfParameters, numberOfParameters );
+    for( int i = 0; i < 4; i++ )
+    {
+        for( int k = 0; k < numberOfBiasArcs - 1; k++ )
+        {
+            double correlation = std::exp( -( biasArcStartTimes.at( k + 1 ) - biasArcStartTimes.at( k ) ) /
+                                           processNoiseCorrelationTime );
+            double noiseVariance = processNoiseStandardDeviation * processNoiseStandardDeviation *
+                    ( 1.0 - correlation * correlation );
+
+            int currentIndex = 6 + i * numberOfBiasArcs + k;
+            expectedProcessNoiseInformation( currentIndex, currentIndex ) += correlation * correlation / noiseVariance;
+            expectedProcessNoiseInformation( currentIndex, currentIndex + 1 ) -= correlation / noiseVariance;
+            expectedProcessNoiseInformation( currentIndex + 1, currentIndex ) -= correlation / noiseVariance;
+            expectedProcessNoiseInformation( currentIndex + 1, currentIndex + 1 ) += 1.0 / noiseVariance;
+        }
+    }
+
+    // Check that process noise is added to bias block of inverse covariance (which does not depend on the state estimate)
+    Eigen::MatrixXd processNoiseInformation =
+            podOutputWithProcessNoise->getUnnormalizedInverseCovarianceMatrix( ) - inverseCovarianceFromHouseholder;
+    for( int i = 6; i < numberOfParameters; i++ )
+    {
+        for( int j = 6; j < numberOfParameters; j++ )
+        {
+            BOOST_CHECK_SMALL( std::fabs( processNoiseInformation( i, j ) - expectedProcessNoiseInformation( i, j ) ),
+                               1.0E-8 * expectedProcessNoiseInformation.cwiseAbs( ).maxCoeff( ) );
+        }
+    }
+
+    // Check that process noise reduces the formal errors of the biases
+    Eigen::VectorXd formalErrorWithoutProcessNoise = podOutputFromHouseholder->getFormalErrorVector( );
+    Eigen::VectorXd formalErrorWithProcessNoise = podOutputWithProcessNoise->getFormalErrorVector( );
+    for( int i = 6; i < numberOfParameters; i++ )
+    {
+        BOOST_CHECK_EQUAL( formalErrorWithProcessNoise( i ) < formalErrorWithoutProcessNoise( i ), true );
+    }
+
+    // Add the same process noise (with zero residuals) by a user-defined time update at the bias arc start times, and store
+    // the epochs and inverse covariance of the solver when it is called
+    std::vector< double > timeUpdateEpochs;
+    std::vector< Eigen::MatrixXd > inverseCovariancesAtTimeUpdate;
+    std::function< void( const double, linear_algebra::HouseholderLeastSquaresSolver& ) > timeUpdateFunction =
+            [ & ]( const double currentEpoch, linear_algebra::HouseholderLeastSquaresSolver& householderLeastSquaresSolver )
+    {
+        timeUpdateEpochs.push_back( currentEpoch );
+        inverseCovariancesAtTimeUpdate.push_back( householderLeastSquaresSolver.getInverseCovarianceMatrix( ) );
+
+        int k = std::distance( biasArcStartTimes.begin( ), std::find(
+                                   biasArcStartTimes.begin( ), biasArcStartTimes.end( ), currentEpoch ) ) - 1;
+        double correlation = std::exp( -( biasArcStartTimes.at( k + 1 ) - biasArcStartTimes.at( k ) ) /
+                                       processNoiseCorrelationTime );
+        double noiseVariance = processNoiseStandardDeviation * processNoiseStandardDeviation *
+                ( 1.0 - correlation * correlation );
+        Eigen::MatrixXd pseudoObservationPartials = Eigen::MatrixXd::Zero( 4, numberOfParameters );
+        for( int i = 0; i < 4; i++ )
+        {
+            pseudoObservationPartials( i, 6 + i * numberOfBiasArcs + k ) = -correlation;
+            pseudoObservationPartials( i, 6 + i * numberOfBiasArcs + k + 1 ) = 1.0;
+        }
+        householderLeastSquaresSolver.addObservationBlock(
+                    pseudoObservationPartials, Eigen::VectorXd::Zero( 4 ), Eigen::VectorXd::Constant( 4, 1.0 / noiseVariance ) );
+    };
+
+    std::shared_ptr< PodOutput< double > > podOutputWithTimeUpdate;
+    executeEarthOrbiterBiasEstimation< double, double >(
+                true, false, true, true, false, true, true, ProcessNoiseSettingsMap( ), &podOutputWithTimeUpdate,
+                std::vector< double >( biasArcStartTimes.begin( ) + 1, biasArcStartTimes.end( ) ), timeUpdateFunction );
+
+    // Check that the time update is called at the second and third arc start times, in that order, in each iteration
+    BOOST_CHECK_EQUAL( timeUpdateEpochs.size( ) > 0, true );
+    BOOST_CHECK_EQUAL( timeUpdateEpochs.size( ) % 2, 0 );
+    for( unsigned int i = 0; i < timeUpdateEpochs.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( timeUpdateEpochs.at( i ), biasArcStartTimes.at( 1 + i % 2 ) );
+    }
+
+    // Check that, at each time update, only the observations before the time update epoch have been processed: the
+    // information on the biases of the arcs after the epoch is zero, while that on the preceding arc is not
+    for( unsigned int i = 0; i < timeUpdateEpochs.size( ); i++ )
+    {
+        int currentArcIndex = 1 + i % 2;
+        for( int j = 0; j < 4; j++ )
+        {
+            BOOST_CHECK_EQUAL( inverseCovariancesAtTimeUpdate.at( i ).col(
+                                   6 + j * numberOfBiasArcs + currentArcIndex - 1 ).cwiseAbs( ).maxCoeff( ) > 0.0, true );
+            for( int k = currentArcIndex; k < numberOfBiasArcs; k++ )
+            {
+                BOOST_CHECK_EQUAL( inverseCovariancesAtTimeUpdate.at( i ).col(
+                                       6 + j * numberOfBiasArcs + k ).cwiseAbs( ).maxCoeff( ), 0.0 );
+            }
+        }
+    }
+
+    // Check that the user-defined time update reproduces the inverse covariance with the built-in process noise
+    Eigen::MatrixXd inverseCovarianceWithProcessNoise = podOutputWithProcessNoise->getUnnormalizedInverseCovarianceMatrix( );
+    Eigen::MatrixXd inverseCovarianceWithTimeUpdate = podOutputWithTimeUpdate->getUnnormalizedInverseCovarianceMatrix( );
+    for( int i = 0; i < numberOfParameters; i++ )
+    {
+        for( int j = 0; j < numberOfParameters; j++ )
+        {
+            BOOST_CHECK_SMALL( std::fabs( inverseCovarianceWithProcessNoise( i, j ) - inverseCovarianceWithTimeUpdate( i, j ) ),
+                               1.0E-10 * std::sqrt( inverseCovarianceWithProcessNoise( i, i ) *
+                                                    inverseCovarianceWithProcessNoise( j, j ) ) );
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 }
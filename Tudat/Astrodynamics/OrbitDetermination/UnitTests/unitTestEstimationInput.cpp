@@ -141,6 +141,122 @@ BOOST_AUTO_TEST_CASE( test_EstimationInputAndOutput )
     }
 }
 
+//! Test whether the normal equations accumulated per block of observations (without storing the full partials matrix) give
+//! the same estimation results as the full partials matrix, with different weights and a priori covariance
+BOOST_AUTO_TEST_CASE( test_BlockWiseNormalEquationsAccumulation )
+{
+    Eigen::VectorXd parameterPerturbation = getDefaultInitialParameterPerturbation( );
+
+    // Define moderate a priori covariance
+    Eigen::MatrixXd moderateInverseAPriopriCovariance = Eigen::MatrixXd::Zero( 7, 7 );
+    for( unsigned int i = 0; i < 7; i++ )
+    {
+        moderateInverseAPriopriCovariance( i, i ) = 1.0 / ( 1.0E-6 * parameterPerturbation( i ) * parameterPerturbation( i ) );
+    }
+
+    // Test case 0: range, Doppler and angular position data, with different weight per observable, no a priori covariance
+    // Test case 1: range data with constant weight, and moderate a priori covariance
+    for( unsigned int testCase = 0; testCase < 2; testCase++ )
+    {
+        int simulationType = ( testCase == 0 ) ? 4 : 1;
+        Eigen::MatrixXd inverseAPrioriCovariance = ( testCase == 0 ) ?
+                    Eigen::MatrixXd::Zero( 7, 7 ) : moderateInverseAPriopriCovariance;
+        double constantWeight = ( testCase == 0 ) ? 1.0 : 100.0;
+
+        // Run estimation with full partials matrix, and with block-wise accumulation of normal equations
+        std::pair< std::shared_ptr< PodOutput< double > >, Eigen::VectorXd > estimationOutputFromPartialsMatrix =
+                executePlanetaryParameterEstimation< double, double >(
+                    simulationType, parameterPerturbation, inverseAPrioriCovariance, constantWeight, true );
+        std::pair< std::shared_ptr< PodOutput< double > >, Eigen::VectorXd > estimationOutputFromNormalEquations =
+                executePlanetaryParameterEstimation< double, double >(
+                    simulationType, parameterPerturbation, inverseAPrioriCovariance, constantWeight, false );
+
+        // Check that full partials matrix is only stored when requested
+        BOOST_CHECK_EQUAL( estimationOutputFromPartialsMatrix.first->normalizedInformationMatrix_.rows( ),
+                           estimationOutputFromPartialsMatrix.first->residuals_.rows( ) );
+        BOOST_CHECK_EQUAL( estimationOutputFromNormalEquations.first->normalizedInformationMatrix_.rows( ), 0 );
+
+        // Check consistency of estimated parameters
+        Eigen::VectorXd estimationErrorDifference =
+                estimationOutputFromPartialsMatrix.second - estimationOutputFromNormalEquations.second;
+        for( unsigned int i = 0; i < 3; i++ )
+        {
+            BOOST_CHECK_SMALL( std::fabs( estimationErrorDifference( i ) ), 1.0E-3 );
+            BOOST_CHECK_SMALL( std::fabs( estimationErrorDifference( i + 3 ) ), 1.0E-8 );
+        }
+        BOOST_CHECK_SMALL( std::fabs( estimationErrorDifference( 6 ) ), 10.0 );
+
+        // Check consistency of normalization and (inverse) covariance
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    estimationOutputFromPartialsMatrix.first->informationMatrixTransformationDiagonal_,
+                    estimationOutputFromNormalEquations.first->informationMatrixTransformationDiagonal_, 1.0E-8 );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    estimationOutputFromPartialsMatrix.first->getUnnormalizedInverseCovarianceMatrix( ),
+                    estimationOutputFromNormalEquations.first->getUnnormalizedInverseCovarianceMatrix( ), 1.0E-8 );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                    estimationOutputFromPartialsMatrix.first->getUnnormalizedCovarianceMatrix( ),
+                    estimationOutputFromNormalEquations.first->getUnnormalizedCovarianceMatrix( ), 1.0E-6 );
+    }
+}
+
+//! Test whether the estimation results are identical when computing the observations and partials in multiple threads
+BOOST_AUTO_TEST_CASE( test_ConcurrentObservationComputation )
+{
+    // Test with full partials matrix, and with block-wise accumulation of normal equations
+    for( unsigned int testCase = 0; testCase < 2; testCase++ )
+    {
+        bool saveInformationMatrix = ( testCase == 0 );
+
+        // Run estimation with range, Doppler and angular position data, in a single thread and in multiple threads
+        std::pair< std::shared_ptr< PodOutput< double > >, Eigen::VectorXd > serialEstimationOutput =
+                executePlanetaryParameterEstimation< double, double >(
+                    4, getDefaultInitialParameterPerturbation( ), Eigen::MatrixXd::Zero( 7, 7 ), 1.0,
+                    saveInformationMatrix, 1 );
+        std::pair< std::shared_ptr< PodOutput< double > >, Eigen::VectorXd > concurrentEstimationOutput =
+                executePlanetaryParameterEstimation< double, double >(
+                    4, getDefaultInitialParameterPerturbation( ), Eigen::MatrixXd::Zero( 7, 7 ), 1.0,
+                    saveInformationMatrix, 4 );
+
+        // Check that parameter estimates are bitwise identical
+        Eigen::VectorXd serialParameterEstimate = serialEstimationOutput.first->parameterEstimate_;
+        Eigen::VectorXd concurrentParameterEstimate = concurrentEstimationOutput.first->parameterEstimate_;
+        BOOST_CHECK_EQUAL( serialParameterEstimate.rows( ), concurrentParameterEstimate.rows( ) );
+        for( int i = 0; i < serialParameterEstimate.rows( ); i++ )
+        {
+            BOOST_CHECK_EQUAL( serialParameterEstimate( i ), concurrentParameterEstimate( i ) );
+        }
+
+        // Check that residuals are bitwise identical
+        Eigen::VectorXd serialResiduals = serialEstimationOutput.first->residuals_;
+        Eigen::VectorXd concurrentResiduals = concurrentEstimationOutput.first->residuals_;
+        BOOST_CHECK_EQUAL( serialResiduals.rows( ), concurrentResiduals.rows( ) );
+        for( int i = 0; i < serialResiduals.rows( ); i++ )
+        {
+            BOOST_CHECK_EQUAL( serialResiduals( i ), concurrentResiduals( i ) );
+        }
+
+        // Check that normal equations (unnormalized inverse covariance) are bitwise identical
+        Eigen::MatrixXd serialInverseCovariance = serialEstimationOutput.first->getUnnormalizedInverseCovarianceMatrix( );
+        Eigen::MatrixXd concurrentInverseCovariance =
+                concurrentEstimationOutput.first->getUnnormalizedInverseCovarianceMatrix( );
+        for( int i = 0; i < serialInverseCovariance.rows( ); i++ )
+        {
+            for( int j = 0; j < serialInverseCovariance.cols( ); j++ )
+            {
+                BOOST_CHECK_EQUAL( serialInverseCovariance( i, j ), concurrentInverseCovariance( i, j ) );
+            }
+        }
+
+        // Check that partials matrix is bitwise identical (if stored)
+        if( saveInformationMatrix )
+        {
+            Eigen::MatrixXd serialInformationMatrix = serialEstimationOutput.first->normalizedInformationMatrix_;
+            Eigen::MatrixXd concurrentInformationMatrix = concurrentEstimationOutput.first->normalizedInformationMatrix_;
+            BOOST_CHECK_EQUAL( ( serialInformationMatrix.array( ) == concurrentInformationMatrix.array( ) ).all( ), true );
+        }
+    }
+}
+
 //! Test whether the covariance is correctly computed as a function of time
 BOOST_AUTO_TEST_CASE( test_CovarianceAsFunctionOfTime )
 {
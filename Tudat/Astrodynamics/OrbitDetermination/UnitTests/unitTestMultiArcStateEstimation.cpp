@@ -50,7 +50,9 @@ using namespace tudat::basic_astrodynamics;
 
 template< typename ObservationScalarType = double , typename TimeType = double , typename StateScalarType  = double >
 Eigen::VectorXd  executeParameterEstimation(
-        const int linkArcs )
+        const int linkArcs,
+        std::shared_ptr< PodOutput< StateScalarType, TimeType > >& podOutput,
+        const bool exploitArcWiseBlockStructure = false )
 {
     //Load spice kernels.f
     std::string kernelsPath = input_output::getSpiceKernelPath( );
@@ -265,9 +267,9 @@ Eigen::VectorXd  executeParameterEstimation(
     std::shared_ptr< PodInput< ObservationScalarType, TimeType > > podInput =
             std::make_shared< PodInput< ObservationScalarType, TimeType > >(
                 observationsAndTimes, ( initialParameterEstimate ).rows( ) );
+    podInput->defineNormalEquationsSolverSettings( exploitArcWiseBlockStructure );
 
-    std::shared_ptr< PodOutput< StateScalarType, TimeType > > podOutput = orbitDeterminationManager.estimateParameters(
-                podInput );
+    podOutput = orbitDeterminationManager.estimateParameters( podInput );
 
     return ( podOutput->parameterEstimate_ - truthParameters ).template cast< double >( );
 }
@@ -279,8 +281,9 @@ BOOST_AUTO_TEST_CASE( test_MultiArcStateEstimation )
     for( unsigned int testCase = 0; testCase < 2; testCase++ )
     {
 #if( BUILD_EXTENDED_PRECISION_PROPAGATION_TOOLS )
+        std::shared_ptr< PodOutput< long double, tudat::Time > > podOutput;
         Eigen::VectorXd parameterError = executeParameterEstimation< long double, tudat::Time, long double >(
-                    testCase );
+                    testCase, podOutput );
         int numberOfEstimatedArcs = ( parameterError.rows( ) - 3 ) / 6;
 
         std::cout <<"Estimation error: "<< parameterError.transpose( ) << std::endl;
@@ -297,8 +300,9 @@ BOOST_AUTO_TEST_CASE( test_MultiArcStateEstimation )
         BOOST_CHECK_SMALL( std::fabs( parameterError( parameterError.rows( ) - 2 ) ), 1.0E-12 );
         BOOST_CHECK_SMALL( std::fabs( parameterError( parameterError.rows( ) - 1 ) ), 1.0E-12 );
 #else
+        std::shared_ptr< PodOutput< double, double > > podOutput;
         Eigen::VectorXd parameterError = executeParameterEstimation< double, double, double >(
-                    testCase );
+                    testCase, podOutput );
         int numberOfEstimatedArcs = ( parameterError.rows( ) - 3 ) / 6;
 
         std::cout << parameterError.transpose( ) << std::endl;
@@ -319,6 +323,65 @@ BOOST_AUTO_TEST_CASE( test_MultiArcStateEstimation )
 
 }
 
+//! Test whether the solution of the normal equations by elimination of the arc-wise parameters (Schur complement) is
+//! consistent with the direct solution of the full normal equations, with arc-wise initial states and global rotation parameters
+BOOST_AUTO_TEST_CASE( test_MultiArcStateEstimationWithArcWiseBlockElimination )
+{
+    // Estimate parameters with direct solution of normal equations, and with elimination of arc-wise parameters
+    std::shared_ptr< PodOutput< double, double > > podOutputFromFullNormalEquations;
+    Eigen::VectorXd parameterErrorFromFullNormalEquations = executeParameterEstimation< double, double, double >(
+                0, podOutputFromFullNormalEquations, false );
+
+    std::shared_ptr< PodOutput< double, double > > podOutputFromArcWiseElimination;
+    Eigen::VectorXd parameterErrorFromArcWiseElimination = executeParameterEstimation< double, double, double >(
+                0, podOutputFromArcWiseElimination, true );
+
+    // Check that block-arrowhead solver is only used when requested
+    BOOST_CHECK_EQUAL( podOutputFromFullNormalEquations->normalEquationsSolver_ == nullptr, true );
+    BOOST_CHECK_EQUAL( podOutputFromArcWiseElimination->normalEquationsSolver_ != nullptr, true );
+
+    int numberOfEstimatedArcs = ( parameterErrorFromFullNormalEquations.rows( ) - 3 ) / 6;
+    BOOST_CHECK_EQUAL( numberOfEstimatedArcs > 1, true );
+
+    // Check that the (normalized) parameter update obtained by elimination of the arc-wise parameters is equal to the direct
+    // solution of the same normal equations, with a relative tolerance scaled to the condition number of the normal matrix
+    Eigen::MatrixXd normalMatrix = podOutputFromArcWiseElimination->inverseNormalizedCovarianceMatrix_;
+    Eigen::VectorXd normalEquationsRightHandSide =
+            podOutputFromArcWiseElimination->normalizedInformationMatrix_.transpose( ) *
+            podOutputFromArcWiseElimination->weightsMatrixDiagonal_.cwiseProduct(
+                podOutputFromArcWiseElimination->residuals_ );
+    Eigen::VectorXd parameterUpdateFromFullNormalEquations =
+            linear_algebra::performLeastSquaresAdjustmentFromNormalEquations(
+                normalMatrix, normalEquationsRightHandSide ).first;
+    Eigen::VectorXd parameterUpdateFromArcWiseElimination =
+            podOutputFromArcWiseElimination->normalEquationsSolver_->getSolution( );
+
+    Eigen::JacobiSVD< Eigen::MatrixXd > normalMatrixDecomposition( normalMatrix );
+    double conditionNumber = normalMatrixDecomposition.singularValues( )( 0 ) /
+            normalMatrixDecomposition.singularValues( )( normalMatrixDecomposition.singularValues( ).rows( ) - 1 );
+    double relativeTolerance = std::max( 1.0E-10, 10.0 * std::numeric_limits< double >::epsilon( ) * conditionNumber );
+    BOOST_CHECK_EQUAL( parameterUpdateFromArcWiseElimination.rows( ), parameterUpdateFromFullNormalEquations.rows( ) );
+    BOOST_CHECK_SMALL( ( parameterUpdateFromArcWiseElimination - parameterUpdateFromFullNormalEquations ).norm( ) /
+                       parameterUpdateFromFullNormalEquations.norm( ), relativeTolerance );
+
+    // Check consistency of estimated global (rotation) parameters
+    Eigen::VectorXd parameterErrorDifference = parameterErrorFromFullNormalEquations - parameterErrorFromArcWiseElimination;
+    BOOST_CHECK_SMALL( std::fabs( parameterErrorDifference( parameterErrorDifference.rows( ) - 3 ) ), 1.0E-19 );
+    BOOST_CHECK_SMALL( std::fabs( parameterErrorDifference( parameterErrorDifference.rows( ) - 2 ) ), 1.0E-11 );
+    BOOST_CHECK_SMALL( std::fabs( parameterErrorDifference( parameterErrorDifference.rows( ) - 1 ) ), 1.0E-11 );
+
+    // Check consistency of covariance, and associated formal errors
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                podOutputFromFullNormalEquations->getUnnormalizedInverseCovarianceMatrix( ),
+                podOutputFromArcWiseElimination->getUnnormalizedInverseCovarianceMatrix( ), 1.0E-8 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                podOutputFromFullNormalEquations->getUnnormalizedCovarianceMatrix( ),
+                podOutputFromArcWiseElimination->getUnnormalizedCovarianceMatrix( ), 1.0E-6 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                podOutputFromFullNormalEquations->getFormalErrorVector( ),
+                podOutputFromArcWiseElimination->getFormalErrorVector( ), 1.0E-6 );
+}
+
 template< typename ObservationScalarType = double , typename TimeType = double , typename StateScalarType  = double >
 Eigen::VectorXd  executeMultiBodyMultiArcParameterEstimation( )
 {
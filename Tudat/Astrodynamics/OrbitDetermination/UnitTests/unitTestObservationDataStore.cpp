@@ -0,0 +1,256 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <fstream>
+#include <limits>
+
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Basics/testMacros.h"
+
+#include "Tudat/Astrodynamics/OrbitDetermination/observationDataStore.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::observation_models;
+using namespace tudat::simulation_setup;
+
+BOOST_AUTO_TEST_SUITE( test_observation_data_store )
+
+//! Test whether observations are correctly stored in, appended to, and retrieved from an observation data store.
+BOOST_AUTO_TEST_CASE( testObservationDataStore )
+{
+    const std::string storeDirectory =
+            ( boost::filesystem::temp_directory_path( ) / boost::filesystem::unique_path( ) ).string( );
+
+    // Define link ends
+    LinkEnds stationOneLinkEnds;
+    stationOneLinkEnds[ transmitter ] = std::make_pair( "Earth", "Station1" );
+    stationOneLinkEnds[ receiver ] = std::make_pair( "Spacecraft", "" );
+
+    LinkEnds stationTwoLinkEnds;
+    stationTwoLinkEnds[ transmitter ] = std::make_pair( "Earth", "Station2" );
+    stationTwoLinkEnds[ receiver ] = std::make_pair( "Spacecraft", "" );
+
+    LinkEnds positionLinkEnds;
+    positionLinkEnds[ observed_body ] = std::make_pair( "Spacecraft", "" );
+
+    // Create data of first pass: range from two stations and position observations.
+    PodInput< double, double >::PodInputDataType firstPassData;
+    std::map< ObservableType, std::map< LinkEnds, Eigen::VectorXd > > firstPassWeights;
+    std::vector< double > firstPassTimes = { 100.0, 110.0, 120.0, 130.0 };
+    firstPassData[ one_way_range ][ stationOneLinkEnds ] = std::make_pair(
+                ( Eigen::VectorXd( 4 ) << 1.0E7, 1.1E7, 1.2E7, 1.3E7 ).finished( ),
+                std::make_pair( firstPassTimes, receiver ) );
+    firstPassData[ one_way_range ][ stationTwoLinkEnds ] = std::make_pair(
+                ( Eigen::VectorXd( 4 ) << 2.0E7, 2.1E7, 2.2E7, 2.3E7 ).finished( ),
+                std::make_pair( firstPassTimes, transmitter ) );
+    firstPassData[ position_observable ][ positionLinkEnds ] = std::make_pair(
+                ( Eigen::VectorXd( 6 ) << 1.0, 2.0, 3.0, 4.0, 5.0, 6.0 ).finished( ),
+                std::make_pair( std::vector< double >( { 100.0, 200.0 } ), observed_body ) );
+    firstPassWeights[ one_way_range ][ stationOneLinkEnds ] = Eigen::VectorXd::Constant( 4, 1.0E-2 );
+    firstPassWeights[ one_way_range ][ stationTwoLinkEnds ] = Eigen::VectorXd::Constant( 4, 4.0E-2 );
+    firstPassWeights[ position_observable ][ positionLinkEnds ] = Eigen::VectorXd::LinSpaced( 6, 1.0, 6.0 );
+
+    {
+        std::shared_ptr< ObservationDataStore > dataStore = std::make_shared< ObservationDataStore >( storeDirectory );
+        BOOST_CHECK_EQUAL( dataStore->getNumberOfRows( ), 0 );
+        appendPodInputDataToObservationDataStore< double, double >( dataStore, firstPassData, firstPassWeights );
+        BOOST_CHECK_EQUAL( dataStore->getNumberOfRows( ), 14 );
+    }
+
+    // Append second pass of station one, in which the second observation is flagged
+    {
+        std::shared_ptr< ObservationDataStore > dataStore = std::make_shared< ObservationDataStore >( storeDirectory, false );
+        BOOST_CHECK_EQUAL( dataStore->getNumberOfRows( ), 14 );
+        dataStore->appendObservations(
+                    one_way_range, stationOneLinkEnds, receiver, { 1000.0, 1010.0, 1020.0 },
+                    ( Eigen::VectorXd( 3 ) << 3.0E7, 3.1E7, 3.2E7 ).finished( ), Eigen::VectorXd::Zero( 0 ), { 0, 1, 0 } );
+        BOOST_CHECK_EQUAL( dataStore->getNumberOfRows( ), 17 );
+    }
+
+    // Simulate interrupted append, by adding data to column file that is not committed to the header
+    {
+        std::ofstream timesFile( ( boost::filesystem::path( storeDirectory ) / "times.bin" ).string( ).c_str( ),
+                                 std::ios::binary | std::ios::app );
+        double dummyTime = -1.0;
+        timesFile.write( reinterpret_cast< const char* >( &dummyTime ), sizeof( dummyTime ) );
+    }
+
+    std::shared_ptr< ObservationDataStore > dataStore = std::make_shared< ObservationDataStore >( storeDirectory, false );
+
+    // Check memory-mapped columns
+    BOOST_CHECK_EQUAL( dataStore->getNumberOfRows( ), 17 );
+    BOOST_CHECK_EQUAL( dataStore->getLinkEndsList( ).size( ), 3 );
+    Eigen::Map< const Eigen::VectorXd > storedTimes = dataStore->getObservationTimes( );
+    Eigen::Map< const Eigen::VectorXd > storedObservations = dataStore->getObservations( );
+    Eigen::Map< const Eigen::VectorXd > storedWeights = dataStore->getWeights( );
+    Eigen::Map< const ObservationDataStore::IntegerColumnType > storedObservableTypes = dataStore->getObservableTypes( );
+    Eigen::Map< const ObservationDataStore::IntegerColumnType > storedLinkEndsIds = dataStore->getLinkEndsIds( );
+    Eigen::Map< const ObservationDataStore::IntegerColumnType > storedReferenceLinkEnds =
+            dataStore->getReferenceLinkEnds( );
+    Eigen::Map< const ObservationDataStore::ByteColumnType > storedFlags = dataStore->getFlags( );
+
+    int currentRow = 0;
+    for( auto observableIterator : firstPassData )
+    {
+        for( auto dataIterator : observableIterator.second )
+        {
+            int observableSize = getObservableSize( observableIterator.first );
+            for( int i = 0; i < dataIterator.second.first.rows( ); i++ )
+            {
+                BOOST_CHECK_EQUAL( storedTimes( currentRow ), dataIterator.second.second.first.at( i / observableSize ) );
+                BOOST_CHECK_EQUAL( storedObservations( currentRow ), dataIterator.second.first( i ) );
+                BOOST_CHECK_EQUAL( storedWeights( currentRow ),
+                                   firstPassWeights.at( observableIterator.first ).at( dataIterator.first )( i ) );
+                BOOST_CHECK_EQUAL( storedObservableTypes( currentRow ), observableIterator.first );
+                BOOST_CHECK( dataStore->getLinkEndsList( ).at( storedLinkEndsIds( currentRow ) ) == dataIterator.first );
+                BOOST_CHECK_EQUAL( storedReferenceLinkEnds( currentRow ), dataIterator.second.second.second );
+                BOOST_CHECK_EQUAL( storedFlags( currentRow ), 0 );
+                currentRow++;
+            }
+        }
+    }
+    for( int i = 0; i < 3; i++ )
+    {
+        BOOST_CHECK_EQUAL( storedTimes( currentRow ), 1000.0 + 10.0 * i );
+        BOOST_CHECK_EQUAL( storedWeights( currentRow ), 1.0 );
+        BOOST_CHECK_EQUAL( storedFlags( currentRow ), ( i == 1 ) ? 1 : 0 );
+        BOOST_CHECK_EQUAL( storedLinkEndsIds( currentRow ), storedLinkEndsIds( 0 ) );
+        currentRow++;
+    }
+
+    // Retrieve all (non-flagged) data, and check whether both passes are merged
+    std::shared_ptr< PodInput< double, double > > podInput =
+            createPodInputFromObservationDataStore< double, double >( dataStore, 2 );
+    PodInput< double, double >::PodInputDataType retrievedData = podInput->getObservationsAndTimes( );
+    BOOST_CHECK_EQUAL( retrievedData.size( ), 2 );
+    BOOST_CHECK_EQUAL( retrievedData.at( one_way_range ).size( ), 2 );
+
+    std::pair< Eigen::VectorXd, std::pair< std::vector< double >, LinkEndType > > stationOneData =
+            retrievedData.at( one_way_range ).at( stationOneLinkEnds );
+    BOOST_CHECK_EQUAL( stationOneData.first.rows( ), 6 );
+    BOOST_CHECK_EQUAL( stationOneData.second.first.size( ), 6 );
+    BOOST_CHECK_EQUAL( stationOneData.second.second, receiver );
+    BOOST_CHECK_EQUAL( stationOneData.first( 3 ), 1.3E7 );
+    BOOST_CHECK_EQUAL( stationOneData.first( 4 ), 3.0E7 );
+    BOOST_CHECK_EQUAL( stationOneData.first( 5 ), 3.2E7 );
+    BOOST_CHECK_EQUAL( stationOneData.second.first.at( 5 ), 1020.0 );
+    BOOST_CHECK_EQUAL( podInput->getWeightsMatrixDiagonals( ).at( one_way_range ).at( stationOneLinkEnds )( 3 ), 1.0E-2 );
+    BOOST_CHECK_EQUAL( podInput->getWeightsMatrixDiagonals( ).at( one_way_range ).at( stationOneLinkEnds )( 4 ), 1.0 );
+
+    BOOST_CHECK_EQUAL( retrievedData.at( one_way_range ).at( stationTwoLinkEnds ).second.second, transmitter );
+    BOOST_CHECK_EQUAL( ( retrievedData.at( one_way_range ).at( stationTwoLinkEnds ).first -
+                         firstPassData.at( one_way_range ).at( stationTwoLinkEnds ).first ).norm( ), 0.0 );
+    BOOST_CHECK_EQUAL( ( retrievedData.at( position_observable ).at( positionLinkEnds ).first -
+                         firstPassData.at( position_observable ).at( positionLinkEnds ).first ).norm( ), 0.0 );
+    BOOST_CHECK_EQUAL( retrievedData.at( position_observable ).at( positionLinkEnds ).second.first.size( ), 2 );
+    BOOST_CHECK_EQUAL( ( podInput->getWeightsMatrixDiagonals( ).at( position_observable ).at( positionLinkEnds ) -
+                         firstPassWeights.at( position_observable ).at( positionLinkEnds ) ).norm( ), 0.0 );
+
+    // Retrieve data in time interval, including flagged data
+    podInput = createPodInputFromObservationDataStore< double, double >(
+                dataStore, 2, 115.0, 1015.0, std::vector< ObservableType >( ), 0 );
+    retrievedData = podInput->getObservationsAndTimes( );
+    BOOST_CHECK_EQUAL( retrievedData.at( one_way_range ).at( stationOneLinkEnds ).second.first.size( ), 4 );
+    BOOST_CHECK_EQUAL( retrievedData.at( one_way_range ).at( stationOneLinkEnds ).first( 3 ), 3.1E7 );
+    BOOST_CHECK_EQUAL( retrievedData.at( one_way_range ).at( stationTwoLinkEnds ).second.first.size( ), 2 );
+    BOOST_CHECK_EQUAL( retrievedData.at( position_observable ).at( positionLinkEnds ).second.first.size( ), 1 );
+    BOOST_CHECK_EQUAL( retrievedData.at( position_observable ).at( positionLinkEnds ).first.rows( ), 3 );
+    BOOST_CHECK_EQUAL( retrievedData.at( position_observable ).at( positionLinkEnds ).first( 0 ), 4.0 );
+
+    // Retrieve data of single observable type
+    podInput = createPodInputFromObservationDataStore< double, double >(
+                dataStore, 2, -std::numeric_limits< double >::infinity( ), std::numeric_limits< double >::infinity( ),
+                { position_observable } );
+    BOOST_CHECK_EQUAL( podInput->getObservationsAndTimes( ).size( ), 1 );
+    BOOST_CHECK_EQUAL( podInput->getObservationsAndTimes( ).count( position_observable ), 1 );
+
+    // Append after interrupted append, and check that uncommitted data is discarded
+    dataStore->appendObservations( one_way_range, stationTwoLinkEnds, transmitter, { 2000.0 },
+                                   ( Eigen::VectorXd( 1 ) << 4.0E7 ).finished( ) );
+    dataStore = std::make_shared< ObservationDataStore >( storeDirectory, false );
+    BOOST_CHECK_EQUAL( dataStore->getNumberOfRows( ), 18 );
+    BOOST_CHECK_EQUAL( dataStore->getObservationTimes( )( 17 ), 2000.0 );
+    BOOST_CHECK_EQUAL( dataStore->getObservations( )( 17 ), 4.0E7 );
+    BOOST_CHECK_EQUAL( dataStore->getObservationTimes( )( 16 ), 1020.0 );
+
+    // Simulate failed append (with new link ends), by replacing a column file with a directory, and check that the
+    // committed data and list of link ends are unchanged
+    LinkEnds stationThreeLinkEnds;
+    stationThreeLinkEnds[ transmitter ] = std::make_pair( "Earth", "Station3" );
+    stationThreeLinkEnds[ receiver ] = std::make_pair( "Spacecraft", "" );
+
+    const boost::filesystem::path flagsFilePath = boost::filesystem::path( storeDirectory ) / "flags.bin";
+    const boost::filesystem::path movedFlagsFilePath = boost::filesystem::path( storeDirectory ) / "flags.bin.moved";
+    boost::filesystem::rename( flagsFilePath, movedFlagsFilePath );
+    boost::filesystem::create_directory( flagsFilePath );
+
+    bool isExceptionCaught = false;
+    try
+    {
+        dataStore->appendObservations( one_way_range, stationThreeLinkEnds, receiver, { 3000.0 },
+                                       ( Eigen::VectorXd( 1 ) << 5.0E7 ).finished( ) );
+    }
+    catch( std::exception& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK( isExceptionCaught );
+    BOOST_CHECK_EQUAL( dataStore->getNumberOfRows( ), 18 );
+    BOOST_CHECK_EQUAL( dataStore->getLinkEndsList( ).size( ), 3 );
+    BOOST_CHECK_EQUAL( dataStore->getObservations( )( 17 ), 4.0E7 );
+
+    boost::filesystem::remove( flagsFilePath );
+    boost::filesystem::rename( movedFlagsFilePath, flagsFilePath );
+    dataStore = std::make_shared< ObservationDataStore >( storeDirectory, false );
+    BOOST_CHECK_EQUAL( dataStore->getNumberOfRows( ), 18 );
+    BOOST_CHECK_EQUAL( dataStore->getLinkEndsList( ).size( ), 3 );
+
+    // Check that inconsistent input is rejected
+    isExceptionCaught = false;
+    try
+    {
+        dataStore->appendObservations( position_observable, positionLinkEnds, observed_body, { 3000.0 },
+                                       ( Eigen::VectorXd( 2 ) << 1.0, 2.0 ).finished( ) );
+    }
+    catch( std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK( isExceptionCaught );
+    BOOST_CHECK_EQUAL( dataStore->getNumberOfRows( ), 18 );
+
+    isExceptionCaught = false;
+    try
+    {
+        ObservationDataStore missingStore( storeDirectory + "_missing", false );
+    }
+    catch( std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK( isExceptionCaught );
+
+    dataStore.reset( );
+    boost::filesystem::remove_all( storeDirectory );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+}
+
+}
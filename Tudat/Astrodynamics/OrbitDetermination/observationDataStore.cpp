@@ -0,0 +1,318 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#include <boost/filesystem.hpp>
+
+#include "Tudat/Astrodynamics/OrbitDetermination/observationDataStore.h"
+#include "Tudat/Basics/binarySerialization.h"
+
+namespace tudat
+{
+
+namespace simulation_setup
+{
+
+//! Identifier at start of observation data store header files.
+static const char observationDataStoreFileIdentifier[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'O', 'B', 'S' };
+
+//! Version of observation data store format.
+static const std::int32_t observationDataStoreFileVersion = 2;
+
+//! Name of header file in observation data store directory.
+static const std::string observationDataStoreHeaderFileName = "header.bin";
+
+//! Names of column files in observation data store directory (in order of ObservationDataStoreColumns enum).
+static const char* const observationDataStoreColumnFileNames[ 7 ] =
+{ "times.bin", "values.bin", "weights.bin", "linkEndsIds.bin", "observableTypes.bin", "referenceLinkEnds.bin", "flags.bin" };
+
+//! Function to append a list of values to a binary (column) file.
+template< typename ColumnScalarType >
+static void appendValuesToColumnFile( const std::string& fileName, const std::vector< ColumnScalarType >& values )
+{
+    std::ofstream outputFile( fileName.c_str( ), std::ios::binary | std::ios::app );
+    outputFile.write( reinterpret_cast< const char* >( values.data( ) ), sizeof( ColumnScalarType ) * values.size( ) );
+    if( !outputFile.good( ) )
+    {
+        throw std::runtime_error( "Error when appending to observation data store, could not write to file " + fileName );
+    }
+}
+
+//! Constructor, opens an existing store, or creates a new, empty store.
+ObservationDataStore::ObservationDataStore( const std::string& storeDirectory, const bool createIfMissing ):
+    storeDirectory_( storeDirectory ), numberOfRows_( 0 )
+{
+    if( !boost::filesystem::exists(
+                boost::filesystem::path( storeDirectory_ ) / observationDataStoreHeaderFileName ) )
+    {
+        if( !createIfMissing )
+        {
+            throw std::runtime_error( "Error when opening observation data store, no store found in " + storeDirectory_ );
+        }
+
+        boost::filesystem::create_directories( storeDirectory_ );
+        for( int i = 0; i < number_of_columns; i++ )
+        {
+            std::ofstream columnFile( getColumnFileName( i ).c_str( ), std::ios::binary | std::ios::trunc );
+            if( !columnFile.is_open( ) )
+            {
+                throw std::runtime_error( "Error when creating observation data store, could not create file " +
+                                          getColumnFileName( i ) );
+            }
+        }
+        writeHeader( 0, linkEndsList_ );
+    }
+
+    readHeaderAndMapColumns( );
+}
+
+//! Function to append a set of observations of a single observable type and set of link ends to the store
+void ObservationDataStore::appendObservations( const observation_models::ObservableType observableType,
+                                               const observation_models::LinkEnds& linkEnds,
+                                               const observation_models::LinkEndType referenceLinkEnd,
+                                               const std::vector< double >& observationTimes,
+                                               const Eigen::VectorXd& observations,
+                                               const Eigen::VectorXd& weights,
+                                               const std::vector< std::uint8_t >& flags )
+{
+    // Check input consistency
+    const int observableSize = observation_models::getObservableSize( observableType );
+    const int numberOfNewRows = observations.rows( );
+    if( static_cast< int >( observationTimes.size( ) ) * observableSize != numberOfNewRows )
+    {
+        throw std::runtime_error( "Error when appending to observation data store, number of observations (" +
+                                  std::to_string( numberOfNewRows ) + ") is inconsistent with number of times (" +
+                                  std::to_string( observationTimes.size( ) ) + ")" );
+    }
+    if( weights.rows( ) != 0 && weights.rows( ) != numberOfNewRows )
+    {
+        throw std::runtime_error( "Error when appending to observation data store, number of weights is inconsistent" );
+    }
+    if( flags.size( ) != 0 && static_cast< int >( flags.size( ) ) != numberOfNewRows )
+    {
+        throw std::runtime_error( "Error when appending to observation data store, number of flags is inconsistent" );
+    }
+    if( numberOfNewRows == 0 )
+    {
+        return;
+    }
+
+    // Retrieve id of link ends, adding them to the (updated) list if needed. The list of the store itself is only updated
+    // once the new rows are committed.
+    std::vector< observation_models::LinkEnds > updatedLinkEndsList = linkEndsList_;
+    std::int32_t linkEndsId = std::distance(
+                updatedLinkEndsList.begin( ), std::find( updatedLinkEndsList.begin( ), updatedLinkEndsList.end( ), linkEnds ) );
+    if( linkEndsId == static_cast< std::int32_t >( updatedLinkEndsList.size( ) ) )
+    {
+        updatedLinkEndsList.push_back( linkEnds );
+    }
+
+    // Create columns of new rows.
+    std::vector< double > newTimes( numberOfNewRows );
+    for( int i = 0; i < numberOfNewRows; i++ )
+    {
+        newTimes[ i ] = observationTimes[ i / observableSize ];
+    }
+    std::vector< double > newValues( observations.data( ), observations.data( ) + numberOfNewRows );
+    std::vector< double > newWeights = ( weights.rows( ) == 0 ) ?
+                std::vector< double >( numberOfNewRows, 1.0 ) :
+                std::vector< double >( weights.data( ), weights.data( ) + numberOfNewRows );
+    std::vector< std::uint8_t > newFlags = ( flags.size( ) == 0 ) ? std::vector< std::uint8_t >( numberOfNewRows, 0 ) : flags;
+
+    // Release mapped columns, and remove any rows that were not committed by a previous (interrupted) append.
+    mappedColumns_.clear( );
+    try
+    {
+        for( int i = 0; i < number_of_columns; i++ )
+        {
+            boost::filesystem::resize_file( getColumnFileName( i ), numberOfRows_ * getColumnEntrySize( i ) );
+        }
+
+        // Write new rows, and commit them by updating the header.
+        appendValuesToColumnFile( getColumnFileName( times_column ), newTimes );
+        appendValuesToColumnFile( getColumnFileName( values_column ), newValues );
+        appendValuesToColumnFile( getColumnFileName( weights_column ), newWeights );
+        appendValuesToColumnFile( getColumnFileName( link_ends_ids_column ),
+                                  std::vector< std::int32_t >( numberOfNewRows, linkEndsId ) );
+        appendValuesToColumnFile( getColumnFileName( observable_types_column ),
+                                  std::vector< std::int32_t >( numberOfNewRows, static_cast< std::int32_t >( observableType ) ) );
+        appendValuesToColumnFile( getColumnFileName( reference_link_ends_column ),
+                                  std::vector< std::int32_t >( numberOfNewRows, static_cast< std::int32_t >( referenceLinkEnd ) ) );
+        appendValuesToColumnFile( getColumnFileName( flags_column ), newFlags );
+
+        writeHeader( numberOfRows_ + numberOfNewRows, updatedLinkEndsList );
+    }
+    catch( std::exception& )
+    {
+        // Restore mapping of committed rows (any rows written to the column files remain uncommitted).
+        readHeaderAndMapColumns( );
+        throw;
+    }
+
+    readHeaderAndMapColumns( );
+}
+
+//! Function to retrieve the name of the file containing a given column.
+std::string ObservationDataStore::getColumnFileName( const int columnIndex ) const
+{
+    return ( boost::filesystem::path( storeDirectory_ ) / observationDataStoreColumnFileNames[ columnIndex ] ).string( );
+}
+
+//! Function to retrieve the size (in bytes) of a single entry of a given column.
+std::size_t ObservationDataStore::getColumnEntrySize( const int columnIndex )
+{
+    switch( columnIndex )
+    {
+    case times_column:
+    case values_column:
+    case weights_column:
+        return sizeof( double );
+    case link_ends_ids_column:
+    case observable_types_column:
+    case reference_link_ends_column:
+        return sizeof( std::int32_t );
+    case flags_column:
+        return sizeof( std::uint8_t );
+    default:
+        throw std::runtime_error( "Error, observation data store column " + std::to_string( columnIndex ) + " not found" );
+    }
+}
+
+//! Function to read the store header, and (re)map the column files.
+void ObservationDataStore::readHeaderAndMapColumns( )
+{
+    const std::string headerFileName =
+            ( boost::filesystem::path( storeDirectory_ ) / observationDataStoreHeaderFileName ).string( );
+    std::ifstream headerFile( headerFileName.c_str( ), std::ios::binary );
+    if( !headerFile.is_open( ) )
+    {
+        throw std::runtime_error( "Error when reading observation data store, could not open file " + headerFileName );
+    }
+
+    // Check file identifier and version.
+    char fileIdentifier[ sizeof( observationDataStoreFileIdentifier ) ];
+    std::int32_t fileVersion = 0;
+    headerFile.read( fileIdentifier, sizeof( fileIdentifier ) );
+    headerFile.read( reinterpret_cast< char* >( &fileVersion ), sizeof( fileVersion ) );
+    if( !headerFile.good( ) ||
+            std::memcmp( fileIdentifier, observationDataStoreFileIdentifier, sizeof( fileIdentifier ) ) != 0 ||
+            fileVersion != observationDataStoreFileVersion )
+    {
+        throw std::runtime_error( "Error when reading observation data store, file " + headerFileName +
+                                  " is not a (compatible) observation data store header" );
+    }
+
+    // Read number of rows and link ends.
+    std::int64_t numberOfRows = 0;
+    std::vector< observation_models::LinkEnds > linkEndsList;
+    try
+    {
+        utilities::readFromBinaryStream( headerFile, numberOfRows );
+        const std::size_t numberOfLinkEnds = utilities::readSizeFromBinaryStream( headerFile );
+        for( std::size_t i = 0; i < numberOfLinkEnds; i++ )
+        {
+            const std::size_t numberOfLinkEndsEntries = utilities::readSizeFromBinaryStream( headerFile );
+
+            observation_models::LinkEnds currentLinkEnds;
+            for( std::size_t j = 0; j < numberOfLinkEndsEntries; j++ )
+            {
+                std::int32_t linkEndType = 0;
+                std::string bodyName, stationName;
+                utilities::readFromBinaryStream( headerFile, linkEndType );
+                utilities::readFromBinaryStream( headerFile, bodyName );
+                utilities::readFromBinaryStream( headerFile, stationName );
+                currentLinkEnds[ static_cast< observation_models::LinkEndType >( linkEndType ) ] =
+                        std::make_pair( bodyName, stationName );
+            }
+            linkEndsList.push_back( currentLinkEnds );
+        }
+    }
+    catch( std::runtime_error& )
+    {
+        numberOfRows = -1;
+    }
+
+    if( numberOfRows < 0 )
+    {
+        throw std::runtime_error( "Error when reading observation data store, header file " + headerFileName +
+                                  " is invalid" );
+    }
+    numberOfRows_ = numberOfRows;
+    linkEndsList_ = linkEndsList;
+
+    // Map committed part of each column file.
+    mappedColumns_.clear( );
+    if( numberOfRows_ > 0 )
+    {
+        for( int i = 0; i < number_of_columns; i++ )
+        {
+            const std::size_t columnSize = numberOfRows_ * getColumnEntrySize( i );
+            if( boost::filesystem::file_size( getColumnFileName( i ) ) < columnSize )
+            {
+                throw std::runtime_error( "Error when reading observation data store, file " + getColumnFileName( i ) +
+                                          " is truncated" );
+            }
+
+            boost::interprocess::file_mapping columnMapping( getColumnFileName( i ).c_str( ),
+                                                             boost::interprocess::read_only );
+            mappedColumns_.push_back(
+                        boost::interprocess::mapped_region( columnMapping, boost::interprocess::read_only, 0, columnSize ) );
+        }
+    }
+}
+
+//! Function to write the store header (replacing the existing one).
+void ObservationDataStore::writeHeader( const std::int64_t numberOfRows,
+                                        const std::vector< observation_models::LinkEnds >& linkEndsList )
+{
+    // Write header to temporary file, which then replaces the existing header.
+    const boost::filesystem::path headerFilePath =
+            boost::filesystem::path( storeDirectory_ ) / observationDataStoreHeaderFileName;
+    const boost::filesystem::path temporaryHeaderFilePath =
+            boost::filesystem::path( storeDirectory_ ) / ( observationDataStoreHeaderFileName + ".tmp" );
+    {
+        std::ofstream headerFile( temporaryHeaderFilePath.string( ).c_str( ), std::ios::binary | std::ios::trunc );
+        if( !headerFile.is_open( ) )
+        {
+            throw std::runtime_error( "Error when writing observation data store, could not open file " +
+                                      temporaryHeaderFilePath.string( ) );
+        }
+
+        headerFile.write( observationDataStoreFileIdentifier, sizeof( observationDataStoreFileIdentifier ) );
+        utilities::writeToBinaryStream( headerFile, observationDataStoreFileVersion );
+        utilities::writeToBinaryStream( headerFile, numberOfRows );
+        utilities::writeSizeToBinaryStream( headerFile, linkEndsList.size( ) );
+        for( unsigned int i = 0; i < linkEndsList.size( ); i++ )
+        {
+            utilities::writeSizeToBinaryStream( headerFile, linkEndsList.at( i ).size( ) );
+            for( auto linkEndIterator : linkEndsList.at( i ) )
+            {
+                utilities::writeToBinaryStream( headerFile, static_cast< std::int32_t >( linkEndIterator.first ) );
+                utilities::writeToBinaryStream( headerFile, linkEndIterator.second.first );
+                utilities::writeToBinaryStream( headerFile, linkEndIterator.second.second );
+            }
+        }
+
+        if( !headerFile.good( ) )
+        {
+            throw std::runtime_error( "Error when writing observation data store header " +
+                                      temporaryHeaderFilePath.string( ) );
+        }
+    }
+
+    boost::filesystem::rename( temporaryHeaderFilePath, headerFilePath );
+}
+
+} // namespace simulation_setup
+
+} // namespace tudat
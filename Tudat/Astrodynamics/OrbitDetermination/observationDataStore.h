@@ -0,0 +1,484 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Notes
+ *      An observation data store is a directory containing one binary file per column (observation times, values, weights,
+ *      link ends ids, observable types, reference link end types and flags), plus a header file with the number of
+ *      committed rows and the table of link ends referred to by the link ends ids. Each column file is a contiguous,
+ *      native-endian array, which is memory-mapped when the store is opened. New observations are appended to the end of
+ *      each column file, after which the header is replaced, so that an interrupted append leaves the store unchanged.
+ *
+ */
+
+#ifndef TUDAT_OBSERVATIONDATASTORE_H
+#define TUDAT_OBSERVATIONDATASTORE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/ObservationModels/linkTypeDefs.h"
+#include "Tudat/Astrodynamics/ObservationModels/observableTypes.h"
+#include "Tudat/Astrodynamics/OrbitDetermination/podInputOutputTypes.h"
+
+namespace tudat
+{
+
+namespace simulation_setup
+{
+
+//! Class for a columnar, memory-mapped, on-disk store of observation data.
+/*!
+ *  Class for a columnar, memory-mapped, on-disk store of observation data. The store contains one row per observation
+ *  entry (i.e. an observable of size n, such as a position observable, takes n subsequent rows of its observable type and
+ *  link ends, with identical time). The columns of all rows are accessible without copying, and rows may be appended
+ *  to the store (for instance, one tracking pass at a time).
+ *  The store is intended to be used by a single process at a time when appending; the memory-mapped columns
+ *  returned by this object remain valid until the next call to appendObservations.
+ */
+class ObservationDataStore
+{
+public:
+
+    //! Typedef for column of 8-bit integers in store.
+    typedef Eigen::Matrix< std::uint8_t, Eigen::Dynamic, 1 > ByteColumnType;
+
+    //! Typedef for column of 32-bit integers in store.
+    typedef Eigen::Matrix< std::int32_t, Eigen::Dynamic, 1 > IntegerColumnType;
+
+    //! Constructor, opens an existing store, or creates a new, empty store.
+    /*!
+     *  Constructor, opens an existing store, or creates a new, empty store.
+     *  \param storeDirectory Directory containing the store.
+     *  \param createIfMissing Boolean denoting whether an empty store is to be created if storeDirectory does not contain
+     *  a store. If false, an exception is thrown in that case.
+     */
+    ObservationDataStore( const std::string& storeDirectory, const bool createIfMissing = true );
+
+    //! Function to append a set of observations of a single observable type and set of link ends to the store
+    /*!
+     *  Function to append a set of observations of a single observable type and set of link ends to the store. The new rows
+     *  are written to the end of all column files, after which they are committed by updating the store header, and the
+     *  columns are mapped again (invalidating any column previously retrieved from this object).
+     *  \param observableType Type of observable.
+     *  \param linkEnds Link ends of observations.
+     *  \param referenceLinkEnd Link end at which the observation times are defined.
+     *  \param observationTimes Times of observations (one entry per observation, i.e. per observableSize rows).
+     *  \param observations Observation values (observableSize rows per observation).
+     *  \param weights Weights of observation values. If empty, unit weights are used.
+     *  \param flags Flags of observation values, which can be used to exclude observations when selecting data from the
+     *  store (see createPodInputFromObservationDataStore). If empty, no flags are set.
+     */
+    void appendObservations( const observation_models::ObservableType observableType,
+                             const observation_models::LinkEnds& linkEnds,
+                             const observation_models::LinkEndType referenceLinkEnd,
+                             const std::vector< double >& observationTimes,
+                             const Eigen::VectorXd& observations,
+                             const Eigen::VectorXd& weights = Eigen::VectorXd::Zero( 0 ),
+                             const std::vector< std::uint8_t >& flags = std::vector< std::uint8_t >( ) );
+
+    //! Function to retrieve the number of rows (observation entries) in the store.
+    /*!
+     *  Function to retrieve the number of rows (observation entries) in the store.
+     *  \return Number of rows (observation entries) in the store.
+     */
+    int getNumberOfRows( ) const
+    {
+        return static_cast< int >( numberOfRows_ );
+    }
+
+    //! Function to retrieve the (memory-mapped) column of observation times.
+    /*!
+     *  Function to retrieve the (memory-mapped) column of observation times.
+     *  \return Column of observation times.
+     */
+    Eigen::Map< const Eigen::VectorXd > getObservationTimes( ) const
+    {
+        return Eigen::Map< const Eigen::VectorXd >( getColumnData< double >( times_column ), getNumberOfRows( ) );
+    }
+
+    //! Function to retrieve the (memory-mapped) column of observation values.
+    /*!
+     *  Function to retrieve the (memory-mapped) column of observation values.
+     *  \return Column of observation values.
+     */
+    Eigen::Map< const Eigen::VectorXd > getObservations( ) const
+    {
+        return Eigen::Map< const Eigen::VectorXd >( getColumnData< double >( values_column ), getNumberOfRows( ) );
+    }
+
+    //! Function to retrieve the (memory-mapped) column of observation weights.
+    /*!
+     *  Function to retrieve the (memory-mapped) column of observation weights.
+     *  \return Column of observation weights.
+     */
+    Eigen::Map< const Eigen::VectorXd > getWeights( ) const
+    {
+        return Eigen::Map< const Eigen::VectorXd >( getColumnData< double >( weights_column ), getNumberOfRows( ) );
+    }
+
+    //! Function to retrieve the (memory-mapped) column of link ends ids (index in list returned by getLinkEndsList).
+    /*!
+     *  Function to retrieve the (memory-mapped) column of link ends ids (index in list returned by getLinkEndsList).
+     *  \return Column of link ends ids.
+     */
+    Eigen::Map< const IntegerColumnType > getLinkEndsIds( ) const
+    {
+        return Eigen::Map< const IntegerColumnType >(
+                    getColumnData< std::int32_t >( link_ends_ids_column ), getNumberOfRows( ) );
+    }
+
+    //! Function to retrieve the (memory-mapped) column of observable types.
+    /*!
+     *  Function to retrieve the (memory-mapped) column of observable types (as values of ObservableType enum).
+     *  \return Column of observable types.
+     */
+    Eigen::Map< const IntegerColumnType > getObservableTypes( ) const
+    {
+        return Eigen::Map< const IntegerColumnType >(
+                    getColumnData< std::int32_t >( observable_types_column ), getNumberOfRows( ) );
+    }
+
+    //! Function to retrieve the (memory-mapped) column of reference link end types.
+    /*!
+     *  Function to retrieve the (memory-mapped) column of reference link end types (as values of LinkEndType enum).
+     *  \return Column of reference link end types.
+     */
+    Eigen::Map< const IntegerColumnType > getReferenceLinkEnds( ) const
+    {
+        return Eigen::Map< const IntegerColumnType >(
+                    getColumnData< std::int32_t >( reference_link_ends_column ), getNumberOfRows( ) );
+    }
+
+    //! Function to retrieve the (memory-mapped) column of observation flags.
+    /*!
+     *  Function to retrieve the (memory-mapped) column of observation flags.
+     *  \return Column of observation flags.
+     */
+    Eigen::Map< const ByteColumnType > getFlags( ) const
+    {
+        return Eigen::Map< const ByteColumnType >( getColumnData< std::uint8_t >( flags_column ), getNumberOfRows( ) );
+    }
+
+    //! Function to retrieve the list of link ends referred to by the link ends ids.
+    /*!
+     *  Function to retrieve the list of link ends referred to by the link ends ids.
+     *  \return List of link ends referred to by the link ends ids.
+     */
+    const std::vector< observation_models::LinkEnds >& getLinkEndsList( ) const
+    {
+        return linkEndsList_;
+    }
+
+    //! Function to retrieve the directory containing the store.
+    /*!
+     *  Function to retrieve the directory containing the store.
+     *  \return Directory containing the store.
+     */
+    std::string getStoreDirectory( ) const
+    {
+        return storeDirectory_;
+    }
+
+private:
+
+    //! Identifiers of the columns in the store.
+    enum ObservationDataStoreColumns
+    {
+        times_column = 0,
+        values_column = 1,
+        weights_column = 2,
+        link_ends_ids_column = 3,
+        observable_types_column = 4,
+        reference_link_ends_column = 5,
+        flags_column = 6,
+        number_of_columns = 7
+    };
+
+    //! Function to retrieve the name of the file containing a given column.
+    std::string getColumnFileName( const int columnIndex ) const;
+
+    //! Function to retrieve the size (in bytes) of a single entry of a given column.
+    static std::size_t getColumnEntrySize( const int columnIndex );
+
+    //! Function to read the store header, and (re)map the column files.
+    void readHeaderAndMapColumns( );
+
+    //! Function to write the store header (replacing the existing one), committing the given number of rows and link ends.
+    void writeHeader( const std::int64_t numberOfRows, const std::vector< observation_models::LinkEnds >& linkEndsList );
+
+    //! Function to retrieve the pointer to the start of a column (nullptr if store is empty).
+    template< typename ColumnScalarType >
+    const ColumnScalarType* getColumnData( const int columnIndex ) const
+    {
+        return ( numberOfRows_ == 0 ) ? nullptr :
+                                        static_cast< const ColumnScalarType* >( mappedColumns_.at( columnIndex ).get_address( ) );
+    }
+
+    //! Directory containing the store.
+    std::string storeDirectory_;
+
+    //! Number of rows that are committed to the store.
+    std::int64_t numberOfRows_;
+
+    //! List of link ends referred to by the link ends ids.
+    std::vector< observation_models::LinkEnds > linkEndsList_;
+
+    //! Memory-mapped regions of the column files (one per column).
+    std::vector< boost::interprocess::mapped_region > mappedColumns_;
+
+};
+
+//! Function to append a complete set of observation data (as used in PodInput) to an observation data store.
+/*!
+ *  Function to append a complete set of observation data (as used in PodInput) to an observation data store, with one call
+ *  to ObservationDataStore::appendObservations per observable type and set of link ends. Observation times and values are
+ *  stored as double.
+ *  \param dataStore Store to which the observations are to be appended.
+ *  \param observationsAndTimes Total data structure of observations and associated times/link ends/type
+ *  \param weightsMatrixDiagonals Weights of observations, sorted by observable type and link ends. If empty, unit weights are
+ *  used.
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+void appendPodInputDataToObservationDataStore(
+        const std::shared_ptr< ObservationDataStore > dataStore,
+        const typename PodInput< ObservationScalarType, TimeType >::PodInputDataType& observationsAndTimes,
+        const std::map< observation_models::ObservableType, std::map< observation_models::LinkEnds, Eigen::VectorXd > >&
+        weightsMatrixDiagonals =
+        std::map< observation_models::ObservableType, std::map< observation_models::LinkEnds, Eigen::VectorXd > >( ) )
+{
+    for( const auto& observablesIterator : observationsAndTimes )
+    {
+        for( const auto& dataIterator : observablesIterator.second )
+        {
+            std::vector< double > observationTimes;
+            observationTimes.reserve( dataIterator.second.second.first.size( ) );
+            for( unsigned int i = 0; i < dataIterator.second.second.first.size( ); i++ )
+            {
+                observationTimes.push_back( static_cast< double >( dataIterator.second.second.first.at( i ) ) );
+            }
+
+            Eigen::VectorXd currentWeights = Eigen::VectorXd::Zero( 0 );
+            if( weightsMatrixDiagonals.count( observablesIterator.first ) > 0 &&
+                    weightsMatrixDiagonals.at( observablesIterator.first ).count( dataIterator.first ) > 0 )
+            {
+                currentWeights = weightsMatrixDiagonals.at( observablesIterator.first ).at( dataIterator.first );
+            }
+
+            dataStore->appendObservations(
+                        observablesIterator.first, dataIterator.first, dataIterator.second.second.second,
+                        observationTimes, dataIterator.second.first.template cast< double >( ), currentWeights );
+        }
+    }
+}
+
+//! Function to create the input to the orbit determination from (a selection of) the data in an observation data store.
+/*!
+ *  Function to create the input to the orbit determination from (a selection of) the data in an observation data store.
+ *  The selected rows are gathered per observable type and set of link ends in a single pass over the (memory-mapped)
+ *  columns, in the order in which they were appended to the store. The weights of the selected observations are taken
+ *  from the store. The rows of a single multi-dimensional observation are selected or excluded together, based on the
+ *  time and flags of the first of these rows.
+ *  \param dataStore Store from which observations are to be retrieved.
+ *  \param numberOfEstimatedParameters Size of vector of estimated parameters
+ *  \param startTime Time from which observations are to be selected
+ *  \param endTime Time up to which observations are to be selected
+ *  \param observableTypes List of observable types that are to be selected. All observable types are selected if empty.
+ *  \param excludedFlags Bit mask of flags for which an observation is excluded (all flags by default).
+ *  \param inverseOfAprioriCovariance A priori covariance matrix (unnormalized) of estimated parameters. None (matrix of
+ *  size 0) by default
+ *  \param initialParameterDeviationEstimate Correction to estimated parameter vector to be applied on first iteration.
+ *  None (vector of size 0) by default
+ *  \return Input to the orbit determination, with observations and weights from the store.
+ */
+template< typename ObservationScalarType = double, typename TimeType = double >
+std::shared_ptr< PodInput< ObservationScalarType, TimeType > > createPodInputFromObservationDataStore(
+        const std::shared_ptr< ObservationDataStore > dataStore,
+        const int numberOfEstimatedParameters,
+        const double startTime = -std::numeric_limits< double >::infinity( ),
+        const double endTime = std::numeric_limits< double >::infinity( ),
+        const std::vector< observation_models::ObservableType >& observableTypes =
+        std::vector< observation_models::ObservableType >( ),
+        const std::uint8_t excludedFlags = std::numeric_limits< std::uint8_t >::max( ),
+        const Eigen::MatrixXd inverseOfAprioriCovariance = Eigen::MatrixXd::Zero( 0, 0 ),
+        const Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > initialParameterDeviationEstimate =
+        Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >::Zero( 0, 1 ) )
+{
+    using namespace observation_models;
+
+    typedef typename PodInput< ObservationScalarType, TimeType >::PodInputDataType PodInputDataType;
+
+    const int numberOfRows = dataStore->getNumberOfRows( );
+    Eigen::Map< const Eigen::VectorXd > storedTimes = dataStore->getObservationTimes( );
+    Eigen::Map< const Eigen::VectorXd > storedObservations = dataStore->getObservations( );
+    Eigen::Map< const Eigen::VectorXd > storedWeights = dataStore->getWeights( );
+    Eigen::Map< const ObservationDataStore::IntegerColumnType > storedLinkEndsIds = dataStore->getLinkEndsIds( );
+    Eigen::Map< const ObservationDataStore::IntegerColumnType > storedObservableTypes = dataStore->getObservableTypes( );
+    Eigen::Map< const ObservationDataStore::IntegerColumnType > storedReferenceLinkEnds = dataStore->getReferenceLinkEnds( );
+    Eigen::Map< const ObservationDataStore::ByteColumnType > storedFlags = dataStore->getFlags( );
+
+    // Assign index to each combination of observable type and link ends id. Since rows are appended per observable type
+    // and link ends, the index of the previous row is reused whenever possible.
+    std::map< std::pair< int, int >, int > blockIndices;
+    std::vector< int > rowBlockIndices( numberOfRows );
+    for( int i = 0; i < numberOfRows; i++ )
+    {
+        if( i > 0 && storedObservableTypes( i ) == storedObservableTypes( i - 1 ) &&
+                storedLinkEndsIds( i ) == storedLinkEndsIds( i - 1 ) )
+        {
+            rowBlockIndices[ i ] = rowBlockIndices[ i - 1 ];
+        }
+        else
+        {
+            std::pair< int, int > currentBlock = std::make_pair( storedObservableTypes( i ), storedLinkEndsIds( i ) );
+            if( blockIndices.count( currentBlock ) == 0 )
+            {
+                int newBlockIndex = blockIndices.size( );
+                blockIndices[ currentBlock ] = newBlockIndex;
+            }
+            rowBlockIndices[ i ] = blockIndices.at( currentBlock );
+        }
+    }
+
+    // Retrieve properties of each block
+    const int numberOfBlocks = blockIndices.size( );
+    std::vector< ObservableType > blockObservableTypes( numberOfBlocks );
+    std::vector< int > blockObservableSizes( numberOfBlocks );
+    std::vector< int > blockLinkEndsIds( numberOfBlocks );
+    std::vector< bool > isBlockSelected( numberOfBlocks, observableTypes.size( ) == 0 );
+    for( const auto& blockIterator : blockIndices )
+    {
+        blockObservableTypes[ blockIterator.second ] = static_cast< ObservableType >( blockIterator.first.first );
+        blockObservableSizes[ blockIterator.second ] = getObservableSize( blockObservableTypes[ blockIterator.second ] );
+        blockLinkEndsIds[ blockIterator.second ] = blockIterator.first.second;
+        if( std::find( observableTypes.begin( ), observableTypes.end( ),
+                       blockObservableTypes[ blockIterator.second ] ) != observableTypes.end( ) )
+        {
+            isBlockSelected[ blockIterator.second ] = true;
+        }
+    }
+
+    // Determine selected rows, handling each multi-dimensional observation as a whole.
+    std::vector< bool > isRowSelected( numberOfRows, false );
+    std::vector< int > numberOfRowsInBlock( numberOfBlocks, 0 );
+    std::vector< int > numberOfSelectedRows( numberOfBlocks, 0 );
+    std::vector< int > blockReferenceLinkEnds( numberOfBlocks, 0 );
+    std::vector< bool > isBlockReferenceLinkEndSet( numberOfBlocks, false );
+    std::vector< bool > isCurrentObservationSelected( numberOfBlocks, false );
+    for( int i = 0; i < numberOfRows; i++ )
+    {
+        const int currentBlock = rowBlockIndices[ i ];
+        if( !isBlockSelected[ currentBlock ] )
+        {
+            continue;
+        }
+
+        if( !isBlockReferenceLinkEndSet[ currentBlock ] )
+        {
+            blockReferenceLinkEnds[ currentBlock ] = storedReferenceLinkEnds( i );
+            isBlockReferenceLinkEndSet[ currentBlock ] = true;
+        }
+        else if( blockReferenceLinkEnds[ currentBlock ] != storedReferenceLinkEnds( i ) )
+        {
+            throw std::runtime_error( "Error when creating POD input from observation data store, reference link end is "
+                                      "not unique for observable " + std::to_string( storedObservableTypes( i ) ) +
+                                      " and link ends " + getLinkEndsString(
+                                          dataStore->getLinkEndsList( ).at( storedLinkEndsIds( i ) ) ) );
+        }
+
+        if( numberOfRowsInBlock[ currentBlock ] % blockObservableSizes[ currentBlock ] == 0 )
+        {
+            isCurrentObservationSelected[ currentBlock ] =
+                    ( storedTimes( i ) >= startTime ) && ( storedTimes( i ) <= endTime ) &&
+                    ( ( storedFlags( i ) & excludedFlags ) == 0 );
+        }
+        numberOfRowsInBlock[ currentBlock ]++;
+
+        if( isCurrentObservationSelected[ currentBlock ] )
+        {
+            isRowSelected[ i ] = true;
+            numberOfSelectedRows[ currentBlock ]++;
+        }
+    }
+
+    // Allocate data for selected observations
+    PodInputDataType observationsAndTimes;
+    std::map< ObservableType, std::map< LinkEnds, Eigen::VectorXd > > weightsMatrixDiagonals;
+    std::vector< Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 >* > blockObservations( numberOfBlocks, nullptr );
+    std::vector< std::vector< TimeType >* > blockTimes( numberOfBlocks, nullptr );
+    std::vector< Eigen::VectorXd* > blockWeights( numberOfBlocks, nullptr );
+    for( int j = 0; j < numberOfBlocks; j++ )
+    {
+        if( numberOfSelectedRows[ j ] == 0 )
+        {
+            continue;
+        }
+
+        const LinkEnds& currentLinkEnds = dataStore->getLinkEndsList( ).at( blockLinkEndsIds[ j ] );
+        if( numberOfSelectedRows[ j ] % blockObservableSizes[ j ] != 0 )
+        {
+            throw std::runtime_error( "Error when creating POD input from observation data store, number of rows for "
+                                      "observable " + std::to_string( blockObservableTypes[ j ] ) + " and link ends " +
+                                      getLinkEndsString( currentLinkEnds ) + " is inconsistent with observable size" );
+        }
+
+        auto& currentData = observationsAndTimes[ blockObservableTypes[ j ] ][ currentLinkEnds ];
+        currentData.first.resize( numberOfSelectedRows[ j ] );
+        currentData.second.first.reserve( numberOfSelectedRows[ j ] / blockObservableSizes[ j ] );
+        currentData.second.second = static_cast< LinkEndType >( blockReferenceLinkEnds[ j ] );
+        blockObservations[ j ] = &currentData.first;
+        blockTimes[ j ] = &currentData.second.first;
+
+        Eigen::VectorXd& currentWeights = weightsMatrixDiagonals[ blockObservableTypes[ j ] ][ currentLinkEnds ];
+        currentWeights.resize( numberOfSelectedRows[ j ] );
+        blockWeights[ j ] = &currentWeights;
+    }
+
+    // Gather selected rows
+    std::vector< int > currentIndexInBlock( numberOfBlocks, 0 );
+    for( int i = 0; i < numberOfRows; i++ )
+    {
+        if( isRowSelected[ i ] )
+        {
+            const int currentBlock = rowBlockIndices[ i ];
+            int& currentIndex = currentIndexInBlock[ currentBlock ];
+
+            ( *blockObservations[ currentBlock ] )( currentIndex ) =
+                    static_cast< ObservationScalarType >( storedObservations( i ) );
+            ( *blockWeights[ currentBlock ] )( currentIndex ) = storedWeights( i );
+            if( currentIndex % blockObservableSizes[ currentBlock ] == 0 )
+            {
+                blockTimes[ currentBlock ]->push_back( static_cast< TimeType >( storedTimes( i ) ) );
+            }
+            currentIndex++;
+        }
+    }
+
+    std::shared_ptr< PodInput< ObservationScalarType, TimeType > > podInput =
+            std::make_shared< PodInput< ObservationScalarType, TimeType > >(
+                observationsAndTimes, numberOfEstimatedParameters, inverseOfAprioriCovariance,
+                initialParameterDeviationEstimate );
+    podInput->setWeightsMatrixDiagonals( weightsMatrixDiagonals );
+    return podInput;
+}
+
+} // namespace simulation_setup
+
+} // namespace tudat
+
+#endif // TUDAT_OBSERVATIONDATASTORE_H
@@ -11,6 +11,7 @@
 #ifndef TUDAT_PODINPUTOUTPUTTYPES_H
 #define TUDAT_PODINPUTOUTPUTTYPES_H
 
+#include <functional>
 #include <map>
 #include <vector>
 #include <iostream>
@@ -20,8 +21,10 @@
 #include <Eigen/LU>
 
 #include "Tudat/Basics/timeType.h"
+#include "Tudat/Mathematics/BasicMathematics/leastSquaresEstimation.h"
 #include "Tudat/Astrodynamics/ObservationModels/linkTypeDefs.h"
 #include "Tudat/Astrodynamics/ObservationModels/observableTypes.h"
+#include "Tudat/Astrodynamics/OrbitDetermination/EstimatableParameters/estimatableParameter.h"
 
 namespace tudat
 {
@@ -29,6 +32,66 @@ namespace tudat
 namespace simulation_setup
 {
 
+//! Settings for process noise on arc-wise estimated parameters, used when estimating with a Householder least squares solution
+/*!
+ *  Settings for process noise on arc-wise estimated parameters, used when estimating with a Householder least squares solution.
+ *  The values p_k and p_k+1 of each entry of the parameter in two consecutive arcs (starting at times t_k and t_k+1) are
+ *  modelled as a first-order Gauss-Markov process: p_k+1 = m_k * p_k + w_k, with m_k = exp( -( t_k+1 - t_k ) / tau ) and
+ *  w_k white noise with variance ( 1 - m_k^2 ) * sigma^2, where sigma is the steady-state standard deviation and tau the
+ *  correlation time of the process. This relation is added as a pseudo-observation in the time update at t_k+1, i.e. after
+ *  the observations before t_k+1 and before those after t_k+1 have been processed (see
+ *  PodInput::defineHouseholderLeastSquaresSettings). The values of the parameter in all arcs remain estimated, so that the
+ *  final result corresponds to a smoothed, rather than a filtered, solution.
+ */
+class ArcWiseProcessNoiseSettings
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor
+     * \param standardDeviation Steady-state standard deviation sigma of the process (in units of the parameter)
+     * \param correlationTime Correlation time tau of the process
+     */
+    ArcWiseProcessNoiseSettings( const double standardDeviation, const double correlationTime ):
+        standardDeviation_( standardDeviation ), correlationTime_( correlationTime )
+    {
+        if( !( standardDeviation_ > 0.0 ) || !( correlationTime_ > 0.0 ) )
+        {
+            throw std::runtime_error( "Error when creating arc-wise process noise settings, standard deviation and correlation "
+                                      "time must be positive" );
+        }
+    }
+
+    //! Function to retrieve the steady-state standard deviation of the process
+    /*!
+     * Function to retrieve the steady-state standard deviation of the process
+     * \return Steady-state standard deviation of the process
+     */
+    double getStandardDeviation( )
+    {
+        return standardDeviation_;
+    }
+
+    //! Function to retrieve the correlation time of the process
+    /*!
+     * Function to retrieve the correlation time of the process
+     * \return Correlation time of the process
+     */
+    double getCorrelationTime( )
+    {
+        return correlationTime_;
+    }
+
+private:
+
+    //! Steady-state standard deviation of the process
+    double standardDeviation_;
+
+    //! Correlation time of the process
+    double correlationTime_;
+};
+
 //! Data structure used to provide input to orbit determination procedure
 template< typename ObservationScalarType = double, typename TimeType = double >
 class PodInput
@@ -68,7 +131,9 @@ public:
         saveInformationMatrix_( true ),
         printOutput_( true ),
         saveResidualsAndParametersFromEachIteration_( true ),
-        saveStateHistoryForEachIteration_( false )
+        saveStateHistoryForEachIteration_( false ),
+        useHouseholderLeastSquares_( false ),
+        exploitArcWiseBlockStructure_( false )
     {
         if( inverseOfAprioriCovariance_.rows( ) == 0 )
         {
@@ -189,6 +254,40 @@ public:
         }
     }
 
+    //! Function to set the values of all observation weights individually
+    /*!
+     * Function to set the values of all observation weights individually, sorted by observable type and link ends. Weights
+     * must be provided for each observable type and set of link ends in the observation data, with one entry per observation.
+     * \param weightsMatrixDiagonals Values for observation weights, sorted by observable type and link ends
+     */
+    void setWeightsMatrixDiagonals(
+            const std::map< observation_models::ObservableType,
+            std::map< observation_models::LinkEnds, Eigen::VectorXd > >& weightsMatrixDiagonals )
+    {
+        for( typename PodInputDataType::const_iterator observablesIterator = observationsAndTimes_.begin( );
+             observablesIterator != observationsAndTimes_.end( ); observablesIterator++ )
+        {
+            for( typename SingleObservablePodInputType::const_iterator dataIterator =
+                 observablesIterator->second.begin( ); dataIterator != observablesIterator->second.end( ); dataIterator++  )
+            {
+                if( weightsMatrixDiagonals.count( observablesIterator->first ) == 0 ||
+                        weightsMatrixDiagonals.at( observablesIterator->first ).count( dataIterator->first ) == 0 )
+                {
+                    throw std::runtime_error( "Error when setting weights, no weights found for observable " +
+                                              std::to_string( observablesIterator->first ) + " and link ends " +
+                                              observation_models::getLinkEndsString( dataIterator->first ) );
+                }
+                else if( weightsMatrixDiagonals.at( observablesIterator->first ).at( dataIterator->first ).rows( ) !=
+                         dataIterator->second.first.rows( ) )
+                {
+                    throw std::runtime_error( "Error when setting weights, number of weights is inconsistent for observable " +
+                                              std::to_string( observablesIterator->first ) );
+                }
+            }
+        }
+        weightsMatrixDiagonals_ = weightsMatrixDiagonals;
+    }
+
     //! Function to define specific settings for estimation process
     /*!
      *  Function to define specific settings for estimation process
@@ -196,7 +295,8 @@ public:
      *  be reintegrated on first iteration, or if existing values are to be used to perform first iteration.
      *  \param reintegrateVariationalEquations Boolean denoting whether the variational equations are to be reintegrated during
      *  estimation
-     *  \param saveInformationMatrix Boolean denoting whether to save the partials matrix in the output
+     *  \param saveInformationMatrix Boolean denoting whether to save the partials matrix in the output. If false, the full
+     *  partials matrix is never stored; instead, the normal equations are accumulated per observable type and link ends.
      *  \param printOutput Boolean denoting whether to print output to th terminal when running the estimation.
      *  \param saveResidualsAndParametersFromEachIteration Boolean denoting whether the residuals and parameters from the each
      *  iteration are to be saved
@@ -217,6 +317,71 @@ public:
         saveStateHistoryForEachIteration_ = saveStateHistoryForEachIteration;
     }
 
+    //! Function to define whether the least squares problem is to be solved by Householder transformations
+    /*!
+     *  Function to define whether the least squares problem is to be solved by Householder transformations, as in a
+     *  square-root information filter. In this case, the observations are processed sequentially in time: the time span of
+     *  the observations is divided into intervals by the time update epochs, and the observations are added interval by
+     *  interval to a running upper-triangular square-root information matrix R (and transformed residuals) by Householder
+     *  transformations, instead of forming and inverting the normal matrix. At each time update epoch, after all observations
+     *  before it have been added, the time update is applied to R: the process noise pseudo-observations of the arcs that
+     *  start at this epoch (see ArcWiseProcessNoiseSettings), followed by the (optional) timeUpdateFunction. The full
+     *  partials matrix is not stored, irrespective of the saveInformationMatrix setting. Since all estimated parameters are
+     *  defined at the initial epoch (or per arc), no mapping of R is needed between the epochs, and the result after
+     *  processing all observations is the smoothed solution.
+     *  \param useHouseholderLeastSquares Boolean denoting whether the Householder least squares solution is to be used
+     *  \param arcWiseProcessNoiseSettings Settings for process noise on arc-wise parameters (empirical accelerations and
+     *  observation biases), per parameter type. The process noise is applied to all estimated parameters of a given type, as
+     *  pseudo-observations relating the parameter values in consecutive arcs (see ArcWiseProcessNoiseSettings). The start
+     *  times of these arcs (except the first) are time update epochs.
+     *  \param timeUpdateEpochs Additional epochs at which a time update is applied (i.e. at which the timeUpdateFunction is
+     *  called), empty by default.
+     *  \param timeUpdateFunction Function that is called at each of the timeUpdateEpochs (in increasing order) with the
+     *  epoch and the running solver, for instance to add pseudo-observations representing process noise with
+     *  HouseholderLeastSquaresSolver::addObservationBlock (in terms of the unnormalized parameter corrections). Empty by
+     *  default.
+     */
+    void defineHouseholderLeastSquaresSettings(
+            const bool useHouseholderLeastSquares = true,
+            const std::map< estimatable_parameters::EstimatebleParametersEnum,
+            std::shared_ptr< ArcWiseProcessNoiseSettings > >& arcWiseProcessNoiseSettings =
+            std::map< estimatable_parameters::EstimatebleParametersEnum, std::shared_ptr< ArcWiseProcessNoiseSettings > >( ),
+            const std::vector< double >& timeUpdateEpochs = std::vector< double >( ),
+            const std::function< void( const double, linear_algebra::HouseholderLeastSquaresSolver& ) > timeUpdateFunction =
+            std::function< void( const double, linear_algebra::HouseholderLeastSquaresSolver& ) >( ) )
+    {
+        if( !useHouseholderLeastSquares && ( arcWiseProcessNoiseSettings.size( ) > 0 || timeUpdateEpochs.size( ) > 0 ) )
+        {
+            throw std::runtime_error( "Error when defining Householder least squares settings, process noise and time updates "
+                                      "can only be used with Householder least squares solution" );
+        }
+        else if( timeUpdateEpochs.size( ) > 0 && !timeUpdateFunction )
+        {
+            throw std::runtime_error( "Error when defining Householder least squares settings, time update epochs provided, "
+                                      "but no time update function" );
+        }
+        useHouseholderLeastSquares_ = useHouseholderLeastSquares;
+        arcWiseProcessNoiseSettings_ = arcWiseProcessNoiseSettings;
+        timeUpdateEpochs_ = timeUpdateEpochs;
+        timeUpdateFunction_ = timeUpdateFunction;
+    }
+
+    //! Function to define whether the arc-wise block structure of the normal equations is exploited when solving them
+    /*!
+     *  Function to define whether the arc-wise block structure of the normal equations is exploited when solving them. In this
+     *  case, the arc-wise estimated parameters (multi-arc initial states, arc-wise drag/radiation pressure/empirical
+     *  acceleration coefficients and arc-wise observation biases) of each arc are eliminated from the normal equations using
+     *  a Schur complement, and the resulting system is solved for the remaining (global) parameters only. The covariance
+     *  matrix is then only computed when requested from the PodOutput. Not used when the Householder least squares solution
+     *  is used, or when the estimated parameters are subject to linear constraints.
+     *  \param exploitArcWiseBlockStructure Boolean denoting whether the arc-wise block structure of the normal equations is
+     *  exploited when solving them
+     */
+    void defineNormalEquationsSolverSettings( const bool exploitArcWiseBlockStructure = true )
+    {
+        exploitArcWiseBlockStructure_ = exploitArcWiseBlockStructure;
+    }
+
     //! Function to return the total data structure of observations and associated times/link ends/type (by reference)
     /*!
      * Function to return the total data structure of observations and associated times/link ends/type (by reference)
@@ -320,6 +485,58 @@ public:
         return saveStateHistoryForEachIteration_;
     }
 
+    //! Function to return the boolean denoting whether the least squares problem is solved by Householder transformations
+    /*!
+     * Function to return the boolean denoting whether the least squares problem is to be solved by Householder transformations
+     * \return Boolean denoting whether the least squares problem is to be solved by Householder transformations
+     */
+    bool getUseHouseholderLeastSquares( )
+    {
+        return useHouseholderLeastSquares_;
+    }
+
+    //! Function to return the settings for process noise on arc-wise parameters, per parameter type
+    /*!
+     * Function to return the settings for process noise on arc-wise parameters, per parameter type
+     * \return Settings for process noise on arc-wise parameters, per parameter type
+     */
+    std::map< estimatable_parameters::EstimatebleParametersEnum, std::shared_ptr< ArcWiseProcessNoiseSettings > >&
+    getArcWiseProcessNoiseSettings( )
+    {
+        return arcWiseProcessNoiseSettings_;
+    }
+
+    //! Function to return the additional epochs at which a time update is applied
+    /*!
+     * Function to return the additional epochs at which a time update is applied (i.e. at which the timeUpdateFunction_ is
+     * called)
+     * \return Additional epochs at which a time update is applied
+     */
+    std::vector< double > getTimeUpdateEpochs( )
+    {
+        return timeUpdateEpochs_;
+    }
+
+    //! Function to return the function that is called at each of the additional time update epochs
+    /*!
+     * Function to return the function that is called at each of the additional time update epochs
+     * \return Function that is called at each of the additional time update epochs
+     */
+    std::function< void( const double, linear_algebra::HouseholderLeastSquaresSolver& ) > getTimeUpdateFunction( )
+    {
+        return timeUpdateFunction_;
+    }
+
+    //! Function to return the boolean denoting whether the arc-wise block structure of the normal equations is exploited
+    /*!
+     * Function to return the boolean denoting whether the arc-wise block structure of the normal equations is exploited
+     * \return Boolean denoting whether the arc-wise block structure of the normal equations is exploited
+     */
+    bool getExploitArcWiseBlockStructure( )
+    {
+        return exploitArcWiseBlockStructure_;
+    }
+
 private:
     //! Total data structure of observations and associated times/link ends/type
     PodInputDataType observationsAndTimes_;
@@ -340,7 +557,7 @@ private:
     //! Boolean denoting whether the variational equations are to be reintegrated during estimation
     bool reintegrateVariationalEquations_;
 
-    //! Boolean denoting whether to print output to th terminal when running the estimation.
+    //! Boolean denoting whether to save the partials matrix in the output (if false, normal equations are accumulated block-wise)
     bool saveInformationMatrix_;
 
     //! Boolean denoting whether to print output to th terminal when running the estimation.
@@ -352,6 +569,22 @@ private:
     //! Boolean denoting whether the state history is to be saved on each iteration.
     bool saveStateHistoryForEachIteration_;
 
+    //! Boolean denoting whether the least squares problem is to be solved by Householder transformations
+    bool useHouseholderLeastSquares_;
+
+    //! Settings for process noise on arc-wise parameters, per parameter type
+    std::map< estimatable_parameters::EstimatebleParametersEnum, std::shared_ptr< ArcWiseProcessNoiseSettings > >
+    arcWiseProcessNoiseSettings_;
+
+    //! Additional epochs at which a time update is applied
+    std::vector< double > timeUpdateEpochs_;
+
+    //! Function that is called at each of the additional time update epochs
+    std::function< void( const double, linear_algebra::HouseholderLeastSquaresSolver& ) > timeUpdateFunction_;
+
+    //! Boolean denoting whether the arc-wise block structure of the normal equations is exploited when solving them
+    bool exploitArcWiseBlockStructure_;
+
 };
 
 //! Class that is used during the orbit determination/parameter estimation to determine whether the estimation is converged.
@@ -505,6 +738,12 @@ struct PodOutput
      */
     Eigen::MatrixXd getUnnormalizedCovarianceMatrix( )
     {
+        if( normalEquationsSolver_ != nullptr )
+        {
+            Eigen::VectorXd inverseTransformationDiagonal = informationMatrixTransformationDiagonal_.cwiseInverse( );
+            return inverseTransformationDiagonal.asDiagonal( ) * normalEquationsSolver_->getCovarianceMatrix( ) *
+                    inverseTransformationDiagonal.asDiagonal( );
+        }
         return getUnnormalizedInverseCovarianceMatrix( ).inverse( );
     }
 
@@ -515,6 +754,11 @@ struct PodOutput
      */
     Eigen::VectorXd getFormalErrorVector( )
     {
+        if( normalEquationsSolver_ != nullptr )
+        {
+            return normalEquationsSolver_->getCovarianceMatrixDiagonal( ).cwiseSqrt( ).cwiseQuotient(
+                        informationMatrixTransformationDiagonal_.cwiseAbs( ) );
+        }
         return ( getUnnormalizedCovarianceMatrix( ).diagonal( ) ).cwiseSqrt( );
     }
 
@@ -589,6 +833,18 @@ struct PodOutput
         dynamicsHistoryPerIteration_ = dynamicsHistoryPerIteration;
         dependentVariableHistoryPerIteration_ = dependentVariableHistoryPerIteration;
     }
+
+    //! Function to set the solver of the block-arrowhead normal equations used in the final estimation iteration
+    /*!
+     * Function to set the solver of the block-arrowhead normal equations used in the final estimation iteration, from which
+     * the (marginal) covariances are computed when requested, instead of inverting the full inverse covariance matrix
+     * \param normalEquationsSolver Solver of the (normalized) normal equations used in the final estimation iteration
+     */
+    void setNormalEquationsSolver(
+            const std::shared_ptr< linear_algebra::BlockArrowheadNormalEquationsSolver > normalEquationsSolver )
+    {
+        normalEquationsSolver_ = normalEquationsSolver;
+    }
     //! Vector of estimated parameter values.
     Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > parameterEstimate_;
 
@@ -627,6 +883,9 @@ struct PodOutput
 
     //! Boolean denoting whether an exception was caught during (re)propagation of equations of motion (and variational equations)
     bool exceptionDuringPropagation_;
+
+    //! Solver of the (normalized) block-arrowhead normal equations used in the final iteration (nullptr if not used)
+    std::shared_ptr< linear_algebra::BlockArrowheadNormalEquationsSolver > normalEquationsSolver_;
 };
 
 
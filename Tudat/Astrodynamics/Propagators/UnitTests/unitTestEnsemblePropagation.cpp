@@ -0,0 +1,264 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <limits>
+#include <string>
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Basics/testMacros.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/keplerPropagator.h"
+#include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/createBodies.h"
+#include "Tudat/SimulationSetup/PropagationSetup/createAccelerationModels.h"
+#include "Tudat/SimulationSetup/PropagationSetup/ensembleDynamicsSimulator.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace numerical_integrators;
+using namespace simulation_setup;
+using namespace basic_astrodynamics;
+using namespace orbital_element_conversions;
+using namespace propagators;
+
+BOOST_AUTO_TEST_SUITE( test_ensemble_propagation )
+
+//! Test ensemble propagation of Kepler orbits with varying initial state and gravitational parameter, by comparing
+//! to analytical solution, and comparing results for different numbers of threads.
+BOOST_AUTO_TEST_CASE( testKeplerEnsemblePropagation )
+{
+    double earthGravitationalParameter = 3.986004418E14;
+    double initialTime = 0.0;
+    double finalTime = 6.0 * 3600.0;
+
+    Eigen::Vector6d nominalKeplerElements;
+    nominalKeplerElements << 7.0E6, 0.01, 0.5, 1.0, 2.0, 0.3;
+    Eigen::VectorXd nominalInitialState = convertKeplerianToCartesianElements(
+                nominalKeplerElements, earthGravitationalParameter );
+
+    // Define function to create the environment and dynamics simulator for a single thread
+    std::function< std::shared_ptr< EnsembleMemberSimulator< double, double > >( ) > memberSimulatorCreationFunction =
+            [ & ]( )
+    {
+        // Create environment
+        std::map< std::string, std::shared_ptr< BodySettings > > bodySettings;
+        bodySettings[ "Earth" ] = std::make_shared< BodySettings >( );
+        bodySettings[ "Earth" ]->ephemerisSettings = std::make_shared< ConstantEphemerisSettings >(
+                    Eigen::Vector6d::Zero( ), "SSB", "ECLIPJ2000" );
+        bodySettings[ "Earth" ]->gravityFieldSettings =
+                std::make_shared< CentralGravityFieldSettings >( earthGravitationalParameter );
+        NamedBodyMap bodyMap = createBodies( bodySettings );
+        bodyMap[ "Vehicle" ] = std::make_shared< Body >( );
+        setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+
+        // Create acceleration models and propagator settings
+        SelectedAccelerationMap accelerationMap;
+        accelerationMap[ "Vehicle" ][ "Earth" ].push_back( std::make_shared< AccelerationSettings >( central_gravity ) );
+        std::vector< std::string > bodiesToPropagate = { "Vehicle" };
+        std::vector< std::string > centralBodies = { "Earth" };
+        AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                    bodyMap, accelerationMap, bodiesToPropagate, centralBodies );
+
+        std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+                std::make_shared< TranslationalStatePropagatorSettings< double > >(
+                    centralBodies, accelerationModelMap, bodiesToPropagate, nominalInitialState, finalTime );
+        std::shared_ptr< IntegratorSettings< > > integratorSettings =
+                std::make_shared< RungeKuttaVariableStepSizeSettings< > >(
+                    initialTime, 10.0, RungeKuttaCoefficients::rungeKuttaFehlberg78, 1.0E-3, 300.0, 1.0E-13, 1.0E-13 );
+
+        std::shared_ptr< SingleArcDynamicsSimulator< double, double > > dynamicsSimulator =
+                std::make_shared< SingleArcDynamicsSimulator< double, double > >(
+                    bodyMap, integratorSettings, propagatorSettings, false );
+
+        // Define function to reset gravitational parameter of Earth
+        std::shared_ptr< gravitation::GravityFieldModel > earthGravityField = bodyMap.at( "Earth" )->getGravityFieldModel( );
+        std::function< void( const Eigen::VectorXd& ) > parameterResetFunction =
+                [ = ]( const Eigen::VectorXd& parameterValues )
+        {
+            earthGravityField->resetGravitationalParameter( parameterValues( 0 ) );
+        };
+
+        return std::make_shared< EnsembleMemberSimulator< double, double > >( dynamicsSimulator, parameterResetFunction );
+    };
+
+    // Create ensemble of initial states and gravitational parameters
+    int numberOfMembers = 12;
+    Eigen::VectorXd initialStateStandardDeviations = ( Eigen::VectorXd( 6 ) <<
+                                                       100.0, 100.0, 100.0, 0.1, 0.1, 0.1 ).finished( );
+    std::vector< Eigen::VectorXd > initialStates = generateGaussianEnsembleInitialStates< double >(
+                nominalInitialState, initialStateStandardDeviations, numberOfMembers, 42 );
+    std::vector< Eigen::VectorXd > parameterValues;
+    for( int i = 0; i < numberOfMembers; i++ )
+    {
+        parameterValues.push_back(
+                    ( Eigen::VectorXd( 1 ) << earthGravitationalParameter * ( 1.0 + 1.0E-6 * ( i - 6 ) ) ).finished( ) );
+    }
+
+    std::vector< double > outputEpochs;
+    for( int i = 1; i <= 6; i++ )
+    {
+        outputEpochs.push_back( initialTime + i * 3600.0 );
+    }
+
+    // Propagate ensemble serially, and in parallel
+    EnsembleDynamicsSimulator< double, double > serialEnsembleSimulator( memberSimulatorCreationFunction, 1 );
+    serialEnsembleSimulator.propagateEnsemble( initialStates, parameterValues, outputEpochs );
+
+    EnsembleDynamicsSimulator< double, double > parallelEnsembleSimulator( memberSimulatorCreationFunction, 3 );
+    BOOST_CHECK_EQUAL( parallelEnsembleSimulator.getMemberSimulators( ).size( ), 3u );
+    parallelEnsembleSimulator.propagateEnsemble( initialStates, parameterValues, outputEpochs );
+
+    BOOST_CHECK_EQUAL( serialEnsembleSimulator.getNumberOfMembers( ), numberOfMembers );
+    BOOST_CHECK_EQUAL( parallelEnsembleSimulator.getNumberOfMembers( ), numberOfMembers );
+
+    std::vector< Eigen::MatrixXd > serialMemberStates = serialEnsembleSimulator.getMemberStates( );
+    std::vector< Eigen::MatrixXd > parallelMemberStates = parallelEnsembleSimulator.getMemberStates( );
+    for( int i = 0; i < numberOfMembers; i++ )
+    {
+        // Check that results are independent of number of threads
+        BOOST_CHECK_EQUAL( serialMemberStates.at( i ).cols( ), static_cast< int >( outputEpochs.size( ) ) );
+        for( int j = 0; j < serialMemberStates.at( i ).rows( ); j++ )
+        {
+            for( int k = 0; k < serialMemberStates.at( i ).cols( ); k++ )
+            {
+                BOOST_CHECK_EQUAL( serialMemberStates.at( i )( j, k ), parallelMemberStates.at( i )( j, k ) );
+            }
+        }
+
+        // Compare to analytical solution
+        double currentGravitationalParameter = parameterValues.at( i )( 0 );
+        Eigen::Vector6d initialKeplerElements = convertCartesianToKeplerianElements(
+                    Eigen::Vector6d( initialStates.at( i ) ), currentGravitationalParameter );
+        for( unsigned int k = 0; k < outputEpochs.size( ); k++ )
+        {
+            Eigen::Vector6d stateDifference = serialMemberStates.at( i ).col( k ) -
+                    convertKeplerianToCartesianElements(
+                        propagateKeplerOrbit( initialKeplerElements, outputEpochs.at( k ) - initialTime,
+                                              currentGravitationalParameter ), currentGravitationalParameter );
+            for( int j = 0; j < 3; j++ )
+            {
+                BOOST_CHECK_SMALL( stateDifference( j ), 1.0E-2 );
+                BOOST_CHECK_SMALL( stateDifference( j + 3 ), 1.0E-5 );
+            }
+        }
+    }
+
+    // Check ensemble statistics
+    Eigen::MatrixXd sampleMeanStates = parallelEnsembleSimulator.getSampleMeanStates( );
+    std::vector< Eigen::MatrixXd > sampleStateCovariances = parallelEnsembleSimulator.getSampleStateCovariances( );
+    Eigen::MatrixXd minimumStates = parallelEnsembleSimulator.getSampleStatePercentiles( 0.0 );
+    Eigen::MatrixXd maximumStates = parallelEnsembleSimulator.getSampleStatePercentiles( 100.0 );
+    BOOST_CHECK_EQUAL( sampleStateCovariances.size( ), outputEpochs.size( ) );
+    for( unsigned int k = 0; k < outputEpochs.size( ); k++ )
+    {
+        Eigen::VectorXd expectedMean = Eigen::VectorXd::Zero( 6 );
+        Eigen::VectorXd expectedMinimum = parallelMemberStates.at( 0 ).col( k );
+        Eigen::VectorXd expectedMaximum = parallelMemberStates.at( 0 ).col( k );
+        for( int i = 0; i < numberOfMembers; i++ )
+        {
+            expectedMean += parallelMemberStates.at( i ).col( k ) / static_cast< double >( numberOfMembers );
+            expectedMinimum = expectedMinimum.cwiseMin( parallelMemberStates.at( i ).col( k ) );
+            expectedMaximum = expectedMaximum.cwiseMax( parallelMemberStates.at( i ).col( k ) );
+        }
+
+        Eigen::VectorXd expectedVariance = Eigen::VectorXd::Zero( 6 );
+        for( int i = 0; i < numberOfMembers; i++ )
+        {
+            expectedVariance += ( parallelMemberStates.at( i ).col( k ) - expectedMean ).cwiseAbs2( ) /
+                    static_cast< double >( numberOfMembers - 1 );
+        }
+
+        for( int j = 0; j < 6; j++ )
+        {
+            BOOST_CHECK_CLOSE_FRACTION( sampleMeanStates( j, k ), expectedMean( j ), 1.0E-12 );
+            BOOST_CHECK_CLOSE_FRACTION( sampleStateCovariances.at( k )( j, j ), expectedVariance( j ), 1.0E-10 );
+            BOOST_CHECK_EQUAL( minimumStates( j, k ), expectedMinimum( j ) );
+            BOOST_CHECK_EQUAL( maximumStates( j, k ), expectedMaximum( j ) );
+        }
+    }
+
+    BOOST_CHECK_EQUAL( parallelEnsembleSimulator.getIndicesOfIncompleteMembers( ).size( ), 0u );
+
+    // Check that output epoch beyond termination is reported as not reached, and is excluded from statistics
+    std::vector< double > extendedOutputEpochs = outputEpochs;
+    extendedOutputEpochs.push_back( finalTime + 3600.0 );
+    parallelEnsembleSimulator.propagateEnsemble( initialStates, parameterValues, extendedOutputEpochs );
+    BOOST_CHECK_EQUAL( parallelEnsembleSimulator.getIndicesOfIncompleteMembers( ).size( ),
+                       static_cast< unsigned int >( numberOfMembers ) );
+    for( int i = 0; i < numberOfMembers; i++ )
+    {
+        for( unsigned int k = 0; k < extendedOutputEpochs.size( ); k++ )
+        {
+            BOOST_CHECK_EQUAL( parallelEnsembleSimulator.getIsOutputEpochReached( ).at( i ).at( k ),
+                               ( k < outputEpochs.size( ) ) );
+        }
+        BOOST_CHECK_EQUAL( parallelEnsembleSimulator.getMemberStates( ).at( i ).col( outputEpochs.size( ) ).hasNaN( ), true );
+        BOOST_CHECK_EQUAL( ( parallelEnsembleSimulator.getMemberStates( ).at( i ).leftCols( outputEpochs.size( ) ) -
+                             parallelMemberStates.at( i ) ).cwiseAbs( ).maxCoeff( ), 0.0 );
+    }
+    BOOST_CHECK_THROW( parallelEnsembleSimulator.getMemberStatesAtOutputEpoch( outputEpochs.size( ) ), std::runtime_error );
+
+    // Check that only final states are stored if no output epochs are provided
+    parallelEnsembleSimulator.propagateEnsemble( initialStates, parameterValues );
+    for( int i = 0; i < numberOfMembers; i++ )
+    {
+        BOOST_CHECK_EQUAL( parallelEnsembleSimulator.getMemberStates( ).at( i ).cols( ), 1 );
+        BOOST_CHECK_EQUAL( parallelEnsembleSimulator.getMemberFinalTimes( ).at( i ) >= finalTime, true );
+    }
+    BOOST_CHECK_EQUAL( parallelEnsembleSimulator.getIndicesOfIncompleteMembers( ).size( ), 0u );
+
+    // Check that inconsistent input is rejected
+    BOOST_CHECK_THROW( parallelEnsembleSimulator.propagateEnsemble(
+                           initialStates, std::vector< Eigen::VectorXd >( parameterValues.begin( ), parameterValues.end( ) - 1 ) ),
+                       std::runtime_error );
+}
+
+#if USE_GSL
+//! Test generation of ensemble initial states from Sobol sequence.
+BOOST_AUTO_TEST_CASE( testSobolEnsembleInitialStates )
+{
+    Eigen::VectorXd nominalState = ( Eigen::VectorXd( 3 ) << 7.0E6, 1.0E3, -2.0E3 ).finished( );
+    Eigen::VectorXd standardDeviations = ( Eigen::VectorXd( 3 ) << 100.0, 10.0, 1.0 ).finished( );
+
+    int numberOfMembers = 1024;
+    std::vector< Eigen::VectorXd > initialStates = generateSobolGaussianEnsembleInitialStates< double >(
+                nominalState, standardDeviations, numberOfMembers );
+    std::vector< Eigen::VectorXd > smallerInitialStates = generateSobolGaussianEnsembleInitialStates< double >(
+                nominalState, standardDeviations, numberOfMembers / 2 );
+    BOOST_CHECK_EQUAL( initialStates.size( ), static_cast< unsigned int >( numberOfMembers ) );
+
+    // Check that smaller ensemble is start of larger one
+    for( int i = 0; i < numberOfMembers / 2; i++ )
+    {
+        BOOST_CHECK_EQUAL( ( initialStates.at( i ) - smallerInitialStates.at( i ) ).cwiseAbs( ).maxCoeff( ), 0.0 );
+    }
+
+    // Check sample mean and standard deviation
+    Eigen::VectorXd sampleMean = statistics::computeSampleMean( initialStates );
+    Eigen::MatrixXd sampleCovariance = statistics::computeSampleCovariance( initialStates );
+    for( int j = 0; j < 3; j++ )
+    {
+        BOOST_CHECK_SMALL( ( sampleMean( j ) - nominalState( j ) ) / standardDeviations( j ), 1.0E-2 );
+        BOOST_CHECK_CLOSE_FRACTION( std::sqrt( sampleCovariance( j, j ) ), standardDeviations( j ), 2.0E-2 );
+    }
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -16,6 +16,7 @@
 #include <boost/make_shared.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include "Tudat/Basics/testMacros.h"
 #include "Tudat/Mathematics/BasicMathematics/linearAlgebra.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
 #include "Tudat/Astrodynamics/BasicAstrodynamics/orbitalElementConversions.h"
@@ -50,7 +51,7 @@ BOOST_AUTO_TEST_CASE( testKeplerMultiArcDynamics )
     //Load spice kernels.
     spice_interface::loadStandardSpiceKernels( );
 
-    for( unsigned testCase = 0; testCase < 3; testCase++ )
+    for( unsigned testCase = 0; testCase < 4; testCase++ )
     {
         std::vector< std::string > bodyNames;
         bodyNames.push_back( "Earth" );
@@ -170,6 +171,77 @@ BOOST_AUTO_TEST_CASE( testKeplerMultiArcDynamics )
                         bodyMap, integratorSettings, std::make_shared< MultiArcPropagatorSettings< double > >(
                             arcPropagationSettingsList, true ), integrationArcStarts );
         }
+        // For case 3: test multi-arc propagation with same integration settings for each arc, with arcs propagated
+        // concurrently in two separate environments, and compare results with sequential propagation
+        else if( testCase == 3 )
+        {
+            std::shared_ptr< IntegratorSettings< > > sequentialIntegratorSettings =
+                    std::make_shared< IntegratorSettings< > >
+                    ( rungeKutta4, initialEphemerisTime, 120.0 );
+            MultiArcDynamicsSimulator< > sequentialDynamicsSimulator(
+                        bodyMap, sequentialIntegratorSettings, std::make_shared< MultiArcPropagatorSettings< double > >(
+                            arcPropagationSettingsList ), integrationArcStarts, true, false );
+            std::vector< std::map< double, Eigen::VectorXd > > sequentialStateHistories =
+                    sequentialDynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+
+            // Create second environment, with associated propagator settings
+            NamedBodyMap secondBodyMap = createBodies( bodySettings );
+            setGlobalFrameBodyEphemerides( secondBodyMap, "SSB", "ECLIPJ2000" );
+
+            AccelerationMap secondAccelerationModelMap = createAccelerationModelsMap(
+                        secondBodyMap, accelerationMap, bodiesToIntegrate, centralBodies );
+            std::vector< std::shared_ptr< SingleArcPropagatorSettings< double > > > secondArcPropagationSettingsList;
+            for( unsigned int i = 0; i < numberOfIntegrationArcs; i++ )
+            {
+                secondArcPropagationSettingsList.push_back(
+                            std::make_shared< TranslationalStatePropagatorSettings< double > >
+                            ( centralBodies, secondAccelerationModelMap, bodiesToIntegrate,
+                              systemInitialStates.at( i ), integrationArcEnds.at( i ) ) );
+            }
+
+            std::shared_ptr< IntegratorSettings< > > integratorSettings =
+                    std::make_shared< IntegratorSettings< > >
+                    ( rungeKutta4, initialEphemerisTime, 120.0 );
+            std::shared_ptr< MultiArcPropagatorSettings< double > > propagatorSettings =
+                    std::make_shared< MultiArcPropagatorSettings< double > >( arcPropagationSettingsList );
+            MultiArcDynamicsSimulator< > dynamicsSimulator(
+                        bodyMap, integratorSettings, propagatorSettings, integrationArcStarts, false, false );
+            dynamicsSimulator.setArcPropagationEnvironments(
+                        { secondBodyMap }, { std::make_shared< MultiArcPropagatorSettings< double > >(
+                                                 secondArcPropagationSettingsList ) } );
+            BOOST_CHECK_EQUAL( dynamicsSimulator.getNumberOfArcPropagationEnvironments( ), 2u );
+
+            dynamicsSimulator.integrateEquationsOfMotion( propagatorSettings->getInitialStates( ) );
+
+            // Check that concurrently propagated states are identical to sequentially propagated states
+            std::vector< std::map< double, Eigen::VectorXd > > concurrentStateHistories =
+                    dynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+            BOOST_CHECK_EQUAL( concurrentStateHistories.size( ), numberOfIntegrationArcs );
+            for( unsigned int i = 0; i < numberOfIntegrationArcs; i++ )
+            {
+                BOOST_CHECK_EQUAL( concurrentStateHistories.at( i ).size( ), sequentialStateHistories.at( i ).size( ) );
+                BOOST_CHECK( concurrentStateHistories.at( i ).size( ) > 0 );
+                for( auto stateIterator = concurrentStateHistories.at( i ).begin( ),
+                     sequentialStateIterator = sequentialStateHistories.at( i ).begin( );
+                     ( stateIterator != concurrentStateHistories.at( i ).end( ) ) &&
+                     ( sequentialStateIterator != sequentialStateHistories.at( i ).end( ) );
+                     stateIterator++, sequentialStateIterator++ )
+                {
+                    BOOST_CHECK_EQUAL( stateIterator->first, sequentialStateIterator->first );
+                    BOOST_CHECK( stateIterator->second == sequentialStateIterator->second );
+                }
+            }
+
+            // Check that propagated states are set in both environments
+            for( unsigned int i = 0; i < numberOfIntegrationArcs; i++ )
+            {
+                double testTime = integrationArcStarts.at( i ) + arcDuration / 2.0;
+                TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                            bodyMap.at( "Moon" )->getEphemeris( )->getCartesianState( testTime ),
+                            secondBodyMap.at( "Moon" )->getEphemeris( )->getCartesianState( testTime ),
+                            std::numeric_limits< double >::epsilon( ) );
+            }
+        }
 
 
         std::shared_ptr< Ephemeris > moonEphemeris = bodyMap.at( "Moon" )->getEphemeris( );
@@ -201,7 +273,7 @@ BOOST_AUTO_TEST_CASE( testKeplerMultiArcDynamics )
             }
 
             // Check if output corresponds to expected analytical solution
-            if( testCase < 2 || i == 0 )
+            if( testCase != 2 || i == 0 )
             {
                 double currentTestTime = testStartTime;
                 while( currentTestTime < testEndTime )
@@ -411,6 +411,170 @@ BOOST_AUTO_TEST_CASE( testEarthMoonMultiArcVariationalEquationCalculation )
     }
 }
 
+//! Function to create an Earth-Moon multi-arc environment, with associated propagator settings and estimated parameters
+void createEarthMoonMultiArcEnvironment(
+        const std::vector< double >& arcStartTimes,
+        const std::vector< double >& arcEndTimes,
+        NamedBodyMap& bodyMap,
+        std::shared_ptr< MultiArcPropagatorSettings< double > >& multiArcPropagatorSettings,
+        std::shared_ptr< estimatable_parameters::EstimatableParameterSet< double > >& parametersToEstimate )
+{
+    // Create bodies needed in simulation
+    std::vector< std::string > bodyNames;
+    bodyNames.push_back( "Earth" );
+    bodyNames.push_back( "Sun" );
+    bodyNames.push_back( "Moon" );
+
+    double buffer = 36000.0;
+    std::map< std::string, std::shared_ptr< BodySettings > > bodySettings =
+            getDefaultBodySettings( bodyNames, arcStartTimes.front( ) - buffer, arcEndTimes.back( ) + buffer );
+    bodySettings[ "Moon" ]->ephemerisSettings->resetMakeMultiArcEphemeris( true );
+    bodySettings[ "Earth" ]->ephemerisSettings->resetMakeMultiArcEphemeris( true );
+    bodyMap = createBodies( bodySettings );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+
+    // Set accelerations between bodies that are to be taken into account.
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Earth" ][ "Sun" ].push_back( std::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationMap[ "Earth" ][ "Moon" ].push_back( std::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationMap[ "Moon" ][ "Sun" ].push_back( std::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationMap[ "Moon" ][ "Earth" ].push_back( std::make_shared< AccelerationSettings >( central_gravity ) );
+
+    std::vector< std::string > bodiesToIntegrate = { "Moon", "Earth" };
+    std::vector< std::string > centralBodies = { "Earth", "Sun" };
+    std::map< std::string, std::string > centralBodyMap = { { "Moon", "Earth" }, { "Earth", "Sun" } };
+    AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodyMap, accelerationMap, centralBodyMap );
+
+    // Create propagator settings
+    std::vector< std::shared_ptr< SingleArcPropagatorSettings< double > > > propagatorSettingsList;
+    for( unsigned int i = 0; i < arcStartTimes.size( ); i++ )
+    {
+        propagatorSettingsList.push_back(
+                    std::make_shared< TranslationalStatePropagatorSettings< double > >(
+                        centralBodies, accelerationModelMap, bodiesToIntegrate,
+                        getInitialStatesOfBodies< double, double >(
+                            bodiesToIntegrate, centralBodies, bodyMap, arcStartTimes.at( i ) ),
+                        arcEndTimes.at( i ) ) );
+    }
+    multiArcPropagatorSettings = std::make_shared< MultiArcPropagatorSettings< double > >( propagatorSettingsList );
+
+    // Create parameters
+    std::vector< std::shared_ptr< EstimatableParameterSettings > > parameterNames;
+    parameterNames.push_back(
+                std::make_shared< ArcWiseInitialTranslationalStateEstimatableParameterSettings< double > >(
+                    "Moon", arcStartTimes, "Earth" ) );
+    parameterNames.push_back(
+                std::make_shared< ArcWiseInitialTranslationalStateEstimatableParameterSettings< double > >(
+                    "Earth", arcStartTimes, "Sun" ) );
+    parameterNames.push_back( std::make_shared< EstimatableParameterSettings >( "Moon", gravitational_parameter ) );
+    parameterNames.push_back( std::make_shared< EstimatableParameterSettings >( "Earth", gravitational_parameter ) );
+    parametersToEstimate = createParametersToEstimate( parameterNames, bodyMap );
+}
+
+//! Test whether concurrent propagation of arcs gives results identical to sequential propagation
+BOOST_AUTO_TEST_CASE( testConcurrentMultiArcVariationalEquationCalculation )
+{
+    //Load spice kernels.
+    spice_interface::loadStandardSpiceKernels( );
+
+    // Define arc times.
+    std::vector< double > arcStartTimes, arcEndTimes;
+    for( unsigned int i = 0; i < 4; i++ )
+    {
+        arcStartTimes.push_back( 1.0E7 + static_cast< double >( i ) * 5.0E5 );
+        arcEndTimes.push_back( arcStartTimes.back( ) + 5.0E5 - 5.0E3 );
+    }
+
+    // Create two independent environments
+    NamedBodyMap bodyMap, secondBodyMap;
+    std::shared_ptr< MultiArcPropagatorSettings< double > > propagatorSettings, secondPropagatorSettings;
+    std::shared_ptr< estimatable_parameters::EstimatableParameterSet< double > > parametersToEstimate,
+            secondParametersToEstimate;
+    createEarthMoonMultiArcEnvironment(
+                arcStartTimes, arcEndTimes, bodyMap, propagatorSettings, parametersToEstimate );
+    createEarthMoonMultiArcEnvironment(
+                arcStartTimes, arcEndTimes, secondBodyMap, secondPropagatorSettings, secondParametersToEstimate );
+
+    // Perturb physical parameters in main environment only (values must be passed to second environment by solver)
+    Eigen::VectorXd parameterVector = parametersToEstimate->template getFullParameterValues< double >( );
+    parameterVector.segment( parameterVector.rows( ) - 2, 2 ) += Eigen::Vector2d( 1.0E11, 1.0E11 );
+    parametersToEstimate->resetParameterValues( parameterVector );
+
+    std::shared_ptr< IntegratorSettings< double > > integratorSettings =
+            std::make_shared< IntegratorSettings< double > >( rungeKutta4, arcStartTimes.front( ), 1800.0 );
+
+    // Propagate arcs sequentially
+    MultiArcVariationalEquationsSolver< double, double > sequentialVariationalEquations(
+                bodyMap, integratorSettings, propagatorSettings, parametersToEstimate, arcStartTimes,
+                true, nullptr, false );
+    sequentialVariationalEquations.integrateVariationalAndDynamicalEquations(
+                propagatorSettings->getInitialStateList( ), true );
+    std::vector< std::map< double, Eigen::VectorXd > > sequentialStateHistories =
+            sequentialVariationalEquations.getDynamicsSimulator( )->getEquationsOfMotionNumericalSolution( );
+    std::vector< std::vector< std::map< double, Eigen::MatrixXd > > > sequentialVariationalHistories =
+            sequentialVariationalEquations.getNumericalVariationalEquationsSolution( );
+    std::vector< Eigen::MatrixXd > sequentialTestMatrices;
+    for( unsigned int arc = 0; arc < arcStartTimes.size( ); arc++ )
+    {
+        sequentialTestMatrices.push_back(
+                    sequentialVariationalEquations.getStateTransitionMatrixInterface( )->
+                    getCombinedStateTransitionAndSensitivityMatrix( arcEndTimes.at( arc ) - 2.0E4 ) );
+    }
+
+    // Propagate arcs concurrently in two environments
+    MultiArcVariationalEquationsSolver< double, double > concurrentVariationalEquations(
+                bodyMap, integratorSettings, propagatorSettings, parametersToEstimate, arcStartTimes,
+                true, nullptr, false );
+    concurrentVariationalEquations.setArcPropagationEnvironments(
+    { secondBodyMap }, { secondPropagatorSettings }, { secondParametersToEstimate } );
+    BOOST_CHECK_EQUAL( concurrentVariationalEquations.getDynamicsSimulator( )->getNumberOfArcPropagationEnvironments( ), 2u );
+    concurrentVariationalEquations.integrateVariationalAndDynamicalEquations(
+                propagatorSettings->getInitialStateList( ), true );
+    std::vector< std::map< double, Eigen::VectorXd > > concurrentStateHistories =
+            concurrentVariationalEquations.getDynamicsSimulator( )->getEquationsOfMotionNumericalSolution( );
+    std::vector< std::vector< std::map< double, Eigen::MatrixXd > > > concurrentVariationalHistories =
+            concurrentVariationalEquations.getNumericalVariationalEquationsSolution( );
+
+    // Check that state, state transition and sensitivity matrix histories are identical
+    BOOST_CHECK_EQUAL( concurrentStateHistories.size( ), arcStartTimes.size( ) );
+    BOOST_CHECK_EQUAL( concurrentVariationalHistories.size( ), arcStartTimes.size( ) );
+    for( unsigned int arc = 0; arc < arcStartTimes.size( ); arc++ )
+    {
+        BOOST_CHECK_EQUAL( concurrentStateHistories.at( arc ).size( ), sequentialStateHistories.at( arc ).size( ) );
+        BOOST_CHECK( concurrentStateHistories.at( arc ).size( ) > 0 );
+        for( auto stateIterator = concurrentStateHistories.at( arc ).begin( ),
+             sequentialStateIterator = sequentialStateHistories.at( arc ).begin( );
+             ( stateIterator != concurrentStateHistories.at( arc ).end( ) ) &&
+             ( sequentialStateIterator != sequentialStateHistories.at( arc ).end( ) );
+             stateIterator++, sequentialStateIterator++ )
+        {
+            BOOST_CHECK_EQUAL( stateIterator->first, sequentialStateIterator->first );
+            BOOST_CHECK( stateIterator->second == sequentialStateIterator->second );
+        }
+
+        for( unsigned int i = 0; i < 2; i++ )
+        {
+            BOOST_CHECK_EQUAL( concurrentVariationalHistories.at( arc ).at( i ).size( ),
+                               sequentialVariationalHistories.at( arc ).at( i ).size( ) );
+            BOOST_CHECK( concurrentVariationalHistories.at( arc ).at( i ).size( ) > 0 );
+            for( auto matrixIterator = concurrentVariationalHistories.at( arc ).at( i ).begin( ),
+                 sequentialMatrixIterator = sequentialVariationalHistories.at( arc ).at( i ).begin( );
+                 ( matrixIterator != concurrentVariationalHistories.at( arc ).at( i ).end( ) ) &&
+                 ( sequentialMatrixIterator != sequentialVariationalHistories.at( arc ).at( i ).end( ) );
+                 matrixIterator++, sequentialMatrixIterator++ )
+            {
+                BOOST_CHECK_EQUAL( matrixIterator->first, sequentialMatrixIterator->first );
+                BOOST_CHECK( matrixIterator->second == sequentialMatrixIterator->second );
+            }
+        }
+
+        // Check interpolated state transition and sensitivity matrices
+        BOOST_CHECK( concurrentVariationalEquations.getStateTransitionMatrixInterface( )->
+                     getCombinedStateTransitionAndSensitivityMatrix( arcEndTimes.at( arc ) - 2.0E4 ) ==
+                     sequentialTestMatrices.at( arc ) );
+    }
+}
 
 BOOST_AUTO_TEST_SUITE_END( )
 
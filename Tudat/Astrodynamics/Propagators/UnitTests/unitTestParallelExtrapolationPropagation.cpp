@@ -0,0 +1,144 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/SimulationSetup/EnvironmentSetup/createBodies.h"
+#include "Tudat/SimulationSetup/PropagationSetup/createAccelerationModels.h"
+#include "Tudat/SimulationSetup/PropagationSetup/dynamicsSimulator.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace numerical_integrators;
+using namespace propagators;
+using namespace simulation_setup;
+
+BOOST_AUTO_TEST_SUITE( test_parallel_extrapolation_propagation )
+
+//! Function to create the environment for the test: point-mass Earth and Moon at fixed positions, and a vehicle.
+NamedBodyMap createTestBodyMap( )
+{
+    Eigen::Vector6d moonState = Eigen::Vector6d::Zero( );
+    moonState( 0 ) = 3.844E8;
+
+    std::map< std::string, std::shared_ptr< BodySettings > > bodySettings;
+    bodySettings[ "Earth" ] = std::make_shared< BodySettings >( );
+    bodySettings[ "Earth" ]->ephemerisSettings = std::make_shared< ConstantEphemerisSettings >( Eigen::Vector6d::Zero( ) );
+    bodySettings[ "Earth" ]->gravityFieldSettings = std::make_shared< CentralGravityFieldSettings >( 3.986004418E14 );
+    bodySettings[ "Moon" ] = std::make_shared< BodySettings >( );
+    bodySettings[ "Moon" ]->ephemerisSettings = std::make_shared< ConstantEphemerisSettings >( moonState );
+    bodySettings[ "Moon" ]->gravityFieldSettings = std::make_shared< CentralGravityFieldSettings >( 4.9048695E12 );
+    NamedBodyMap bodyMap = createBodies( bodySettings );
+    bodyMap[ "Vehicle" ] = std::make_shared< Body >( );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+    return bodyMap;
+}
+
+//! Function to create the propagator settings for the test, with the acceleration models created in the given environment.
+std::shared_ptr< TranslationalStatePropagatorSettings< double > > createTestPropagatorSettings(
+        const NamedBodyMap& bodyMap )
+{
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Vehicle" ][ "Earth" ].push_back(
+                std::make_shared< AccelerationSettings >( basic_astrodynamics::central_gravity ) );
+    accelerationMap[ "Vehicle" ][ "Moon" ].push_back(
+                std::make_shared< AccelerationSettings >( basic_astrodynamics::central_gravity ) );
+    std::vector< std::string > bodiesToPropagate = { "Vehicle" };
+    std::vector< std::string > centralBodies = { "Earth" };
+    basic_astrodynamics::AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodyMap, accelerationMap, bodiesToPropagate, centralBodies );
+
+    Eigen::VectorXd initialState( 6 );
+    initialState << 7.0E6, 0.0, 0.0, 0.0, 6.0E3, 4.0E3;
+    std::vector< std::shared_ptr< SingleDependentVariableSaveSettings > > dependentVariables;
+    dependentVariables.push_back( std::make_shared< SingleDependentVariableSaveSettings >(
+                                      relative_distance_dependent_variable, "Vehicle", "Moon" ) );
+    return std::make_shared< TranslationalStatePropagatorSettings< double > >(
+                centralBodies, accelerationModelMap, bodiesToPropagate, initialState,
+                std::make_shared< PropagationTimeTerminationSettings >( 86400.0 ), cowell,
+                std::make_shared< DependentVariableSaveSettings >( dependentVariables, false ) );
+}
+
+//! Test whether propagation with concurrent evaluation of the Bulirsch-Stoer extrapolation sequence in separate
+//! environments reproduces the sequential propagation.
+BOOST_AUTO_TEST_CASE( testParallelExtrapolationSequencePropagation )
+{
+    std::shared_ptr< IntegratorSettings< > > integratorSettings =
+            std::make_shared< BulirschStoerIntegratorSettings< > >(
+                0.0, 60.0, bulirsch_stoer_sequence, 6, 1.0E-3, 3600.0, 1.0E-12, 1.0E-12 );
+
+    // Propagate sequentially.
+    NamedBodyMap bodyMap = createTestBodyMap( );
+    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            createTestPropagatorSettings( bodyMap );
+    SingleArcDynamicsSimulator< double, double > sequentialDynamicsSimulator(
+                bodyMap, integratorSettings, propagatorSettings );
+
+    // Propagate with the extrapolation sequence evaluated in four environments.
+    std::vector< NamedBodyMap > additionalBodyMaps;
+    std::vector< std::shared_ptr< PropagatorSettings< double > > > additionalPropagatorSettings;
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        additionalBodyMaps.push_back( createTestBodyMap( ) );
+        additionalPropagatorSettings.push_back( createTestPropagatorSettings( additionalBodyMaps.back( ) ) );
+    }
+    SingleArcDynamicsSimulator< double, double > parallelDynamicsSimulator(
+                bodyMap, integratorSettings, propagatorSettings, false );
+    parallelDynamicsSimulator.setExtrapolationSequenceEnvironments( additionalBodyMaps, additionalPropagatorSettings );
+    parallelDynamicsSimulator.integrateEquationsOfMotion( propagatorSettings->getInitialStates( ) );
+
+    // Check that the state and dependent variable histories are identical.
+    std::map< double, Eigen::VectorXd > stateHistory = sequentialDynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+    std::map< double, Eigen::VectorXd > parallelStateHistory =
+            parallelDynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+    std::map< double, Eigen::VectorXd > dependentVariableHistory =
+            sequentialDynamicsSimulator.getDependentVariableHistory( );
+    std::map< double, Eigen::VectorXd > parallelDependentVariableHistory =
+            parallelDynamicsSimulator.getDependentVariableHistory( );
+    BOOST_CHECK( stateHistory.size( ) > 10 );
+    BOOST_CHECK_EQUAL( parallelStateHistory.size( ), stateHistory.size( ) );
+    BOOST_CHECK_EQUAL( parallelDependentVariableHistory.size( ), dependentVariableHistory.size( ) );
+    for( auto stateIterator : stateHistory )
+    {
+        BOOST_CHECK_EQUAL( parallelStateHistory.count( stateIterator.first ), 1 );
+        BOOST_CHECK( parallelStateHistory[ stateIterator.first ] == stateIterator.second );
+        BOOST_CHECK( parallelDependentVariableHistory[ stateIterator.first ] ==
+                     dependentVariableHistory.at( stateIterator.first ) );
+    }
+
+    // Check that the environments can only be used with a Bulirsch-Stoer integrator, and that their settings must be
+    // consistent.
+    SingleArcDynamicsSimulator< double, double > rungeKuttaDynamicsSimulator(
+                bodyMap, std::make_shared< IntegratorSettings< > >( rungeKutta4, 0.0, 30.0 ), propagatorSettings, false );
+    BOOST_CHECK_THROW( rungeKuttaDynamicsSimulator.setExtrapolationSequenceEnvironments(
+                           additionalBodyMaps, additionalPropagatorSettings ), std::runtime_error );
+    BOOST_CHECK_THROW( parallelDynamicsSimulator.setExtrapolationSequenceEnvironments(
+                           additionalBodyMaps, std::vector< std::shared_ptr< PropagatorSettings< double > > >( ) ),
+                       std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -0,0 +1,234 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/Propagators/integrateEquations.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/createBodies.h"
+#include "Tudat/SimulationSetup/PropagationSetup/createAccelerationModels.h"
+#include "Tudat/SimulationSetup/PropagationSetup/dynamicsSimulator.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace numerical_integrators;
+using namespace propagators;
+using namespace simulation_setup;
+
+BOOST_AUTO_TEST_SUITE( test_propagation_checkpoint )
+
+//! Typedef for interface to integrate equations with double state and time.
+typedef EquationIntegrationInterface< Eigen::VectorXd, double > VectorEquationIntegrationInterface;
+
+//! Checkpoint of integration, consisting of the loop state and the histories at the moment it was stored.
+struct IntegrationCheckpoint
+{
+    IntegrationLoopState< double > loopState;
+    std::map< double, Eigen::VectorXd > solutionHistory;
+    std::map< double, Eigen::VectorXd > dependentVariableHistory;
+    std::map< double, double > cumulativeComputationTimeHistory;
+};
+
+//! Test whether propagation resumed from a checkpoint gives results identical to those of an uninterrupted propagation.
+BOOST_AUTO_TEST_CASE( testResumeFromCheckpoint )
+{
+    // Define state derivative function (Keplerian orbit with unit gravitational parameter), which stores the time and
+    // state at which it was last evaluated (as the environment is updated in a full propagation), and dependent variable
+    // function, which retrieves these.
+    double lastEvaluationTime = TUDAT_NAN;
+    Eigen::VectorXd lastEvaluationState;
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > stateDerivativeFunction =
+            [ & ]( const double time, const Eigen::VectorXd& state )
+    {
+        lastEvaluationTime = time;
+        lastEvaluationState = state;
+
+        Eigen::VectorXd stateDerivative( 6 );
+        stateDerivative.segment( 0, 3 ) = state.segment( 3, 3 );
+        stateDerivative.segment( 3, 3 ) = -state.segment( 0, 3 ) / std::pow( state.segment( 0, 3 ).norm( ), 3 );
+        return stateDerivative;
+    };
+    std::function< Eigen::VectorXd( ) > dependentVariableFunction = [ & ]( )
+    {
+        Eigen::VectorXd dependentVariables( 2 );
+        dependentVariables << lastEvaluationTime, lastEvaluationState.segment( 0, 3 ).norm( );
+        return dependentVariables;
+    };
+    Eigen::VectorXd initialState( 6 );
+    initialState << 1.0, 0.0, 0.0, 0.0, 1.2, 0.1;
+
+    std::vector< std::shared_ptr< IntegratorSettings< double > > > integratorSettingsList;
+    integratorSettingsList.push_back( std::make_shared< AdamsBashforthMoultonSettings< double > >(
+                                          0.0, 0.01, 1.0E-6, 1.0, 1.0E-12, 1.0E-12, 6, 11, 3 ) );
+    integratorSettingsList.push_back( std::make_shared< RungeKuttaVariableStepSizeSettingsScalarTolerances< double > >(
+                                          0.0, 0.01, RungeKuttaCoefficients::rungeKuttaFehlberg78, 1.0E-6, 1.0,
+                                          1.0E-12, 1.0E-12, 2 ) );
+    integratorSettingsList.push_back( std::make_shared< GaussJacksonIntegratorSettings< double > >( 0.0, 0.01 ) );
+
+    for( unsigned int i = 0; i < integratorSettingsList.size( ); i++ )
+    {
+        // Propagate without interruption, storing a checkpoint after each step.
+        std::map< double, Eigen::VectorXd > solutionHistory;
+        std::map< double, Eigen::VectorXd > dependentVariableHistory;
+        std::map< double, double > cumulativeComputationTimeHistory;
+        std::vector< IntegrationCheckpoint > checkpoints;
+        std::function< void( const IntegrationLoopState< double >& ) > checkpointFunction =
+                [ & ]( const IntegrationLoopState< double >& loopState )
+        {
+            checkpoints.push_back( IntegrationCheckpoint{ loopState, solutionHistory, dependentVariableHistory,
+                                                          cumulativeComputationTimeHistory } );
+        };
+        VectorEquationIntegrationInterface::integrateEquations(
+                    stateDerivativeFunction, solutionHistory, initialState, integratorSettingsList.at( i ),
+                    std::make_shared< FixedTimePropagationTerminationCondition >( 10.0, true ),
+                    dependentVariableHistory, cumulativeComputationTimeHistory, dependentVariableFunction,
+                    std::function< void( Eigen::VectorXd& ) >( ), TUDAT_NAN, std::chrono::steady_clock::now( ),
+                    std::make_shared< PropagationCheckpointSettings< double > >( 0.0, checkpointFunction ) );
+        BOOST_CHECK( checkpoints.size( ) > 10 );
+
+        // Resume propagation from a checkpoint, and compare results.
+        const IntegrationCheckpoint& checkpoint = checkpoints.at( checkpoints.size( ) / 2 );
+        std::map< double, Eigen::VectorXd > resumedSolutionHistory = checkpoint.solutionHistory;
+        std::map< double, Eigen::VectorXd > resumedDependentVariableHistory = checkpoint.dependentVariableHistory;
+        std::map< double, double > resumedCumulativeComputationTimeHistory = checkpoint.cumulativeComputationTimeHistory;
+        bool isResumeFunctionCalled = false;
+        VectorEquationIntegrationInterface::integrateEquations(
+                    stateDerivativeFunction, resumedSolutionHistory, initialState, integratorSettingsList.at( i ),
+                    std::make_shared< FixedTimePropagationTerminationCondition >( 10.0, true ),
+                    resumedDependentVariableHistory, resumedCumulativeComputationTimeHistory, dependentVariableFunction,
+                    std::function< void( Eigen::VectorXd& ) >( ), TUDAT_NAN, std::chrono::steady_clock::now( ),
+                    std::make_shared< PropagationCheckpointSettings< double > >(
+                        TUDAT_NAN, checkpointFunction,
+                        std::make_shared< IntegrationLoopState< double > >( checkpoint.loopState ),
+                        [ & ]( ){ isResumeFunctionCalled = true; } ) );
+        BOOST_CHECK_EQUAL( isResumeFunctionCalled, true );
+
+        BOOST_CHECK_EQUAL( resumedSolutionHistory.size( ), solutionHistory.size( ) );
+        BOOST_CHECK_EQUAL( resumedDependentVariableHistory.size( ), dependentVariableHistory.size( ) );
+        BOOST_CHECK_EQUAL( resumedCumulativeComputationTimeHistory.size( ), cumulativeComputationTimeHistory.size( ) );
+        for( auto solutionIterator : solutionHistory )
+        {
+            BOOST_CHECK_EQUAL( resumedSolutionHistory.count( solutionIterator.first ), 1 );
+            BOOST_CHECK( resumedSolutionHistory[ solutionIterator.first ] == solutionIterator.second );
+            BOOST_CHECK( resumedDependentVariableHistory[ solutionIterator.first ] ==
+                         dependentVariableHistory.at( solutionIterator.first ) );
+        }
+    }
+}
+
+//! Function to retrieve the size (in bytes) of a file.
+long long getFileSize( const std::string& fileName )
+{
+    std::ifstream file( fileName.c_str( ), std::ios::binary | std::ios::ate );
+    return static_cast< long long >( file.tellg( ) );
+}
+
+//! Test whether dynamics simulator resumed from an (incrementally stored) checkpoint file rebuilds the full histories.
+BOOST_AUTO_TEST_CASE( testResumeSimulatorFromCheckpointFile )
+{
+    // Create Earth with point-mass gravity field, and vehicle.
+    std::map< std::string, std::shared_ptr< BodySettings > > bodySettings;
+    bodySettings[ "Earth" ] = std::make_shared< BodySettings >( );
+    bodySettings[ "Earth" ]->ephemerisSettings = std::make_shared< ConstantEphemerisSettings >( Eigen::Vector6d::Zero( ) );
+    bodySettings[ "Earth" ]->gravityFieldSettings = std::make_shared< CentralGravityFieldSettings >( 3.986004418E14 );
+    NamedBodyMap bodyMap = createBodies( bodySettings );
+    bodyMap[ "Vehicle" ] = std::make_shared< Body >( );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Vehicle" ][ "Earth" ].push_back(
+                std::make_shared< AccelerationSettings >( basic_astrodynamics::central_gravity ) );
+    std::vector< std::string > bodiesToPropagate = { "Vehicle" };
+    std::vector< std::string > centralBodies = { "Earth" };
+    basic_astrodynamics::AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodyMap, accelerationMap, bodiesToPropagate, centralBodies );
+
+    Eigen::VectorXd initialState( 6 );
+    initialState << 7.0E6, 0.0, 0.0, 0.0, 6.0E3, 4.0E3;
+    std::vector< std::shared_ptr< SingleDependentVariableSaveSettings > > dependentVariables;
+    dependentVariables.push_back( std::make_shared< SingleDependentVariableSaveSettings >(
+                                      relative_distance_dependent_variable, "Vehicle", "Earth" ) );
+    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            std::make_shared< TranslationalStatePropagatorSettings< double > >(
+                centralBodies, accelerationModelMap, bodiesToPropagate, initialState,
+                std::make_shared< PropagationTimeTerminationSettings >( 86400.0, true ), cowell,
+                std::make_shared< DependentVariableSaveSettings >( dependentVariables, false ) );
+    std::shared_ptr< IntegratorSettings< > > integratorSettings =
+            std::make_shared< IntegratorSettings< > >( rungeKutta4, 0.0, 30.0 );
+
+    // Propagate without interruption, storing a checkpoint after each step.
+    const std::string checkpointFileName = "testPropagationCheckpoint.dat";
+    const std::string historyFileName = getCheckpointHistoryFileName( checkpointFileName );
+    SingleArcDynamicsSimulator< double, double > dynamicsSimulator(
+                bodyMap, integratorSettings, propagatorSettings, false );
+    dynamicsSimulator.setCheckpointSettings( checkpointFileName, 0.0 );
+    dynamicsSimulator.integrateEquationsOfMotion( propagatorSettings->getInitialStates( ) );
+
+    // Check that histories are stored in history file, and not in (rewritten) checkpoint file.
+    const long long historyFileSize = getFileSize( historyFileName );
+    BOOST_CHECK( historyFileSize > 2880 * 7 * static_cast< long long >( sizeof( double ) ) );
+    BOOST_CHECK( getFileSize( checkpointFileName ) < 1000 );
+
+    // Simulate data appended by interrupted checkpoint, which is to be ignored when resuming.
+    {
+        std::ofstream historyFile( historyFileName.c_str( ), std::ios::binary | std::ios::app );
+        historyFile << "incomplete checkpoint data";
+    }
+
+    // Resume propagation with new simulator, and compare results.
+    SingleArcDynamicsSimulator< double, double > resumedDynamicsSimulator(
+                bodyMap, integratorSettings, propagatorSettings, false );
+    resumedDynamicsSimulator.resumeIntegrationFromCheckpoint( checkpointFileName );
+
+    std::map< double, Eigen::VectorXd > stateHistory = dynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+    std::map< double, Eigen::VectorXd > resumedStateHistory =
+            resumedDynamicsSimulator.getEquationsOfMotionNumericalSolution( );
+    std::map< double, Eigen::VectorXd > dependentVariableHistory = dynamicsSimulator.getDependentVariableHistory( );
+    std::map< double, Eigen::VectorXd > resumedDependentVariableHistory =
+            resumedDynamicsSimulator.getDependentVariableHistory( );
+    BOOST_CHECK_EQUAL( stateHistory.size( ), 2881 );
+    BOOST_CHECK_EQUAL( resumedStateHistory.size( ), stateHistory.size( ) );
+    BOOST_CHECK_EQUAL( resumedDependentVariableHistory.size( ), dependentVariableHistory.size( ) );
+    for( auto stateIterator : stateHistory )
+    {
+        BOOST_CHECK_EQUAL( resumedStateHistory.count( stateIterator.first ), 1 );
+        BOOST_CHECK( resumedStateHistory[ stateIterator.first ] == stateIterator.second );
+        BOOST_CHECK( resumedDependentVariableHistory[ stateIterator.first ] ==
+                     dependentVariableHistory.at( stateIterator.first ) );
+    }
+    BOOST_CHECK( resumedDynamicsSimulator.getCumulativeNumberOfFunctionEvaluations( ) ==
+                 dynamicsSimulator.getCumulativeNumberOfFunctionEvaluations( ) );
+    BOOST_CHECK_EQUAL( resumedDynamicsSimulator.getCumulativeComputationTimeHistory( ).size( ),
+                       dynamicsSimulator.getCumulativeComputationTimeHistory( ).size( ) );
+
+    std::remove( checkpointFileName.c_str( ) );
+    std::remove( historyFileName.c_str( ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
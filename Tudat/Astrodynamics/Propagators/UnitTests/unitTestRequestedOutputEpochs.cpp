@@ -0,0 +1,155 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Astrodynamics/Propagators/integrateEquations.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace numerical_integrators;
+using namespace propagators;
+
+BOOST_AUTO_TEST_SUITE( test_requested_output_epochs )
+
+//! Typedef for interface to integrate equations with double state and time.
+typedef EquationIntegrationInterface< Eigen::VectorXd, double > VectorEquationIntegrationInterface;
+
+//! Analytical solution of a harmonic oscillator, with unit frequency and initial state [1, 0] at t=0.
+Eigen::VectorXd computeHarmonicOscillatorState( const double time )
+{
+    Eigen::VectorXd state( 2 );
+    state << std::cos( time ), -std::sin( time );
+    return state;
+}
+
+//! Test saving of propagation results at requested epochs, using the dense output of the integrator.
+BOOST_AUTO_TEST_CASE( testRequestedOutputEpochs )
+{
+    // Define state derivative function, which stores the time and state at which it was last evaluated (as the
+    // environment is updated in a full propagation), and dependent variable function, which retrieves these.
+    double lastEvaluationTime = TUDAT_NAN;
+    Eigen::VectorXd lastEvaluationState;
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > stateDerivativeFunction =
+            [ & ]( const double time, const Eigen::VectorXd& state )
+    {
+        lastEvaluationTime = time;
+        lastEvaluationState = state;
+
+        Eigen::VectorXd stateDerivative( 2 );
+        stateDerivative << state( 1 ), -state( 0 );
+        return stateDerivative;
+    };
+    std::function< Eigen::VectorXd( ) > dependentVariableFunction = [ & ]( )
+    {
+        Eigen::VectorXd dependentVariables( 3 );
+        dependentVariables << lastEvaluationTime, lastEvaluationState;
+        return dependentVariables;
+    };
+
+    // Define (non-equidistant) output epochs, including some outside of propagation interval.
+    std::vector< double > requestedOutputTimes;
+    requestedOutputTimes.push_back( -1.0 );
+    for( int i = 0; i <= 200; i++ )
+    {
+        requestedOutputTimes.push_back( 0.1 * static_cast< double >( i ) + 0.04 * std::sin( static_cast< double >( i ) ) );
+    }
+    requestedOutputTimes.at( 1 ) = 0.0;
+    requestedOutputTimes.push_back( 25.0 );
+
+    std::vector< RungeKuttaCoefficients::CoefficientSets > coefficientSets =
+    { RungeKuttaCoefficients::rungeKuttaFehlberg78, RungeKuttaCoefficients::rungeKutta87DormandPrince };
+    for( unsigned int i = 0; i < coefficientSets.size( ); i++ )
+    {
+        // Propagate forwards and backwards.
+        for( unsigned int testCase = 0; testCase < 2; testCase++ )
+        {
+            const bool isPropagationForward = ( testCase == 0 );
+            const double initialTime = isPropagationForward ? 0.0 : 20.0;
+            const double finalTime = isPropagationForward ? 20.0 : 0.0;
+
+            std::shared_ptr< IntegratorSettings< double > > integratorSettings =
+                    std::make_shared< RungeKuttaVariableStepSizeSettingsScalarTolerances< double > >(
+                        initialTime, isPropagationForward ? 0.1 : -0.1, coefficientSets.at( i ), 1.0E-6, 10.0,
+                        1.0E-12, 1.0E-12 );
+            integratorSettings->requestedOutputTimes_ = requestedOutputTimes;
+
+            std::map< double, Eigen::VectorXd > solutionHistory;
+            std::map< double, Eigen::VectorXd > dependentVariableHistory;
+            std::map< double, double > cumulativeComputationTimeHistory;
+            VectorEquationIntegrationInterface::integrateEquations(
+                        stateDerivativeFunction, solutionHistory, computeHarmonicOscillatorState( initialTime ),
+                        integratorSettings,
+                        std::make_shared< FixedTimePropagationTerminationCondition >( finalTime, isPropagationForward ),
+                        dependentVariableHistory, cumulativeComputationTimeHistory, dependentVariableFunction );
+
+            // Check that results are saved exactly at requested epochs in propagation interval.
+            BOOST_CHECK_EQUAL( solutionHistory.size( ), requestedOutputTimes.size( ) - 2 );
+            BOOST_CHECK_EQUAL( dependentVariableHistory.size( ), requestedOutputTimes.size( ) - 2 );
+            for( unsigned int j = 1; j < requestedOutputTimes.size( ) - 1; j++ )
+            {
+                const double outputTime = requestedOutputTimes.at( j );
+                BOOST_CHECK_EQUAL( solutionHistory.count( outputTime ), 1 );
+                BOOST_CHECK_EQUAL( dependentVariableHistory.count( outputTime ), 1 );
+
+                // Check accuracy of state.
+                BOOST_CHECK_SMALL( ( solutionHistory.at( outputTime ) - computeHarmonicOscillatorState( outputTime ) ).
+                                   cwiseAbs( ).maxCoeff( ), 1.0E-9 );
+
+                // Check that dependent variables are computed at requested epoch, from saved state.
+                BOOST_CHECK_EQUAL( dependentVariableHistory.at( outputTime )( 0 ), outputTime );
+                BOOST_CHECK_EQUAL( ( dependentVariableHistory.at( outputTime ).segment( 1, 2 ) -
+                                     solutionHistory.at( outputTime ) ).cwiseAbs( ).maxCoeff( ), 0.0 );
+            }
+        }
+    }
+
+    // Check that unsorted epochs are rejected.
+    std::shared_ptr< IntegratorSettings< double > > integratorSettings =
+            std::make_shared< RungeKuttaVariableStepSizeSettingsScalarTolerances< double > >(
+                0.0, 0.1, RungeKuttaCoefficients::rungeKuttaFehlberg78, 1.0E-6, 10.0, 1.0E-12, 1.0E-12 );
+    integratorSettings->requestedOutputTimes_ = { 0.0, 2.0, 1.0 };
+
+    std::map< double, Eigen::VectorXd > solutionHistory;
+    std::map< double, Eigen::VectorXd > dependentVariableHistory;
+    std::map< double, double > cumulativeComputationTimeHistory;
+    BOOST_CHECK_THROW( VectorEquationIntegrationInterface::integrateEquations(
+                           stateDerivativeFunction, solutionHistory, computeHarmonicOscillatorState( 0.0 ),
+                           integratorSettings, std::make_shared< FixedTimePropagationTerminationCondition >( 20.0, true ),
+                           dependentVariableHistory, cumulativeComputationTimeHistory ), std::runtime_error );
+
+    // Check that integrators without dense output are rejected.
+    integratorSettings = std::make_shared< IntegratorSettings< double > >( rungeKutta4, 0.0, 0.1 );
+    integratorSettings->requestedOutputTimes_ = { 0.0, 1.0, 2.0 };
+    BOOST_CHECK_THROW( VectorEquationIntegrationInterface::integrateEquations(
+                           stateDerivativeFunction, solutionHistory, computeHarmonicOscillatorState( 0.0 ),
+                           integratorSettings, std::make_shared< FixedTimePropagationTerminationCondition >( 20.0, true ),
+                           dependentVariableHistory, cumulativeComputationTimeHistory ), std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -0,0 +1,272 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Basics/testMacros.h"
+#include "Tudat/Astrodynamics/Ephemerides/tabulatedEphemeris.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/createBodies.h"
+#include "Tudat/SimulationSetup/PropagationSetup/createAccelerationModels.h"
+#include "Tudat/SimulationSetup/EstimationSetup/createEstimatableParameters.h"
+#include "Tudat/SimulationSetup/EstimationSetup/variationalEquationsSolver.h"
+
+namespace tudat
+{
+
+namespace unit_tests
+{
+
+using namespace tudat::numerical_integrators;
+using namespace tudat::simulation_setup;
+using namespace tudat::basic_astrodynamics;
+using namespace tudat::estimatable_parameters;
+using namespace tudat::ephemerides;
+using namespace tudat::propagators;
+
+BOOST_AUTO_TEST_SUITE( test_variational_equations_sparsity )
+
+//! Function to set up the variational equations for a four-body system, and check the block-sparse evaluation
+/*!
+ *  Function to set up the variational equations for Earth, Moon, Mars and a vehicle, and check that the block-sparse
+ *  evaluation of the variational equations is equal to the product with the full (dense) matrix of state partials.
+ *  \param useHierarchicalCentralBodies Boolean denoting whether the bodies are propagated w.r.t. each other
+ *  (Vehicle w.r.t. Moon, Moon w.r.t. Earth), or all w.r.t. the (non-propagated) Sun.
+ *  \return Non-zero blocks of the matrix of state partials, per row block.
+ */
+std::vector< std::vector< int > > checkBlockSparseVariationalEquations( const bool useHierarchicalCentralBodies )
+{
+    const double initialTime = 1.0E7;
+    const double finalTime = initialTime + 86400.0;
+
+    // Define global states of bodies
+    std::map< std::string, Eigen::Vector6d > globalStates;
+    globalStates[ "Sun" ] = Eigen::Vector6d::Zero( );
+    globalStates[ "Earth" ] = ( Eigen::Vector6d( ) << 1.496E11, 0.0, 0.0, 0.0, 29.78E3, 0.0 ).finished( );
+    globalStates[ "Moon" ] = globalStates[ "Earth" ] +
+            ( Eigen::Vector6d( ) << 3.844E8, 0.0, 1.0E7, 0.0, 1.022E3, 0.0 ).finished( );
+    globalStates[ "Mars" ] = ( Eigen::Vector6d( ) << -1.2E11, 1.9E11, 0.0, -20.0E3, -12.0E3, 0.5E3 ).finished( );
+    globalStates[ "Vehicle" ] = globalStates[ "Moon" ] +
+            ( Eigen::Vector6d( ) << 2.0E6, 0.0, 1.0E5, 0.0, 1.5E3, 0.1E3 ).finished( );
+
+    std::map< std::string, double > gravitationalParameters;
+    gravitationalParameters[ "Sun" ] = 1.32712440018E20;
+    gravitationalParameters[ "Earth" ] = 3.986004418E14;
+    gravitationalParameters[ "Moon" ] = 4.9048695E12;
+    gravitationalParameters[ "Mars" ] = 4.282837E13;
+
+    // Create bodies with constant ephemerides and point-mass gravity fields
+    std::map< std::string, std::shared_ptr< BodySettings > > bodySettings;
+    for( std::map< std::string, double >::const_iterator bodyIterator = gravitationalParameters.begin( );
+         bodyIterator != gravitationalParameters.end( ); bodyIterator++ )
+    {
+        bodySettings[ bodyIterator->first ] = std::make_shared< BodySettings >( );
+        bodySettings[ bodyIterator->first ]->ephemerisSettings =
+                std::make_shared< ConstantEphemerisSettings >( globalStates.at( bodyIterator->first ) );
+        bodySettings[ bodyIterator->first ]->gravityFieldSettings =
+                std::make_shared< CentralGravityFieldSettings >( bodyIterator->second );
+    }
+    NamedBodyMap bodyMap = createBodies( bodySettings );
+
+    // Set propagation order and central bodies
+    std::vector< std::string > bodiesToIntegrate = { "Earth", "Moon", "Mars", "Vehicle" };
+    std::vector< std::string > centralBodies;
+    if( useHierarchicalCentralBodies )
+    {
+        centralBodies = { "Sun", "Earth", "Sun", "Moon" };
+    }
+    else
+    {
+        centralBodies = { "Sun", "Sun", "Sun", "Sun" };
+    }
+
+    bodyMap[ "Vehicle" ] = std::make_shared< Body >( );
+    bodyMap[ "Vehicle" ]->setEphemeris( std::make_shared< TabulatedCartesianEphemeris< double, double > >(
+                                            std::shared_ptr< interpolators::OneDimensionalInterpolator<
+                                            double, Eigen::Vector6d > >( ), centralBodies.at( 3 ) ) );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+
+    // Set point-mass accelerations
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Earth" ][ "Sun" ].push_back( std::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationMap[ "Earth" ][ "Moon" ].push_back( std::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationMap[ "Moon" ][ "Sun" ].push_back( std::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationMap[ "Moon" ][ "Earth" ].push_back( std::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationMap[ "Mars" ][ "Sun" ].push_back( std::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationMap[ "Vehicle" ][ "Earth" ].push_back( std::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationMap[ "Vehicle" ][ "Sun" ].push_back( std::make_shared< AccelerationSettings >( central_gravity ) );
+
+    AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodyMap, accelerationMap, bodiesToIntegrate, centralBodies );
+
+    // Set initial states w.r.t. central bodies, and parameters to estimate
+    Eigen::VectorXd initialStates = Eigen::VectorXd::Zero( 6 * bodiesToIntegrate.size( ) );
+    std::vector< std::shared_ptr< EstimatableParameterSettings > > parameterNames;
+    for( unsigned int i = 0; i < bodiesToIntegrate.size( ); i++ )
+    {
+        Eigen::Vector6d currentInitialState =
+                globalStates.at( bodiesToIntegrate.at( i ) ) - globalStates.at( centralBodies.at( i ) );
+        initialStates.segment( 6 * i, 6 ) = currentInitialState;
+        parameterNames.push_back( std::make_shared< InitialTranslationalStateEstimatableParameterSettings< double > >(
+                                      bodiesToIntegrate.at( i ), currentInitialState, centralBodies.at( i ) ) );
+    }
+    parameterNames.push_back( std::make_shared< EstimatableParameterSettings >( "Earth", gravitational_parameter ) );
+    std::shared_ptr< EstimatableParameterSet< double > > parametersToEstimate =
+            createParametersToEstimate( parameterNames, bodyMap, accelerationModelMap );
+
+    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            std::make_shared< TranslationalStatePropagatorSettings< double > >
+            ( centralBodies, accelerationModelMap, bodiesToIntegrate, initialStates, finalTime );
+    std::shared_ptr< IntegratorSettings< > > integratorSettings =
+            std::make_shared< IntegratorSettings< > >( rungeKutta4, initialTime, 60.0 );
+
+    // Create state derivative model, with variational equations
+    std::vector< std::shared_ptr< SingleStateTypeDerivative< double, double > > > stateDerivativeModels =
+            createStateDerivativeModels< double, double >( propagatorSettings, bodyMap, initialTime );
+    std::map< IntegratedStateType, orbit_determination::StateDerivativePartialsMap > stateDerivativePartials =
+            createStateDerivativePartials< double, double >(
+                getStateDerivativeModelMapFromVector( stateDerivativeModels ), bodyMap, parametersToEstimate );
+
+    SingleArcDynamicsSimulator< double, double > dynamicsSimulator(
+                bodyMap, integratorSettings, propagatorSettings, false, false, false, false,
+                std::chrono::steady_clock::now( ), stateDerivativeModels );
+    std::shared_ptr< DynamicsStateDerivativeModel< double, double > > dynamicsStateDerivative =
+            dynamicsSimulator.getDynamicsStateDerivative( );
+
+    std::shared_ptr< VariationalEquations > variationalEquations = std::make_shared< VariationalEquations >(
+                stateDerivativePartials, parametersToEstimate, dynamicsStateDerivative->getStateTypeStartIndices( ) );
+    dynamicsStateDerivative->addVariationalEquations( variationalEquations );
+    dynamicsStateDerivative->setPropagationSettings( std::vector< IntegratedStateType >( ), true, true );
+
+    // Check partition of state into single bodies
+    const int stateSize = initialStates.rows( );
+    const int numberOfParameters = parametersToEstimate->getParameterSetSize( );
+    BOOST_CHECK_EQUAL( variationalEquations->getStateBlockIndices( ).size( ), bodiesToIntegrate.size( ) );
+    for( unsigned int i = 0; i < variationalEquations->getStateBlockIndices( ).size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( variationalEquations->getStateBlockIndices( ).at( i ).first, static_cast< int >( 6 * i ) );
+        BOOST_CHECK_EQUAL( variationalEquations->getStateBlockIndices( ).at( i ).second, 6 );
+    }
+
+    // Evaluate variational equations at two different epochs/states (to check that no values of the partials persist
+    // between evaluations).
+    std::srand( 42 );
+    for( unsigned int test = 0; test < 2; test++ )
+    {
+        const double currentTime = initialTime + 3600.0 * test;
+        Eigen::VectorXd currentStates = initialStates;
+        for( unsigned int i = 0; i < bodiesToIntegrate.size( ); i++ )
+        {
+            currentStates.segment( 6 * i, 3 ) += 3600.0 * test * currentStates.segment( 6 * i + 3, 3 );
+        }
+
+        // Evaluate with random state transition and sensitivity matrices
+        Eigen::MatrixXd fullState = Eigen::MatrixXd::Zero( stateSize, numberOfParameters + 1 );
+        fullState.block( 0, 0, stateSize, numberOfParameters ) = Eigen::MatrixXd::Random( stateSize, numberOfParameters );
+        fullState.block( 0, numberOfParameters, stateSize, 1 ) = currentStates;
+
+        Eigen::MatrixXd blockSparseDerivative =
+                dynamicsStateDerivative->computeStateDerivative( currentTime, fullState ).block(
+                    0, 0, stateSize, numberOfParameters );
+        Eigen::MatrixXd statePartialMatrix = variationalEquations->getStatePartialMatrix( );
+
+        // Evaluate with zero state transition and sensitivity matrices, to retrieve contribution of parameter partials
+        Eigen::MatrixXd zeroVariationsState = fullState;
+        zeroVariationsState.block( 0, 0, stateSize, numberOfParameters ).setZero( );
+        Eigen::MatrixXd parameterPartialContribution =
+                dynamicsStateDerivative->computeStateDerivative( currentTime, zeroVariationsState ).block(
+                    0, 0, stateSize, numberOfParameters );
+
+        // Compare block-sparse evaluation with full (dense) matrix product
+        Eigen::MatrixXd denseDerivative =
+                statePartialMatrix * fullState.block( 0, 0, stateSize, numberOfParameters ) + parameterPartialContribution;
+        for( int i = 0; i < stateSize; i++ )
+        {
+            double rowScale = std::max( denseDerivative.row( i ).cwiseAbs( ).maxCoeff( ),
+                                        std::numeric_limits< double >::min( ) );
+            for( int j = 0; j < numberOfParameters; j++ )
+            {
+                BOOST_CHECK_SMALL( std::fabs( blockSparseDerivative( i, j ) - denseDerivative( i, j ) ) / rowScale,
+                                   1.0E-14 );
+            }
+        }
+
+        // Check that all non-zero entries of state partial matrix are inside sparsity pattern
+        const std::vector< std::vector< int > >& nonZeroBlocks = variationalEquations->getNonZeroStatePartialBlocks( );
+        for( unsigned int i = 0; i < bodiesToIntegrate.size( ); i++ )
+        {
+            for( unsigned int j = 0; j < bodiesToIntegrate.size( ); j++ )
+            {
+                if( std::find( nonZeroBlocks.at( i ).begin( ), nonZeroBlocks.at( i ).end( ), static_cast< int >( j ) ) ==
+                        nonZeroBlocks.at( i ).end( ) )
+                {
+                    BOOST_CHECK_EQUAL( statePartialMatrix.block( 6 * i, 6 * j, 6, 6 ).cwiseAbs( ).maxCoeff( ), 0.0 );
+                }
+            }
+        }
+    }
+
+    return variationalEquations->getNonZeroStatePartialBlocks( );
+}
+
+//! Test block-sparse evaluation of variational equations, with all bodies propagated w.r.t. the Sun
+BOOST_AUTO_TEST_CASE( testVariationalEquationsSparsityFlatCentralBodies )
+{
+    std::vector< std::vector< int > > nonZeroBlocks = checkBlockSparseVariationalEquations( false );
+
+    // Earth and Moon are coupled, Mars is decoupled, vehicle depends on Earth only.
+    std::vector< std::vector< int > > expectedNonZeroBlocks = { { 0, 1 }, { 0, 1 }, { 2 }, { 0, 3 } };
+    BOOST_CHECK_EQUAL( nonZeroBlocks.size( ), expectedNonZeroBlocks.size( ) );
+    for( unsigned int i = 0; i < expectedNonZeroBlocks.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL_COLLECTIONS( nonZeroBlocks.at( i ).begin( ), nonZeroBlocks.at( i ).end( ),
+                                       expectedNonZeroBlocks.at( i ).begin( ), expectedNonZeroBlocks.at( i ).end( ) );
+    }
+}
+
+//! Test block-sparse evaluation of variational equations, with vehicle propagated w.r.t. Moon, and Moon w.r.t. Earth
+BOOST_AUTO_TEST_CASE( testVariationalEquationsSparsityHierarchicalCentralBodies )
+{
+    std::vector< std::vector< int > > nonZeroBlocks = checkBlockSparseVariationalEquations( true );
+
+    // Mars remains decoupled from other bodies
+    BOOST_CHECK_EQUAL( nonZeroBlocks.size( ), 4 );
+    std::vector< int > expectedMarsBlocks = { 2 };
+    BOOST_CHECK_EQUAL_COLLECTIONS( nonZeroBlocks.at( 2 ).begin( ), nonZeroBlocks.at( 2 ).end( ),
+                                   expectedMarsBlocks.begin( ), expectedMarsBlocks.end( ) );
+
+    // Vehicle state depends on states of Earth and Moon (through central body hierarchy)
+    std::vector< int > expectedVehicleBlocks = { 0, 1, 3 };
+    BOOST_CHECK_EQUAL_COLLECTIONS( nonZeroBlocks.at( 3 ).begin( ), nonZeroBlocks.at( 3 ).end( ),
+                                   expectedVehicleBlocks.begin( ), expectedVehicleBlocks.end( ) );
+
+    // Dynamics of Earth and Moon do not depend on state of Mars or vehicle
+    for( unsigned int i = 0; i < 2; i++ )
+    {
+        BOOST_CHECK( std::find( nonZeroBlocks.at( i ).begin( ), nonZeroBlocks.at( i ).end( ), 2 ) ==
+                     nonZeroBlocks.at( i ).end( ) );
+        BOOST_CHECK( std::find( nonZeroBlocks.at( i ).begin( ), nonZeroBlocks.at( i ).end( ), 3 ) ==
+                     nonZeroBlocks.at( i ).end( ) );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
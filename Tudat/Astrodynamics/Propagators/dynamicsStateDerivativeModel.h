@@ -23,6 +23,8 @@
 #include <Eigen/Core>
 
 #include "Tudat/Astrodynamics/BasicAstrodynamics/torqueModelTypes.h"
+#include "Tudat/Basics/profiling.h"
+#include "Tudat/Basics/stateHistory.h"
 #include "Tudat/Astrodynamics/Propagators/bodyMassStateDerivative.h"
 #include "Tudat/Astrodynamics/Propagators/singleStateTypeDerivative.h"
 #include "Tudat/Astrodynamics/Propagators/nBodyStateDerivative.h"
@@ -146,6 +148,7 @@ public:
     StateType computeStateDerivative( const TimeType time, const StateType& state )
     {
 //        std::cout << "Computing state derivative: " <<time<<" "<<state.transpose( ) << std::endl;
+        TUDAT_PROFILE_SCOPE( stateDerivativeProfilingEntry_ );
 
         // Initialize state derivative
         if( stateDerivative_.rows( ) != state.rows( ) || stateDerivative_.cols( ) != state.cols( )  )
@@ -168,11 +171,14 @@ public:
             }
 
             convertCurrentStateToGlobalRepresentationPerType( state, time, evaluateVariationalEquations_ );
+
+            TUDAT_PROFILE_SCOPE( environmentUpdateProfilingEntry_ );
             environmentUpdateFunction_( time, currentStatesPerTypeInConventionalRepresentation_,
                                         integratedStatesFromEnvironment_ );
         }
         else
         {
+            TUDAT_PROFILE_SCOPE( environmentUpdateProfilingEntry_ );
             environmentUpdateFunction_(
                         time, std::unordered_map<
                         IntegratedStateType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >( ),
@@ -193,6 +199,7 @@ public:
                  stateDerivativeModelsIterator_ != stateDerivativeModels_.end( );
                  stateDerivativeModelsIterator_++ )
             {
+                TUDAT_PROFILE_SCOPE( stateDerivativeModelUpdateProfilingEntries_[ stateDerivativeModelsIterator_->first ] );
                 for( unsigned int i = 0; i < stateDerivativeModelsIterator_->second.size( ); i++ )
                 {
                     // Update state derivative models
@@ -204,6 +211,8 @@ public:
                  stateDerivativeModelsIterator_ != stateDerivativeModels_.end( );
                  stateDerivativeModelsIterator_++ )
             {
+                TUDAT_PROFILE_SCOPE(
+                            stateDerivativeModelEvaluationProfilingEntries_[ stateDerivativeModelsIterator_->first ] );
                 for( unsigned int i = 0; i < stateDerivativeModelsIterator_->second.size( ); i++ )
                 {
                     // Evaluate and set current dynamical state derivative
@@ -219,8 +228,12 @@ public:
         // If variational equations are to be integrated: evaluate and set.
         if( evaluateVariationalEquations_ )
         {
-            variationalEquations_->updatePartials( time, currentStatesPerTypeInConventionalRepresentation_ );
+            {
+                TUDAT_PROFILE_SCOPE( partialsUpdateProfilingEntry_ );
+                variationalEquations_->updatePartials( time, currentStatesPerTypeInConventionalRepresentation_ );
+            }
 
+            TUDAT_PROFILE_SCOPE( variationalEquationsProfilingEntry_ );
             variationalEquations_->evaluateVariationalEquations< StateScalarType >(
                         time, state.block( 0, 0, totalConventionalStateSize_, variationalEquations_->getNumberOfParameterValues( ) ),
                         stateDerivative_.block( 0, 0, totalConventionalStateSize_, variationalEquations_->getNumberOfParameterValues( ) ) );
@@ -355,6 +368,36 @@ public:
         }
     }
 
+    //! Function to convert a contiguous state history from propagator-specific form to the conventional form.
+    /*!
+     * Function to convert a contiguous state history from propagator-specific form to the conventional form
+     * (not necessarily in inertial frame). The memory allocated by convertedSolution is reused.
+     * \sa DynamicsStateDerivativeModel::convertToOutputSolution
+     * \param convertedSolution State history (rawSolution), converted to the 'conventional form' (by reference)
+     * \param rawSolution State history in propagator-specific form (i.e. form that is used in
+     *        numerical integration).
+     */
+    void convertNumericalStateSolutionsToOutputSolutions(
+            utilities::StateHistory< TimeType, StateScalarType >& convertedSolution,
+            const utilities::StateHistory< TimeType, StateScalarType >& rawSolution )
+    {
+        convertedSolution.clear( 0 );
+        Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > currentRawState, currentOutputState;
+        for( int i = 0; i < rawSolution.size( ); i++ )
+        {
+            currentRawState = rawSolution.getState( i );
+            currentOutputState = convertToOutputSolution( currentRawState, rawSolution.getTime( i ) );
+
+            // Set size of output history from first converted state
+            if( i == 0 )
+            {
+                convertedSolution.clear( currentOutputState.rows( ) );
+                convertedSolution.reserve( rawSolution.size( ) );
+            }
+            convertedSolution.addEntry( rawSolution.getTime( i ), currentOutputState );
+        }
+    }
+
     //! Function to process the state vector during propagation.
     /*!
      * Function to process the state vector during propagation.
@@ -575,6 +618,68 @@ public:
         cumulativeFunctionEvaluationCounter_.clear( );
     }
 
+    //! Function to set the number of calls to the computeStateDerivative function (total and per time step).
+    /*!
+     * Function to set the number of calls to the computeStateDerivative function (total and per time step), for instance
+     * when a propagation is resumed from a checkpoint (automatically by SingleArcDynamicsSimulator).
+     * \param numberOfFunctionEvaluations Number of calls to the computeStateDerivative function
+     * \param cumulativeNumberOfFunctionEvaluations Number of calls to the computeStateDerivative function per time step
+     */
+    void setFunctionEvaluationCounters(
+            const unsigned int numberOfFunctionEvaluations,
+            const std::map< TimeType, unsigned int >& cumulativeNumberOfFunctionEvaluations )
+    {
+        functionEvaluationCounter_ = numberOfFunctionEvaluations;
+        cumulativeFunctionEvaluationCounter_ = cumulativeNumberOfFunctionEvaluations;
+    }
+
+    //! Function to set the object in which the computation time of the components of the state derivative is stored.
+    /*!
+     * Function to set the object in which the computation time of the components of the state derivative (environment
+     * update, state derivative models per type, variational equations) is stored, if Tudat is built with USE_PROFILING.
+     * The object is passed on to the state derivative models, to store the computation time of their components
+     * (e.g. individual acceleration models).
+     * \param profilingData Object in which the computation time of the components of the state derivative is stored.
+     */
+    void setProfilingData( const std::shared_ptr< utilities::ProfilingData > profilingData )
+    {
+        profilingData_ = profilingData;
+
+        // Register entries (if any profiling data is set).
+        std::function< utilities::ProfilingEntry*( const std::string& ) > getProfilingEntry =
+                [ = ]( const std::string& componentName )
+        {
+            return ( profilingData_ == nullptr ) ? nullptr : profilingData_->getEntry( componentName );
+        };
+        stateDerivativeProfilingEntry_ = getProfilingEntry( "State derivative" );
+        environmentUpdateProfilingEntry_ = getProfilingEntry( "Environment update" );
+        partialsUpdateProfilingEntry_ = getProfilingEntry( "Variational equations: partials update" );
+        variationalEquationsProfilingEntry_ = getProfilingEntry( "Variational equations: evaluation" );
+        for( auto modelIterator = stateDerivativeModels_.begin( ); modelIterator != stateDerivativeModels_.end( );
+             modelIterator++ )
+        {
+            stateDerivativeModelUpdateProfilingEntries_[ modelIterator->first ] = getProfilingEntry(
+                        "State derivative model update: " + getIntegratedStateTypeName( modelIterator->first ) );
+            stateDerivativeModelEvaluationProfilingEntries_[ modelIterator->first ] = getProfilingEntry(
+                        "State derivative model evaluation: " + getIntegratedStateTypeName( modelIterator->first ) );
+            for( unsigned int i = 0; i < modelIterator->second.size( ); i++ )
+            {
+                modelIterator->second.at( i )->setProfilingData( profilingData_ );
+            }
+        }
+    }
+
+    //! Function to retrieve the object in which the computation time of the components of the state derivative is stored.
+    /*!
+     * Function to retrieve the object in which the computation time of the components of the state derivative is stored.
+     * \return Object in which the computation time of the components of the state derivative is stored (nullptr if not
+     * set).
+     */
+    std::shared_ptr< utilities::ProfilingData > getProfilingData( )
+    {
+        return profilingData_;
+    }
+
 private:
 
     //! Function to convert the to the conventional form in the global frame per dynamics type.
@@ -699,6 +804,27 @@ private:
     //! Variable to keep track of the number of calls to the computeStateDerivative function
     unsigned int functionEvaluationCounter_ = 0;
 
+    //! Object in which the computation time of the components of the state derivative is stored (nullptr if not set).
+    std::shared_ptr< utilities::ProfilingData > profilingData_;
+
+    //! Profiling entry for the complete computeStateDerivative function.
+    utilities::ProfilingEntry* stateDerivativeProfilingEntry_ = nullptr;
+
+    //! Profiling entry for the environment update.
+    utilities::ProfilingEntry* environmentUpdateProfilingEntry_ = nullptr;
+
+    //! Profiling entries for the update of the state derivative models, per type of state.
+    std::map< IntegratedStateType, utilities::ProfilingEntry* > stateDerivativeModelUpdateProfilingEntries_;
+
+    //! Profiling entries for the evaluation of the state derivative models, per type of state.
+    std::map< IntegratedStateType, utilities::ProfilingEntry* > stateDerivativeModelEvaluationProfilingEntries_;
+
+    //! Profiling entry for the update of the partials used in the variational equations.
+    utilities::ProfilingEntry* partialsUpdateProfilingEntry_ = nullptr;
+
+    //! Profiling entry for the evaluation of the variational equations.
+    utilities::ProfilingEntry* variationalEquationsProfilingEntry_ = nullptr;
+
     //! Variable to keep track of the number of calls to the computeStateDerivative function per time step
     std::map< TimeType, unsigned int > cumulativeFunctionEvaluationCounter_;
 };
@@ -9,6 +9,7 @@
  */
 
 #include <algorithm>
+#include <stdexcept>
 #include "Tudat/Astrodynamics/Propagators/environmentUpdateTypes.h"
 
 namespace tudat
@@ -17,6 +18,37 @@ namespace tudat
 namespace propagators
 {
 
+//! Function to get a string representing the type of an environment model update
+std::string getEnvironmentUpdateTypeName( const EnvironmentModelsToUpdate environmentUpdateType )
+{
+    std::string environmentUpdateName;
+    switch( environmentUpdateType )
+    {
+    case body_translational_state_update:
+        environmentUpdateName = "translational state";
+        break;
+    case body_rotational_state_update:
+        environmentUpdateName = "rotational state";
+        break;
+    case body_mass_update:
+        environmentUpdateName = "mass";
+        break;
+    case spherical_harmonic_gravity_field_update:
+        environmentUpdateName = "spherical harmonic gravity field";
+        break;
+    case vehicle_flight_conditions_update:
+        environmentUpdateName = "flight conditions";
+        break;
+    case radiation_pressure_interface_update:
+        environmentUpdateName = "radiation pressure interface";
+        break;
+    default:
+        throw std::runtime_error( "Error, did not recognize environment update type " +
+                                  std::to_string( environmentUpdateType ) + " when getting name" );
+    }
+    return environmentUpdateName;
+}
+
 //! Function to extend existing list of required environment update types
 void addEnvironmentUpdates( std::map< propagators::EnvironmentModelsToUpdate,
                             std::vector< std::string > >& environmentUpdateList,
@@ -33,6 +33,14 @@ enum EnvironmentModelsToUpdate
     radiation_pressure_interface_update = 5
 };
 
+//! Function to get a string representing the type of an environment model update
+/*!
+ * Function to get a string representing the type of an environment model update
+ * \param environmentUpdateType Type of environment model update
+ * \return String with environment model update id.
+ */
+std::string getEnvironmentUpdateTypeName( const EnvironmentModelsToUpdate environmentUpdateType );
+
 //! Function to extend existing list of required environment update types
 /*!
  * Function to extend existing list of required environment update types
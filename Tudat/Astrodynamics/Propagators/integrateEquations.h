@@ -17,11 +17,16 @@
 #include <limits>
 
 #include <map>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "Tudat/Mathematics/NumericalIntegrators/numericalIntegrator.h"
 
 #include "Tudat/Astrodynamics/BasicAstrodynamics/timeConversions.h"
 #include "Tudat/Basics/timeType.h"
+#include "Tudat/Basics/stateHistory.h"
 #include "Tudat/Astrodynamics/Propagators/singleStateTypeDerivative.h"
 #include "Tudat/Mathematics/NumericalIntegrators/createNumericalIntegrator.h"
 #include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
@@ -344,20 +349,22 @@ void getFinalStateForExactTerminationCondition(
  * \param timeStep Last time step taken by integrator.
  * \param dependentVariableFunction Function returning dependent variables (obtained from environment and state
  * derivative model).
- * \param solutionHistory History of state variables that are to be saved given as map
- * (time as key; returned by reference)
- * \param dependentVariableHistory History of dependent variables that are to be saved given as map
- * (time as key; returned by reference)
+ * \param solutionHistory History of state variables that are to be saved given as map or StateHistory
+ * (returned by reference)
+ * \param dependentVariableHistory History of dependent variables that are to be saved given as map or StateHistory
+ * (returned by reference)
  * \param currentCpuTime Current run time of propagation.
  */
-template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType  >
+template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType,
+          typename SolutionHistoryType = std::map< TimeType, StateType >,
+          typename DependentVariableHistoryType = std::map< TimeType, Eigen::VectorXd > >
 void propagateToExactTerminationCondition(
         const std::shared_ptr< numerical_integrators::NumericalIntegrator< TimeType, StateType, StateType, TimeStepType > > integrator,
         const std::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
         const TimeStepType timeStep,
         const std::function< Eigen::VectorXd( ) > dependentVariableFunction,
-        std::map< TimeType, StateType >& solutionHistory,
-        std::map< TimeType, Eigen::VectorXd >& dependentVariableHistory,
+        SolutionHistoryType& solutionHistory,
+        DependentVariableHistoryType& dependentVariableHistory,
         const double currentCpuTime )
 {
     // Turn off step size control
@@ -376,39 +383,26 @@ void propagateToExactTerminationCondition(
 
     // Check if any dependent variables are saved. If so, remove last entry
     bool recomputeDependentVariables = false;
+    bool isPropagationForward = ( timeStep > 0 );
     if( dependentVariableHistory.size( ) > 0 )
     {
-        if( dependentVariableHistory.rbegin( )->first == solutionHistory.rbegin( )->first )
+        if( utilities::getLastAddedTimeOfHistory( dependentVariableHistory, isPropagationForward ) ==
+                utilities::getLastAddedTimeOfHistory( solutionHistory, isPropagationForward ) )
         {
-            if( timeStep > 0 )
-            {
-                dependentVariableHistory.erase( std::prev( dependentVariableHistory.end() ) );
-            }
-            else
-            {
-                dependentVariableHistory.erase(  dependentVariableHistory.begin( ) );
-            }
+            utilities::removeLastAddedEntryOfHistory( dependentVariableHistory, isPropagationForward );
             recomputeDependentVariables = true;
         }
     }
 
     // Remove state entry last added, and enter converged final state
-    if( timeStep > 0 )
-    {
-        solutionHistory.erase( std::prev( solutionHistory.end() ) );
-        solutionHistory[ endTime ] = endState;
-    }
-    else
-    {
-        solutionHistory.erase( solutionHistory.begin( ) );
-        solutionHistory[ endTime ] = endState;
-    }
+    utilities::removeLastAddedEntryOfHistory( solutionHistory, isPropagationForward );
+    utilities::addEntryToHistory( solutionHistory, endTime, endState );
 
     // Recompute final dependent variables, if required
     if( recomputeDependentVariables )
     {
         integrator->getStateDerivativeFunction( )( endTime, endState );
-        dependentVariableHistory[ endTime ] = dependentVariableFunction( );
+        utilities::addEntryToHistory( dependentVariableHistory, endTime, Eigen::VectorXd( dependentVariableFunction( ) ) );
 
         // Check stopping conditions to be able to save details
         propagationTerminationCondition->checkStopCondition( endTime, currentCpuTime );
@@ -418,6 +412,73 @@ void propagateToExactTerminationCondition(
     integrator->setStepSizeControl( true );
 }
 
+//! State of the numerical integration loop, from which the integration can be resumed.
+/*!
+ *  State of the numerical integration loop (see integrateEquationsFromIntegrator), from which the integration can be
+ *  resumed, consisting of the time step of the next step, the number of steps since the last saved step and the internal
+ *  state of the numerical integrator (as written by NumericalIntegrator::writeStateToBinaryStream).
+ */
+template< typename TimeStepType >
+struct IntegrationLoopState
+{
+    //! Time step of the next integration step.
+    TimeStepType timeStep;
+
+    //! Number of integration steps since the last step at which the results were saved (modulo save frequency).
+    int saveIndex;
+
+    //! Cumulative computation time (in seconds) at the moment that the loop state was stored.
+    double cumulativeComputationTime;
+
+    //! Binary representation of the internal state of the numerical integrator.
+    std::string integratorState;
+};
+
+//! Settings for the storage of checkpoints of the numerical integration loop, and for resuming from a checkpoint.
+/*!
+ *  Settings for the storage of checkpoints of the numerical integration loop (see integrateEquationsFromIntegrator), and
+ *  for resuming the integration from a checkpoint. A checkpoint is stored after each integration step for which the
+ *  computation time since the previous checkpoint (or the start of the integration) exceeds the checkpoint interval,
+ *  and the propagation is not terminated. The histories of the state and dependent variables are not part of the loop
+ *  state, and are to be stored by the checkpoint function as well.
+ */
+template< typename TimeStepType >
+class PropagationCheckpointSettings
+{
+public:
+
+    //! Constructor.
+    /*!
+     *  Constructor.
+     *  \param checkpointInterval Computation time (in seconds) between subsequent checkpoints (no checkpoints are stored
+     *  if NaN).
+     *  \param checkpointFunction Function that is called with the current loop state to store a checkpoint.
+     *  \param resumeLoopState Loop state from which the integration is to be resumed (nullptr if integration is to be
+     *  started from the current state of the integrator).
+     *  \param resumeFunction Function that is called when resuming the integration, after the internal state of the
+     *  integrator has been restored (empty by default).
+     */
+    PropagationCheckpointSettings(
+            const double checkpointInterval,
+            const std::function< void( const IntegrationLoopState< TimeStepType >& ) > checkpointFunction,
+            const std::shared_ptr< IntegrationLoopState< TimeStepType > > resumeLoopState = nullptr,
+            const std::function< void( ) > resumeFunction = std::function< void( ) >( ) ):
+        checkpointInterval_( checkpointInterval ), checkpointFunction_( checkpointFunction ),
+        resumeLoopState_( resumeLoopState ), resumeFunction_( resumeFunction ){ }
+
+    //! Computation time (in seconds) between subsequent checkpoints (no checkpoints are stored if NaN).
+    double checkpointInterval_;
+
+    //! Function that is called with the current loop state to store a checkpoint.
+    std::function< void( const IntegrationLoopState< TimeStepType >& ) > checkpointFunction_;
+
+    //! Loop state from which the integration is to be resumed (nullptr if integration is not resumed).
+    std::shared_ptr< IntegrationLoopState< TimeStepType > > resumeLoopState_;
+
+    //! Function that is called when resuming the integration, after the internal state of the integrator has been restored.
+    std::function< void( ) > resumeFunction_;
+};
+
 //! Function to numerically integrate a given first order differential equation
 /*!
  *  Function to numerically integrate a given first order differential equation, with the state derivative a function of
@@ -425,10 +486,10 @@ void propagateToExactTerminationCondition(
  *  \param integrator Numerical integrator used for propagation
  *  \param initialTimeStep Time step to use for first step of numerical integration
  *  \param propagationTerminationCondition Object to determine when/how the propagation is to be stopped at the current time.
- *  \param solutionHistory History of state variables that are to be saved given as map
- *  (time as key; returned by reference)
- *  \param dependentVariableHistory History of dependent variables that are to be saved given as map
- *  (time as key; returned by reference)
+ *  \param solutionHistory History of state variables that are to be saved given as map (time as key), or as
+ *  StateHistory, which stores the history in contiguous memory (returned by reference)
+ *  \param dependentVariableHistory History of dependent variables that are to be saved given as map (time as key), or as
+ *  StateHistory (returned by reference)
  *  \param cumulativeComputationTimeHistory History of cumulative computation times that are to be saved given
  *  as map (time as key; returned by reference)
  *  \param dependentVariableFunction Function returning dependent variables (obtained from environment and state
@@ -439,57 +500,143 @@ void propagateToExactTerminationCondition(
  *  \param printInterval Frequency with which to print progress to console (nan = never).
  *  \param initialClockTime Initial clock time from which to determine cumulative computation time.
  *  By default now(), i.e. the moment at which this function is called.
+ *  \param requestedOutputTimes Epochs at which the state and dependent variables are to be saved, sorted in ascending
+ *  order. If empty (default), the results are saved every saveFrequency steps. If not empty, the results are saved only
+ *  at these epochs (and, if applicable, at the exact termination condition), using the dense output of the integrator.
+ *  \param checkpointSettings Settings for storing checkpoints of the integration loop, and for resuming the integration
+ *  from a checkpoint (none by default). When resuming, the histories are not cleared, the internal state of the integrator
+ *  is restored from the loop state, and the initialClockTime should be set such that the cumulative computation time
+ *  continues from the value at the checkpoint.
  *  \return Event that triggered the termination of the propagation
  */
-template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType  >
+template< typename StateType = Eigen::MatrixXd, typename TimeType = double, typename TimeStepType = TimeType,
+          typename SolutionHistoryType = std::map< TimeType, StateType >,
+          typename DependentVariableHistoryType = std::map< TimeType, Eigen::VectorXd > >
 std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrator(
         const std::shared_ptr< numerical_integrators::NumericalIntegrator< TimeType, StateType, StateType, TimeStepType > > integrator,
         const TimeStepType initialTimeStep,
         const std::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
-        std::map< TimeType, StateType >& solutionHistory,
-        std::map< TimeType, Eigen::VectorXd >& dependentVariableHistory,
+        SolutionHistoryType& solutionHistory,
+        DependentVariableHistoryType& dependentVariableHistory,
         std::map< TimeType, double >& cumulativeComputationTimeHistory,
         const std::function< Eigen::VectorXd( ) > dependentVariableFunction = std::function< Eigen::VectorXd( ) >( ),
         const std::function< void( StateType& ) > statePostProcessingFunction = std::function< void( StateType& ) >( ),
         const int saveFrequency = TUDAT_NAN,
         const TimeType printInterval = TUDAT_NAN,
-        const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ) )
+        const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ),
+        const std::vector< TimeType >& requestedOutputTimes = std::vector< TimeType >( ),
+        const std::shared_ptr< PropagationCheckpointSettings< TimeStepType > > checkpointSettings = nullptr )
 {
     std::shared_ptr< PropagationTerminationDetails > propagationTerminationReason;
 
+    // Restore internal state of integrator if integration is resumed from checkpoint.
+    const bool isIntegrationResumed = ( checkpointSettings != nullptr && checkpointSettings->resumeLoopState_ != nullptr );
+    if( isIntegrationResumed )
+    {
+        std::istringstream integratorStateStream( checkpointSettings->resumeLoopState_->integratorState );
+        integrator->readStateFromBinaryStream( integratorStateStream );
+        if( checkpointSettings->resumeFunction_ != nullptr )
+        {
+            checkpointSettings->resumeFunction_( );
+        }
+    }
+
     // Get Initial state and time.
     TimeType currentTime = integrator->getCurrentIndependentVariable( );
     TimeType initialTime = currentTime;
     StateType newState = integrator->getCurrentState( );
 
-    // Initialization of numerical solutions for variational equations
-    solutionHistory.clear( );
-    solutionHistory[ currentTime ] = newState;
+    // Function to save state and dependent variables at given epoch
+    std::function< void( const TimeType, StateType ) > saveCurrentState =
+            [ & ]( const TimeType saveTime, StateType stateToSave )
+    {
+        utilities::addEntryToHistory( solutionHistory, saveTime, stateToSave );
+
+        if( !( dependentVariableFunction == nullptr ) )
+        {
+            integrator->getStateDerivativeFunction( )( saveTime, stateToSave );
+            utilities::addEntryToHistory(
+                        dependentVariableHistory, saveTime, Eigen::VectorXd( dependentVariableFunction( ) ) );
+        }
+    };
+
+    // Set requested output epochs in order of propagation, and discard those before initial time.
+    const bool saveAtRequestedOutputTimes = ( requestedOutputTimes.size( ) > 0 );
+    const bool isPropagationForward = ( initialTimeStep > 0 );
+    std::vector< TimeType > outputTimesToSave;
+    if( saveAtRequestedOutputTimes )
+    {
+        if( !integrator->isDenseOutputAvailable( ) )
+        {
+            throw std::runtime_error( "Error, saving of propagation results at requested epochs requires an integrator "
+                                      "with dense output." );
+        }
+
+        for( unsigned int i = 1; i < requestedOutputTimes.size( ); i++ )
+        {
+            if( requestedOutputTimes.at( i ) < requestedOutputTimes.at( i - 1 ) )
+            {
+                throw std::runtime_error( "Error, requested epochs at which to save propagation results are not sorted." );
+            }
+        }
+
+        for( unsigned int i = 0; i < requestedOutputTimes.size( ); i++ )
+        {
+            const TimeType outputTime = isPropagationForward ?
+                        requestedOutputTimes.at( i ) : requestedOutputTimes.at( requestedOutputTimes.size( ) - 1 - i );
+            if( isIntegrationResumed ? ( isPropagationForward ? ( outputTime > initialTime ) : ( outputTime < initialTime ) ) :
+                                       ( isPropagationForward ? ( outputTime >= initialTime ) : ( outputTime <= initialTime ) ) )
+            {
+                outputTimesToSave.push_back( outputTime );
+            }
+        }
+    }
+    unsigned int nextOutputTimeIndex = 0;
 
-    dependentVariableHistory.clear( );
-    if( !( dependentVariableFunction == nullptr ) )
+    // Initialization of numerical solutions for variational equations (histories up to checkpoint are retained if resumed)
+    if( !isIntegrationResumed )
     {
-        integrator->getStateDerivativeFunction( )( currentTime, newState );
-        dependentVariableHistory[ currentTime ] = dependentVariableFunction( );
+        solutionHistory.clear( );
+        dependentVariableHistory.clear( );
+        if( !saveAtRequestedOutputTimes )
+        {
+            saveCurrentState( currentTime, newState );
+        }
+        else if( outputTimesToSave.size( ) > 0 && outputTimesToSave.at( 0 ) == initialTime )
+        {
+            saveCurrentState( currentTime, newState );
+            nextOutputTimeIndex++;
+        }
     }
 
     // CPU time
-    cumulativeComputationTimeHistory.clear( );
+    if( !isIntegrationResumed )
+    {
+        cumulativeComputationTimeHistory.clear( );
+    }
     double currentCPUTime = std::chrono::duration_cast< std::chrono::nanoseconds >(
                 std::chrono::steady_clock::now( ) - initialClockTime ).count( ) * 1.0e-9;
     cumulativeComputationTimeHistory[ currentTime ] = currentCPUTime;
 
     // Set initial time step and total integration time.
-    TimeStepType timeStep = initialTimeStep;
+    TimeStepType timeStep = isIntegrationResumed ? checkpointSettings->resumeLoopState_->timeStep : initialTimeStep;
     TimeType previousTime = currentTime;
     TimeType previousPrintTime = TUDAT_NAN;
 
-    int saveIndex = 0;
+    int saveIndex = isIntegrationResumed ? checkpointSettings->resumeLoopState_->saveIndex : 0;
+
+    // Computation time at which the last checkpoint was stored.
+    const bool storeCheckpoints = ( checkpointSettings != nullptr && checkpointSettings->checkpointFunction_ != nullptr &&
+            checkpointSettings->checkpointInterval_ == checkpointSettings->checkpointInterval_ );
+    double lastCheckpointCPUTime = currentCPUTime;
 
     propagationTerminationReason = std::make_shared< PropagationTerminationDetails >(
                 unknown_propagation_termination_reason );
     bool breakPropagation = 0;
 
+    // States (before post-processing) at requested output epochs in current step.
+    std::vector< std::pair< TimeType, StateType > > currentStepOutputStates;
+
     // Perform numerical integration steps until end time reached.
     do
     {
@@ -501,6 +648,24 @@ std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrato
 
                 // Perform integration step.
                 newState = integrator->performIntegrationStep( timeStep );
+
+                // Compute states at requested output epochs in current step (before the current state is modified).
+                currentStepOutputStates.clear( );
+                if( saveAtRequestedOutputTimes && !integrator->getPropagationTerminationConditionReached( ) )
+                {
+                    const TimeType stepEndTime = integrator->getCurrentIndependentVariable( );
+                    while( nextOutputTimeIndex < outputTimesToSave.size( ) &&
+                           ( isPropagationForward ? ( outputTimesToSave.at( nextOutputTimeIndex ) <= stepEndTime ) :
+                                                    ( outputTimesToSave.at( nextOutputTimeIndex ) >= stepEndTime ) ) )
+                    {
+                        currentStepOutputStates.push_back(
+                                    std::make_pair( outputTimesToSave.at( nextOutputTimeIndex ),
+                                                    integrator->getDenseOutputState(
+                                                        outputTimesToSave.at( nextOutputTimeIndex ) ) ) );
+                        nextOutputTimeIndex++;
+                    }
+                }
+
                 if( statePostProcessingFunction != nullptr )
                 {
                     statePostProcessingFunction( newState );
@@ -524,16 +689,24 @@ std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrato
                 timeStep = integrator->getNextStepSize( );
 
                 // Save integration result in map
-                saveIndex++;
-                saveIndex = saveIndex % saveFrequency;
-                if( saveIndex == 0 )
+                if( saveAtRequestedOutputTimes )
                 {
-                    solutionHistory[ currentTime ] = newState;
-
-                    if( !( dependentVariableFunction == nullptr ) )
+                    for( unsigned int i = 0; i < currentStepOutputStates.size( ); i++ )
                     {
-                        integrator->getStateDerivativeFunction( )( currentTime, newState );
-                        dependentVariableHistory[ currentTime ] = dependentVariableFunction( );
+                        if( statePostProcessingFunction != nullptr )
+                        {
+                            statePostProcessingFunction( currentStepOutputStates.at( i ).second );
+                        }
+                        saveCurrentState( currentStepOutputStates.at( i ).first, currentStepOutputStates.at( i ).second );
+                    }
+                }
+                else
+                {
+                    saveIndex++;
+                    saveIndex = saveIndex % saveFrequency;
+                    if( saveIndex == 0 )
+                    {
+                        saveCurrentState( currentTime, newState );
                     }
                 }
             }
@@ -594,6 +767,18 @@ std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrato
                 }
                 breakPropagation = true;
             }
+
+            // Store checkpoint from which the integration can be resumed.
+            if( storeCheckpoints && !breakPropagation &&
+                    currentCPUTime - lastCheckpointCPUTime >= checkpointSettings->checkpointInterval_ )
+            {
+                std::ostringstream integratorStateStream;
+                integrator->writeStateToBinaryStream( integratorStateStream );
+                checkpointSettings->checkpointFunction_(
+                            IntegrationLoopState< TimeStepType >{
+                                timeStep, saveIndex, currentCPUTime, integratorStateStream.str( ) } );
+                lastCheckpointCPUTime = currentCPUTime;
+            }
         }
         catch( const std::exception& caughtException )
         {
@@ -622,7 +807,9 @@ Eigen::MatrixXd, double, double >(
         const std::function< void( Eigen::MatrixXd& ) > statePostProcessingFunction,
         const int saveFrequency,
         const double printInterval,
-        const std::chrono::steady_clock::time_point initialClockTime );
+        const std::chrono::steady_clock::time_point initialClockTime,
+        const std::vector< double >& requestedOutputTimes,
+        const std::shared_ptr< PropagationCheckpointSettings< double > > checkpointSettings );
 
 
 extern template std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrator<
@@ -637,8 +824,25 @@ Eigen::VectorXd, double, double >(
         const std::function< void( Eigen::VectorXd& ) > statePostProcessingFunction,
         const int saveFrequency,
         const double printInterval,
-        const std::chrono::steady_clock::time_point initialClockTime );
+        const std::chrono::steady_clock::time_point initialClockTime,
+        const std::vector< double >& requestedOutputTimes,
+        const std::shared_ptr< PropagationCheckpointSettings< double > > checkpointSettings );
 
+extern template std::shared_ptr< PropagationTerminationDetails > integrateEquationsFromIntegrator<
+Eigen::VectorXd, double, double >(
+        const std::shared_ptr< numerical_integrators::NumericalIntegrator< double, Eigen::VectorXd, Eigen::VectorXd, double > > integrator,
+        const double initialTimeStep,
+        const std::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
+        utilities::StateHistory< double, double >& solutionHistory,
+        utilities::StateHistory< double, double >& dependentVariableHistory,
+        std::map< double, double >& cumulativeComputationTimeHistory,
+        const std::function< Eigen::VectorXd( ) > dependentVariableFunction,
+        const std::function< void( Eigen::VectorXd& ) > statePostProcessingFunction,
+        const int saveFrequency,
+        const double printInterval,
+        const std::chrono::steady_clock::time_point initialClockTime,
+        const std::vector< double >& requestedOutputTimes,
+        const std::shared_ptr< PropagationCheckpointSettings< double > > checkpointSettings );
 
 //! Interface class for integrating some state derivative function.
 /*!
@@ -657,12 +861,13 @@ public:
      *  Function to numerically integrate a given first order differential equation, with the state derivative a function of
      *  a single independent variable and the current state
      *  \param stateDerivativeFunction Function returning the state derivative from current time and state.
-     *  \param solutionHistory History of numerical states given as map (time as key; returned by reference)
+     *  \param solutionHistory History of numerical states given as map (time as key), or as StateHistory (returned by
+     *  reference)
      *  \param initialState Initial state
      *  \param integratorSettings Settings for numerical integrator.
      *  \param propagationTerminationCondition Object to determine when/how the propagation is to be stopped at the current time.
-     *  \param dependentVariableHistory History of dependent variables that are to be saved given as map
-     *  (time as key; returned by reference)
+     *  \param dependentVariableHistory History of dependent variables that are to be saved given as map (time as key),
+     *  or as StateHistory (returned by reference)
      *  \param cumulativeComputationTimeHistory History of cumulative computation times that are to be saved given
      *  as map (time as key; returned by reference)
      *  \param dependentVariableFunction Function returning dependent variables (obtained from environment and state
@@ -671,20 +876,30 @@ public:
      *  \param printInterval Frequency with which to print progress to console (nan = never).
      *  \param initialClockTime Initial clock time from which to determine cumulative computation time.
      *  By default now(), i.e. the moment at which this function is called.
+     *  \param checkpointSettings Settings for storing checkpoints of the integration loop, and for resuming the
+     *  integration from a checkpoint (none by default).
+     *  \param additionalStateDerivativeFunctions State derivative functions, equivalent to stateDerivativeFunction but
+     *  bound to separate copies of the dynamical model and environment, with which the extrapolation sequence of a
+     *  Bulirsch-Stoer integrator is evaluated concurrently (none by default, see createIntegrator).
      *  \return Event that triggered the termination of the propagation
      */
+    template< typename SolutionHistoryType = std::map< TimeType, StateType >,
+              typename DependentVariableHistoryType = std::map< TimeType, Eigen::VectorXd > >
     static std::shared_ptr< PropagationTerminationDetails > integrateEquations(
             std::function< StateType( const TimeType, const StateType& ) > stateDerivativeFunction,
-            std::map< TimeType, StateType >& solutionHistory,
+            SolutionHistoryType& solutionHistory,
             const StateType initialState,
             const std::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > integratorSettings,
             const std::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
-            std::map< TimeType, Eigen::VectorXd >& dependentVariableHistory,
+            DependentVariableHistoryType& dependentVariableHistory,
             std::map< TimeType, double >& cumulativeComputationTimeHistory,
             const std::function< Eigen::VectorXd( ) > dependentVariableFunction = std::function< Eigen::VectorXd( ) >( ),
             const std::function< void( StateType& ) > statePostProcessingFunction = std::function< void( StateType& ) >( ),
             const TimeType printInterval = TUDAT_NAN,
-            const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ) );
+            const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ) ,
+            const std::shared_ptr< PropagationCheckpointSettings< TimeType > > checkpointSettings = nullptr,
+            const std::vector< std::function< StateType( const TimeType, const StateType& ) > >&
+            additionalStateDerivativeFunctions = std::vector< std::function< StateType( const TimeType, const StateType& ) > >( ) );
 
 };
 
@@ -699,12 +914,13 @@ public:
      *  Function to numerically integrate a given first order differential equation, with the state derivative a function of
      *  a single independent variable and the current state
      *  \param stateDerivativeFunction Function returning the state derivative from current time and state.
-     *  \param solutionHistory History of numerical states given as map (time as key; returned by reference)
+     *  \param solutionHistory History of numerical states given as map (time as key), or as StateHistory (returned by
+     *  reference)
      *  \param initialState Initial state
      *  \param integratorSettings Settings for numerical integrator.
      *  \param propagationTerminationCondition Object to determine when/how the propagation is to be stopped at the current time.
-     *  \param dependentVariableHistory History of dependent variables that are to be saved given as map
-     *  (time as key; returned by reference)
+     *  \param dependentVariableHistory History of dependent variables that are to be saved given as map (time as key),
+     *  or as StateHistory (returned by reference)
      *  \param cumulativeComputationTimeHistory History of cumulative computation times that are to be saved given
      *  as map (time as key; returned by reference)
      *  \param dependentVariableFunction Function returning dependent variables (obtained from environment and state
@@ -713,20 +929,30 @@ public:
      *  \param printInterval Frequency with which to print progress to console (nan = never).
      *  \param initialClockTime Initial clock time from which to determine cumulative computation time.
      *  By default now(), i.e. the moment at which this function is called.
+     *  \param checkpointSettings Settings for storing checkpoints of the integration loop, and for resuming the
+     *  integration from a checkpoint (none by default).
+     *  \param additionalStateDerivativeFunctions State derivative functions, equivalent to stateDerivativeFunction but
+     *  bound to separate copies of the dynamical model and environment, with which the extrapolation sequence of a
+     *  Bulirsch-Stoer integrator is evaluated concurrently (none by default, see createIntegrator).
      *  \return Event that triggered the termination of the propagation
      */
+    template< typename SolutionHistoryType = std::map< double, StateType >,
+              typename DependentVariableHistoryType = std::map< double, Eigen::VectorXd > >
     static std::shared_ptr< PropagationTerminationDetails > integrateEquations(
             std::function< StateType( const double, const StateType& ) > stateDerivativeFunction,
-            std::map< double, StateType >& solutionHistory,
+            SolutionHistoryType& solutionHistory,
             const StateType initialState,
             const std::shared_ptr< numerical_integrators::IntegratorSettings< double > > integratorSettings,
             const std::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
-            std::map< double, Eigen::VectorXd >& dependentVariableHistory,
+            DependentVariableHistoryType& dependentVariableHistory,
             std::map< double, double >& cumulativeComputationTimeHistory,
             const std::function< Eigen::VectorXd( ) > dependentVariableFunction = std::function< Eigen::VectorXd( ) >( ),
             const std::function< void( StateType& ) > statePostProcessingFunction = std::function< void( StateType& ) >( ),
             const double printInterval = TUDAT_NAN,
-            const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ) )
+            const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ),
+            const std::shared_ptr< PropagationCheckpointSettings< double > > checkpointSettings = nullptr,
+            const std::vector< std::function< StateType( const double, const StateType& ) > >&
+            additionalStateDerivativeFunctions = std::vector< std::function< StateType( const double, const StateType& ) > >( ) )
     {
         std::function< bool( const double, const double ) > stopPropagationFunction =
                 std::bind( &PropagationTerminationCondition::checkStopCondition, propagationTerminationCondition, std::placeholders::_1, std::placeholders::_2 );
@@ -734,7 +960,7 @@ public:
         // Create numerical integrator.
         std::shared_ptr< numerical_integrators::NumericalIntegrator< double, StateType, StateType > > integrator =
                 numerical_integrators::createIntegrator< double, StateType >(
-                    stateDerivativeFunction, initialState, integratorSettings );
+                    stateDerivativeFunction, initialState, integratorSettings, additionalStateDerivativeFunctions );
 
         if( integratorSettings->assessPropagationTerminationConditionDuringIntegrationSubsteps_ )
         {
@@ -749,7 +975,9 @@ public:
                     statePostProcessingFunction,
                     integratorSettings->saveFrequency_,
                     printInterval,
-                    initialClockTime );
+                    initialClockTime,
+                    integratorSettings->requestedOutputTimes_,
+                    checkpointSettings );
     }
 
 };
@@ -765,12 +993,13 @@ public:
      *  Function to numerically integrate a given first order differential equation, with the state derivative a function of
      *  a single independent variable and the current state
      *  \param stateDerivativeFunction Function returning the state derivative from current time and state.
-     *  \param solutionHistory History of numerical states given as map (time as key; returned by reference)
+     *  \param solutionHistory History of numerical states given as map (time as key), or as StateHistory (returned by
+     *  reference)
      *  \param initialState Initial state
      *  \param integratorSettings Settings for numerical integrator.
      *  \param propagationTerminationCondition Object to determine when/how the propagation is to be stopped at the current time.
-     *  \param dependentVariableHistory History of dependent variables that are to be saved given as map
-     *  (time as key; returned by reference)
+     *  \param dependentVariableHistory History of dependent variables that are to be saved given as map (time as key),
+     *  or as StateHistory (returned by reference)
      *  \param cumulativeComputationTimeHistory History of cumulative computation times that are to be saved given
      *  as map (time as key; returned by reference)
      *  \param dependentVariableFunction Function returning dependent variables (obtained from environment and state
@@ -779,20 +1008,30 @@ public:
      *  \param printInterval Frequency with which to print progress to console (nan = never).
      *  \param initialClockTime Initial clock time from which to determine cumulative computation time.
      *  By default now(), i.e. the moment at which this function is called.
+     *  \param checkpointSettings Settings for storing checkpoints of the integration loop, and for resuming the
+     *  integration from a checkpoint (none by default).
+     *  \param additionalStateDerivativeFunctions State derivative functions, equivalent to stateDerivativeFunction but
+     *  bound to separate copies of the dynamical model and environment, with which the extrapolation sequence of a
+     *  Bulirsch-Stoer integrator is evaluated concurrently (none by default, see createIntegrator).
      *  \return Event that triggered the termination of the propagation
      */
+    template< typename SolutionHistoryType = std::map< Time, StateType >,
+              typename DependentVariableHistoryType = std::map< Time, Eigen::VectorXd > >
     static std::shared_ptr< PropagationTerminationDetails > integrateEquations(
             std::function< StateType( const Time, const StateType& ) > stateDerivativeFunction,
-            std::map< Time, StateType >& solutionHistory,
+            SolutionHistoryType& solutionHistory,
             const StateType initialState,
             const std::shared_ptr< numerical_integrators::IntegratorSettings< Time > > integratorSettings,
             const std::shared_ptr< PropagationTerminationCondition > propagationTerminationCondition,
-            std::map< Time, Eigen::VectorXd >& dependentVariableHistory,
+            DependentVariableHistoryType& dependentVariableHistory,
             std::map< Time, double >& cumulativeComputationTimeHistory,
             const std::function< Eigen::VectorXd( ) > dependentVariableFunction = std::function< Eigen::VectorXd( ) >( ),
             const std::function< void( StateType& ) > statePostProcessingFunction = std::function< void( StateType& ) >( ),
             const Time printInterval = TUDAT_NAN,
-            const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ) )
+            const std::chrono::steady_clock::time_point initialClockTime = std::chrono::steady_clock::now( ),
+            const std::shared_ptr< PropagationCheckpointSettings< long double > > checkpointSettings = nullptr,
+            const std::vector< std::function< StateType( const Time, const StateType& ) > >&
+            additionalStateDerivativeFunctions = std::vector< std::function< StateType( const Time, const StateType& ) > >( ) )
     {
         std::function< bool( const double, const double ) > stopPropagationFunction =
                 std::bind( &PropagationTerminationCondition::checkStopCondition, propagationTerminationCondition, std::placeholders::_1, std::placeholders::_2 );
@@ -800,7 +1039,7 @@ public:
         // Create numerical integrator.
         std::shared_ptr< numerical_integrators::NumericalIntegrator< Time, StateType, StateType, long double > > integrator =
                 numerical_integrators::createIntegrator< Time, StateType, long double  >(
-                    stateDerivativeFunction, initialState, integratorSettings );
+                    stateDerivativeFunction, initialState, integratorSettings, additionalStateDerivativeFunctions );
 
         if( integratorSettings->assessPropagationTerminationConditionDuringIntegrationSubsteps_ )
         {
@@ -815,7 +1054,9 @@ public:
                     statePostProcessingFunction,
                     integratorSettings->saveFrequency_,
                     printInterval,
-                    initialClockTime );
+                    initialClockTime,
+                    integratorSettings->requestedOutputTimes_,
+                    checkpointSettings );
     }
 
 };
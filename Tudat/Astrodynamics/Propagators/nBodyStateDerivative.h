@@ -189,10 +189,23 @@ public:
     {
         for( unsigned int i = 0; i < accelerationModelList_.size( ); i++ )
         {
+            TUDAT_PROFILE_SCOPE( accelerationModelProfilingEntries_[ i ] );
             accelerationModelList_.at( i )->updateMembers( currentTime );
         }
     }
 
+    //! Function to set the object in which the computation time of the individual acceleration models is stored.
+    /*!
+     * Function to set the object in which the computation time of the individual acceleration models is stored, if Tudat
+     * is built with USE_PROFILING.
+     * \param profilingData Object in which the computation time of the acceleration models is stored.
+     */
+    void setProfilingData( const std::shared_ptr< utilities::ProfilingData > profilingData )
+    {
+        profilingData_ = profilingData;
+        createAccelerationModelList( );
+    }
+
     //! Function to convert the propagator-specific form of the state to the conventional form in the global frame.
     /*!
      * Function to convert the propagator-specific form of the state to the conventional form in the
@@ -334,6 +347,7 @@ protected:
     {
         // Iterate over all accelerations and update their internal state.
         accelerationModelList_.clear( );
+        accelerationModelProfilingEntries_.clear( );
         for( outerAccelerationIterator = accelerationModelsPerBody_.begin( );
              outerAccelerationIterator != accelerationModelsPerBody_.end( ); outerAccelerationIterator++ )
         {
@@ -346,11 +360,37 @@ protected:
                 for( unsigned int j = 0; j < innerAccelerationIterator->second.size( ); j++ )
                 {
                     accelerationModelList_.push_back( innerAccelerationIterator->second.at( j ) );
+                    accelerationModelProfilingEntries_.push_back(
+                                ( profilingData_ == nullptr ) ? nullptr : profilingData_->getEntry(
+                                    "Acceleration: " + getAccelerationModelProfilingName(
+                                        innerAccelerationIterator->second.at( j ) ) +
+                                    "of " + outerAccelerationIterator->first +
+                                    " exerted by " + innerAccelerationIterator->first ) );
                 }
             }
         }
     }
 
+    //! Function to get the name of an acceleration model type, as used in the profiling data.
+    /*!
+     * Function to get the name of an acceleration model type, as used in the profiling data.
+     * \param accelerationModel Acceleration model for which the name is to be retrieved
+     * \return Name of acceleration model type (followed by a space).
+     */
+    static std::string getAccelerationModelProfilingName(
+            const std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > accelerationModel )
+    {
+        try
+        {
+            return basic_astrodynamics::getAccelerationModelName(
+                        basic_astrodynamics::getAccelerationModelType( accelerationModel ) );
+        }
+        catch( const std::runtime_error& )
+        {
+            return "unidentified ";
+        }
+    }
+
     //! Function to get the state derivative of the system in Cartesian coordinates.
     /*!
      * Function to get the state derivative of the system in Cartesian coordinates. The environment
@@ -438,6 +478,12 @@ protected:
     //! Vector of acceleration models, containing all entries of accelerationModelsPerBody_.
     std::vector< std::shared_ptr< basic_astrodynamics::AccelerationModel< Eigen::Vector3d > > > accelerationModelList_;
 
+    //! Object in which the computation time of the acceleration models is stored (nullptr if not profiled).
+    std::shared_ptr< utilities::ProfilingData > profilingData_;
+
+    //! Profiling entries for each of the entries of accelerationModelList_ (nullptr if not profiled).
+    std::vector< utilities::ProfilingEntry* > accelerationModelProfilingEntries_;
+
     //! Object responsible for providing the current integration origins from the global origins.
     std::shared_ptr< CentralBodyData< StateScalarType, TimeType > > centralBodyData_;
 
@@ -15,6 +15,33 @@ namespace tudat
 namespace propagators
 {
 
+//! Function to get a string representing a type of propagated state.
+std::string getIntegratedStateTypeName( const IntegratedStateType stateType )
+{
+    std::string stateTypeName;
+    switch( stateType )
+    {
+    case hybrid:
+        stateTypeName = "hybrid";
+        break;
+    case translational_state:
+        stateTypeName = "translational";
+        break;
+    case rotational_state:
+        stateTypeName = "rotational";
+        break;
+    case body_mass_state:
+        stateTypeName = "mass";
+        break;
+    case custom_state:
+        stateTypeName = "custom";
+        break;
+    default:
+        throw std::runtime_error( "Did not recognize state type " + std::to_string( stateType ) + " when getting name" );
+    }
+    return stateTypeName;
+}
+
 //! Get size of state for single propagated state of given type.
 int getSingleIntegrationSize( const IntegratedStateType stateType )
 {
@@ -12,9 +12,12 @@
 #define TUDAT_STATEDERIVATIVE_H
 
 #include <map>
+#include <memory>
+#include <string>
 
 #include <Eigen/Core>
 
+#include "Tudat/Basics/profiling.h"
 #include "Tudat/Basics/timeType.h"
 #include <Tudat/Basics/utilityMacros.h>
 
@@ -34,6 +37,14 @@ enum IntegratedStateType
     custom_state = 4
 };
 
+//! Function to get a string representing a type of propagated state.
+/*!
+ * Function to get a string representing a type of propagated state.
+ * \param stateType Type of state
+ * \return String with state type id.
+ */
+std::string getIntegratedStateTypeName( const IntegratedStateType stateType );
+
 //! Get size of state for single propagated state of given type.
 /*!
  * Get size of state for single propagated state of given type (i.e. 6 for translational state).
@@ -229,6 +240,18 @@ public:
         return false;
     }
 
+    //! Function to set the object in which the computation time of the components of the state derivative is stored.
+    /*!
+     * Function to set the object in which the computation time of the components of the state derivative (e.g. the
+     * individual acceleration models) is stored, if Tudat is built with USE_PROFILING. Default implementation is empty,
+     * in which case only the total computation time of this object is recorded (by the DynamicsStateDerivativeModel).
+     * \param profilingData Object in which the computation time of the components of the state derivative is stored.
+     */
+    virtual void setProfilingData( const std::shared_ptr< utilities::ProfilingData > profilingData )
+    {
+        TUDAT_UNUSED_PARAMETER( profilingData );
+    }
+
 protected:
 
     //! Type of dynamics for which the state derivative is calculated.
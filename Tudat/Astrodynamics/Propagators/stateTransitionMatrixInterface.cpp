@@ -18,6 +18,23 @@ namespace tudat
 namespace propagators
 {
 
+//! Function to interpolate a matrix history into existing storage, without memory allocation if possible.
+void interpolateMatrixHistory(
+        const std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > >& matrixInterpolator,
+        const std::shared_ptr< interpolators::MatrixHistoryLagrangeInterpolator >& matrixHistoryInterpolator,
+        const double evaluationTime,
+        Eigen::Ref< Eigen::MatrixXd > interpolatedMatrix )
+{
+    if( matrixHistoryInterpolator != nullptr )
+    {
+        matrixHistoryInterpolator->interpolate( evaluationTime, interpolatedMatrix );
+    }
+    else
+    {
+        interpolatedMatrix = matrixInterpolator->interpolate( evaluationTime );
+    }
+}
+
 //! Function to reset the state transition and sensitivity matrix interpolators
 void SingleArcCombinedStateTransitionAndSensitivityMatrixInterface::updateMatrixInterpolators(
         const std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > >
@@ -27,25 +44,93 @@ void SingleArcCombinedStateTransitionAndSensitivityMatrixInterface::updateMatrix
 {
     stateTransitionMatrixInterpolator_ = stateTransitionMatrixInterpolator;
     sensitivityMatrixInterpolator_ = sensitivityMatrixInterpolator;
+
+    setMatrixHistoryInterpolators( );
 }
 
 //! Function to get the concatenated state transition and sensitivity matrix at a given time.
 Eigen::MatrixXd SingleArcCombinedStateTransitionAndSensitivityMatrixInterface::getCombinedStateTransitionAndSensitivityMatrix(
         const double evaluationTime )
 {
-    combinedStateTransitionMatrix_.setZero( );
+    Eigen::MatrixXd combinedStateTransitionMatrix;
+    getCombinedStateTransitionAndSensitivityMatrix( evaluationTime, combinedStateTransitionMatrix );
+    return combinedStateTransitionMatrix;
+}
+
+//! Function to get the concatenated state transition and sensitivity matrix at a given time, into existing storage.
+void SingleArcCombinedStateTransitionAndSensitivityMatrixInterface::getCombinedStateTransitionAndSensitivityMatrix(
+        const double evaluationTime, Eigen::MatrixXd& combinedStateTransitionMatrix )
+{
+    if( combinedStateTransitionMatrix.rows( ) != stateTransitionMatrixSize_ ||
+            combinedStateTransitionMatrix.cols( ) != stateTransitionMatrixSize_ + sensitivityMatrixSize_ )
+    {
+        combinedStateTransitionMatrix.resize( stateTransitionMatrixSize_, stateTransitionMatrixSize_ + sensitivityMatrixSize_ );
+    }
 
     // Set Phi and S matrices.
-    combinedStateTransitionMatrix_.block( 0, 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_ ) =
-            stateTransitionMatrixInterpolator_->interpolate( evaluationTime );
+    interpolateMatrixHistory( stateTransitionMatrixInterpolator_, stateTransitionMatrixHistoryInterpolator_, evaluationTime,
+                              combinedStateTransitionMatrix.leftCols( stateTransitionMatrixSize_ ) );
+
+    if( sensitivityMatrixSize_ > 0 )
+    {
+        interpolateMatrixHistory( sensitivityMatrixInterpolator_, sensitivityMatrixHistoryInterpolator_, evaluationTime,
+                                  combinedStateTransitionMatrix.rightCols( sensitivityMatrixSize_ ) );
+    }
+}
+
+//! Function to get the concatenated state transition and sensitivity matrices at a sorted list of times.
+void SingleArcCombinedStateTransitionAndSensitivityMatrixInterface::getFullCombinedStateTransitionAndSensitivityMatrices(
+        const std::vector< double >& evaluationTimes,
+        std::vector< Eigen::MatrixXd >& combinedStateTransitionMatrices )
+{
+    // Evaluate times one at a time if matrix histories can not be processed in a single pass.
+    if( stateTransitionMatrixHistoryInterpolator_ == nullptr ||
+            ( sensitivityMatrixSize_ > 0 && sensitivityMatrixHistoryInterpolator_ == nullptr ) )
+    {
+        CombinedStateTransitionAndSensitivityMatrixInterface::getFullCombinedStateTransitionAndSensitivityMatrices(
+                    evaluationTimes, combinedStateTransitionMatrices );
+        return;
+    }
+
+    combinedStateTransitionMatrices.resize( evaluationTimes.size( ) );
+    for( unsigned int i = 0; i < combinedStateTransitionMatrices.size( ); i++ )
+    {
+        if( combinedStateTransitionMatrices.at( i ).rows( ) != stateTransitionMatrixSize_ ||
+                combinedStateTransitionMatrices.at( i ).cols( ) != stateTransitionMatrixSize_ + sensitivityMatrixSize_ )
+        {
+            combinedStateTransitionMatrices.at( i ).resize(
+                        stateTransitionMatrixSize_, stateTransitionMatrixSize_ + sensitivityMatrixSize_ );
+        }
+    }
+
+    // Set Phi and S matrices, in single pass over each matrix history.
+    stateTransitionMatrixHistoryInterpolator_->interpolateAtSortedValues(
+                evaluationTimes, [ & ]( const int i )
+    {
+        return Eigen::Ref< Eigen::MatrixXd >(
+                    combinedStateTransitionMatrices[ i ].leftCols( stateTransitionMatrixSize_ ) );
+    } );
 
     if( sensitivityMatrixSize_ > 0 )
     {
-        combinedStateTransitionMatrix_.block( 0, stateTransitionMatrixSize_, stateTransitionMatrixSize_, sensitivityMatrixSize_ ) =
-                sensitivityMatrixInterpolator_->interpolate( evaluationTime );
+        sensitivityMatrixHistoryInterpolator_->interpolateAtSortedValues(
+                    evaluationTimes, [ & ]( const int i )
+        {
+            return Eigen::Ref< Eigen::MatrixXd >(
+                        combinedStateTransitionMatrices[ i ].rightCols( sensitivityMatrixSize_ ) );
+        } );
     }
+}
 
-    return combinedStateTransitionMatrix_;
+//! Function to set the matrix history interpolators from the state transition and sensitivity matrix interpolators.
+void SingleArcCombinedStateTransitionAndSensitivityMatrixInterface::setMatrixHistoryInterpolators( )
+{
+    stateTransitionMatrixHistoryInterpolator_ =
+            std::dynamic_pointer_cast< interpolators::MatrixHistoryLagrangeInterpolator >(
+                stateTransitionMatrixInterpolator_ );
+    sensitivityMatrixHistoryInterpolator_ =
+            std::dynamic_pointer_cast< interpolators::MatrixHistoryLagrangeInterpolator >(
+                sensitivityMatrixInterpolator_ );
 }
 
 //! Constructor
@@ -77,6 +162,8 @@ MultiArcCombinedStateTransitionAndSensitivityMatrixInterface::MultiArcCombinedSt
     arcSplitTimes.push_back(  std::numeric_limits< double >::max( ));
     lookUpscheme_ = std::make_shared< interpolators::HuntingAlgorithmLookupScheme< double > >(
                 arcSplitTimes );
+
+    setMatrixHistoryInterpolators( );
 }
 
 //! Function to reset the state transition and sensitivity matrix interpolators
@@ -103,6 +190,8 @@ void MultiArcCombinedStateTransitionAndSensitivityMatrixInterface::updateMatrixI
 
     lookUpscheme_ = std::make_shared< interpolators::HuntingAlgorithmLookupScheme< double > >(
                 arcSplitTimes );
+
+    setMatrixHistoryInterpolators( );
 }
 
 //! Function to get the concatenated single-arc state transition and sensitivity matrix at a given time.
@@ -126,20 +215,55 @@ Eigen::MatrixXd MultiArcCombinedStateTransitionAndSensitivityMatrixInterface::ge
 Eigen::MatrixXd MultiArcCombinedStateTransitionAndSensitivityMatrixInterface::getFullCombinedStateTransitionAndSensitivityMatrix(
         const double evaluationTime )
 {
-    Eigen::MatrixXd combinedStateTransitionMatrix = Eigen::MatrixXd::Zero(
-                stateTransitionMatrixSize_, numberOfStateArcs_ * stateTransitionMatrixSize_ + sensitivityMatrixSize_ );
+    Eigen::MatrixXd combinedStateTransitionMatrix;
+    getFullCombinedStateTransitionAndSensitivityMatrix( evaluationTime, combinedStateTransitionMatrix );
+    return combinedStateTransitionMatrix;
+}
+
+//! Function to get the concatenated state transition matrices for each arc and sensitivity matrix at a given time,
+//! into existing storage.
+void MultiArcCombinedStateTransitionAndSensitivityMatrixInterface::getFullCombinedStateTransitionAndSensitivityMatrix(
+        const double evaluationTime, Eigen::MatrixXd& combinedStateTransitionMatrix )
+{
+    if( combinedStateTransitionMatrix.rows( ) != stateTransitionMatrixSize_ ||
+            combinedStateTransitionMatrix.cols( ) != numberOfStateArcs_ * stateTransitionMatrixSize_ + sensitivityMatrixSize_ )
+    {
+        combinedStateTransitionMatrix.resize(
+                    stateTransitionMatrixSize_, numberOfStateArcs_ * stateTransitionMatrixSize_ + sensitivityMatrixSize_ );
+    }
+    combinedStateTransitionMatrix.setZero( );
 
     int currentArc = lookUpscheme_->findNearestLowerNeighbour( evaluationTime );
 
     // Set Phi and S matrices of current arc.
-    combinedStateTransitionMatrix.block( 0, currentArc * stateTransitionMatrixSize_, stateTransitionMatrixSize_, stateTransitionMatrixSize_ ) =
-            stateTransitionMatrixInterpolators_.at( currentArc )->interpolate( evaluationTime );
+    interpolateMatrixHistory( stateTransitionMatrixInterpolators_.at( currentArc ),
+                              stateTransitionMatrixHistoryInterpolators_.at( currentArc ), evaluationTime,
+                              combinedStateTransitionMatrix.block(
+                                  0, currentArc * stateTransitionMatrixSize_,
+                                  stateTransitionMatrixSize_, stateTransitionMatrixSize_ ) );
 
-    combinedStateTransitionMatrix.block(
-                0, numberOfStateArcs_ * stateTransitionMatrixSize_, stateTransitionMatrixSize_, sensitivityMatrixSize_ ) =
-            sensitivityMatrixInterpolators_.at( currentArc )->interpolate( evaluationTime );
+    if( sensitivityMatrixSize_ > 0 )
+    {
+        interpolateMatrixHistory( sensitivityMatrixInterpolators_.at( currentArc ),
+                                  sensitivityMatrixHistoryInterpolators_.at( currentArc ), evaluationTime,
+                                  combinedStateTransitionMatrix.rightCols( sensitivityMatrixSize_ ) );
+    }
+}
 
-    return combinedStateTransitionMatrix;
+//! Function to set the matrix history interpolators from the state transition and sensitivity matrix interpolators.
+void MultiArcCombinedStateTransitionAndSensitivityMatrixInterface::setMatrixHistoryInterpolators( )
+{
+    stateTransitionMatrixHistoryInterpolators_.clear( );
+    sensitivityMatrixHistoryInterpolators_.clear( );
+    for( int i = 0; i < numberOfStateArcs_; i++ )
+    {
+        stateTransitionMatrixHistoryInterpolators_.push_back(
+                    std::dynamic_pointer_cast< interpolators::MatrixHistoryLagrangeInterpolator >(
+                        stateTransitionMatrixInterpolators_.at( i ) ) );
+        sensitivityMatrixHistoryInterpolators_.push_back(
+                    std::dynamic_pointer_cast< interpolators::MatrixHistoryLagrangeInterpolator >(
+                        sensitivityMatrixInterpolators_.at( i ) ) );
+    }
 }
 
 //! Function to retrieve the current arc for a given time
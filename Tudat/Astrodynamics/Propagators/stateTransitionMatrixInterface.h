@@ -18,6 +18,7 @@
 
 #include <Eigen/Core>
 
+#include "Tudat/Mathematics/Interpolators/matrixHistoryLagrangeInterpolator.h"
 #include "Tudat/Mathematics/Interpolators/oneDimensionalInterpolator.h"
 
 namespace tudat
@@ -72,6 +73,42 @@ public:
      */
     virtual Eigen::MatrixXd getFullCombinedStateTransitionAndSensitivityMatrix( const double evaluationTime ) = 0;
 
+    //! Function to get the full concatenated state transition and sensitivity matrix at a given time, into existing storage.
+    /*!
+     *  Function to get the concatenated state transition and sensitivity matrix at a given time, which includes
+     *  zero values for parameters not active in current arc, into existing storage. Derived classes override this function
+     *  to avoid memory allocation when combinedStateTransitionMatrix already has the correct size.
+     *  \param evaluationTime Time at which to evaluate matrix interpolators
+     *  \param combinedStateTransitionMatrix Concatenated state transition and sensitivity matrices, including inactive
+     *  parameters at evaluationTime (returned by reference, resized if needed).
+     */
+    virtual void getFullCombinedStateTransitionAndSensitivityMatrix(
+            const double evaluationTime, Eigen::MatrixXd& combinedStateTransitionMatrix )
+    {
+        combinedStateTransitionMatrix = getFullCombinedStateTransitionAndSensitivityMatrix( evaluationTime );
+    }
+
+    //! Function to get the full concatenated state transition and sensitivity matrices at a sorted list of times.
+    /*!
+     *  Function to get the concatenated state transition and sensitivity matrices at a sorted list of times, which
+     *  include zero values for parameters not active in current arc. Derived classes override this function to evaluate
+     *  all times in a single pass over the matrix history.
+     *  \param evaluationTimes Times at which to evaluate matrix interpolators, sorted in ascending order.
+     *  \param combinedStateTransitionMatrices Concatenated state transition and sensitivity matrices at evaluationTimes
+     *  (returned by reference, existing entries of correct size are overwritten without allocation).
+     */
+    virtual void getFullCombinedStateTransitionAndSensitivityMatrices(
+            const std::vector< double >& evaluationTimes,
+            std::vector< Eigen::MatrixXd >& combinedStateTransitionMatrices )
+    {
+        combinedStateTransitionMatrices.resize( evaluationTimes.size( ) );
+        for( unsigned int i = 0; i < evaluationTimes.size( ); i++ )
+        {
+            getFullCombinedStateTransitionAndSensitivityMatrix(
+                        evaluationTimes.at( i ), combinedStateTransitionMatrices.at( i ) );
+        }
+    }
+
     //! Function to get the size of state transition matrix
     /*!
      * Function to get the size of state transition matrix
@@ -135,8 +172,7 @@ public:
         stateTransitionMatrixInterpolator_( stateTransitionMatrixInterpolator ),
         sensitivityMatrixInterpolator_( sensitivityMatrixInterpolator )
     {
-        combinedStateTransitionMatrix_ = Eigen::MatrixXd::Zero(
-                        stateTransitionMatrixSize_, stateTransitionMatrixSize_ + sensitivityMatrixSize_ );
+        setMatrixHistoryInterpolators( );
     }
 
     //! Destructor.
@@ -184,6 +220,18 @@ public:
      */
     Eigen::MatrixXd getCombinedStateTransitionAndSensitivityMatrix( const double evaluationTime );
 
+    //! Function to get the concatenated state transition and sensitivity matrix at a given time, into existing storage.
+    /*!
+     *  Function to get the concatenated state transition and sensitivity matrix at a given time, into existing storage.
+     *  If the matrix interpolators are of type MatrixHistoryLagrangeInterpolator, and combinedStateTransitionMatrix
+     *  already has the correct size, no memory is allocated.
+     *  \param evaluationTime Time at which to evaluate matrix interpolators
+     *  \param combinedStateTransitionMatrix Concatenated state transition and sensitivity matrices (returned by
+     *  reference, resized if needed).
+     */
+    void getCombinedStateTransitionAndSensitivityMatrix(
+            const double evaluationTime, Eigen::MatrixXd& combinedStateTransitionMatrix );
+
     //! Function to get the concatenated state transition and sensitivity matrix at a given time.
     /*!
      *  Function to get the concatenated state transition and sensitivity matrix at a given time
@@ -196,6 +244,33 @@ public:
         return getCombinedStateTransitionAndSensitivityMatrix( evaluationTime );
     }
 
+    //! Function to get the concatenated state transition and sensitivity matrix at a given time, into existing storage.
+    /*!
+     *  Function to get the concatenated state transition and sensitivity matrix at a given time, into existing storage
+     *  (functionality equal to getCombinedStateTransitionAndSensitivityMatrix for single-arc case).
+     *  \param evaluationTime Time at which to evaluate matrix interpolators
+     *  \param combinedStateTransitionMatrix Concatenated state transition and sensitivity matrices (returned by
+     *  reference, resized if needed).
+     */
+    void getFullCombinedStateTransitionAndSensitivityMatrix(
+            const double evaluationTime, Eigen::MatrixXd& combinedStateTransitionMatrix )
+    {
+        getCombinedStateTransitionAndSensitivityMatrix( evaluationTime, combinedStateTransitionMatrix );
+    }
+
+    //! Function to get the concatenated state transition and sensitivity matrices at a sorted list of times.
+    /*!
+     *  Function to get the concatenated state transition and sensitivity matrices at a sorted list of times. If the matrix
+     *  interpolators are of type MatrixHistoryLagrangeInterpolator, all times are evaluated in a single pass over the
+     *  matrix history, and no memory is allocated for existing entries of combinedStateTransitionMatrices of correct size.
+     *  \param evaluationTimes Times at which to evaluate matrix interpolators, sorted in ascending order.
+     *  \param combinedStateTransitionMatrices Concatenated state transition and sensitivity matrices at evaluationTimes
+     *  (returned by reference).
+     */
+    void getFullCombinedStateTransitionAndSensitivityMatrices(
+            const std::vector< double >& evaluationTimes,
+            std::vector< Eigen::MatrixXd >& combinedStateTransitionMatrices );
+
     //! Function to get the size of the total parameter vector.
     /*!
      * Function to get the size of the total parameter vector. For single-arc, this is simply the combination of
@@ -209,8 +284,8 @@ public:
 
 private:
 
-    //! Predefined matrix to use as return value when calling getCombinedStateTransitionAndSensitivityMatrix.
-    Eigen::MatrixXd combinedStateTransitionMatrix_;
+    //! Function to set the matrix history interpolators from the state transition and sensitivity matrix interpolators.
+    void setMatrixHistoryInterpolators( );
 
     //! Interpolator returning the state transition matrix as a function of time.
     std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > >
@@ -219,6 +294,12 @@ private:
     //! Interpolator returning the sensitivity matrix as a function of time.
     std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > >
     sensitivityMatrixInterpolator_;
+
+    //! Interpolator stateTransitionMatrixInterpolator_, cast to MatrixHistoryLagrangeInterpolator (nullptr if not possible).
+    std::shared_ptr< interpolators::MatrixHistoryLagrangeInterpolator > stateTransitionMatrixHistoryInterpolator_;
+
+    //! Interpolator sensitivityMatrixInterpolator_, cast to MatrixHistoryLagrangeInterpolator (nullptr if not possible).
+    std::shared_ptr< interpolators::MatrixHistoryLagrangeInterpolator > sensitivityMatrixHistoryInterpolator_;
 };
 
 //! Interface object of interpolation of numerically propagated state transition and sensitivity matrices for multi-arc
@@ -317,6 +398,19 @@ public:
      */
     Eigen::MatrixXd getFullCombinedStateTransitionAndSensitivityMatrix( const double evaluationTime );
 
+    //! Function to get the concatenated state transition matrices for each arc and sensitivity matrix at a given time,
+    //! into existing storage.
+    /*!
+     *  Function to get the concatenated state transition matrices for each arc and sensitivity matrix at a given time, into
+     *  existing storage. If the matrix interpolators are of type MatrixHistoryLagrangeInterpolator, and
+     *  combinedStateTransitionMatrix already has the correct size, no memory is allocated.
+     *  \param evaluationTime Time at which to evaluate matrix interpolators
+     *  \param combinedStateTransitionMatrix Concatenated state transition and sensitivity matrices (returned by
+     *  reference, resized if needed).
+     */
+    void getFullCombinedStateTransitionAndSensitivityMatrix(
+            const double evaluationTime, Eigen::MatrixXd& combinedStateTransitionMatrix );
+
     //! Function to retrieve the current arc for a given time
     /*!
      * Function to retrieve the current arc for a given time
@@ -337,6 +431,9 @@ public:
 
 private:
 
+    //! Function to set the matrix history interpolators from the state transition and sensitivity matrix interpolators.
+    void setMatrixHistoryInterpolators( );
+
     //! List of interpolators returning the state transition matrix as a function of time.
     std::vector< std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > > >
     stateTransitionMatrixInterpolators_;
@@ -345,6 +442,16 @@ private:
     std::vector< std::shared_ptr< interpolators::OneDimensionalInterpolator< double, Eigen::MatrixXd > > >
     sensitivityMatrixInterpolators_;
 
+    //! List of interpolators stateTransitionMatrixInterpolators_, cast to MatrixHistoryLagrangeInterpolator (nullptr if
+    //! not possible).
+    std::vector< std::shared_ptr< interpolators::MatrixHistoryLagrangeInterpolator > >
+    stateTransitionMatrixHistoryInterpolators_;
+
+    //! List of interpolators sensitivityMatrixInterpolators_, cast to MatrixHistoryLagrangeInterpolator (nullptr if
+    //! not possible).
+    std::vector< std::shared_ptr< interpolators::MatrixHistoryLagrangeInterpolator > >
+    sensitivityMatrixHistoryInterpolators_;
+
     //! Times at which the multiple arcs start
     std::vector< double > arcStartTimes_;
 
@@ -400,6 +507,8 @@ public:
     //! Destructor
     ~HybridArcCombinedStateTransitionAndSensitivityMatrixInterface( ){ }
 
+    using CombinedStateTransitionAndSensitivityMatrixInterface::getFullCombinedStateTransitionAndSensitivityMatrix;
+
     //! Function to get the size of the total parameter vector.
     /*!
      * Function to get the size of the total parameter vector.
@@ -33,16 +33,54 @@ void VariationalEquations::getBodyInitialStatePartialMatrix(
 {
     setBodyStatePartialMatrix( );
 
-    // Add partials of body positions and velocities.
-    currentMatrixDerivative.block( 0, 0, totalDynamicalStateSize_, numberOfParameterValues_ ) =
-            ( variationalMatrix_.template cast< StateScalarType >( ) * stateTransitionAndSensitivityMatrices );
+    // Add partials of body positions and velocities, skipping blocks of partial matrix that are zero by construction.
+    for( unsigned int i = 0; i < stateBlockIndices_.size( ); i++ )
+    {
+        const int rowStartIndex = stateBlockIndices_[ i ].first;
+        const int rowSize = stateBlockIndices_[ i ].second;
+
+        if( nonZeroStatePartialBlocks_[ i ].size( ) == 0 )
+        {
+            currentMatrixDerivative.block( rowStartIndex, 0, rowSize, numberOfParameterValues_ ).setZero( );
+        }
+
+        for( unsigned int j = 0; j < nonZeroStatePartialBlocks_[ i ].size( ); j++ )
+        {
+            const int columnStartIndex = stateBlockIndices_[ nonZeroStatePartialBlocks_[ i ][ j ] ].first;
+            const int columnSize = stateBlockIndices_[ nonZeroStatePartialBlocks_[ i ][ j ] ].second;
+
+            if( j == 0 )
+            {
+                currentMatrixDerivative.block( rowStartIndex, 0, rowSize, numberOfParameterValues_ ).noalias( ) =
+                        variationalMatrix_.block( rowStartIndex, columnStartIndex, rowSize, columnSize ).template
+                        cast< StateScalarType >( ) *
+                        stateTransitionAndSensitivityMatrices.block( columnStartIndex, 0, columnSize, numberOfParameterValues_ );
+            }
+            else
+            {
+                currentMatrixDerivative.block( rowStartIndex, 0, rowSize, numberOfParameterValues_ ).noalias( ) +=
+                        variationalMatrix_.block( rowStartIndex, columnStartIndex, rowSize, columnSize ).template
+                        cast< StateScalarType >( ) *
+                        stateTransitionAndSensitivityMatrices.block( columnStartIndex, 0, columnSize, numberOfParameterValues_ );
+            }
+        }
+    }
 }
 
 //! Calculates matrix containing partial derivatives of state derivatives w.r.t. body state.
 void VariationalEquations::setBodyStatePartialMatrix( )
 {
-    // Initialize partial matrix
-    variationalMatrix_.setZero( );
+    // Initialize partial matrix (blocks outside of sparsity pattern are never modified, and remain zero)
+    for( unsigned int i = 0; i < stateBlockIndices_.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < nonZeroStatePartialBlocks_[ i ].size( ); j++ )
+        {
+            variationalMatrix_.block( stateBlockIndices_[ i ].first,
+                                      stateBlockIndices_[ nonZeroStatePartialBlocks_[ i ][ j ] ].first,
+                                      stateBlockIndices_[ i ].second,
+                                      stateBlockIndices_[ nonZeroStatePartialBlocks_[ i ][ j ] ].second ).setZero( );
+        }
+    }
 
     if( dynamicalStatesToEstimate_.count( propagators::translational_state ) > 0 )
     {
@@ -68,7 +106,90 @@ void VariationalEquations::setBodyStatePartialMatrix( )
         }
     }
 
-    // Iterate over all bodies undergoing accelerations for which initial condition is to be estimated.
+    // Iterate over all partials w.r.t. current states of bodies for which initial condition is to be estimated.
+    for( unsigned int i = 0; i < statePartialFunctions_.size( ); i++ )
+    {
+        const std::array< int, 4 >& blockIndices = statePartialFunctions_[ i ].first;
+        statePartialFunctions_[ i ].second(
+                    variationalMatrix_.block( blockIndices[ 0 ], blockIndices[ 1 ], blockIndices[ 2 ], blockIndices[ 3 ] ) );
+    }
+
+   for( unsigned int i = 0; i < statePartialAdditionIndices_.size( ); i++ )
+   {
+       variationalMatrix_.block( 0, statePartialAdditionIndices_.at( i ).second, totalDynamicalStateSize_, 3 ) +=
+               variationalMatrix_.block( 0, statePartialAdditionIndices_.at( i ).first, totalDynamicalStateSize_, 3 );
+   }
+
+   for( unsigned int i = 0; i < inertiaTensorsForMultiplication_.size( ); i++ )
+   {
+       variationalMatrix_.block( inertiaTensorsForMultiplication_.at( i ).first, 0, 3, totalDynamicalStateSize_ ) =
+               ( inertiaTensorsForMultiplication_.at( i ).second( ).inverse( ) ) *
+               variationalMatrix_.block( inertiaTensorsForMultiplication_.at( i ).first, 0, 3, totalDynamicalStateSize_ ).eval( );
+   }
+
+}
+
+//! Function (called by constructor) to determine which blocks of the matrix of state partials can be non-zero
+void VariationalEquations::setStatePartialSparsityPattern( )
+{
+    // Partition state into states of single bodies.
+    std::map< int, int > blockSizesPerStartIndex;
+    for( std::map< propagators::IntegratedStateType, orbit_determination::StateDerivativePartialsMap >::iterator
+         partialTypeIterator = stateDerivativePartialList_.begin( );
+         partialTypeIterator != stateDerivativePartialList_.end( ); partialTypeIterator++ )
+    {
+        int startIndex = stateTypeStartIndices_.at( partialTypeIterator->first );
+        int currentStateSize = getSingleIntegrationSize( partialTypeIterator->first );
+        for( unsigned int i = 0; i < partialTypeIterator->second.size( ); i++ )
+        {
+            blockSizesPerStartIndex[ startIndex + i * currentStateSize ] = currentStateSize;
+        }
+    }
+
+    stateBlockIndices_.clear( );
+    bool isPartitionValid = true;
+    int currentIndex = 0;
+    for( std::map< int, int >::const_iterator blockIterator = blockSizesPerStartIndex.begin( );
+         blockIterator != blockSizesPerStartIndex.end( ); blockIterator++ )
+    {
+        if( blockIterator->first != currentIndex )
+        {
+            isPartitionValid = false;
+        }
+        stateBlockIndices_.push_back( *blockIterator );
+        currentIndex = blockIterator->first + blockIterator->second;
+    }
+
+    // If state entries are not uniquely partitioned into blocks, use single (dense) block.
+    if( !isPartitionValid || currentIndex != totalDynamicalStateSize_ )
+    {
+        stateBlockIndices_.clear( );
+        stateBlockIndices_.push_back( std::make_pair( 0, totalDynamicalStateSize_ ) );
+    }
+
+    // Function to retrieve index of block containing given entry of the state.
+    std::function< int( const int ) > getBlockIndex = [ & ]( const int stateIndex )
+    {
+        int blockIndex = 0;
+        while( blockIndex < static_cast< int >( stateBlockIndices_.size( ) ) - 1 &&
+               stateBlockIndices_[ blockIndex + 1 ].first <= stateIndex )
+        {
+            blockIndex++;
+        }
+        return blockIndex;
+    };
+
+    // Set diagonal blocks as non-zero.
+    const int numberOfBlocks = stateBlockIndices_.size( );
+    std::vector< std::vector< bool > > isBlockNonZero(
+                numberOfBlocks, std::vector< bool >( numberOfBlocks, false ) );
+    for( int i = 0; i < numberOfBlocks; i++ )
+    {
+        isBlockNonZero[ i ][ i ] = true;
+    }
+
+    // Set blocks with explicit state partials as non-zero, and store partial functions contiguously.
+    statePartialFunctions_.clear( );
     for( std::map< IntegratedStateType, std::vector< std::multimap< std::pair< int, int >,
          std::function< void( Eigen::Block< Eigen::MatrixXd > ) > > > >::iterator
          typeIterator = statePartialList_.begin( ); typeIterator != statePartialList_.end( ); typeIterator++ )
@@ -79,33 +200,57 @@ void VariationalEquations::setBodyStatePartialMatrix( )
 
         for( unsigned int i = 0; i < typeIterator->second.size( ); i++ )
         {
-            // Iterate over all bodies exerting an acceleration on this body.
             for( statePartialIterator_ = typeIterator->second.at( i ).begin( );
                  statePartialIterator_ != typeIterator->second.at( i ).end( );
                  statePartialIterator_++ )
             {
-                statePartialIterator_->second(
-                            variationalMatrix_.block(
-                                startIndex + entriesToSkipPerEntry + i* currentStateSize, statePartialIterator_->first.first,
-                                currentStateSize - entriesToSkipPerEntry, statePartialIterator_->first.second ) );
-
+                std::array< int, 4 > blockIndices =
+                {{ static_cast< int >( startIndex + entriesToSkipPerEntry + i * currentStateSize ),
+                   statePartialIterator_->first.first,
+                   currentStateSize - entriesToSkipPerEntry,
+                   statePartialIterator_->first.second }};
+                statePartialFunctions_.push_back( std::make_pair( blockIndices, statePartialIterator_->second ) );
+
+                for( int rowBlock = getBlockIndex( blockIndices[ 0 ] );
+                     rowBlock <= getBlockIndex( blockIndices[ 0 ] + blockIndices[ 2 ] - 1 ); rowBlock++ )
+                {
+                    for( int columnBlock = getBlockIndex( blockIndices[ 1 ] );
+                         columnBlock <= getBlockIndex( blockIndices[ 1 ] + blockIndices[ 3 ] - 1 ); columnBlock++ )
+                    {
+                        isBlockNonZero[ rowBlock ][ columnBlock ] = true;
+                    }
+                }
             }
         }
     }
 
-   for( unsigned int i = 0; i < statePartialAdditionIndices_.size( ); i++ )
-   {
-       variationalMatrix_.block( 0, statePartialAdditionIndices_.at( i ).second, totalDynamicalStateSize_, 3 ) +=
-               variationalMatrix_.block( 0, statePartialAdditionIndices_.at( i ).first, totalDynamicalStateSize_, 3 );
-   }
-
-   for( unsigned int i = 0; i < inertiaTensorsForMultiplication_.size( ); i++ )
-   {
-       variationalMatrix_.block( inertiaTensorsForMultiplication_.at( i ).first, 0, 3, totalDynamicalStateSize_ ) =
-               ( inertiaTensorsForMultiplication_.at( i ).second( ).inverse( ) ) *
-               variationalMatrix_.block( inertiaTensorsForMultiplication_.at( i ).first, 0, 3, totalDynamicalStateSize_ ).eval( );
-   }
+    // Add blocks that are filled by hierarchical estimation of dynamics (in same order as in setBodyStatePartialMatrix).
+    for( unsigned int i = 0; i < statePartialAdditionIndices_.size( ); i++ )
+    {
+        const int originalColumnBlock = getBlockIndex( statePartialAdditionIndices_.at( i ).first );
+        const int targetColumnBlock = getBlockIndex( statePartialAdditionIndices_.at( i ).second );
+        for( int rowBlock = 0; rowBlock < numberOfBlocks; rowBlock++ )
+        {
+            if( isBlockNonZero[ rowBlock ][ originalColumnBlock ] )
+            {
+                isBlockNonZero[ rowBlock ][ targetColumnBlock ] = true;
+            }
+        }
+    }
 
+    // Store list of non-zero blocks per row block.
+    nonZeroStatePartialBlocks_.clear( );
+    nonZeroStatePartialBlocks_.resize( numberOfBlocks );
+    for( int i = 0; i < numberOfBlocks; i++ )
+    {
+        for( int j = 0; j < numberOfBlocks; j++ )
+        {
+            if( isBlockNonZero[ i ][ j ] )
+            {
+                nonZeroStatePartialBlocks_[ i ].push_back( j );
+            }
+        }
+    }
 }
 
 //! Function to clear reference/cached values of state derivative partials.
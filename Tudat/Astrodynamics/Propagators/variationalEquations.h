@@ -10,6 +10,7 @@
 #ifndef TUDAT_VARIATIONALEQUATIONS_H
 #define TUDAT_VARIATIONALEQUATIONS_H
 
+#include <array>
 #include <map>
 #include <string>
 #include <vector>
@@ -103,6 +104,7 @@ public:
         setStatePartialFunctionList( );
         setTranslationalStatePartialFrameScalingFunctions( parametersToEstimate );
         setRotationalStatePartialScalingFunctions( parametersToEstimate );
+        setStatePartialSparsityPattern( );
         setParameterPartialFunctionList( parametersToEstimate );
     }
 
@@ -117,7 +119,9 @@ public:
     //! Function to compute the contribution of the derivatives w.r.t. current states in the variational equations
     /*!
      *  Function to compute the contribution of the derivatives w.r.t. current states in the variational equations,
-     *  e.g. first term in Eq. (7.45) in (Montenbruck & Gill, 2000).
+     *  e.g. first term in Eq. (7.45) in (Montenbruck & Gill, 2000). The product of the matrix of partials and the
+     *  state transition and sensitivity matrices is computed block-wise, skipping all blocks of the partial matrix that
+     *  are zero by construction (see setStatePartialSparsityPattern).
      *  \param stateTransitionAndSensitivityMatrices Current combined state transition and sensitivity matric
      *  \param currentMatrixDerivative Matrix block which is to return (by reference) the given contribution to the
      *  variational equations.
@@ -280,7 +284,40 @@ public:
     {
         return numberOfParameterValues_;
     }
-    
+
+    //! Function to retrieve the matrix of partial derivatives of state derivatives w.r.t. current states.
+    /*!
+     *  Function to retrieve the matrix of partial derivatives of state derivatives w.r.t. current states, as last computed
+     *  by setBodyStatePartialMatrix.
+     *  \return Matrix of partial derivatives of state derivatives w.r.t. current states.
+     */
+    const Eigen::MatrixXd& getStatePartialMatrix( )
+    {
+        return variationalMatrix_;
+    }
+
+    //! Function to retrieve the start index and size of the states of the single bodies into which the state is partitioned
+    /*!
+     *  Function to retrieve the start index and size of the states of the single bodies into which the state is
+     *  partitioned for the block-wise evaluation of the variational equations (see setStatePartialSparsityPattern).
+     *  \return Start index and size of the states of the single bodies.
+     */
+    const std::vector< std::pair< int, int > >& getStateBlockIndices( )
+    {
+        return stateBlockIndices_;
+    }
+
+    //! Function to retrieve the list of blocks of the matrix of state partials that can be non-zero, per row block.
+    /*!
+     *  Function to retrieve the list of blocks of the matrix of state partials that can be non-zero, per row block
+     *  (see setStatePartialSparsityPattern).
+     *  \return List of column blocks (indices in getStateBlockIndices( ) ) that can be non-zero, per row block.
+     */
+    const std::vector< std::vector< int > >& getNonZeroStatePartialBlocks( )
+    {
+        return nonZeroStatePartialBlocks_;
+    }
+
 protected:
     
 private:
@@ -292,6 +329,19 @@ private:
      */
     void setStatePartialFunctionList( );
 
+    //! Function (called by constructor) to determine which blocks of the matrix of state partials can be non-zero
+    /*!
+     * Function (called by constructor) to determine which blocks of the matrix of state partials (variationalMatrix_) can
+     * be non-zero. The state vector is partitioned into the states of the single bodies (stateBlockIndices_). A block of
+     * variationalMatrix_ (with rows of body i and columns of body j) can only be non-zero if it is on the diagonal, if
+     * one of the state derivative models of body i depends on the state of body j, or if it receives such a block due to
+     * hierarchical estimation of dynamics (statePartialAdditionIndices_). The resulting pattern (nonZeroStatePartialBlocks_)
+     * is used to skip zero blocks when setting and multiplying variationalMatrix_. In addition, the partial functions
+     * in statePartialList_ are copied to a contiguous list (statePartialFunctions_), with the matrix block that
+     * they set.
+     */
+    void setStatePartialSparsityPattern( );
+
     //! Function to add parameter partial functions for single state derivative model, and set of parameter objects.
     /*!
      *  Function to add parameter partial functions for single state derivative model, and set of parameter objects.
@@ -531,6 +581,20 @@ private:
     //! Pre-defined iterator for efficiency.
     std::multimap< std::pair< int, int >, std::function< void( Eigen::Block< Eigen::MatrixXd > ) > >::iterator
     statePartialIterator_;
+
+    //! Contiguous list of all functions in statePartialList_, with the block of variationalMatrix_ they set.
+    /*!
+     *  Contiguous list of all functions in statePartialList_, with the block of variationalMatrix_ they set (as start
+     *  row, start column, number of rows and number of columns).
+     */
+    std::vector< std::pair< std::array< int, 4 >, std::function< void( Eigen::Block< Eigen::MatrixXd > ) > > >
+    statePartialFunctions_;
+
+    //! Start index and size of the states of the single bodies into which the propagated state is partitioned.
+    std::vector< std::pair< int, int > > stateBlockIndices_;
+
+    //! List of blocks (indices in stateBlockIndices_) of columns of variationalMatrix_ that can be non-zero, per row block
+    std::vector< std::vector< int > > nonZeroStatePartialBlocks_;
     
     //! Vector of pair providing indices of column blocks of variational equations to add to other column blocks
     /*!
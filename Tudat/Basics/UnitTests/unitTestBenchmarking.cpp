@@ -0,0 +1,141 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Basics/benchmarking.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+//! Benchmark that sleeps for 100 microseconds per iteration, after an untimed set-up of 1 ms per iteration.
+void sleepingBenchmark( utilities::BenchmarkState& benchmarkState )
+{
+    while( benchmarkState.keepRunning( ) )
+    {
+        benchmarkState.pauseTiming( );
+        std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+        benchmarkState.resumeTiming( );
+
+        std::this_thread::sleep_for( std::chrono::microseconds( 100 ) );
+    }
+    benchmarkState.setItemsProcessed( 2 * benchmarkState.getNumberOfIterations( ) );
+    benchmarkState.setCounter( "sleepsPerIteration", 2.0 );
+}
+
+//! Benchmark performing a trivial computation.
+void summationBenchmark( utilities::BenchmarkState& benchmarkState )
+{
+    double sum = 0.0;
+    while( benchmarkState.keepRunning( ) )
+    {
+        sum += 1.0;
+        utilities::doNotOptimize( sum );
+    }
+}
+
+TUDAT_BENCHMARK_WITH_ITERATIONS( "Test/Sleep", &sleepingBenchmark, 5 );
+TUDAT_BENCHMARK( "Test/Summation", &summationBenchmark );
+
+BOOST_AUTO_TEST_SUITE( test_benchmarking )
+
+//! Test whether the benchmark state counts iterations and excludes paused time.
+BOOST_AUTO_TEST_CASE( testBenchmarkState )
+{
+    utilities::BenchmarkState benchmarkState( 5 );
+    sleepingBenchmark( benchmarkState );
+
+    BOOST_CHECK_EQUAL( benchmarkState.getNumberOfCompletedIterations( ), 5 );
+    BOOST_CHECK( benchmarkState.getElapsedRealNanoseconds( ) >= 5.0 * 100.0E3 );
+    BOOST_CHECK( benchmarkState.getElapsedRealNanoseconds( ) < 5.0 * 1.0E6 );
+    BOOST_CHECK_EQUAL( benchmarkState.getItemsProcessed( ), 10 );
+    BOOST_CHECK_EQUAL( benchmarkState.getCounters( ).at( "sleepsPerIteration" ), 2.0 );
+
+    // Check that a benchmark with zero iterations does not run its loop body.
+    utilities::BenchmarkState emptyBenchmarkState( 0 );
+    int numberOfLoopEvaluations = 0;
+    while( emptyBenchmarkState.keepRunning( ) )
+    {
+        numberOfLoopEvaluations++;
+    }
+    BOOST_CHECK_EQUAL( numberOfLoopEvaluations, 0 );
+}
+
+//! Test whether registered benchmarks are run with the correct settings, and results are properly written.
+BOOST_AUTO_TEST_CASE( testBenchmarkRun )
+{
+    BOOST_CHECK_EQUAL( utilities::getRegisteredBenchmarks( ).size( ), 2 );
+
+    // Run benchmark with fixed number of iterations, with repetitions.
+    utilities::BenchmarkRunSettings runSettings;
+    runSettings.nameFilter = "Sleep";
+    runSettings.numberOfRepetitions = 3;
+    std::vector< utilities::BenchmarkResult > benchmarkResults =
+            utilities::runRegisteredBenchmarks( runSettings, nullptr );
+
+    BOOST_CHECK_EQUAL( benchmarkResults.size( ), 6 );
+    for( unsigned int i = 0; i < 3; i++ )
+    {
+        BOOST_CHECK_EQUAL( benchmarkResults.at( i ).resultName, "Test/Sleep" );
+        BOOST_CHECK_EQUAL( benchmarkResults.at( i ).repetitionIndex, static_cast< int >( i ) );
+        BOOST_CHECK_EQUAL( benchmarkResults.at( i ).numberOfIterations, 5 );
+        BOOST_CHECK( benchmarkResults.at( i ).realTimePerIteration >= 100.0E3 );
+        BOOST_CHECK( benchmarkResults.at( i ).itemsPerSecond > 0.0 );
+        BOOST_CHECK_EQUAL( benchmarkResults.at( i ).counters.at( "sleepsPerIteration" ), 2.0 );
+    }
+    BOOST_CHECK_EQUAL( benchmarkResults.at( 3 ).resultName, "Test/Sleep_mean" );
+    BOOST_CHECK_EQUAL( benchmarkResults.at( 4 ).resultName, "Test/Sleep_median" );
+    BOOST_CHECK_EQUAL( benchmarkResults.at( 5 ).resultName, "Test/Sleep_stddev" );
+    BOOST_CHECK_CLOSE_FRACTION( benchmarkResults.at( 3 ).realTimePerIteration,
+                                ( benchmarkResults.at( 0 ).realTimePerIteration +
+                                  benchmarkResults.at( 1 ).realTimePerIteration +
+                                  benchmarkResults.at( 2 ).realTimePerIteration ) / 3.0, 1.0E-14 );
+    BOOST_CHECK_EQUAL( benchmarkResults.at( 3 ).counters.at( "sleepsPerIteration" ), 2.0 );
+    BOOST_CHECK_EQUAL( benchmarkResults.at( 5 ).counters.at( "sleepsPerIteration" ), 0.0 );
+
+    // Check that counters are written to JSON output.
+    std::ostringstream counterJsonStream;
+    utilities::writeBenchmarkResultsToJson( benchmarkResults, "test", counterJsonStream );
+    BOOST_CHECK( counterJsonStream.str( ).find( "\"sleepsPerIteration\": 2," ) != std::string::npos );
+
+    // Run benchmark for which the number of iterations is determined from the minimum time.
+    runSettings.nameFilter = "Summation";
+    runSettings.numberOfRepetitions = 1;
+    runSettings.minimumTime = 0.01;
+    benchmarkResults = utilities::runRegisteredBenchmarks( runSettings, nullptr );
+    BOOST_CHECK_EQUAL( benchmarkResults.size( ), 1 );
+    BOOST_CHECK( benchmarkResults.at( 0 ).numberOfIterations > 1000 );
+    BOOST_CHECK( benchmarkResults.at( 0 ).numberOfIterations * benchmarkResults.at( 0 ).realTimePerIteration >= 0.01E9 );
+
+    // Check JSON output.
+    std::ostringstream jsonStream;
+    utilities::writeBenchmarkResultsToJson( benchmarkResults, "test", jsonStream );
+    const std::string jsonOutput = jsonStream.str( );
+    BOOST_CHECK( jsonOutput.find( "\"context\": {" ) != std::string::npos );
+    BOOST_CHECK( jsonOutput.find( "\"name\": \"Test/Summation\"" ) != std::string::npos );
+    BOOST_CHECK( jsonOutput.find( "\"run_type\": \"iteration\"" ) != std::string::npos );
+    BOOST_CHECK( jsonOutput.find( "\"time_unit\": \"ns\"" ) != std::string::npos );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -0,0 +1,188 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <algorithm>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Basics/binarySerialization.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_binary_serialization )
+
+//! Test whether values written to a binary stream are read back identically.
+BOOST_AUTO_TEST_CASE( testBinarySerializationRoundTrip )
+{
+    const int integerValue = -42;
+    const unsigned int unsignedValue = 42;
+    const bool booleanValue = true;
+    const long double longDoubleValue = 1.0L / 3.0L;
+    const Time timeValue( 12, 1234.5678L );
+    const std::string stringValue = std::string( "binary\0string", 13 );
+    const Eigen::Vector3d fixedSizeVector( 1.0 / 3.0, -2.0, 1.0E-300 );
+    const Eigen::Matrix< long double, Eigen::Dynamic, Eigen::Dynamic > dynamicMatrix =
+            Eigen::Matrix< long double, Eigen::Dynamic, Eigen::Dynamic >::Random( 4, 7 );
+    const std::vector< Eigen::VectorXd > vectorOfVectors = { Eigen::VectorXd::Random( 3 ), Eigen::VectorXd( ) };
+    const std::map< double, unsigned int > map = { { -1.5, 3 }, { 0.0, 5 }, { 2.5, 8 } };
+    const std::map< Time, double > timeMap = { { Time( 1, 0.5L ), 0.25 }, { Time( -2, 3.0L ), 1.0 } };
+
+    utilities::StateHistory< double, long double > stateHistory;
+    for( int i = 0; i < 5; i++ )
+    {
+        stateHistory.addEntry( -10.0 * i, Eigen::Matrix< long double, Eigen::Dynamic, 1 >::Constant( 2, i / 3.0L ) );
+    }
+
+    std::ostringstream outputStream;
+    utilities::writeToBinaryStream( outputStream, integerValue );
+    utilities::writeToBinaryStream( outputStream, unsignedValue );
+    utilities::writeToBinaryStream( outputStream, booleanValue );
+    utilities::writeToBinaryStream( outputStream, longDoubleValue );
+    utilities::writeToBinaryStream( outputStream, timeValue );
+    utilities::writeToBinaryStream( outputStream, stringValue );
+    utilities::writeToBinaryStream( outputStream, fixedSizeVector );
+    utilities::writeToBinaryStream( outputStream, dynamicMatrix );
+    utilities::writeToBinaryStream( outputStream, vectorOfVectors );
+    utilities::writeToBinaryStream( outputStream, map );
+    utilities::writeToBinaryStream( outputStream, timeMap );
+    utilities::writeToBinaryStream( outputStream, stateHistory );
+
+    int readIntegerValue;
+    unsigned int readUnsignedValue;
+    bool readBooleanValue;
+    long double readLongDoubleValue;
+    Time readTimeValue;
+    std::string readStringValue;
+    Eigen::Vector3d readFixedSizeVector;
+    Eigen::Matrix< long double, Eigen::Dynamic, Eigen::Dynamic > readDynamicMatrix;
+    std::vector< Eigen::VectorXd > readVectorOfVectors;
+    std::map< double, unsigned int > readMap = { { 100.0, 1 } };
+    std::map< Time, double > readTimeMap;
+    utilities::StateHistory< double, long double > readStateHistory( 10, 10 );
+
+    std::istringstream inputStream( outputStream.str( ) );
+    utilities::readFromBinaryStream( inputStream, readIntegerValue );
+    utilities::readFromBinaryStream( inputStream, readUnsignedValue );
+    utilities::readFromBinaryStream( inputStream, readBooleanValue );
+    utilities::readFromBinaryStream( inputStream, readLongDoubleValue );
+    utilities::readFromBinaryStream( inputStream, readTimeValue );
+    utilities::readFromBinaryStream( inputStream, readStringValue );
+    utilities::readFromBinaryStream( inputStream, readFixedSizeVector );
+    utilities::readFromBinaryStream( inputStream, readDynamicMatrix );
+    utilities::readFromBinaryStream( inputStream, readVectorOfVectors );
+    utilities::readFromBinaryStream( inputStream, readMap );
+    utilities::readFromBinaryStream( inputStream, readTimeMap );
+    utilities::readFromBinaryStream( inputStream, readStateHistory );
+
+    BOOST_CHECK_EQUAL( readIntegerValue, integerValue );
+    BOOST_CHECK_EQUAL( readUnsignedValue, unsignedValue );
+    BOOST_CHECK_EQUAL( readBooleanValue, booleanValue );
+    BOOST_CHECK( readLongDoubleValue == longDoubleValue );
+    BOOST_CHECK( readTimeValue == timeValue );
+    BOOST_CHECK( readStringValue == stringValue );
+    BOOST_CHECK( readFixedSizeVector == fixedSizeVector );
+    BOOST_CHECK( readDynamicMatrix == dynamicMatrix );
+    BOOST_CHECK_EQUAL( readVectorOfVectors.size( ), vectorOfVectors.size( ) );
+    BOOST_CHECK( readVectorOfVectors.at( 0 ) == vectorOfVectors.at( 0 ) );
+    BOOST_CHECK_EQUAL( readVectorOfVectors.at( 1 ).rows( ), 0 );
+    BOOST_CHECK( readMap == map );
+    BOOST_CHECK( readTimeMap == timeMap );
+
+    BOOST_CHECK_EQUAL( readStateHistory.size( ), stateHistory.size( ) );
+    BOOST_CHECK_EQUAL( readStateHistory.getStateSize( ), 2 );
+    for( int i = 0; i < stateHistory.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( readStateHistory.getTime( i ), stateHistory.getTime( i ) );
+        BOOST_CHECK( readStateHistory.getState( i ) == stateHistory.getState( i ) );
+    }
+
+    // Check that reading beyond the end of the stream throws an exception.
+    BOOST_CHECK_THROW( utilities::readFromBinaryStream( inputStream, readIntegerValue ), std::runtime_error );
+}
+
+//! Test whether reading invalid data from a binary stream throws an exception.
+BOOST_AUTO_TEST_CASE( testBinarySerializationErrors )
+{
+    // Check that a matrix of incompatible size cannot be read into a fixed-size matrix.
+    {
+        std::ostringstream outputStream;
+        utilities::writeToBinaryStream( outputStream, Eigen::Vector4d::Zero( ).eval( ) );
+        std::istringstream inputStream( outputStream.str( ) );
+        Eigen::Vector3d readVector;
+        BOOST_CHECK_THROW( utilities::readFromBinaryStream( inputStream, readVector ), std::runtime_error );
+    }
+
+    // Check that a truncated stream cannot be read.
+    {
+        std::ostringstream outputStream;
+        utilities::writeToBinaryStream( outputStream, Eigen::VectorXd::Ones( 10 ).eval( ) );
+        const std::string truncatedData = outputStream.str( ).substr( 0, outputStream.str( ).size( ) - 1 );
+        std::istringstream inputStream( truncatedData );
+        Eigen::VectorXd readVector;
+        BOOST_CHECK_THROW( utilities::readFromBinaryStream( inputStream, readVector ), std::runtime_error );
+    }
+}
+
+//! Test whether a state history can be written and read in segments.
+BOOST_AUTO_TEST_CASE( testBinarySerializationOfStateHistorySegments )
+{
+    utilities::StateHistory< double, double > stateHistory;
+    std::ostringstream outputStream;
+    int numberOfWrittenEntries = 0;
+    for( int i = 0; i < 10; i++ )
+    {
+        stateHistory.addEntry( -0.5 * i, Eigen::Vector3d::Constant( i ) );
+        if( i == 4 )
+        {
+            // Overwrite last entry, which is written again in the next segment.
+            stateHistory.addEntry( -0.5 * i, Eigen::Vector3d::Constant( -i ) );
+        }
+
+        if( i % 3 == 1 || i == 9 )
+        {
+            utilities::writeToBinaryStream( outputStream, stateHistory, std::max( numberOfWrittenEntries - 1, 0 ) );
+            numberOfWrittenEntries = stateHistory.size( );
+        }
+    }
+
+    // Rebuild history from segments.
+    std::istringstream inputStream( outputStream.str( ) );
+    utilities::StateHistory< double, double > readStateHistory;
+    for( int i = 0; i < 4; i++ )
+    {
+        utilities::appendFromBinaryStream( inputStream, readStateHistory );
+    }
+
+    BOOST_CHECK_EQUAL( readStateHistory.size( ), stateHistory.size( ) );
+    BOOST_CHECK_EQUAL( readStateHistory.getStateSize( ), 3 );
+    for( int i = 0; i < stateHistory.size( ); i++ )
+    {
+        BOOST_CHECK_EQUAL( readStateHistory.getTime( i ), stateHistory.getTime( i ) );
+        BOOST_CHECK( readStateHistory.getState( i ) == stateHistory.getState( i ) );
+    }
+    BOOST_CHECK_THROW( utilities::appendFromBinaryStream( inputStream, readStateHistory ), std::runtime_error );
+    BOOST_CHECK_THROW( utilities::writeToBinaryStream( outputStream, stateHistory, 11 ), std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -0,0 +1,126 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Basics/parallelization.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_parallelization )
+
+//! Test if parallel loop produces results identical to serial loop, for various numbers of threads
+BOOST_AUTO_TEST_CASE( testParallelLoop )
+{
+    int numberOfIterations = 1000;
+
+    // Compute reference results serially
+    std::vector< double > serialResults( numberOfIterations );
+    for( int i = 0; i < numberOfIterations; i++ )
+    {
+        serialResults[ i ] = std::sin( 0.1 * i ) * std::exp( -1.0E-3 * i );
+    }
+
+    for( int numberOfThreads = 0; numberOfThreads < 6; numberOfThreads++ )
+    {
+        std::vector< double > parallelResults( numberOfIterations, 0.0 );
+        std::vector< int > numberOfEvaluations( numberOfIterations, 0 );
+        utilities::executeParallelLoop(
+                    numberOfIterations, numberOfThreads, [ & ]( const int i )
+        {
+            parallelResults[ i ] = std::sin( 0.1 * i ) * std::exp( -1.0E-3 * i );
+            numberOfEvaluations[ i ]++;
+        } );
+
+        // Check that each iteration is performed exactly once, and results are bitwise identical
+        for( int i = 0; i < numberOfIterations; i++ )
+        {
+            BOOST_CHECK_EQUAL( numberOfEvaluations[ i ], 1 );
+            BOOST_CHECK_EQUAL( parallelResults[ i ], serialResults[ i ] );
+        }
+    }
+
+    BOOST_CHECK_EQUAL( utilities::getNumberOfHardwareThreads( ) >= 1, true );
+}
+
+//! Test if worker indices are provided correctly, and each worker executes its iterations sequentially
+BOOST_AUTO_TEST_CASE( testParallelLoopWorkerIndex )
+{
+    int numberOfIterations = 200;
+    int numberOfThreads = 4;
+
+    // Count iterations that are active per worker (must never exceed 1)
+    std::vector< int > activeIterationsPerWorker( numberOfThreads, 0 );
+    std::vector< int > maximumActiveIterationsPerWorker( numberOfThreads, 0 );
+    std::vector< int > workerIndices( numberOfIterations, -1 );
+    utilities::executeParallelLoopWithWorkerIndex(
+                numberOfIterations, numberOfThreads, [ & ]( const int i, const int workerIndex )
+    {
+        activeIterationsPerWorker[ workerIndex ]++;
+        maximumActiveIterationsPerWorker[ workerIndex ] = std::max(
+                    maximumActiveIterationsPerWorker[ workerIndex ], activeIterationsPerWorker[ workerIndex ] );
+        workerIndices[ i ] = workerIndex;
+        activeIterationsPerWorker[ workerIndex ]--;
+    } );
+
+    for( int i = 0; i < numberOfIterations; i++ )
+    {
+        BOOST_CHECK_EQUAL( ( workerIndices[ i ] >= 0 ) && ( workerIndices[ i ] < numberOfThreads ), true );
+    }
+    for( int i = 0; i < numberOfThreads; i++ )
+    {
+        BOOST_CHECK_EQUAL( maximumActiveIterationsPerWorker[ i ] <= 1, true );
+    }
+
+    // Check that serial execution uses worker 0
+    utilities::executeParallelLoopWithWorkerIndex(
+                10, 1, [ & ]( const int, const int workerIndex )
+    {
+        BOOST_CHECK_EQUAL( workerIndex, 0 );
+    } );
+}
+
+//! Test if exceptions thrown in worker threads are propagated to the calling thread
+BOOST_AUTO_TEST_CASE( testParallelLoopException )
+{
+    bool isExceptionCaught = false;
+    try
+    {
+        utilities::executeParallelLoop(
+                    100, 4, [ & ]( const int i )
+        {
+            if( i == 37 )
+            {
+                throw std::runtime_error( "Test exception" );
+            }
+        } );
+    }
+    catch( std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -0,0 +1,89 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Basics/profiling.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_profiling )
+
+//! Test whether the computation time of (nested) components is properly accumulated and reported.
+BOOST_AUTO_TEST_CASE( testProfilingData )
+{
+    utilities::ProfilingData profilingData;
+    utilities::ProfilingEntry* outerEntry = profilingData.getEntry( "Outer" );
+    utilities::ProfilingEntry* innerEntry = profilingData.getEntry( "Inner" );
+    profilingData.getEntry( "Unused" );
+
+    // Check that entries are not duplicated, and remain valid when registering new entries.
+    BOOST_CHECK_EQUAL( profilingData.getEntry( "Outer" ), outerEntry );
+
+    for( int i = 0; i < 4; i++ )
+    {
+        utilities::ScopedProfilingTimer outerTimer( outerEntry );
+        for( int j = 0; j < 3; j++ )
+        {
+            utilities::ScopedProfilingTimer innerTimer( innerEntry );
+            std::this_thread::sleep_for( std::chrono::microseconds( 200 ) );
+        }
+
+        // Check that a timer without entry does nothing.
+        utilities::ScopedProfilingTimer emptyTimer( nullptr );
+    }
+
+    BOOST_CHECK_EQUAL( outerEntry->numberOfCalls, 4 );
+    BOOST_CHECK_EQUAL( innerEntry->numberOfCalls, 12 );
+    BOOST_CHECK( innerEntry->totalNanoseconds >= 12 * 200000 );
+    BOOST_CHECK( outerEntry->totalNanoseconds >= innerEntry->totalNanoseconds );
+
+    // Check report, which should not contain components that have not been called.
+    std::vector< utilities::ProfilingReportEntry > profilingReport = profilingData.getProfilingReport( "Outer" );
+    BOOST_CHECK_EQUAL( profilingReport.size( ), 2 );
+    BOOST_CHECK_EQUAL( profilingReport.at( 0 ).componentName, "Outer" );
+    BOOST_CHECK_EQUAL( profilingReport.at( 1 ).componentName, "Inner" );
+    BOOST_CHECK_EQUAL( profilingReport.at( 0 ).fractionOfTotalTime, 1.0 );
+    BOOST_CHECK( profilingReport.at( 1 ).fractionOfTotalTime > 0.0 && profilingReport.at( 1 ).fractionOfTotalTime <= 1.0 );
+    BOOST_CHECK_CLOSE_FRACTION( profilingReport.at( 1 ).meanNanoseconds,
+                                static_cast< double >( innerEntry->totalNanoseconds ) / 12.0, 1.0E-15 );
+
+    // Check that the component with largest time is used as reference if none is provided.
+    std::vector< utilities::ProfilingReportEntry > defaultProfilingReport = profilingData.getProfilingReport( );
+    BOOST_CHECK_EQUAL( defaultProfilingReport.at( 1 ).fractionOfTotalTime, profilingReport.at( 1 ).fractionOfTotalTime );
+
+    std::ostringstream reportStream;
+    profilingData.printProfilingReport( "Outer", reportStream );
+    BOOST_CHECK( reportStream.str( ).find( "Inner, 12, " ) != std::string::npos );
+
+    // Check that resetting retains the registered entries.
+    profilingData.reset( );
+    BOOST_CHECK_EQUAL( outerEntry->numberOfCalls, 0 );
+    BOOST_CHECK_EQUAL( outerEntry->totalNanoseconds, 0 );
+    BOOST_CHECK_EQUAL( profilingData.getEntry( "Inner" ), innerEntry );
+    BOOST_CHECK_EQUAL( profilingData.getProfilingReport( ).size( ), 0 );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -0,0 +1,143 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include "Tudat/Basics/stateHistory.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+BOOST_AUTO_TEST_SUITE( test_state_history )
+
+//! Test addition, retrieval and removal of entries, and conversion to/from map.
+BOOST_AUTO_TEST_CASE( testStateHistoryEntries )
+{
+    utilities::StateHistory< double, double > stateHistory( 0, 10 );
+    std::map< double, Eigen::VectorXd > historyMap;
+
+    // Add entries, and add same entries to map
+    for( int i = 0; i < 10; i++ )
+    {
+        Eigen::VectorXd currentState = ( Eigen::VectorXd( 3 ) << 1.0 * i, 2.0 * i, 3.0 * i ).finished( );
+        stateHistory.addEntry( 10.0 * i, currentState );
+        historyMap[ 10.0 * i ] = currentState;
+    }
+
+    BOOST_CHECK_EQUAL( stateHistory.size( ), 10 );
+    BOOST_CHECK_EQUAL( stateHistory.getStateSize( ), 3 );
+    BOOST_CHECK_EQUAL( stateHistory.isInAscendingOrder( ), true );
+    BOOST_CHECK_EQUAL( stateHistory.getLastTime( ), 90.0 );
+
+    // Check that states are stored contiguously, one state per row
+    Eigen::MatrixXd stateBlock = stateHistory.getStateBlock( );
+    BOOST_CHECK_EQUAL( stateBlock.rows( ), 10 );
+    BOOST_CHECK_EQUAL( stateBlock.cols( ), 3 );
+    for( int i = 0; i < 10; i++ )
+    {
+        BOOST_CHECK_EQUAL( stateHistory.getTime( i ), 10.0 * i );
+        for( int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK_EQUAL( stateHistory.getState( i )( j ), ( j + 1.0 ) * i );
+            BOOST_CHECK_EQUAL( stateBlock( i, j ), ( j + 1.0 ) * i );
+            BOOST_CHECK_EQUAL( ( &stateHistory.getState( 0 )( 0 ) )[ 3 * i + j ], ( j + 1.0 ) * i );
+        }
+    }
+
+    // Check map view of history
+    std::map< double, Eigen::VectorXd > retrievedMap = stateHistory.getHistoryMap( );
+    BOOST_CHECK_EQUAL( retrievedMap.size( ), historyMap.size( ) );
+    for( auto mapIterator : historyMap )
+    {
+        BOOST_CHECK_EQUAL( ( retrievedMap.at( mapIterator.first ) - mapIterator.second ).norm( ), 0.0 );
+    }
+
+    // Check creation from map
+    utilities::StateHistory< double, double > stateHistoryFromMap( historyMap );
+    BOOST_CHECK_EQUAL( stateHistoryFromMap.size( ), 10 );
+    BOOST_CHECK_EQUAL( ( Eigen::MatrixXd( stateHistoryFromMap.getStateBlock( ) ) - stateBlock ).norm( ), 0.0 );
+
+    // Check overwriting of last entry, and removal of last entry
+    stateHistory.addEntry( 90.0, Eigen::Vector3d::Constant( -1.0 ) );
+    BOOST_CHECK_EQUAL( stateHistory.size( ), 10 );
+    BOOST_CHECK_EQUAL( stateHistory.getState( 9 )( 2 ), -1.0 );
+    stateHistory.removeLastEntry( );
+    BOOST_CHECK_EQUAL( stateHistory.size( ), 9 );
+    BOOST_CHECK_EQUAL( stateHistory.getLastTime( ), 80.0 );
+
+    // Check that inconsistent entries are rejected
+    BOOST_CHECK_THROW( stateHistory.addEntry( 20.0, Eigen::Vector3d::Zero( ) ), std::runtime_error );
+    BOOST_CHECK_THROW( stateHistory.addEntry( 100.0, Eigen::Vector2d::Zero( ) ), std::runtime_error );
+
+    // Check that memory is retained after clearing history
+    const double* dataPointer = &stateHistory.getState( 0 )( 0 );
+    stateHistory.clear( );
+    BOOST_CHECK_EQUAL( stateHistory.size( ), 0 );
+    for( int i = 0; i < 10; i++ )
+    {
+        stateHistory.addEntry( 10.0 * i, Eigen::Vector3d::Constant( i ) );
+    }
+    BOOST_CHECK_EQUAL( &stateHistory.getState( 0 )( 0 ), dataPointer );
+}
+
+//! Test history of backward propagation, and retrieval of sorted (segments of) states.
+BOOST_AUTO_TEST_CASE( testBackwardStateHistory )
+{
+    utilities::StateHistory< double, long double > stateHistory;
+    for( int i = 0; i < 5; i++ )
+    {
+        Eigen::Matrix< long double, Eigen::Dynamic, 1 > currentState =
+                Eigen::Matrix< long double, Eigen::Dynamic, 1 >::LinSpaced( 7, -1.0L * i, 6.0L - i );
+        stateHistory.addEntry( -2.0 * i, currentState );
+    }
+    BOOST_CHECK_EQUAL( stateHistory.isInAscendingOrder( ), false );
+    BOOST_CHECK_EQUAL( stateHistory.getLastTime( ), -8.0 );
+    BOOST_CHECK_THROW( stateHistory.addEntry( 0.0, stateHistory.getState( 0 ) ), std::runtime_error );
+
+    // Retrieve sorted segment of states
+    std::vector< double > times;
+    std::vector< Eigen::Matrix< long double, 3, 1 > > states;
+    stateHistory.getSortedTimesAndStates( times, states, 2, 3 );
+    BOOST_CHECK_EQUAL( times.size( ), 5 );
+    BOOST_CHECK_EQUAL( states.size( ), 5 );
+    for( int i = 0; i < 5; i++ )
+    {
+        BOOST_CHECK_EQUAL( times.at( i ), -2.0 * ( 4 - i ) );
+        for( int j = 0; j < 3; j++ )
+        {
+            BOOST_CHECK_EQUAL( states.at( i )( j ), stateHistory.getState( 4 - i )( j + 2 ) );
+        }
+    }
+    BOOST_CHECK_THROW( stateHistory.getSortedTimesAndStates( times, states, 5, 3 ), std::runtime_error );
+
+    // Check map view, and functions for compatibility with map
+    std::map< double, Eigen::Matrix< long double, Eigen::Dynamic, 1 > > historyMap = stateHistory.getHistoryMap( );
+    BOOST_CHECK_EQUAL( historyMap.begin( )->first, -8.0 );
+    BOOST_CHECK_EQUAL( utilities::getLastAddedTimeOfHistory( historyMap, false ),
+                       utilities::getLastAddedTimeOfHistory( stateHistory, false ) );
+    utilities::removeLastAddedEntryOfHistory( historyMap, false );
+    utilities::removeLastAddedEntryOfHistory( stateHistory, false );
+    BOOST_CHECK_EQUAL( historyMap.begin( )->first, stateHistory.getLastTime( ) );
+    BOOST_CHECK_EQUAL( static_cast< int >( historyMap.size( ) ), stateHistory.size( ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
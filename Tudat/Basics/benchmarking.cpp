@@ -0,0 +1,407 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <regex>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+#include "Tudat/Basics/benchmarking.h"
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+//! Function to retrieve the list of all benchmarks that have been registered.
+std::vector< BenchmarkDefinition >& getRegisteredBenchmarks( )
+{
+    static std::vector< BenchmarkDefinition > registeredBenchmarks;
+    return registeredBenchmarks;
+}
+
+//! Function to register a benchmark, typically called through the TUDAT_BENCHMARK macros.
+int registerBenchmark( const std::string& benchmarkName,
+                       const std::function< void( BenchmarkState& ) > benchmarkFunction,
+                       const unsigned long long fixedNumberOfIterations )
+{
+    getRegisteredBenchmarks( ).push_back( BenchmarkDefinition{ benchmarkName, benchmarkFunction, fixedNumberOfIterations } );
+    return static_cast< int >( getRegisteredBenchmarks( ).size( ) );
+}
+
+//! Function to create the result of a single repetition from the state after running it.
+BenchmarkResult createRepetitionResult( const std::string& benchmarkName, const int repetitionIndex,
+                                        const BenchmarkState& benchmarkState )
+{
+    const double numberOfIterations = static_cast< double >( benchmarkState.getNumberOfIterations( ) );
+
+    BenchmarkResult benchmarkResult;
+    benchmarkResult.resultName = benchmarkName;
+    benchmarkResult.benchmarkName = benchmarkName;
+    benchmarkResult.repetitionIndex = repetitionIndex;
+    benchmarkResult.numberOfIterations = benchmarkState.getNumberOfIterations( );
+    benchmarkResult.realTimePerIteration = benchmarkState.getElapsedRealNanoseconds( ) / numberOfIterations;
+    benchmarkResult.cpuTimePerIteration = benchmarkState.getElapsedCpuNanoseconds( ) / numberOfIterations;
+    benchmarkResult.itemsPerSecond = ( benchmarkState.getElapsedRealNanoseconds( ) > 0.0 ) ?
+                1.0E9 * static_cast< double >( benchmarkState.getItemsProcessed( ) ) /
+                benchmarkState.getElapsedRealNanoseconds( ) : 0.0;
+    benchmarkResult.counters = benchmarkState.getCounters( );
+    return benchmarkResult;
+}
+
+//! Function to create an aggregate result (mean, median or stddev) over a set of repetitions.
+BenchmarkResult createAggregateResult( const std::vector< BenchmarkResult >& repetitionResults,
+                                       const std::string& aggregateName )
+{
+    std::vector< double > realTimes, cpuTimes, itemsPerSecond;
+    for( unsigned int i = 0; i < repetitionResults.size( ); i++ )
+    {
+        realTimes.push_back( repetitionResults.at( i ).realTimePerIteration );
+        cpuTimes.push_back( repetitionResults.at( i ).cpuTimePerIteration );
+        itemsPerSecond.push_back( repetitionResults.at( i ).itemsPerSecond );
+    }
+
+    std::function< double( std::vector< double > ) > aggregateFunction;
+    if( aggregateName == "mean" )
+    {
+        aggregateFunction = [ ]( const std::vector< double >& values )
+        {
+            double sum = 0.0;
+            for( unsigned int i = 0; i < values.size( ); i++ )
+            {
+                sum += values.at( i );
+            }
+            return sum / static_cast< double >( values.size( ) );
+        };
+    }
+    else if( aggregateName == "median" )
+    {
+        aggregateFunction = [ ]( std::vector< double > values )
+        {
+            std::sort( values.begin( ), values.end( ) );
+            const unsigned int middleIndex = values.size( ) / 2;
+            return ( values.size( ) % 2 == 1 ) ? values.at( middleIndex ) :
+                                                 0.5 * ( values.at( middleIndex - 1 ) + values.at( middleIndex ) );
+        };
+    }
+    else if( aggregateName == "stddev" )
+    {
+        aggregateFunction = [ ]( const std::vector< double >& values )
+        {
+            double sum = 0.0, sumOfSquares = 0.0;
+            for( unsigned int i = 0; i < values.size( ); i++ )
+            {
+                sum += values.at( i );
+                sumOfSquares += values.at( i ) * values.at( i );
+            }
+            const double numberOfValues = static_cast< double >( values.size( ) );
+            const double mean = sum / numberOfValues;
+            return std::sqrt( std::max( 0.0, ( sumOfSquares - numberOfValues * mean * mean ) /
+                                        ( numberOfValues - 1.0 ) ) );
+        };
+    }
+    else
+    {
+        throw std::runtime_error( "Error, benchmark aggregate " + aggregateName + " not recognized." );
+    }
+
+    BenchmarkResult aggregateResult;
+    aggregateResult.resultName = repetitionResults.at( 0 ).benchmarkName + "_" + aggregateName;
+    aggregateResult.benchmarkName = repetitionResults.at( 0 ).benchmarkName;
+    aggregateResult.repetitionIndex = -1;
+    aggregateResult.aggregateName = aggregateName;
+    aggregateResult.numberOfIterations = repetitionResults.at( 0 ).numberOfIterations;
+    aggregateResult.realTimePerIteration = aggregateFunction( realTimes );
+    aggregateResult.cpuTimePerIteration = aggregateFunction( cpuTimes );
+    aggregateResult.itemsPerSecond = aggregateFunction( itemsPerSecond );
+
+    for( auto counterIterator : repetitionResults.at( 0 ).counters )
+    {
+        std::vector< double > counterValues;
+        for( unsigned int i = 0; i < repetitionResults.size( ); i++ )
+        {
+            counterValues.push_back( repetitionResults.at( i ).counters.at( counterIterator.first ) );
+        }
+        aggregateResult.counters[ counterIterator.first ] = aggregateFunction( counterValues );
+    }
+    return aggregateResult;
+}
+
+//! Function to run a single benchmark, with the given number of repetitions.
+std::vector< BenchmarkResult > runBenchmark( const BenchmarkDefinition& benchmarkDefinition,
+                                             const BenchmarkRunSettings& runSettings )
+{
+    std::vector< BenchmarkResult > repetitionResults;
+
+    // Determine number of iterations, retaining the final calibration run as the first repetition.
+    unsigned long long numberOfIterations = benchmarkDefinition.fixedNumberOfIterations;
+    if( numberOfIterations == 0 )
+    {
+        const double minimumNanoseconds = 1.0E9 * runSettings.minimumTime;
+        numberOfIterations = 1;
+        while( true )
+        {
+            BenchmarkState benchmarkState( numberOfIterations );
+            benchmarkDefinition.benchmarkFunction( benchmarkState );
+            if( benchmarkState.getElapsedRealNanoseconds( ) >= minimumNanoseconds || numberOfIterations >= 1000000000ULL )
+            {
+                repetitionResults.push_back( createRepetitionResult( benchmarkDefinition.benchmarkName, 0, benchmarkState ) );
+                break;
+            }
+
+            // Increase number of iterations by the (estimated) required factor, by at least 10 % and at most a factor 10.
+            const double scalingFactor = ( benchmarkState.getElapsedRealNanoseconds( ) > 0.0 ) ?
+                        1.4 * minimumNanoseconds / benchmarkState.getElapsedRealNanoseconds( ) : 10.0;
+            numberOfIterations = std::max(
+                        numberOfIterations + 1, static_cast< unsigned long long >(
+                            static_cast< double >( numberOfIterations ) * std::min( 10.0, std::max( 1.1, scalingFactor ) ) ) );
+        }
+    }
+
+    // Run (remaining) repetitions.
+    for( unsigned int i = repetitionResults.size( ); i < std::max( 1U, runSettings.numberOfRepetitions ); i++ )
+    {
+        BenchmarkState benchmarkState( numberOfIterations );
+        benchmarkDefinition.benchmarkFunction( benchmarkState );
+        repetitionResults.push_back( createRepetitionResult( benchmarkDefinition.benchmarkName, i, benchmarkState ) );
+    }
+
+    // Compute aggregates
+    std::vector< BenchmarkResult > benchmarkResults = repetitionResults;
+    if( repetitionResults.size( ) > 1 )
+    {
+        benchmarkResults.push_back( createAggregateResult( repetitionResults, "mean" ) );
+        benchmarkResults.push_back( createAggregateResult( repetitionResults, "median" ) );
+        benchmarkResults.push_back( createAggregateResult( repetitionResults, "stddev" ) );
+    }
+    return benchmarkResults;
+}
+
+//! Function to run all registered benchmarks of which the name matches the filter of the run settings.
+std::vector< BenchmarkResult > runRegisteredBenchmarks( const BenchmarkRunSettings& runSettings,
+                                                        std::ostream* outputStream )
+{
+    const std::regex nameFilter( runSettings.nameFilter );
+
+    std::vector< BenchmarkResult > benchmarkResults;
+    const std::vector< BenchmarkDefinition >& registeredBenchmarks = getRegisteredBenchmarks( );
+    for( unsigned int i = 0; i < registeredBenchmarks.size( ); i++ )
+    {
+        if( std::regex_search( registeredBenchmarks.at( i ).benchmarkName, nameFilter ) )
+        {
+            std::vector< BenchmarkResult > currentResults = runBenchmark( registeredBenchmarks.at( i ), runSettings );
+            if( outputStream != nullptr )
+            {
+                for( unsigned int j = 0; j < currentResults.size( ); j++ )
+                {
+                    printBenchmarkResult( currentResults.at( j ), *outputStream );
+                }
+            }
+            benchmarkResults.insert( benchmarkResults.end( ), currentResults.begin( ), currentResults.end( ) );
+        }
+    }
+    return benchmarkResults;
+}
+
+//! Function to print a single benchmark result as a line in a table.
+void printBenchmarkResult( const BenchmarkResult& benchmarkResult, std::ostream& outputStream )
+{
+    std::ostringstream resultLine;
+    resultLine << std::left << std::setw( 48 ) << benchmarkResult.resultName << std::right << std::fixed
+               << std::setprecision( 1 ) << std::setw( 18 ) << benchmarkResult.realTimePerIteration << " ns"
+               << std::setw( 18 ) << benchmarkResult.cpuTimePerIteration << " ns"
+               << std::setw( 12 ) << benchmarkResult.numberOfIterations;
+    if( benchmarkResult.itemsPerSecond > 0.0 )
+    {
+        resultLine << std::scientific << std::setprecision( 3 ) << std::setw( 14 )
+                   << benchmarkResult.itemsPerSecond << " items/s";
+    }
+    for( auto counterIterator : benchmarkResult.counters )
+    {
+        resultLine << std::scientific << std::setprecision( 3 ) << "  " << counterIterator.first << "="
+                   << counterIterator.second;
+    }
+    outputStream << resultLine.str( ) << std::endl;
+}
+
+//! Function to write a string as a JSON string literal, escaping special characters.
+std::string getJsonStringLiteral( const std::string& value )
+{
+    std::ostringstream literalStream;
+    literalStream << "\"";
+    for( unsigned int i = 0; i < value.size( ); i++ )
+    {
+        const char currentCharacter = value.at( i );
+        if( currentCharacter == '"' || currentCharacter == '\\' )
+        {
+            literalStream << "\\" << currentCharacter;
+        }
+        else if( static_cast< unsigned char >( currentCharacter ) < 0x20 )
+        {
+            literalStream << "\\u" << std::hex << std::setw( 4 ) << std::setfill( '0' )
+                          << static_cast< int >( currentCharacter ) << std::dec << std::setfill( ' ' );
+        }
+        else
+        {
+            literalStream << currentCharacter;
+        }
+    }
+    literalStream << "\"";
+    return literalStream.str( );
+}
+
+//! Function to write benchmark results in JSON format.
+void writeBenchmarkResultsToJson( const std::vector< BenchmarkResult >& benchmarkResults,
+                                  const std::string& executableName,
+                                  std::ostream& outputStream )
+{
+    // Write context of run.
+    const std::time_t currentTime = std::time( nullptr );
+    char dateString[ 32 ];
+    std::strftime( dateString, sizeof( dateString ), "%Y-%m-%dT%H:%M:%S", std::localtime( &currentTime ) );
+
+    outputStream << "{" << std::endl;
+    outputStream << "  \"context\": {" << std::endl;
+    outputStream << "    \"date\": " << getJsonStringLiteral( dateString ) << "," << std::endl;
+    outputStream << "    \"executable\": " << getJsonStringLiteral( executableName ) << "," << std::endl;
+    outputStream << "    \"num_cpus\": " << std::thread::hardware_concurrency( ) << "," << std::endl;
+#ifdef NDEBUG
+    outputStream << "    \"library_build_type\": \"release\"" << std::endl;
+#else
+    outputStream << "    \"library_build_type\": \"debug\"" << std::endl;
+#endif
+    outputStream << "  }," << std::endl;
+
+    // Write results.
+    outputStream << "  \"benchmarks\": [" << std::endl;
+    std::ostringstream resultsStream;
+    resultsStream << std::setprecision( 17 );
+    for( unsigned int i = 0; i < benchmarkResults.size( ); i++ )
+    {
+        const BenchmarkResult& currentResult = benchmarkResults.at( i );
+        resultsStream << "    {" << std::endl;
+        resultsStream << "      \"name\": " << getJsonStringLiteral( currentResult.resultName ) << "," << std::endl;
+        resultsStream << "      \"run_name\": " << getJsonStringLiteral( currentResult.benchmarkName ) << "," << std::endl;
+        if( currentResult.aggregateName.empty( ) )
+        {
+            resultsStream << "      \"run_type\": \"iteration\"," << std::endl;
+            resultsStream << "      \"repetition_index\": " << currentResult.repetitionIndex << "," << std::endl;
+        }
+        else
+        {
+            resultsStream << "      \"run_type\": \"aggregate\"," << std::endl;
+            resultsStream << "      \"aggregate_name\": " << getJsonStringLiteral( currentResult.aggregateName )
+                          << "," << std::endl;
+        }
+        resultsStream << "      \"iterations\": " << currentResult.numberOfIterations << "," << std::endl;
+        resultsStream << "      \"real_time\": " << currentResult.realTimePerIteration << "," << std::endl;
+        resultsStream << "      \"cpu_time\": " << currentResult.cpuTimePerIteration << "," << std::endl;
+        if( currentResult.itemsPerSecond > 0.0 )
+        {
+            resultsStream << "      \"items_per_second\": " << currentResult.itemsPerSecond << "," << std::endl;
+        }
+        for( auto counterIterator : currentResult.counters )
+        {
+            resultsStream << "      " << getJsonStringLiteral( counterIterator.first ) << ": "
+                          << counterIterator.second << "," << std::endl;
+        }
+        resultsStream << "      \"time_unit\": \"ns\"" << std::endl;
+        resultsStream << "    }" << ( ( i + 1 < benchmarkResults.size( ) ) ? "," : "" ) << std::endl;
+    }
+    outputStream << resultsStream.str( );
+    outputStream << "  ]" << std::endl;
+    outputStream << "}" << std::endl;
+}
+
+//! Function to run the registered benchmarks, with settings parsed from the command line.
+int runBenchmarksFromCommandLine( int argc, char* argv[ ] )
+{
+    BenchmarkRunSettings runSettings;
+    std::string outputFileName;
+    bool listBenchmarksOnly = false;
+
+    // Parse command line arguments.
+    for( int i = 1; i < argc; i++ )
+    {
+        const std::string currentArgument = argv[ i ];
+        const std::size_t separatorPosition = currentArgument.find( '=' );
+        const std::string argumentName = currentArgument.substr( 0, separatorPosition );
+        const std::string argumentValue = ( separatorPosition == std::string::npos ) ?
+                    "" : currentArgument.substr( separatorPosition + 1 );
+
+        if( argumentName == "--benchmark_filter" )
+        {
+            runSettings.nameFilter = argumentValue;
+        }
+        else if( argumentName == "--benchmark_min_time" )
+        {
+            runSettings.minimumTime = std::stod( argumentValue );
+        }
+        else if( argumentName == "--benchmark_repetitions" )
+        {
+            runSettings.numberOfRepetitions = static_cast< unsigned int >( std::stoul( argumentValue ) );
+        }
+        else if( argumentName == "--benchmark_out" )
+        {
+            outputFileName = argumentValue;
+        }
+        else if( argumentName == "--benchmark_list_tests" )
+        {
+            listBenchmarksOnly = true;
+        }
+        else
+        {
+            std::cerr << "Error, benchmark argument " << currentArgument << " not recognized. Supported arguments are "
+                      << "--benchmark_filter=<regex>, --benchmark_min_time=<seconds>, --benchmark_repetitions=<number>, "
+                      << "--benchmark_out=<file> and --benchmark_list_tests" << std::endl;
+            return 1;
+        }
+    }
+
+    if( listBenchmarksOnly )
+    {
+        const std::regex nameFilter( runSettings.nameFilter );
+        for( unsigned int i = 0; i < getRegisteredBenchmarks( ).size( ); i++ )
+        {
+            if( std::regex_search( getRegisteredBenchmarks( ).at( i ).benchmarkName, nameFilter ) )
+            {
+                std::cout << getRegisteredBenchmarks( ).at( i ).benchmarkName << std::endl;
+            }
+        }
+        return 0;
+    }
+
+    // Run benchmarks and write results.
+    std::cout << std::left << std::setw( 48 ) << "Benchmark" << std::right << std::setw( 21 ) << "Time"
+              << std::setw( 21 ) << "CPU" << std::setw( 12 ) << "Iterations" << std::endl;
+    std::vector< BenchmarkResult > benchmarkResults = runRegisteredBenchmarks( runSettings, &std::cout );
+
+    if( !outputFileName.empty( ) )
+    {
+        std::ofstream outputFile( outputFileName );
+        if( !outputFile.good( ) )
+        {
+            std::cerr << "Error, could not open benchmark output file " << outputFileName << std::endl;
+            return 1;
+        }
+        writeBenchmarkResultsToJson( benchmarkResults, argv[ 0 ], outputFile );
+    }
+
+    return 0;
+}
+
+} // namespace utilities
+
+} // namespace tudat
@@ -0,0 +1,396 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_BENCHMARKING_H
+#define TUDAT_BENCHMARKING_H
+
+#include <chrono>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+//! Function to prevent the compiler from optimizing away the computation of a value that is not used otherwise.
+/*!
+ *  Function to prevent the compiler from optimizing away the computation of a value that is not used otherwise, to be
+ *  used on the result of the benchmarked computation.
+ *  \param value Value that is to be considered as used by the compiler.
+ */
+template< typename ValueType >
+inline void doNotOptimize( const ValueType& value )
+{
+#if defined( __GNUC__ ) || defined( __clang__ )
+    asm volatile( "" : : "r,m"( value ) : "memory" );
+#else
+    static const volatile void* volatile valueSink;
+    valueSink = &value;
+#endif
+}
+
+//! Class to control and time the iterations of a single benchmark run.
+/*!
+ *  Class to control and time the iterations of a single benchmark run. The benchmarked function loops over
+ *  keepRunning( ), which returns true as long as iterations remain. Timing starts at the first call of keepRunning( ) and
+ *  stops at its last call, so that set-up performed before the loop is not included. Set-up that has to be repeated for
+ *  each iteration can be excluded from the timing using pauseTiming and resumeTiming.
+ */
+class BenchmarkState
+{
+public:
+
+    //! Constructor.
+    /*!
+     *  Constructor.
+     *  \param numberOfIterations Number of iterations that are to be run.
+     */
+    BenchmarkState( const unsigned long long numberOfIterations ):
+        numberOfIterations_( numberOfIterations ), numberOfCompletedIterations_( 0 ), isStarted_( false ),
+        isRunning_( false ), elapsedRealNanoseconds_( 0.0 ), elapsedCpuNanoseconds_( 0.0 ), itemsProcessed_( 0 ){ }
+
+    //! Function to check whether a (further) iteration is to be run, starting and stopping the timer as needed.
+    /*!
+     *  Function to check whether a (further) iteration is to be run, starting the timer at the first call and stopping it
+     *  once all iterations have been completed.
+     *  \return True if a further iteration is to be run.
+     */
+    bool keepRunning( )
+    {
+        if( !isStarted_ )
+        {
+            isStarted_ = true;
+            resumeTiming( );
+        }
+        else
+        {
+            numberOfCompletedIterations_++;
+        }
+
+        if( numberOfCompletedIterations_ < numberOfIterations_ )
+        {
+            return true;
+        }
+        else
+        {
+            if( isRunning_ )
+            {
+                pauseTiming( );
+            }
+            return false;
+        }
+    }
+
+    //! Function to pause the timer, to exclude per-iteration set-up from the measured time.
+    void pauseTiming( )
+    {
+        if( isRunning_ )
+        {
+            elapsedRealNanoseconds_ += static_cast< double >(
+                        std::chrono::duration_cast< std::chrono::nanoseconds >(
+                            std::chrono::steady_clock::now( ) - realStartTime_ ).count( ) );
+            elapsedCpuNanoseconds_ += 1.0E9 * static_cast< double >( std::clock( ) - cpuStartTime_ ) /
+                    static_cast< double >( CLOCKS_PER_SEC );
+            isRunning_ = false;
+        }
+    }
+
+    //! Function to resume the timer, after it was paused using pauseTiming.
+    void resumeTiming( )
+    {
+        if( !isRunning_ )
+        {
+            isRunning_ = true;
+            cpuStartTime_ = std::clock( );
+            realStartTime_ = std::chrono::steady_clock::now( );
+        }
+    }
+
+    //! Function to set the total number of items (e.g. function evaluations) processed in all iterations.
+    /*!
+     *  Function to set the total number of items (e.g. function evaluations) processed in all iterations, from which the
+     *  throughput is computed.
+     *  \param itemsProcessed Total number of items processed in all iterations.
+     */
+    void setItemsProcessed( const unsigned long long itemsProcessed )
+    {
+        itemsProcessed_ = itemsProcessed;
+    }
+
+    //! Function to set a user-defined counter, reported alongside the timing results.
+    /*!
+     *  Function to set a user-defined counter (e.g. the number of function evaluations per iteration, or the error of the
+     *  computed result), which is reported alongside the timing results. Aggregates are computed in the same manner as for
+     *  the timings.
+     *  \param counterName Name of the counter.
+     *  \param counterValue Value of the counter.
+     */
+    void setCounter( const std::string& counterName, const double counterValue )
+    {
+        counters_[ counterName ] = counterValue;
+    }
+
+    //! Function to retrieve the number of iterations that are to be run.
+    /*!
+     *  Function to retrieve the number of iterations that are to be run.
+     *  \return Number of iterations that are to be run.
+     */
+    unsigned long long getNumberOfIterations( ) const
+    {
+        return numberOfIterations_;
+    }
+
+    //! Function to retrieve the number of iterations that have been completed.
+    /*!
+     *  Function to retrieve the number of iterations that have been completed.
+     *  \return Number of iterations that have been completed.
+     */
+    unsigned long long getNumberOfCompletedIterations( ) const
+    {
+        return numberOfCompletedIterations_;
+    }
+
+    //! Function to retrieve the wall-clock time measured over all iterations (in nanoseconds).
+    /*!
+     *  Function to retrieve the wall-clock time measured over all iterations (in nanoseconds).
+     *  \return Wall-clock time measured over all iterations.
+     */
+    double getElapsedRealNanoseconds( ) const
+    {
+        return elapsedRealNanoseconds_;
+    }
+
+    //! Function to retrieve the processor time measured over all iterations (in nanoseconds).
+    /*!
+     *  Function to retrieve the processor time measured over all iterations (in nanoseconds).
+     *  \return Processor time measured over all iterations.
+     */
+    double getElapsedCpuNanoseconds( ) const
+    {
+        return elapsedCpuNanoseconds_;
+    }
+
+    //! Function to retrieve the total number of items processed in all iterations (0 if not set).
+    /*!
+     *  Function to retrieve the total number of items processed in all iterations (0 if not set).
+     *  \return Total number of items processed in all iterations.
+     */
+    unsigned long long getItemsProcessed( ) const
+    {
+        return itemsProcessed_;
+    }
+
+    //! Function to retrieve the user-defined counters that have been set.
+    /*!
+     *  Function to retrieve the user-defined counters that have been set.
+     *  \return User-defined counters, with counter names as keys.
+     */
+    const std::map< std::string, double >& getCounters( ) const
+    {
+        return counters_;
+    }
+
+private:
+
+    //! Number of iterations that are to be run.
+    unsigned long long numberOfIterations_;
+
+    //! Number of iterations that have been completed.
+    unsigned long long numberOfCompletedIterations_;
+
+    //! Boolean denoting whether keepRunning has been called.
+    bool isStarted_;
+
+    //! Boolean denoting whether the timer is currently running.
+    bool isRunning_;
+
+    //! Wall-clock time at which the timer was last (re)started.
+    std::chrono::steady_clock::time_point realStartTime_;
+
+    //! Processor time at which the timer was last (re)started.
+    std::clock_t cpuStartTime_;
+
+    //! Wall-clock time measured over all iterations (in nanoseconds).
+    double elapsedRealNanoseconds_;
+
+    //! Processor time measured over all iterations (in nanoseconds).
+    double elapsedCpuNanoseconds_;
+
+    //! Total number of items processed in all iterations.
+    unsigned long long itemsProcessed_;
+
+    //! User-defined counters, with counter names as keys.
+    std::map< std::string, double > counters_;
+};
+
+//! Definition of a single benchmark, as registered using TUDAT_BENCHMARK.
+struct BenchmarkDefinition
+{
+    //! Name of the benchmark.
+    std::string benchmarkName;
+
+    //! Function that runs the benchmark, looping over BenchmarkState::keepRunning.
+    std::function< void( BenchmarkState& ) > benchmarkFunction;
+
+    //! Fixed number of iterations per repetition; if 0, the number of iterations is determined from the minimum time.
+    unsigned long long fixedNumberOfIterations;
+};
+
+//! Settings for running the registered benchmarks.
+struct BenchmarkRunSettings
+{
+    //! Regular expression that the names of the benchmarks that are to be run are to (partially) match.
+    std::string nameFilter = "";
+
+    //! Minimum wall-clock time (in seconds) of a single repetition, used to determine the number of iterations.
+    double minimumTime = 0.5;
+
+    //! Number of times that each benchmark is repeated; aggregates are computed if larger than one.
+    unsigned int numberOfRepetitions = 1;
+};
+
+//! Result of a single repetition of a benchmark, or of an aggregate over all repetitions.
+struct BenchmarkResult
+{
+    //! Name of the result (benchmark name, appended with the aggregate name for aggregates)
+    std::string resultName;
+
+    //! Name of the benchmark.
+    std::string benchmarkName;
+
+    //! Index of the repetition (-1 for aggregates).
+    int repetitionIndex;
+
+    //! Name of the aggregate (mean, median or stddev), empty if this is the result of a single repetition.
+    std::string aggregateName;
+
+    //! Number of iterations run in each repetition.
+    unsigned long long numberOfIterations;
+
+    //! Wall-clock time per iteration (in nanoseconds).
+    double realTimePerIteration;
+
+    //! Processor time per iteration (in nanoseconds).
+    double cpuTimePerIteration;
+
+    //! Number of items processed per second of wall-clock time (0 if not set by the benchmark).
+    double itemsPerSecond;
+
+    //! User-defined counters set by the benchmark, with counter names as keys.
+    std::map< std::string, double > counters;
+};
+
+//! Function to retrieve the list of all benchmarks that have been registered.
+/*!
+ *  Function to retrieve the list of all benchmarks that have been registered.
+ *  \return List of all registered benchmarks, in order of registration.
+ */
+std::vector< BenchmarkDefinition >& getRegisteredBenchmarks( );
+
+//! Function to register a benchmark, typically called through the TUDAT_BENCHMARK macros.
+/*!
+ *  Function to register a benchmark, typically called through the TUDAT_BENCHMARK macros.
+ *  \param benchmarkName Name of the benchmark.
+ *  \param benchmarkFunction Function that runs the benchmark, looping over BenchmarkState::keepRunning.
+ *  \param fixedNumberOfIterations Fixed number of iterations per repetition; if 0 (default), the number of iterations is
+ *  determined from the minimum time of the run settings. A fixed number is typically used for long-running benchmarks.
+ *  \return Number of registered benchmarks.
+ */
+int registerBenchmark( const std::string& benchmarkName,
+                       const std::function< void( BenchmarkState& ) > benchmarkFunction,
+                       const unsigned long long fixedNumberOfIterations = 0 );
+
+//! Function to run a single benchmark, with the given number of repetitions.
+/*!
+ *  Function to run a single benchmark, with the given number of repetitions. Unless a fixed number of iterations is
+ *  defined, the number of iterations is increased until a single run takes at least the minimum time, after which the
+ *  repetitions are run with that number of iterations.
+ *  \param benchmarkDefinition Definition of the benchmark that is to be run.
+ *  \param runSettings Settings for running the benchmark (the name filter is not used).
+ *  \return Result of each repetition, followed by the mean, median and standard deviation if more than one repetition is
+ *  run.
+ */
+std::vector< BenchmarkResult > runBenchmark( const BenchmarkDefinition& benchmarkDefinition,
+                                             const BenchmarkRunSettings& runSettings );
+
+//! Function to run all registered benchmarks of which the name matches the filter of the run settings.
+/*!
+ *  Function to run all registered benchmarks of which the name matches the filter of the run settings.
+ *  \param runSettings Settings for running the benchmarks.
+ *  \param outputStream Stream to which the result of each benchmark is printed as it completes (none if nullptr).
+ *  \return Results of all benchmarks that have been run (see runBenchmark).
+ */
+std::vector< BenchmarkResult > runRegisteredBenchmarks( const BenchmarkRunSettings& runSettings,
+                                                        std::ostream* outputStream = &std::cout );
+
+//! Function to print a single benchmark result as a line in a table.
+/*!
+ *  Function to print a single benchmark result as a line in a table.
+ *  \param benchmarkResult Result that is to be printed.
+ *  \param outputStream Stream to which the result is written.
+ */
+void printBenchmarkResult( const BenchmarkResult& benchmarkResult, std::ostream& outputStream );
+
+//! Function to write benchmark results in JSON format.
+/*!
+ *  Function to write benchmark results in JSON format. The format (a "context" object and a "benchmarks" list, with times
+ *  in nanoseconds) is that of the Google Benchmark library, so that results of different runs can be compared with the
+ *  tools available for it.
+ *  \param benchmarkResults Results that are to be written.
+ *  \param executableName Name of the benchmark executable, written to the context.
+ *  \param outputStream Stream to which the results are written.
+ */
+void writeBenchmarkResultsToJson( const std::vector< BenchmarkResult >& benchmarkResults,
+                                  const std::string& executableName,
+                                  std::ostream& outputStream );
+
+//! Function to run the registered benchmarks, with settings parsed from the command line.
+/*!
+ *  Function to run the registered benchmarks, with settings parsed from the command line. The supported arguments are
+ *  --benchmark_filter=<regex>, --benchmark_min_time=<seconds>, --benchmark_repetitions=<number>,
+ *  --benchmark_out=<file> (to which the results are written in JSON format) and --benchmark_list_tests (to only print the
+ *  names of the registered benchmarks).
+ *  \param argc Number of command line arguments.
+ *  \param argv Command line arguments.
+ *  \return Exit status of the program (0 if successful).
+ */
+int runBenchmarksFromCommandLine( int argc, char* argv[ ] );
+
+} // namespace utilities
+
+} // namespace tudat
+
+#define TUDAT_BENCHMARK_CONCATENATE_IMPLEMENTATION( first, second ) first##second
+#define TUDAT_BENCHMARK_CONCATENATE( first, second ) TUDAT_BENCHMARK_CONCATENATE_IMPLEMENTATION( first, second )
+
+//! Macro to register a benchmark function (taking a utilities::BenchmarkState&) under the given name.
+#define TUDAT_BENCHMARK( benchmarkName, benchmarkFunction ) \
+    static const int TUDAT_BENCHMARK_CONCATENATE( registeredBenchmark, __LINE__ ) = \
+    tudat::utilities::registerBenchmark( benchmarkName, benchmarkFunction )
+
+//! Macro to register a benchmark function that is run with a fixed number of iterations per repetition.
+#define TUDAT_BENCHMARK_WITH_ITERATIONS( benchmarkName, benchmarkFunction, numberOfIterations ) \
+    static const int TUDAT_BENCHMARK_CONCATENATE( registeredBenchmark, __LINE__ ) = \
+    tudat::utilities::registerBenchmark( benchmarkName, benchmarkFunction, numberOfIterations )
+
+//! Macro to define the main function of a benchmark program, which runs the registered benchmarks.
+#define TUDAT_BENCHMARK_MAIN( ) \
+    int main( int argc, char* argv[ ] ) \
+    { \
+        return tudat::utilities::runBenchmarksFromCommandLine( argc, argv ); \
+    }
+
+#endif // TUDAT_BENCHMARKING_H
@@ -0,0 +1,304 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_BINARYSERIALIZATION_H
+#define TUDAT_BINARYSERIALIZATION_H
+
+#include <cstdint>
+#include <istream>
+#include <map>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/stateHistory.h"
+#include "Tudat/Basics/timeType.h"
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+// The functions in this file write (and read) values to (from) a binary stream, in native byte order and without any
+// type information, for the storage of intermediate results (e.g. checkpoints of a propagation) that are read back on the
+// same platform by the same program. Sizes of containers and matrices are written as 64-bit integers, so that the data
+// can be read back independently of the size of the (unsigned) int type. Values must be read back in the same order, and
+// with the same types, as they were written.
+
+//! Function to check whether the last read operation on a binary stream was successful.
+/*!
+ *  Function to check whether the last read operation on a binary stream was successful, throws an exception if not
+ *  (e.g. if the end of the stream was reached).
+ *  \param inputStream Stream from which data was read.
+ */
+inline void checkBinaryStreamReadStatus( const std::istream& inputStream )
+{
+    if( !inputStream )
+    {
+        throw std::runtime_error( "Error when reading from binary stream, stream is truncated or corrupted." );
+    }
+}
+
+//! Function to write an arithmetic value (e.g. integer, floating point number, boolean) to a binary stream.
+template< typename ValueType >
+typename std::enable_if< std::is_arithmetic< ValueType >::value >::type writeToBinaryStream(
+        std::ostream& outputStream, const ValueType& value )
+{
+    outputStream.write( reinterpret_cast< const char* >( &value ), sizeof( ValueType ) );
+}
+
+//! Function to read an arithmetic value (e.g. integer, floating point number, boolean) from a binary stream.
+template< typename ValueType >
+typename std::enable_if< std::is_arithmetic< ValueType >::value >::type readFromBinaryStream(
+        std::istream& inputStream, ValueType& value )
+{
+    inputStream.read( reinterpret_cast< char* >( &value ), sizeof( ValueType ) );
+    checkBinaryStreamReadStatus( inputStream );
+}
+
+//! Function to write a size (of a container or matrix) to a binary stream.
+inline void writeSizeToBinaryStream( std::ostream& outputStream, const std::size_t size )
+{
+    writeToBinaryStream( outputStream, static_cast< std::int64_t >( size ) );
+}
+
+//! Function to read a size (of a container or matrix) from a binary stream.
+inline std::size_t readSizeFromBinaryStream( std::istream& inputStream )
+{
+    std::int64_t size;
+    readFromBinaryStream( inputStream, size );
+    if( size < 0 )
+    {
+        throw std::runtime_error( "Error when reading from binary stream, found negative size." );
+    }
+    return static_cast< std::size_t >( size );
+}
+
+//! Function to write a Time object to a binary stream.
+inline void writeToBinaryStream( std::ostream& outputStream, const Time& time )
+{
+    writeToBinaryStream( outputStream, time.getFullPeriods( ) );
+    writeToBinaryStream( outputStream, time.getSecondsIntoFullPeriod( ) );
+}
+
+//! Function to read a Time object from a binary stream.
+inline void readFromBinaryStream( std::istream& inputStream, Time& time )
+{
+    int fullPeriods;
+    long double secondsIntoFullPeriod;
+    readFromBinaryStream( inputStream, fullPeriods );
+    readFromBinaryStream( inputStream, secondsIntoFullPeriod );
+    time = Time( fullPeriods, secondsIntoFullPeriod );
+}
+
+//! Function to write a string to a binary stream, preceded by its length.
+inline void writeToBinaryStream( std::ostream& outputStream, const std::string& stringToWrite )
+{
+    writeSizeToBinaryStream( outputStream, stringToWrite.size( ) );
+    outputStream.write( stringToWrite.data( ), stringToWrite.size( ) );
+}
+
+//! Function to read a string from a binary stream, preceded by its length.
+inline void readFromBinaryStream( std::istream& inputStream, std::string& readString )
+{
+    readString.resize( readSizeFromBinaryStream( inputStream ) );
+    if( readString.size( ) > 0 )
+    {
+        inputStream.read( &readString[ 0 ], readString.size( ) );
+        checkBinaryStreamReadStatus( inputStream );
+    }
+}
+
+//! Function to write an Eigen matrix to a binary stream, preceded by its number of rows and columns.
+template< typename ScalarType, int Rows, int Columns, int Options, int MaximumRows, int MaximumColumns >
+void writeToBinaryStream( std::ostream& outputStream,
+                          const Eigen::Matrix< ScalarType, Rows, Columns, Options, MaximumRows, MaximumColumns >& matrix )
+{
+    writeSizeToBinaryStream( outputStream, matrix.rows( ) );
+    writeSizeToBinaryStream( outputStream, matrix.cols( ) );
+    outputStream.write( reinterpret_cast< const char* >( matrix.data( ) ), matrix.size( ) * sizeof( ScalarType ) );
+}
+
+//! Function to read an Eigen matrix from a binary stream, preceded by its number of rows and columns.
+template< typename ScalarType, int Rows, int Columns, int Options, int MaximumRows, int MaximumColumns >
+void readFromBinaryStream( std::istream& inputStream,
+                           Eigen::Matrix< ScalarType, Rows, Columns, Options, MaximumRows, MaximumColumns >& matrix )
+{
+    const std::size_t numberOfRows = readSizeFromBinaryStream( inputStream );
+    const std::size_t numberOfColumns = readSizeFromBinaryStream( inputStream );
+    if( ( Rows != Eigen::Dynamic && static_cast< int >( numberOfRows ) != Rows ) ||
+            ( Columns != Eigen::Dynamic && static_cast< int >( numberOfColumns ) != Columns ) )
+    {
+        throw std::runtime_error( "Error when reading matrix from binary stream, size " + std::to_string( numberOfRows ) +
+                                  "x" + std::to_string( numberOfColumns ) + " is incompatible with matrix type." );
+    }
+    matrix.resize( numberOfRows, numberOfColumns );
+    inputStream.read( reinterpret_cast< char* >( matrix.data( ) ), matrix.size( ) * sizeof( ScalarType ) );
+    checkBinaryStreamReadStatus( inputStream );
+}
+
+template< typename ValueType >
+void writeToBinaryStream( std::ostream& outputStream, const std::vector< ValueType >& vectorToWrite );
+
+template< typename ValueType >
+void readFromBinaryStream( std::istream& inputStream, std::vector< ValueType >& readVector );
+
+template< typename KeyType, typename ValueType >
+void writeToBinaryStream( std::ostream& outputStream, const std::map< KeyType, ValueType >& mapToWrite );
+
+template< typename KeyType, typename ValueType >
+void readFromBinaryStream( std::istream& inputStream, std::map< KeyType, ValueType >& readMap );
+
+//! Function to write a vector to a binary stream, preceded by its size.
+template< typename ValueType >
+void writeToBinaryStream( std::ostream& outputStream, const std::vector< ValueType >& vectorToWrite )
+{
+    writeSizeToBinaryStream( outputStream, vectorToWrite.size( ) );
+    for( unsigned int i = 0; i < vectorToWrite.size( ); i++ )
+    {
+        writeToBinaryStream( outputStream, static_cast< const ValueType& >( vectorToWrite[ i ] ) );
+    }
+}
+
+//! Function to read a vector from a binary stream, preceded by its size.
+template< typename ValueType >
+void readFromBinaryStream( std::istream& inputStream, std::vector< ValueType >& readVector )
+{
+    const std::size_t vectorSize = readSizeFromBinaryStream( inputStream );
+    readVector.clear( );
+    for( std::size_t i = 0; i < vectorSize; i++ )
+    {
+        ValueType value;
+        readFromBinaryStream( inputStream, value );
+        readVector.push_back( value );
+    }
+}
+
+//! Function to write a map to a binary stream, preceded by its size.
+template< typename KeyType, typename ValueType >
+void writeToBinaryStream( std::ostream& outputStream, const std::map< KeyType, ValueType >& mapToWrite )
+{
+    writeSizeToBinaryStream( outputStream, mapToWrite.size( ) );
+    for( auto mapIterator : mapToWrite )
+    {
+        writeToBinaryStream( outputStream, mapIterator.first );
+        writeToBinaryStream( outputStream, mapIterator.second );
+    }
+}
+
+//! Function to read a map from a binary stream, preceded by its size.
+template< typename KeyType, typename ValueType >
+void readFromBinaryStream( std::istream& inputStream, std::map< KeyType, ValueType >& readMap )
+{
+    const std::size_t mapSize = readSizeFromBinaryStream( inputStream );
+    readMap.clear( );
+    for( std::size_t i = 0; i < mapSize; i++ )
+    {
+        KeyType key;
+        ValueType value;
+        readFromBinaryStream( inputStream, key );
+        readFromBinaryStream( inputStream, value );
+        readMap.insert( readMap.end( ), std::make_pair( key, value ) );
+    }
+}
+
+//! Function to write a state history to a binary stream.
+template< typename TimeType, typename ScalarType >
+void writeToBinaryStream( std::ostream& outputStream, const StateHistory< TimeType, ScalarType >& history )
+{
+    writeSizeToBinaryStream( outputStream, history.getStateSize( ) );
+    writeToBinaryStream( outputStream, history.getTimes( ) );
+    writeToBinaryStream( outputStream, typename StateHistory< TimeType, ScalarType >::StateBlockType(
+                             history.getStateBlock( ) ) );
+}
+
+//! Function to read a state history from a binary stream, retaining the memory allocated by the history.
+template< typename TimeType, typename ScalarType >
+void readFromBinaryStream( std::istream& inputStream, StateHistory< TimeType, ScalarType >& history )
+{
+    const std::size_t stateSize = readSizeFromBinaryStream( inputStream );
+    std::vector< TimeType > times;
+    readFromBinaryStream( inputStream, times );
+    typename StateHistory< TimeType, ScalarType >::StateBlockType states;
+    readFromBinaryStream( inputStream, states );
+    if( static_cast< std::size_t >( states.rows( ) ) != times.size( ) ||
+            ( times.size( ) > 0 && static_cast< std::size_t >( states.cols( ) ) != stateSize ) )
+    {
+        throw std::runtime_error( "Error when reading state history from binary stream, sizes are inconsistent." );
+    }
+
+    history.clear( stateSize );
+    history.reserve( times.size( ) );
+    for( unsigned int i = 0; i < times.size( ); i++ )
+    {
+        history.addEntry( times.at( i ), states.row( i ).transpose( ) );
+    }
+}
+
+//! Function to write the entries of a state history from a given entry onwards to a binary stream.
+/*!
+ *  Function to write the entries of a state history from a given entry onwards to a binary stream, in the same format as
+ *  a complete state history. Such segments can be appended to a history using appendFromBinaryStream, so that a history
+ *  that grows during a propagation can be stored incrementally.
+ *  \param outputStream Stream to which the segment of the history is written.
+ *  \param history History of which the segment is written.
+ *  \param startIndex Index of the first entry that is written.
+ */
+template< typename TimeType, typename ScalarType >
+void writeToBinaryStream( std::ostream& outputStream, const StateHistory< TimeType, ScalarType >& history,
+                          const int startIndex )
+{
+    if( startIndex < 0 || startIndex > history.size( ) )
+    {
+        throw std::runtime_error( "Error when writing segment of state history to binary stream, start index " +
+                                  std::to_string( startIndex ) + " is out of range." );
+    }
+    const int numberOfEntries = history.size( ) - startIndex;
+    writeSizeToBinaryStream( outputStream, history.getStateSize( ) );
+    writeToBinaryStream( outputStream, std::vector< TimeType >(
+                             history.getTimes( ).begin( ) + startIndex, history.getTimes( ).end( ) ) );
+    writeToBinaryStream( outputStream, typename StateHistory< TimeType, ScalarType >::StateBlockType(
+                             history.getStateBlock( ).bottomRows( numberOfEntries ) ) );
+}
+
+//! Function to read a (segment of a) state history from a binary stream, and append it to an existing history.
+/*!
+ *  Function to read a (segment of a) state history from a binary stream (see writeToBinaryStream), and append it to an
+ *  existing history. An entry at the same epoch as the current last entry of the history overwrites this last entry.
+ *  \param inputStream Stream from which the segment of the history is read.
+ *  \param history History to which the entries are appended (returned by reference).
+ */
+template< typename TimeType, typename ScalarType >
+void appendFromBinaryStream( std::istream& inputStream, StateHistory< TimeType, ScalarType >& history )
+{
+    StateHistory< TimeType, ScalarType > historySegment;
+    readFromBinaryStream( inputStream, historySegment );
+    if( historySegment.size( ) > 0 && history.size( ) > 0 &&
+            historySegment.getStateSize( ) != history.getStateSize( ) )
+    {
+        throw std::runtime_error( "Error when appending state history from binary stream, state sizes are inconsistent." );
+    }
+
+    for( int i = 0; i < historySegment.size( ); i++ )
+    {
+        history.addEntry( historySegment.getTime( i ), historySegment.getState( i ) );
+    }
+}
+
+} // namespace utilities
+
+} // namespace tudat
+
+#endif // TUDAT_BINARYSERIALIZATION_H
@@ -0,0 +1,110 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "Tudat/Basics/parallelization.h"
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+//! Function to retrieve the number of threads that can run concurrently on the current machine.
+unsigned int getNumberOfHardwareThreads( )
+{
+    unsigned int numberOfThreads = std::thread::hardware_concurrency( );
+    return ( numberOfThreads == 0 ) ? 1 : numberOfThreads;
+}
+
+//! Function to execute the iterations of a loop in parallel.
+void executeParallelLoop( const int numberOfIterations,
+                          const int numberOfThreads,
+                          const std::function< void( const int ) >& loopBody )
+{
+    executeParallelLoopWithWorkerIndex(
+                numberOfIterations, numberOfThreads, [ & ]( const int iterationIndex, const int )
+    {
+        loopBody( iterationIndex );
+    } );
+}
+
+//! Function to execute the iterations of a loop in parallel, providing the index of the executing worker to each iteration.
+void executeParallelLoopWithWorkerIndex( const int numberOfIterations,
+                                         const int numberOfThreads,
+                                         const std::function< void( const int, const int ) >& loopBody )
+{
+    // Execute serially if no (effective) parallelization is requested
+    if( numberOfThreads <= 1 || numberOfIterations <= 1 )
+    {
+        for( int i = 0; i < numberOfIterations; i++ )
+        {
+            loopBody( i, 0 );
+        }
+        return;
+    }
+
+    std::atomic< int > nextIteration( 0 );
+    std::atomic< bool > isExceptionThrown( false );
+    std::exception_ptr firstException;
+    std::mutex exceptionMutex;
+
+    // Define function executed by each worker: process iterations until all are taken
+    auto workerFunction = [ & ]( const int workerIndex )
+    {
+        int currentIteration;
+        while( !isExceptionThrown && ( currentIteration = nextIteration++ ) < numberOfIterations )
+        {
+            try
+            {
+                loopBody( currentIteration, workerIndex );
+            }
+            catch( ... )
+            {
+                std::lock_guard< std::mutex > lock( exceptionMutex );
+                if( !isExceptionThrown )
+                {
+                    firstException = std::current_exception( );
+                    isExceptionThrown = true;
+                }
+            }
+        }
+    };
+
+    // Start workers, with calling thread acting as worker 0
+    int numberOfWorkers = std::min( numberOfThreads, numberOfIterations );
+    std::vector< std::thread > workers;
+    workers.reserve( numberOfWorkers - 1 );
+    for( int i = 1; i < numberOfWorkers; i++ )
+    {
+        workers.push_back( std::thread( workerFunction, i ) );
+    }
+    workerFunction( 0 );
+
+    for( unsigned int i = 0; i < workers.size( ); i++ )
+    {
+        workers.at( i ).join( );
+    }
+
+    if( firstException )
+    {
+        std::rethrow_exception( firstException );
+    }
+}
+
+} // namespace utilities
+
+} // namespace tudat
@@ -0,0 +1,67 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_PARALLELIZATION_H
+#define TUDAT_PARALLELIZATION_H
+
+#include <functional>
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+//! Function to retrieve the number of threads that can run concurrently on the current machine.
+/*!
+ *  Function to retrieve the number of threads that can run concurrently on the current machine, as reported by the standard
+ *  library. If this number cannot be determined, 1 is returned.
+ *  \return Number of threads that can run concurrently on the current machine.
+ */
+unsigned int getNumberOfHardwareThreads( );
+
+//! Function to execute the iterations of a loop in parallel.
+/*!
+ *  Function to execute the iterations of a loop in parallel, using a fixed number of worker threads. Iterations are
+ *  distributed dynamically: each worker takes the next unprocessed iteration index as soon as it is idle, so that iterations
+ *  of unequal cost are balanced over the workers. The iterations must be mutually independent, and may only modify data
+ *  that is not touched by any other iteration (e.g. an entry of a pre-allocated output vector, indexed by the iteration
+ *  number). The result of the loop is then independent of the number of threads that is used.
+ *  If an exception is thrown during an iteration, no new iterations are started, and the first exception that was caught is
+ *  rethrown in the calling thread once all workers are finished.
+ *  \param numberOfIterations Number of iterations of the loop
+ *  \param numberOfThreads Number of worker threads that are to be used. If this number is <= 1, or if only a single
+ *  iteration is to be performed, the loop is executed serially in the calling thread.
+ *  \param loopBody Function that is to be executed for each iteration, with the iteration index as input.
+ */
+void executeParallelLoop( const int numberOfIterations,
+                          const int numberOfThreads,
+                          const std::function< void( const int ) >& loopBody );
+
+//! Function to execute the iterations of a loop in parallel, providing the index of the executing worker to each iteration.
+/*!
+ *  Function to execute the iterations of a loop in parallel, identical to executeParallelLoop, but providing the index of
+ *  the worker that executes the iteration to the loop body. The worker index is in the range [0, numberOfThreads), and each
+ *  worker executes its iterations sequentially. This allows each worker to use its own (non-reentrant) objects, such as a
+ *  separate copy of the environment and dynamical model, which are reused for all iterations executed by that worker.
+ *  \param numberOfIterations Number of iterations of the loop
+ *  \param numberOfThreads Number of worker threads that are to be used. If this number is <= 1, or if only a single
+ *  iteration is to be performed, the loop is executed serially in the calling thread (with worker index 0).
+ *  \param loopBody Function that is to be executed for each iteration, with the iteration index and worker index as input.
+ */
+void executeParallelLoopWithWorkerIndex( const int numberOfIterations,
+                                         const int numberOfThreads,
+                                         const std::function< void( const int, const int ) >& loopBody );
+
+} // namespace utilities
+
+} // namespace tudat
+
+#endif // TUDAT_PARALLELIZATION_H
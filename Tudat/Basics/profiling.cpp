@@ -0,0 +1,97 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include <algorithm>
+#include <iomanip>
+
+#include "Tudat/Basics/profiling.h"
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+//! Function to reset the number of calls and computation time of all registered components to zero.
+void ProfilingData::reset( )
+{
+    for( auto entryIterator = profilingEntries_.begin( ); entryIterator != profilingEntries_.end( ); entryIterator++ )
+    {
+        entryIterator->second = ProfilingEntry( );
+    }
+}
+
+//! Function to retrieve the computation time summary of all components that have been called at least once.
+std::vector< ProfilingReportEntry > ProfilingData::getProfilingReport( const std::string& referenceComponentName ) const
+{
+    // Determine computation time w.r.t. which fractions are computed.
+    unsigned long long referenceNanoseconds = 0;
+    if( profilingEntries_.count( referenceComponentName ) > 0 )
+    {
+        referenceNanoseconds = profilingEntries_.at( referenceComponentName ).totalNanoseconds;
+    }
+    else
+    {
+        for( auto entryIterator = profilingEntries_.begin( ); entryIterator != profilingEntries_.end( ); entryIterator++ )
+        {
+            referenceNanoseconds = std::max( referenceNanoseconds, entryIterator->second.totalNanoseconds );
+        }
+    }
+
+    // Create summary for each component that has been called.
+    std::vector< ProfilingReportEntry > profilingReport;
+    for( auto entryIterator = profilingEntries_.begin( ); entryIterator != profilingEntries_.end( ); entryIterator++ )
+    {
+        if( entryIterator->second.numberOfCalls > 0 )
+        {
+            ProfilingReportEntry reportEntry;
+            reportEntry.componentName = entryIterator->first;
+            reportEntry.numberOfCalls = entryIterator->second.numberOfCalls;
+            reportEntry.totalNanoseconds = entryIterator->second.totalNanoseconds;
+            reportEntry.meanNanoseconds = static_cast< double >( entryIterator->second.totalNanoseconds ) /
+                    static_cast< double >( entryIterator->second.numberOfCalls );
+            reportEntry.fractionOfTotalTime = ( referenceNanoseconds > 0 ) ?
+                        static_cast< double >( entryIterator->second.totalNanoseconds ) /
+                        static_cast< double >( referenceNanoseconds ) : 0.0;
+            profilingReport.push_back( reportEntry );
+        }
+    }
+
+    std::stable_sort( profilingReport.begin( ), profilingReport.end( ),
+                      [ ]( const ProfilingReportEntry& first, const ProfilingReportEntry& second )
+    {
+        return first.totalNanoseconds > second.totalNanoseconds;
+    } );
+
+    return profilingReport;
+}
+
+//! Function to print the computation time summary of all components that have been called at least once.
+void ProfilingData::printProfilingReport( const std::string& referenceComponentName,
+                                          std::ostream& outputStream ) const
+{
+    std::vector< ProfilingReportEntry > profilingReport = getProfilingReport( referenceComponentName );
+
+    const std::streamsize outputPrecision = outputStream.precision( );
+    outputStream << "Component, number of calls, total time [ns], mean time [ns], fraction of time" << std::endl;
+    for( unsigned int i = 0; i < profilingReport.size( ); i++ )
+    {
+        outputStream << profilingReport.at( i ).componentName << ", "
+                     << profilingReport.at( i ).numberOfCalls << ", "
+                     << profilingReport.at( i ).totalNanoseconds << ", "
+                     << std::fixed << std::setprecision( 1 ) << profilingReport.at( i ).meanNanoseconds << ", "
+                     << std::setprecision( 4 ) << profilingReport.at( i ).fractionOfTotalTime
+                     << std::defaultfloat << std::setprecision( outputPrecision ) << std::endl;
+    }
+}
+
+} // namespace utilities
+
+} // namespace tudat
@@ -0,0 +1,169 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_PROFILING_H
+#define TUDAT_PROFILING_H
+
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+//! Accumulated number of calls and computation time of a single profiled component.
+struct ProfilingEntry
+{
+    //! Number of times that the component has been called.
+    unsigned long long numberOfCalls = 0;
+
+    //! Total wall-clock time spent in the component (in nanoseconds).
+    unsigned long long totalNanoseconds = 0;
+};
+
+//! Summary of the computation time of a single profiled component, as provided by ProfilingData::getProfilingReport
+struct ProfilingReportEntry
+{
+    //! Name of the profiled component.
+    std::string componentName;
+
+    //! Number of times that the component has been called.
+    unsigned long long numberOfCalls;
+
+    //! Total wall-clock time spent in the component (in nanoseconds).
+    unsigned long long totalNanoseconds;
+
+    //! Mean wall-clock time per call of the component (in nanoseconds).
+    double meanNanoseconds;
+
+    //! Fraction of the computation time of the reference component that is spent in this component.
+    double fractionOfTotalTime;
+};
+
+//! Class to store the accumulated computation time of a set of named components.
+/*!
+ *  Class to store the accumulated computation time of a set of named components, filled by ScopedProfilingTimer objects
+ *  (through the TUDAT_PROFILE_SCOPE macro). Entries are registered once by name, after which the pointer to the entry
+ *  is used directly, so that no look-up is needed during the evaluation of the profiled components. Pointers to entries
+ *  remain valid for the lifetime of this object. Components may be nested, in which case the time spent in a nested
+ *  component is also included in the time of the component containing it.
+ */
+class ProfilingData
+{
+public:
+
+    //! Function to retrieve (and register, if it does not yet exist) the entry of a profiled component.
+    /*!
+     *  Function to retrieve (and register, if it does not yet exist) the entry of a profiled component.
+     *  \param componentName Name of the profiled component.
+     *  \return Pointer to entry of the profiled component.
+     */
+    ProfilingEntry* getEntry( const std::string& componentName )
+    {
+        return &profilingEntries_[ componentName ];
+    }
+
+    //! Function to reset the number of calls and computation time of all registered components to zero.
+    void reset( );
+
+    //! Function to retrieve the computation time summary of all components that have been called at least once.
+    /*!
+     *  Function to retrieve the computation time summary of all components that have been called at least once, sorted by
+     *  descending total computation time.
+     *  \param referenceComponentName Name of the component w.r.t. the computation time of which the fraction of time spent
+     *  in each component is computed (typically the outermost profiled component). If empty or not registered, the
+     *  component with the largest total computation time is used.
+     *  \return Computation time summary per component.
+     */
+    std::vector< ProfilingReportEntry > getProfilingReport( const std::string& referenceComponentName = "" ) const;
+
+    //! Function to print the computation time summary of all components that have been called at least once.
+    /*!
+     *  Function to print the computation time summary of all components that have been called at least once.
+     *  \param referenceComponentName Name of the component w.r.t. the computation time of which the fraction of time spent
+     *  in each component is computed (see getProfilingReport).
+     *  \param outputStream Stream to which the summary is written.
+     */
+    void printProfilingReport( const std::string& referenceComponentName = "",
+                               std::ostream& outputStream = std::cout ) const;
+
+private:
+
+    //! Accumulated number of calls and computation time per component (key)
+    std::map< std::string, ProfilingEntry > profilingEntries_;
+};
+
+//! Class that adds the wall-clock time between its construction and destruction to a profiling entry.
+class ScopedProfilingTimer
+{
+public:
+
+    //! Constructor, starts the timer.
+    /*!
+     *  Constructor, starts the timer.
+     *  \param profilingEntry Entry to which the number of calls and computation time are added upon destruction. If
+     *  nullptr, no timing is performed.
+     */
+    ScopedProfilingTimer( ProfilingEntry* profilingEntry ):
+        profilingEntry_( profilingEntry )
+    {
+        if( profilingEntry_ != nullptr )
+        {
+            startTime_ = std::chrono::steady_clock::now( );
+        }
+    }
+
+    //! Destructor, adds the elapsed time to the profiling entry.
+    ~ScopedProfilingTimer( )
+    {
+        if( profilingEntry_ != nullptr )
+        {
+            profilingEntry_->numberOfCalls++;
+            profilingEntry_->totalNanoseconds += static_cast< unsigned long long >(
+                        std::chrono::duration_cast< std::chrono::nanoseconds >(
+                            std::chrono::steady_clock::now( ) - startTime_ ).count( ) );
+        }
+    }
+
+private:
+
+    //! Entry to which the number of calls and computation time are added upon destruction.
+    ProfilingEntry* profilingEntry_;
+
+    //! Time at which the timer was started.
+    std::chrono::steady_clock::time_point startTime_;
+};
+
+} // namespace utilities
+
+} // namespace tudat
+
+#define TUDAT_PROFILING_CONCATENATE_IMPLEMENTATION( first, second ) first##second
+#define TUDAT_PROFILING_CONCATENATE( first, second ) TUDAT_PROFILING_CONCATENATE_IMPLEMENTATION( first, second )
+
+//! Macro to time the remainder of the current scope, and add it to the given utilities::ProfilingEntry pointer.
+/*!
+ *  Macro to time the remainder of the current scope, and add it to the given utilities::ProfilingEntry pointer (which may
+ *  be nullptr). The macro expands to nothing if Tudat is not built with USE_PROFILING, so that the instrumentation has no
+ *  run-time cost in that case.
+ */
+#if( USE_PROFILING )
+#define TUDAT_PROFILE_SCOPE( profilingEntry ) \
+    tudat::utilities::ScopedProfilingTimer TUDAT_PROFILING_CONCATENATE( scopedProfilingTimer, __LINE__ )( profilingEntry )
+#else
+#define TUDAT_PROFILE_SCOPE( profilingEntry )
+#endif
+
+#endif // TUDAT_PROFILING_H
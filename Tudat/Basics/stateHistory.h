@@ -0,0 +1,435 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_STATEHISTORY_H
+#define TUDAT_STATEHISTORY_H
+
+#include <iterator>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace utilities
+{
+
+//! Class to store the history of a vector quantity (e.g. numerically integrated state) in contiguous memory.
+/*!
+ *  Class to store the history of a vector quantity of fixed size (e.g. numerically integrated state, or dependent variables)
+ *  in contiguous memory, as an alternative to a std::map< TimeType, Eigen::VectorXd >. The epochs are stored in a single
+ *  vector, and the states are stored as the rows of a single row-major block (i.e. the entries of each state are contiguous,
+ *  and the states are stored one after the other). Contrary to a map, adding an entry does not require a separate heap
+ *  allocation for the state and for the map node. When the history is cleared, the allocated memory is retained, so that
+ *  repeated propagations of the same size do not allocate any memory at all.
+ *  Entries are stored in the order in which they are added, which must be strictly monotonic in time (either increasing,
+ *  for forward propagation, or decreasing, for backward propagation). As for a map, adding an entry at the same epoch as the
+ *  last entry overwrites the last entry. A map of the history may be retrieved using the getHistoryMap function, for
+ *  compatibility with interfaces that require a map.
+ *  \tparam TimeType Type of the epochs
+ *  \tparam ScalarType Scalar type of the entries of the state
+ */
+template< typename TimeType, typename ScalarType = double >
+class StateHistory
+{
+public:
+
+    //! Typedef for the (vector) state that is stored.
+    typedef Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 > StateType;
+
+    //! Typedef for block containing all states (one state per row).
+    typedef Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor > StateBlockType;
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param stateSize Size of the state that is to be stored. If 0 (default), the size is set by the first entry that is
+     *  added to the history.
+     *  \param expectedNumberOfEntries Number of entries for which memory is to be pre-allocated (default 0).
+     */
+    StateHistory( const int stateSize = 0, const int expectedNumberOfEntries = 0 ):
+        stateSize_( stateSize )
+    {
+        if( stateSize_ < 0 )
+        {
+            throw std::runtime_error( "Error when creating state history, state size must be non-negative." );
+        }
+        reserve( expectedNumberOfEntries );
+    }
+
+    //! Constructor from map of states
+    /*!
+     *  Constructor from map of states, entries are stored in the (increasing) order of the map keys.
+     *  \param historyMap Map of states (time as key) that is to be stored.
+     */
+    template< int NumberOfRows >
+    StateHistory( const std::map< TimeType, Eigen::Matrix< ScalarType, NumberOfRows, 1 > >& historyMap ):
+        stateSize_( 0 )
+    {
+        if( historyMap.size( ) > 0 )
+        {
+            stateSize_ = historyMap.begin( )->second.rows( );
+        }
+        reserve( historyMap.size( ) );
+
+        for( typename std::map< TimeType, Eigen::Matrix< ScalarType, NumberOfRows, 1 > >::const_iterator
+             mapIterator = historyMap.begin( ); mapIterator != historyMap.end( ); mapIterator++ )
+        {
+            addEntry( mapIterator->first, mapIterator->second );
+        }
+    }
+
+    //! Function to pre-allocate memory for a given number of entries.
+    /*!
+     *  Function to pre-allocate memory for a given number of entries. If the state size is not yet known, only the memory
+     *  for the epochs is allocated.
+     *  \param numberOfEntries Number of entries for which memory is to be allocated.
+     */
+    void reserve( const int numberOfEntries )
+    {
+        if( numberOfEntries > 0 )
+        {
+            times_.reserve( numberOfEntries );
+            states_.reserve( numberOfEntries * stateSize_ );
+        }
+    }
+
+    //! Function to remove all entries from the history, retaining the allocated memory.
+    void clear( )
+    {
+        times_.clear( );
+        states_.clear( );
+    }
+
+    //! Function to remove all entries from the history, and reset the size of the state, retaining the allocated memory.
+    /*!
+     *  Function to remove all entries from the history, and reset the size of the state, retaining the allocated memory.
+     *  \param stateSize New size of the state that is to be stored (0 if size is to be set by first entry that is added).
+     */
+    void clear( const int stateSize )
+    {
+        clear( );
+        stateSize_ = stateSize;
+    }
+
+    //! Function to add an entry to the end of the history.
+    /*!
+     *  Function to add an entry to the end of the history. The epoch of the entry must be beyond the epoch of the current
+     *  last entry, in the direction (forward/backward in time) defined by the existing entries. If the epoch is equal to that
+     *  of the current last entry, this entry is overwritten.
+     *  \param time Epoch of the new entry
+     *  \param state State at the new epoch (must be a vector of size getStateSize( ) ).
+     */
+    template< typename Derived >
+    void addEntry( const TimeType& time, const Eigen::MatrixBase< Derived >& state )
+    {
+        if( stateSize_ == 0 && times_.size( ) == 0 )
+        {
+            stateSize_ = state.size( );
+        }
+
+        if( state.size( ) != stateSize_ || ( state.rows( ) != 1 && state.cols( ) != 1 ) )
+        {
+            throw std::runtime_error( "Error when adding entry to state history, state has size " +
+                                      std::to_string( state.size( ) ) + ", expected vector of size " +
+                                      std::to_string( stateSize_ ) );
+        }
+
+        // Check time ordering, overwrite last entry if epochs are equal.
+        int numberOfEntries = size( );
+        if( numberOfEntries > 0 )
+        {
+            if( time == times_.back( ) )
+            {
+                getState( numberOfEntries - 1 ) = state;
+                return;
+            }
+            else if( numberOfEntries > 1 && ( ( time > times_.back( ) ) != isInAscendingOrder( ) ) )
+            {
+                throw std::runtime_error( "Error when adding entry to state history, epochs are not monotonic." );
+            }
+        }
+
+        times_.push_back( time );
+        states_.resize( states_.size( ) + stateSize_ );
+        getState( numberOfEntries ) = state;
+    }
+
+    //! Function to remove the last entry from the history
+    void removeLastEntry( )
+    {
+        if( times_.size( ) == 0 )
+        {
+            throw std::runtime_error( "Error when removing entry from state history, history is empty." );
+        }
+        times_.pop_back( );
+        states_.resize( states_.size( ) - stateSize_ );
+    }
+
+    //! Function to retrieve the number of entries in the history.
+    /*!
+     *  Function to retrieve the number of entries in the history.
+     *  \return Number of entries in the history.
+     */
+    int size( ) const
+    {
+        return static_cast< int >( times_.size( ) );
+    }
+
+    //! Function to retrieve the size of the state that is stored.
+    /*!
+     *  Function to retrieve the size of the state that is stored.
+     *  \return Size of the state that is stored.
+     */
+    int getStateSize( ) const
+    {
+        return stateSize_;
+    }
+
+    //! Function to check whether the entries are stored with increasing epoch.
+    /*!
+     *  Function to check whether the entries are stored with increasing epoch. Returns true for histories with less than
+     *  two entries.
+     *  \return True if the entries are stored with increasing epoch, false if with decreasing epoch.
+     */
+    bool isInAscendingOrder( ) const
+    {
+        return ( times_.size( ) < 2 ) || ( times_.at( 1 ) > times_.at( 0 ) );
+    }
+
+    //! Function to retrieve the epochs of all entries, in the order in which they were added
+    /*!
+     *  Function to retrieve the epochs of all entries, in the order in which they were added
+     *  \return Epochs of all entries
+     */
+    const std::vector< TimeType >& getTimes( ) const
+    {
+        return times_;
+    }
+
+    //! Function to retrieve the epoch of a single entry
+    /*!
+     *  Function to retrieve the epoch of a single entry
+     *  \param index Index of the entry
+     *  \return Epoch of the requested entry
+     */
+    const TimeType& getTime( const int index ) const
+    {
+        return times_.at( index );
+    }
+
+    //! Function to retrieve a (modifiable) view of the state of a single entry
+    /*!
+     *  Function to retrieve a (modifiable) view of the state of a single entry. The view is invalidated if entries are added to
+     *  or removed from the history.
+     *  \param index Index of the entry
+     *  \return View of the state of the requested entry
+     */
+    Eigen::Map< StateType > getState( const int index )
+    {
+        return Eigen::Map< StateType >( states_.data( ) + index * stateSize_, stateSize_ );
+    }
+
+    //! Function to retrieve a view of the state of a single entry
+    /*!
+     *  Function to retrieve a view of the state of a single entry. The view is invalidated if entries are added to
+     *  or removed from the history.
+     *  \param index Index of the entry
+     *  \return View of the state of the requested entry
+     */
+    Eigen::Map< const StateType > getState( const int index ) const
+    {
+        return Eigen::Map< const StateType >( states_.data( ) + index * stateSize_, stateSize_ );
+    }
+
+    //! Function to retrieve the epoch of the last entry that was added.
+    /*!
+     *  Function to retrieve the epoch of the last entry that was added.
+     *  \return Epoch of the last entry that was added.
+     */
+    const TimeType& getLastTime( ) const
+    {
+        return times_.back( );
+    }
+
+    //! Function to retrieve a view of the block of all states, with the state of entry i in row i.
+    /*!
+     *  Function to retrieve a view of the block of all states, with the state of entry i in row i. The view is invalidated if
+     *  entries are added to or removed from the history.
+     *  \return View of the block of all states
+     */
+    Eigen::Map< const StateBlockType > getStateBlock( ) const
+    {
+        return Eigen::Map< const StateBlockType >( states_.data( ), size( ), stateSize_ );
+    }
+
+    //! Function to retrieve the history as a map
+    /*!
+     *  Function to retrieve the history as a map, with time as key, for use by interfaces that require a map.
+     *  \return Map of states, with time as key.
+     */
+    std::map< TimeType, StateType > getHistoryMap( ) const
+    {
+        std::map< TimeType, StateType > historyMap;
+        bool isAscending = isInAscendingOrder( );
+        for( int i = 0; i < size( ); i++ )
+        {
+            // Insert with hint, so that each insertion takes constant time.
+            historyMap.insert( isAscending ? historyMap.end( ) : historyMap.begin( ),
+                               std::make_pair( times_[ i ], StateType( getState( i ) ) ) );
+        }
+        return historyMap;
+    }
+
+    //! Function to retrieve (a segment of) the history as vectors of epochs and states, with increasing epoch.
+    /*!
+     *  Function to retrieve (a segment of) the history as vectors of epochs and states, with increasing epoch, as required
+     *  by the constructors of the interpolators, without the creation of an intermediate map.
+     *  \param times Epochs of the entries, in increasing order (returned by reference).
+     *  \param states (Segment of) the states at the entries in times (returned by reference).
+     *  \param startIndex Index in the state vector from which the state segment that is to be retrieved starts (default 0).
+     *  \param segmentSize Size of the state segment that is to be retrieved (default -1, denoting the full state).
+     */
+    template< typename OutputStateType >
+    void getSortedTimesAndStates( std::vector< TimeType >& times,
+                                  std::vector< OutputStateType >& states,
+                                  const int startIndex = 0,
+                                  const int segmentSize = -1 ) const
+    {
+        int sizeOfSegment = ( segmentSize < 0 ) ? ( stateSize_ - startIndex ) : segmentSize;
+        if( startIndex < 0 || startIndex + sizeOfSegment > stateSize_ )
+        {
+            throw std::runtime_error( "Error when retrieving state segment from state history, segment is out of bounds." );
+        }
+
+        int numberOfEntries = size( );
+        times.resize( numberOfEntries );
+        states.resize( numberOfEntries );
+
+        bool isAscending = isInAscendingOrder( );
+        for( int i = 0; i < numberOfEntries; i++ )
+        {
+            int entryIndex = isAscending ? i : ( numberOfEntries - 1 - i );
+            times[ i ] = times_[ entryIndex ];
+            states[ i ] = getState( entryIndex ).segment( startIndex, sizeOfSegment );
+        }
+    }
+
+private:
+
+    //! Size of the state that is stored.
+    int stateSize_;
+
+    //! Epochs of entries, in the order in which they were added.
+    std::vector< TimeType > times_;
+
+    //! States of entries, concatenated in the order in which they were added.
+    std::vector< ScalarType > states_;
+
+};
+
+//! Function to add an entry to a map of states
+/*!
+ *  Function to add an entry to a map of states, overload to allow (propagation) functions to be used with both maps and
+ *  StateHistory objects.
+ *  \param history Map of states to which entry is to be added.
+ *  \param time Epoch of the new entry
+ *  \param state State at the new epoch
+ */
+template< typename TimeType, typename StateType >
+void addEntryToHistory( std::map< TimeType, StateType >& history, const TimeType& time, const StateType& state )
+{
+    history[ time ] = state;
+}
+
+//! Function to add an entry to a state history
+/*!
+ *  Function to add an entry to a state history, overload to allow (propagation) functions to be used with both maps and
+ *  StateHistory objects.
+ *  \param history State history to which entry is to be added.
+ *  \param time Epoch of the new entry
+ *  \param state State at the new epoch
+ */
+template< typename TimeType, typename ScalarType, typename Derived >
+void addEntryToHistory( StateHistory< TimeType, ScalarType >& history, const TimeType& time,
+                        const Eigen::MatrixBase< Derived >& state )
+{
+    history.addEntry( time, state );
+}
+
+//! Function to retrieve the epoch of the last entry that was added to a map of states.
+/*!
+ *  Function to retrieve the epoch of the last entry that was added to a map of states, assuming entries were added
+ *  monotonically in time.
+ *  \param history Map of states
+ *  \param isHistoryForward Boolean denoting whether entries were added with increasing (true) or decreasing (false) epoch.
+ *  \return Epoch of the last entry that was added
+ */
+template< typename TimeType, typename StateType >
+TimeType getLastAddedTimeOfHistory( const std::map< TimeType, StateType >& history, const bool isHistoryForward )
+{
+    return isHistoryForward ? history.rbegin( )->first : history.begin( )->first;
+}
+
+//! Function to retrieve the epoch of the last entry that was added to a state history.
+/*!
+ *  Function to retrieve the epoch of the last entry that was added to a state history.
+ *  \param history State history
+ *  \param isHistoryForward Boolean denoting whether entries were added with increasing (true) or decreasing (false) epoch.
+ *  (unused by this overload).
+ *  \return Epoch of the last entry that was added
+ */
+template< typename TimeType, typename ScalarType >
+TimeType getLastAddedTimeOfHistory( const StateHistory< TimeType, ScalarType >& history, const bool /* isHistoryForward */ )
+{
+    return history.getLastTime( );
+}
+
+//! Function to remove the last entry that was added to a map of states.
+/*!
+ *  Function to remove the last entry that was added to a map of states, assuming entries were added monotonically in time.
+ *  \param history Map of states
+ *  \param isHistoryForward Boolean denoting whether entries were added with increasing (true) or decreasing (false) epoch.
+ */
+template< typename TimeType, typename StateType >
+void removeLastAddedEntryOfHistory( std::map< TimeType, StateType >& history, const bool isHistoryForward )
+{
+    if( isHistoryForward )
+    {
+        history.erase( std::prev( history.end( ) ) );
+    }
+    else
+    {
+        history.erase( history.begin( ) );
+    }
+}
+
+//! Function to remove the last entry that was added to a state history.
+/*!
+ *  Function to remove the last entry that was added to a state history.
+ *  \param history State history
+ *  \param isHistoryForward Boolean denoting whether entries were added with increasing (true) or decreasing (false) epoch.
+ *  (unused by this overload).
+ */
+template< typename TimeType, typename ScalarType >
+void removeLastAddedEntryOfHistory( StateHistory< TimeType, ScalarType >& history, const bool /* isHistoryForward */ )
+{
+    history.removeLastEntry( );
+}
+
+} // namespace utilities
+
+} // namespace tudat
+
+#endif // TUDAT_STATEHISTORY_H
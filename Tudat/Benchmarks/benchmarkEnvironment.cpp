@@ -0,0 +1,230 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Notes
+ *      Micro-benchmarks of environment models evaluated during propagation: spherical harmonic gravitational acceleration
+ *      (with randomly generated coefficients, through the acceleration model, the term-by-term summation and the
+ *      acceleration kernel), NRLMSISE-00 atmosphere and the ITRS to GCRS rotation.
+ *
+ */
+
+#include <cmath>
+#include <map>
+#include <random>
+#include <vector>
+
+#include "Tudat/Astrodynamics/Gravitation/sphericalHarmonicsAccelerationKernel.h"
+#include "Tudat/Astrodynamics/Gravitation/sphericalHarmonicsGravityModel.h"
+#include "Tudat/Basics/benchmarking.h"
+#include "Tudat/InputOutput/basicInputOutput.h"
+#if USE_NRLMSISE00
+#include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00Atmosphere.h"
+#include "Tudat/Astrodynamics/Aerodynamics/nrlmsise00InputFunctions.h"
+#include "Tudat/InputOutput/solarActivityData.h"
+#endif
+#if USE_SOFA
+#include "Tudat/Astrodynamics/EarthOrientation/earthOrientationCalculator.h"
+#include "Tudat/Astrodynamics/Ephemerides/itrsToGcrsRotationModel.h"
+#endif
+
+namespace tudat
+{
+
+namespace benchmarks
+{
+
+//! Function to generate random geodesy-normalized coefficients, with magnitude following Kaula's rule.
+void generateRandomSphericalHarmonicCoefficients( const int maximumDegree, std::mt19937& randomNumberGenerator,
+                                                  Eigen::MatrixXd& cosineCoefficients,
+                                                  Eigen::MatrixXd& sineCoefficients )
+{
+    std::normal_distribution< double > distribution( 0.0, 1.0 );
+    cosineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumDegree + 1 );
+    sineCoefficients = Eigen::MatrixXd::Zero( maximumDegree + 1, maximumDegree + 1 );
+    cosineCoefficients( 0, 0 ) = 1.0;
+    for( int degree = 2; degree <= maximumDegree; degree++ )
+    {
+        for( int order = 0; order <= degree; order++ )
+        {
+            const double coefficientMagnitude = 1.0E-5 / static_cast< double >( degree * degree );
+            cosineCoefficients( degree, order ) = coefficientMagnitude * distribution( randomNumberGenerator );
+            if( order > 0 )
+            {
+                sineCoefficients( degree, order ) = coefficientMagnitude * distribution( randomNumberGenerator );
+            }
+        }
+    }
+}
+
+//! Function to generate evaluation positions at LEO altitude, in random directions.
+std::vector< Eigen::Vector3d > generateRandomLeoPositions( const double referenceRadius,
+                                                           std::mt19937& randomNumberGenerator )
+{
+    std::normal_distribution< double > distribution( 0.0, 1.0 );
+    std::vector< Eigen::Vector3d > positions;
+    for( int i = 0; i < 100; i++ )
+    {
+        Eigen::Vector3d direction( distribution( randomNumberGenerator ), distribution( randomNumberGenerator ),
+                                   distribution( randomNumberGenerator ) );
+        positions.push_back( ( referenceRadius + 500.0E3 ) * direction.normalized( ) );
+    }
+    return positions;
+}
+
+//! Benchmark of the spherical harmonic gravitational acceleration model, for a field of given degree and order.
+void benchmarkSphericalHarmonicsAcceleration( utilities::BenchmarkState& benchmarkState, const int maximumDegree )
+{
+    const double gravitationalParameter = 3.986004418E14;
+    const double referenceRadius = 6378137.0;
+
+    std::mt19937 randomNumberGenerator( 42 );
+    Eigen::MatrixXd cosineCoefficients, sineCoefficients;
+    generateRandomSphericalHarmonicCoefficients(
+                maximumDegree, randomNumberGenerator, cosineCoefficients, sineCoefficients );
+    std::vector< Eigen::Vector3d > positions = generateRandomLeoPositions( referenceRadius, randomNumberGenerator );
+
+    unsigned int positionIndex = 0;
+    gravitation::SphericalHarmonicsGravitationalAccelerationModel accelerationModel(
+                [ & ]( ){ return positions[ positionIndex ]; },
+                gravitationalParameter, referenceRadius, cosineCoefficients, sineCoefficients );
+
+    double currentTime = 0.0;
+    while( benchmarkState.keepRunning( ) )
+    {
+        accelerationModel.updateMembers( currentTime );
+        utilities::doNotOptimize( accelerationModel.getAcceleration( ) );
+
+        currentTime += 1.0;
+        positionIndex = ( positionIndex + 1 ) % positions.size( );
+    }
+}
+
+TUDAT_BENCHMARK( "SphericalHarmonicsAcceleration/20",
+                 std::bind( &benchmarkSphericalHarmonicsAcceleration, std::placeholders::_1, 20 ) );
+TUDAT_BENCHMARK( "SphericalHarmonicsAcceleration/70",
+                 std::bind( &benchmarkSphericalHarmonicsAcceleration, std::placeholders::_1, 70 ) );
+TUDAT_BENCHMARK( "SphericalHarmonicsAcceleration/200",
+                 std::bind( &benchmarkSphericalHarmonicsAcceleration, std::placeholders::_1, 200 ) );
+
+//! Benchmark of the direct evaluation of the spherical harmonic acceleration, either through the term-by-term
+//! summation (computeGeodesyNormalizedGravitationalAccelerationSum) or through the acceleration kernel.
+void benchmarkSphericalHarmonicsAccelerationEvaluation(
+        utilities::BenchmarkState& benchmarkState, const int maximumDegree, const bool useKernel,
+        const gravitation::SphericalHarmonicsSummationMethod summationMethod )
+{
+    const double gravitationalParameter = 3.986004418E14;
+    const double referenceRadius = 6378137.0;
+
+    std::mt19937 randomNumberGenerator( 42 );
+    Eigen::MatrixXd cosineCoefficients, sineCoefficients;
+    generateRandomSphericalHarmonicCoefficients(
+                maximumDegree, randomNumberGenerator, cosineCoefficients, sineCoefficients );
+    std::vector< Eigen::Vector3d > positions = generateRandomLeoPositions( referenceRadius, randomNumberGenerator );
+
+    std::shared_ptr< basic_mathematics::SphericalHarmonicsCache > sphericalHarmonicsCache =
+            std::make_shared< basic_mathematics::SphericalHarmonicsCache >( maximumDegree + 1, maximumDegree + 2 );
+    std::map< std::pair< int, int >, Eigen::Vector3d > accelerationPerTerm;
+    gravitation::SphericalHarmonicsAccelerationKernel accelerationKernel( cosineCoefficients, sineCoefficients );
+    accelerationKernel.setSummationMethod( summationMethod );
+
+    unsigned int positionIndex = 0;
+    while( benchmarkState.keepRunning( ) )
+    {
+        if( useKernel )
+        {
+            utilities::doNotOptimize( accelerationKernel.computeAcceleration(
+                                          positions[ positionIndex ], gravitationalParameter, referenceRadius ) );
+        }
+        else
+        {
+            utilities::doNotOptimize( gravitation::computeGeodesyNormalizedGravitationalAccelerationSum(
+                                          positions[ positionIndex ], gravitationalParameter, referenceRadius,
+                                          cosineCoefficients, sineCoefficients, sphericalHarmonicsCache,
+                                          accelerationPerTerm ) );
+        }
+        positionIndex = ( positionIndex + 1 ) % positions.size( );
+    }
+}
+
+TUDAT_BENCHMARK( "SphericalHarmonicsAccelerationSum/360",
+                 std::bind( &benchmarkSphericalHarmonicsAccelerationEvaluation, std::placeholders::_1, 360, false,
+                            gravitation::forward_recursion_summation ) );
+TUDAT_BENCHMARK( "SphericalHarmonicsAccelerationKernel/20",
+                 std::bind( &benchmarkSphericalHarmonicsAccelerationEvaluation, std::placeholders::_1, 20, true,
+                            gravitation::forward_recursion_summation ) );
+TUDAT_BENCHMARK( "SphericalHarmonicsAccelerationKernel/70",
+                 std::bind( &benchmarkSphericalHarmonicsAccelerationEvaluation, std::placeholders::_1, 70, true,
+                            gravitation::forward_recursion_summation ) );
+TUDAT_BENCHMARK( "SphericalHarmonicsAccelerationKernel/200",
+                 std::bind( &benchmarkSphericalHarmonicsAccelerationEvaluation, std::placeholders::_1, 200, true,
+                            gravitation::forward_recursion_summation ) );
+TUDAT_BENCHMARK( "SphericalHarmonicsAccelerationKernel/360",
+                 std::bind( &benchmarkSphericalHarmonicsAccelerationEvaluation, std::placeholders::_1, 360, true,
+                            gravitation::forward_recursion_summation ) );
+TUDAT_BENCHMARK( "SphericalHarmonicsAccelerationKernelClenshaw/20",
+                 std::bind( &benchmarkSphericalHarmonicsAccelerationEvaluation, std::placeholders::_1, 20, true,
+                            gravitation::clenshaw_summation ) );
+TUDAT_BENCHMARK( "SphericalHarmonicsAccelerationKernelClenshaw/70",
+                 std::bind( &benchmarkSphericalHarmonicsAccelerationEvaluation, std::placeholders::_1, 70, true,
+                            gravitation::clenshaw_summation ) );
+TUDAT_BENCHMARK( "SphericalHarmonicsAccelerationKernelClenshaw/200",
+                 std::bind( &benchmarkSphericalHarmonicsAccelerationEvaluation, std::placeholders::_1, 200, true,
+                            gravitation::clenshaw_summation ) );
+TUDAT_BENCHMARK( "SphericalHarmonicsAccelerationKernelClenshaw/360",
+                 std::bind( &benchmarkSphericalHarmonicsAccelerationEvaluation, std::placeholders::_1, 360, true,
+                            gravitation::clenshaw_summation ) );
+
+#if USE_NRLMSISE00
+//! Benchmark of the evaluation of the NRLMSISE-00 atmosphere density, using the default space weather data.
+void benchmarkNrlmsise00Atmosphere( utilities::BenchmarkState& benchmarkState )
+{
+    input_output::solar_activity::SolarActivityDataMap solarActivityData =
+            input_output::solar_activity::readSolarActivityData(
+                input_output::getSpaceWeatherDataPath( ) + "sw19571001.txt" );
+    aerodynamics::NRLMSISE00Atmosphere atmosphereModel(
+                std::bind( &aerodynamics::nrlmsiseInputFunction, std::placeholders::_1, std::placeholders::_2,
+                           std::placeholders::_3, std::placeholders::_4, solarActivityData, false, 0.0 ) );
+
+    // Evaluate along (approximate) LEO ground track, so that no cached model output is reused.
+    double currentTime = 1.0E8;
+    while( benchmarkState.keepRunning( ) )
+    {
+        const double orbitAngle = std::fmod( 2.0 * mathematical_constants::PI * currentTime / 5400.0,
+                                             2.0 * mathematical_constants::PI );
+        utilities::doNotOptimize( atmosphereModel.getDensity(
+                                      400.0E3 + 20.0E3 * std::sin( orbitAngle ), orbitAngle - mathematical_constants::PI,
+                                      1.2 * std::sin( orbitAngle ), currentTime ) );
+        currentTime += 10.0;
+    }
+}
+
+TUDAT_BENCHMARK( "Nrlmsise00Atmosphere/Density", &benchmarkNrlmsise00Atmosphere );
+#endif
+
+#if USE_SOFA
+//! Benchmark of the computation of the rotation from ITRS to GCRS, using the IERS 2010 conventions.
+void benchmarkItrsToGcrsRotation( utilities::BenchmarkState& benchmarkState )
+{
+    ephemerides::GcrsToItrsRotationModel earthRotationModel(
+                earth_orientation::createStandardEarthOrientationCalculator( ) );
+
+    double currentTime = 1.0E8;
+    while( benchmarkState.keepRunning( ) )
+    {
+        utilities::doNotOptimize( earthRotationModel.getRotationToBaseFrame( currentTime ) );
+        currentTime += 10.0;
+    }
+}
+
+TUDAT_BENCHMARK( "ItrsToGcrsRotation/Iers2010", &benchmarkItrsToGcrsRotation );
+#endif
+
+} // namespace benchmarks
+
+} // namespace tudat
@@ -0,0 +1,121 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Notes
+ *      Micro-benchmarks of the Legendre polynomial recursion, the Kepler equation solver and the Lagrange interpolator.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <random>
+#include <vector>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/convertMeanToEccentricAnomalies.h"
+#include "Tudat/Basics/benchmarking.h"
+#include "Tudat/Mathematics/BasicMathematics/legendrePolynomials.h"
+#include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
+
+namespace tudat
+{
+
+namespace benchmarks
+{
+
+//! Benchmark of the update of the geodesy-normalized Legendre polynomial cache up to the given degree and order.
+void benchmarkLegendreRecursion( utilities::BenchmarkState& benchmarkState, const int maximumDegree )
+{
+    basic_mathematics::LegendreCache legendreCache( maximumDegree, maximumDegree, true );
+
+    // Cycle through range of latitudes, so that the cache is recomputed at each evaluation.
+    std::vector< double > polynomialParameters;
+    for( int i = 0; i < 64; i++ )
+    {
+        polynomialParameters.push_back( std::sin( -1.5 + 3.0 * static_cast< double >( i ) / 63.0 ) );
+    }
+
+    unsigned int parameterIndex = 0;
+    while( benchmarkState.keepRunning( ) )
+    {
+        legendreCache.update( polynomialParameters[ parameterIndex ] );
+        utilities::doNotOptimize( legendreCache.getLegendrePolynomial( maximumDegree, maximumDegree ) );
+        parameterIndex = ( parameterIndex + 1 ) % polynomialParameters.size( );
+    }
+}
+
+//! Benchmark of the solution of Kepler's equation for elliptical orbits, for a grid of eccentricities and mean anomalies.
+void benchmarkKeplerSolver( utilities::BenchmarkState& benchmarkState )
+{
+    std::vector< std::pair< double, double > > eccentricitiesAndMeanAnomalies;
+    for( int i = 0; i < 10; i++ )
+    {
+        for( int j = 0; j < 10; j++ )
+        {
+            eccentricitiesAndMeanAnomalies.push_back(
+                        std::make_pair( 0.95 * static_cast< double >( i ) / 9.0 + 0.001,
+                                        2.0 * mathematical_constants::PI * static_cast< double >( j ) / 10.0 + 0.1 ) );
+        }
+    }
+
+    while( benchmarkState.keepRunning( ) )
+    {
+        for( unsigned int i = 0; i < eccentricitiesAndMeanAnomalies.size( ); i++ )
+        {
+            utilities::doNotOptimize( orbital_element_conversions::convertMeanAnomalyToEccentricAnomaly(
+                                          eccentricitiesAndMeanAnomalies[ i ].first,
+                                          eccentricitiesAndMeanAnomalies[ i ].second ) );
+        }
+    }
+    benchmarkState.setItemsProcessed( benchmarkState.getNumberOfIterations( ) * eccentricitiesAndMeanAnomalies.size( ) );
+}
+
+//! Benchmark of the interpolation of a Cartesian state history with an 8-point Lagrange interpolator.
+void benchmarkLagrangeInterpolator( utilities::BenchmarkState& benchmarkState )
+{
+    // Create state history of circular orbit, with 60 s step size.
+    std::map< double, Eigen::Vector6d > stateHistory;
+    for( int i = 0; i < 1000; i++ )
+    {
+        const double time = 60.0 * static_cast< double >( i );
+        const double angle = 1.0E-3 * time;
+        stateHistory[ time ] = ( Eigen::Vector6d( ) << std::cos( angle ), std::sin( angle ), 0.0,
+                                 -1.0E-3 * std::sin( angle ), 1.0E-3 * std::cos( angle ), 0.0 ).finished( );
+    }
+    interpolators::LagrangeInterpolator< double, Eigen::Vector6d > interpolator( stateHistory, 8 );
+
+    // Generate random (sorted) interpolation times, as typically requested during observation simulation.
+    std::mt19937 randomNumberGenerator( 42 );
+    std::uniform_real_distribution< double > distribution( 600.0, 59000.0 );
+    std::vector< double > interpolationTimes;
+    for( int i = 0; i < 1000; i++ )
+    {
+        interpolationTimes.push_back( distribution( randomNumberGenerator ) );
+    }
+    std::sort( interpolationTimes.begin( ), interpolationTimes.end( ) );
+
+    while( benchmarkState.keepRunning( ) )
+    {
+        for( unsigned int i = 0; i < interpolationTimes.size( ); i++ )
+        {
+            utilities::doNotOptimize( interpolator.interpolate( interpolationTimes[ i ] ) );
+        }
+    }
+    benchmarkState.setItemsProcessed( benchmarkState.getNumberOfIterations( ) * interpolationTimes.size( ) );
+}
+
+TUDAT_BENCHMARK( "LegendreRecursion/20", std::bind( &benchmarkLegendreRecursion, std::placeholders::_1, 20 ) );
+TUDAT_BENCHMARK( "LegendreRecursion/70", std::bind( &benchmarkLegendreRecursion, std::placeholders::_1, 70 ) );
+TUDAT_BENCHMARK( "LegendreRecursion/200", std::bind( &benchmarkLegendreRecursion, std::placeholders::_1, 200 ) );
+TUDAT_BENCHMARK( "KeplerSolver/Elliptical", &benchmarkKeplerSolver );
+TUDAT_BENCHMARK( "LagrangeInterpolator/Vector6d/8", &benchmarkLagrangeInterpolator );
+
+} // namespace benchmarks
+
+} // namespace tudat
@@ -0,0 +1,80 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Notes
+ *      Macro-benchmark of a grid search over departure date and time of flight for an Earth-Mars transfer, solving a
+ *      Lambert problem (Izzo's method) for each grid point, with approximate planet positions.
+ *
+ */
+
+#include <algorithm>
+#include <limits>
+
+#include "Tudat/Astrodynamics/BasicAstrodynamics/physicalConstants.h"
+#include "Tudat/Astrodynamics/Ephemerides/approximatePlanetPositions.h"
+#include "Tudat/Astrodynamics/MissionSegments/lambertTargeterIzzo.h"
+#include "Tudat/Basics/benchmarking.h"
+
+namespace tudat
+{
+
+namespace benchmarks
+{
+
+//! Benchmark of a 100 x 100 Lambert grid search for an Earth-Mars transfer.
+void benchmarkLambertGridSearch( utilities::BenchmarkState& benchmarkState )
+{
+    const double sunGravitationalParameter = 1.32712440018E20;
+    const int numberOfDepartureDates = 100;
+    const int numberOfTimesOfFlight = 100;
+
+    ephemerides::ApproximatePlanetPositions earthEphemeris(
+                ephemerides::ApproximatePlanetPositionsBase::earthMoonBarycenter );
+    ephemerides::ApproximatePlanetPositions marsEphemeris(
+                ephemerides::ApproximatePlanetPositionsBase::mars );
+
+    while( benchmarkState.keepRunning( ) )
+    {
+        double minimumDeltaV = std::numeric_limits< double >::max( );
+        for( int i = 0; i < numberOfDepartureDates; i++ )
+        {
+            // Departure dates spread over two years, starting in 2020.
+            const double departureTime = 20.0 * physical_constants::JULIAN_YEAR +
+                    2.0 * physical_constants::JULIAN_YEAR * static_cast< double >( i ) /
+                    static_cast< double >( numberOfDepartureDates );
+            const Eigen::Vector6d departureState = earthEphemeris.getCartesianState( departureTime );
+
+            for( int j = 0; j < numberOfTimesOfFlight; j++ )
+            {
+                // Times of flight between 100 and 400 days.
+                const double timeOfFlight = ( 100.0 + 300.0 * static_cast< double >( j ) /
+                                              static_cast< double >( numberOfTimesOfFlight ) ) *
+                        physical_constants::JULIAN_DAY;
+                const Eigen::Vector6d arrivalState = marsEphemeris.getCartesianState( departureTime + timeOfFlight );
+
+                mission_segments::LambertTargeterIzzo lambertTargeter(
+                            departureState.segment( 0, 3 ), arrivalState.segment( 0, 3 ), timeOfFlight,
+                            sunGravitationalParameter );
+                const double totalDeltaV =
+                        ( lambertTargeter.getInertialVelocityAtDeparture( ) - departureState.segment( 3, 3 ) ).norm( ) +
+                        ( lambertTargeter.getInertialVelocityAtArrival( ) - arrivalState.segment( 3, 3 ) ).norm( );
+                minimumDeltaV = std::min( minimumDeltaV, totalDeltaV );
+            }
+        }
+        utilities::doNotOptimize( minimumDeltaV );
+    }
+    benchmarkState.setItemsProcessed(
+                benchmarkState.getNumberOfIterations( ) * numberOfDepartureDates * numberOfTimesOfFlight );
+}
+
+TUDAT_BENCHMARK( "LambertGridSearch/EarthMars", &benchmarkLambertGridSearch );
+
+} // namespace benchmarks
+
+} // namespace tudat
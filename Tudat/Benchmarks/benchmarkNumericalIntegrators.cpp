@@ -0,0 +1,344 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Hairer, E., Lubich, C., Wanner, G. Geometric Numerical Integration, 2nd Edition, Springer, 2006.
+ *
+ *    Notes
+ *      Benchmarks of the numerical integrators, reporting the number of state derivative evaluations and the accuracy of
+ *      the result as counters alongside the timings:
+ *        - Gauss-Jackson, Runge-Kutta (Fehlberg 7(8) and Dormand-Prince 8(7)) and Adams-Bashforth-Moulton integrators
+ *          for a one-day propagation of a low Earth orbit in the GGM02C gravity field (degree and order 20), with Earth
+ *          rotation modelled as a uniform rotation about the inertial z-axis. The final position error is computed
+ *          w.r.t. a Dormand-Prince 8(7) solution with a small fixed step size.
+ *        - Symplectic (Yoshida and Gauss-Legendre), Runge-Kutta, Adams-Bashforth-Moulton and Bulirsch-Stoer integrators
+ *          for a propagation of the outer solar system over 10^5 days (Sun, Jupiter, Saturn, Uranus, Neptune and Pluto
+ *          as mutually attracting point masses, initial conditions of Hairer et al., 2006, Section I.2.4), in
+ *          astronomical units, solar masses and days. The relative energy error is sampled every 1000 days.
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "Tudat/Astrodynamics/Gravitation/sphericalHarmonicsAccelerationKernel.h"
+#include "Tudat/Basics/benchmarking.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/Mathematics/NumericalIntegrators/createNumericalIntegrator.h"
+#include "Tudat/SimulationSetup/EnvironmentSetup/createGravityField.h"
+
+namespace tudat
+{
+
+namespace benchmarks
+{
+
+using namespace tudat::numerical_integrators;
+
+//! Definition of a propagation problem used to benchmark the numerical integrators.
+struct IntegratorBenchmarkProblem
+{
+    //! State derivative function, incrementing numberOfEvaluations at each call.
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > stateDerivativeFunction;
+
+    //! Initial state of the propagation (at t=0).
+    Eigen::VectorXd initialState;
+
+    //! Final time of the propagation.
+    double finalTime;
+
+    //! Reference period (orbital period or year), per which the number of state derivative evaluations is reported.
+    double referencePeriod;
+
+    //! Number of state derivative evaluations since it was last reset.
+    std::shared_ptr< long long > numberOfEvaluations;
+};
+
+//! Function to propagate a benchmark problem with the given integrator settings, returning the final state.
+Eigen::VectorXd propagateIntegratorBenchmarkProblem(
+        const IntegratorBenchmarkProblem& benchmarkProblem,
+        const std::shared_ptr< IntegratorSettings< double > > integratorSettings )
+{
+    std::shared_ptr< NumericalIntegrator< double, Eigen::VectorXd, Eigen::VectorXd > > integrator =
+            createIntegrator< double, Eigen::VectorXd >(
+                benchmarkProblem.stateDerivativeFunction, benchmarkProblem.initialState, integratorSettings );
+    return integrator->integrateTo( benchmarkProblem.finalTime, integratorSettings->initialTimeStep_ );
+}
+
+//! Function to create the GGM02C (degree and order 20) LEO propagation problem, propagated over one day.
+IntegratorBenchmarkProblem createGgm02cLeoPropagationProblem( )
+{
+    // Load GGM02C gravity field.
+    std::pair< Eigen::MatrixXd, Eigen::MatrixXd > coefficients;
+    const std::pair< double, double > fieldParameters = simulation_setup::readGravityFieldFile(
+                simulation_setup::getPathForSphericalHarmonicsModel( simulation_setup::ggm02c ), 20, 20,
+                coefficients, 0, 1 );
+    const double gravitationalParameter = fieldParameters.first;
+    const double referenceRadius = fieldParameters.second;
+    const double earthRotationRate = 7.2921150E-5;
+    std::shared_ptr< gravitation::SphericalHarmonicsAccelerationKernel > accelerationKernel =
+            std::make_shared< gravitation::SphericalHarmonicsAccelerationKernel >(
+                coefficients.first, coefficients.second );
+
+    // Define state derivative function (Cowell formulation).
+    IntegratorBenchmarkProblem benchmarkProblem;
+    benchmarkProblem.numberOfEvaluations = std::make_shared< long long >( 0 );
+    std::shared_ptr< long long > numberOfEvaluations = benchmarkProblem.numberOfEvaluations;
+    benchmarkProblem.stateDerivativeFunction =
+            [ = ]( const double time, const Eigen::VectorXd& state )
+    {
+        ( *numberOfEvaluations )++;
+
+        const Eigen::Matrix3d rotationToBodyFixedFrame =
+                Eigen::AngleAxisd( -earthRotationRate * time, Eigen::Vector3d::UnitZ( ) ).toRotationMatrix( );
+        Eigen::VectorXd stateDerivative( 6 );
+        stateDerivative.segment( 0, 3 ) = state.segment( 3, 3 );
+        stateDerivative.segment( 3, 3 ) = rotationToBodyFixedFrame.transpose( ) * accelerationKernel->computeAcceleration(
+                    rotationToBodyFixedFrame * state.segment( 0, 3 ), gravitationalParameter, referenceRadius );
+        return stateDerivative;
+    };
+
+    // Define initial state: near-circular orbit at 400 km altitude, with an inclination of 51.6 degrees.
+    const double semiMajorAxis = referenceRadius + 400.0E3;
+    const double eccentricity = 1.0E-3;
+    const double inclination = 51.6 * mathematical_constants::PI / 180.0;
+    const double perigeeVelocity = std::sqrt( gravitationalParameter / semiMajorAxis *
+                                              ( 1.0 + eccentricity ) / ( 1.0 - eccentricity ) );
+    benchmarkProblem.initialState = Eigen::VectorXd( 6 );
+    benchmarkProblem.initialState << semiMajorAxis * ( 1.0 - eccentricity ), 0.0, 0.0,
+            0.0, perigeeVelocity * std::cos( inclination ), perigeeVelocity * std::sin( inclination );
+    benchmarkProblem.finalTime = 86400.0;
+    benchmarkProblem.referencePeriod = 2.0 * mathematical_constants::PI *
+            std::sqrt( std::pow( semiMajorAxis, 3 ) / gravitationalParameter );
+
+    return benchmarkProblem;
+}
+
+//! Benchmark of a one-day GGM02C LEO propagation with the given integrator settings.
+void benchmarkGgm02cLeoPropagation( utilities::BenchmarkState& benchmarkState,
+                                    const std::shared_ptr< IntegratorSettings< double > > integratorSettings )
+{
+    // Create problem and reference solution (Dormand-Prince 8(7) with small fixed step size) once for all benchmarks.
+    static const IntegratorBenchmarkProblem benchmarkProblem = createGgm02cLeoPropagationProblem( );
+    static const Eigen::Vector3d referencePosition = propagateIntegratorBenchmarkProblem(
+                benchmarkProblem, std::make_shared< RungeKuttaVariableStepSizeSettingsScalarTolerances< double > >(
+                    0.0, 2.5, RungeKuttaCoefficients::rungeKutta87DormandPrince, 2.5, 2.5,
+                    std::numeric_limits< double >::infinity( ), std::numeric_limits< double >::infinity( ) ) ).segment( 0, 3 );
+
+    *benchmarkProblem.numberOfEvaluations = 0;
+    Eigen::VectorXd finalState;
+    while( benchmarkState.keepRunning( ) )
+    {
+        finalState = propagateIntegratorBenchmarkProblem( benchmarkProblem, integratorSettings );
+        utilities::doNotOptimize( finalState );
+    }
+
+    const long long numberOfEvaluations = *benchmarkProblem.numberOfEvaluations;
+    benchmarkState.setItemsProcessed( static_cast< unsigned long long >( numberOfEvaluations ) );
+    benchmarkState.setCounter( "evaluationsPerOrbit", static_cast< double >( numberOfEvaluations ) /
+                               ( static_cast< double >( benchmarkState.getNumberOfIterations( ) ) *
+                                 benchmarkProblem.finalTime / benchmarkProblem.referencePeriod ) );
+    benchmarkState.setCounter( "finalPositionError", ( finalState.segment( 0, 3 ) - referencePosition ).norm( ) );
+}
+
+TUDAT_BENCHMARK_WITH_ITERATIONS(
+        "Ggm02cLeoPropagation/GaussJackson8PEC/60", std::bind(
+            &benchmarkGgm02cLeoPropagation, std::placeholders::_1,
+            std::make_shared< GaussJacksonIntegratorSettings< double > >( 0.0, 60.0, 8, 1 ) ), 3 );
+TUDAT_BENCHMARK_WITH_ITERATIONS(
+        "Ggm02cLeoPropagation/GaussJackson8PECE/60", std::bind(
+            &benchmarkGgm02cLeoPropagation, std::placeholders::_1,
+            std::make_shared< GaussJacksonIntegratorSettings< double > >( 0.0, 60.0, 8, 2 ) ), 3 );
+TUDAT_BENCHMARK_WITH_ITERATIONS(
+        "Ggm02cLeoPropagation/GaussJackson8PECE/30", std::bind(
+            &benchmarkGgm02cLeoPropagation, std::placeholders::_1,
+            std::make_shared< GaussJacksonIntegratorSettings< double > >( 0.0, 30.0, 8, 2 ) ), 3 );
+TUDAT_BENCHMARK_WITH_ITERATIONS(
+        "Ggm02cLeoPropagation/RungeKuttaFehlberg78/1E-10", std::bind(
+            &benchmarkGgm02cLeoPropagation, std::placeholders::_1,
+            std::make_shared< RungeKuttaVariableStepSizeSettingsScalarTolerances< double > >(
+                0.0, 10.0, RungeKuttaCoefficients::rungeKuttaFehlberg78, 1.0E-3, 1000.0, 1.0E-10, 1.0E-10 ) ), 3 );
+TUDAT_BENCHMARK_WITH_ITERATIONS(
+        "Ggm02cLeoPropagation/DormandPrince87/1E-10", std::bind(
+            &benchmarkGgm02cLeoPropagation, std::placeholders::_1,
+            std::make_shared< RungeKuttaVariableStepSizeSettingsScalarTolerances< double > >(
+                0.0, 10.0, RungeKuttaCoefficients::rungeKutta87DormandPrince, 1.0E-3, 1000.0, 1.0E-10, 1.0E-10 ) ), 3 );
+TUDAT_BENCHMARK_WITH_ITERATIONS(
+        "Ggm02cLeoPropagation/AdamsBashforthMoulton/1E-10", std::bind(
+            &benchmarkGgm02cLeoPropagation, std::placeholders::_1,
+            std::make_shared< AdamsBashforthMoultonSettings< double > >(
+                0.0, 10.0, 1.0E-3, 1000.0, 1.0E-10, 1.0E-10 ) ), 3 );
+
+//! Gravitational constant used in the outer solar system problem (in AU^3 / ( solar mass day^2 ) ).
+const double outerSolarSystemGravitationalConstant = 2.95912208286E-4;
+
+//! Function to retrieve the masses of the bodies in the outer solar system problem (Sun mass includes inner planets).
+std::vector< double > getOuterSolarSystemMasses( )
+{
+    return { 1.00000597682, 0.000954786104043, 0.000285583733151, 0.0000437273164546, 0.0000517759138449, 1.0 / 1.3E8 };
+}
+
+//! Function to compute the total (kinetic and potential) energy of the outer solar system.
+double computeOuterSolarSystemEnergy( const Eigen::VectorXd& state )
+{
+    static const std::vector< double > masses = getOuterSolarSystemMasses( );
+
+    double energy = 0.0;
+    for( unsigned int i = 0; i < masses.size( ); i++ )
+    {
+        energy += 0.5 * masses.at( i ) * state.segment( 6 * i + 3, 3 ).squaredNorm( );
+        for( unsigned int j = 0; j < i; j++ )
+        {
+            energy -= outerSolarSystemGravitationalConstant * masses.at( i ) * masses.at( j ) /
+                    ( state.segment( 6 * j, 3 ) - state.segment( 6 * i, 3 ) ).norm( );
+        }
+    }
+    return energy;
+}
+
+//! Function to create the outer solar system propagation problem, propagated over 10^5 days.
+IntegratorBenchmarkProblem createOuterSolarSystemPropagationProblem( )
+{
+    const std::vector< double > masses = getOuterSolarSystemMasses( );
+    const int numberOfBodies = static_cast< int >( masses.size( ) );
+
+    IntegratorBenchmarkProblem benchmarkProblem;
+    benchmarkProblem.initialState = Eigen::VectorXd::Zero( 6 * numberOfBodies );
+    benchmarkProblem.initialState.segment( 6, 6 ) <<
+            -3.5023653, -3.8169847, -1.5507963, 0.00565429, -0.00412490, -0.00190589;
+    benchmarkProblem.initialState.segment( 12, 6 ) <<
+            9.0755314, -3.0458353, -1.6483708, 0.00168318, 0.00483525, 0.00192462;
+    benchmarkProblem.initialState.segment( 18, 6 ) <<
+            8.3101420, -16.2901086, -7.2521278, 0.00354178, 0.00137102, 0.00055029;
+    benchmarkProblem.initialState.segment( 24, 6 ) <<
+            11.4707666, -25.7294829, -10.8169456, 0.00288930, 0.00114527, 0.00039677;
+    benchmarkProblem.initialState.segment( 30, 6 ) <<
+            -15.5387357, -25.2225594, -3.1902382, 0.00276725, -0.00170702, -0.00136504;
+    benchmarkProblem.finalTime = 1.0E5;
+    benchmarkProblem.referencePeriod = 365.25;
+
+    // Define state derivative function (Cowell formulation).
+    benchmarkProblem.numberOfEvaluations = std::make_shared< long long >( 0 );
+    std::shared_ptr< long long > numberOfEvaluations = benchmarkProblem.numberOfEvaluations;
+    benchmarkProblem.stateDerivativeFunction =
+            [ = ]( const double, const Eigen::VectorXd& state )
+    {
+        ( *numberOfEvaluations )++;
+
+        Eigen::VectorXd stateDerivative = Eigen::VectorXd::Zero( state.rows( ) );
+        for( int i = 0; i < numberOfBodies; i++ )
+        {
+            stateDerivative.segment( 6 * i, 3 ) = state.segment( 6 * i + 3, 3 );
+            for( int j = 0; j < i; j++ )
+            {
+                const Eigen::Vector3d relativePosition = state.segment( 6 * j, 3 ) - state.segment( 6 * i, 3 );
+                const Eigen::Vector3d scaledRelativePosition =
+                        outerSolarSystemGravitationalConstant * relativePosition / std::pow( relativePosition.norm( ), 3 );
+                stateDerivative.segment( 6 * i + 3, 3 ) += masses.at( j ) * scaledRelativePosition;
+                stateDerivative.segment( 6 * j + 3, 3 ) -= masses.at( i ) * scaledRelativePosition;
+            }
+        }
+        return stateDerivative;
+    };
+
+    return benchmarkProblem;
+}
+
+//! Benchmark of an outer solar system propagation with the given integrator settings.
+void benchmarkOuterSolarSystemPropagation( utilities::BenchmarkState& benchmarkState,
+                                           const std::shared_ptr< IntegratorSettings< double > > integratorSettings )
+{
+    static const IntegratorBenchmarkProblem benchmarkProblem = createOuterSolarSystemPropagationProblem( );
+    const double initialEnergy = computeOuterSolarSystemEnergy( benchmarkProblem.initialState );
+    const double samplingInterval = 1000.0;
+
+    *benchmarkProblem.numberOfEvaluations = 0;
+    double maximumRelativeEnergyError = 0.0;
+    double relativeEnergyError = 0.0;
+    while( benchmarkState.keepRunning( ) )
+    {
+        std::shared_ptr< NumericalIntegrator< double, Eigen::VectorXd, Eigen::VectorXd > > integrator =
+                createIntegrator< double, Eigen::VectorXd >(
+                    benchmarkProblem.stateDerivativeFunction, benchmarkProblem.initialState, integratorSettings );
+        double stepSize = integratorSettings->initialTimeStep_;
+        for( double sampleTime = samplingInterval; sampleTime <= benchmarkProblem.finalTime;
+             sampleTime += samplingInterval )
+        {
+            const Eigen::VectorXd sampleState = integrator->integrateTo( sampleTime, stepSize );
+            stepSize = integrator->getNextStepSize( );
+
+            benchmarkState.pauseTiming( );
+            relativeEnergyError = std::fabs( ( computeOuterSolarSystemEnergy( sampleState ) - initialEnergy ) /
+                                             initialEnergy );
+            maximumRelativeEnergyError = std::max( maximumRelativeEnergyError, relativeEnergyError );
+            benchmarkState.resumeTiming( );
+        }
+    }
+
+    const long long numberOfEvaluations = *benchmarkProblem.numberOfEvaluations;
+    benchmarkState.setItemsProcessed( static_cast< unsigned long long >( numberOfEvaluations ) );
+    benchmarkState.setCounter( "evaluationsPerYear", static_cast< double >( numberOfEvaluations ) /
+                               ( static_cast< double >( benchmarkState.getNumberOfIterations( ) ) *
+                                 benchmarkProblem.finalTime / benchmarkProblem.referencePeriod ) );
+    benchmarkState.setCounter( "maximumRelativeEnergyError", maximumRelativeEnergyError );
+    benchmarkState.setCounter( "finalRelativeEnergyError", relativeEnergyError );
+}
+
+TUDAT_BENCHMARK_WITH_ITERATIONS(
+        "OuterSolarSystemPropagation/Yoshida4/50", std::bind(
+            &benchmarkOuterSolarSystemPropagation, std::placeholders::_1,
+            std::make_shared< YoshidaSymplecticIntegratorSettings< double > >( 0.0, 50.0, 4 ) ), 1 );
+TUDAT_BENCHMARK_WITH_ITERATIONS(
+        "OuterSolarSystemPropagation/Yoshida6/50", std::bind(
+            &benchmarkOuterSolarSystemPropagation, std::placeholders::_1,
+            std::make_shared< YoshidaSymplecticIntegratorSettings< double > >( 0.0, 50.0, 6 ) ), 1 );
+TUDAT_BENCHMARK_WITH_ITERATIONS(
+        "OuterSolarSystemPropagation/Yoshida8/50", std::bind(
+            &benchmarkOuterSolarSystemPropagation, std::placeholders::_1,
+            std::make_shared< YoshidaSymplecticIntegratorSettings< double > >( 0.0, 50.0, 8 ) ), 1 );
+TUDAT_BENCHMARK_WITH_ITERATIONS(
+        "OuterSolarSystemPropagation/GaussLegendre4/50", std::bind(
+            &benchmarkOuterSolarSystemPropagation, std::placeholders::_1,
+            std::make_shared< GaussLegendreIntegratorSettings< double > >( 0.0, 50.0, 2 ) ), 1 );
+TUDAT_BENCHMARK_WITH_ITERATIONS(
+        "OuterSolarSystemPropagation/GaussLegendre6/50", std::bind(
+            &benchmarkOuterSolarSystemPropagation, std::placeholders::_1,
+            std::make_shared< GaussLegendreIntegratorSettings< double > >( 0.0, 50.0, 3 ) ), 1 );
+TUDAT_BENCHMARK_WITH_ITERATIONS(
+        "OuterSolarSystemPropagation/GaussLegendre8/50", std::bind(
+            &benchmarkOuterSolarSystemPropagation, std::placeholders::_1,
+            std::make_shared< GaussLegendreIntegratorSettings< double > >( 0.0, 50.0, 4 ) ), 1 );
+TUDAT_BENCHMARK_WITH_ITERATIONS(
+        "OuterSolarSystemPropagation/RungeKuttaFehlberg78/1E-12", std::bind(
+            &benchmarkOuterSolarSystemPropagation, std::placeholders::_1,
+            std::make_shared< RungeKuttaVariableStepSizeSettingsScalarTolerances< double > >(
+                0.0, 10.0, RungeKuttaCoefficients::rungeKuttaFehlberg78, 1.0E-3, 1000.0, 1.0E-12, 1.0E-12 ) ), 1 );
+TUDAT_BENCHMARK_WITH_ITERATIONS(
+        "OuterSolarSystemPropagation/DormandPrince87/1E-12", std::bind(
+            &benchmarkOuterSolarSystemPropagation, std::placeholders::_1,
+            std::make_shared< RungeKuttaVariableStepSizeSettingsScalarTolerances< double > >(
+                0.0, 10.0, RungeKuttaCoefficients::rungeKutta87DormandPrince, 1.0E-3, 1000.0, 1.0E-12, 1.0E-12 ) ), 1 );
+TUDAT_BENCHMARK_WITH_ITERATIONS(
+        "OuterSolarSystemPropagation/AdamsBashforthMoulton/1E-12", std::bind(
+            &benchmarkOuterSolarSystemPropagation, std::placeholders::_1,
+            std::make_shared< AdamsBashforthMoultonSettings< double > >(
+                0.0, 10.0, 1.0E-3, 1000.0, 1.0E-12, 1.0E-12 ) ), 1 );
+TUDAT_BENCHMARK_WITH_ITERATIONS(
+        "OuterSolarSystemPropagation/BulirschStoer/1E-12", std::bind(
+            &benchmarkOuterSolarSystemPropagation, std::placeholders::_1,
+            std::make_shared< BulirschStoerIntegratorSettings< double > >(
+                0.0, 10.0, bulirsch_stoer_sequence, 6, 1.0E-3, 1000.0, 1.0E-12, 1.0E-12 ) ), 1 );
+
+} // namespace benchmarks
+
+} // namespace tudat
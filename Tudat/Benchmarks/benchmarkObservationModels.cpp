@@ -0,0 +1,82 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Notes
+ *      Micro-benchmarks of the iterative light-time solution, for an interplanetary link between link ends on circular
+ *      heliocentric orbits, with and without first-order relativistic light-time correction.
+ *
+ */
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "Tudat/Astrodynamics/ObservationModels/lightTimeSolution.h"
+#include "Tudat/Astrodynamics/ObservationModels/ObservableCorrections/firstOrderRelativisticLightTimeCorrection.h"
+#include "Tudat/Basics/benchmarking.h"
+
+namespace tudat
+{
+
+namespace benchmarks
+{
+
+//! Function returning the Cartesian state on a circular orbit in the xy-plane.
+Eigen::Vector6d getCircularOrbitState( const double time, const double orbitRadius, const double meanMotion,
+                                       const double initialAngle )
+{
+    const double currentAngle = initialAngle + meanMotion * time;
+    return ( Eigen::Vector6d( ) << orbitRadius * std::cos( currentAngle ), orbitRadius * std::sin( currentAngle ), 0.0,
+             -orbitRadius * meanMotion * std::sin( currentAngle ), orbitRadius * meanMotion * std::cos( currentAngle ),
+             0.0 ).finished( );
+}
+
+//! Benchmark of the light-time solution between Earth- and Mars-like circular orbits.
+void benchmarkLightTimeCalculator( utilities::BenchmarkState& benchmarkState, const bool useRelativisticCorrection )
+{
+    const double sunGravitationalParameter = 1.32712440018E20;
+    const double astronomicalUnit = 1.495978707E11;
+
+    std::function< Eigen::Vector6d( const double ) > transmitterStateFunction =
+            std::bind( &getCircularOrbitState, std::placeholders::_1, astronomicalUnit,
+                       std::sqrt( sunGravitationalParameter / std::pow( astronomicalUnit, 3 ) ), 0.0 );
+    std::function< Eigen::Vector6d( const double ) > receiverStateFunction =
+            std::bind( &getCircularOrbitState, std::placeholders::_1, 1.52 * astronomicalUnit,
+                       std::sqrt( sunGravitationalParameter / std::pow( 1.52 * astronomicalUnit, 3 ) ), 1.0 );
+
+    std::vector< std::shared_ptr< observation_models::LightTimeCorrection > > lightTimeCorrections;
+    if( useRelativisticCorrection )
+    {
+        lightTimeCorrections.push_back(
+                    std::make_shared< observation_models::FirstOrderLightTimeCorrectionCalculator >(
+                        std::vector< std::function< Eigen::Vector6d( const double ) > >(
+                            { [ ]( const double ){ return Eigen::Vector6d::Zero( ).eval( ); } } ),
+                        std::vector< std::function< double( ) > >( { [ = ]( ){ return sunGravitationalParameter; } } ),
+                        std::vector< std::string >( { "Sun" } ), "Earth", "Mars" ) );
+    }
+
+    observation_models::LightTimeCalculator< double, double > lightTimeCalculator(
+                transmitterStateFunction, receiverStateFunction, lightTimeCorrections );
+
+    double currentTime = 1.0E8;
+    while( benchmarkState.keepRunning( ) )
+    {
+        utilities::doNotOptimize( lightTimeCalculator.calculateLightTime( currentTime ) );
+        currentTime += 60.0;
+    }
+}
+
+TUDAT_BENCHMARK( "LightTimeCalculator/NoCorrections",
+                 std::bind( &benchmarkLightTimeCalculator, std::placeholders::_1, false ) );
+TUDAT_BENCHMARK( "LightTimeCalculator/FirstOrderRelativistic",
+                 std::bind( &benchmarkLightTimeCalculator, std::placeholders::_1, true ) );
+
+} // namespace benchmarks
+
+} // namespace tudat
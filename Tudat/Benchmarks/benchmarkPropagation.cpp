@@ -0,0 +1,237 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Notes
+ *      Macro-benchmarks of a full LEO propagation (spherical harmonic gravity, third-body perturbations, radiation
+ *      pressure and drag) and of a multi-arc state estimation of a LEO vehicle. The environment is created from Spice,
+ *      so these benchmarks are only available when Tudat is built with USE_CSPICE.
+ *
+ */
+
+#include "Tudat/Basics/benchmarking.h"
+
+#if USE_CSPICE
+#include "Tudat/SimulationSetup/tudatSimulationHeader.h"
+#include "Tudat/Astrodynamics/ObservationModels/simulateObservations.h"
+#include "Tudat/SimulationSetup/EstimationSetup/orbitDeterminationManager.h"
+#endif
+
+namespace tudat
+{
+
+namespace benchmarks
+{
+
+#if USE_CSPICE
+
+using namespace tudat::simulation_setup;
+using namespace tudat::propagators;
+using namespace tudat::numerical_integrators;
+using namespace tudat::orbital_element_conversions;
+using namespace tudat::basic_astrodynamics;
+
+//! Function to retrieve the nominal initial Keplerian state of the LEO vehicle used in the benchmarks.
+Eigen::Vector6d getNominalLeoInitialKeplerianState( )
+{
+    Eigen::Vector6d initialStateInKeplerianElements;
+    initialStateInKeplerianElements( semiMajorAxisIndex ) = 6878.0E3;
+    initialStateInKeplerianElements( eccentricityIndex ) = 0.001;
+    initialStateInKeplerianElements( inclinationIndex ) = unit_conversions::convertDegreesToRadians( 97.4 );
+    initialStateInKeplerianElements( argumentOfPeriapsisIndex ) = unit_conversions::convertDegreesToRadians( 235.7 );
+    initialStateInKeplerianElements( longitudeOfAscendingNodeIndex ) = unit_conversions::convertDegreesToRadians( 23.4 );
+    initialStateInKeplerianElements( trueAnomalyIndex ) = unit_conversions::convertDegreesToRadians( 139.87 );
+    return initialStateInKeplerianElements;
+}
+
+//! Benchmark of a one-day propagation of a LEO vehicle with a representative set of perturbations.
+void benchmarkLeoPropagation( utilities::BenchmarkState& benchmarkState )
+{
+    spice_interface::loadStandardSpiceKernels( );
+
+    const double simulationStartEpoch = 1.0E7;
+    const double simulationEndEpoch = simulationStartEpoch + physical_constants::JULIAN_DAY;
+
+    // Create bodies.
+    std::vector< std::string > bodiesToCreate = { "Sun", "Earth", "Moon" };
+    std::map< std::string, std::shared_ptr< BodySettings > > bodySettings =
+            getDefaultBodySettings( bodiesToCreate, simulationStartEpoch - 300.0, simulationEndEpoch + 300.0 );
+    NamedBodyMap bodyMap = createBodies( bodySettings );
+
+    bodyMap[ "Vehicle" ] = std::make_shared< Body >( );
+    bodyMap[ "Vehicle" ]->setConstantBodyMass( 400.0 );
+    bodyMap[ "Vehicle" ]->setAerodynamicCoefficientInterface(
+                createAerodynamicCoefficientInterface(
+                    std::make_shared< ConstantAerodynamicCoefficientSettings >(
+                        4.0, 1.2 * Eigen::Vector3d::UnitX( ), 1, 1 ), "Vehicle" ) );
+    bodyMap[ "Vehicle" ]->setRadiationPressureInterface(
+                "Sun", createRadiationPressureInterface(
+                    std::make_shared< CannonBallRadiationPressureInterfaceSettings >(
+                        "Sun", 4.0, 1.2, std::vector< std::string >( { "Earth" } ) ), "Vehicle", bodyMap ) );
+    setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+
+    // Create accelerations.
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Vehicle" ][ "Earth" ].push_back( std::make_shared< SphericalHarmonicAccelerationSettings >( 20, 20 ) );
+    accelerationMap[ "Vehicle" ][ "Earth" ].push_back( std::make_shared< AccelerationSettings >( aerodynamic ) );
+    accelerationMap[ "Vehicle" ][ "Sun" ].push_back( std::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationMap[ "Vehicle" ][ "Sun" ].push_back(
+                std::make_shared< AccelerationSettings >( cannon_ball_radiation_pressure ) );
+    accelerationMap[ "Vehicle" ][ "Moon" ].push_back( std::make_shared< AccelerationSettings >( central_gravity ) );
+    std::vector< std::string > bodiesToPropagate = { "Vehicle" };
+    std::vector< std::string > centralBodies = { "Earth" };
+    AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodyMap, accelerationMap, bodiesToPropagate, centralBodies );
+
+    // Create propagation and integration settings.
+    const Eigen::Vector6d initialState = convertKeplerianToCartesianElements(
+                getNominalLeoInitialKeplerianState( ),
+                bodyMap.at( "Earth" )->getGravityFieldModel( )->getGravitationalParameter( ) );
+    std::shared_ptr< TranslationalStatePropagatorSettings< double > > propagatorSettings =
+            std::make_shared< TranslationalStatePropagatorSettings< double > >(
+                centralBodies, accelerationModelMap, bodiesToPropagate, initialState, simulationEndEpoch );
+    std::shared_ptr< IntegratorSettings< > > integratorSettings =
+            std::make_shared< IntegratorSettings< > >( rungeKutta4, simulationStartEpoch, 10.0 );
+
+    SingleArcDynamicsSimulator< > dynamicsSimulator(
+                bodyMap, integratorSettings, propagatorSettings, false );
+
+    while( benchmarkState.keepRunning( ) )
+    {
+        dynamicsSimulator.integrateEquationsOfMotion( propagatorSettings->getInitialStates( ) );
+        utilities::doNotOptimize( dynamicsSimulator.getEquationsOfMotionNumericalSolution( ).rbegin( )->second );
+    }
+    benchmarkState.setItemsProcessed(
+                benchmarkState.getNumberOfIterations( ) *
+                dynamicsSimulator.getEquationsOfMotionNumericalSolution( ).size( ) );
+}
+
+//! Benchmark of the estimation of the arc-wise initial states of a LEO vehicle, from simulated position observations.
+void benchmarkMultiArcEstimation( utilities::BenchmarkState& benchmarkState )
+{
+    using namespace tudat::observation_models;
+    using namespace tudat::estimatable_parameters;
+
+    spice_interface::loadStandardSpiceKernels( );
+
+    const double initialEphemerisTime = 1.0E7;
+    const double finalEphemerisTime = initialEphemerisTime + 4.0 * physical_constants::JULIAN_DAY;
+    const int numberOfArcs = 4;
+
+    // Create bodies.
+    std::vector< std::string > bodyNames = { "Earth", "Sun", "Moon" };
+    std::map< std::string, std::shared_ptr< BodySettings > > bodySettings =
+            getDefaultBodySettings( bodyNames, initialEphemerisTime - physical_constants::JULIAN_DAY,
+                                    finalEphemerisTime + physical_constants::JULIAN_DAY );
+    NamedBodyMap bodyMap = createBodies( bodySettings );
+    bodyMap[ "Vehicle" ] = std::make_shared< Body >( );
+    bodyMap[ "Vehicle" ]->setEphemeris( std::make_shared< ephemerides::MultiArcEphemeris >(
+                                            std::map< double, std::shared_ptr< ephemerides::Ephemeris > >( ),
+                                            "Earth", "ECLIPJ2000" ) );
+    setGlobalFrameBodyEphemerides( bodyMap, "Earth", "ECLIPJ2000" );
+
+    // Create accelerations.
+    SelectedAccelerationMap accelerationMap;
+    accelerationMap[ "Vehicle" ][ "Earth" ].push_back( std::make_shared< SphericalHarmonicAccelerationSettings >( 8, 8 ) );
+    accelerationMap[ "Vehicle" ][ "Sun" ].push_back( std::make_shared< AccelerationSettings >( central_gravity ) );
+    accelerationMap[ "Vehicle" ][ "Moon" ].push_back( std::make_shared< AccelerationSettings >( central_gravity ) );
+    std::vector< std::string > bodiesToIntegrate = { "Vehicle" };
+    std::vector< std::string > centralBodies = { "Earth" };
+    AccelerationMap accelerationModelMap = createAccelerationModelsMap(
+                bodyMap, accelerationMap, bodiesToIntegrate, centralBodies );
+
+    // Define arcs, and initial state per arc.
+    const double arcDuration = ( finalEphemerisTime - initialEphemerisTime ) / static_cast< double >( numberOfArcs );
+    const double earthGravitationalParameter =
+            bodyMap.at( "Earth" )->getGravityFieldModel( )->getGravitationalParameter( );
+    std::vector< double > integrationArcStartTimes;
+    Eigen::VectorXd arcWiseInitialStates = Eigen::VectorXd::Zero( 6 * numberOfArcs );
+    std::vector< std::shared_ptr< SingleArcPropagatorSettings< double > > > propagatorSettingsList;
+    for( int i = 0; i < numberOfArcs; i++ )
+    {
+        integrationArcStartTimes.push_back( initialEphemerisTime + static_cast< double >( i ) * arcDuration );
+
+        Eigen::Vector6d currentInitialStateInKeplerianElements = getNominalLeoInitialKeplerianState( );
+        currentInitialStateInKeplerianElements( trueAnomalyIndex ) += 0.5 * static_cast< double >( i );
+        arcWiseInitialStates.segment( 6 * i, 6 ) = convertKeplerianToCartesianElements(
+                    currentInitialStateInKeplerianElements, earthGravitationalParameter );
+
+        propagatorSettingsList.push_back(
+                    std::make_shared< TranslationalStatePropagatorSettings< double > >(
+                        centralBodies, accelerationModelMap, bodiesToIntegrate,
+                        arcWiseInitialStates.segment( 6 * i, 6 ), integrationArcStartTimes.at( i ) + arcDuration ) );
+    }
+    std::shared_ptr< PropagatorSettings< double > > propagatorSettings =
+            std::make_shared< MultiArcPropagatorSettings< double > >( propagatorSettingsList );
+    std::shared_ptr< IntegratorSettings< > > integratorSettings =
+            std::make_shared< IntegratorSettings< > >( rungeKutta4, initialEphemerisTime, 30.0 );
+
+    // Define estimated parameters and observation models.
+    std::vector< std::shared_ptr< EstimatableParameterSettings > > parameterNames;
+    parameterNames.push_back( std::make_shared< ArcWiseInitialTranslationalStateEstimatableParameterSettings< double > >(
+                                  "Vehicle", arcWiseInitialStates, integrationArcStartTimes, "Earth" ) );
+    std::shared_ptr< EstimatableParameterSet< double > > parametersToEstimate =
+            createParametersToEstimate< double >( parameterNames, bodyMap );
+
+    LinkEnds linkEnds;
+    linkEnds[ observed_body ] = std::make_pair( "Vehicle", "" );
+    ObservationSettingsMap observationSettingsMap;
+    observationSettingsMap.insert( std::make_pair( linkEnds, std::make_shared< ObservationSettings >(
+                                                       position_observable ) ) );
+
+    OrbitDeterminationManager< double, double > orbitDeterminationManager(
+                bodyMap, parametersToEstimate, observationSettingsMap, integratorSettings, propagatorSettings );
+
+    // Simulate observations, 100 per arc.
+    std::vector< double > observationTimes;
+    for( int i = 0; i < numberOfArcs; i++ )
+    {
+        for( int j = 0; j < 100; j++ )
+        {
+            observationTimes.push_back( integrationArcStartTimes.at( i ) + 300.0 +
+                                        static_cast< double >( j ) * ( arcDuration - 600.0 ) / 99.0 );
+        }
+    }
+    std::map< ObservableType, std::map< LinkEnds, std::pair< std::vector< double >, LinkEndType > > >
+            measurementSimulationInput;
+    measurementSimulationInput[ position_observable ][ linkEnds ] = std::make_pair( observationTimes, observed_body );
+    std::shared_ptr< PodInput< double, double > > podInput =
+            std::make_shared< PodInput< double, double > >(
+                simulateObservations< double, double >(
+                    measurementSimulationInput, orbitDeterminationManager.getObservationSimulators( ) ),
+                arcWiseInitialStates.rows( ) );
+
+    // Perturb initial states.
+    Eigen::VectorXd perturbedParameters = parametersToEstimate->getFullParameterValues< double >( );
+    for( int i = 0; i < numberOfArcs; i++ )
+    {
+        perturbedParameters.segment( 6 * i, 3 ) += Eigen::Vector3d::Constant( 1.0 );
+        perturbedParameters.segment( 6 * i + 3, 3 ) += Eigen::Vector3d::Constant( 1.0E-3 );
+    }
+
+    while( benchmarkState.keepRunning( ) )
+    {
+        benchmarkState.pauseTiming( );
+        parametersToEstimate->resetParameterValues( perturbedParameters );
+        benchmarkState.resumeTiming( );
+
+        utilities::doNotOptimize(
+                    orbitDeterminationManager.estimateParameters(
+                        podInput, std::make_shared< EstimationConvergenceChecker >( 3 ) )->
+                    parameterEstimate_ );
+    }
+}
+
+TUDAT_BENCHMARK_WITH_ITERATIONS( "LeoPropagation/OneDay", &benchmarkLeoPropagation, 3 );
+TUDAT_BENCHMARK_WITH_ITERATIONS( "MultiArcEstimation/LeoPosition", &benchmarkMultiArcEstimation, 1 );
+
+#endif
+
+} // namespace benchmarks
+
+} // namespace tudat
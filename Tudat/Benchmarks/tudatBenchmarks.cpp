@@ -0,0 +1,19 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    Notes
+ *      Main function of the Tudat benchmark suite, which runs all benchmarks registered in the files of this directory.
+ *      Run with --benchmark_out=<file> to write the results in JSON format, and --benchmark_filter=<regex> to select
+ *      benchmarks by name (see utilities::runBenchmarksFromCommandLine for all options).
+ *
+ */
+
+#include "Tudat/Basics/benchmarking.h"
+
+TUDAT_BENCHMARK_MAIN( )
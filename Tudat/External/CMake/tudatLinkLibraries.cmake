@@ -46,6 +46,9 @@ endif()
   list(APPEND TUDAT_EXTERNAL_LIBRARIES gsl)
  endif()
 
+ # Threading library, used for parallel execution of independent computations
+ list(APPEND TUDAT_EXTERNAL_LIBRARIES ${CMAKE_THREAD_LIBS_INIT})
+
  # Find PaGMO library on local system.
  if( USE_PAGMO )
    list(APPEND TUDAT_EXTERNAL_LIBRARIES pthread)
@@ -37,8 +37,12 @@
 #include "Tudat/External/SpiceInterface/spiceEphemeris.h"
 #include "Tudat/External/SpiceInterface/spiceInterface.h"
 #include "Tudat/External/SpiceInterface/spiceRotationalEphemeris.h"
+#include "Tudat/External/SpiceInterface/spiceSnapshot.h"
+#include "Tudat/Basics/parallelization.h"
 
+#include <future>
 #include <limits>
+#include <mutex>
 #include <stdexcept>
 
 namespace tudat
@@ -479,6 +483,137 @@ BOOST_AUTO_TEST_CASE( testSpiceWrappers_7 )
     BOOST_CHECK_EQUAL( spiceKernelsLoaded, 0 );
 }
 
+// Test 8: Concurrent access to Spice through wrappers and snapshot.
+BOOST_AUTO_TEST_CASE( testSpiceWrappers_8 )
+{
+    using namespace spice_interface;
+
+    // Load Spice kernels.
+    clearSpiceKernels( );
+    loadStandardSpiceKernels( );
+
+    // Create snapshot of lunar state and Earth rotation.
+    const double startTime = 1.0E7;
+    const double endTime = startTime + 10.0 * 86400.0;
+    SpiceSnapshot spiceSnapshot( startTime, endTime );
+    spiceSnapshot.addBodyState( "Moon", "Earth", "J2000", 1.0E-3, 1.0E-6 );
+    spiceSnapshot.addFrameRotation( "J2000", "IAU_Earth", 1.0E-10, 1.0E-14 );
+
+    BOOST_CHECK_EQUAL( spiceSnapshot.hasBodyState( "Moon", "Earth", "J2000" ), true );
+    BOOST_CHECK_EQUAL( spiceSnapshot.hasBodyState( "Earth", "Moon", "J2000" ), false );
+    BOOST_CHECK_EQUAL( spiceSnapshot.hasFrameRotation( "J2000", "IAU_Earth" ), true );
+    BOOST_CHECK_THROW( spiceSnapshot.getBodyCartesianStateAtEpoch( "Earth", "Moon", "J2000", startTime ),
+                       std::runtime_error );
+    BOOST_CHECK_THROW( spiceSnapshot.computeRotationQuaternionBetweenFrames( "IAU_Earth", "J2000", startTime ),
+                       std::runtime_error );
+
+    // Evaluate Spice data concurrently, directly through wrappers and from snapshot.
+    const int numberOfTestTimes = 500;
+    std::vector< Eigen::Vector6d > directStates( numberOfTestTimes ), snapshotStates( numberOfTestTimes );
+    std::vector< Eigen::Matrix3d > directRotations( numberOfTestTimes ), snapshotRotations( numberOfTestTimes );
+    std::vector< Eigen::Matrix3d > directRotationDerivatives( numberOfTestTimes ),
+            snapshotRotationDerivatives( numberOfTestTimes );
+    utilities::executeParallelLoop(
+                numberOfTestTimes, 4, [ & ]( const int i )
+    {
+        const double testTime = startTime + ( endTime - startTime ) * static_cast< double >( i ) /
+                static_cast< double >( numberOfTestTimes - 1 );
+
+        directStates[ i ] = getBodyCartesianStateAtEpoch( "Moon", "Earth", "J2000", "NONE", testTime );
+        directRotations[ i ] = computeRotationQuaternionBetweenFrames(
+                    "J2000", "IAU_Earth", testTime ).toRotationMatrix( );
+        directRotationDerivatives[ i ] = computeRotationMatrixDerivativeBetweenFrames(
+                    "J2000", "IAU_Earth", testTime );
+
+        snapshotStates[ i ] = spiceSnapshot.getBodyCartesianStateAtEpoch( "Moon", "Earth", "J2000", testTime );
+        snapshotRotations[ i ] = spiceSnapshot.computeRotationQuaternionBetweenFrames(
+                    "J2000", "IAU_Earth", testTime ).toRotationMatrix( );
+        snapshotRotationDerivatives[ i ] = spiceSnapshot.computeRotationMatrixDerivativeBetweenFrames(
+                    "J2000", "IAU_Earth", testTime );
+    } );
+
+    // Compare concurrently evaluated data with data evaluated from a single thread.
+    for( int i = 0; i < numberOfTestTimes; i++ )
+    {
+        const double testTime = startTime + ( endTime - startTime ) * static_cast< double >( i ) /
+                static_cast< double >( numberOfTestTimes - 1 );
+        const Eigen::Vector6d expectedState = getBodyCartesianStateAtEpoch(
+                    "Moon", "Earth", "J2000", "NONE", testTime );
+        const Eigen::Matrix3d expectedRotation = computeRotationQuaternionBetweenFrames(
+                    "J2000", "IAU_Earth", testTime ).toRotationMatrix( );
+        const Eigen::Matrix3d expectedRotationDerivative = computeRotationMatrixDerivativeBetweenFrames(
+                    "J2000", "IAU_Earth", testTime );
+
+        BOOST_CHECK_EQUAL( ( directStates[ i ] - expectedState ).norm( ), 0.0 );
+        BOOST_CHECK_EQUAL( ( directRotations[ i ] - expectedRotation ).norm( ), 0.0 );
+        BOOST_CHECK_EQUAL( ( directRotationDerivatives[ i ] - expectedRotationDerivative ).norm( ), 0.0 );
+
+        BOOST_CHECK_SMALL( ( snapshotStates[ i ] - expectedState ).segment( 0, 3 ).norm( ), 2.0E-3 );
+        BOOST_CHECK_SMALL( ( snapshotStates[ i ] - expectedState ).segment( 3, 3 ).norm( ), 2.0E-6 );
+        BOOST_CHECK_SMALL( ( snapshotRotations[ i ] - expectedRotation ).norm( ), 1.0E-9 );
+        BOOST_CHECK_SMALL( ( snapshotRotationDerivatives[ i ] - expectedRotationDerivative ).norm( ), 1.0E-13 );
+    }
+
+    // Check that snapshot cannot be evaluated outside of its time interval.
+    BOOST_CHECK_THROW( spiceSnapshot.getBodyCartesianStateAtEpoch( "Moon", "Earth", "J2000", endTime + 1.0 ),
+                       std::runtime_error );
+
+    // Reload the kernels concurrently with lookups of the lunar state. Each reload (clearing and loading the kernels, and
+    // retrieving the number of loaded kernels) is done while holding the Spice mutex, which is recursive so that the
+    // wrappers can be called while it is held. No lookup can then be done while the kernels are (partially) cleared.
+    const int numberOfLoadedKernels = getTotalCountOfKernelsLoaded( );
+    const int numberOfReloads = 20;
+    std::vector< int > numberOfKernelsAfterReload( numberOfReloads );
+    std::vector< int > isMutexAvailableDuringReload( numberOfReloads );
+    std::vector< Eigen::Vector6d > statesDuringReload( numberOfTestTimes );
+    utilities::executeParallelLoop(
+                numberOfTestTimes, 4, [ & ]( const int i )
+    {
+        if( i % ( numberOfTestTimes / numberOfReloads ) == 0 )
+        {
+            const int reloadIndex = i / ( numberOfTestTimes / numberOfReloads );
+            std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+            clearSpiceKernels( );
+            loadStandardSpiceKernels( );
+            numberOfKernelsAfterReload[ reloadIndex ] = getTotalCountOfKernelsLoaded( );
+
+            // Check whether the mutex can be acquired by another thread during the reload
+            isMutexAvailableDuringReload[ reloadIndex ] = std::async( std::launch::async, [ ]( )
+            {
+                bool isMutexAvailable = getSpiceMutex( ).try_lock( );
+                if( isMutexAvailable )
+                {
+                    getSpiceMutex( ).unlock( );
+                }
+                return isMutexAvailable;
+            } ).get( );
+        }
+
+        const double testTime = startTime + ( endTime - startTime ) * static_cast< double >( i ) /
+                static_cast< double >( numberOfTestTimes - 1 );
+        statesDuringReload[ i ] = getBodyCartesianStateAtEpoch( "Moon", "Earth", "J2000", "NONE", testTime );
+    } );
+
+    // Check that the mutex was held during each reload, and that lookups during the reloads are unaffected.
+    for( int i = 0; i < numberOfReloads; i++ )
+    {
+        BOOST_CHECK_EQUAL( numberOfKernelsAfterReload[ i ], numberOfLoadedKernels );
+        BOOST_CHECK_EQUAL( isMutexAvailableDuringReload[ i ], false );
+    }
+    for( int i = 0; i < numberOfTestTimes; i++ )
+    {
+        BOOST_CHECK_EQUAL( ( statesDuringReload[ i ] - directStates[ i ] ).norm( ), 0.0 );
+    }
+
+    // Check that the mutex is released after the reloads.
+    const bool isMutexAvailableAfterReloads = getSpiceMutex( ).try_lock( );
+    if( isMutexAvailableAfterReloads )
+    {
+        getSpiceMutex( ).unlock( );
+    }
+    BOOST_CHECK_EQUAL( isMutexAvailableAfterReloads, true );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
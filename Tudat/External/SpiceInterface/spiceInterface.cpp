@@ -21,6 +21,13 @@ namespace spice_interface
 
 using Eigen::Vector6d;
 
+//! Function to retrieve the mutex by which all calls to the Spice toolkit are serialized.
+std::recursive_mutex& getSpiceMutex( )
+{
+    static std::recursive_mutex spiceMutex;
+    return spiceMutex;
+}
+
 //! Convert a Julian date to ephemeris time (equivalent to TDB in Spice).
 double convertJulianDateToEphemerisTime( const double julianDate )
 {
@@ -36,6 +43,8 @@ double convertEphemerisTimeToJulianDate( const double ephemerisTime )
 //! Converts a date string to ephemeris time.
 double convertDateStringToEphemerisTime( const std::string& dateString )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     double ephemerisTime = 0.0;
     str2et_c( dateString.c_str( ), &ephemerisTime );
     return ephemerisTime;
@@ -47,6 +56,7 @@ Vector6d getBodyCartesianStateAtEpoch(
         const std::string& referenceFrameName, const std::string& aberrationCorrections,
         const double ephemerisTime )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
 
     // Declare variables for cartesian state and light-time to be determined by Spice.
     double stateAtEpoch[ 6 ];
@@ -76,6 +86,8 @@ Eigen::Vector3d getBodyCartesianPositionAtEpoch( const std::string& targetBodyNa
                                                  const std::string& aberrationCorrections,
                                                  const double ephemerisTime )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     // Declare variables for cartesian position and light-time to be determined by Spice.
     double positionAtEpoch[ 3 ];
     double lightTime;
@@ -102,6 +114,8 @@ Eigen::Quaterniond computeRotationQuaternionBetweenFrames( const std::string& or
                                                            const std::string& newFrame,
                                                            const double ephemerisTime )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     // Declare rotation matrix.
     double rotationArray[ 3 ][ 3 ];
 
@@ -127,6 +141,8 @@ Eigen::Matrix3d computeRotationMatrixDerivativeBetweenFrames( const std::string&
                                                               const std::string& newFrame,
                                                               const double ephemerisTime )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     double stateTransition[ 6 ][ 6 ];
 
     // Calculate state transition matrix.
@@ -150,6 +166,8 @@ Eigen::Vector3d getAngularVelocityVectorOfFrameInOriginalFrame( const std::strin
                                                                 const std::string& newFrame,
                                                                 const double ephemerisTime )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     double stateTransition[ 6 ][ 6 ];
 
     // Calculate state transition matrix.
@@ -168,6 +186,8 @@ Eigen::Vector3d getAngularVelocityVectorOfFrameInOriginalFrame( const std::strin
 std::pair< Eigen::Quaterniond, Eigen::Matrix3d > computeRotationQuaternionAndRotationMatrixDerivativeBetweenFrames(
         const std::string& originalFrame, const std::string& newFrame, const double ephemerisTime )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     double stateTransition[ 6 ][ 6 ];
 
     sxform_c( originalFrame.c_str( ), newFrame.c_str( ), ephemerisTime, stateTransition );
@@ -190,6 +210,8 @@ std::pair< Eigen::Quaterniond, Eigen::Matrix3d > computeRotationQuaternionAndRot
 std::vector< double > getBodyProperties( const std::string& body, const std::string& property,
                                          const int maximumNumberOfValues )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     // Delcare variable in which raw result is to be put by Spice function.
     double propertyArray[ maximumNumberOfValues ];
 
@@ -211,6 +233,8 @@ std::vector< double > getBodyProperties( const std::string& body, const std::str
 //! Get gravitational parameter of a body.
 double getBodyGravitationalParameter( const std::string& body )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     // Delcare variable in which raw result is to be put by Spice function.
     double gravitationalParameter[ 1 ];
 
@@ -228,6 +252,8 @@ double getBodyGravitationalParameter( const std::string& body )
 //! Get the (arithmetic) mean of the three principal axes of the tri-axial ellipsoid shape.
 double getAverageRadius( const std::string& body )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     // Delcare variable in which raw result is to be put by Spice function.
     double radii[ 3 ];
 
@@ -243,6 +269,8 @@ double getAverageRadius( const std::string& body )
 //! Convert a body name to its NAIF identification number.
 int convertBodyNameToNaifId( const std::string& bodyName )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     // Convert body name to NAIF ID number.
     SpiceInt bodyNaifId;
     SpiceBoolean isIdFound;
@@ -255,6 +283,8 @@ int convertBodyNameToNaifId( const std::string& bodyName )
 //! Check if a certain property of a body is in the kernel pool.
 bool checkBodyPropertyInKernelPool( const std::string& bodyName, const std::string& bodyProperty )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     // Convert body name to NAIF ID.
     const int naifId = convertBodyNameToNaifId( bodyName );
 
@@ -266,22 +296,33 @@ bool checkBodyPropertyInKernelPool( const std::string& bodyName, const std::stri
 //! Load a Spice kernel.
 void loadSpiceKernelInTudat( const std::string& fileName )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     furnsh_c(  fileName.c_str( ) );
 }
 
 //! Get the amount of loaded Spice kernels.
 int getTotalCountOfKernelsLoaded( )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     SpiceInt count;
     ktotal_c( "ALL", &count );
     return count;
 }
 
 //! Clear all Spice kernels.
-void clearSpiceKernels( ) { kclear_c( ); }
+void clearSpiceKernels( )
+{
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
+    kclear_c( );
+}
 
 void loadStandardSpiceKernels( const std::vector< std::string > alternativeEphemerisKernels  )
 {
+    std::lock_guard< std::recursive_mutex > spiceLock( getSpiceMutex( ) );
+
     std::string kernelPath = input_output::getSpiceKernelPath( );
 
     loadSpiceKernelInTudat( kernelPath + "pck00010.tpc" );
@@ -24,6 +24,7 @@
 #ifndef TUDAT_SPICE_INTERFACE_H
 #define TUDAT_SPICE_INTERFACE_H
 
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -43,6 +44,18 @@ namespace tudat
 namespace spice_interface
 {
 
+//! Function to retrieve the mutex by which all calls to the Spice toolkit are serialized.
+/*!
+ * Function to retrieve the (process-wide) mutex by which all calls to the Spice toolkit are serialized. The Spice toolkit
+ * stores its kernel pool and internal buffers in global variables, so that it may not be called from multiple threads
+ * simultaneously. All wrapper functions in this file lock this mutex for the duration of their Spice calls, so that they
+ * may safely be called concurrently (although calls are then not executed in parallel). Any code calling the Spice
+ * toolkit directly should also lock this mutex. For parallel evaluation of Spice data without locking, see
+ * SpiceSnapshot.
+ * \return Mutex by which all calls to the Spice toolkit are serialized.
+ */
+std::recursive_mutex& getSpiceMutex( );
+
 //! Convert a Julian date to ephemeris time (equivalent to TDB in Spice).
 /*!
  * Function to convert a Julian date to ephemeris time, which is equivalent to barycentric
@@ -0,0 +1,118 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <stdexcept>
+
+#include "Tudat/Astrodynamics/Ephemerides/customEphemeris.h"
+#include "Tudat/External/SpiceInterface/spiceInterface.h"
+#include "Tudat/External/SpiceInterface/spiceSnapshot.h"
+
+namespace tudat
+{
+
+namespace spice_interface
+{
+
+//! Function to add the state of a body to the snapshot.
+void SpiceSnapshot::addBodyState( const std::string& targetBodyName,
+                                  const std::string& observerBodyName,
+                                  const std::string& referenceFrameName,
+                                  const double positionTolerance,
+                                  const double velocityTolerance )
+{
+    std::shared_ptr< ephemerides::Ephemeris > spiceStateEphemeris = std::make_shared< ephemerides::CustomEphemeris >(
+                [ = ]( const double ephemerisTime )
+    {
+        return spice_interface::getBodyCartesianStateAtEpoch(
+                    targetBodyName, observerBodyName, referenceFrameName, "NONE", ephemerisTime );
+    }, observerBodyName, referenceFrameName );
+
+    bodyStates_[ std::make_tuple( targetBodyName, observerBodyName, referenceFrameName ) ] =
+            ephemerides::fitChebyshevEphemeris(
+                spiceStateEphemeris, startTime_, endTime_, positionTolerance, velocityTolerance, polynomialDegree_ );
+}
+
+//! Function to add the rotation between two frames to the snapshot.
+void SpiceSnapshot::addFrameRotation( const std::string& originalFrame,
+                                      const std::string& newFrame,
+                                      const double rotationTolerance,
+                                      const double rotationRateTolerance )
+{
+    std::array< std::shared_ptr< ephemerides::ChebyshevEphemeris >, 3 > rotationRowEphemerides;
+    for( int i = 0; i < 3; i++ )
+    {
+        // Represent row i of rotation matrix and its derivative as 'position' and 'velocity', respectively.
+        std::shared_ptr< ephemerides::Ephemeris > spiceRotationRowEphemeris =
+                std::make_shared< ephemerides::CustomEphemeris >( [ = ]( const double ephemerisTime )
+        {
+            const std::pair< Eigen::Quaterniond, Eigen::Matrix3d > rotationAndDerivative =
+                    spice_interface::computeRotationQuaternionAndRotationMatrixDerivativeBetweenFrames(
+                        originalFrame, newFrame, ephemerisTime );
+
+            Eigen::Vector6d rotationRow;
+            rotationRow.segment( 0, 3 ) = rotationAndDerivative.first.toRotationMatrix( ).row( i ).transpose( );
+            rotationRow.segment( 3, 3 ) = rotationAndDerivative.second.row( i ).transpose( );
+            return rotationRow;
+        }, originalFrame, newFrame );
+
+        rotationRowEphemerides[ i ] = ephemerides::fitChebyshevEphemeris(
+                    spiceRotationRowEphemeris, startTime_, endTime_, rotationTolerance, rotationRateTolerance,
+                    polynomialDegree_ );
+    }
+
+    frameRotations_[ std::make_pair( originalFrame, newFrame ) ] = rotationRowEphemerides;
+}
+
+//! Function to retrieve the Chebyshev ephemeris representing the state of a body.
+std::shared_ptr< ephemerides::ChebyshevEphemeris > SpiceSnapshot::getBodyStateEphemeris(
+        const std::string& targetBodyName,
+        const std::string& observerBodyName,
+        const std::string& referenceFrameName ) const
+{
+    auto bodyStateIterator = bodyStates_.find( std::make_tuple( targetBodyName, observerBodyName, referenceFrameName ) );
+    if( bodyStateIterator == bodyStates_.end( ) )
+    {
+        throw std::runtime_error( "Error, state of " + targetBodyName + " w.r.t. " + observerBodyName + " in frame " +
+                                  referenceFrameName + " not found in Spice snapshot." );
+    }
+    return bodyStateIterator->second;
+}
+
+//! Function to retrieve the rotation quaternion, and rotation matrix derivative, between two frames.
+std::pair< Eigen::Quaterniond, Eigen::Matrix3d >
+SpiceSnapshot::computeRotationQuaternionAndRotationMatrixDerivativeBetweenFrames(
+        const std::string& originalFrame,
+        const std::string& newFrame,
+        const double ephemerisTime ) const
+{
+    auto frameRotationIterator = frameRotations_.find( std::make_pair( originalFrame, newFrame ) );
+    if( frameRotationIterator == frameRotations_.end( ) )
+    {
+        throw std::runtime_error( "Error, rotation from " + originalFrame + " to " + newFrame +
+                                  " not found in Spice snapshot." );
+    }
+
+    // Evaluate rows of rotation matrix and its derivative.
+    Eigen::Matrix3d rotationMatrix;
+    Eigen::Matrix3d rotationMatrixDerivative;
+    for( int i = 0; i < 3; i++ )
+    {
+        const Eigen::Vector6d rotationRow = frameRotationIterator->second[ i ]->getCartesianState( ephemerisTime );
+        rotationMatrix.row( i ) = rotationRow.segment( 0, 3 ).transpose( );
+        rotationMatrixDerivative.row( i ) = rotationRow.segment( 3, 3 ).transpose( );
+    }
+
+    return std::make_pair( Eigen::Quaterniond( rotationMatrix ).normalized( ), rotationMatrixDerivative );
+}
+
+} // namespace spice_interface
+
+} // namespace tudat
@@ -0,0 +1,250 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_SPICE_SNAPSHOT_H
+#define TUDAT_SPICE_SNAPSHOT_H
+
+#include <array>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include "Tudat/Astrodynamics/Ephemerides/chebyshevEphemeris.h"
+#include "Tudat/Basics/basicTypedefs.h"
+
+namespace tudat
+{
+
+namespace spice_interface
+{
+
+//! Class storing a snapshot of Spice data, which can be evaluated concurrently without accessing the Spice toolkit.
+/*!
+ *  Class storing a snapshot of Spice data, which can be evaluated concurrently without accessing the Spice toolkit.
+ *  The Spice toolkit may not be called from multiple threads simultaneously, so that the wrapper functions in
+ *  spiceInterface.h serialize all calls by a single mutex. For parallel propagations (e.g. Monte Carlo analyses or
+ *  multi-arc propagations), this snapshot is created once (after loading the kernels), by fitting Chebyshev
+ *  polynomials to the body states and frame rotations that are required, in a given time interval. Afterwards, the
+ *  snapshot is not modified, and may be interrogated from any number of threads simultaneously without locking.
+ *  Body states are stored as ChebyshevEphemeris objects, which may also be retrieved and used directly as the ephemeris of
+ *  a body. Frame rotations are stored as three ChebyshevEphemeris objects, each of which represents one row of the
+ *  rotation matrix (as 'position') and its time derivative (as 'velocity').
+ *  Aberration corrections are not supported, states are geometric.
+ */
+class SpiceSnapshot
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor, sets the time interval and polynomial degree for all data subsequently added to the snapshot.
+     * \param startTime Start of time interval for which data is stored (ephemeris time).
+     * \param endTime End of time interval for which data is stored (ephemeris time).
+     * \param polynomialDegree Degree of the Chebyshev series used to represent the data.
+     */
+    SpiceSnapshot( const double startTime,
+                   const double endTime,
+                   const int polynomialDegree = 12 ):
+        startTime_( startTime ), endTime_( endTime ), polynomialDegree_( polynomialDegree ){ }
+
+    //! Function to add the state of a body to the snapshot.
+    /*!
+     * Function to add the state of a body to the snapshot, by fitting a Chebyshev ephemeris to the state retrieved from
+     * Spice. This function calls the Spice toolkit, and may not be called while the snapshot is in concurrent use.
+     * \param targetBodyName Name of the body of which the state is to be stored.
+     * \param observerBodyName Name of the body relative to which the state is to be stored.
+     * \param referenceFrameName Name of the reference frame in which the state is to be stored.
+     * \param positionTolerance Maximum allowed position error w.r.t. Spice.
+     * \param velocityTolerance Maximum allowed velocity error w.r.t. Spice.
+     */
+    void addBodyState( const std::string& targetBodyName,
+                       const std::string& observerBodyName,
+                       const std::string& referenceFrameName,
+                       const double positionTolerance = 1.0E-3,
+                       const double velocityTolerance = 1.0E-6 );
+
+    //! Function to add the rotation between two frames to the snapshot.
+    /*!
+     * Function to add the rotation between two frames to the snapshot, by fitting Chebyshev series to the rotation
+     * matrix and its time derivative retrieved from Spice. This function calls the Spice toolkit, and may not be called
+     * while the snapshot is in concurrent use.
+     * \param originalFrame Reference frame from which the rotation is to be stored.
+     * \param newFrame Reference frame to which the rotation is to be stored.
+     * \param rotationTolerance Maximum allowed error of each row of the rotation matrix w.r.t. Spice (norm).
+     * \param rotationRateTolerance Maximum allowed error of each row of the rotation matrix derivative w.r.t. Spice
+     * (norm).
+     */
+    void addFrameRotation( const std::string& originalFrame,
+                           const std::string& newFrame,
+                           const double rotationTolerance = 1.0E-10,
+                           const double rotationRateTolerance = 1.0E-14 );
+
+    //! Function to check whether the state of a body is stored in the snapshot.
+    /*!
+     * Function to check whether the state of a body is stored in the snapshot.
+     * \param targetBodyName Name of the body of which the state is requested.
+     * \param observerBodyName Name of the body relative to which the state is requested.
+     * \param referenceFrameName Name of the reference frame in which the state is requested.
+     * \return True if the state is stored in the snapshot.
+     */
+    bool hasBodyState( const std::string& targetBodyName,
+                       const std::string& observerBodyName,
+                       const std::string& referenceFrameName ) const
+    {
+        return ( bodyStates_.count( std::make_tuple( targetBodyName, observerBodyName, referenceFrameName ) ) > 0 );
+    }
+
+    //! Function to check whether the rotation between two frames is stored in the snapshot.
+    /*!
+     * Function to check whether the rotation between two frames is stored in the snapshot.
+     * \param originalFrame Reference frame from which the rotation is requested.
+     * \param newFrame Reference frame to which the rotation is requested.
+     * \return True if the rotation is stored in the snapshot.
+     */
+    bool hasFrameRotation( const std::string& originalFrame,
+                           const std::string& newFrame ) const
+    {
+        return ( frameRotations_.count( std::make_pair( originalFrame, newFrame ) ) > 0 );
+    }
+
+    //! Function to retrieve the Chebyshev ephemeris representing the state of a body.
+    /*!
+     * Function to retrieve the Chebyshev ephemeris representing the state of a body, which may be used as the
+     * ephemeris of the body in a propagation. An exception is thrown if the state is not stored in the snapshot.
+     * \param targetBodyName Name of the body of which the state is requested.
+     * \param observerBodyName Name of the body relative to which the state is requested.
+     * \param referenceFrameName Name of the reference frame in which the state is requested.
+     * \return Chebyshev ephemeris representing the state of the body.
+     */
+    std::shared_ptr< ephemerides::ChebyshevEphemeris > getBodyStateEphemeris(
+            const std::string& targetBodyName,
+            const std::string& observerBodyName,
+            const std::string& referenceFrameName ) const;
+
+    //! Function to retrieve the Cartesian state of a body from the snapshot.
+    /*!
+     * Function to retrieve the Cartesian state of a body from the snapshot. This function does not call the Spice toolkit
+     * and may be called concurrently. An exception is thrown if the state is not stored in the snapshot.
+     * \param targetBodyName Name of the body of which the state is requested.
+     * \param observerBodyName Name of the body relative to which the state is requested.
+     * \param referenceFrameName Name of the reference frame in which the state is requested.
+     * \param ephemerisTime Ephemeris time at which the state is requested.
+     * \return Cartesian state of the body (in m and m/s).
+     */
+    Eigen::Vector6d getBodyCartesianStateAtEpoch( const std::string& targetBodyName,
+                                                  const std::string& observerBodyName,
+                                                  const std::string& referenceFrameName,
+                                                  const double ephemerisTime ) const
+    {
+        return getBodyStateEphemeris( targetBodyName, observerBodyName, referenceFrameName )->getCartesianState(
+                    ephemerisTime );
+    }
+
+    //! Function to retrieve the rotation quaternion between two frames from the snapshot.
+    /*!
+     * Function to retrieve the rotation quaternion between two frames from the snapshot. This function does not call the
+     * Spice toolkit and may be called concurrently. An exception is thrown if the rotation is not stored in the snapshot.
+     * \param originalFrame Reference frame from which the rotation is requested.
+     * \param newFrame Reference frame to which the rotation is requested.
+     * \param ephemerisTime Ephemeris time at which the rotation is requested.
+     * \return Rotation quaternion from originalFrame to newFrame.
+     */
+    Eigen::Quaterniond computeRotationQuaternionBetweenFrames( const std::string& originalFrame,
+                                                               const std::string& newFrame,
+                                                               const double ephemerisTime ) const
+    {
+        return computeRotationQuaternionAndRotationMatrixDerivativeBetweenFrames(
+                    originalFrame, newFrame, ephemerisTime ).first;
+    }
+
+    //! Function to retrieve the time derivative of the rotation matrix between two frames from the snapshot.
+    /*!
+     * Function to retrieve the time derivative of the rotation matrix between two frames from the snapshot. This
+     * function does not call the Spice toolkit and may be called concurrently. An exception is thrown if the rotation is
+     * not stored in the snapshot.
+     * \param originalFrame Reference frame from which the rotation is requested.
+     * \param newFrame Reference frame to which the rotation is requested.
+     * \param ephemerisTime Ephemeris time at which the rotation is requested.
+     * \return Time derivative of rotation matrix from originalFrame to newFrame.
+     */
+    Eigen::Matrix3d computeRotationMatrixDerivativeBetweenFrames( const std::string& originalFrame,
+                                                                  const std::string& newFrame,
+                                                                  const double ephemerisTime ) const
+    {
+        return computeRotationQuaternionAndRotationMatrixDerivativeBetweenFrames(
+                    originalFrame, newFrame, ephemerisTime ).second;
+    }
+
+    //! Function to retrieve the rotation quaternion, and rotation matrix derivative, between two frames.
+    /*!
+     * Function to retrieve the rotation quaternion, and time derivative of the rotation matrix, between two frames from
+     * the snapshot. This function does not call the Spice toolkit and may be called concurrently. An exception is thrown
+     * if the rotation is not stored in the snapshot.
+     * \param originalFrame Reference frame from which the rotation is requested.
+     * \param newFrame Reference frame to which the rotation is requested.
+     * \param ephemerisTime Ephemeris time at which the rotation is requested.
+     * \return Pair of rotation quaternion and time derivative of rotation matrix from originalFrame to newFrame.
+     */
+    std::pair< Eigen::Quaterniond, Eigen::Matrix3d > computeRotationQuaternionAndRotationMatrixDerivativeBetweenFrames(
+            const std::string& originalFrame,
+            const std::string& newFrame,
+            const double ephemerisTime ) const;
+
+    //! Function to retrieve the start of the time interval for which data is stored.
+    /*!
+     * Function to retrieve the start of the time interval for which data is stored.
+     * \return Start of the time interval for which data is stored.
+     */
+    double getStartTime( ) const
+    {
+        return startTime_;
+    }
+
+    //! Function to retrieve the end of the time interval for which data is stored.
+    /*!
+     * Function to retrieve the end of the time interval for which data is stored.
+     * \return End of the time interval for which data is stored.
+     */
+    double getEndTime( ) const
+    {
+        return endTime_;
+    }
+
+private:
+
+    //! Start of time interval for which data is stored.
+    double startTime_;
+
+    //! End of time interval for which data is stored.
+    double endTime_;
+
+    //! Degree of the Chebyshev series used to represent the data.
+    int polynomialDegree_;
+
+    //! Body states, with key (target, observer, reference frame).
+    std::map< std::tuple< std::string, std::string, std::string >,
+    std::shared_ptr< ephemerides::ChebyshevEphemeris > > bodyStates_;
+
+    //! Frame rotations (one Chebyshev ephemeris per row of rotation matrix), with key (original frame, new frame).
+    std::map< std::pair< std::string, std::string >,
+    std::array< std::shared_ptr< ephemerides::ChebyshevEphemeris >, 3 > > frameRotations_;
+};
+
+} // namespace spice_interface
+
+} // namespace tudat
+
+#endif // TUDAT_SPICE_SNAPSHOT_H
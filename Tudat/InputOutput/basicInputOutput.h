@@ -29,6 +29,7 @@
 
 #include <boost/filesystem.hpp>
 
+#include "Tudat/Basics/stateHistory.h"
 #include "Tudat/InputOutput/streamFilters.h"
 
 namespace tudat
@@ -302,6 +303,70 @@ void writeDataMapToTextFile(
                             precisionOfKeyType, precisionOfValueType, delimiter );
 }
 
+//! Write state history to text file.
+/*!
+ * Writes data stored in a (contiguous) state history to text file, in the same format as the
+ * writeDataMapToTextFile function for a map, with the entries written with increasing key. The
+ * states are written directly from the contiguous memory, without creating an intermediate map.
+ * \tparam KeyType Data type for epochs in state history.
+ * \tparam ScalarType Scalar type of states in state history.
+ * \param stateHistory State history with data.
+ * \param outputFilename Output filename.
+ * \param outputDirectory Output directory. This can be passed as a string as well. It will be
+ *          created if it does not exist.
+ * \param fileHeader Text to be placed at the head of the output file. N.B: This string MUST end in
+ *          a newline/return character, or the first line of data will not be printed on a new
+ *          line.
+ * \param precisionOfKeyType Number of significant digits of KeyType-data to output.
+ * \param precisionOfValueType Number of significant digits of ValueType-data to output.
+ * \param delimiter Delimiter character, to delimit data entries in file.
+ */
+template< typename KeyType, typename ScalarType >
+void writeDataMapToTextFile(
+        const utilities::StateHistory< KeyType, ScalarType >& stateHistory, const std::string& outputFilename,
+        const boost::filesystem::path& outputDirectory, const std::string& fileHeader = "",
+        const int precisionOfKeyType = 16, const int precisionOfValueType = 16,
+        const std::string& delimiter = "\t" )
+{
+    // Check if output directory exists; create it if it doesn't.
+    if ( !boost::filesystem::exists( outputDirectory ) )
+    {
+        boost::filesystem::create_directories( outputDirectory );
+    }
+
+    // Open output file.
+    std::string outputDirectoryAndFilename = outputDirectory.string( ) + "/" + outputFilename;
+    std::ofstream outputFile_( outputDirectoryAndFilename.c_str( ) );
+
+    // Write file header to file.
+    outputFile_ << fileHeader;
+
+    // Loop over state history, in order of increasing key.
+    int numberOfEntries = stateHistory.size( );
+    bool isAscending = stateHistory.isInAscendingOrder( );
+    for( int i = 0; i < numberOfEntries; i++ )
+    {
+        int entryIndex = isAscending ? i : ( numberOfEntries - 1 - i );
+        outputFile_ << std::setprecision( precisionOfKeyType )
+                    << std::left << std::setw( precisionOfKeyType + 1 )
+                    << stateHistory.getTime( entryIndex );
+
+        Eigen::Map< const Eigen::Matrix< ScalarType, Eigen::Dynamic, 1 > > currentState =
+                stateHistory.getState( entryIndex );
+        for( int j = 0; j < currentState.rows( ); j++ )
+        {
+            outputFile_ << delimiter << " "
+                        << std::setprecision( precisionOfValueType ) << std::left
+                        << std::setw( precisionOfValueType + 1 )
+                        << currentState( j );
+        }
+        outputFile_ << std::endl;
+    }
+
+    // Close output file.
+    outputFile_.close( );
+}
+
 //! Write data map to text file.
 /*!
  * Writes data stored in a map to text file, using default KeyType-precision and
@@ -68,13 +68,16 @@ static std::map< EphemerisType, std::string > ephemerisTypes =
     { interpolated_spice, "interpolatedSpice" },
     { constant_ephemeris, "constant" },
     { kepler_ephemeris, "kepler" },
-    { custom_ephemeris, "custom" }
+    { custom_ephemeris, "custom" },
+    { chebyshev_ephemeris, "chebyshev" },
+    { spice_snapshot_ephemeris, "spiceSnapshot" }
 };
 
 //! `EphemerisType` not supported by `json_interface`.
 static std::vector< EphemerisType > unsupportedEphemerisTypes =
 {
-    custom_ephemeris
+    custom_ephemeris,
+    spice_snapshot_ephemeris
 };
 
 //! Convert `EphemerisType` to `json`.
@@ -485,10 +485,25 @@ void to_json( nlohmann::json& jsonObject, const std::shared_ptr< ObservationSimu
 
         return;
     }
-    else
+    else if( std::dynamic_pointer_cast< VisibilityWindowObservationSimulationTimeSettings< double > >(
+                 observationSimulationTimeSettings ) != nullptr )
     {
+        std::shared_ptr< VisibilityWindowObservationSimulationTimeSettings< double > > windowSimulationTimeSettings =
+                std::dynamic_pointer_cast< VisibilityWindowObservationSimulationTimeSettings< double > >(
+                    observationSimulationTimeSettings );
+        jsonObject[ K::observationSimulationTimesType ] = visibility_window_observation_simulation_times;
+        jsonObject[ K::observationSimulationStartTime ] = windowSimulationTimeSettings->startTime_;
+        jsonObject[ K::observationSimulationEndTime ] = windowSimulationTimeSettings->endTime_;
+        jsonObject[ K::observationInterval ] = windowSimulationTimeSettings->observationInterval_;
+        jsonObject[ K::visibilityWindowSamplingStep ] = windowSimulationTimeSettings->windowSamplingStep_;
+        jsonObject[ K::visibilityWindowRootFinderTolerance ] = windowSimulationTimeSettings->windowRootFinderTolerance_;
+
         return;
     }
+    else
+    {
+        throw std::runtime_error( "Error when creating JSON object of observation simulation times, type not recognized." );
+    }
 
 }
 
@@ -29,6 +29,9 @@ static std::map< AvailableIntegrators, std::string > integratorTypes =
     { rungeKuttaVariableStepSize, "rungeKuttaVariableStepSize" },
     { adamsBashforthMoulton, "adamsBashforthMoulton" },
     { bulirschStoer, "bulirschStoer" },
+    { gaussJackson, "gaussJackson" },
+    { yoshidaSymplectic, "yoshidaSymplectic" },
+    { gaussLegendre, "gaussLegendre" }
 };
 
 //! `AvailableIntegrators` not supported by `json_interface`.
@@ -125,6 +128,10 @@ void to_json( nlohmann::json& jsonObject, const std::shared_ptr< IntegratorSetti
                     scalarTolerancesIntegratorSettings->maximumFactorIncreaseForNextStepSize_;
             jsonObject[ K::minimumFactorDecreaseForNextStepSize ] =
                     scalarTolerancesIntegratorSettings->minimumFactorDecreaseForNextStepSize_;
+            if( scalarTolerancesIntegratorSettings->requestedOutputTimes_.size( ) > 0 )
+            {
+                jsonObject[ K::requestedOutputTimes ] = scalarTolerancesIntegratorSettings->requestedOutputTimes_;
+            }
         }
         else
         {
@@ -169,6 +176,36 @@ void to_json( nlohmann::json& jsonObject, const std::shared_ptr< IntegratorSetti
 
         return;
     }
+    case gaussJackson:
+    {
+        std::shared_ptr< GaussJacksonIntegratorSettings< TimeType > > gaussJacksonSettings =
+                std::dynamic_pointer_cast< GaussJacksonIntegratorSettings< TimeType > >( integratorSettings );
+        assertNonnullptrPointer( gaussJacksonSettings );
+        jsonObject[ K::stepSize ] = gaussJacksonSettings->initialTimeStep_;
+        jsonObject[ K::order ] = gaussJacksonSettings->order_;
+        jsonObject[ K::numberOfCorrectorIterations ] = gaussJacksonSettings->numberOfCorrectorIterations_;
+        return;
+    }
+    case yoshidaSymplectic:
+    {
+        std::shared_ptr< YoshidaSymplecticIntegratorSettings< TimeType > > yoshidaSettings =
+                std::dynamic_pointer_cast< YoshidaSymplecticIntegratorSettings< TimeType > >( integratorSettings );
+        assertNonnullptrPointer( yoshidaSettings );
+        jsonObject[ K::stepSize ] = yoshidaSettings->initialTimeStep_;
+        jsonObject[ K::order ] = yoshidaSettings->order_;
+        return;
+    }
+    case gaussLegendre:
+    {
+        std::shared_ptr< GaussLegendreIntegratorSettings< TimeType > > gaussLegendreSettings =
+                std::dynamic_pointer_cast< GaussLegendreIntegratorSettings< TimeType > >( integratorSettings );
+        assertNonnullptrPointer( gaussLegendreSettings );
+        jsonObject[ K::stepSize ] = gaussLegendreSettings->initialTimeStep_;
+        jsonObject[ K::numberOfStages ] = gaussLegendreSettings->numberOfStages_;
+        jsonObject[ K::maximumNumberOfIterations ] = gaussLegendreSettings->maximumNumberOfIterations_;
+        jsonObject[ K::iterationTolerance ] = gaussLegendreSettings->iterationTolerance_;
+        return;
+    }
     default:
         handleUnimplementedEnumValue( integratorType, integratorTypes, unsupportedIntegratorTypes );
     }
@@ -229,6 +266,8 @@ void from_json( const nlohmann::json& jsonObject, std::shared_ptr< IntegratorSet
                                   defaults.maximumFactorIncreaseForNextStepSize_ ),
                         getValue( jsonObject, K::minimumFactorDecreaseForNextStepSize,
                                   defaults.minimumFactorDecreaseForNextStepSize_ ) );
+            integratorSettings->requestedOutputTimes_ =
+                    getValue( jsonObject, K::requestedOutputTimes, defaults.requestedOutputTimes_ );
         }
         else
         {
@@ -284,6 +323,48 @@ void from_json( const nlohmann::json& jsonObject, std::shared_ptr< IntegratorSet
                               defaults.minimumFactorDecreaseForNextStepSize_ ) );
         return;
     }
+    case gaussJackson:
+    {
+        GaussJacksonIntegratorSettings< TimeType > defaults( 0.0, 0.0 );
+
+        integratorSettings = std::make_shared< GaussJacksonIntegratorSettings< TimeType > >(
+                    initialTime,
+                    getValue< TimeType >( jsonObject, K::stepSize ),
+                    getValue( jsonObject, K::order, defaults.order_ ),
+                    getValue( jsonObject, K::numberOfCorrectorIterations, defaults.numberOfCorrectorIterations_ ),
+                    getValue( jsonObject, K::saveFrequency, defaults.saveFrequency_ ),
+                    getValue( jsonObject, K::assessPropagationTerminationConditionDuringIntegrationSubsteps,
+                              defaults.assessPropagationTerminationConditionDuringIntegrationSubsteps_ ) );
+        return;
+    }
+    case yoshidaSymplectic:
+    {
+        YoshidaSymplecticIntegratorSettings< TimeType > defaults( 0.0, 0.0 );
+
+        integratorSettings = std::make_shared< YoshidaSymplecticIntegratorSettings< TimeType > >(
+                    initialTime,
+                    getValue< TimeType >( jsonObject, K::stepSize ),
+                    getValue( jsonObject, K::order, defaults.order_ ),
+                    getValue( jsonObject, K::saveFrequency, defaults.saveFrequency_ ),
+                    getValue( jsonObject, K::assessPropagationTerminationConditionDuringIntegrationSubsteps,
+                              defaults.assessPropagationTerminationConditionDuringIntegrationSubsteps_ ) );
+        return;
+    }
+    case gaussLegendre:
+    {
+        GaussLegendreIntegratorSettings< TimeType > defaults( 0.0, 0.0 );
+
+        integratorSettings = std::make_shared< GaussLegendreIntegratorSettings< TimeType > >(
+                    initialTime,
+                    getValue< TimeType >( jsonObject, K::stepSize ),
+                    getValue( jsonObject, K::numberOfStages, defaults.numberOfStages_ ),
+                    getValue( jsonObject, K::maximumNumberOfIterations, defaults.maximumNumberOfIterations_ ),
+                    getValue( jsonObject, K::iterationTolerance, defaults.iterationTolerance_ ),
+                    getValue( jsonObject, K::saveFrequency, defaults.saveFrequency_ ),
+                    getValue( jsonObject, K::assessPropagationTerminationConditionDuringIntegrationSubsteps,
+                              defaults.assessPropagationTerminationConditionDuringIntegrationSubsteps_ ) );
+        return;
+    }
     default:
         handleUnimplementedEnumValue( integratorType, integratorTypes, unsupportedIntegratorTypes );
     }
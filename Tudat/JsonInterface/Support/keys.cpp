@@ -324,6 +324,11 @@ const std::string Keys::Observation::perturbingBodies = "perturbingBodies";
 
 const std::string Keys::Observation::observationSimulationTimesType = "observationSimulationTimesType";
 const std::string Keys::Observation::observationSimulationTimesList = "observationSimulationTimesList";
+const std::string Keys::Observation::observationSimulationStartTime = "observationSimulationStartTime";
+const std::string Keys::Observation::observationSimulationEndTime = "observationSimulationEndTime";
+const std::string Keys::Observation::observationInterval = "observationInterval";
+const std::string Keys::Observation::visibilityWindowSamplingStep = "visibilityWindowSamplingStep";
+const std::string Keys::Observation::visibilityWindowRootFinderTolerance = "visibilityWindowRootFinderTolerance";
 
 const std::string Keys::Observation::observableViabilityType = "viabilityType";
 const std::string Keys::Observation::associatedLinkEnd = "associatedLinkEnd";
@@ -435,11 +440,17 @@ const std::string Keys::Integrator::areTolerancesDefinedAsScalar = "areTolerance
 const std::string Keys::Integrator::safetyFactorForNextStepSize = "safetyFactorForNextStepSize";
 const std::string Keys::Integrator::maximumFactorIncreaseForNextStepSize = "maximumFactorIncreaseForNextStepSize";
 const std::string Keys::Integrator::minimumFactorDecreaseForNextStepSize = "minimumFactorDecreaseForNextStepSize";
+const std::string Keys::Integrator::requestedOutputTimes = "requestedOutputTimes";
 const std::string Keys::Integrator::bandwidth = "bandwidth";
 const std::string Keys::Integrator::extrapolationSequence = "extrapolationSequence";
 const std::string Keys::Integrator::maximumNumberOfSteps = "maximumNumberOfSteps";
 const std::string Keys::Integrator::maximumOrder = "maximumOrder";
 const std::string Keys::Integrator::minimumOrder = "minimumOrder";
+const std::string Keys::Integrator::order = "order";
+const std::string Keys::Integrator::numberOfCorrectorIterations = "numberOfCorrectorIterations";
+const std::string Keys::Integrator::numberOfStages = "numberOfStages";
+const std::string Keys::Integrator::maximumNumberOfIterations = "maximumNumberOfIterations";
+const std::string Keys::Integrator::iterationTolerance = "iterationTolerance";
 
 //  Interpolation
 
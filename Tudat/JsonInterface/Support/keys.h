@@ -322,6 +322,11 @@ struct Keys
 
         static const std::string observationSimulationTimesType;
         static const std::string observationSimulationTimesList;
+        static const std::string observationSimulationStartTime;
+        static const std::string observationSimulationEndTime;
+        static const std::string observationInterval;
+        static const std::string visibilityWindowSamplingStep;
+        static const std::string visibilityWindowRootFinderTolerance;
 
         static const std::string observableViabilityType;
         static const std::string associatedLinkEnd;
@@ -464,11 +469,17 @@ struct Keys
         static const std::string safetyFactorForNextStepSize;
         static const std::string maximumFactorIncreaseForNextStepSize;
         static const std::string minimumFactorDecreaseForNextStepSize;
+        static const std::string requestedOutputTimes;
         static const std::string bandwidth;
         static const std::string extrapolationSequence;
         static const std::string maximumNumberOfSteps;
         static const std::string minimumOrder;
         static const std::string maximumOrder;
+        static const std::string order;
+        static const std::string numberOfCorrectorIterations;
+        static const std::string numberOfStages;
+        static const std::string maximumNumberOfIterations;
+        static const std::string iterationTolerance;
     };
 
     struct Interpolation
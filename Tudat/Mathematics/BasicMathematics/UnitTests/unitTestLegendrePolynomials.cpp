@@ -21,6 +21,8 @@
 
 #define BOOST_TEST_MAIN
 
+#include <stdexcept>
+
 #include <boost/test/floating_point_comparison.hpp>
 #include <boost/test/unit_test.hpp>
 
@@ -274,6 +276,54 @@ BOOST_AUTO_TEST_CASE( test_Legendre_GeodesyLegendrePolynomialDerivative )
     TUDAT_CHECK_MATRIX_CLOSE_FRACTION( expectedValues, computedTestValues, 1.0e-14 );
 }
 
+//! Test whether output type of Legendre cache is correctly applied.
+BOOST_AUTO_TEST_CASE( test_LegendreCacheOutputType )
+{
+    const int maximumDegree = 50;
+    const int maximumOrder = 50;
+    const double polynomialParameter = 0.3;
+
+    for( unsigned int normalization = 0; normalization < 2; normalization++ )
+    {
+        // Create caches, one for each output type.
+        basic_mathematics::LegendreCache valuesCache( maximumDegree, maximumOrder, normalization );
+        valuesCache.setOutputType( basic_mathematics::legendre_values );
+        basic_mathematics::LegendreCache firstDerivativesCache( maximumDegree, maximumOrder, normalization );
+        basic_mathematics::LegendreCache secondDerivativesCache( maximumDegree, maximumOrder, normalization );
+        secondDerivativesCache.setComputeSecondDerivatives( true );
+
+        BOOST_CHECK_EQUAL( valuesCache.getOutputType( ), basic_mathematics::legendre_values );
+        BOOST_CHECK_EQUAL( firstDerivativesCache.getOutputType( ), basic_mathematics::legendre_first_derivatives );
+        BOOST_CHECK_EQUAL( secondDerivativesCache.getOutputType( ), basic_mathematics::legendre_second_derivatives );
+
+        valuesCache.update( polynomialParameter );
+        firstDerivativesCache.update( polynomialParameter );
+        secondDerivativesCache.update( polynomialParameter );
+
+        // Check that values and derivatives are independent of output type.
+        for( int degree = 0; degree <= maximumDegree; degree++ )
+        {
+            for( int order = 0; order <= degree; order++ )
+            {
+                BOOST_CHECK_EQUAL( valuesCache.getLegendrePolynomial( degree, order ),
+                                   secondDerivativesCache.getLegendrePolynomial( degree, order ) );
+                BOOST_CHECK_EQUAL( firstDerivativesCache.getLegendrePolynomial( degree, order ),
+                                   secondDerivativesCache.getLegendrePolynomial( degree, order ) );
+                BOOST_CHECK_EQUAL( firstDerivativesCache.getLegendrePolynomialDerivative( degree, order ),
+                                   secondDerivativesCache.getLegendrePolynomialDerivative( degree, order ) );
+            }
+        }
+
+        // Check that non-computed derivatives cannot be retrieved.
+        BOOST_CHECK_THROW( valuesCache.getLegendrePolynomialDerivative( 2, 1 ), std::runtime_error );
+        BOOST_CHECK_THROW( firstDerivativesCache.getLegendrePolynomialSecondDerivative( 2, 1 ), std::runtime_error );
+
+        // Check that switching off second derivatives reverts to first derivatives.
+        secondDerivativesCache.setComputeSecondDerivatives( false );
+        BOOST_CHECK_EQUAL( secondDerivativesCache.getOutputType( ), basic_mathematics::legendre_first_derivatives );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
@@ -17,6 +17,8 @@
 #include <boost/test/floating_point_comparison.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include "Tudat/Basics/testMacros.h"
+#include "Tudat/Mathematics/BasicMathematics/leastSquaresEstimation.h"
 #include "Tudat/Mathematics/BasicMathematics/linearAlgebra.h"
 #include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
 
@@ -305,6 +307,288 @@ BOOST_AUTO_TEST_CASE( testRotationMatrixDerivatives )
     }
 }
 
+//! Test if least squares solution from block-wise accumulated normal equations matches solution from full information matrix
+BOOST_AUTO_TEST_CASE( testNormalEquationsAccumulation )
+{
+    // Create deterministic test information matrix, residuals and weights
+    int numberOfObservations = 60;
+    int numberOfParameters = 5;
+    Eigen::MatrixXd informationMatrix = Eigen::MatrixXd::Zero( numberOfObservations, numberOfParameters );
+    Eigen::VectorXd residuals = Eigen::VectorXd::Zero( numberOfObservations );
+    Eigen::VectorXd weights = Eigen::VectorXd::Zero( numberOfObservations );
+    for( int i = 0; i < numberOfObservations; i++ )
+    {
+        double currentTime = static_cast< double >( i ) / static_cast< double >( numberOfObservations );
+        for( int j = 0; j < numberOfParameters; j++ )
+        {
+            informationMatrix( i, j ) = std::cos( ( j + 1 ) * currentTime ) + std::pow( currentTime, j );
+        }
+        residuals( i ) = std::sin( 3.0 * currentTime ) + 0.1 * currentTime;
+        weights( i ) = 1.0 + 0.5 * std::sin( 7.0 * currentTime );
+    }
+
+    Eigen::MatrixXd inverseAprioriCovariance = 1.0E-3 * Eigen::MatrixXd::Identity( numberOfParameters, numberOfParameters );
+
+    // Compute least squares solution from full information matrix
+    std::pair< Eigen::VectorXd, Eigen::MatrixXd > fullSolution =
+            linear_algebra::performLeastSquaresAdjustmentFromInformationMatrix(
+                informationMatrix, residuals, weights, inverseAprioriCovariance, false );
+
+    // Accumulate normal equations in blocks of unequal size, and compute least squares solution
+    Eigen::MatrixXd normalMatrix = Eigen::MatrixXd::Zero( numberOfParameters, numberOfParameters );
+    Eigen::VectorXd rightHandSide = Eigen::VectorXd::Zero( numberOfParameters );
+    std::vector< int > blockSizes = { 7, 20, 1, 32 };
+    int startIndex = 0;
+    for( unsigned int i = 0; i < blockSizes.size( ); i++ )
+    {
+        linear_algebra::addObservationBlockToNormalEquations(
+                    informationMatrix.block( startIndex, 0, blockSizes.at( i ), numberOfParameters ),
+                    residuals.segment( startIndex, blockSizes.at( i ) ),
+                    weights.segment( startIndex, blockSizes.at( i ) ), normalMatrix, rightHandSide );
+        startIndex += blockSizes.at( i );
+    }
+    std::pair< Eigen::VectorXd, Eigen::MatrixXd > accumulatedSolution =
+            linear_algebra::performLeastSquaresAdjustmentFromNormalEquations(
+                normalMatrix + inverseAprioriCovariance, rightHandSide, false );
+
+    // Check consistency of solutions
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( fullSolution.first, accumulatedSolution.first, 1.0E-10 );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION( fullSolution.second, accumulatedSolution.second, 1.0E-12 );
+
+    // Check that inconsistent input is rejected
+    bool isExceptionCaught = false;
+    try
+    {
+        linear_algebra::addObservationBlockToNormalEquations(
+                    informationMatrix, residuals.segment( 0, 10 ), weights, normalMatrix, rightHandSide );
+    }
+    catch( std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+}
+
+//! Test if least squares solution from Householder transformations matches solution from normal equations
+BOOST_AUTO_TEST_CASE( testHouseholderLeastSquaresSolver )
+{
+    // Create deterministic test information matrix, residuals and weights, with the last two parameters only affecting
+    // the first and second half of the observations, respectively (as for arc-wise parameters)
+    int numberOfObservations = 60;
+    int numberOfParameters = 7;
+    Eigen::MatrixXd informationMatrix = Eigen::MatrixXd::Zero( numberOfObservations, numberOfParameters );
+    Eigen::VectorXd residuals = Eigen::VectorXd::Zero( numberOfObservations );
+    Eigen::VectorXd weights = Eigen::VectorXd::Zero( numberOfObservations );
+    for( int i = 0; i < numberOfObservations; i++ )
+    {
+        double currentTime = static_cast< double >( i ) / static_cast< double >( numberOfObservations );
+        for( int j = 0; j < numberOfParameters - 2; j++ )
+        {
+            informationMatrix( i, j ) = std::cos( ( j + 1 ) * currentTime ) + std::pow( currentTime, j );
+        }
+        informationMatrix( i, numberOfParameters - 2 + ( 2 * i ) / numberOfObservations ) = 1.0 + currentTime;
+        residuals( i ) = std::sin( 3.0 * currentTime ) + 0.1 * currentTime;
+        weights( i ) = 1.0 + 0.5 * std::sin( 7.0 * currentTime );
+    }
+
+    // Scale columns of partials, to test normalization
+    Eigen::VectorXd normalizationTerms = Eigen::VectorXd::Zero( numberOfParameters );
+    for( int j = 0; j < numberOfParameters; j++ )
+    {
+        normalizationTerms( j ) = std::pow( 10.0, 2 * j - 6 );
+    }
+    Eigen::MatrixXd scaledInformationMatrix = informationMatrix * normalizationTerms.asDiagonal( );
+
+    // Test with diagonal, full and singular a priori information
+    std::vector< Eigen::MatrixXd > inverseAprioriCovariances;
+    inverseAprioriCovariances.push_back( 1.0E-3 * Eigen::MatrixXd::Identity( numberOfParameters, numberOfParameters ) );
+    inverseAprioriCovariances.push_back( inverseAprioriCovariances.at( 0 ) );
+    inverseAprioriCovariances.at( 1 )( 0, 1 ) = inverseAprioriCovariances.at( 1 )( 1, 0 ) = 2.0E-4;
+    inverseAprioriCovariances.push_back( Eigen::MatrixXd::Zero( numberOfParameters, numberOfParameters ) );
+    inverseAprioriCovariances.at( 2 ).block( 0, 0, 2, 2 ) = 1.0E-3 * Eigen::Matrix2d::Ones( );
+
+    for( unsigned int test = 0; test < inverseAprioriCovariances.size( ); test++ )
+    {
+        // Compute least squares solution from full information matrix
+        std::pair< Eigen::VectorXd, Eigen::MatrixXd > fullSolution =
+                linear_algebra::performLeastSquaresAdjustmentFromInformationMatrix(
+                    informationMatrix, residuals, weights, inverseAprioriCovariances.at( test ), false );
+
+        // Add observations to solver in blocks of unequal size, using scaled partials, and compute normalized solution
+        linear_algebra::HouseholderLeastSquaresSolver householderLeastSquaresSolver(
+                    normalizationTerms.asDiagonal( ) * inverseAprioriCovariances.at( test ) *
+                    normalizationTerms.asDiagonal( ) );
+        std::vector< int > blockSizes = { 7, 20, 1, 32 };
+        int startIndex = 0;
+        for( unsigned int i = 0; i < blockSizes.size( ); i++ )
+        {
+            householderLeastSquaresSolver.addObservationBlock(
+                        scaledInformationMatrix.block( startIndex, 0, blockSizes.at( i ), numberOfParameters ),
+                        residuals.segment( startIndex, blockSizes.at( i ) ),
+                        weights.segment( startIndex, blockSizes.at( i ) ) );
+            startIndex += blockSizes.at( i );
+        }
+        householderLeastSquaresSolver.normalizeParameters( normalizationTerms );
+
+        // Check consistency of solutions
+        Eigen::VectorXd householderSolution = householderLeastSquaresSolver.getSolution( false );
+        TUDAT_CHECK_MATRIX_CLOSE_FRACTION( fullSolution.first, householderSolution, 1.0E-8 );
+        BOOST_CHECK_SMALL( ( fullSolution.second - householderLeastSquaresSolver.getInverseCovarianceMatrix( ) ).cwiseAbs( ).
+                           maxCoeff( ), 1.0E-12 * fullSolution.second.cwiseAbs( ).maxCoeff( ) );
+
+        // Check that square-root information matrix is upper triangular
+        for( int i = 0; i < numberOfParameters; i++ )
+        {
+            for( int j = 0; j < i; j++ )
+            {
+                BOOST_CHECK_EQUAL( householderLeastSquaresSolver.getSquareRootInformationMatrix( )( i, j ), 0.0 );
+            }
+        }
+
+        // Check weighted sum of squares of post-fit residuals, including a priori
+        Eigen::VectorXd postFitResiduals = residuals - informationMatrix * householderSolution;
+        double expectedResidualSumOfSquares = postFitResiduals.dot( weights.cwiseProduct( postFitResiduals ) ) +
+                householderSolution.dot( inverseAprioriCovariances.at( test ) * householderSolution );
+        BOOST_CHECK_CLOSE_FRACTION( householderLeastSquaresSolver.getResidualSumOfSquares( ),
+                                    expectedResidualSumOfSquares, 1.0E-10 );
+    }
+
+    // Check that inconsistent input is rejected
+    bool isExceptionCaught = false;
+    try
+    {
+        linear_algebra::HouseholderLeastSquaresSolver householderLeastSquaresSolver( numberOfParameters );
+        householderLeastSquaresSolver.addObservationBlock(
+                    informationMatrix, residuals, -weights );
+    }
+    catch( std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+}
+
+BOOST_AUTO_TEST_CASE( testBlockArrowheadNormalEquationsSolver )
+{
+    // Create deterministic test problem with two global parameters (indices 0 and 13), and four arcs with three local
+    // parameters each (indices 1 to 12). In the second test, a parameter without any information is added (index 14).
+    int numberOfArcs = 4;
+    int numberOfObservationsPerArc = 40;
+    int numberOfObservations = numberOfArcs * numberOfObservationsPerArc;
+
+    for( unsigned int test = 0; test < 2; test++ )
+    {
+        int numberOfParameters = ( test == 0 ) ? 14 : 15;
+        Eigen::MatrixXd informationMatrix = Eigen::MatrixXd::Zero( numberOfObservations, numberOfParameters );
+        Eigen::VectorXd residuals = Eigen::VectorXd::Zero( numberOfObservations );
+        Eigen::VectorXd weights = Eigen::VectorXd::Zero( numberOfObservations );
+        for( int i = 0; i < numberOfObservations; i++ )
+        {
+            int currentArc = i / numberOfObservationsPerArc;
+            double currentTime = static_cast< double >( i ) / static_cast< double >( numberOfObservations );
+            double currentArcTime = static_cast< double >( i % numberOfObservationsPerArc ) /
+                    static_cast< double >( numberOfObservationsPerArc );
+            informationMatrix( i, 0 ) = std::cos( 2.0 * currentTime );
+            informationMatrix( i, 13 ) = currentTime * currentTime;
+            for( int j = 0; j < 3; j++ )
+            {
+                informationMatrix( i, 1 + 3 * currentArc + j ) = std::pow( currentArcTime, j ) + 0.1 * std::sin( j + i );
+            }
+            residuals( i ) = std::sin( 3.0 * currentTime ) + 0.1 * currentArcTime;
+            weights( i ) = 1.0 + 0.5 * std::sin( 7.0 * currentTime );
+        }
+
+        Eigen::MatrixXd inverseAprioriCovariance = 1.0E-3 * Eigen::MatrixXd::Identity( numberOfParameters, numberOfParameters );
+        if( test == 1 )
+        {
+            inverseAprioriCovariance( 14, 14 ) = 0.0;
+        }
+        Eigen::MatrixXd normalMatrix = linear_algebra::calculateInverseOfUpdatedCovarianceMatrix(
+                    informationMatrix, weights, inverseAprioriCovariance );
+        Eigen::VectorXd rightHandSide = informationMatrix.transpose( ) * weights.asDiagonal( ) * residuals;
+
+        // Define candidate local blocks, with first arc split into two (coupled) blocks
+        std::vector< std::vector< int > > candidateLocalParameterBlocks = { { 1, 2 }, { 3 }, { 4, 5, 6 }, { 7, 8, 9 },
+                                                                            { 10, 11, 12 } };
+        if( test == 1 )
+        {
+            candidateLocalParameterBlocks.push_back( { 14 } );
+        }
+
+        // Solve normal equations with full and block-arrowhead solver, and compare results
+        std::pair< Eigen::VectorXd, Eigen::MatrixXd > fullSolution =
+                linear_algebra::performLeastSquaresAdjustmentFromNormalEquations( normalMatrix, rightHandSide, false );
+        linear_algebra::BlockArrowheadNormalEquationsSolver blockSolver(
+                    normalMatrix, rightHandSide, candidateLocalParameterBlocks, false );
+        for( int i = 0; i < numberOfParameters; i++ )
+        {
+            BOOST_CHECK_SMALL( std::fabs( fullSolution.first( i ) - blockSolver.getSolution( )( i ) ),
+                               1.0E-10 * fullSolution.first.cwiseAbs( ).maxCoeff( ) );
+        }
+
+        // Check merging of coupled blocks, and moving of singular block to global parameters
+        std::vector< std::vector< int > > expectedLocalParameterBlocks = { { 1, 2, 3 }, { 4, 5, 6 }, { 7, 8, 9 },
+                                                                           { 10, 11, 12 } };
+        std::vector< int > expectedGlobalParameterIndices = { 0, 13 };
+        if( test == 1 )
+        {
+            expectedGlobalParameterIndices.push_back( 14 );
+        }
+        BOOST_CHECK( blockSolver.getLocalParameterBlocks( ) == expectedLocalParameterBlocks );
+        BOOST_CHECK( blockSolver.getGlobalParameterIndices( ) == expectedGlobalParameterIndices );
+
+        // Check covariances against inverse of full normal matrix
+        if( test == 0 )
+        {
+            Eigen::MatrixXd fullCovariance = normalMatrix.inverse( );
+            double covarianceTolerance = 1.0E-10 * fullCovariance.cwiseAbs( ).maxCoeff( );
+
+            BOOST_CHECK_SMALL( ( blockSolver.getCovarianceMatrix( ) - fullCovariance ).cwiseAbs( ).maxCoeff( ),
+                               covarianceTolerance );
+            BOOST_CHECK_SMALL( ( blockSolver.getCovarianceMatrixDiagonal( ) - fullCovariance.diagonal( ) ).cwiseAbs( ).
+                               maxCoeff( ), covarianceTolerance );
+
+            Eigen::MatrixXd globalCovariance = blockSolver.getGlobalCovarianceMatrix( );
+            for( unsigned int i = 0; i < expectedGlobalParameterIndices.size( ); i++ )
+            {
+                for( unsigned int j = 0; j < expectedGlobalParameterIndices.size( ); j++ )
+                {
+                    BOOST_CHECK_SMALL( globalCovariance( i, j ) - fullCovariance(
+                                           expectedGlobalParameterIndices.at( i ), expectedGlobalParameterIndices.at( j ) ),
+                                       covarianceTolerance );
+                }
+            }
+
+            for( unsigned int k = 0; k < expectedLocalParameterBlocks.size( ); k++ )
+            {
+                Eigen::MatrixXd localCovariance = blockSolver.getLocalCovarianceMatrix( k );
+                const std::vector< int >& currentBlock = expectedLocalParameterBlocks.at( k );
+                for( unsigned int i = 0; i < currentBlock.size( ); i++ )
+                {
+                    for( unsigned int j = 0; j < currentBlock.size( ); j++ )
+                    {
+                        BOOST_CHECK_SMALL( localCovariance( i, j ) - fullCovariance(
+                                               currentBlock.at( i ), currentBlock.at( j ) ), covarianceTolerance );
+                    }
+                }
+            }
+        }
+    }
+
+    // Check that parameters in multiple local blocks are rejected
+    bool isExceptionCaught = false;
+    try
+    {
+        linear_algebra::BlockArrowheadNormalEquationsSolver blockSolver(
+                    Eigen::MatrixXd::Identity( 4, 4 ), Eigen::VectorXd::Ones( 4 ), { { 0, 1 }, { 1, 2 } } );
+    }
+    catch( std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK_EQUAL( isExceptionCaught, true );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
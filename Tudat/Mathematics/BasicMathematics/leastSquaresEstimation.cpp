@@ -9,9 +9,15 @@
  *
  */
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <limits>
+#include <map>
+#include <string>
 
+#include <Eigen/Cholesky>
+#include <Eigen/Eigenvalues>
 #include <Eigen/LU>
 
 #include "Tudat/Basics/utilities.h"
@@ -93,26 +99,43 @@ Eigen::MatrixXd calculateInverseOfUpdatedCovarianceMatrix(
                 Eigen::MatrixXd::Zero( informationMatrix.cols( ), informationMatrix.cols( ) ) );
 }
 
-//! Function to perform an iteration least squares estimation from information matrix, weights and residuals and a priori
-//! information
-std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromInformationMatrix(
-        const Eigen::MatrixXd& informationMatrix,
-        const Eigen::VectorXd& observationResiduals,
-        const Eigen::VectorXd& diagonalOfWeightMatrix,
-        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+//! Function to add the contribution of a block of observations to a set of normal equations
+void addObservationBlockToNormalEquations(
+        const Eigen::MatrixXd& informationMatrixBlock,
+        const Eigen::VectorXd& observationResidualsBlock,
+        const Eigen::VectorXd& diagonalOfWeightMatrixBlock,
+        Eigen::MatrixXd& normalMatrix,
+        Eigen::VectorXd& rightHandSide )
+{
+    if( ( informationMatrixBlock.rows( ) != observationResidualsBlock.rows( ) ) ||
+            ( informationMatrixBlock.rows( ) != diagonalOfWeightMatrixBlock.rows( ) ) )
+    {
+        throw std::runtime_error( "Error when adding observations to normal equations, input sizes are inconsistent" );
+    }
+
+    if( ( normalMatrix.rows( ) != informationMatrixBlock.cols( ) ) || ( normalMatrix.cols( ) != informationMatrixBlock.cols( ) ) ||
+            ( rightHandSide.rows( ) != informationMatrixBlock.cols( ) ) )
+    {
+        throw std::runtime_error( "Error when adding observations to normal equations, size of normal equations is inconsistent" );
+    }
+
+    normalMatrix.noalias( ) += informationMatrixBlock.transpose( ) *
+            multiplyInformationMatrixByDiagonalWeightMatrix( informationMatrixBlock, diagonalOfWeightMatrixBlock );
+    rightHandSide.noalias( ) += informationMatrixBlock.transpose( ) *
+            ( diagonalOfWeightMatrixBlock.cwiseProduct( observationResidualsBlock ) );
+}
+
+//! Function to perform an iteration least squares estimation from the normal equations
+std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromNormalEquations(
+        const Eigen::MatrixXd& inverseOfCovarianceMatrix,
+        const Eigen::VectorXd& rightHandSide,
         const bool checkConditionNumber,
         const double maximumAllowedConditionNumber,
         const Eigen::MatrixXd& constraintMultiplier,
         const Eigen::VectorXd& constraintRightHandside )
 {
-//    std::cout<<"Residuals "<<observationResiduals.transpose( )<<std::endl;
-//    std::cout<<"Weight diag. "<<diagonalOfWeightMatrix.transpose( )<<std::endl;
-//    std::cout<<"Partials "<<informationMatrix.transpose( )<<std::endl;
-
-    Eigen::VectorXd rightHandSide = informationMatrix.transpose( ) *
-            ( diagonalOfWeightMatrix.cwiseProduct( observationResiduals ) );
-    Eigen::MatrixXd inverseOfCovarianceMatrix = calculateInverseOfUpdatedCovarianceMatrix(
-                informationMatrix, diagonalOfWeightMatrix, inverseOfAPrioriCovarianceMatrix );
+    Eigen::MatrixXd constrainedInverseOfCovarianceMatrix = inverseOfCovarianceMatrix;
+    Eigen::VectorXd constrainedRightHandSide = rightHandSide;
 
     // Add constraints to inverse covariance matrix if required
     if( constraintMultiplier.rows( ) != 0 )
@@ -122,7 +145,7 @@ std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromI
             throw std::runtime_error( "Error when performing constrained least-squares, constraints are incompatible" );
         }
 
-        if( constraintMultiplier.cols( ) != informationMatrix.cols( ) )
+        if( constraintMultiplier.cols( ) != inverseOfCovarianceMatrix.cols( ) )
         {
             throw std::runtime_error( "Error when performing constrained least-squares, constraints are incompatible with partials" );
         }
@@ -130,26 +153,45 @@ std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromI
         int numberOfConstraints = constraintMultiplier.rows( );
         int numberOfParameters = constraintMultiplier.cols( );
 
-        inverseOfCovarianceMatrix.conservativeResize(
+        constrainedInverseOfCovarianceMatrix.conservativeResize(
                     numberOfParameters + numberOfConstraints, numberOfParameters + numberOfConstraints );
-        inverseOfCovarianceMatrix.block( numberOfParameters, 0, numberOfConstraints, numberOfParameters ) =
+        constrainedInverseOfCovarianceMatrix.block( numberOfParameters, 0, numberOfConstraints, numberOfParameters ) =
                constraintMultiplier;
-        inverseOfCovarianceMatrix.block( 0, numberOfParameters, numberOfParameters, numberOfConstraints ) =
+        constrainedInverseOfCovarianceMatrix.block( 0, numberOfParameters, numberOfParameters, numberOfConstraints ) =
                constraintMultiplier.transpose( );
-        inverseOfCovarianceMatrix.block(
+        constrainedInverseOfCovarianceMatrix.block(
                     numberOfParameters, numberOfParameters, numberOfConstraints, numberOfConstraints ).setZero( );
 
-        rightHandSide.conservativeResize( numberOfParameters + numberOfConstraints );
-        rightHandSide.segment( numberOfParameters, numberOfConstraints ) = constraintRightHandside;
+        constrainedRightHandSide.conservativeResize( numberOfParameters + numberOfConstraints );
+        constrainedRightHandSide.segment( numberOfParameters, numberOfConstraints ) = constraintRightHandside;
     }
 
-//    std::cout<<"RHS "<<rightHandSide.transpose( )<<std::endl;
-//    std::cout<<"Inv cov "<<inverseOfCovarianceMatrix<<std::endl;
-
     return std::make_pair( solveSystemOfEquationsWithSvd(
-                               inverseOfCovarianceMatrix, rightHandSide, checkConditionNumber, maximumAllowedConditionNumber ),
-                           inverseOfCovarianceMatrix );
+                               constrainedInverseOfCovarianceMatrix, constrainedRightHandSide,
+                               checkConditionNumber, maximumAllowedConditionNumber ),
+                           constrainedInverseOfCovarianceMatrix );
+}
 
+//! Function to perform an iteration least squares estimation from information matrix, weights and residuals and a priori
+//! information
+std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromInformationMatrix(
+        const Eigen::MatrixXd& informationMatrix,
+        const Eigen::VectorXd& observationResiduals,
+        const Eigen::VectorXd& diagonalOfWeightMatrix,
+        const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix,
+        const bool checkConditionNumber,
+        const double maximumAllowedConditionNumber,
+        const Eigen::MatrixXd& constraintMultiplier,
+        const Eigen::VectorXd& constraintRightHandside )
+{
+    Eigen::VectorXd rightHandSide = informationMatrix.transpose( ) *
+            ( diagonalOfWeightMatrix.cwiseProduct( observationResiduals ) );
+    Eigen::MatrixXd inverseOfCovarianceMatrix = calculateInverseOfUpdatedCovarianceMatrix(
+                informationMatrix, diagonalOfWeightMatrix, inverseOfAPrioriCovarianceMatrix );
+
+    return performLeastSquaresAdjustmentFromNormalEquations(
+                inverseOfCovarianceMatrix, rightHandSide, checkConditionNumber, maximumAllowedConditionNumber,
+                constraintMultiplier, constraintRightHandside );
 }
 
 //! Function to perform an iteration least squares estimation from information matrix, weights and residuals
@@ -178,6 +220,478 @@ std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromI
                 checkConditionNumber, maximumAllowedConditionNumber );
 }
 
+//! Constructor, without any a priori information
+HouseholderLeastSquaresSolver::HouseholderLeastSquaresSolver( const int numberOfParameters ):
+    squareRootInformationMatrix_( Eigen::MatrixXd::Zero( numberOfParameters, numberOfParameters ) ),
+    transformedResiduals_( Eigen::VectorXd::Zero( numberOfParameters ) ),
+    residualSumOfSquares_( 0.0 ){ }
+
+//! Constructor, with a priori information
+HouseholderLeastSquaresSolver::HouseholderLeastSquaresSolver( const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix ):
+    HouseholderLeastSquaresSolver( inverseOfAPrioriCovarianceMatrix.rows( ) )
+{
+    if( inverseOfAPrioriCovarianceMatrix.rows( ) != inverseOfAPrioriCovarianceMatrix.cols( ) )
+    {
+        throw std::runtime_error( "Error when creating Householder least squares solver, a priori information is not square" );
+    }
+
+    if( inverseOfAPrioriCovarianceMatrix.isDiagonal( 0.0 ) )
+    {
+        if( ( inverseOfAPrioriCovarianceMatrix.diagonal( ).array( ) < 0.0 ).any( ) )
+        {
+            throw std::runtime_error( "Error when creating Householder least squares solver, a priori information is negative" );
+        }
+        squareRootInformationMatrix_ = inverseOfAPrioriCovarianceMatrix.diagonal( ).cwiseSqrt( ).asDiagonal( );
+    }
+    else
+    {
+        Eigen::LLT< Eigen::MatrixXd > choleskyDecomposition( inverseOfAPrioriCovarianceMatrix );
+        if( choleskyDecomposition.info( ) == Eigen::Success )
+        {
+            squareRootInformationMatrix_ = choleskyDecomposition.matrixU( );
+        }
+        else
+        {
+            // Add singular a priori information as pseudo-observations along its eigenvectors
+            Eigen::SelfAdjointEigenSolver< Eigen::MatrixXd > eigenDecomposition( inverseOfAPrioriCovarianceMatrix );
+            Eigen::VectorXd eigenvalues = eigenDecomposition.eigenvalues( );
+            double eigenvalueTolerance = eigenvalues.cwiseAbs( ).maxCoeff( ) * eigenvalues.rows( ) *
+                    std::numeric_limits< double >::epsilon( );
+            if( eigenvalues.minCoeff( ) < -eigenvalueTolerance )
+            {
+                throw std::runtime_error( "Error when creating Householder least squares solver, a priori information is not "
+                                          "positive semi-definite" );
+            }
+
+            for( int i = 0; i < eigenvalues.rows( ); i++ )
+            {
+                if( eigenvalues( i ) > eigenvalueTolerance )
+                {
+                    addObservationBlock( std::sqrt( eigenvalues( i ) ) *
+                                         eigenDecomposition.eigenvectors( ).col( i ).transpose( ),
+                                         Eigen::VectorXd::Zero( 1 ), Eigen::VectorXd::Ones( 1 ) );
+                }
+            }
+        }
+    }
+}
+
+//! Function to add a block of observations to the solver
+void HouseholderLeastSquaresSolver::addObservationBlock( const Eigen::MatrixXd& informationMatrixBlock,
+                                                       const Eigen::VectorXd& observationResidualsBlock,
+                                                       const Eigen::VectorXd& diagonalOfWeightMatrixBlock )
+{
+    if( ( informationMatrixBlock.rows( ) != observationResidualsBlock.rows( ) ) ||
+            ( informationMatrixBlock.rows( ) != diagonalOfWeightMatrixBlock.rows( ) ) )
+    {
+        throw std::runtime_error( "Error when adding observations to Householder least squares solver, input sizes are inconsistent" );
+    }
+
+    int numberOfParameters = squareRootInformationMatrix_.cols( );
+    if( informationMatrixBlock.cols( ) != numberOfParameters )
+    {
+        throw std::runtime_error( "Error when adding observations to Householder least squares solver, number of parameters is inconsistent" );
+    }
+
+    if( ( diagonalOfWeightMatrixBlock.array( ) < 0.0 ).any( ) )
+    {
+        throw std::runtime_error( "Error when adding observations to Householder least squares solver, weights must be non-negative" );
+    }
+
+    // Whiten partials and residuals, so that all observations have unit weight
+    Eigen::VectorXd squareRootOfWeights = diagonalOfWeightMatrixBlock.cwiseSqrt( );
+    Eigen::MatrixXd weightedPartials = squareRootOfWeights.asDiagonal( ) * informationMatrixBlock;
+    Eigen::VectorXd weightedResiduals = squareRootOfWeights.cwiseProduct( observationResidualsBlock );
+
+    // Annihilate partials column by column with Householder transformations acting on [R; W^1/2 H] and [z; W^1/2 y]
+    for( int j = 0; j < numberOfParameters; j++ )
+    {
+        double columnSquaredNorm = weightedPartials.col( j ).squaredNorm( );
+        if( columnSquaredNorm == 0.0 )
+        {
+            continue;
+        }
+
+        // Compute Householder vector v = [1; h/(alpha - beta)] and factor tau, which map [alpha; h] onto [beta; 0]
+        double diagonalEntry = squareRootInformationMatrix_( j, j );
+        double newDiagonalEntry = std::sqrt( diagonalEntry * diagonalEntry + columnSquaredNorm );
+        if( diagonalEntry >= 0.0 )
+        {
+            newDiagonalEntry = -newDiagonalEntry;
+        }
+        double householderFactor = ( newDiagonalEntry - diagonalEntry ) / newDiagonalEntry;
+        weightedPartials.col( j ) /= ( diagonalEntry - newDiagonalEntry );
+        squareRootInformationMatrix_( j, j ) = newDiagonalEntry;
+
+        // Apply transformation to the remaining columns
+        int numberOfRemainingColumns = numberOfParameters - j - 1;
+        if( numberOfRemainingColumns > 0 )
+        {
+            Eigen::RowVectorXd projection = squareRootInformationMatrix_.row( j ).tail( numberOfRemainingColumns ) +
+                    weightedPartials.col( j ).transpose( ) * weightedPartials.rightCols( numberOfRemainingColumns );
+            squareRootInformationMatrix_.row( j ).tail( numberOfRemainingColumns ) -= householderFactor * projection;
+            weightedPartials.rightCols( numberOfRemainingColumns ).noalias( ) -=
+                    ( householderFactor * weightedPartials.col( j ) ) * projection;
+        }
+
+        // Apply transformation to the residuals
+        double residualProjection = transformedResiduals_( j ) + weightedPartials.col( j ).dot( weightedResiduals );
+        transformedResiduals_( j ) -= householderFactor * residualProjection;
+        weightedResiduals -= ( householderFactor * residualProjection ) * weightedPartials.col( j );
+    }
+
+    // Remaining (transformed) residuals can no longer be reduced by any parameter adjustment
+    residualSumOfSquares_ += weightedResiduals.squaredNorm( );
+}
+
+//! Function to normalize the estimated parameters
+void HouseholderLeastSquaresSolver::normalizeParameters( const Eigen::VectorXd& normalizationTerms )
+{
+    if( normalizationTerms.rows( ) != squareRootInformationMatrix_.cols( ) )
+    {
+        throw std::runtime_error( "Error when normalizing Householder least squares solver, size of normalization is inconsistent" );
+    }
+    squareRootInformationMatrix_ = squareRootInformationMatrix_ * normalizationTerms.cwiseInverse( ).asDiagonal( );
+}
+
+//! Function to compute the least squares solution from the current square-root information matrix
+Eigen::VectorXd HouseholderLeastSquaresSolver::getSolution( const bool checkConditionNumber,
+                                                          const double maximumAllowedConditionNumber ) const
+{
+    int numberOfParameters = squareRootInformationMatrix_.cols( );
+    if( numberOfParameters == 0 )
+    {
+        return Eigen::VectorXd::Zero( 0 );
+    }
+
+    Eigen::VectorXd absoluteDiagonal = squareRootInformationMatrix_.diagonal( ).cwiseAbs( );
+    double maximumDiagonalEntry = absoluteDiagonal.maxCoeff( );
+    double minimumDiagonalEntry = absoluteDiagonal.minCoeff( );
+
+    if( minimumDiagonalEntry <= maximumDiagonalEntry * numberOfParameters * std::numeric_limits< double >::epsilon( ) )
+    {
+        // Information matrix is (numerically) singular: compute minimum-norm solution
+        Eigen::JacobiSVD< Eigen::MatrixXd > svdDecomposition = squareRootInformationMatrix_.jacobiSvd(
+                    Eigen::ComputeThinU | Eigen::ComputeThinV );
+        if( checkConditionNumber )
+        {
+            double conditionNumber = std::pow( getConditionNumberOfDecomposedMatrix( svdDecomposition ), 2 );
+            if( conditionNumber > maximumAllowedConditionNumber )
+            {
+                std::cerr << "Warning when performing least squares, condition number is " << conditionNumber << std::endl;
+            }
+        }
+        return svdDecomposition.solve( transformedResiduals_ );
+    }
+    else
+    {
+        // Condition number of R^T*R is estimated from the diagonal of R (lower bound of actual value)
+        if( checkConditionNumber )
+        {
+            double conditionNumber = std::pow( maximumDiagonalEntry / minimumDiagonalEntry, 2 );
+            if( conditionNumber > maximumAllowedConditionNumber )
+            {
+                std::cerr << "Warning when performing least squares, condition number is at least " << conditionNumber
+                          << std::endl;
+            }
+        }
+        return squareRootInformationMatrix_.triangularView< Eigen::Upper >( ).solve( transformedResiduals_ );
+    }
+}
+
+//! Function to retrieve the inverse covariance matrix (R^T*R) of the current solution
+Eigen::MatrixXd HouseholderLeastSquaresSolver::getInverseCovarianceMatrix( ) const
+{
+    return squareRootInformationMatrix_.transpose( ) * squareRootInformationMatrix_;
+}
+
+//! Function to retrieve the entries of a matrix at a given set of rows and columns
+Eigen::MatrixXd getMatrixEntries( const Eigen::MatrixXd& matrix, const std::vector< int >& rowIndices,
+                                  const std::vector< int >& columnIndices )
+{
+    Eigen::MatrixXd matrixEntries = Eigen::MatrixXd( rowIndices.size( ), columnIndices.size( ) );
+    for( unsigned int j = 0; j < columnIndices.size( ); j++ )
+    {
+        for( unsigned int i = 0; i < rowIndices.size( ); i++ )
+        {
+            matrixEntries( i, j ) = matrix( rowIndices.at( i ), columnIndices.at( j ) );
+        }
+    }
+    return matrixEntries;
+}
+
+//! Function to retrieve the entries of a vector at a given set of indices
+Eigen::VectorXd getVectorEntries( const Eigen::VectorXd& vector, const std::vector< int >& indices )
+{
+    Eigen::VectorXd vectorEntries = Eigen::VectorXd( indices.size( ) );
+    for( unsigned int i = 0; i < indices.size( ); i++ )
+    {
+        vectorEntries( i ) = vector( indices.at( i ) );
+    }
+    return vectorEntries;
+}
+
+//! Constructor, solves the normal equations
+BlockArrowheadNormalEquationsSolver::BlockArrowheadNormalEquationsSolver(
+        const Eigen::MatrixXd& inverseOfCovarianceMatrix,
+        const Eigen::VectorXd& rightHandSide,
+        const std::vector< std::vector< int > >& candidateLocalParameterBlocks,
+        const bool checkConditionNumber,
+        const double maximumAllowedConditionNumber )
+{
+    int numberOfParameters = inverseOfCovarianceMatrix.rows( );
+    if( ( inverseOfCovarianceMatrix.cols( ) != numberOfParameters ) || ( rightHandSide.rows( ) != numberOfParameters ) )
+    {
+        throw std::runtime_error( "Error when solving block-arrowhead normal equations, input sizes are inconsistent" );
+    }
+
+    // Set candidate block of each parameter (-1 for global parameters)
+    std::vector< int > parameterBlockIndices( numberOfParameters, -1 );
+    for( unsigned int i = 0; i < candidateLocalParameterBlocks.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < candidateLocalParameterBlocks.at( i ).size( ); j++ )
+        {
+            int currentIndex = candidateLocalParameterBlocks.at( i ).at( j );
+            if( currentIndex < 0 || currentIndex >= numberOfParameters )
+            {
+                throw std::runtime_error( "Error when solving block-arrowhead normal equations, parameter index out of range" );
+            }
+            else if( parameterBlockIndices.at( currentIndex ) != -1 )
+            {
+                throw std::runtime_error( "Error when solving block-arrowhead normal equations, parameter " +
+                                          std::to_string( currentIndex ) + " is in multiple local blocks" );
+            }
+            parameterBlockIndices[ currentIndex ] = i;
+        }
+    }
+
+    // Merge candidate blocks that are coupled in the normal matrix (union-find, with root of each block)
+    std::vector< int > blockRoots( candidateLocalParameterBlocks.size( ) );
+    for( unsigned int i = 0; i < blockRoots.size( ); i++ )
+    {
+        blockRoots[ i ] = i;
+    }
+    auto findRoot = [ & ]( int blockIndex )
+    {
+        while( blockRoots.at( blockIndex ) != blockIndex )
+        {
+            blockRoots[ blockIndex ] = blockRoots.at( blockRoots.at( blockIndex ) );
+            blockIndex = blockRoots.at( blockIndex );
+        }
+        return blockIndex;
+    };
+    for( int j = 0; j < numberOfParameters; j++ )
+    {
+        if( parameterBlockIndices.at( j ) >= 0 )
+        {
+            for( int i = j + 1; i < numberOfParameters; i++ )
+            {
+                if( parameterBlockIndices.at( i ) >= 0 && inverseOfCovarianceMatrix( i, j ) != 0.0 )
+                {
+                    int firstRoot = findRoot( parameterBlockIndices.at( i ) );
+                    int secondRoot = findRoot( parameterBlockIndices.at( j ) );
+                    if( firstRoot != secondRoot )
+                    {
+                        blockRoots[ std::max( firstRoot, secondRoot ) ] = std::min( firstRoot, secondRoot );
+                    }
+                }
+            }
+        }
+    }
+
+    std::map< int, std::vector< int > > mergedBlocks;
+    for( int i = 0; i < numberOfParameters; i++ )
+    {
+        if( parameterBlockIndices.at( i ) >= 0 )
+        {
+            mergedBlocks[ findRoot( parameterBlockIndices.at( i ) ) ].push_back( i );
+        }
+        else
+        {
+            globalParameterIndices_.push_back( i );
+        }
+    }
+
+    // Decompose diagonal blocks of local parameters; singular blocks are moved to global parameters
+    for( auto blockIterator = mergedBlocks.begin( ); blockIterator != mergedBlocks.end( ); blockIterator++ )
+    {
+        Eigen::LLT< Eigen::MatrixXd > currentDecomposition(
+                    getMatrixEntries( inverseOfCovarianceMatrix, blockIterator->second, blockIterator->second ) );
+        if( currentDecomposition.info( ) == Eigen::Success )
+        {
+            localParameterBlocks_.push_back( blockIterator->second );
+            localBlockDecompositions_.push_back( currentDecomposition );
+        }
+        else
+        {
+            globalParameterIndices_.insert(
+                        globalParameterIndices_.end( ), blockIterator->second.begin( ), blockIterator->second.end( ) );
+        }
+    }
+    std::sort( globalParameterIndices_.begin( ), globalParameterIndices_.end( ) );
+
+    // Eliminate local blocks, computing Schur complement and associated right-hand side
+    int numberOfGlobalParameters = globalParameterIndices_.size( );
+    Eigen::MatrixXd schurComplement = getMatrixEntries(
+                inverseOfCovarianceMatrix, globalParameterIndices_, globalParameterIndices_ );
+    Eigen::VectorXd schurComplementRightHandSide = getVectorEntries( rightHandSide, globalParameterIndices_ );
+    std::vector< Eigen::VectorXd > localSolutions;
+    for( unsigned int i = 0; i < localParameterBlocks_.size( ); i++ )
+    {
+        Eigen::MatrixXd localToGlobalBlock = getMatrixEntries(
+                    inverseOfCovarianceMatrix, localParameterBlocks_.at( i ), globalParameterIndices_ );
+        localToGlobalCouplings_.push_back( localBlockDecompositions_.at( i ).solve( localToGlobalBlock ) );
+        localSolutions.push_back( localBlockDecompositions_.at( i ).solve(
+                                      getVectorEntries( rightHandSide, localParameterBlocks_.at( i ) ) ) );
+
+        schurComplement.noalias( ) -= localToGlobalBlock.transpose( ) * localToGlobalCouplings_.at( i );
+        schurComplementRightHandSide.noalias( ) -= localToGlobalBlock.transpose( ) * localSolutions.at( i );
+    }
+
+    // Solve for global parameters, and back-substitute to obtain local parameters
+    solution_ = Eigen::VectorXd::Zero( numberOfParameters );
+    Eigen::VectorXd globalSolution = Eigen::VectorXd::Zero( numberOfGlobalParameters );
+    if( numberOfGlobalParameters > 0 )
+    {
+        schurComplementDecomposition_.compute( schurComplement, Eigen::ComputeThinU | Eigen::ComputeThinV );
+        if( checkConditionNumber )
+        {
+            double conditionNumber = getConditionNumberOfDecomposedMatrix( schurComplementDecomposition_ );
+            if( conditionNumber > maximumAllowedConditionNumber )
+            {
+                std::cerr << "Warning when performing least squares, condition number is " << conditionNumber << std::endl;
+            }
+        }
+        globalSolution = schurComplementDecomposition_.solve( schurComplementRightHandSide );
+    }
+
+    for( int i = 0; i < numberOfGlobalParameters; i++ )
+    {
+        solution_( globalParameterIndices_.at( i ) ) = globalSolution( i );
+    }
+    for( unsigned int i = 0; i < localParameterBlocks_.size( ); i++ )
+    {
+        Eigen::VectorXd localSolution = localSolutions.at( i ) - localToGlobalCouplings_.at( i ) * globalSolution;
+        for( unsigned int j = 0; j < localParameterBlocks_.at( i ).size( ); j++ )
+        {
+            solution_( localParameterBlocks_.at( i ).at( j ) ) = localSolution( j );
+        }
+    }
+}
+
+//! Function to compute the marginal covariance matrix of a single local block
+Eigen::MatrixXd BlockArrowheadNormalEquationsSolver::getLocalCovarianceMatrix( const int blockIndex ) const
+{
+    const Eigen::MatrixXd& currentCoupling = localToGlobalCouplings_.at( blockIndex );
+    Eigen::MatrixXd localCovariance = localBlockDecompositions_.at( blockIndex ).solve(
+                Eigen::MatrixXd::Identity( currentCoupling.rows( ), currentCoupling.rows( ) ) );
+    if( globalParameterIndices_.size( ) > 0 )
+    {
+        localCovariance.noalias( ) += currentCoupling * getGlobalCovarianceMatrix( ) * currentCoupling.transpose( );
+    }
+    return localCovariance;
+}
+
+//! Function to compute the marginal covariance matrix of the global parameters
+Eigen::MatrixXd BlockArrowheadNormalEquationsSolver::getGlobalCovarianceMatrix( ) const
+{
+    if( globalParameterIndices_.size( ) == 0 )
+    {
+        return Eigen::MatrixXd::Zero( 0, 0 );
+    }
+    return schurComplementDecomposition_.solve(
+                Eigen::MatrixXd::Identity( globalParameterIndices_.size( ), globalParameterIndices_.size( ) ) );
+}
+
+//! Function to compute the diagonal of the covariance matrix (variances of all parameters)
+Eigen::VectorXd BlockArrowheadNormalEquationsSolver::getCovarianceMatrixDiagonal( ) const
+{
+    Eigen::VectorXd covarianceDiagonal = Eigen::VectorXd::Zero( solution_.rows( ) );
+
+    Eigen::MatrixXd globalCovariance = getGlobalCovarianceMatrix( );
+    for( unsigned int i = 0; i < globalParameterIndices_.size( ); i++ )
+    {
+        covarianceDiagonal( globalParameterIndices_.at( i ) ) = globalCovariance( i, i );
+    }
+
+    for( unsigned int i = 0; i < localParameterBlocks_.size( ); i++ )
+    {
+        const Eigen::MatrixXd& currentCoupling = localToGlobalCouplings_.at( i );
+        Eigen::VectorXd localVariances = localBlockDecompositions_.at( i ).solve(
+                    Eigen::MatrixXd::Identity( currentCoupling.rows( ), currentCoupling.rows( ) ) ).diagonal( );
+        if( globalParameterIndices_.size( ) > 0 )
+        {
+            localVariances += ( currentCoupling * globalCovariance ).cwiseProduct( currentCoupling ).rowwise( ).sum( );
+        }
+        for( unsigned int j = 0; j < localParameterBlocks_.at( i ).size( ); j++ )
+        {
+            covarianceDiagonal( localParameterBlocks_.at( i ).at( j ) ) = localVariances( j );
+        }
+    }
+    return covarianceDiagonal;
+}
+
+//! Function to compute the full covariance matrix
+Eigen::MatrixXd BlockArrowheadNormalEquationsSolver::getCovarianceMatrix( ) const
+{
+    int numberOfParameters = solution_.rows( );
+    int numberOfGlobalParameters = globalParameterIndices_.size( );
+    Eigen::MatrixXd covarianceMatrix = Eigen::MatrixXd::Zero( numberOfParameters, numberOfParameters );
+
+    // Compute covariance of global parameters, and products F_i*S^-1
+    Eigen::MatrixXd globalCovariance = getGlobalCovarianceMatrix( );
+    std::vector< Eigen::MatrixXd > localToGlobalCovariances;
+    for( unsigned int i = 0; i < localParameterBlocks_.size( ); i++ )
+    {
+        localToGlobalCovariances.push_back( localToGlobalCouplings_.at( i ) * globalCovariance );
+    }
+
+    for( int i = 0; i < numberOfGlobalParameters; i++ )
+    {
+        for( int j = 0; j < numberOfGlobalParameters; j++ )
+        {
+            covarianceMatrix( globalParameterIndices_.at( i ), globalParameterIndices_.at( j ) ) = globalCovariance( i, j );
+        }
+    }
+
+    for( unsigned int i = 0; i < localParameterBlocks_.size( ); i++ )
+    {
+        const std::vector< int >& currentBlock = localParameterBlocks_.at( i );
+
+        // Set local-global covariance: -F_i*S^-1
+        for( unsigned int k = 0; k < currentBlock.size( ); k++ )
+        {
+            for( int j = 0; j < numberOfGlobalParameters; j++ )
+            {
+                covarianceMatrix( currentBlock.at( k ), globalParameterIndices_.at( j ) ) =
+                        covarianceMatrix( globalParameterIndices_.at( j ), currentBlock.at( k ) ) =
+                        -localToGlobalCovariances.at( i )( k, j );
+            }
+        }
+
+        // Set local-local covariance: delta_ij*N_ii^-1 + F_i*S^-1*F_j^T
+        for( unsigned int j = 0; j <= i; j++ )
+        {
+            const std::vector< int >& otherBlock = localParameterBlocks_.at( j );
+            Eigen::MatrixXd currentCovariance = localToGlobalCovariances.at( i ) * localToGlobalCouplings_.at( j ).transpose( );
+            if( i == j )
+            {
+                currentCovariance += localBlockDecompositions_.at( i ).solve(
+                            Eigen::MatrixXd::Identity( currentBlock.size( ), currentBlock.size( ) ) );
+            }
+            for( unsigned int k = 0; k < currentBlock.size( ); k++ )
+            {
+                for( unsigned int l = 0; l < otherBlock.size( ); l++ )
+                {
+                    covarianceMatrix( currentBlock.at( k ), otherBlock.at( l ) ) =
+                            covarianceMatrix( otherBlock.at( l ), currentBlock.at( k ) ) = currentCovariance( k, l );
+                }
+            }
+        }
+    }
+    return covarianceMatrix;
+}
+
 //! Function to fit a univariate polynomial through a set of data
 Eigen::VectorXd getLeastSquaresPolynomialFit(
         const Eigen::VectorXd& independentValues,
@@ -16,7 +16,9 @@
 #define TUDAT_LEASTSQUARESESTIMATION_H
 
 #include <map>
+#include <vector>
 
+#include <Eigen/Cholesky>
 #include <Eigen/Core>
 #include <Eigen/SVD>
 
@@ -100,6 +102,49 @@ Eigen::MatrixXd calculateInverseOfUpdatedCovarianceMatrix(
         const Eigen::MatrixXd& informationMatrix,
         const Eigen::VectorXd& diagonalOfWeightMatrix );
 
+//! Function to add the contribution of a block of observations to a set of normal equations
+/*!
+ * Function to add the contribution of a block of observations to a set of normal equations, so that the normal equations
+ * can be accumulated without ever storing the information matrix of all observations. The normal matrix
+ * (H^T*W*H) and right-hand side (H^T*W*y) are modified by this function.
+ * \param informationMatrixBlock Matrix containing partial derivatives of the observations in the current block (rows) w.r.t.
+ * estimated parameters (columns)
+ * \param observationResidualsBlock Difference between measured and simulated observations in the current block
+ * \param diagonalOfWeightMatrixBlock Diagonal of observation weights matrix of the current block
+ * \param normalMatrix Normal matrix to which the contribution of the current block is added (returned by reference)
+ * \param rightHandSide Right-hand side of normal equations to which the contribution of the current block is added (returned
+ * by reference)
+ */
+void addObservationBlockToNormalEquations(
+        const Eigen::MatrixXd& informationMatrixBlock,
+        const Eigen::VectorXd& observationResidualsBlock,
+        const Eigen::VectorXd& diagonalOfWeightMatrixBlock,
+        Eigen::MatrixXd& normalMatrix,
+        Eigen::VectorXd& rightHandSide );
+
+//! Function to perform an iteration least squares estimation from the normal equations
+/*!
+ * Function to perform an iteration least squares estimation from the normal equations, i.e. the inverse of the covariance
+ * matrix (including any a priori information) and the associated right-hand side. This function allows the estimation to
+ * be performed without the complete information matrix being available, e.g. when it has been accumulated block-wise by
+ * addObservationBlockToNormalEquations.
+ * \param inverseOfCovarianceMatrix Inverse of covariance matrix (H^T*W*H + inverse a priori covariance)
+ * \param rightHandSide Right-hand side of normal equations (H^T*W*y)
+ * \param checkConditionNumber Boolean to denote whether the condition number is checked when estimating (warning is printed
+ * when value exceeds maximumAllowedConditionNumber)
+ * \param maximumAllowedConditionNumber Maximum value of the condition number of the covariance matrix that is allowed
+ * \param constraintMultiplier Multiplier for estimated parameter that defines linear constraint
+ * \param constraintRightHandside Right-hand side estimation linear constraint
+ * \return Pair containing: (first: parameter adjustment, second: inverse covariance)
+ */
+std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromNormalEquations(
+        const Eigen::MatrixXd& inverseOfCovarianceMatrix,
+        const Eigen::VectorXd& rightHandSide,
+        const bool checkConditionNumber = 1,
+        const double maximumAllowedConditionNumber = 1.0E8,
+        const Eigen::MatrixXd& constraintMultiplier = Eigen::MatrixXd( 0, 0 ),
+        const Eigen::VectorXd& constraintRightHandside = Eigen::VectorXd( 0 ) );
+
 //! Function to perform an iteration least squares estimation from information matrix, weights and residuals and a priori
 //! information
 /*!
@@ -169,6 +214,236 @@ std::pair< Eigen::VectorXd, Eigen::MatrixXd > performLeastSquaresAdjustmentFromI
         const bool checkConditionNumber = 1,
         const double maximumAllowedConditionNumber = 1.0E8 );
 
+//! Class to solve a linear least squares problem by Householder transformations (batch QR decomposition)
+/*!
+ *  Class to solve a linear least squares problem by Householder transformations (batch QR decomposition). Instead of the normal
+ *  matrix H^T*W*H, the upper-triangular square root R of the information matrix (with R^T*R = H^T*W*H + P^-1) and the associated
+ *  transformed residuals z are stored. Each block of observations is added by a sequence of Householder transformations,
+ *  which annihilate the (weighted) partials of the block into R, so that the normal matrix is never formed. The condition
+ *  number of R is the square root of that of the normal matrix, making the solution much less sensitive to round-off.
+ *  Columns of the partials that are fully zero (e.g. parameters of arcs that are not observed by a block) are skipped, so
+ *  that the cost of adding a block of m observations is at most O(m*n^2), with n the number of parameters.
+ */
+class HouseholderLeastSquaresSolver
+{
+public:
+
+    //! Constructor, without any a priori information
+    /*!
+     * Constructor, without any a priori information
+     * \param numberOfParameters Number of estimated parameters
+     */
+    HouseholderLeastSquaresSolver( const int numberOfParameters );
+
+    //! Constructor, with a priori information
+    /*!
+     * Constructor, with a priori information, which is converted to an initial square-root information matrix
+     * \param inverseOfAPrioriCovarianceMatrix Inverse of a priori covariance matrix (must be positive semi-definite)
+     */
+    HouseholderLeastSquaresSolver( const Eigen::MatrixXd& inverseOfAPrioriCovarianceMatrix );
+
+    //! Function to add a block of observations to the solver
+    /*!
+     * Function to add a block of observations to the solver, updating the square-root information matrix and transformed
+     * residuals by Householder transformations.
+     * \param informationMatrixBlock Matrix containing partial derivatives of the observations in the current block (rows)
+     * w.r.t. estimated parameters (columns)
+     * \param observationResidualsBlock Difference between measured and simulated observations in the current block
+     * \param diagonalOfWeightMatrixBlock Diagonal of observation weights matrix of the current block
+     */
+    void addObservationBlock( const Eigen::MatrixXd& informationMatrixBlock,
+                              const Eigen::VectorXd& observationResidualsBlock,
+                              const Eigen::VectorXd& diagonalOfWeightMatrixBlock );
+
+    //! Function to normalize the estimated parameters
+    /*!
+     * Function to normalize the estimated parameters, such that the solver subsequently solves for the normalized parameters
+     * x.cwiseProduct( normalizationTerms ). This is equivalent to having added all partials with columns divided by
+     * normalizationTerms (as done by e.g. OrbitDeterminationManager::normalizeObservationMatrix).
+     * \param normalizationTerms Vector with scaling values used for normalization of each column of the partials matrix
+     */
+    void normalizeParameters( const Eigen::VectorXd& normalizationTerms );
+
+    //! Function to compute the least squares solution from the current square-root information matrix
+    /*!
+     * Function to compute the least squares solution from the current square-root information matrix, by back-substitution.
+     * If the square-root information matrix is (numerically) singular, the minimum-norm solution is computed by SVD.
+     * \param checkConditionNumber Boolean to denote whether the condition number of the information matrix is checked
+     * (warning is printed when value exceeds maximumAllowedConditionNumber)
+     * \param maximumAllowedConditionNumber Maximum value of the condition number of the information matrix that is allowed
+     * \return Least squares solution
+     */
+    Eigen::VectorXd getSolution( const bool checkConditionNumber = 1,
+                                 const double maximumAllowedConditionNumber = 1.0E8 ) const;
+
+    //! Function to retrieve the inverse covariance matrix (R^T*R) of the current solution
+    /*!
+     * Function to retrieve the inverse covariance matrix (R^T*R) of the current solution
+     * \return Inverse covariance matrix of the current solution
+     */
+    Eigen::MatrixXd getInverseCovarianceMatrix( ) const;
+
+    //! Function to retrieve the upper-triangular square-root information matrix R
+    /*!
+     * Function to retrieve the upper-triangular square-root information matrix R
+     * \return Upper-triangular square-root information matrix R
+     */
+    const Eigen::MatrixXd& getSquareRootInformationMatrix( ) const
+    {
+        return squareRootInformationMatrix_;
+    }
+
+    //! Function to retrieve the transformed residuals z, such that the solution x satisfies R*x=z
+    /*!
+     * Function to retrieve the transformed residuals z, such that the solution x satisfies R*x=z
+     * \return Transformed residuals z
+     */
+    const Eigen::VectorXd& getTransformedResiduals( ) const
+    {
+        return transformedResiduals_;
+    }
+
+    //! Function to retrieve the weighted sum of squares of the post-fit residuals of all observations that were added
+    /*!
+     * Function to retrieve the weighted sum of squares of the post-fit residuals (i.e. residuals after applying the
+     * solution from getSolution) of all observations that were added to the solver.
+     * \return Weighted sum of squares of the post-fit residuals
+     */
+    double getResidualSumOfSquares( ) const
+    {
+        return residualSumOfSquares_;
+    }
+
+private:
+
+    //! Upper-triangular square-root information matrix R
+    Eigen::MatrixXd squareRootInformationMatrix_;
+
+    //! Transformed residuals z
+    Eigen::VectorXd transformedResiduals_;
+
+    //! Weighted sum of squares of the post-fit residuals
+    double residualSumOfSquares_;
+};
+
+//! Class to solve normal equations with a block-arrowhead structure, by eliminating local blocks with a Schur complement
+/*!
+ *  Class to solve normal equations N*x=b in which the parameters can be split into a number of local blocks, which are
+ *  mutually uncoupled in N (e.g. the parameters of separate arcs in a multi-arc estimation), and a set of global parameters
+ *  that may couple to all local blocks. Each local block i is eliminated by a Cholesky decomposition of its diagonal block
+ *  N_ii, after which the Schur complement S = N_GG - sum_i N_Gi*N_ii^-1*N_iG is solved for the global parameters (by SVD,
+ *  as in performLeastSquaresAdjustmentFromNormalEquations), and the local parameters are recovered by back-substitution.
+ *  The cost is O(k*l^3 + g^3) (plus coupling terms O(k*l^2*g + k*l*g^2)), with k local blocks of size l and g global
+ *  parameters, instead of O(n^3) for the full system. The marginal covariances of the parameters are only computed when
+ *  requested.
+ *  Candidate local blocks that turn out to be coupled in the normal matrix are merged, and local blocks with a singular
+ *  diagonal block are moved to the global parameters, so that the solution is always equal to that of the full system.
+ */
+class BlockArrowheadNormalEquationsSolver
+{
+public:
+
+    //! Constructor, solves the normal equations
+    /*!
+     * Constructor, solves the normal equations
+     * \param inverseOfCovarianceMatrix Inverse of covariance matrix (H^T*W*H + inverse a priori covariance)
+     * \param rightHandSide Right-hand side of normal equations (H^T*W*y)
+     * \param candidateLocalParameterBlocks List of candidate local blocks, each given by the indices of its parameters. All
+     * parameters not in any block are global parameters.
+     * \param checkConditionNumber Boolean to denote whether the condition number of the Schur complement is checked when
+     * estimating (warning is printed when value exceeds maximumAllowedConditionNumber)
+     * \param maximumAllowedConditionNumber Maximum value of the condition number of the Schur complement that is allowed
+     */
+    BlockArrowheadNormalEquationsSolver(
+            const Eigen::MatrixXd& inverseOfCovarianceMatrix,
+            const Eigen::VectorXd& rightHandSide,
+            const std::vector< std::vector< int > >& candidateLocalParameterBlocks,
+            const bool checkConditionNumber = 1,
+            const double maximumAllowedConditionNumber = 1.0E8 );
+
+    //! Function to retrieve the solution of the normal equations
+    /*!
+     * Function to retrieve the solution of the normal equations
+     * \return Solution of the normal equations
+     */
+    const Eigen::VectorXd& getSolution( ) const
+    {
+        return solution_;
+    }
+
+    //! Function to retrieve the local blocks that were eliminated, each given by the indices of its parameters
+    /*!
+     * Function to retrieve the local blocks that were eliminated (after merging coupled blocks and removing singular
+     * blocks), each given by the indices of its parameters
+     * \return Local blocks that were eliminated
+     */
+    const std::vector< std::vector< int > >& getLocalParameterBlocks( ) const
+    {
+        return localParameterBlocks_;
+    }
+
+    //! Function to retrieve the indices of the global parameters
+    /*!
+     * Function to retrieve the indices of the global parameters
+     * \return Indices of the global parameters
+     */
+    const std::vector< int >& getGlobalParameterIndices( ) const
+    {
+        return globalParameterIndices_;
+    }
+
+    //! Function to compute the marginal covariance matrix of a single local block
+    /*!
+     * Function to compute the marginal covariance matrix of a single local block (N_ii^-1 + F_i*S^-1*F_i^T, with
+     * F_i = N_ii^-1*N_iG)
+     * \param blockIndex Index of local block in list returned by getLocalParameterBlocks
+     * \return Marginal covariance matrix of local block, in order of its parameter indices
+     */
+    Eigen::MatrixXd getLocalCovarianceMatrix( const int blockIndex ) const;
+
+    //! Function to compute the marginal covariance matrix of the global parameters
+    /*!
+     * Function to compute the marginal covariance matrix of the global parameters (inverse of Schur complement)
+     * \return Marginal covariance matrix of the global parameters, in order of getGlobalParameterIndices
+     */
+    Eigen::MatrixXd getGlobalCovarianceMatrix( ) const;
+
+    //! Function to compute the diagonal of the covariance matrix (variances of all parameters)
+    /*!
+     * Function to compute the diagonal of the covariance matrix (variances of all parameters), without computing the
+     * full covariance matrix
+     * \return Diagonal of the covariance matrix
+     */
+    Eigen::VectorXd getCovarianceMatrixDiagonal( ) const;
+
+    //! Function to compute the full covariance matrix
+    /*!
+     * Function to compute the full covariance matrix, from the decompositions of the local blocks and Schur complement
+     * \return Full covariance matrix
+     */
+    Eigen::MatrixXd getCovarianceMatrix( ) const;
+
+private:
+
+    //! Local blocks that were eliminated, each given by the indices of its parameters
+    std::vector< std::vector< int > > localParameterBlocks_;
+
+    //! Indices of the global parameters
+    std::vector< int > globalParameterIndices_;
+
+    //! Cholesky decompositions of the diagonal blocks N_ii of the local blocks
+    std::vector< Eigen::LLT< Eigen::MatrixXd > > localBlockDecompositions_;
+
+    //! Coupling matrices F_i = N_ii^-1*N_iG of the local blocks
+    std::vector< Eigen::MatrixXd > localToGlobalCouplings_;
+
+    //! SVD decomposition of the Schur complement S
+    Eigen::JacobiSVD< Eigen::MatrixXd > schurComplementDecomposition_;
+
+    //! Solution of the normal equations
+    Eigen::VectorXd solution_;
+};
+
 //! Function to fit a univariate polynomial through a set of data
 /*!
  *  Function to fit a univariate polynomial through a set of data. User must provide independent variables and observations
@@ -9,6 +9,7 @@
  *
  */
 
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
@@ -29,38 +30,18 @@ namespace basic_mathematics
 LegendreCache::LegendreCache( const bool useGeodesyNormalization )
 {
     useGeodesyNormalization_  = useGeodesyNormalization;
-
-    if( useGeodesyNormalization_ )
-    {
-        legendrePolynomialFunction_ = geodesyNormalizedLegendrePolynomialFunction;
-    }
-    else
-    {
-        legendrePolynomialFunction_ = regularLegendrePolynomialFunction;
-    }
+    outputType_ = legendre_first_derivatives;
 
     resetMaximumDegreeAndOrder( 1, 1 );
-
-    computeSecondDerivatives_ = 0;
-
 }
 
 //! Constructor
 LegendreCache::LegendreCache( const int maximumDegree, const int maximumOrder, const bool useGeodesyNormalization  )
 {
     useGeodesyNormalization_  = useGeodesyNormalization;
-
-    if( useGeodesyNormalization_ )
-    {
-        legendrePolynomialFunction_ = geodesyNormalizedLegendrePolynomialFunction;
-    }
-    else
-    {
-        legendrePolynomialFunction_ = regularLegendrePolynomialFunction;
-    }
+    outputType_ = legendre_first_derivatives;
 
     resetMaximumDegreeAndOrder( maximumDegree, maximumOrder );
-    computeSecondDerivatives_ = 0;
 }
 
 //! Get Legendre polynomial from cache when possible, and from direct computation otherwise.
@@ -74,65 +55,76 @@ void LegendreCache::update( const double polynomialParameter  )
         // Set complement of argument (assuming it to be sine of latitude) cosine of latitude is always positive.
         currentPolynomialParameterComplement_ = std::sqrt( 1.0 - polynomialParameter * polynomialParameter );
 
-        LegendreCache& thisReference = *this;
+        const int rowSize = maximumOrder_ + 1;
 
-        int jMax = -1;
-        for( int i = 0; i <= maximumDegree_; i++ )
+        // Compute Legendre polynomials, column by column (e.g. for increasing degree at constant order)
+        const double degreeOneOrderOnePolynomial = useGeodesyNormalization_ ?
+                    std::sqrt( 3.0 - 3.0 * polynomialParameter * polynomialParameter ) :
+                    std::sqrt( 1.0 - polynomialParameter * polynomialParameter );
+        for( int j = 0; j <= maximumOrder_; j++ )
         {
-            jMax = std::min( i, maximumOrder_ );
-            for( int j = 0; j <= jMax ; j++ )
+            // Compute sectoral polynomial
+            if( j == 0 )
             {
-                // Compute legendre polynomial
-                legendreValues_[ i * ( maximumOrder_ + 1 ) + j ] = legendrePolynomialFunction_( i, j, thisReference );
-
-                if( j != 0 )
-                {
-                    // Compute legendre polynomial derivative
-                    if( useGeodesyNormalization_ )
-                    {
-                        legendreDerivatives_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ] =
-                                computeGeodesyLegendrePolynomialDerivative(
-                                    i, j - 1, currentPolynomialParameter_,
-                                    legendreValues_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ],
-                                legendreValues_[ i * ( maximumOrder_ + 1 ) + j ],
-                                derivativeNormalizations_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ] );
-                    }
-                    else
-                    {
-                        legendreDerivatives_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ] =
-                                computeLegendrePolynomialDerivative(
-                                    j - 1, currentPolynomialParameter_,
-                                    legendreValues_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ],
-                                legendreValues_[ i * ( maximumOrder_ + 1 ) + j ] );
-                    }
+                legendreValues_[ 0 ] = 1.0;
+            }
+            else if( j == 1 )
+            {
+                legendreValues_[ rowSize + 1 ] = degreeOneOrderOnePolynomial;
+            }
+            else
+            {
+                legendreValues_[ j * rowSize + j ] = sectoralRecursionCoefficients_[ j ] *
+                        degreeOneOrderOnePolynomial * legendreValues_[ ( j - 1 ) * rowSize + ( j - 1 ) ];
+            }
 
-                }
+            // Compute polynomials at current order through degree recursion
+            double twoDegreesPriorPolynomial = 0.0;
+            double oneDegreePriorPolynomial = legendreValues_[ j * rowSize + j ];
+            for( int i = j + 1; i <= maximumDegree_; i++ )
+            {
+                const double currentPolynomial =
+                        firstDegreeRecursionCoefficients_[ i * rowSize + j ] * polynomialParameter *
+                        oneDegreePriorPolynomial -
+                        secondDegreeRecursionCoefficients_[ i * rowSize + j ] * twoDegreesPriorPolynomial;
+                legendreValues_[ i * rowSize + j ] = currentPolynomial;
+
+                twoDegreesPriorPolynomial = oneDegreePriorPolynomial;
+                oneDegreePriorPolynomial = currentPolynomial;
             }
+        }
+
+        // Compute first derivatives of Legendre polynomials if needed
+        if( outputType_ != legendre_values )
+        {
+            const double inverseComplement = 1.0 / currentPolynomialParameterComplement_;
+            const double orderTermMultiplier = polynomialParameter * inverseComplement * inverseComplement;
 
-            // Compute legendre polynomial derivative for i = j  (if needed)
-            if( jMax == i )
+            int jMax = -1;
+            for( int i = 0; i <= maximumDegree_; i++ )
             {
-                if( useGeodesyNormalization_ )
-                {
-                    legendreDerivatives_[ i * ( maximumOrder_ + 1 ) +  jMax ] =
-                            computeGeodesyLegendrePolynomialDerivative(
-                                i, jMax, currentPolynomialParameter_,
-                                legendreValues_[ i * ( maximumOrder_ + 1 ) + jMax ], 0.0,
-                            derivativeNormalizations_[ i * ( maximumOrder_ + 1 ) + jMax ] );
-                }
-                else
+                jMax = std::min( i, maximumOrder_ );
+                for( int j = 0; j <= jMax ; j++ )
                 {
-                    legendreDerivatives_[ i * ( maximumOrder_ + 1 ) + jMax ] =
-                            computeLegendrePolynomialDerivative(
-                                jMax, currentPolynomialParameter_,
-                                legendreValues_[ i * ( maximumOrder_ + 1 ) + jMax ], 0.0 );
+                    // The derivative at order j requires the polynomial at order j + 1, which is zero for i = j, and
+                    // not available for j = maximumOrder_ < i (as in the derivative computation of previous versions).
+                    if( j < jMax || jMax == i )
+                    {
+                        const double incrementedLegendrePolynomial =
+                                ( j < jMax ) ? legendreValues_[ i * rowSize + j + 1 ] : 0.0;
+                        legendreDerivatives_[ i * rowSize + j ] =
+                                ( useGeodesyNormalization_ ? derivativeNormalizations_[ i * rowSize + j ] : 1.0 ) *
+                                incrementedLegendrePolynomial * inverseComplement -
+                                static_cast< double >( j ) * orderTermMultiplier * legendreValues_[ i * rowSize + j ];
+                    }
                 }
             }
         }
 
         // Compute second derivatives of Legendre polynomials if needed
-        if( computeSecondDerivatives_ )
+        if( outputType_ == legendre_second_derivatives )
         {
+            int jMax = -1;
             for( int i = 0; i <= maximumDegree_; i++ )
             {
                 jMax = std::min( i, maximumOrder_ );
@@ -141,53 +133,26 @@ void LegendreCache::update( const double polynomialParameter  )
                     if( j != 0 )
                     {
                         // Compute legendre polynomial second derivatives
-                        if( useGeodesyNormalization_ )
-                        {
-                            legendreSecondDerivatives_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ] =
-                                    computeGeodesyLegendrePolynomialSecondDerivative(
-                                        i, j - 1, currentPolynomialParameter_,
-                                        legendreValues_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ],
-                                    legendreValues_[ i * ( maximumOrder_ + 1 ) + j ],
-                                    legendreDerivatives_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ],
-                                    legendreDerivatives_[ i * ( maximumOrder_ + 1 ) + j ],
-                                    derivativeNormalizations_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ] );
-                        }
-                        else
-                        {
-                            legendreSecondDerivatives_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ] =
-                                    computeGeodesyLegendrePolynomialSecondDerivative(
-                                        i, j - 1, currentPolynomialParameter_,
-                                        legendreValues_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ],
-                                    legendreValues_[ i * ( maximumOrder_ + 1 ) + j ],
-                                    legendreDerivatives_[ i * ( maximumOrder_ + 1 ) + ( j - 1 ) ],
-                                    legendreDerivatives_[ i * ( maximumOrder_ + 1 ) + j ], 1.0 );
-                        }
-
+                        legendreSecondDerivatives_[ i * rowSize + ( j - 1 ) ] =
+                                computeGeodesyLegendrePolynomialSecondDerivative(
+                                    i, j - 1, currentPolynomialParameter_,
+                                    legendreValues_[ i * rowSize + ( j - 1 ) ],
+                                legendreValues_[ i * rowSize + j ],
+                                legendreDerivatives_[ i * rowSize + ( j - 1 ) ],
+                                legendreDerivatives_[ i * rowSize + j ],
+                                ( useGeodesyNormalization_ ? derivativeNormalizations_[ i * rowSize + ( j - 1 ) ] : 1.0 ) );
                     }
                 }
                 // Compute legendre polynomial second derivative for i = j  (if needed)
                 if( jMax == i )
                 {
-                    if( useGeodesyNormalization_ )
-                    {
-                        legendreSecondDerivatives_[ i * ( maximumOrder_ + 1 ) +  jMax ] =
-                                computeGeodesyLegendrePolynomialSecondDerivative(
-                                    i, jMax, currentPolynomialParameter_,
-                                    legendreValues_[ i * ( maximumOrder_ + 1 ) + jMax ], 0.0,
-                                legendreDerivatives_[ i * ( maximumOrder_ + 1 ) + jMax ], 0.0,
-                                derivativeNormalizations_[ i * ( maximumOrder_ + 1 ) + jMax ] );
-                    }
-                    else
-                    {
-                        legendreSecondDerivatives_[ i * ( maximumOrder_ + 1 ) +  jMax ] =
-                                computeGeodesyLegendrePolynomialSecondDerivative(
-                                    i, jMax, currentPolynomialParameter_,
-                                    legendreValues_[ i * ( maximumOrder_ + 1 ) + jMax ], 0.0,
-                                legendreDerivatives_[ i * ( maximumOrder_ + 1 ) + jMax ], 0.0,
-                                1.0 );
-                    }
+                    legendreSecondDerivatives_[ i * rowSize +  jMax ] =
+                            computeGeodesyLegendrePolynomialSecondDerivative(
+                                i, jMax, currentPolynomialParameter_,
+                                legendreValues_[ i * rowSize + jMax ], 0.0,
+                            legendreDerivatives_[ i * rowSize + jMax ], 0.0,
+                            ( useGeodesyNormalization_ ? derivativeNormalizations_[ i * rowSize + jMax ] : 1.0 ) );
                 }
-
             }
         }
     }
@@ -209,6 +174,9 @@ void LegendreCache::resetMaximumDegreeAndOrder( const int maximumDegree, const i
     legendreSecondDerivatives_.resize( ( maximumDegree_ + 1 ) * ( maximumOrder_ + 1 ) );
 
     derivativeNormalizations_.resize( ( maximumDegree_ + 1 ) * ( maximumOrder_ + 1 ) );
+    firstDegreeRecursionCoefficients_.resize( ( maximumDegree_ + 1 ) * ( maximumOrder_ + 1 ) );
+    secondDegreeRecursionCoefficients_.resize( ( maximumDegree_ + 1 ) * ( maximumOrder_ + 1 ) );
+    sectoralRecursionCoefficients_.resize( maximumOrder_ + 1 );
 
     for( int i = 0; i <= maximumDegree_; i++ )
     {
@@ -224,6 +192,52 @@ void LegendreCache::resetMaximumDegreeAndOrder( const int maximumDegree, const i
             {
                 derivativeNormalizations_[ i * ( maximumOrder_ + 1 ) + j ] *= std::sqrt( 0.5 );
             }
+
+            // Compute coefficients of degree recursion (see computeLegendrePolynomialVertical and
+            // computeGeodesyLegendrePolynomialVertical)
+            const double degree = static_cast< double >( i );
+            const double order = static_cast< double >( j );
+            double firstRecursionCoefficient = 0.0, secondRecursionCoefficient = 0.0;
+            if( i > j )
+            {
+                if( useGeodesyNormalization_ )
+                {
+                    const double commonFactor = std::sqrt(
+                                ( 2.0 * degree + 1.0 ) / ( ( degree + order ) * ( degree - order ) ) );
+                    firstRecursionCoefficient = commonFactor * std::sqrt( 2.0 * degree - 1.0 );
+                    if( i > j + 1 )
+                    {
+                        secondRecursionCoefficient = commonFactor * std::sqrt(
+                                    ( degree + order - 1.0 ) * ( degree - order - 1.0 ) / ( 2.0 * degree - 3.0 ) );
+                    }
+                }
+                else
+                {
+                    firstRecursionCoefficient = ( 2.0 * degree - 1.0 ) / ( degree - order );
+                    secondRecursionCoefficient = ( degree + order - 1.0 ) / ( degree - order );
+                }
+            }
+            firstDegreeRecursionCoefficients_[ i * ( maximumOrder_ + 1 ) + j ] = firstRecursionCoefficient;
+            secondDegreeRecursionCoefficients_[ i * ( maximumOrder_ + 1 ) + j ] = secondRecursionCoefficient;
+        }
+    }
+
+    // Compute coefficients of sectoral recursion (see computeLegendrePolynomialDiagonal and
+    // computeGeodesyLegendrePolynomialDiagonal)
+    for( int j = 0; j <= maximumOrder_; j++ )
+    {
+        if( j < 2 )
+        {
+            sectoralRecursionCoefficients_[ j ] = TUDAT_NAN;
+        }
+        else if( useGeodesyNormalization_ )
+        {
+            sectoralRecursionCoefficients_[ j ] = std::sqrt(
+                        ( 2.0 * static_cast< double >( j ) + 1.0 ) / ( 6.0 * static_cast< double >( j ) ) );
+        }
+        else
+        {
+            sectoralRecursionCoefficients_[ j ] = 2.0 * static_cast< double >( j ) - 1.0;
         }
     }
 
@@ -270,6 +284,10 @@ double LegendreCache::getLegendrePolynomialDerivative(
         throw std::runtime_error( errorMessage );
         return TUDAT_NAN;
     }
+    else if( outputType_ == legendre_values )
+    {
+        throw std::runtime_error( "Error when requesting legendre cache first derivatives, no computations performed" );
+    }
     else if( order > degree )
     {
         return 0.0;
@@ -294,7 +312,7 @@ double LegendreCache::getLegendrePolynomialSecondDerivative(
         throw std::runtime_error( errorMessage );
         return TUDAT_NAN;
     }
-    else if( computeSecondDerivatives_ == 0 )
+    else if( outputType_ != legendre_second_derivatives )
     {
         throw std::runtime_error( "Error when requesting legendre cache second derivatives, no computations performed" );
     }
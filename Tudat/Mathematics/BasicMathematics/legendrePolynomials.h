@@ -48,7 +48,22 @@ namespace tudat
 namespace basic_mathematics
 {
 
+//! Enum defining which quantities are computed when updating a LegendreCache.
+enum LegendreCacheOutputType
+{
+    legendre_values,
+    legendre_first_derivatives,
+    legendre_second_derivatives
+};
+
 //! Class for creating and accessing a back-end cache of Legendre polynomials.
+/*!
+ * Class for creating and accessing a back-end cache of Legendre polynomials. When updating the cache, the polynomials
+ * are computed by a direct forward-column recursion (over increasing degree at constant order, starting from the
+ * sectoral polynomial), using recursion coefficients that are precomputed when resetting the maximum degree and order.
+ * The output type (see LegendreCacheOutputType) determines whether the polynomials only, or also their first, or first
+ * and second, derivatives are computed (legendre_first_derivatives by default).
+ */
 class LegendreCache
 {
 
@@ -176,10 +191,37 @@ public:
      */
     void setComputeSecondDerivatives( const bool computeSecondDerivatives )
     {
-        computeSecondDerivatives_ = computeSecondDerivatives;
+        if( computeSecondDerivatives )
+        {
+            setOutputType( legendre_second_derivatives );
+        }
+        else if( outputType_ == legendre_second_derivatives )
+        {
+            setOutputType( legendre_first_derivatives );
+        }
+    }
+
+    //! Function to reset which quantities are to be computed when calling update function
+    /*!
+     * Function to reset which quantities are to be computed when calling update function
+     * \param outputType Quantities that are to be computed when calling update function.
+     */
+    void setOutputType( const LegendreCacheOutputType outputType )
+    {
+        outputType_ = outputType;
         currentPolynomialParameter_ = TUDAT_NAN;
     }
 
+    //! Function to retrieve which quantities are computed when calling update function
+    /*!
+     * Function to retrieve which quantities are computed when calling update function
+     * \return Quantities that are computed when calling update function.
+     */
+    LegendreCacheOutputType getOutputType( )
+    {
+        return outputType_;
+    }
+
 
 
 private:
@@ -217,9 +259,6 @@ private:
      */
     std::vector< double > legendreSecondDerivatives_;
 
-    //! Function from which to compute the Legendre polynomials.
-    LegendrePolynomialFunction legendrePolynomialFunction_;
-
     //! Boolean denoting whether the Legendre polynomials are geodesy-normalized or unnormalized
     bool useGeodesyNormalization_;
 
@@ -229,9 +268,17 @@ private:
     //! Prec-computed normalization factors that are to be used for computation fo Legendre polynomial derivative
     std::vector< double > derivativeNormalizations_;
 
-    //! Boolean denoting whether the second derivatives of the Legendre polynomials are to be computed when calling
-    //! update function.
-    bool computeSecondDerivatives_;
+    //! Pre-computed coefficients of P_{n-1,m} in degree recursion for P_{n,m}, at entry n * ( maximumOrder_ + 1 ) + m.
+    std::vector< double > firstDegreeRecursionCoefficients_;
+
+    //! Pre-computed coefficients of P_{n-2,m} in degree recursion for P_{n,m}, at entry n * ( maximumOrder_ + 1 ) + m.
+    std::vector< double > secondDegreeRecursionCoefficients_;
+
+    //! Pre-computed coefficients of P_{1,1}P_{m-1,m-1} in sectoral recursion for P_{m,m}, at entry m.
+    std::vector< double > sectoralRecursionCoefficients_;
+
+    //! Quantities that are to be computed when calling update function.
+    LegendreCacheOutputType outputType_;
 
 
 };
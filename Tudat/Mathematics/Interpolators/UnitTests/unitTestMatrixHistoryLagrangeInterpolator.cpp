@@ -0,0 +1,204 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/parallelization.h"
+#include "Tudat/Mathematics/Interpolators/lagrangeInterpolator.h"
+#include "Tudat/Mathematics/Interpolators/matrixHistoryLagrangeInterpolator.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace tudat::interpolators;
+
+//! Function to evaluate a test matrix, of which each entry is a smooth function of time.
+Eigen::MatrixXd getTestMatrix( const double time, const int numberOfRows, const int numberOfColumns )
+{
+    Eigen::MatrixXd testMatrix( numberOfRows, numberOfColumns );
+    for( int i = 0; i < numberOfRows; i++ )
+    {
+        for( int j = 0; j < numberOfColumns; j++ )
+        {
+            testMatrix( i, j ) = std::sin( 0.1 * time * static_cast< double >( i + 1 ) + static_cast< double >( j ) ) +
+                    0.01 * static_cast< double >( i * numberOfColumns + j );
+        }
+    }
+    return testMatrix;
+}
+
+//! Function to evaluate a test matrix, of which each entry is a cubic polynomial of time.
+Eigen::MatrixXd getCubicTestMatrix( const double time, const int numberOfRows, const int numberOfColumns )
+{
+    Eigen::MatrixXd testMatrix( numberOfRows, numberOfColumns );
+    for( int i = 0; i < numberOfRows; i++ )
+    {
+        for( int j = 0; j < numberOfColumns; j++ )
+        {
+            testMatrix( i, j ) = static_cast< double >( i - j ) + 0.3 * time * static_cast< double >( j + 1 ) -
+                    0.02 * time * time + 1.0E-3 * time * time * time * static_cast< double >( i + 1 );
+        }
+    }
+    return testMatrix;
+}
+
+BOOST_AUTO_TEST_SUITE( test_matrix_history_lagrange_interpolation )
+
+//! Test whether the interpolator reproduces the results of the LagrangeInterpolator, and polynomials of sufficiently
+//! low order.
+BOOST_AUTO_TEST_CASE( testMatrixHistoryLagrangeInterpolatorAccuracy )
+{
+    const int numberOfRows = 6;
+    const int numberOfColumns = 9;
+
+    // Create (non-equidistant) data set.
+    std::map< double, Eigen::MatrixXd > dataMap;
+    std::map< double, Eigen::MatrixXd > cubicDataMap;
+    for( int i = 0; i < 40; i++ )
+    {
+        const double currentTime = 2.0 * static_cast< double >( i ) + 0.3 * std::sin( static_cast< double >( i ) );
+        dataMap[ currentTime ] = getTestMatrix( currentTime, numberOfRows, numberOfColumns );
+        cubicDataMap[ currentTime ] = getCubicTestMatrix( currentTime, numberOfRows, numberOfColumns );
+    }
+
+    for( unsigned int numberOfStages = 2; numberOfStages <= 8; numberOfStages += 2 )
+    {
+        LagrangeInterpolator< double, Eigen::MatrixXd > lagrangeInterpolator( dataMap, numberOfStages );
+        MatrixHistoryLagrangeInterpolator matrixHistoryInterpolator( dataMap, numberOfStages );
+        BOOST_CHECK_EQUAL( matrixHistoryInterpolator.getNumberOfRows( ), numberOfRows );
+        BOOST_CHECK_EQUAL( matrixHistoryInterpolator.getNumberOfColumns( ), numberOfColumns );
+
+        // Compare to LagrangeInterpolator in intervals where both use the same (centered) stencil.
+        const double firstTime = dataMap.begin( )->first;
+        const double lastTime = dataMap.rbegin( )->first;
+        for( int i = 0; i < 1000; i++ )
+        {
+            const double testTime = firstTime + ( lastTime - firstTime ) * static_cast< double >( i ) / 999.0;
+            if( std::distance( dataMap.begin( ), dataMap.upper_bound( testTime ) ) > static_cast< int >( numberOfStages ) / 2 &&
+                    std::distance( dataMap.upper_bound( testTime ), dataMap.end( ) ) >= static_cast< int >( numberOfStages ) / 2 )
+            {
+                const Eigen::MatrixXd matrixDifference =
+                        matrixHistoryInterpolator.interpolate( testTime ) - lagrangeInterpolator.interpolate( testTime );
+                BOOST_CHECK_SMALL( matrixDifference.cwiseAbs( ).maxCoeff( ), 1.0E-13 );
+            }
+        }
+
+        // Check data points are reproduced exactly.
+        for( auto dataIterator = dataMap.begin( ); dataIterator != dataMap.end( ); dataIterator++ )
+        {
+            BOOST_CHECK_SMALL( ( matrixHistoryInterpolator.interpolate( dataIterator->first ) -
+                                 dataIterator->second ).cwiseAbs( ).maxCoeff( ), 1.0E-14 );
+        }
+
+        // Check cubic polynomials are reproduced over the full domain (including edges and extrapolation).
+        if( numberOfStages >= 4 )
+        {
+            MatrixHistoryLagrangeInterpolator cubicInterpolator( cubicDataMap, numberOfStages );
+            for( int i = 0; i < 1000; i++ )
+            {
+                const double testTime = firstTime - 1.0 + ( lastTime - firstTime + 2.0 ) * static_cast< double >( i ) / 999.0;
+                const Eigen::MatrixXd matrixDifference = cubicInterpolator.interpolate( testTime ) -
+                        getCubicTestMatrix( testTime, numberOfRows, numberOfColumns );
+                BOOST_CHECK_SMALL( matrixDifference.cwiseAbs( ).maxCoeff( ), 1.0E-10 );
+            }
+        }
+    }
+
+    // Check invalid input.
+    BOOST_CHECK_THROW( MatrixHistoryLagrangeInterpolator( dataMap, 5 ), std::runtime_error );
+    BOOST_CHECK_THROW( MatrixHistoryLagrangeInterpolator( dataMap, 42 ), std::runtime_error );
+    dataMap.begin( )->second = Eigen::MatrixXd::Zero( numberOfRows + 1, numberOfColumns );
+    BOOST_CHECK_THROW( MatrixHistoryLagrangeInterpolator( dataMap, 4 ), std::runtime_error );
+}
+
+//! Test interpolation into caller-provided storage, batch interpolation, and concurrent interpolation.
+BOOST_AUTO_TEST_CASE( testMatrixHistoryLagrangeInterpolatorInterfaces )
+{
+    const int numberOfRows = 6;
+    const int numberOfColumns = 30;
+
+    std::vector< double > times;
+    std::vector< Eigen::MatrixXd > matrices;
+    for( int i = 0; i < 100; i++ )
+    {
+        times.push_back( 10.0 * static_cast< double >( i ) );
+        matrices.push_back( getTestMatrix( times.back( ), numberOfRows, numberOfColumns ) );
+    }
+    MatrixHistoryLagrangeInterpolator interpolator( times, matrices, 8 );
+
+    std::vector< double > testTimes;
+    for( int i = 0; i < 2000; i++ )
+    {
+        testTimes.push_back( -5.0 + 0.5 * static_cast< double >( i ) );
+    }
+
+    // Compute reference values with function returning matrix.
+    std::vector< Eigen::MatrixXd > referenceMatrices;
+    for( unsigned int i = 0; i < testTimes.size( ); i++ )
+    {
+        referenceMatrices.push_back( interpolator.interpolate( testTimes.at( i ) ) );
+    }
+
+    // Check interpolation into block of larger matrix.
+    Eigen::MatrixXd combinedMatrix = Eigen::MatrixXd::Zero( numberOfRows + 2, numberOfColumns + 6 );
+    for( unsigned int i = 0; i < testTimes.size( ); i += 7 )
+    {
+        interpolator.interpolate( testTimes.at( i ), combinedMatrix.block( 1, 6, numberOfRows, numberOfColumns ) );
+        BOOST_CHECK( combinedMatrix.block( 1, 6, numberOfRows, numberOfColumns ) == referenceMatrices.at( i ) );
+        BOOST_CHECK_EQUAL( combinedMatrix.leftCols( 6 ).cwiseAbs( ).maxCoeff( ), 0.0 );
+        BOOST_CHECK_EQUAL( combinedMatrix.topRows( 1 ).cwiseAbs( ).maxCoeff( ), 0.0 );
+        BOOST_CHECK_EQUAL( combinedMatrix.bottomRows( 1 ).cwiseAbs( ).maxCoeff( ), 0.0 );
+    }
+    BOOST_CHECK_THROW( interpolator.interpolate( 0.0, combinedMatrix ), std::runtime_error );
+
+    // Check batch interpolation.
+    std::vector< Eigen::MatrixXd > batchMatrices;
+    interpolator.interpolateAtSortedValues( testTimes, batchMatrices );
+    BOOST_CHECK_EQUAL( batchMatrices.size( ), testTimes.size( ) );
+    for( unsigned int i = 0; i < testTimes.size( ); i++ )
+    {
+        BOOST_CHECK( batchMatrices.at( i ) == referenceMatrices.at( i ) );
+    }
+
+    std::vector< double > unsortedTimes = testTimes;
+    std::swap( unsortedTimes.at( 3 ), unsortedTimes.at( 4 ) );
+    BOOST_CHECK_THROW( interpolator.interpolateAtSortedValues( unsortedTimes, batchMatrices ), std::runtime_error );
+
+    // Check concurrent interpolation.
+    std::vector< Eigen::MatrixXd > parallelMatrices(
+                testTimes.size( ), Eigen::MatrixXd::Zero( numberOfRows, numberOfColumns ) );
+    utilities::executeParallelLoop(
+                testTimes.size( ), 4, [ & ]( const int i )
+    {
+        interpolator.interpolate( testTimes.at( i ), parallelMatrices.at( i ) );
+    } );
+    for( unsigned int i = 0; i < testTimes.size( ); i++ )
+    {
+        BOOST_CHECK( parallelMatrices.at( i ) == referenceMatrices.at( i ) );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
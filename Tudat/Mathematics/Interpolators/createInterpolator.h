@@ -430,24 +430,26 @@ public:
     std::shared_ptr< InterpolatorSettings > interpolatorSettings_;
 };
 
-//! Function to create a one-dimensional interpolator
+//! Function to create a one-dimensional interpolator from vectors of independent and dependent values
 /*!
- *  Function to create a one-dimensional interpolator from the data that is to be interpolated,
+ *  Function to create a one-dimensional interpolator from the data that is to be interpolated, provided as vectors of
+ *  independent and dependent values (e.g. as retrieved from a StateHistory, without creating an intermediate map),
  *  as well as the settings that are to be used to create the interpolator.
- *  \param dataToInterpolate Map providing data that is to be interpolated (key = independent
- *      variables, value = dependent variables).
+ *  \param independentValues Values of the independent variable, sorted in ascending order.
+ *  \param dependentValues Values of the dependent variable at the values in independentValues.
  *  \param interpolatorSettings Settings that are to be used to create interpolator.
  *  \param defaultExtrapolationValue Pair of default values to be used for extrapolation, in case
         of use_default_value or use_default_value_with_warning as methods for boundaryHandling.
  *  \param firstDerivativeOfDependentVariables First derivative of dependent variables w.r.t. independent variable at
- *      independent variables values in values of dataToInterpolate. By default, this vector is empty, it only needs to
+ *      independent variables values in independentValues. By default, this vector is empty, it only needs to
  *      be supplied if the selected interpolator requires this data (e.g. Hermite spline).
- *  \return Interpolator created from dataToInterpolate using interpolatorSettings.
+ *  \return Interpolator created from independentValues and dependentValues using interpolatorSettings.
  */
 template< typename IndependentVariableType, typename DependentVariableType >
 std::shared_ptr< OneDimensionalInterpolator< IndependentVariableType, DependentVariableType > >
 createOneDimensionalInterpolator(
-        const std::map< IndependentVariableType, DependentVariableType > dataToInterpolate,
+        const std::vector< IndependentVariableType >& independentValues,
+        const std::vector< DependentVariableType >& dependentValues,
         const std::shared_ptr< InterpolatorSettings > interpolatorSettings,
         const std::pair< DependentVariableType, DependentVariableType >& defaultExtrapolationValue =
         std::make_pair( IdentityElement::getAdditionIdentity< DependentVariableType >( ),
@@ -473,7 +475,7 @@ createOneDimensionalInterpolator(
     case linear_interpolator:
         createdInterpolator = std::make_shared< LinearInterpolator
                 < IndependentVariableType, DependentVariableType > >(
-                    dataToInterpolate, interpolatorSettings->getSelectedLookupScheme( ),
+                    independentValues, dependentValues, interpolatorSettings->getSelectedLookupScheme( ),
                     interpolatorSettings->getBoundaryHandling( ).at( 0 ), defaultExtrapolationValue );
         break;
     case cubic_spline_interpolator:
@@ -482,14 +484,14 @@ createOneDimensionalInterpolator(
         {
             createdInterpolator = std::make_shared< CubicSplineInterpolator
                     < IndependentVariableType, DependentVariableType > >(
-                        dataToInterpolate, interpolatorSettings->getSelectedLookupScheme( ),
+                        independentValues, dependentValues, interpolatorSettings->getSelectedLookupScheme( ),
                         interpolatorSettings->getBoundaryHandling( ).at( 0 ) );
         }
         else
         {
             createdInterpolator = std::make_shared< CubicSplineInterpolator
                     < IndependentVariableType, DependentVariableType, long double > >(
-                        dataToInterpolate, interpolatorSettings->getSelectedLookupScheme( ),
+                        independentValues, dependentValues, interpolatorSettings->getSelectedLookupScheme( ),
                         interpolatorSettings->getBoundaryHandling( ).at( 0 ), defaultExtrapolationValue );
         }
         break;
@@ -506,7 +508,7 @@ createOneDimensionalInterpolator(
             {
                 createdInterpolator = std::make_shared< LagrangeInterpolator
                         < IndependentVariableType, DependentVariableType, double > >(
-                            dataToInterpolate, lagrangeInterpolatorSettings->getInterpolatorOrder( ),
+                            independentValues, dependentValues, lagrangeInterpolatorSettings->getInterpolatorOrder( ),
                             interpolatorSettings->getSelectedLookupScheme( ),
                             lagrangeInterpolatorSettings->getLagrangeBoundaryHandling( ),
                             interpolatorSettings->getBoundaryHandling( ).at( 0 ), defaultExtrapolationValue );
@@ -515,7 +517,7 @@ createOneDimensionalInterpolator(
             {
                 createdInterpolator = std::make_shared< LagrangeInterpolator
                         < IndependentVariableType, DependentVariableType, long double > >(
-                            dataToInterpolate, lagrangeInterpolatorSettings->getInterpolatorOrder( ),
+                            independentValues, dependentValues, lagrangeInterpolatorSettings->getInterpolatorOrder( ),
                             interpolatorSettings->getSelectedLookupScheme( ),
                             lagrangeInterpolatorSettings->getLagrangeBoundaryHandling( ),
                             interpolatorSettings->getBoundaryHandling( ).at( 0 ), defaultExtrapolationValue );
@@ -530,24 +532,32 @@ createOneDimensionalInterpolator(
     }
     case hermite_spline_interpolator:
     {
-        if( firstDerivativeOfDependentVariables.size( ) != dataToInterpolate.size( ) )
+        if( firstDerivativeOfDependentVariables.size( ) != dependentValues.size( ) )
         {
             throw std::runtime_error(
                         "Error when creating hermite spline interpolator, derivative size is inconsistent" );
         }
         createdInterpolator = std::make_shared< HermiteCubicSplineInterpolator
                 < IndependentVariableType, DependentVariableType > >(
-                    dataToInterpolate, firstDerivativeOfDependentVariables,
+                    independentValues, dependentValues, firstDerivativeOfDependentVariables,
                     interpolatorSettings->getSelectedLookupScheme( ),
                     interpolatorSettings->getBoundaryHandling( ).at( 0 ), defaultExtrapolationValue );
         break;
     }
     case piecewise_constant_interpolator:
+    {
+        // Piecewise constant interpolator is only created from map
+        std::map< IndependentVariableType, DependentVariableType > dataToInterpolate;
+        for( unsigned int i = 0; i < independentValues.size( ) && i < dependentValues.size( ); i++ )
+        {
+            dataToInterpolate[ independentValues.at( i ) ] = dependentValues.at( i );
+        }
         createdInterpolator = std::make_shared< PiecewiseConstantInterpolator
                 < IndependentVariableType, DependentVariableType > >(
                     dataToInterpolate, interpolatorSettings->getSelectedLookupScheme( ),
                     interpolatorSettings->getBoundaryHandling( ).at( 0 ), defaultExtrapolationValue );
         break;
+    }
     default:
         throw std::runtime_error( "Error when making interpolator, function cannot be used to create interplator of type " +
                                   std::to_string( interpolatorSettings->getInterpolatorType( ) ) );
@@ -555,6 +565,47 @@ createOneDimensionalInterpolator(
     return createdInterpolator;
 }
 
+//! Function to create a one-dimensional interpolator
+/*!
+ *  Function to create a one-dimensional interpolator from the data that is to be interpolated,
+ *  as well as the settings that are to be used to create the interpolator.
+ *  \param dataToInterpolate Map providing data that is to be interpolated (key = independent
+ *      variables, value = dependent variables).
+ *  \param interpolatorSettings Settings that are to be used to create interpolator.
+ *  \param defaultExtrapolationValue Pair of default values to be used for extrapolation, in case
+        of use_default_value or use_default_value_with_warning as methods for boundaryHandling.
+ *  \param firstDerivativeOfDependentVariables First derivative of dependent variables w.r.t. independent variable at
+ *      independent variables values in values of dataToInterpolate. By default, this vector is empty, it only needs to
+ *      be supplied if the selected interpolator requires this data (e.g. Hermite spline).
+ *  \return Interpolator created from dataToInterpolate using interpolatorSettings.
+ */
+template< typename IndependentVariableType, typename DependentVariableType >
+std::shared_ptr< OneDimensionalInterpolator< IndependentVariableType, DependentVariableType > >
+createOneDimensionalInterpolator(
+        const std::map< IndependentVariableType, DependentVariableType > dataToInterpolate,
+        const std::shared_ptr< InterpolatorSettings > interpolatorSettings,
+        const std::pair< DependentVariableType, DependentVariableType >& defaultExtrapolationValue =
+        std::make_pair( IdentityElement::getAdditionIdentity< DependentVariableType >( ),
+                        IdentityElement::getAdditionIdentity< DependentVariableType >( ) ),
+        const std::vector< DependentVariableType > firstDerivativeOfDependentVariables =
+        std::vector< DependentVariableType >( ) )
+{
+    std::vector< IndependentVariableType > independentValues;
+    std::vector< DependentVariableType > dependentValues;
+    independentValues.reserve( dataToInterpolate.size( ) );
+    dependentValues.reserve( dataToInterpolate.size( ) );
+    for( typename std::map< IndependentVariableType, DependentVariableType >::const_iterator
+         dataIterator = dataToInterpolate.begin( ); dataIterator != dataToInterpolate.end( ); dataIterator++ )
+    {
+        independentValues.push_back( dataIterator->first );
+        dependentValues.push_back( dataIterator->second );
+    }
+
+    return createOneDimensionalInterpolator(
+                independentValues, dependentValues, interpolatorSettings, defaultExtrapolationValue,
+                firstDerivativeOfDependentVariables );
+}
+
 //! Function to create an interpolator from DataInterpolationSettings
 /*!
  *  Function to create an interpolator from DataInterpolationSettings
@@ -0,0 +1,224 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+
+#include "Tudat/Mathematics/Interpolators/matrixHistoryLagrangeInterpolator.h"
+
+namespace tudat
+{
+
+namespace interpolators
+{
+
+//! Constructor from vectors of independent/dependent data.
+MatrixHistoryLagrangeInterpolator::MatrixHistoryLagrangeInterpolator(
+        const std::vector< double >& independentVariables,
+        const std::vector< Eigen::MatrixXd >& dependentVariables,
+        const int numberOfStages ):
+    OneDimensionalInterpolator< double, Eigen::MatrixXd >( extrapolate_at_boundary ),
+    numberOfStages_( numberOfStages )
+{
+    if( dependentVariables.size( ) != independentVariables.size( ) )
+    {
+        throw std::runtime_error(
+                    "Error: indep. and dep. variables incompatible in matrix history Lagrange interpolator." );
+    }
+
+    independentValues_ = independentVariables;
+    if( !std::is_sorted( independentValues_.begin( ), independentValues_.end( ) ) )
+    {
+        throw std::runtime_error(
+                    "Error: independent variables not sorted in matrix history Lagrange interpolator." );
+    }
+
+    initializeInterpolator( dependentVariables );
+}
+
+//! Constructor from map of independent/dependent data.
+MatrixHistoryLagrangeInterpolator::MatrixHistoryLagrangeInterpolator(
+        const std::map< double, Eigen::MatrixXd >& dataMap,
+        const int numberOfStages ):
+    OneDimensionalInterpolator< double, Eigen::MatrixXd >( extrapolate_at_boundary ),
+    numberOfStages_( numberOfStages )
+{
+    std::vector< Eigen::MatrixXd > dependentVariables;
+    dependentVariables.reserve( dataMap.size( ) );
+    independentValues_.reserve( dataMap.size( ) );
+    for( auto mapIterator = dataMap.begin( ); mapIterator != dataMap.end( ); mapIterator++ )
+    {
+        independentValues_.push_back( mapIterator->first );
+        dependentVariables.push_back( mapIterator->second );
+    }
+
+    initializeInterpolator( dependentVariables );
+}
+
+//! Function to interpolate the matrix at a given independent variable value.
+Eigen::MatrixXd MatrixHistoryLagrangeInterpolator::interpolate( const double targetIndependentVariableValue )
+{
+    Eigen::MatrixXd interpolatedMatrix( numberOfRows_, numberOfColumns_ );
+    interpolate( targetIndependentVariableValue, interpolatedMatrix );
+    return interpolatedMatrix;
+}
+
+//! Function to interpolate the matrix at a given independent variable value, into caller-provided storage.
+void MatrixHistoryLagrangeInterpolator::interpolate( const double targetIndependentVariableValue,
+                                                     Eigen::Ref< Eigen::MatrixXd > interpolatedMatrix ) const
+{
+    // Find nearest lower data point (stateless, so that function may be called concurrently).
+    const int lowerEntry = static_cast< int >(
+                std::distance( independentValues_.begin( ),
+                               std::upper_bound( independentValues_.begin( ), independentValues_.end( ),
+                                                 targetIndependentVariableValue ) ) ) - 1;
+
+    interpolateFromStencil( targetIndependentVariableValue, getStencilStartIndex( lowerEntry ), interpolatedMatrix );
+}
+
+//! Function to interpolate the matrix at a sorted list of independent variable values.
+void MatrixHistoryLagrangeInterpolator::interpolateAtSortedValues(
+        const std::vector< double >& targetIndependentVariableValues,
+        std::vector< Eigen::MatrixXd >& interpolatedMatrices ) const
+{
+    interpolatedMatrices.resize( targetIndependentVariableValues.size( ) );
+    for( unsigned int i = 0; i < interpolatedMatrices.size( ); i++ )
+    {
+        if( interpolatedMatrices[ i ].rows( ) != numberOfRows_ || interpolatedMatrices[ i ].cols( ) != numberOfColumns_ )
+        {
+            interpolatedMatrices[ i ].resize( numberOfRows_, numberOfColumns_ );
+        }
+    }
+
+    interpolateAtSortedValues( targetIndependentVariableValues, [ & ]( const int i )
+    {
+        return Eigen::Ref< Eigen::MatrixXd >( interpolatedMatrices[ i ] );
+    } );
+}
+
+//! Function (called by constructor) to store the matrices, and pre-compute the inverse denominators of all stencils.
+void MatrixHistoryLagrangeInterpolator::initializeInterpolator( const std::vector< Eigen::MatrixXd >& dependentVariables )
+{
+    numberOfIndependentValues_ = static_cast< int >( independentValues_.size( ) );
+
+    // Check input consistency.
+    if( numberOfStages_ % 2 != 0 || numberOfStages_ < 2 )
+    {
+        throw std::runtime_error(
+                    "Error: matrix history Lagrange interpolator currently only handles even positive orders." );
+    }
+    if( numberOfStages_ > maximumNumberOfStages )
+    {
+        throw std::runtime_error(
+                    "Error: matrix history Lagrange interpolator supports at most " +
+                    std::to_string( maximumNumberOfStages ) + " stages." );
+    }
+    if( numberOfIndependentValues_ < numberOfStages_ )
+    {
+        throw std::runtime_error(
+                    "Error: insufficient number of data points for matrix history Lagrange interpolator." );
+    }
+
+    // Store matrices contiguously.
+    numberOfRows_ = static_cast< int >( dependentVariables.at( 0 ).rows( ) );
+    numberOfColumns_ = static_cast< int >( dependentVariables.at( 0 ).cols( ) );
+    const int matrixSize = numberOfRows_ * numberOfColumns_;
+    matrixHistory_.resize( static_cast< std::size_t >( matrixSize ) * numberOfIndependentValues_ );
+    for( int i = 0; i < numberOfIndependentValues_; i++ )
+    {
+        if( dependentVariables.at( i ).rows( ) != numberOfRows_ || dependentVariables.at( i ).cols( ) != numberOfColumns_ )
+        {
+            throw std::runtime_error(
+                        "Error: inconsistent matrix sizes in matrix history Lagrange interpolator." );
+        }
+        Eigen::Map< Eigen::MatrixXd >(
+                    matrixHistory_.data( ) + static_cast< std::size_t >( matrixSize ) * i,
+                    numberOfRows_, numberOfColumns_ ) = dependentVariables.at( i );
+    }
+
+    // Pre-compute inverse denominators of Lagrange polynomials for each stencil.
+    const int numberOfStencils = numberOfIndependentValues_ - numberOfStages_ + 1;
+    inverseDenominators_.resize( numberOfStencils * numberOfStages_ );
+    for( int i = 0; i < numberOfStencils; i++ )
+    {
+        for( int j = 0; j < numberOfStages_; j++ )
+        {
+            double denominator = 1.0;
+            for( int k = 0; k < numberOfStages_; k++ )
+            {
+                if( k != j )
+                {
+                    denominator *= ( independentValues_[ i + j ] - independentValues_[ i + k ] );
+                }
+            }
+
+            if( denominator == 0.0 )
+            {
+                throw std::runtime_error(
+                            "Error: duplicate independent variables in matrix history Lagrange interpolator." );
+            }
+            inverseDenominators_[ i * numberOfStages_ + j ] = 1.0 / denominator;
+        }
+    }
+
+    // Create lookup scheme, for consistency with other interpolators (not used internally).
+    makeLookupScheme( binarySearch );
+}
+
+//! Function to interpolate the matrix using a given stencil.
+void MatrixHistoryLagrangeInterpolator::interpolateFromStencil(
+        const double targetIndependentVariableValue,
+        const int stencilStartIndex,
+        Eigen::Ref< Eigen::MatrixXd > interpolatedMatrix ) const
+{
+    if( interpolatedMatrix.rows( ) != numberOfRows_ || interpolatedMatrix.cols( ) != numberOfColumns_ )
+    {
+        throw std::runtime_error(
+                    "Error: output matrix of incorrect size in matrix history Lagrange interpolator." );
+    }
+
+    // Compute Lagrange weights, using products of differences to the left and right of each node (no divisions
+    // other than the pre-computed ones, and exact at the nodes).
+    LagrangeWeights lagrangeWeights( numberOfStages_ );
+    const double* stencilTimes = independentValues_.data( ) + stencilStartIndex;
+    const double* stencilInverseDenominators = inverseDenominators_.data( ) + stencilStartIndex * numberOfStages_;
+
+    double leftProduct = 1.0;
+    for( int j = 0; j < numberOfStages_; j++ )
+    {
+        lagrangeWeights( j ) = leftProduct;
+        leftProduct *= ( targetIndependentVariableValue - stencilTimes[ j ] );
+    }
+    double rightProduct = 1.0;
+    for( int j = numberOfStages_ - 1; j >= 0; j-- )
+    {
+        lagrangeWeights( j ) *= rightProduct * stencilInverseDenominators[ j ];
+        rightProduct *= ( targetIndependentVariableValue - stencilTimes[ j ] );
+    }
+
+    // Compute weighted sum of stencil matrices, one column at a time. Each column of the stencil is a
+    // (numberOfRows_ x numberOfStages_) matrix with stride equal to the matrix size, multiplied by the weights.
+    const int matrixSize = numberOfRows_ * numberOfColumns_;
+    const double* stencilData = matrixHistory_.data( ) + static_cast< std::size_t >( matrixSize ) * stencilStartIndex;
+    for( int k = 0; k < numberOfColumns_; k++ )
+    {
+        Eigen::Map< const Eigen::MatrixXd, 0, Eigen::OuterStride< > > stencilColumns(
+                    stencilData + k * numberOfRows_, numberOfRows_, numberOfStages_,
+                    Eigen::OuterStride< >( matrixSize ) );
+        interpolatedMatrix.col( k ).noalias( ) = stencilColumns * lagrangeWeights;
+    }
+}
+
+} // namespace interpolators
+
+} // namespace tudat
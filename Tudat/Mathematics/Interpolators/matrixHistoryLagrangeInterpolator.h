@@ -0,0 +1,247 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      http://mathworld.wolfram.com/LagrangeInterpolatingPolynomial.html
+ *
+ */
+
+#ifndef TUDAT_MATRIX_HISTORY_LAGRANGE_INTERPOLATOR_H
+#define TUDAT_MATRIX_HISTORY_LAGRANGE_INTERPOLATOR_H
+
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "Tudat/Mathematics/Interpolators/oneDimensionalInterpolator.h"
+
+namespace tudat
+{
+
+namespace interpolators
+{
+
+//! Class to perform Lagrange interpolation of a history of equally sized matrices, without dynamic memory allocation.
+/*!
+ *  Class to perform Lagrange interpolation of a history of equally sized matrices (e.g. state transition and
+ *  sensitivity matrices), optimized for large matrices and many evaluations. All matrices are stored in a single
+ *  contiguous array (each matrix contiguous, in column-major order), so that the interpolated matrix is computed as a
+ *  single matrix-vector product of the matrices of the interpolation stencil with the Lagrange weights, which is
+ *  vectorized over the matrix entries. The interpolated matrix can be written to caller-provided storage (including a
+ *  block of a larger matrix), so that no memory is allocated, and a sorted list of times can be processed in a single
+ *  pass over the history.
+ *  The stencil of numberOfStages data points is centered on the interval containing the requested time. Near the
+ *  edges of the history, the stencil is shifted so that it remains inside the history (rather than using a cubic spline,
+ *  as done by the LagrangeInterpolator class), and outside the history the polynomial of the first/last stencil is
+ *  extrapolated.
+ *  None of the interpolation functions modify the object, so that it may be used concurrently from multiple threads.
+ *  Note that the matrices are not stored in the dependentValues_ member of the base class.
+ */
+class MatrixHistoryLagrangeInterpolator: public OneDimensionalInterpolator< double, Eigen::MatrixXd >
+{
+public:
+
+    using OneDimensionalInterpolator< double, Eigen::MatrixXd >::interpolate;
+
+    //! Constructor from vectors of independent/dependent data.
+    /*!
+     *  Constructor from vectors of independent/dependent data.
+     *  \param independentVariables Vector of values of independent variables, must be sorted in ascending order.
+     *  \param dependentVariables Vector of matrices at independent variables (all of equal size).
+     *  \param numberOfStages Number of data points that are used to calculate the interpolating polynomial (must be even,
+     *  and not larger than the number of data points).
+     */
+    MatrixHistoryLagrangeInterpolator(
+            const std::vector< double >& independentVariables,
+            const std::vector< Eigen::MatrixXd >& dependentVariables,
+            const int numberOfStages );
+
+    //! Constructor from map of independent/dependent data.
+    /*!
+     *  Constructor from map of independent/dependent data.
+     *  \param dataMap Map containing independent variables as key and matrices (all of equal size) as value.
+     *  \param numberOfStages Number of data points that are used to calculate the interpolating polynomial (must be even,
+     *  and not larger than the number of data points).
+     */
+    MatrixHistoryLagrangeInterpolator(
+            const std::map< double, Eigen::MatrixXd >& dataMap,
+            const int numberOfStages );
+
+    //! Destructor.
+    ~MatrixHistoryLagrangeInterpolator( ){ }
+
+    //! Function to interpolate the matrix at a given independent variable value.
+    /*!
+     *  Function to interpolate the matrix at a given independent variable value, returning a newly allocated matrix
+     *  (see overloaded function for an allocation-free alternative).
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation is to take place.
+     *  \return Interpolated matrix.
+     */
+    Eigen::MatrixXd interpolate( const double targetIndependentVariableValue );
+
+    //! Function to interpolate the matrix at a given independent variable value, into caller-provided storage.
+    /*!
+     *  Function to interpolate the matrix at a given independent variable value, into caller-provided storage (which may
+     *  be a block of a larger matrix). No memory is allocated by this function.
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation is to take place.
+     *  \param interpolatedMatrix Interpolated matrix (returned by reference), must be of correct size.
+     */
+    void interpolate( const double targetIndependentVariableValue,
+                      Eigen::Ref< Eigen::MatrixXd > interpolatedMatrix ) const;
+
+    //! Function to interpolate the matrix at a sorted list of independent variable values.
+    /*!
+     *  Function to interpolate the matrix at a sorted list of independent variable values, in a single pass over the
+     *  history. Matrices in the output vector that already have the correct size are overwritten without allocating
+     *  memory.
+     *  \param targetIndependentVariableValues Values of independent variable at which interpolation is to take place,
+     *  must be sorted in ascending order.
+     *  \param interpolatedMatrices Interpolated matrices (returned by reference), resized if needed.
+     */
+    void interpolateAtSortedValues( const std::vector< double >& targetIndependentVariableValues,
+                                    std::vector< Eigen::MatrixXd >& interpolatedMatrices ) const;
+
+    //! Function to interpolate the matrix at a sorted list of independent variable values, into caller-provided storage.
+    /*!
+     *  Function to interpolate the matrix at a sorted list of independent variable values, in a single pass over the
+     *  history, writing each interpolated matrix into storage provided by the caller (e.g. a block of a larger matrix).
+     *  No memory is allocated by this function.
+     *  \param targetIndependentVariableValues Values of independent variable at which interpolation is to take place,
+     *  must be sorted in ascending order.
+     *  \param getOutputMatrix Function returning the storage (as Eigen::Ref< Eigen::MatrixXd >, of correct size) into
+     *  which the interpolated matrix is to be written, as a function of the index in targetIndependentVariableValues.
+     */
+    template< typename OutputMatrixFunction >
+    void interpolateAtSortedValues( const std::vector< double >& targetIndependentVariableValues,
+                                    const OutputMatrixFunction& getOutputMatrix ) const
+    {
+        // Walk through history once, advancing the nearest lower data point with the target values.
+        int lowerEntry = -1;
+        for( unsigned int i = 0; i < targetIndependentVariableValues.size( ); i++ )
+        {
+            if( i > 0 && targetIndependentVariableValues.at( i ) < targetIndependentVariableValues.at( i - 1 ) )
+            {
+                throw std::runtime_error(
+                            "Error: target values not sorted in matrix history Lagrange interpolator." );
+            }
+
+            while( lowerEntry + 1 < numberOfIndependentValues_ &&
+                   independentValues_[ lowerEntry + 1 ] <= targetIndependentVariableValues.at( i ) )
+            {
+                lowerEntry++;
+            }
+
+            interpolateFromStencil( targetIndependentVariableValues.at( i ), getStencilStartIndex( lowerEntry ),
+                                    getOutputMatrix( i ) );
+        }
+    }
+
+    //! Function to retrieve the number of rows of the interpolated matrices.
+    /*!
+     *  Function to retrieve the number of rows of the interpolated matrices.
+     *  \return Number of rows of the interpolated matrices.
+     */
+    int getNumberOfRows( ) const
+    {
+        return numberOfRows_;
+    }
+
+    //! Function to retrieve the number of columns of the interpolated matrices.
+    /*!
+     *  Function to retrieve the number of columns of the interpolated matrices.
+     *  \return Number of columns of the interpolated matrices.
+     */
+    int getNumberOfColumns( ) const
+    {
+        return numberOfColumns_;
+    }
+
+    //! Function to retrieve the number of stages of interpolator
+    /*!
+     *  Function to retrieve the number of stages of interpolator
+     *  \return Number of stages of interpolator
+     */
+    int getNumberOfStages( ) const
+    {
+        return numberOfStages_;
+    }
+
+    //! Maximum number of stages of interpolator (so that Lagrange weights can be stored without dynamic allocation).
+    static const int maximumNumberOfStages = 16;
+
+private:
+
+    //! Typedef for vector of Lagrange weights of single interpolation stencil.
+    typedef Eigen::Matrix< double, Eigen::Dynamic, 1, 0, maximumNumberOfStages, 1 > LagrangeWeights;
+
+    //! Function (called by constructor) to store the matrices, and pre-compute the inverse denominators of all stencils.
+    /*!
+     *  Function (called by constructor) to store the matrices contiguously, and pre-compute the inverse denominators of
+     *  the Lagrange polynomials of all stencils.
+     *  \param dependentVariables Vector of matrices at independent variables.
+     */
+    void initializeInterpolator( const std::vector< Eigen::MatrixXd >& dependentVariables );
+
+    //! Function to compute the start index of the stencil for a given nearest lower data point.
+    /*!
+     *  Function to compute the start index of the stencil for a given nearest lower data point.
+     *  \param lowerEntry Index of nearest lower data point.
+     *  \return Start index of the stencil.
+     */
+    int getStencilStartIndex( const int lowerEntry ) const
+    {
+        int stencilStartIndex = lowerEntry - ( numberOfStages_ / 2 - 1 );
+        if( stencilStartIndex < 0 )
+        {
+            stencilStartIndex = 0;
+        }
+        else if( stencilStartIndex > numberOfIndependentValues_ - numberOfStages_ )
+        {
+            stencilStartIndex = numberOfIndependentValues_ - numberOfStages_;
+        }
+        return stencilStartIndex;
+    }
+
+    //! Function to interpolate the matrix using a given stencil.
+    /*!
+     *  Function to interpolate the matrix using a given stencil.
+     *  \param targetIndependentVariableValue Value of independent variable at which interpolation is to take place.
+     *  \param stencilStartIndex Start index of the stencil.
+     *  \param interpolatedMatrix Interpolated matrix (returned by reference).
+     */
+    void interpolateFromStencil( const double targetIndependentVariableValue,
+                                 const int stencilStartIndex,
+                                 Eigen::Ref< Eigen::MatrixXd > interpolatedMatrix ) const;
+
+    //! Matrices of all data points, each stored contiguously in column-major order.
+    std::vector< double > matrixHistory_;
+
+    //! Inverse denominators of the Lagrange polynomials, stored contiguously per stencil start index.
+    std::vector< double > inverseDenominators_;
+
+    //! Number of rows of the interpolated matrices.
+    int numberOfRows_;
+
+    //! Number of columns of the interpolated matrices.
+    int numberOfColumns_;
+
+    //! Number of data points used to calculate the interpolating polynomial.
+    int numberOfStages_;
+
+    //! Number of data points.
+    int numberOfIndependentValues_;
+};
+
+} // namespace interpolators
+
+} // namespace tudat
+
+#endif // TUDAT_MATRIX_HISTORY_LAGRANGE_INTERPOLATOR_H
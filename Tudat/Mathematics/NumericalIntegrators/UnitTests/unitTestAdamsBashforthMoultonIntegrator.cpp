@@ -25,6 +25,8 @@
 
 #include <limits>
 #include <cmath>
+#include <sstream>
+#include <stdexcept>
 
 #include <Eigen/Core>
 
@@ -164,6 +166,241 @@ BOOST_AUTO_TEST_CASE( test_AdamsBashforthMoulton_Integrator_Compare78_VanDerPol
     BOOST_CHECK_SMALL( std::fabs( difference( 1 ) ), 5E-12 );
 }
 
+//! Compute van der Pol state derivative, with the state stored as a 1x2 matrix.
+Eigen::MatrixXd computeVanDerPolMatrixStateDerivative( const double time, const Eigen::MatrixXd& state )
+{
+    Eigen::VectorXd vectorState = Eigen::Map< const Eigen::VectorXd >( state.data( ), state.size( ) );
+    Eigen::VectorXd vectorStateDerivative = computeVanDerPolStateDerivative( time, vectorState );
+    return Eigen::Map< const Eigen::MatrixXd >( vectorStateDerivative.data( ), state.rows( ), state.cols( ) );
+}
+
+//! Test whether results are independent of the shape of the state (which is stored as a column in the history).
+BOOST_AUTO_TEST_CASE( test_AdamsBashforthMoulton_Integrator_MatrixState )
+{
+    double minimumStepSize = 0.001;
+    double maximumStepSize = std::numeric_limits< double >::infinity( );
+    double relativeTolerance = 1E-12;
+    double absoluteTolerance = 1E-12;
+
+    // Initial conditions
+    double initialTime = 0.2;
+    Eigen::VectorXd initialState( 2 );
+    initialState << -1.0, 1.0;
+    Eigen::MatrixXd initialMatrixState = initialState.transpose( );
+
+    AdamsBashforthMoultonIntegratorXd vectorIntegrator(
+                computeVanDerPolStateDerivative, initialTime, initialState,
+                minimumStepSize, maximumStepSize, relativeTolerance, absoluteTolerance );
+    AdamsBashforthMoultonIntegrator< double, Eigen::MatrixXd, Eigen::MatrixXd > matrixIntegrator(
+                computeVanDerPolMatrixStateDerivative, initialTime, initialMatrixState,
+                minimumStepSize, maximumStepSize, relativeTolerance, absoluteTolerance );
+
+    double endTime = 1.4;
+    Eigen::VectorXd vectorSolution = vectorIntegrator.integrateTo( endTime, 1.0 );
+    Eigen::MatrixXd matrixSolution = matrixIntegrator.integrateTo( endTime, 1.0 );
+
+    BOOST_CHECK_EQUAL( matrixSolution.rows( ), 1 );
+    BOOST_CHECK_EQUAL( matrixSolution.cols( ), 2 );
+    for( int i = 0; i < 2; i++ )
+    {
+        BOOST_CHECK_SMALL( std::fabs( vectorSolution( i ) - matrixSolution( 0, i ) ), 1E-15 );
+    }
+}
+
+//! Test rollback to previous state, and subsequent continuation of the integration.
+BOOST_AUTO_TEST_CASE( test_AdamsBashforthMoulton_Integrator_Rollback )
+{
+    double minimumStepSize = 0.001;
+    double maximumStepSize = std::numeric_limits< double >::infinity( );
+    double relativeTolerance = 1E-12;
+    double absoluteTolerance = 1E-12;
+
+    // Initial conditions
+    double initialTime = 0.2;
+    Eigen::VectorXd initialState( 2 );
+    initialState << -1.0, 1.0;
+
+    AdamsBashforthMoultonIntegratorXd integrator(
+                computeVanDerPolStateDerivative, initialTime, initialState,
+                minimumStepSize, maximumStepSize, relativeTolerance, absoluteTolerance );
+
+    // Take sufficient steps to start using the multi-step method.
+    integrator.setStepSize( 0.01 );
+    for( unsigned int i = 0; i < 20; i++ )
+    {
+        integrator.performIntegrationStep( );
+    }
+
+    // Take step, and check previous state.
+    double previousTime = integrator.getCurrentIndependentVariable( );
+    Eigen::VectorXd previousState = integrator.getCurrentState( );
+    Eigen::VectorXd previousDerivative = integrator.getLastDerivative( );
+    Eigen::VectorXd nextState = integrator.performIntegrationStep( );
+    double nextTime = integrator.getCurrentIndependentVariable( );
+    BOOST_CHECK_EQUAL( integrator.getPreviousIndependentVariable( ), previousTime );
+    BOOST_CHECK_EQUAL( ( integrator.getPreviousState( ) - previousState ).norm( ), 0.0 );
+
+    // Roll back step, and check that state and derivative are restored.
+    BOOST_CHECK( integrator.rollbackToPreviousState( ) );
+    BOOST_CHECK_EQUAL( integrator.getCurrentIndependentVariable( ), previousTime );
+    BOOST_CHECK_EQUAL( ( integrator.getCurrentState( ) - previousState ).norm( ), 0.0 );
+    BOOST_CHECK_EQUAL( ( integrator.getLastDerivative( ) - previousDerivative ).norm( ), 0.0 );
+    BOOST_CHECK( !integrator.rollbackToPreviousState( ) );
+
+    // Retake step, and check that result is unchanged.
+    Eigen::VectorXd recomputedNextState = integrator.performIntegrationStep( );
+    BOOST_CHECK_EQUAL( integrator.getCurrentIndependentVariable( ), nextTime );
+    BOOST_CHECK_EQUAL( ( recomputedNextState - nextState ).norm( ), 0.0 );
+}
+
+//! Test restart of the integrator after the step size is changed externally, while the order is above its minimum.
+BOOST_AUTO_TEST_CASE( test_AdamsBashforthMoulton_Integrator_RestartAfterStepSizeChange )
+{
+    // Circular orbit with unit gravitational parameter and radius.
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > stateDerivativeFunction =
+            [ ]( const double, const Eigen::VectorXd& state )
+    {
+        Eigen::VectorXd stateDerivative( 4 );
+        stateDerivative.segment( 0, 2 ) = state.segment( 2, 2 );
+        stateDerivative.segment( 2, 2 ) = -state.segment( 0, 2 ) / std::pow( state.segment( 0, 2 ).norm( ), 3 );
+        return stateDerivative;
+    };
+    Eigen::VectorXd initialState( 4 );
+    initialState << 1.0, 0.0, 0.0, 1.0;
+
+    AdamsBashforthMoultonIntegratorXd integrator(
+                stateDerivativeFunction, 0.0, initialState, 1.0E-6, 10.0, 1.0E-10, 1.0E-10 );
+
+    // Take steps with the step size selected by the integrator, to increase the order.
+    double stepSize = 0.01;
+    for( unsigned int i = 0; i < 30; i++ )
+    {
+        integrator.performIntegrationStep( stepSize );
+        stepSize = integrator.getNextStepSize( );
+    }
+
+    // Impose a different step size, forcing a restart from single steps, and continue with the step size selected by
+    // the integrator.
+    stepSize = 0.04;
+    for( unsigned int i = 0; i < 14; i++ )
+    {
+        Eigen::VectorXd currentState = integrator.performIntegrationStep( stepSize );
+        stepSize = integrator.getNextStepSize( );
+        double currentTime = integrator.getCurrentIndependentVariable( );
+        Eigen::VectorXd expectedState( 4 );
+        expectedState << std::cos( currentTime ), std::sin( currentTime ),
+                -std::sin( currentTime ), std::cos( currentTime );
+        BOOST_CHECK_SMALL( ( currentState - expectedState ).cwiseAbs( ).maxCoeff( ), 1.0E-9 );
+    }
+}
+
+//! Test whether integration can be resumed, with identical results, from the integrator state written to a stream.
+BOOST_AUTO_TEST_CASE( test_AdamsBashforthMoulton_Integrator_ResumeFromStoredState )
+{
+    // Circular orbit with unit gravitational parameter and radius.
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > stateDerivativeFunction =
+            [ ]( const double, const Eigen::VectorXd& state )
+    {
+        Eigen::VectorXd stateDerivative( 4 );
+        stateDerivative.segment( 0, 2 ) = state.segment( 2, 2 );
+        stateDerivative.segment( 2, 2 ) = -state.segment( 0, 2 ) / std::pow( state.segment( 0, 2 ).norm( ), 3 );
+        return stateDerivative;
+    };
+    Eigen::VectorXd initialState( 4 );
+    initialState << 1.0, 0.0, 0.0, 1.0;
+
+    AdamsBashforthMoultonIntegratorXd integrator(
+                stateDerivativeFunction, 0.0, initialState, 1.0E-6, 10.0, 1.0E-10, 1.0E-10 );
+
+    // Take steps until order is increased, and store integrator state.
+    double stepSize = 0.01;
+    for( unsigned int i = 0; i < 30; i++ )
+    {
+        integrator.performIntegrationStep( stepSize );
+        stepSize = integrator.getNextStepSize( );
+    }
+    std::ostringstream integratorStateStream;
+    integrator.writeStateToBinaryStream( integratorStateStream );
+
+    // Restore state in new integrator (created with different initial conditions), and compare subsequent steps.
+    AdamsBashforthMoultonIntegratorXd resumedIntegrator(
+                stateDerivativeFunction, 0.0, 2.0 * initialState, 1.0E-6, 10.0, 1.0E-10, 1.0E-10 );
+    std::istringstream inputStream( integratorStateStream.str( ) );
+    resumedIntegrator.readStateFromBinaryStream( inputStream );
+    BOOST_CHECK_EQUAL( resumedIntegrator.getOrder( ), integrator.getOrder( ) );
+    BOOST_CHECK_EQUAL( resumedIntegrator.getNextStepSize( ), integrator.getNextStepSize( ) );
+
+    double resumedStepSize = stepSize;
+    for( unsigned int i = 0; i < 20; i++ )
+    {
+        Eigen::VectorXd currentState = integrator.performIntegrationStep( stepSize );
+        Eigen::VectorXd resumedState = resumedIntegrator.performIntegrationStep( resumedStepSize );
+        stepSize = integrator.getNextStepSize( );
+        resumedStepSize = resumedIntegrator.getNextStepSize( );
+
+        BOOST_CHECK_EQUAL( resumedIntegrator.getCurrentIndependentVariable( ),
+                           integrator.getCurrentIndependentVariable( ) );
+        BOOST_CHECK_EQUAL( resumedStepSize, stepSize );
+        for( int j = 0; j < 4; j++ )
+        {
+            BOOST_CHECK_EQUAL( resumedState( j ), currentState( j ) );
+        }
+    }
+
+    // Check that state of incompatible integrator is rejected.
+    AdamsBashforthMoultonIntegratorXd incompatibleIntegrator(
+                stateDerivativeFunction, 0.0, Eigen::VectorXd::Zero( 6 ), 1.0E-6, 10.0, 1.0E-10, 1.0E-10 );
+    std::istringstream incompatibleInputStream( integratorStateStream.str( ) );
+    BOOST_CHECK_THROW( incompatibleIntegrator.readStateFromBinaryStream( incompatibleInputStream ), std::runtime_error );
+}
+
+//! Test circular buffer used to store integrator history.
+BOOST_AUTO_TEST_CASE( test_MultistepHistoryBuffer )
+{
+    MultistepHistoryBuffer< double > historyBuffer( 2, 4 );
+
+    // Add more entries than fit in the buffer, with entry i equal to ( i, -i ).
+    for( int i = 0; i < 6; i++ )
+    {
+        historyBuffer.pushFront( );
+        historyBuffer.setSegment( 0, 0, Eigen::Vector2d( i, -i ) );
+    }
+    BOOST_CHECK_EQUAL( historyBuffer.getSize( ), 4 );
+    for( int i = 0; i < 4; i++ )
+    {
+        BOOST_CHECK_EQUAL( historyBuffer.getSegment( i, 0, 1 )( 0 ), 5 - i );
+        BOOST_CHECK_EQUAL( historyBuffer.getSegment( i, 1, 1 )( 0 ), i - 5 );
+    }
+
+    // Check range of entries, with and without stride, across the boundary of the buffer.
+    Eigen::MatrixXd range = historyBuffer.getRange( 0, 4, 1, 1, 1 );
+    Eigen::MatrixXd stridedRange = historyBuffer.getRange( 1, 2, 2, 0, 2 );
+    for( int i = 0; i < 4; i++ )
+    {
+        BOOST_CHECK_EQUAL( range( 0, i ), i - 5 );
+    }
+    for( int i = 0; i < 2; i++ )
+    {
+        BOOST_CHECK_EQUAL( stridedRange( 0, i ), 4 - 2 * i );
+        BOOST_CHECK_EQUAL( stridedRange( 1, i ), 2 * i - 4 );
+    }
+
+    // Check copying, truncating and restoring entries.
+    int head = historyBuffer.getHead( );
+    historyBuffer.copyEntry( 3, 0 );
+    BOOST_CHECK_EQUAL( historyBuffer.getRange( 0, 1, 1, 0, 1 )( 0, 0 ), 2 );
+    historyBuffer.truncate( 2 );
+    historyBuffer.pushFront( );
+    BOOST_CHECK_EQUAL( historyBuffer.getSize( ), 3 );
+    historyBuffer.restoreLayout( head, 4 );
+    BOOST_CHECK_EQUAL( historyBuffer.getSegment( 0, 0, 1 )( 0 ), 2 );
+    BOOST_CHECK_EQUAL( historyBuffer.getSegment( 1, 0, 1 )( 0 ), 4 );
+    BOOST_CHECK_EQUAL( historyBuffer.getSegment( 3, 0, 1 )( 0 ), 2 );
+
+    BOOST_CHECK_THROW( historyBuffer.pushBack( ), std::runtime_error );
+    BOOST_CHECK_THROW( historyBuffer.resize( 5 ), std::runtime_error );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
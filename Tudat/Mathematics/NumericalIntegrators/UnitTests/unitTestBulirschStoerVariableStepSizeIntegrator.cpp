@@ -25,12 +25,15 @@
 
 #include <limits>
 #include <cmath>
+#include <functional>
+#include <vector>
 
 #include <Eigen/Core>
 
 #include <boost/test/unit_test.hpp>
 
 #include "Tudat/Mathematics/NumericalIntegrators/bulirschStoerVariableStepsizeIntegrator.h"
+#include "Tudat/Mathematics/NumericalIntegrators/createNumericalIntegrator.h"
 #include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaVariableStepSizeIntegrator.h"
 #include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaCoefficients.h"
 #include "Tudat/Mathematics/NumericalIntegrators/UnitTests/numericalIntegratorTestFunctions.h"
@@ -167,6 +170,160 @@ BOOST_AUTO_TEST_CASE( test_BulirschStoer_Integrator_Compare78_VanDerPol )
     BOOST_CHECK_SMALL( std::fabs( difference( 1 ) ), 5E-12 );
 }
 
+//! Test whether parallel evaluation of the extrapolation sequence reproduces the sequential result.
+BOOST_AUTO_TEST_CASE( test_BulirschStoer_Integrator_ParallelSequenceEvaluation )
+{
+    // Initial conditions
+    double initialTime = 0.2;
+    Eigen::VectorXd initialState( 2 );
+    initialState << -1.0, 1.0;
+
+    // Create state derivative functions that count their number of evaluations, and store the time at which they were
+    // last evaluated, one for each thread.
+    const unsigned int numberOfThreads = 4;
+    std::vector< int > numberOfEvaluations( numberOfThreads + 1, 0 );
+    std::vector< double > lastEvaluationTimes( numberOfThreads + 1, TUDAT_NAN );
+    std::vector< std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > > stateDerivativeFunctions;
+    for( unsigned int i = 0; i < numberOfThreads + 1; i++ )
+    {
+        stateDerivativeFunctions.push_back(
+                    [ &numberOfEvaluations, &lastEvaluationTimes, i ]( const double time, const Eigen::VectorXd& state )
+        {
+            numberOfEvaluations[ i ]++;
+            lastEvaluationTimes[ i ] = time;
+            return computeVanDerPolStateDerivative( time, state );
+        } );
+    }
+
+    // Create sequential integrator (function 0) and parallel integrator (functions 1 to 4).
+    BulirschStoerVariableStepSizeIntegratorXd sequentialIntegrator(
+                getBulirschStoerStepSequence( bulirsch_stoer_sequence, 8 ),
+                stateDerivativeFunctions.at( 0 ), initialTime, initialState,
+                std::numeric_limits< double >::epsilon( ), std::numeric_limits< double >::infinity( ), 1.0E-14, 1.0E-14 );
+    BulirschStoerVariableStepSizeIntegratorXd parallelIntegrator(
+                getBulirschStoerStepSequence( bulirsch_stoer_sequence, 8 ),
+                stateDerivativeFunctions.at( 1 ), initialTime, initialState,
+                std::numeric_limits< double >::epsilon( ), std::numeric_limits< double >::infinity( ), 1.0E-14, 1.0E-14 );
+    parallelIntegrator.setAdditionalStateDerivativeFunctions(
+                std::vector< std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > >(
+                    stateDerivativeFunctions.begin( ) + 2, stateDerivativeFunctions.end( ) ) );
+    BOOST_CHECK_EQUAL( sequentialIntegrator.getNumberOfThreads( ), 1 );
+    BOOST_CHECK_EQUAL( parallelIntegrator.getNumberOfThreads( ), numberOfThreads );
+
+    // Check that all steps (including rejected ones) are identical.
+    double stepSize = 0.1;
+    for( unsigned int i = 0; i < 20; i++ )
+    {
+        Eigen::VectorXd sequentialState = sequentialIntegrator.performIntegrationStep( stepSize );
+        Eigen::VectorXd parallelState = parallelIntegrator.performIntegrationStep( stepSize );
+
+        BOOST_CHECK_EQUAL( sequentialIntegrator.getCurrentIndependentVariable( ),
+                           parallelIntegrator.getCurrentIndependentVariable( ) );
+        BOOST_CHECK_EQUAL( ( sequentialState - parallelState ).cwiseAbs( ).maxCoeff( ), 0.0 );
+        BOOST_CHECK_EQUAL( sequentialIntegrator.getNextStepSize( ), parallelIntegrator.getNextStepSize( ) );
+        BOOST_CHECK_EQUAL( lastEvaluationTimes.at( 0 ), lastEvaluationTimes.at( 1 ) );
+        stepSize = sequentialIntegrator.getNextStepSize( );
+    }
+
+    // Check that the same number of evaluations is performed (the distribution over the threads depends on scheduling).
+    int numberOfParallelEvaluations = 0;
+    for( unsigned int i = 1; i < numberOfThreads + 1; i++ )
+    {
+        numberOfParallelEvaluations += numberOfEvaluations.at( i );
+    }
+    BOOST_CHECK_EQUAL( numberOfEvaluations.at( 0 ), numberOfParallelEvaluations );
+
+    // Check that sequential evaluation is restored.
+    parallelIntegrator.setAdditionalStateDerivativeFunctions(
+                std::vector< std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > >( ) );
+    BOOST_CHECK_EQUAL( parallelIntegrator.getNumberOfThreads( ), 1 );
+    for( unsigned int i = 1; i < numberOfThreads + 1; i++ )
+    {
+        numberOfEvaluations[ i ] = 0;
+    }
+    sequentialIntegrator.performIntegrationStep( stepSize );
+    parallelIntegrator.performIntegrationStep( stepSize );
+    BOOST_CHECK_EQUAL( ( sequentialIntegrator.getCurrentState( ) - parallelIntegrator.getCurrentState( ) ).norm( ), 0.0 );
+    BOOST_CHECK( numberOfEvaluations.at( 1 ) > 0 );
+    for( unsigned int i = 2; i < numberOfThreads + 1; i++ )
+    {
+        BOOST_CHECK_EQUAL( numberOfEvaluations.at( i ), 0 );
+    }
+}
+
+//! Test whether parallel evaluation of the extrapolation sequence is correctly set up when creating the integrator.
+BOOST_AUTO_TEST_CASE( test_BulirschStoer_Integrator_ParallelSequenceEvaluationFromSettings )
+{
+    // Initial conditions
+    double initialTime = 0.2;
+    Eigen::VectorXd initialState( 2 );
+    initialState << -1.0, 1.0;
+
+    // Create state derivative functions that count their number of evaluations, one for each thread.
+    const unsigned int numberOfThreads = 4;
+    std::vector< int > numberOfEvaluations( numberOfThreads + 1, 0 );
+    std::vector< std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > > stateDerivativeFunctions;
+    for( unsigned int i = 0; i < numberOfThreads + 1; i++ )
+    {
+        stateDerivativeFunctions.push_back( [ &numberOfEvaluations, i ]( const double time, const Eigen::VectorXd& state )
+        {
+            numberOfEvaluations[ i ]++;
+            return computeVanDerPolStateDerivative( time, state );
+        } );
+    }
+
+    // Create integrators from settings, with sequential (function 0) and parallel (functions 1 to 4) evaluation of the
+    // extrapolation sequence.
+    std::shared_ptr< BulirschStoerIntegratorSettings< double > > integratorSettings =
+            std::make_shared< BulirschStoerIntegratorSettings< double > >(
+                initialTime, 0.1, bulirsch_stoer_sequence, 8, std::numeric_limits< double >::epsilon( ),
+                std::numeric_limits< double >::infinity( ), 1.0E-14, 1.0E-14 );
+    std::shared_ptr< NumericalIntegrator< double, Eigen::VectorXd, Eigen::VectorXd > > sequentialIntegrator =
+            createIntegrator< double, Eigen::VectorXd >(
+                stateDerivativeFunctions.at( 0 ), initialState, integratorSettings );
+    std::shared_ptr< NumericalIntegrator< double, Eigen::VectorXd, Eigen::VectorXd > > parallelIntegrator =
+            createIntegrator< double, Eigen::VectorXd >(
+                stateDerivativeFunctions.at( 1 ), initialState, integratorSettings,
+                std::vector< std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > >(
+                    stateDerivativeFunctions.begin( ) + 2, stateDerivativeFunctions.end( ) ) );
+    BOOST_CHECK_EQUAL( std::dynamic_pointer_cast< BulirschStoerVariableStepSizeIntegratorXd >(
+                           sequentialIntegrator )->getNumberOfThreads( ), 1 );
+    BOOST_CHECK_EQUAL( std::dynamic_pointer_cast< BulirschStoerVariableStepSizeIntegratorXd >(
+                           parallelIntegrator )->getNumberOfThreads( ), numberOfThreads );
+
+    sequentialIntegrator->integrateTo( 2.0, 0.1 );
+    parallelIntegrator->integrateTo( 2.0, 0.1 );
+
+    // Check that results are identical, and that the additional functions are used.
+    BOOST_CHECK_EQUAL( sequentialIntegrator->getCurrentIndependentVariable( ),
+                       parallelIntegrator->getCurrentIndependentVariable( ) );
+    BOOST_CHECK_EQUAL( ( sequentialIntegrator->getCurrentState( ) - parallelIntegrator->getCurrentState( ) ).
+                       cwiseAbs( ).maxCoeff( ), 0.0 );
+    int numberOfParallelEvaluations = 0;
+    for( unsigned int i = 1; i < numberOfThreads + 1; i++ )
+    {
+        numberOfParallelEvaluations += numberOfEvaluations.at( i );
+    }
+    BOOST_CHECK_EQUAL( numberOfEvaluations.at( 0 ), numberOfParallelEvaluations );
+    BOOST_CHECK( numberOfParallelEvaluations > numberOfEvaluations.at( 1 ) );
+
+    // Check that additional functions are rejected for other integrators.
+    bool isExceptionCaught = false;
+    try
+    {
+        createIntegrator< double, Eigen::VectorXd >(
+                    stateDerivativeFunctions.at( 0 ), initialState,
+                    std::make_shared< IntegratorSettings< double > >( rungeKutta4, initialTime, 0.1 ),
+                    std::vector< std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > >(
+                        stateDerivativeFunctions.begin( ) + 2, stateDerivativeFunctions.end( ) ) );
+    }
+    catch( std::runtime_error& )
+    {
+        isExceptionCaught = true;
+    }
+    BOOST_CHECK( isExceptionCaught );
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
 
 } // namespace unit_tests
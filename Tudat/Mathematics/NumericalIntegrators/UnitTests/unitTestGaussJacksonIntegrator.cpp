@@ -0,0 +1,358 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Hairer, E., Norsett, S.P., Wanner, G. Solving Ordinary Differential Equations I, 2nd Edition, Springer, 1993.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/utilities.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/Mathematics/NumericalIntegrators/createNumericalIntegrator.h"
+#include "Tudat/Mathematics/NumericalIntegrators/gaussJacksonIntegrator.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace numerical_integrators;
+
+//! Number of state derivative evaluations.
+int numberOfStateDerivativeEvaluations = 0;
+
+//! State derivative of one or more independent Keplerian orbits (unit gravitational parameter), for a vector or matrix
+//! state consisting of blocks of Cartesian position and velocity.
+template< typename StateType >
+StateType computeKeplerStateDerivative( const double, const StateType& state )
+{
+    numberOfStateDerivativeEvaluations++;
+
+    StateType stateDerivative( state.rows( ), state.cols( ) );
+    for( int i = 0; i < state.rows( ) / 6; i++ )
+    {
+        for( int j = 0; j < state.cols( ); j++ )
+        {
+            const Eigen::Vector3d position = state.block( 6 * i, j, 3, 1 );
+            stateDerivative.block( 6 * i, j, 3, 1 ) = state.block( 6 * i + 3, j, 3, 1 );
+            stateDerivative.block( 6 * i + 3, j, 3, 1 ) = -position / std::pow( position.norm( ), 3 );
+        }
+    }
+    return stateDerivative;
+}
+
+//! Analytical solution of circular Keplerian orbit with unit radius (and unit gravitational parameter).
+Eigen::VectorXd computeCircularOrbitState( const double time )
+{
+    Eigen::VectorXd state = Eigen::VectorXd::Zero( 6 );
+    state << std::cos( time ), std::sin( time ), 0.0, -std::sin( time ), std::cos( time ), 0.0;
+    return state;
+}
+
+//! Function to compute the maximum error in the state of a circular orbit, after one orbital period.
+double computeCircularOrbitError( const double stepSize, const unsigned int order,
+                                  const unsigned int numberOfCorrectorIterations )
+{
+    GaussJacksonIntegratorXd integrator(
+                &computeKeplerStateDerivative< Eigen::VectorXd >, 0.0, computeCircularOrbitState( 0.0 ),
+                stepSize, order, numberOfCorrectorIterations );
+    const int numberOfSteps = static_cast< int >( std::round( 2.0 * mathematical_constants::PI / stepSize ) );
+    for( int i = 0; i < numberOfSteps; i++ )
+    {
+        integrator.performIntegrationStep( stepSize );
+    }
+    return ( integrator.getCurrentState( ) - computeCircularOrbitState( integrator.getCurrentIndependentVariable( ) ) ).
+            cwiseAbs( ).maxCoeff( );
+}
+
+BOOST_AUTO_TEST_SUITE( test_gauss_jackson_integrator )
+
+//! Test the coefficients of the predictor and corrector formulas.
+BOOST_AUTO_TEST_CASE( testGaussJacksonCoefficients )
+{
+    for( unsigned int order = 2; order <= 14; order++ )
+    {
+        const GaussJacksonCoefficients coefficients = computeGaussJacksonCoefficients( order );
+        BOOST_CHECK_EQUAL( coefficients.positionPredictorCoefficients.rows( ), order + 1 );
+        BOOST_CHECK_EQUAL( coefficients.velocityCorrectorCoefficients.rows( ), order + 1 );
+
+        // For constant accelerations, only the lowest-order backward difference term is non-zero, being the first
+        // coefficient of the summed Adams-Moulton (-1/2), Adams-Bashforth (1/2), Cowell (1/12) and Stormer (1/12) forms.
+        BOOST_CHECK_SMALL( coefficients.velocityCorrectorCoefficients.sum( ) + 0.5, 1.0E-12 );
+        BOOST_CHECK_SMALL( coefficients.velocityPredictorCoefficients.sum( ) - 0.5, 1.0E-12 );
+        BOOST_CHECK_SMALL( coefficients.positionCorrectorCoefficients.sum( ) - 1.0 / 12.0, 1.0E-12 );
+        BOOST_CHECK_SMALL( coefficients.positionPredictorCoefficients.sum( ) - 1.0 / 12.0, 1.0E-12 );
+    }
+
+    // Check second-order corrector coefficients, computed by hand from the backward difference forms (Cowell
+    // coefficients 1/12, 0, -1/240 and Adams-Moulton coefficients -1/2, -1/12, -1/24).
+    const GaussJacksonCoefficients coefficients = computeGaussJacksonCoefficients( 2 );
+    Eigen::Vector3d expectedPositionCorrectorCoefficients( 19.0 / 240.0, 1.0 / 120.0, -1.0 / 240.0 );
+    Eigen::Vector3d expectedVelocityCorrectorCoefficients( -5.0 / 8.0, 1.0 / 6.0, -1.0 / 24.0 );
+    BOOST_CHECK_SMALL( ( coefficients.positionCorrectorCoefficients - expectedPositionCorrectorCoefficients ).
+                       cwiseAbs( ).maxCoeff( ), 1.0E-15 );
+    BOOST_CHECK_SMALL( ( coefficients.velocityCorrectorCoefficients - expectedVelocityCorrectorCoefficients ).
+                       cwiseAbs( ).maxCoeff( ), 1.0E-15 );
+
+    // Check unsupported orders.
+    BOOST_CHECK_THROW( computeGaussJacksonCoefficients( 1 ), std::runtime_error );
+    BOOST_CHECK_THROW( computeGaussJacksonCoefficients( 15 ), std::runtime_error );
+}
+
+//! Test accuracy and order of convergence for a circular Keplerian orbit.
+BOOST_AUTO_TEST_CASE( testGaussJacksonAccuracy )
+{
+    for( unsigned int numberOfCorrectorIterations = 1; numberOfCorrectorIterations <= 2; numberOfCorrectorIterations++ )
+    {
+        // Check order of convergence of eighth-order integrator (global error of order 9 or higher).
+        const double largeStepError = computeCircularOrbitError( 2.0 * mathematical_constants::PI / 40.0, 8,
+                                                                 numberOfCorrectorIterations );
+        const double smallStepError = computeCircularOrbitError( 2.0 * mathematical_constants::PI / 80.0, 8,
+                                                                 numberOfCorrectorIterations );
+        BOOST_CHECK_SMALL( largeStepError, 1.0E-8 );
+        BOOST_CHECK_GT( largeStepError / smallStepError, std::pow( 2.0, 9.0 ) );
+
+        // Check that lower order gives lower accuracy.
+        BOOST_CHECK_GT( computeCircularOrbitError( 2.0 * mathematical_constants::PI / 40.0, 4,
+                                                   numberOfCorrectorIterations ), 100.0 * largeStepError );
+
+        // Check that higher order gives higher accuracy (when iterating the corrector, the predict-evaluate-correct mode
+        // having a smaller stability region at high order).
+        if( numberOfCorrectorIterations > 1 )
+        {
+            BOOST_CHECK_LT( computeCircularOrbitError( 2.0 * mathematical_constants::PI / 40.0, 12,
+                                                       numberOfCorrectorIterations ), 0.01 * largeStepError );
+        }
+    }
+
+    // Check number of state derivative evaluations per step.
+    for( unsigned int numberOfCorrectorIterations = 1; numberOfCorrectorIterations <= 3; numberOfCorrectorIterations++ )
+    {
+        GaussJacksonIntegratorXd integrator(
+                    &computeKeplerStateDerivative< Eigen::VectorXd >, 0.0, computeCircularOrbitState( 0.0 ),
+                    0.05, 8, numberOfCorrectorIterations );
+        BOOST_CHECK_EQUAL( integrator.getNumberOfCorrectorIterations( ), numberOfCorrectorIterations );
+        for( int i = 0; i < 8; i++ )
+        {
+            BOOST_CHECK_EQUAL( integrator.isStartupCompleted( ), false );
+            integrator.performIntegrationStep( 0.05 );
+        }
+        BOOST_CHECK_EQUAL( integrator.isStartupCompleted( ), true );
+
+        numberOfStateDerivativeEvaluations = 0;
+        for( int i = 0; i < 100; i++ )
+        {
+            integrator.performIntegrationStep( 0.05 );
+        }
+        BOOST_CHECK_EQUAL( numberOfStateDerivativeEvaluations, 100 * static_cast< int >( numberOfCorrectorIterations ) );
+        BOOST_CHECK_SMALL( ( integrator.getCurrentState( ) - computeCircularOrbitState( 108.0 * 0.05 ) ).
+                           cwiseAbs( ).maxCoeff( ), 1.0E-11 );
+    }
+}
+
+//! Test integration of multiple bodies, matrix states, and backwards integration.
+BOOST_AUTO_TEST_CASE( testGaussJacksonStateTypes )
+{
+    const double stepSize = 0.05;
+
+    // Define states of two bodies in (different) eccentric orbits.
+    Eigen::VectorXd firstInitialState( 6 ), secondInitialState( 6 );
+    firstInitialState << 1.0, 0.0, 0.0, 0.0, 1.2, 0.1;
+    secondInitialState << 0.0, 0.8, 0.3, -1.1, 0.0, 0.2;
+    Eigen::VectorXd combinedInitialState( 12 );
+    combinedInitialState << firstInitialState, secondInitialState;
+    Eigen::MatrixXd matrixInitialState( 6, 2 );
+    matrixInitialState << firstInitialState, secondInitialState;
+
+    GaussJacksonIntegratorXd firstIntegrator(
+                &computeKeplerStateDerivative< Eigen::VectorXd >, 0.0, firstInitialState, stepSize );
+    GaussJacksonIntegratorXd secondIntegrator(
+                &computeKeplerStateDerivative< Eigen::VectorXd >, 0.0, secondInitialState, stepSize );
+    GaussJacksonIntegratorXd combinedIntegrator(
+                &computeKeplerStateDerivative< Eigen::VectorXd >, 0.0, combinedInitialState, stepSize );
+    GaussJacksonIntegrator< double, Eigen::MatrixXd, Eigen::MatrixXd > matrixIntegrator(
+                &computeKeplerStateDerivative< Eigen::MatrixXd >, 0.0, matrixInitialState, stepSize );
+    GaussJacksonIntegrator< double, Eigen::Vector6d, Eigen::Vector6d > fixedSizeIntegrator(
+                &computeKeplerStateDerivative< Eigen::Vector6d >, 0.0, firstInitialState, stepSize );
+    for( int i = 0; i < 200; i++ )
+    {
+        firstIntegrator.performIntegrationStep( stepSize );
+        secondIntegrator.performIntegrationStep( stepSize );
+        combinedIntegrator.performIntegrationStep( stepSize );
+        matrixIntegrator.performIntegrationStep( stepSize );
+        fixedSizeIntegrator.performIntegrationStep( stepSize );
+    }
+
+    // Check that all blocks are integrated independently.
+    BOOST_CHECK_SMALL( ( combinedIntegrator.getCurrentState( ).segment( 0, 6 ) -
+                         firstIntegrator.getCurrentState( ) ).cwiseAbs( ).maxCoeff( ), 1.0E-14 );
+    BOOST_CHECK_SMALL( ( combinedIntegrator.getCurrentState( ).segment( 6, 6 ) -
+                         secondIntegrator.getCurrentState( ) ).cwiseAbs( ).maxCoeff( ), 1.0E-14 );
+    BOOST_CHECK_SMALL( ( matrixIntegrator.getCurrentState( ).col( 0 ) -
+                         firstIntegrator.getCurrentState( ) ).cwiseAbs( ).maxCoeff( ), 1.0E-14 );
+    BOOST_CHECK_SMALL( ( matrixIntegrator.getCurrentState( ).col( 1 ) -
+                         secondIntegrator.getCurrentState( ) ).cwiseAbs( ).maxCoeff( ), 1.0E-14 );
+    BOOST_CHECK_SMALL( ( fixedSizeIntegrator.getCurrentState( ) -
+                         firstIntegrator.getCurrentState( ) ).cwiseAbs( ).maxCoeff( ), 1.0E-14 );
+
+    // Integrate backwards, and check that initial state is recovered.
+    GaussJacksonIntegratorXd backwardsIntegrator(
+                &computeKeplerStateDerivative< Eigen::VectorXd >, firstIntegrator.getCurrentIndependentVariable( ),
+                firstIntegrator.getCurrentState( ), -stepSize );
+    for( int i = 0; i < 200; i++ )
+    {
+        backwardsIntegrator.performIntegrationStep( -stepSize );
+    }
+    BOOST_CHECK_SMALL( backwardsIntegrator.getCurrentIndependentVariable( ), 1.0E-12 );
+    BOOST_CHECK_SMALL( ( backwardsIntegrator.getCurrentState( ) - firstInitialState ).cwiseAbs( ).maxCoeff( ), 1.0E-10 );
+}
+
+//! Test rollback, step size changes and state modification.
+BOOST_AUTO_TEST_CASE( testGaussJacksonRollbackAndRestart )
+{
+    const double stepSize = 0.05;
+    GaussJacksonIntegratorXd integrator(
+                &computeKeplerStateDerivative< Eigen::VectorXd >, 0.0, computeCircularOrbitState( 0.0 ), stepSize );
+    BOOST_CHECK_EQUAL( integrator.rollbackToPreviousState( ), false );
+
+    // Check rollback during start-up, and when taking Gauss-Jackson steps.
+    for( int i = 0; i < 20; i++ )
+    {
+        const Eigen::VectorXd stepState = integrator.performIntegrationStep( stepSize );
+        BOOST_CHECK_EQUAL( integrator.rollbackToPreviousState( ), true );
+        BOOST_CHECK_EQUAL( integrator.rollbackToPreviousState( ), false );
+        BOOST_CHECK( integrator.performIntegrationStep( stepSize ) == stepState );
+    }
+
+    // Check step with different step size (restarting the integrator), which is rolled back.
+    const Eigen::VectorXd referenceState = integrator.performIntegrationStep( stepSize );
+    integrator.rollbackToPreviousState( );
+    integrator.performIntegrationStep( 0.3 * stepSize );
+    BOOST_CHECK_EQUAL( integrator.isStartupCompleted( ), false );
+    BOOST_CHECK_EQUAL( integrator.getNextStepSize( ), 0.3 * stepSize );
+    BOOST_CHECK_SMALL( ( integrator.getCurrentState( ) - computeCircularOrbitState( 20.3 * stepSize ) ).
+                       cwiseAbs( ).maxCoeff( ), 1.0E-13 );
+    integrator.rollbackToPreviousState( );
+    BOOST_CHECK_EQUAL( integrator.isStartupCompleted( ), true );
+    BOOST_CHECK_EQUAL( integrator.getNextStepSize( ), stepSize );
+    BOOST_CHECK( integrator.performIntegrationStep( stepSize ) == referenceState );
+
+    // Check restart after modifying state.
+    integrator.modifyCurrentState( computeCircularOrbitState( integrator.getCurrentIndependentVariable( ) ) );
+    BOOST_CHECK_EQUAL( integrator.isStartupCompleted( ), false );
+    BOOST_CHECK_EQUAL( integrator.rollbackToPreviousState( ), false );
+    for( int i = 0; i < 100; i++ )
+    {
+        integrator.performIntegrationStep( stepSize );
+    }
+    BOOST_CHECK_SMALL( ( integrator.getCurrentState( ) - computeCircularOrbitState( 121.0 * stepSize ) ).
+                       cwiseAbs( ).maxCoeff( ), 1.0E-12 );
+
+    // Check integrateTo, which takes a shorter step at the end of the interval.
+    integrator.modifyCurrentIntegrationVariables( computeCircularOrbitState( 0.0 ), 0.0 );
+    BOOST_CHECK_EQUAL( integrator.getCurrentIndependentVariable( ), 0.0 );
+    const Eigen::VectorXd finalState = integrator.integrateTo( 1.01, stepSize );
+    BOOST_CHECK_SMALL( integrator.getCurrentIndependentVariable( ) - 1.01, 1.0E-14 );
+    BOOST_CHECK_SMALL( ( finalState - computeCircularOrbitState( 1.01 ) ).cwiseAbs( ).maxCoeff( ), 1.0E-13 );
+}
+
+//! Test whether integration can be resumed, with identical results, from the integrator state written to a stream.
+BOOST_AUTO_TEST_CASE( testGaussJacksonResumeFromStoredState )
+{
+    const double stepSize = 0.05;
+
+    // Store integrator state during start-up (after 3 steps), and when taking Gauss-Jackson steps (after 15 steps).
+    for( int numberOfStepsBeforeStorage = 3; numberOfStepsBeforeStorage <= 15; numberOfStepsBeforeStorage += 12 )
+    {
+        GaussJacksonIntegratorXd integrator(
+                    &computeKeplerStateDerivative< Eigen::VectorXd >, 0.0, computeCircularOrbitState( 0.0 ), stepSize );
+        for( int i = 0; i < numberOfStepsBeforeStorage; i++ )
+        {
+            integrator.performIntegrationStep( stepSize );
+        }
+        std::ostringstream integratorStateStream;
+        integrator.writeStateToBinaryStream( integratorStateStream );
+
+        GaussJacksonIntegratorXd resumedIntegrator(
+                    &computeKeplerStateDerivative< Eigen::VectorXd >, 0.0, computeCircularOrbitState( 1.0 ), stepSize );
+        std::istringstream inputStream( integratorStateStream.str( ) );
+        resumedIntegrator.readStateFromBinaryStream( inputStream );
+        BOOST_CHECK_EQUAL( resumedIntegrator.isStartupCompleted( ), integrator.isStartupCompleted( ) );
+
+        for( int i = 0; i < 20; i++ )
+        {
+            const Eigen::VectorXd currentState = integrator.performIntegrationStep( stepSize );
+            BOOST_CHECK( resumedIntegrator.performIntegrationStep( stepSize ) == currentState );
+            BOOST_CHECK_EQUAL( resumedIntegrator.getCurrentIndependentVariable( ),
+                               integrator.getCurrentIndependentVariable( ) );
+        }
+    }
+}
+
+//! Test creation from integrator settings, and input checks.
+BOOST_AUTO_TEST_CASE( testGaussJacksonSettingsAndInputChecks )
+{
+    std::shared_ptr< IntegratorSettings< double > > integratorSettings =
+            std::make_shared< GaussJacksonIntegratorSettings< double > >( 0.0, 0.05, 10, 2 );
+    BOOST_CHECK_EQUAL( integratorSettings->integratorType_, gaussJackson );
+    BOOST_CHECK_EQUAL( std::dynamic_pointer_cast< GaussJacksonIntegratorSettings< double > >(
+                           integratorSettings->clone( ) )->order_, 10 );
+
+    std::shared_ptr< NumericalIntegrator< double, Eigen::VectorXd, Eigen::VectorXd > > integrator =
+            createIntegrator< double, Eigen::VectorXd >(
+                &computeKeplerStateDerivative< Eigen::VectorXd >, computeCircularOrbitState( 0.0 ), integratorSettings );
+    std::shared_ptr< GaussJacksonIntegratorXd > gaussJacksonIntegrator =
+            std::dynamic_pointer_cast< GaussJacksonIntegratorXd >( integrator );
+    BOOST_CHECK( gaussJacksonIntegrator != nullptr );
+    BOOST_CHECK_EQUAL( gaussJacksonIntegrator->getOrder( ), 10 );
+    BOOST_CHECK_EQUAL( gaussJacksonIntegrator->getNumberOfCorrectorIterations( ), 2 );
+    BOOST_CHECK_EQUAL( gaussJacksonIntegrator->getNextStepSize( ), 0.05 );
+
+    // Check settings of wrong type.
+    integratorSettings = std::make_shared< IntegratorSettings< double > >( gaussJackson, 0.0, 0.05 );
+    BOOST_CHECK_THROW( ( createIntegrator< double, Eigen::VectorXd >(
+                             &computeKeplerStateDerivative< Eigen::VectorXd >, computeCircularOrbitState( 0.0 ),
+                             integratorSettings ) ), std::runtime_error );
+
+    // Check state that does not consist of Cartesian position/velocity blocks.
+    BOOST_CHECK_THROW( GaussJacksonIntegratorXd( &computeKeplerStateDerivative< Eigen::VectorXd >, 0.0,
+                                                 Eigen::VectorXd::Zero( 7 ), 0.05 ), std::runtime_error );
+
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > firstOrderStateDerivativeFunction =
+            [ ]( const double, const Eigen::VectorXd& state ){ return Eigen::VectorXd( -state ); };
+    GaussJacksonIntegratorXd firstOrderIntegrator( firstOrderStateDerivativeFunction, 0.0,
+                                                   computeCircularOrbitState( 0.0 ), 0.05 );
+    BOOST_CHECK_THROW( firstOrderIntegrator.performIntegrationStep( 0.05 ), std::runtime_error );
+
+    // Check invalid order and step size.
+    BOOST_CHECK_THROW( GaussJacksonIntegratorXd( &computeKeplerStateDerivative< Eigen::VectorXd >, 0.0,
+                                                 computeCircularOrbitState( 0.0 ), 0.05, 20 ), std::runtime_error );
+    BOOST_CHECK_THROW( GaussJacksonIntegratorXd( &computeKeplerStateDerivative< Eigen::VectorXd >, 0.0,
+                                                 computeCircularOrbitState( 0.0 ), 0.05, 8, 0 ), std::runtime_error );
+    BOOST_CHECK_THROW( GaussJacksonIntegratorXd( &computeKeplerStateDerivative< Eigen::VectorXd >, 0.0,
+                                                 computeCircularOrbitState( 0.0 ), 0.0 ), std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
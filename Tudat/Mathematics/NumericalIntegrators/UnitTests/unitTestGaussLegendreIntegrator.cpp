@@ -0,0 +1,303 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Hairer, E., Wanner, G. Solving Ordinary Differential Equations II, 2nd Edition, Springer, 1996.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/utilities.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/Mathematics/NumericalIntegrators/createNumericalIntegrator.h"
+#include "Tudat/Mathematics/NumericalIntegrators/gaussLegendreIntegrator.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace numerical_integrators;
+
+//! Number of state derivative evaluations.
+int numberOfStateDerivativeEvaluations = 0;
+
+//! State derivative of one or more independent Keplerian orbits (unit gravitational parameter), for a vector or matrix
+//! state consisting of blocks of Cartesian position and velocity.
+template< typename StateType >
+StateType computeKeplerStateDerivative( const double, const StateType& state )
+{
+    numberOfStateDerivativeEvaluations++;
+
+    StateType stateDerivative( state.rows( ), state.cols( ) );
+    for( int i = 0; i < state.rows( ) / 6; i++ )
+    {
+        for( int j = 0; j < state.cols( ); j++ )
+        {
+            const Eigen::Vector3d position = state.block( 6 * i, j, 3, 1 );
+            stateDerivative.block( 6 * i, j, 3, 1 ) = state.block( 6 * i + 3, j, 3, 1 );
+            stateDerivative.block( 6 * i + 3, j, 3, 1 ) = -position / std::pow( position.norm( ), 3 );
+        }
+    }
+    return stateDerivative;
+}
+
+//! Analytical solution of circular Keplerian orbit with unit radius (and unit gravitational parameter).
+Eigen::VectorXd computeCircularOrbitState( const double time )
+{
+    Eigen::VectorXd state = Eigen::VectorXd::Zero( 6 );
+    state << std::cos( time ), std::sin( time ), 0.0, -std::sin( time ), std::cos( time ), 0.0;
+    return state;
+}
+
+//! Keplerian energy of a state consisting of Cartesian position and velocity (unit gravitational parameter).
+double computeKeplerEnergy( const Eigen::VectorXd& state )
+{
+    return 0.5 * state.segment( 3, 3 ).squaredNorm( ) - 1.0 / state.segment( 0, 3 ).norm( );
+}
+
+//! Function to compute the maximum error in the state of a circular orbit, after one orbital period.
+double computeCircularOrbitError( const double stepSize, const unsigned int numberOfStages )
+{
+    GaussLegendreIntegratorXd integrator(
+                &computeKeplerStateDerivative< Eigen::VectorXd >, 0.0, computeCircularOrbitState( 0.0 ),
+                stepSize, numberOfStages );
+    const int numberOfSteps = static_cast< int >( std::round( 2.0 * mathematical_constants::PI / stepSize ) );
+    for( int i = 0; i < numberOfSteps; i++ )
+    {
+        integrator.performIntegrationStep( stepSize );
+    }
+    return ( integrator.getCurrentState( ) - computeCircularOrbitState( integrator.getCurrentIndependentVariable( ) ) ).
+            cwiseAbs( ).maxCoeff( );
+}
+
+BOOST_AUTO_TEST_SUITE( test_gauss_legendre_integrator )
+
+//! Test the coefficients of the collocation methods.
+BOOST_AUTO_TEST_CASE( testGaussLegendreCoefficients )
+{
+    for( unsigned int numberOfStages = 1; numberOfStages <= 6; numberOfStages++ )
+    {
+        const GaussLegendreCoefficients coefficients = computeGaussLegendreCoefficients( numberOfStages );
+        BOOST_CHECK_EQUAL( coefficients.nodes.rows( ), numberOfStages );
+
+        // Check row sums of a, sum of weights, and symmetry of nodes and weights.
+        BOOST_CHECK_SMALL( ( coefficients.aCoefficients.rowwise( ).sum( ) - coefficients.nodes ).
+                           cwiseAbs( ).maxCoeff( ), 1.0E-15 );
+        BOOST_CHECK_SMALL( coefficients.bCoefficients.sum( ) - 1.0, 1.0E-15 );
+        BOOST_CHECK_SMALL( ( coefficients.nodes + coefficients.nodes.reverse( ) ).array( ).
+                           abs( ).maxCoeff( ) - 1.0, 1.0E-15 );
+        BOOST_CHECK_SMALL( ( coefficients.bCoefficients - coefficients.bCoefficients.reverse( ) ).
+                           cwiseAbs( ).maxCoeff( ), 1.0E-15 );
+
+        // Check quadrature order 2 s: the weights integrate theta^k exactly for k < 2 s.
+        for( unsigned int k = 0; k < 2 * numberOfStages; k++ )
+        {
+            BOOST_CHECK_SMALL( coefficients.bCoefficients.dot(
+                                   coefficients.nodes.array( ).pow( static_cast< double >( k ) ).matrix( ) ) -
+                               1.0 / static_cast< double >( k + 1 ), 1.0E-15 );
+        }
+
+        // Check symplecticity condition b_i a_ij + b_j a_ji = b_i b_j.
+        const Eigen::MatrixXd weightMatrix = coefficients.bCoefficients.asDiagonal( ) * coefficients.aCoefficients;
+        BOOST_CHECK_SMALL( ( weightMatrix + weightMatrix.transpose( ) -
+                             coefficients.bCoefficients * coefficients.bCoefficients.transpose( ) ).
+                           cwiseAbs( ).maxCoeff( ), 1.0E-15 );
+    }
+
+    // Check two-stage coefficients (Hairer and Wanner, 1996, Table 5.2).
+    const GaussLegendreCoefficients coefficients = computeGaussLegendreCoefficients( 2 );
+    BOOST_CHECK_SMALL( coefficients.nodes( 0 ) - ( 0.5 - std::sqrt( 3.0 ) / 6.0 ), 1.0E-15 );
+    BOOST_CHECK_SMALL( coefficients.aCoefficients( 0, 0 ) - 0.25, 1.0E-15 );
+    BOOST_CHECK_SMALL( coefficients.aCoefficients( 0, 1 ) - ( 0.25 - std::sqrt( 3.0 ) / 6.0 ), 1.0E-15 );
+    BOOST_CHECK_SMALL( coefficients.aCoefficients( 1, 0 ) - ( 0.25 + std::sqrt( 3.0 ) / 6.0 ), 1.0E-15 );
+    BOOST_CHECK_SMALL( coefficients.bCoefficients( 0 ) - 0.5, 1.0E-15 );
+
+    // Check unsupported numbers of stages.
+    BOOST_CHECK_THROW( computeGaussLegendreCoefficients( 0 ), std::runtime_error );
+    BOOST_CHECK_THROW( computeGaussLegendreCoefficients( 7 ), std::runtime_error );
+}
+
+//! Test accuracy and order of convergence for a circular Keplerian orbit.
+BOOST_AUTO_TEST_CASE( testGaussLegendreAccuracy )
+{
+    for( unsigned int numberOfStages = 1; numberOfStages <= 4; numberOfStages++ )
+    {
+        // Use larger steps for higher orders, for errors well above round-off level.
+        const double order = static_cast< double >( 2 * numberOfStages );
+        const double largeStepSize = 2.0 * mathematical_constants::PI / ( numberOfStages <= 2 ? 100.0 : 20.0 );
+        const double largeStepError = computeCircularOrbitError( largeStepSize, numberOfStages );
+        const double smallStepError = computeCircularOrbitError( largeStepSize / 2.0, numberOfStages );
+        BOOST_CHECK_GT( largeStepError / smallStepError, 0.8 * std::pow( 2.0, order ) );
+        BOOST_CHECK_LT( largeStepError / smallStepError, 1.25 * std::pow( 2.0, order ) );
+    }
+
+    // Check that the extrapolated initial guess limits the number of iterations.
+    GaussLegendreIntegratorXd integrator(
+                &computeKeplerStateDerivative< Eigen::VectorXd >, 0.0, computeCircularOrbitState( 0.0 ), 0.05, 3 );
+    BOOST_CHECK_EQUAL( integrator.getOrder( ), 6 );
+    integrator.performIntegrationStep( 0.05 );
+    const unsigned int firstStepIterations = integrator.getNumberOfIterationsOfLastStep( );
+    numberOfStateDerivativeEvaluations = 0;
+    unsigned int numberOfIterations = 0;
+    for( int i = 0; i < 100; i++ )
+    {
+        integrator.performIntegrationStep( 0.05 );
+        numberOfIterations += integrator.getNumberOfIterationsOfLastStep( );
+    }
+    BOOST_CHECK_EQUAL( numberOfStateDerivativeEvaluations, 3 * static_cast< int >( numberOfIterations ) );
+    BOOST_CHECK_LT( numberOfIterations, 100 * firstStepIterations );
+    BOOST_CHECK_SMALL( ( integrator.getCurrentState( ) - computeCircularOrbitState( 101.0 * 0.05 ) ).
+                       cwiseAbs( ).maxCoeff( ), 1.0E-10 );
+}
+
+//! Test that the energy error remains bounded over many orbits of an eccentric orbit.
+BOOST_AUTO_TEST_CASE( testGaussLegendreEnergyConservation )
+{
+    // Eccentric orbit (e = 0.5, unit semi-major axis and period 2 pi), integrated for 1000 orbits.
+    Eigen::VectorXd initialState = Eigen::VectorXd::Zero( 6 );
+    initialState << 0.5, 0.0, 0.0, 0.0, std::sqrt( 3.0 ), 0.0;
+    const double initialEnergy = computeKeplerEnergy( initialState );
+    const double stepSize = 2.0 * mathematical_constants::PI / 100.0;
+
+    GaussLegendreIntegratorXd integrator(
+                &computeKeplerStateDerivative< Eigen::VectorXd >, 0.0, initialState, stepSize, 2 );
+
+    // Maximum energy error during first and last 10 orbits.
+    double initialEnergyError = 0.0;
+    double finalEnergyError = 0.0;
+    for( int i = 0; i < 100 * 1000; i++ )
+    {
+        integrator.performIntegrationStep( stepSize );
+        const double energyError = std::fabs( computeKeplerEnergy( integrator.getCurrentState( ) ) - initialEnergy );
+        if( i < 100 * 10 )
+        {
+            initialEnergyError = std::max( initialEnergyError, energyError );
+        }
+        else if( i >= 100 * 990 )
+        {
+            finalEnergyError = std::max( finalEnergyError, energyError );
+        }
+    }
+
+    // Check that energy error does not grow (within round-off contributions).
+    BOOST_CHECK_LT( finalEnergyError, 1.5 * initialEnergyError + 1.0E-12 );
+}
+
+//! Test integration of matrix states, backwards integration, and rollback.
+BOOST_AUTO_TEST_CASE( testGaussLegendreStateTypesAndRollback )
+{
+    const double stepSize = 0.05;
+
+    Eigen::VectorXd firstInitialState( 6 ), secondInitialState( 6 );
+    firstInitialState << 1.0, 0.0, 0.0, 0.0, 1.2, 0.1;
+    secondInitialState << 0.0, 0.8, 0.3, -1.1, 0.0, 0.2;
+    Eigen::MatrixXd matrixInitialState( 6, 2 );
+    matrixInitialState << firstInitialState, secondInitialState;
+
+    GaussLegendreIntegratorXd firstIntegrator(
+                &computeKeplerStateDerivative< Eigen::VectorXd >, 0.0, firstInitialState, stepSize );
+    GaussLegendreIntegrator< double, Eigen::MatrixXd, Eigen::MatrixXd > matrixIntegrator(
+                &computeKeplerStateDerivative< Eigen::MatrixXd >, 0.0, matrixInitialState, stepSize );
+    GaussLegendreIntegrator< double, Eigen::Vector6d, Eigen::Vector6d > fixedSizeIntegrator(
+                &computeKeplerStateDerivative< Eigen::Vector6d >, 0.0, firstInitialState, stepSize );
+    for( int i = 0; i < 200; i++ )
+    {
+        firstIntegrator.performIntegrationStep( stepSize );
+        matrixIntegrator.performIntegrationStep( stepSize );
+        fixedSizeIntegrator.performIntegrationStep( stepSize );
+    }
+
+    // Columns are coupled through the convergence criterion only, so differences are at round-off level.
+    BOOST_CHECK_SMALL( ( matrixIntegrator.getCurrentState( ).col( 0 ) -
+                         firstIntegrator.getCurrentState( ) ).cwiseAbs( ).maxCoeff( ), 1.0E-13 );
+    BOOST_CHECK_SMALL( ( fixedSizeIntegrator.getCurrentState( ) -
+                         firstIntegrator.getCurrentState( ) ).cwiseAbs( ).maxCoeff( ), 1.0E-14 );
+
+    // Integrate backwards, and check that initial state is recovered (method is symmetric).
+    GaussLegendreIntegratorXd backwardsIntegrator(
+                &computeKeplerStateDerivative< Eigen::VectorXd >, firstIntegrator.getCurrentIndependentVariable( ),
+                firstIntegrator.getCurrentState( ), -stepSize );
+    for( int i = 0; i < 200; i++ )
+    {
+        backwardsIntegrator.performIntegrationStep( -stepSize );
+    }
+    BOOST_CHECK_SMALL( backwardsIntegrator.getCurrentIndependentVariable( ), 1.0E-12 );
+    BOOST_CHECK_SMALL( ( backwardsIntegrator.getCurrentState( ) - firstInitialState ).cwiseAbs( ).maxCoeff( ), 1.0E-12 );
+
+    // Check rollback, and that the repeated step (without extrapolated initial guess) agrees to round-off level.
+    const Eigen::VectorXd stepState = firstIntegrator.getCurrentState( );
+    const Eigen::VectorXd previousStepState = firstIntegrator.getPreviousState( );
+    BOOST_CHECK_EQUAL( firstIntegrator.rollbackToPreviousState( ), true );
+    BOOST_CHECK_EQUAL( firstIntegrator.rollbackToPreviousState( ), false );
+    BOOST_CHECK_SMALL( firstIntegrator.getCurrentIndependentVariable( ) - 199.0 * stepSize, 1.0E-12 );
+    BOOST_CHECK( firstIntegrator.getCurrentState( ) == previousStepState );
+    firstIntegrator.performIntegrationStep( stepSize );
+    BOOST_CHECK_SMALL( ( firstIntegrator.getCurrentState( ) - stepState ).cwiseAbs( ).maxCoeff( ), 1.0E-14 );
+
+    // Check integrateTo, which takes a shorter step at the end of the interval.
+    firstIntegrator.modifyCurrentIntegrationVariables( computeCircularOrbitState( 0.0 ), 0.0 );
+    const Eigen::VectorXd finalState = firstIntegrator.integrateTo( 1.01, stepSize );
+    BOOST_CHECK_SMALL( firstIntegrator.getCurrentIndependentVariable( ) - 1.01, 1.0E-14 );
+    BOOST_CHECK_SMALL( ( finalState - computeCircularOrbitState( 1.01 ) ).cwiseAbs( ).maxCoeff( ), 1.0E-11 );
+}
+
+//! Test creation from integrator settings, and input checks.
+BOOST_AUTO_TEST_CASE( testGaussLegendreSettingsAndInputChecks )
+{
+    std::shared_ptr< IntegratorSettings< double > > integratorSettings =
+            std::make_shared< GaussLegendreIntegratorSettings< double > >( 0.0, 0.05, 4, 20, 1.0E-14 );
+    BOOST_CHECK_EQUAL( integratorSettings->integratorType_, gaussLegendre );
+    BOOST_CHECK_EQUAL( std::dynamic_pointer_cast< GaussLegendreIntegratorSettings< double > >(
+                           integratorSettings->clone( ) )->numberOfStages_, 4 );
+
+    std::shared_ptr< GaussLegendreIntegratorXd > createdIntegrator =
+            std::dynamic_pointer_cast< GaussLegendreIntegratorXd >(
+                createIntegrator< double, Eigen::VectorXd >(
+                    &computeKeplerStateDerivative< Eigen::VectorXd >, computeCircularOrbitState( 0.0 ),
+                    integratorSettings ) );
+    BOOST_CHECK( createdIntegrator != nullptr );
+    BOOST_CHECK_EQUAL( createdIntegrator->getOrder( ), 8 );
+    BOOST_CHECK_EQUAL( createdIntegrator->getNextStepSize( ), 0.05 );
+
+    integratorSettings = std::make_shared< IntegratorSettings< double > >( gaussLegendre, 0.0, 0.05 );
+    BOOST_CHECK_THROW( ( createIntegrator< double, Eigen::VectorXd >(
+                             &computeKeplerStateDerivative< Eigen::VectorXd >, computeCircularOrbitState( 0.0 ),
+                             integratorSettings ) ), std::runtime_error );
+
+    // Check that fixed-point iteration for a stiff problem with too large step size is detected.
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > stiffStateDerivativeFunction =
+            [ ]( const double, const Eigen::VectorXd& state ){ return Eigen::VectorXd( -1000.0 * state ); };
+    GaussLegendreIntegratorXd stiffIntegrator( stiffStateDerivativeFunction, 0.0, Eigen::VectorXd::Ones( 2 ), 0.1 );
+    BOOST_CHECK_THROW( stiffIntegrator.performIntegrationStep( 0.1 ), std::runtime_error );
+
+    // Check invalid settings.
+    BOOST_CHECK_THROW( GaussLegendreIntegratorXd( &computeKeplerStateDerivative< Eigen::VectorXd >, 0.0,
+                                                  computeCircularOrbitState( 0.0 ), 0.05, 0 ), std::runtime_error );
+    BOOST_CHECK_THROW( GaussLegendreIntegratorXd( &computeKeplerStateDerivative< Eigen::VectorXd >, 0.0,
+                                                  computeCircularOrbitState( 0.0 ), 0.05, 3, 0 ), std::runtime_error );
+    BOOST_CHECK_THROW( GaussLegendreIntegratorXd( &computeKeplerStateDerivative< Eigen::VectorXd >, 0.0,
+                                                  computeCircularOrbitState( 0.0 ), 0.0 ), std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -0,0 +1,214 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Hairer, E., Norsett, S.P., Wanner, G. Solving Ordinary Differential Equations I, 2nd Edition, Springer, 1993.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaCoefficients.h"
+#include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaVariableStepSizeIntegrator.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace numerical_integrators;
+
+//! State derivative of a harmonic oscillator, with state [position, velocity] and unit frequency.
+Eigen::VectorXd computeHarmonicOscillatorStateDerivative( const double, const Eigen::VectorXd& state )
+{
+    Eigen::VectorXd stateDerivative( 2 );
+    stateDerivative << state( 1 ), -state( 0 );
+    return stateDerivative;
+}
+
+//! Analytical solution of a harmonic oscillator, with unit frequency and initial state [1, 0].
+Eigen::VectorXd computeHarmonicOscillatorState( const double time )
+{
+    Eigen::VectorXd state( 2 );
+    state << std::cos( time ), -std::sin( time );
+    return state;
+}
+
+//! Function to compute the maximum dense output error over a number of steps of fixed size, w.r.t. the solution that
+//! is obtained by propagating exactly from the start of each step.
+double computeMaximumDenseOutputError( const RungeKuttaCoefficients::CoefficientSets coefficientSet,
+                                       const double stepSize )
+{
+    RungeKuttaVariableStepSizeIntegratorXd integrator(
+                RungeKuttaCoefficients::get( coefficientSet ), &computeHarmonicOscillatorStateDerivative,
+                0.0, computeHarmonicOscillatorState( 0.0 ), stepSize, stepSize, 1.0, 1.0 );
+    integrator.setStepSizeControl( false );
+
+    double maximumError = 0.0;
+    for( int i = 0; i < 10; i++ )
+    {
+        const double stepStartTime = integrator.getCurrentIndependentVariable( );
+        const Eigen::VectorXd stepStartState = integrator.getCurrentState( );
+        integrator.performIntegrationStep( stepSize );
+
+        for( int j = 1; j < 10; j++ )
+        {
+            // Compare to solution with initial state equal to state at start of step (local error).
+            const double stepFraction = static_cast< double >( j ) / 10.0;
+            const double elapsedTime = stepFraction * stepSize;
+            Eigen::VectorXd localSolution( 2 );
+            localSolution << stepStartState( 0 ) * std::cos( elapsedTime ) + stepStartState( 1 ) * std::sin( elapsedTime ),
+                    -stepStartState( 0 ) * std::sin( elapsedTime ) + stepStartState( 1 ) * std::cos( elapsedTime );
+
+            maximumError = std::max(
+                        maximumError, ( integrator.getDenseOutputState( stepStartTime + elapsedTime ) -
+                                        localSolution ).cwiseAbs( ).maxCoeff( ) );
+        }
+    }
+    return maximumError;
+}
+
+BOOST_AUTO_TEST_SUITE( test_runge_kutta_dense_output )
+
+//! Test whether the continuous extensions of the coefficient sets satisfy the expected conditions.
+BOOST_AUTO_TEST_CASE( testRungeKuttaContinuousExtensionCoefficients )
+{
+    // Check which coefficient sets have dense output.
+    BOOST_CHECK_EQUAL( RungeKuttaCoefficients::get(
+                           RungeKuttaCoefficients::rungeKuttaFehlberg45 ).hasDenseOutput( ), false );
+    BOOST_CHECK_EQUAL( RungeKuttaCoefficients::get(
+                           RungeKuttaCoefficients::rungeKuttaFehlberg56 ).hasDenseOutput( ), false );
+
+    std::vector< RungeKuttaCoefficients::CoefficientSets > denseOutputCoefficientSets =
+    { RungeKuttaCoefficients::rungeKuttaFehlberg78, RungeKuttaCoefficients::rungeKutta87DormandPrince };
+    for( unsigned int i = 0; i < denseOutputCoefficientSets.size( ); i++ )
+    {
+        const RungeKuttaCoefficients& coefficients = RungeKuttaCoefficients::get( denseOutputCoefficientSets.at( i ) );
+        BOOST_CHECK_EQUAL( coefficients.hasDenseOutput( ), true );
+        BOOST_CHECK_EQUAL( coefficients.denseOutputOrder, 7 );
+
+        const int numberOfRegularStages = coefficients.cCoefficients.rows( );
+        const int numberOfStages = numberOfRegularStages + coefficients.denseOutputCCoefficients.rows( );
+        BOOST_CHECK_EQUAL( coefficients.denseOutputACoefficients.cols( ), numberOfStages );
+        BOOST_CHECK_EQUAL( coefficients.denseOutputBCoefficients.rows( ), numberOfStages );
+
+        // Check consistency of nodes, and explicit form of additional stages.
+        for( int j = 0; j < coefficients.denseOutputCCoefficients.rows( ); j++ )
+        {
+            BOOST_CHECK_SMALL( coefficients.denseOutputACoefficients.row( j ).sum( ) -
+                               coefficients.denseOutputCCoefficients( j ), 1.0E-12 );
+            BOOST_CHECK_EQUAL( coefficients.denseOutputACoefficients.row( j ).tail(
+                                   numberOfStages - numberOfRegularStages - j ).cwiseAbs( ).maxCoeff( ), 0.0 );
+        }
+
+        // Check that continuous extension reproduces propagated solution, and state derivative, at end of step.
+        const Eigen::VectorXd propagatedWeights = coefficients.bCoefficients.row(
+                    ( coefficients.orderEstimateToIntegrate == RungeKuttaCoefficients::lower ) ? 0 : 1 ).transpose( );
+        const Eigen::VectorXd endPointWeights = coefficients.denseOutputBCoefficients.rowwise( ).sum( );
+        BOOST_CHECK_SMALL( ( endPointWeights.head( numberOfRegularStages ) - propagatedWeights ).cwiseAbs( ).maxCoeff( ),
+                           1.0E-12 );
+        BOOST_CHECK_SMALL( endPointWeights.tail( numberOfStages - numberOfRegularStages ).cwiseAbs( ).maxCoeff( ),
+                           1.0E-12 );
+
+        Eigen::VectorXd endPointDerivativeWeights = Eigen::VectorXd::Zero( numberOfStages );
+        for( int j = 0; j < coefficients.denseOutputBCoefficients.cols( ); j++ )
+        {
+            endPointDerivativeWeights += static_cast< double >( j + 1 ) * coefficients.denseOutputBCoefficients.col( j );
+        }
+        BOOST_CHECK_SMALL( endPointDerivativeWeights( numberOfRegularStages ) - 1.0, 1.0E-11 );
+        endPointDerivativeWeights( numberOfRegularStages ) = 0.0;
+        BOOST_CHECK_SMALL( endPointDerivativeWeights.cwiseAbs( ).maxCoeff( ), 1.0E-11 );
+    }
+
+    // Check that unattainable orders are rejected.
+    RungeKuttaCoefficients coefficients = RungeKuttaCoefficients::get( RungeKuttaCoefficients::rungeKuttaFehlberg45 );
+    BOOST_CHECK_THROW( computeContinuousExtension( coefficients, 5 ), std::runtime_error );
+    BOOST_CHECK_THROW( computeContinuousExtension( coefficients, 0 ), std::runtime_error );
+}
+
+//! Test accuracy and order of convergence of dense output of Runge-Kutta integrator.
+BOOST_AUTO_TEST_CASE( testRungeKuttaDenseOutputAccuracy )
+{
+    std::vector< RungeKuttaCoefficients::CoefficientSets > denseOutputCoefficientSets =
+    { RungeKuttaCoefficients::rungeKuttaFehlberg78, RungeKuttaCoefficients::rungeKutta87DormandPrince };
+    for( unsigned int i = 0; i < denseOutputCoefficientSets.size( ); i++ )
+    {
+        // Check that local error of dense output converges with order 8 (order 7 of continuous extension, plus one
+        // for local error).
+        const double largeStepError = computeMaximumDenseOutputError( denseOutputCoefficientSets.at( i ), 0.4 );
+        const double smallStepError = computeMaximumDenseOutputError( denseOutputCoefficientSets.at( i ), 0.2 );
+        BOOST_CHECK_SMALL( largeStepError, 1.0E-8 );
+        BOOST_CHECK_GT( largeStepError / smallStepError, std::pow( 2.0, 7.5 ) );
+
+        // Propagate with step-size control, and check dense output throughout propagation.
+        RungeKuttaVariableStepSizeIntegratorXd integrator(
+                    RungeKuttaCoefficients::get( denseOutputCoefficientSets.at( i ) ),
+                    &computeHarmonicOscillatorStateDerivative, 0.0, computeHarmonicOscillatorState( 0.0 ),
+                    1.0E-6, 10.0, 1.0E-12, 1.0E-12 );
+        BOOST_CHECK_EQUAL( integrator.isDenseOutputAvailable( ), true );
+        BOOST_CHECK_THROW( integrator.getDenseOutputState( 0.0 ), std::runtime_error );
+
+        double stepSize = 0.1;
+        while( integrator.getCurrentIndependentVariable( ) < 20.0 )
+        {
+            integrator.performIntegrationStep( stepSize );
+            stepSize = integrator.getNextStepSize( );
+
+            const double previousTime = integrator.getPreviousIndependentVariable( );
+            const double currentTime = integrator.getCurrentIndependentVariable( );
+
+            // Check continuity at step boundaries (at end of step, up to rounding errors of interpolation weights).
+            BOOST_CHECK_SMALL( ( integrator.getDenseOutputState( previousTime ) -
+                                 integrator.getPreviousState( ) ).cwiseAbs( ).maxCoeff( ), 1.0E-15 );
+            BOOST_CHECK_SMALL( ( integrator.getDenseOutputState( currentTime ) -
+                                 integrator.getCurrentState( ) ).cwiseAbs( ).maxCoeff( ), 1.0E-12 );
+
+            // Check accuracy within step.
+            for( int j = 1; j < 4; j++ )
+            {
+                const double testTime = previousTime + static_cast< double >( j ) / 4.0 * ( currentTime - previousTime );
+                BOOST_CHECK_SMALL( ( integrator.getDenseOutputState( testTime ) -
+                                     computeHarmonicOscillatorState( testTime ) ).cwiseAbs( ).maxCoeff( ), 1.0E-10 );
+            }
+
+            // Check that dense output outside of last step is rejected.
+            BOOST_CHECK_THROW( integrator.getDenseOutputState( currentTime + 0.1 * ( currentTime - previousTime ) ),
+                               std::runtime_error );
+        }
+
+        // Check that dense output is not available after modifying state.
+        integrator.modifyCurrentState( integrator.getCurrentState( ) );
+        BOOST_CHECK_THROW( integrator.getDenseOutputState( integrator.getCurrentIndependentVariable( ) ),
+                           std::runtime_error );
+    }
+
+    // Check that dense output is not available for coefficient sets without continuous extension.
+    RungeKuttaVariableStepSizeIntegratorXd integrator(
+                RungeKuttaCoefficients::get( RungeKuttaCoefficients::rungeKuttaFehlberg45 ),
+                &computeHarmonicOscillatorStateDerivative, 0.0, computeHarmonicOscillatorState( 0.0 ),
+                1.0E-6, 10.0, 1.0E-12, 1.0E-12 );
+    integrator.performIntegrationStep( 0.1 );
+    BOOST_CHECK_EQUAL( integrator.isDenseOutputAvailable( ), false );
+    BOOST_CHECK_THROW( integrator.getDenseOutputState( 0.05 ), std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
@@ -0,0 +1,301 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Yoshida, H., Construction of higher order symplectic integrators, Physics Letters A, 150(5-7), 1990.
+ *
+ */
+
+#define BOOST_TEST_MAIN
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+
+#include <boost/test/unit_test.hpp>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/utilities.h"
+#include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
+#include "Tudat/Mathematics/NumericalIntegrators/createNumericalIntegrator.h"
+#include "Tudat/Mathematics/NumericalIntegrators/yoshidaSymplecticIntegrator.h"
+
+namespace tudat
+{
+namespace unit_tests
+{
+
+using namespace numerical_integrators;
+
+//! Number of state derivative evaluations.
+int numberOfStateDerivativeEvaluations = 0;
+
+//! State derivative of one or more independent Keplerian orbits (unit gravitational parameter), for a vector or matrix
+//! state consisting of blocks of Cartesian position and velocity.
+template< typename StateType >
+StateType computeKeplerStateDerivative( const double, const StateType& state )
+{
+    numberOfStateDerivativeEvaluations++;
+
+    StateType stateDerivative( state.rows( ), state.cols( ) );
+    for( int i = 0; i < state.rows( ) / 6; i++ )
+    {
+        for( int j = 0; j < state.cols( ); j++ )
+        {
+            const Eigen::Vector3d position = state.block( 6 * i, j, 3, 1 );
+            stateDerivative.block( 6 * i, j, 3, 1 ) = state.block( 6 * i + 3, j, 3, 1 );
+            stateDerivative.block( 6 * i + 3, j, 3, 1 ) = -position / std::pow( position.norm( ), 3 );
+        }
+    }
+    return stateDerivative;
+}
+
+//! Analytical solution of circular Keplerian orbit with unit radius (and unit gravitational parameter).
+Eigen::VectorXd computeCircularOrbitState( const double time )
+{
+    Eigen::VectorXd state = Eigen::VectorXd::Zero( 6 );
+    state << std::cos( time ), std::sin( time ), 0.0, -std::sin( time ), std::cos( time ), 0.0;
+    return state;
+}
+
+//! Keplerian energy of a state consisting of Cartesian position and velocity (unit gravitational parameter).
+double computeKeplerEnergy( const Eigen::VectorXd& state )
+{
+    return 0.5 * state.segment( 3, 3 ).squaredNorm( ) - 1.0 / state.segment( 0, 3 ).norm( );
+}
+
+//! Function to compute the maximum error in the state of a circular orbit, after one orbital period.
+double computeCircularOrbitError( const double stepSize, const unsigned int order )
+{
+    YoshidaSymplecticIntegratorXd integrator(
+                &computeKeplerStateDerivative< Eigen::VectorXd >, 0.0, computeCircularOrbitState( 0.0 ),
+                stepSize, order );
+    const int numberOfSteps = static_cast< int >( std::round( 2.0 * mathematical_constants::PI / stepSize ) );
+    for( int i = 0; i < numberOfSteps; i++ )
+    {
+        integrator.performIntegrationStep( stepSize );
+    }
+    return ( integrator.getCurrentState( ) - computeCircularOrbitState( integrator.getCurrentIndependentVariable( ) ) ).
+            cwiseAbs( ).maxCoeff( );
+}
+
+BOOST_AUTO_TEST_SUITE( test_yoshida_symplectic_integrator )
+
+//! Test the step size fractions of the composition.
+BOOST_AUTO_TEST_CASE( testYoshidaCompositionCoefficients )
+{
+    const int expectedNumberOfStages[ 4 ] = { 1, 3, 7, 15 };
+    for( unsigned int order = 2; order <= 8; order += 2 )
+    {
+        const Eigen::VectorXd coefficients = getYoshidaCompositionCoefficients( order );
+        BOOST_CHECK_EQUAL( coefficients.rows( ), expectedNumberOfStages[ order / 2 - 1 ] );
+        BOOST_CHECK_SMALL( coefficients.sum( ) - 1.0, 1.0E-15 );
+        BOOST_CHECK_SMALL( ( coefficients - coefficients.reverse( ) ).cwiseAbs( ).maxCoeff( ), 1.0E-15 );
+
+        // Third-order condition of symmetric compositions of second-order methods (Yoshida, 1990).
+        if( order > 2 )
+        {
+            BOOST_CHECK_SMALL( coefficients.array( ).cube( ).sum( ), 1.0E-13 );
+        }
+    }
+
+    // Check fourth-order coefficients (Yoshida, 1990).
+    const Eigen::VectorXd coefficients = getYoshidaCompositionCoefficients( 4 );
+    BOOST_CHECK_SMALL( coefficients( 0 ) - 1.0 / ( 2.0 - std::cbrt( 2.0 ) ), 1.0E-15 );
+    BOOST_CHECK_SMALL( coefficients( 1 ) + std::cbrt( 2.0 ) / ( 2.0 - std::cbrt( 2.0 ) ), 1.0E-15 );
+
+    // Check unsupported orders.
+    BOOST_CHECK_THROW( getYoshidaCompositionCoefficients( 3 ), std::runtime_error );
+    BOOST_CHECK_THROW( getYoshidaCompositionCoefficients( 10 ), std::runtime_error );
+}
+
+//! Test accuracy and order of convergence for a circular Keplerian orbit.
+BOOST_AUTO_TEST_CASE( testYoshidaAccuracy )
+{
+    for( unsigned int order = 2; order <= 8; order += 2 )
+    {
+        // Use larger steps for higher orders, for errors well above round-off level.
+        const double largeStepSize = 2.0 * mathematical_constants::PI / ( order <= 4 ? 200.0 : 50.0 );
+        const double largeStepError = computeCircularOrbitError( largeStepSize, order );
+        const double smallStepError = computeCircularOrbitError( largeStepSize / 2.0, order );
+        BOOST_CHECK_GT( largeStepError / smallStepError, 0.8 * std::pow( 2.0, static_cast< double >( order ) ) );
+        BOOST_CHECK_LT( largeStepError / smallStepError, 1.25 * std::pow( 2.0, static_cast< double >( order ) ) );
+    }
+
+    // Check number of state derivative evaluations per step.
+    for( unsigned int order = 2; order <= 8; order += 2 )
+    {
+        YoshidaSymplecticIntegratorXd integrator(
+                    &computeKeplerStateDerivative< Eigen::VectorXd >, 0.0, computeCircularOrbitState( 0.0 ), 0.05, order );
+        numberOfStateDerivativeEvaluations = 0;
+        for( int i = 0; i < 10; i++ )
+        {
+            integrator.performIntegrationStep( 0.05 );
+        }
+        BOOST_CHECK_EQUAL( integrator.getOrder( ), order );
+        BOOST_CHECK_EQUAL( numberOfStateDerivativeEvaluations, 10 * integrator.getNumberOfStages( ) );
+    }
+}
+
+//! Test that the energy error remains bounded over many orbits of an eccentric orbit.
+BOOST_AUTO_TEST_CASE( testYoshidaEnergyConservation )
+{
+    // Eccentric orbit (e = 0.5, unit semi-major axis and period 2 pi), integrated for 1000 orbits.
+    Eigen::VectorXd initialState = Eigen::VectorXd::Zero( 6 );
+    initialState << 0.5, 0.0, 0.0, 0.0, std::sqrt( 3.0 ), 0.0;
+    const double initialEnergy = computeKeplerEnergy( initialState );
+    const double stepSize = 2.0 * mathematical_constants::PI / 200.0;
+
+    for( unsigned int order = 4; order <= 6; order += 2 )
+    {
+        YoshidaSymplecticIntegratorXd integrator(
+                    &computeKeplerStateDerivative< Eigen::VectorXd >, 0.0, initialState, stepSize, order );
+
+        // Maximum energy error during first and last 10 orbits.
+        double initialEnergyError = 0.0;
+        double finalEnergyError = 0.0;
+        for( int i = 0; i < 200 * 1000; i++ )
+        {
+            integrator.performIntegrationStep( stepSize );
+            const double energyError = std::fabs( computeKeplerEnergy( integrator.getCurrentState( ) ) - initialEnergy );
+            if( i < 200 * 10 )
+            {
+                initialEnergyError = std::max( initialEnergyError, energyError );
+            }
+            else if( i >= 200 * 990 )
+            {
+                finalEnergyError = std::max( finalEnergyError, energyError );
+            }
+        }
+
+        // Check that energy error does not grow (within round-off contributions).
+        BOOST_CHECK_LT( finalEnergyError, 1.5 * initialEnergyError + 1.0E-12 );
+    }
+}
+
+//! Test integration of multiple bodies, matrix states, and backwards integration.
+BOOST_AUTO_TEST_CASE( testYoshidaStateTypes )
+{
+    const double stepSize = 0.05;
+
+    // Define states of two bodies in (different) eccentric orbits.
+    Eigen::VectorXd firstInitialState( 6 ), secondInitialState( 6 );
+    firstInitialState << 1.0, 0.0, 0.0, 0.0, 1.2, 0.1;
+    secondInitialState << 0.0, 0.8, 0.3, -1.1, 0.0, 0.2;
+    Eigen::VectorXd combinedInitialState( 12 );
+    combinedInitialState << firstInitialState, secondInitialState;
+    Eigen::MatrixXd matrixInitialState( 6, 2 );
+    matrixInitialState << firstInitialState, secondInitialState;
+
+    YoshidaSymplecticIntegratorXd firstIntegrator(
+                &computeKeplerStateDerivative< Eigen::VectorXd >, 0.0, firstInitialState, stepSize );
+    YoshidaSymplecticIntegratorXd secondIntegrator(
+                &computeKeplerStateDerivative< Eigen::VectorXd >, 0.0, secondInitialState, stepSize );
+    YoshidaSymplecticIntegratorXd combinedIntegrator(
+                &computeKeplerStateDerivative< Eigen::VectorXd >, 0.0, combinedInitialState, stepSize );
+    YoshidaSymplecticIntegrator< double, Eigen::MatrixXd, Eigen::MatrixXd > matrixIntegrator(
+                &computeKeplerStateDerivative< Eigen::MatrixXd >, 0.0, matrixInitialState, stepSize );
+    YoshidaSymplecticIntegrator< double, Eigen::Vector6d, Eigen::Vector6d > fixedSizeIntegrator(
+                &computeKeplerStateDerivative< Eigen::Vector6d >, 0.0, firstInitialState, stepSize );
+    for( int i = 0; i < 200; i++ )
+    {
+        firstIntegrator.performIntegrationStep( stepSize );
+        secondIntegrator.performIntegrationStep( stepSize );
+        combinedIntegrator.performIntegrationStep( stepSize );
+        matrixIntegrator.performIntegrationStep( stepSize );
+        fixedSizeIntegrator.performIntegrationStep( stepSize );
+    }
+
+    // Check that all blocks are integrated independently.
+    BOOST_CHECK_SMALL( ( combinedIntegrator.getCurrentState( ).segment( 0, 6 ) -
+                         firstIntegrator.getCurrentState( ) ).cwiseAbs( ).maxCoeff( ), 1.0E-14 );
+    BOOST_CHECK_SMALL( ( combinedIntegrator.getCurrentState( ).segment( 6, 6 ) -
+                         secondIntegrator.getCurrentState( ) ).cwiseAbs( ).maxCoeff( ), 1.0E-14 );
+    BOOST_CHECK_SMALL( ( matrixIntegrator.getCurrentState( ).col( 0 ) -
+                         firstIntegrator.getCurrentState( ) ).cwiseAbs( ).maxCoeff( ), 1.0E-14 );
+    BOOST_CHECK_SMALL( ( matrixIntegrator.getCurrentState( ).col( 1 ) -
+                         secondIntegrator.getCurrentState( ) ).cwiseAbs( ).maxCoeff( ), 1.0E-14 );
+    BOOST_CHECK_SMALL( ( fixedSizeIntegrator.getCurrentState( ) -
+                         firstIntegrator.getCurrentState( ) ).cwiseAbs( ).maxCoeff( ), 1.0E-14 );
+
+    // Integrate backwards, and check that initial state is recovered (method is symmetric).
+    YoshidaSymplecticIntegratorXd backwardsIntegrator(
+                &computeKeplerStateDerivative< Eigen::VectorXd >, firstIntegrator.getCurrentIndependentVariable( ),
+                firstIntegrator.getCurrentState( ), -stepSize );
+    for( int i = 0; i < 200; i++ )
+    {
+        backwardsIntegrator.performIntegrationStep( -stepSize );
+    }
+    BOOST_CHECK_SMALL( backwardsIntegrator.getCurrentIndependentVariable( ), 1.0E-12 );
+    BOOST_CHECK_SMALL( ( backwardsIntegrator.getCurrentState( ) - firstInitialState ).cwiseAbs( ).maxCoeff( ), 1.0E-12 );
+}
+
+//! Test rollback, creation from integrator settings, and input checks.
+BOOST_AUTO_TEST_CASE( testYoshidaSettingsAndInputChecks )
+{
+    const double stepSize = 0.05;
+    YoshidaSymplecticIntegratorXd integrator(
+                &computeKeplerStateDerivative< Eigen::VectorXd >, 0.0, computeCircularOrbitState( 0.0 ), stepSize );
+    BOOST_CHECK_EQUAL( integrator.rollbackToPreviousState( ), false );
+    const Eigen::VectorXd stepState = integrator.performIntegrationStep( stepSize );
+    BOOST_CHECK_EQUAL( integrator.rollbackToPreviousState( ), true );
+    BOOST_CHECK_EQUAL( integrator.rollbackToPreviousState( ), false );
+    BOOST_CHECK( integrator.performIntegrationStep( stepSize ) == stepState );
+    BOOST_CHECK( integrator.getPreviousState( ) == computeCircularOrbitState( 0.0 ) );
+
+    // Check integrateTo, which takes a shorter step at the end of the interval.
+    integrator.modifyCurrentIntegrationVariables( computeCircularOrbitState( 0.0 ), 0.0 );
+    const Eigen::VectorXd finalState = integrator.integrateTo( 1.01, stepSize );
+    BOOST_CHECK_SMALL( integrator.getCurrentIndependentVariable( ) - 1.01, 1.0E-14 );
+    BOOST_CHECK_SMALL( ( finalState - computeCircularOrbitState( 1.01 ) ).cwiseAbs( ).maxCoeff( ), 1.0E-9 );
+
+    // Check creation from settings.
+    std::shared_ptr< IntegratorSettings< double > > integratorSettings =
+            std::make_shared< YoshidaSymplecticIntegratorSettings< double > >( 0.0, stepSize, 8 );
+    BOOST_CHECK_EQUAL( integratorSettings->integratorType_, yoshidaSymplectic );
+    BOOST_CHECK_EQUAL( std::dynamic_pointer_cast< YoshidaSymplecticIntegratorSettings< double > >(
+                           integratorSettings->clone( ) )->order_, 8 );
+    std::shared_ptr< YoshidaSymplecticIntegratorXd > createdIntegrator =
+            std::dynamic_pointer_cast< YoshidaSymplecticIntegratorXd >(
+                createIntegrator< double, Eigen::VectorXd >(
+                    &computeKeplerStateDerivative< Eigen::VectorXd >, computeCircularOrbitState( 0.0 ),
+                    integratorSettings ) );
+    BOOST_CHECK( createdIntegrator != nullptr );
+    BOOST_CHECK_EQUAL( createdIntegrator->getOrder( ), 8 );
+    BOOST_CHECK_EQUAL( createdIntegrator->getNextStepSize( ), stepSize );
+
+    integratorSettings = std::make_shared< IntegratorSettings< double > >( yoshidaSymplectic, 0.0, stepSize );
+    BOOST_CHECK_THROW( ( createIntegrator< double, Eigen::VectorXd >(
+                             &computeKeplerStateDerivative< Eigen::VectorXd >, computeCircularOrbitState( 0.0 ),
+                             integratorSettings ) ), std::runtime_error );
+
+    // Check state that does not consist of Cartesian position/velocity blocks.
+    BOOST_CHECK_THROW( YoshidaSymplecticIntegratorXd( &computeKeplerStateDerivative< Eigen::VectorXd >, 0.0,
+                                                      Eigen::VectorXd::Zero( 7 ), stepSize ), std::runtime_error );
+    std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > firstOrderStateDerivativeFunction =
+            [ ]( const double, const Eigen::VectorXd& state ){ return Eigen::VectorXd( -state ); };
+    YoshidaSymplecticIntegratorXd firstOrderIntegrator( firstOrderStateDerivativeFunction, 0.0,
+                                                        computeCircularOrbitState( 0.0 ), stepSize );
+    BOOST_CHECK_THROW( firstOrderIntegrator.performIntegrationStep( stepSize ), std::runtime_error );
+
+    // Check invalid order and step size.
+    BOOST_CHECK_THROW( YoshidaSymplecticIntegratorXd( &computeKeplerStateDerivative< Eigen::VectorXd >, 0.0,
+                                                      computeCircularOrbitState( 0.0 ), stepSize, 5 ),
+                       std::runtime_error );
+    BOOST_CHECK_THROW( YoshidaSymplecticIntegratorXd( &computeKeplerStateDerivative< Eigen::VectorXd >, 0.0,
+                                                      computeCircularOrbitState( 0.0 ), 0.0 ), std::runtime_error );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
+
+} // namespace unit_tests
+
+} // namespace tudat
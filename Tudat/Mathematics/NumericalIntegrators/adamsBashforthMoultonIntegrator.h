@@ -21,7 +21,6 @@
 #ifndef TUDAT_ADAMS_BASHFORTH_MOULTON_INTEGRATOR_H
 #define TUDAT_ADAMS_BASHFORTH_MOULTON_INTEGRATOR_H
 
-#include <deque>
 #include <algorithm>
 #include <limits>
 
@@ -29,6 +28,7 @@
 
 #include <Eigen/Core>
 
+#include "Tudat/Mathematics/NumericalIntegrators/multistepHistoryBuffer.h"
 #include "Tudat/Mathematics/NumericalIntegrators/numericalIntegrator.h"
 #include "Tudat/Mathematics/NumericalIntegrators/reinitializableNumericalIntegrator.h"
 #include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaCoefficients.h"
@@ -74,6 +74,15 @@ public:
     typedef typename ReinitializableNumericalIntegratorBase::NumericalIntegratorBase::
     StateDerivativeFunction StateDerivativeFunction;
 
+    //! Typedef for the scalar type of the state.
+    typedef typename StateType::Scalar StateScalarType;
+
+    //! Typedef for a state (or state derivative) stored as a single column vector.
+    typedef Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > FlatStateType;
+
+    //! Typedef for a table of integration coefficients, with each set of coefficients stored in a (contiguous) row.
+    typedef Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor > CoefficientTable;
+
     //! Default constructor.
     /*!
      * Default constructor, taking a state derivative function as
@@ -120,11 +129,27 @@ public:
         order_ = minimumOrder_;
         stepSize_ = 1.;
         fixedSingleStep_ = fixedStepSize_;
-        
-        // Start filling the state and state derivative history deques.
-        stateHistory_.push_front( currentState_ );
-        derivHistory_.push_front( this->stateDerivativeFunction_(
-                                      currentIndependentVariable_, currentState_ ));
+
+        // Allocate the history buffer, with each entry consisting of a state and its derivative, and the variables
+        // used during each step, so that no memory is allocated by the integrator itself while integrating.
+        stateSize_ = static_cast< int >( currentState_.size( ) );
+        history_ = MultistepHistoryBuffer< StateScalarType >( 2 * stateSize_, maximumHistorySize );
+        lastState_ = currentState_;
+        lastDerivative_ = currentState_;
+        predictedState_ = currentState_;
+        correctedState_ = currentState_;
+        doubleStepCorrectedState_ = currentState_;
+        absoluteError_ = currentState_;
+        relativeError_ = currentState_;
+        predictorAbsoluteError_ = currentState_;
+        predictorRelativeError_ = currentState_;
+        interpolatedState_.resize( stateSize_ );
+        interpolatedDerivative_.resize( stateSize_ );
+        lastHistoryHead_ = 0;
+        lastHistorySize_ = 0;
+
+        // Start filling the state and state derivative history.
+        addStateToHistory( currentState_, this->stateDerivativeFunction_( currentIndependentVariable_, currentState_ ) );
     }
 
     //! Default constructor.
@@ -221,17 +246,9 @@ public:
         // If stepSize is not same as old, clear the step-size dependent histories.
         if ( stepSize != stepSize_ )
         {
-            // Pop all values from the history deque (the history is
-            // invalid as it is dependent on the stepSize), except for
-            // the current state and state derivative.
-            while ( stateHistory_.size( ) > 1 )
-            {
-                stateHistory_.pop_back( );
-            }
-            while ( derivHistory_.size( ) > 1 )
-            {
-                derivHistory_.pop_back( );
-            }
+            // Remove all values from the history (the history is invalid as it is dependent on the stepSize),
+            // except for the current state and state derivative.
+            history_.truncate( 1 );
             stepSize_ = stepSize;
             
             // Allow single step integrator to determine own stepsize
@@ -250,61 +267,55 @@ public:
     {
         // Set last* variables for rollback.
         lastStepSize_ = stepSize_;
-        lastState_ = stateHistory_.back( );
-        lastDerivative_ = derivHistory_.back( );
+        lastState_ = currentState_;
+        getFlatState( lastDerivative_ ) = history_.getSegment( 0, stateSize_, stateSize_ );
         lastIndependentVariable_ = currentIndependentVariable_;
 
         // Remove old elements so enough are left to calculate predicted and corrected.
         // max twice the order, to facilitatie a doubling, halving, and order change.
-        while ( stateHistory_.size( ) > order_ * 2 )
-        {
-            stateHistory_.pop_back( );
-        }
-        while ( derivHistory_.size( ) > order_ * 2 )
-        {
-            derivHistory_.pop_back( );
-        }
-        unsigned int sizeStateHistory = stateHistory_.size( );
-        unsigned int sizeDerivativeHistory = derivHistory_.size( );
-        unsigned int possibleOrder = std::min( sizeStateHistory, sizeDerivativeHistory );
-
-        StateType correctedState;
-        StateType predictedState;
+        history_.truncate( 2 * order_ );
+        lastHistoryHead_ = history_.getHead( );
+        lastHistorySize_ = history_.getSize( );
+        unsigned int possibleOrder = static_cast< unsigned int >( history_.getSize( ) );
 
         // Check if enough history steps are available to perform AM
         // step if not use a single-step method.
-        if ( possibleOrder < minimumOrder_ || possibleOrder < order_ )
+        const bool isSingleStep = ( possibleOrder < minimumOrder_ || possibleOrder < order_ );
+        if ( isSingleStep )
         {
-            correctedState = performSingleStep( );
+            correctedState_ = performSingleStep( );
         }
         else
         {
-            StateType predictedState = performPredictorStep( order_, false );
+            performPredictorStep( order_, false, predictedState_ );
             predictedDerivative_ = this->stateDerivativeFunction_( currentIndependentVariable_ +
-                                                                   stepSize_, predictedState );
-            correctedState  = performCorrectorStep( predictedState, order_, false );
-            absoluteError_ = estimateAbsoluteError( predictedState, correctedState, order_ );
-            relativeError_ = estimateRelativeError( predictedState, correctedState, absoluteError_ );
+                                                                   stepSize_, predictedState_ );
+            performCorrectorStep( predictedState_, order_, false, correctedState_ );
+            estimateAbsoluteError( predictedState_, correctedState_, order_, absoluteError_ );
+            estimateRelativeError( predictedState_, correctedState_, absoluteError_, relativeError_ );
         }
 
         // Change order to one that gives a higher predicted accuracy
-        // Add tolenaces
-        StateType predictorAbsoluteError;
-        StateType predictorRelativeError;
-        
         // If order is not fixed, order is not max yet and enough
         // history is available, then predict the error of an order
-        // more.
-        if ( !fixedOrder_ && order_ < maximumOrder_ && order_ < possibleOrder )
+        // more. Not done for single steps, for which there is no predicted derivative (and the corrected state
+        // must not be overwritten).
+        if ( isSingleStep )
+        {
+            predictorAbsoluteError_ = absoluteError_;
+            predictorRelativeError_ = relativeError_;
+        }
+        else if ( !fixedOrder_ && order_ < maximumOrder_ && order_ < possibleOrder )
         {
-            predictedState = performPredictorStep( order_ + 1, false );
-            correctedState = performCorrectorStep( predictedState, order_ + 1, false );
-            predictorAbsoluteError = estimateAbsoluteError( predictedState, correctedState, order_ + 1 );
-            predictorRelativeError = estimateRelativeError( predictedState, correctedState, predictorAbsoluteError );
+            performPredictorStep( order_ + 1, false, predictedState_ );
+            performCorrectorStep( predictedState_, order_ + 1, false, correctedState_ );
+            estimateAbsoluteError( predictedState_, correctedState_, order_ + 1, predictorAbsoluteError_ );
+            estimateRelativeError( predictedState_, correctedState_, predictorAbsoluteError_,
+                                   predictorRelativeError_ );
 
             // If the predicted error is less than the current error,
             // increase the error.
-            if ( errorCompare( predictorAbsoluteError, predictorRelativeError, absoluteError_, relativeError_ ) )
+            if ( errorCompare( predictorAbsoluteError_, predictorRelativeError_, absoluteError_, relativeError_ ) )
             {
                 
                 order_++;
@@ -315,39 +326,32 @@ public:
         }
         else if ( !fixedOrder_ && order_ > minimumOrder_ && order_ - 1 <= possibleOrder )
         {
-            predictedState = performPredictorStep( order_ - 1, false );
-            correctedState = performCorrectorStep( predictedState, order_ - 1, false );
-            predictorAbsoluteError = estimateAbsoluteError( predictedState, correctedState, order_ - 1 );
-            predictorRelativeError = estimateRelativeError( predictedState, correctedState, predictorAbsoluteError );
+            performPredictorStep( order_ - 1, false, predictedState_ );
+            performCorrectorStep( predictedState_, order_ - 1, false, correctedState_ );
+            estimateAbsoluteError( predictedState_, correctedState_, order_ - 1, predictorAbsoluteError_ );
+            estimateRelativeError( predictedState_, correctedState_, predictorAbsoluteError_,
+                                   predictorRelativeError_ );
             // If it is less than the current order, lower the order.
-            if ( errorCompare( predictorAbsoluteError, predictorRelativeError, absoluteError_, relativeError_ ) )
+            if ( errorCompare( predictorAbsoluteError_, predictorRelativeError_, absoluteError_, relativeError_ ) )
             {
                 order_--;
             } else {
-                predictorAbsoluteError = absoluteError_;
-                predictorRelativeError = relativeError_;
+                predictorAbsoluteError_ = absoluteError_;
+                predictorRelativeError_ = relativeError_;
             }
         }
         else
         {
-            predictorAbsoluteError = absoluteError_;
-            predictorRelativeError = relativeError_;
+            predictorAbsoluteError_ = absoluteError_;
+            predictorRelativeError_ = relativeError_;
         }
 
         // If the error (after order change) is too big, stepsize
         // isn't fixed and will not become too small, then halve the
         // stepsize.
-        if ( errorTooLarge( predictorAbsoluteError, predictorRelativeError )
+        if ( errorTooLarge( predictorAbsoluteError_, predictorRelativeError_ )
              && std::fabs( stepSize_ / 2.0 )> minimumStepSize_ && !fixedStepSize_ )
         {
-            // Set up new data for halving
-            std::deque< StateType > tempStateHistory;
-            std::deque< StateType > tempDerivativeHistory;
-            StateType midState = currentState_;
-            StateDerivativeType midDerivative = midState;
-            unsigned int interpolationStateIndex;
-            unsigned int interpolationDerivativeIndex;
-
             // Only if there is enough historical data, is it possible to create the intermediate
             // points. Redefine order based on available data, it could drop, but can't be lower
             // that minimum order
@@ -360,38 +364,8 @@ public:
             {
                 order_ = minimumOrder_;
             }
-            
-            for( unsigned int i = 0; i < possibleHalvingOrder ; i++ )
-            {
-                // If states are even, they already exist, no need to interpolate
-                if ( i % 2 == 0 )
-                {
-                    tempStateHistory.push_back( stateHistory_.at( i / 2 ));
-                    tempDerivativeHistory.push_back( derivHistory_.at( i / 2 ));
-                } else {
-                    // Reset midpoint state and deriv to zero
-                    midState = 0 * midState;
-                    midDerivative = midState;
-                    interpolationDerivativeIndex = ( order_ - 1 ) * ( order_ - 1 ) + ( i - 1 ) / 2;
-                    interpolationStateIndex = interpolationDerivativeIndex - order_ + 1;
-                    for( unsigned int j = 0; j < order_; j++ )
-                    {
-                        midState += interpolationCoefficients[ interpolationStateIndex ][ j ] *
-                                stateHistory_.at( j ) + interpolationCoefficients[ interpolationStateIndex ][ order_ + j ] *
-                                derivHistory_.at( j ) * stepSize_;
-                        midDerivative += interpolationCoefficients[ interpolationDerivativeIndex ][ j ] *
-                                stateHistory_.at( j ) / stepSize_
-                                + interpolationCoefficients[ interpolationDerivativeIndex ][ order_ + j ] *
-                                derivHistory_.at( j );
-                    }
-                    tempStateHistory.push_back( midState );
-                    tempDerivativeHistory.push_back( midDerivative );
-                }
-            }
-            
-            // Set the new history and stepsize
-            stateHistory_ = tempStateHistory;
-            derivHistory_ = tempDerivativeHistory;
+
+            halveHistoryStepSize( possibleOrder, possibleHalvingOrder );
             stepSize_ = stepSize_ / 2.0;
             
             // Temporarily turn halving off.
@@ -404,8 +378,8 @@ public:
         // If the error (after order change ) is too small, the
         // stepsize isn't fixed and the and will not become too big,
         // then double the stepsize.
-        if ( errorTooSmall( predictorAbsoluteError, predictorRelativeError )
-             && sizeDerivativeHistory >= 2 * order_
+        if ( errorTooSmall( predictorAbsoluteError_, predictorRelativeError_ )
+             && possibleOrder >= 2 * order_
              && std::fabs( stepSize_ * 2.0 ) <= maximumStepSize_ && !fixedStepSize_ )
         {
             
@@ -418,45 +392,39 @@ public:
             // 2. The difference in the derivative of the predicted state (predictedDerivative_)
             //    at the normal stepsize (already computed) with the doubled stepsize (not computed)
             //    is neglibile. This assumption saves one function evaluation.
-            // It's possible to reuse previously defined variables here except for correctedState
+            // It's possible to reuse previously defined variables here except for correctedState_
             // which is still used below.
-            predictedState = performPredictorStep( order_ , true );
-            StateType doubleStepCorrectedState = performCorrectorStep( predictedState, order_, true );
-            predictorAbsoluteError = estimateAbsoluteError( predictedState, doubleStepCorrectedState, order_ );
-            predictorRelativeError = estimateRelativeError( predictedState, doubleStepCorrectedState,
-                                                            predictorAbsoluteError );
+            performPredictorStep( order_ , true, predictedState_ );
+            performCorrectorStep( predictedState_, order_, true, doubleStepCorrectedState_ );
+            estimateAbsoluteError( predictedState_, doubleStepCorrectedState_, order_, predictorAbsoluteError_ );
+            estimateRelativeError( predictedState_, doubleStepCorrectedState_, predictorAbsoluteError_,
+                                   predictorRelativeError_ );
 
             // Only update the history if the error will not be too large
-            if ( !errorTooLarge( predictorAbsoluteError, predictorRelativeError ) )
+            if ( !errorTooLarge( predictorAbsoluteError_, predictorRelativeError_ ) )
             {
                 // Note that the history should be at least 7 to allow successful
                 // continuation of the AM scheme.
-                std::deque< StateType > tempStateHistory;
-                std::deque< StateType > tempDerivativeHistory;
-                
-                // Use old history to fill new history, skipping every other entry starting at 1
-                for( unsigned int i = 1; i < sizeStateHistory; i += 2 )
-                {
-                    tempStateHistory.push_back( stateHistory_.at( i ));
-                }
-                for( unsigned int i = 1; i < sizeDerivativeHistory; i += 2 )
+                // Use old history to fill new history, skipping every other entry starting at 1. Entries are
+                // moved towards the front of the buffer, so each entry is read before it is overwritten.
+                int doubledHistorySize = history_.getSize( ) / 2;
+                for( int i = 0; i < doubledHistorySize; i++ )
                 {
-                    tempDerivativeHistory.push_back( derivHistory_.at( i ));
+                    history_.copyEntry( 2 * i + 1, i );
                 }
-                
-                // Set the new history and stepsize
-                stateHistory_ = tempStateHistory;
-                derivHistory_ = tempDerivativeHistory;
+                history_.truncate( doubledHistorySize );
+
+                // The history before this step is overwritten, so it can no longer be restored by a rollback.
+                lastHistorySize_ = 0;
                 stepSize_ = stepSize_ * 2.0;
             }
         } // end if ( errorTooSmall( ...
 
         // Move computed state to history
         currentIndependentVariable_ += lastStepSize_;
-        currentState_ = correctedState;
-        stateHistory_.push_front( currentState_ );
-        derivHistory_.push_front( this->stateDerivativeFunction_(
-                                      currentIndependentVariable_, currentState_ ) );
+        currentState_ = correctedState_;
+        addStateToHistory( currentState_, this->stateDerivativeFunction_(
+                               currentIndependentVariable_, currentState_ ) );
         return currentState_;
     }
 
@@ -476,16 +444,24 @@ public:
         }
         currentIndependentVariable_ = lastIndependentVariable_;
         stepSize_ = lastStepSize_;
-        stateHistory_.push_back( lastState_ );
-        derivHistory_.push_back( lastDerivative_ );
-        stateHistory_.pop_front( );
-        derivHistory_.pop_front( );
-        derivHistory_.pop_front( );
-        currentState_ = stateHistory_.front( );
+        currentState_ = lastState_;
+
+        // Restore the history as it was before the last step. The entries are still in the buffer, unless the history
+        // was modified in place when doubling the step size, in which case the history is restarted.
+        if( lastHistorySize_ > 0 )
+        {
+            history_.restoreLayout( lastHistoryHead_, lastHistorySize_ );
+        }
+        else
+        {
+            history_.truncate( 1 );
+            history_.setSegment( 0, 0, getFlatState( currentState_ ) );
+        }
+
         // Recalculate the derivative in order to make sure that all
         // update functions inside state derivative model get reactivated
-        derivHistory_.push_front( this->stateDerivativeFunction_(
-                                      currentIndependentVariable_, currentState_ ) );
+        history_.setSegment( 0, stateSize_, getFlatState(
+                                 this->stateDerivativeFunction_( currentIndependentVariable_, currentState_ ) ) );
         return true;
     }
 
@@ -504,9 +480,9 @@ public:
         currentState_ = newState;
 
         // Clear the history and initiate with new state and derivative.
-        stateHistory_[ 0 ] = currentState_;
-        derivHistory_[ 0 ] = this->stateDerivativeFunction_(
-                    currentIndependentVariable_, currentState_ );
+        history_.setSegment( 0, 0, getFlatState( currentState_ ) );
+        history_.setSegment( 0, stateSize_, getFlatState(
+                                 this->stateDerivativeFunction_( currentIndependentVariable_, currentState_ ) ) );
         if ( !allowRollback )
         {
             lastIndependentVariable_ = currentIndependentVariable_;
@@ -516,6 +492,64 @@ public:
         fixedSingleStep_ = fixedStepSize_;
     }
 
+    //! Function to write the internal state of the integrator to a binary stream.
+    /*!
+     * Function to write the internal state of the integrator to a binary stream, consisting of the current independent
+     * variable and state, the step size and order of the next step, the truncation errors of the last step and the
+     * history of states and state derivatives, so that the integration can be resumed with identical results.
+     * \param outputStream Stream to which the integrator state is to be written.
+     */
+    void writeStateToBinaryStream( std::ostream& outputStream )
+    {
+        utilities::writeToBinaryStream( outputStream, currentIndependentVariable_ );
+        utilities::writeToBinaryStream( outputStream, currentState_ );
+        utilities::writeToBinaryStream( outputStream, stepSize_ );
+        utilities::writeToBinaryStream( outputStream, lastStepSize_ );
+        utilities::writeToBinaryStream( outputStream, order_ );
+        utilities::writeToBinaryStream( outputStream, fixedSingleStep_ );
+        utilities::writeToBinaryStream( outputStream, absoluteError_ );
+        utilities::writeToBinaryStream( outputStream, relativeError_ );
+
+        // Write the history with entry i in column i.
+        utilities::writeToBinaryStream( outputStream, Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >(
+                                            history_.getRange( 0, history_.getSize( ), 1, 0, 2 * stateSize_ ) ) );
+    }
+
+    //! Function to read the internal state of the integrator from a binary stream.
+    /*!
+     * Function to read the internal state of the integrator from a binary stream, as written by
+     * writeStateToBinaryStream. The state cannot be rolled back after calling this function.
+     * \param inputStream Stream from which the integrator state is to be read.
+     */
+    void readStateFromBinaryStream( std::istream& inputStream )
+    {
+        utilities::readFromBinaryStream( inputStream, currentIndependentVariable_ );
+        utilities::readFromBinaryStream( inputStream, currentState_ );
+        utilities::readFromBinaryStream( inputStream, stepSize_ );
+        utilities::readFromBinaryStream( inputStream, lastStepSize_ );
+        utilities::readFromBinaryStream( inputStream, order_ );
+        utilities::readFromBinaryStream( inputStream, fixedSingleStep_ );
+        utilities::readFromBinaryStream( inputStream, absoluteError_ );
+        utilities::readFromBinaryStream( inputStream, relativeError_ );
+
+        Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > historyEntries;
+        utilities::readFromBinaryStream( inputStream, historyEntries );
+        if( historyEntries.rows( ) != 2 * stateSize_ || historyEntries.cols( ) < 1 ||
+                historyEntries.cols( ) > history_.getCapacity( ) )
+        {
+            throw std::runtime_error( "Error when reading Adams-Bashforth-Moulton integrator state, history is "
+                                      "incompatible with integrator." );
+        }
+        history_.resize( historyEntries.cols( ) );
+        for( int i = 0; i < historyEntries.cols( ); i++ )
+        {
+            history_.setSegment( i, 0, historyEntries.col( i ) );
+        }
+
+        lastIndependentVariable_ = currentIndependentVariable_;
+        lastHistorySize_ = 0;
+    }
+
     //! Return maximum truncation error.
     /*!
      * Return the truncation error to be estimated by computError( ).
@@ -542,7 +576,12 @@ public:
      * Return the last value of the derivative
      * \return last derivative value
      */
-    StateDerivativeType getLastDerivative( ){ return derivHistory_.front( ); }
+    StateDerivativeType getLastDerivative( )
+    {
+        StateDerivativeType lastDerivative = currentState_;
+        getFlatState( lastDerivative ) = history_.getSegment( 0, stateSize_, stateSize_ );
+        return lastDerivative;
+    }
 
     //! (Un )set fixed step size.
     /*!
@@ -838,23 +877,22 @@ protected:
     
     //! Perform predictor step.
     /*!
-     * Using the order find predicted estimate using the Adams-Bashforth predictor
+     * Using the order find predicted estimate using the Adams-Bashforth predictor. The derivatives from the history
+     * that are used are retrieved as a single (strided) block of the history buffer, so that the predictor is
+     * evaluated as a single matrix-vector product with the tabulated coefficients.
      * \param order Order of the integration.
      * \param doubleStep Boolean if stepsize should be considered double, true for estimating doubling error.
-     * \return state after predictor step
+     * \param predictedState State after predictor step (returned by reference).
      */
-    StateType performPredictorStep( unsigned int order, bool doubleStep )
+    void performPredictorStep( const unsigned int order, const bool doubleStep, StateType& predictedState )
     {
         // Calculate predicted state
-        unsigned int stepsToSkip = static_cast< unsigned int>( doubleStep );
-        TimeStepType stepSize = stepSize_ * static_cast< double >( stepsToSkip + 1 );
-        StateType predictedState = stateHistory_.at( stepsToSkip );
-        for ( unsigned int i = 0; i < order; i++ )
-        {
-            predictedState += extrapolationCoefficients[ order * 2 - 2 ][ i ] * stepSize *
-                    derivHistory_.at( i * ( stepsToSkip + 1 ) + stepsToSkip );
-        }
-        return predictedState;
+        int stepsToSkip = static_cast< int >( doubleStep );
+        StateScalarType stepSize = static_cast< StateScalarType >( stepSize_ * static_cast< double >( stepsToSkip + 1 ) );
+        getFlatState( predictedState ) = history_.getSegment( stepsToSkip, 0, stateSize_ );
+        getFlatState( predictedState ).noalias( ) +=
+                ( stepSize * history_.getRange( stepsToSkip, order, stepsToSkip + 1, stateSize_, stateSize_ ) ) *
+                getCoefficients( getExtrapolationCoefficientTable( ), order * 2 - 2, 0, order );
     }
 
     //! Perform correcter step.
@@ -863,20 +901,18 @@ protected:
      * \param predictedState by the predictor.
      * \param order of the integration.
      * \param doubleStep boolean if stepsize should be considered double, true for estimating doubling error.
-     * \return  after corrector step
+     * \param correctedState State after corrector step (returned by reference).
      */
-    StateType performCorrectorStep( StateType predictedState, unsigned int order, bool doubleStep )
+    void performCorrectorStep( const StateType& predictedState, const unsigned int order, const bool doubleStep,
+                               StateType& correctedState )
     {
-        unsigned int stepsToSkip = static_cast< unsigned int>( doubleStep );
-        TimeStepType stepSize = stepSize_ * static_cast< double >( stepsToSkip + 1 );
-        StateType correctedState = stateHistory_.at( stepsToSkip ) + extrapolationCoefficients[ order * 2 - 1 ][ 0 ] *
-                stepSize * predictedDerivative_;
-        for ( unsigned int i = 1; i < order; i++ )
-        {
-            correctedState += stepSize * extrapolationCoefficients[ order * 2 - 1 ][ i ] *
-                    derivHistory_.at( ( i - 1 ) * ( stepsToSkip + 1 ) + stepsToSkip );
-        }
-        return correctedState;
+        int stepsToSkip = static_cast< int >( doubleStep );
+        StateScalarType stepSize = static_cast< StateScalarType >( stepSize_ * static_cast< double >( stepsToSkip + 1 ) );
+        getFlatState( correctedState ) = history_.getSegment( stepsToSkip, 0, stateSize_ ) +
+                getExtrapolationCoefficientTable( )( order * 2 - 1, 0 ) * stepSize * getFlatState( predictedDerivative_ );
+        getFlatState( correctedState ).noalias( ) +=
+                ( stepSize * history_.getRange( stepsToSkip, order - 1, stepsToSkip + 1, stateSize_, stateSize_ ) ) *
+                getCoefficients( getExtrapolationCoefficientTable( ), order * 2 - 1, 1, order - 1 );
     }
 
     //! Estimate the absolute error
@@ -885,12 +921,13 @@ protected:
      * \param predictedState by the predictor.
      * \param correctedState by the corrector.
      * \param order of the integration.
-     * \return absolute error vector.
+     * \param absoluteError Absolute error vector (returned by reference).
      */
-    StateType estimateAbsoluteError( StateType predictedState, StateType correctedState, unsigned int order )
+    void estimateAbsoluteError( const StateType& predictedState, const StateType& correctedState,
+                                const unsigned int order, StateType& absoluteError )
     {
         // Estimate the maximum truncation error
-        return truncationErrorCoefficients[ order ] * ( predictedState - correctedState ).cwiseAbs( ).array( );
+        absoluteError = truncationErrorCoefficients[ order ] * ( predictedState - correctedState ).cwiseAbs( );
     }
 
     //! Estimate the relative error
@@ -899,12 +936,14 @@ protected:
      * \param predictedState by the predictor.
      * \param correctedState by the corrector.
      * \param absoluteError
-     * \return relative error vector.
+     * \param relativeError Relative error vector (returned by reference).
      */
-    StateType estimateRelativeError( StateType predictedState, StateType correctedState, StateType absoluteError )
+    void estimateRelativeError( const StateType& predictedState, const StateType& correctedState,
+                                const StateType& absoluteError, StateType& relativeError )
     {
         // Estimate the maximum truncation error
-        return absoluteError.cwiseQuotient( ( correctedState.cwiseAbs( ) ).cwiseMax( predictedState.cwiseAbs( ) ) );
+        relativeError = absoluteError.cwiseQuotient(
+                    ( correctedState.cwiseAbs( ) ).cwiseMax( predictedState.cwiseAbs( ) ) );
     }
 
     //! Compare two errors
@@ -917,23 +956,22 @@ protected:
      * \param relativeError2 relative error two.
      * \return true if one is better than two, false otherwise.
      */
-    bool errorCompare( StateType absoluteError1, StateType relativeError1,
-                       StateType absoluteError2, StateType relativeError2 )
+    bool errorCompare( const StateType& absoluteError1, const StateType& relativeError1,
+                       const StateType& absoluteError2, const StateType& relativeError2 )
     {
-        // Find compound error
-        StateType c1 = absoluteError1.cwiseMin( relativeError1 );
-        StateType c2 = absoluteError2.cwiseMin( relativeError2 );
         bool oneBetter = true;
         if( strictCompare_ )
         {
-            // Needs to be better or equal for each component
-            for( int i = 0; i < c1.size( ); ++i )
+            // Needs to be better or equal for each component of the compound error
+            for( int i = 0; i < absoluteError1.size( ); ++i )
             {
-                oneBetter = oneBetter && ( c1( i ) <= c2( i ) );
+                oneBetter = oneBetter && ( std::min( absoluteError1( i ), relativeError1( i ) ) <=
+                                           std::min( absoluteError2( i ), relativeError2( i ) ) );
             }
         } else {
             // Needs to be overal better
-            oneBetter = ( c1.norm( ) <= c2.norm( ) );
+            oneBetter = ( absoluteError1.cwiseMin( relativeError1 ).norm( ) <=
+                          absoluteError2.cwiseMin( relativeError2 ).norm( ) );
         }
         return oneBetter;
     }
@@ -946,7 +984,7 @@ protected:
      * \param relativeError relative error.
      * \return true if one error is too big, false if within limits
      */
-    bool errorTooLarge( StateType absoluteError, StateType relativeError )
+    bool errorTooLarge( const StateType& absoluteError, const StateType& relativeError )
     {
         bool belowLimit = true;
         // All components needs to be below the upper limit (tol)
@@ -967,7 +1005,7 @@ protected:
      * \param relativeError relative error.
      * \return true if one error is too small, false if within limits
      */
-    bool errorTooSmall( StateType absoluteError, StateType relativeError )
+    bool errorTooSmall( const StateType& absoluteError, const StateType& relativeError )
     {
         bool belowLimit = true;
         // All components need to be above lower limit ( tol / bw )
@@ -980,6 +1018,140 @@ protected:
         return belowLimit;
     }
 
+    //! Function to halve the step size of the history.
+    /*!
+     * Function to halve the step size of the history, by interpolating the states and state derivatives halfway
+     * between the entries of the current history. The history is modified in place: the interpolated entries are
+     * first computed in unused entries beyond the current history, after which the existing entries are moved to the
+     * even entries (starting from the back, so that no entry is overwritten before it is moved) and the interpolated
+     * entries to the odd entries. The current order_ is used for the interpolation.
+     * \param currentHistorySize Number of entries in the history before halving.
+     * \param halvedHistorySize Number of entries in the history after halving.
+     */
+    void halveHistoryStepSize( const unsigned int currentHistorySize, const unsigned int halvedHistorySize )
+    {
+        int numberOfMidPoints = static_cast< int >( halvedHistorySize / 2 );
+        int firstMidPointEntry = static_cast< int >( std::max( currentHistorySize, halvedHistorySize ) );
+        history_.resize( firstMidPointEntry + numberOfMidPoints );
+
+        // Compute mid points from first order_ entries of the history.
+        StateScalarType stepSize = static_cast< StateScalarType >( stepSize_ );
+        const CoefficientTable& interpolationCoefficientTable = getInterpolationCoefficientTable( );
+        unsigned int interpolationStateIndex;
+        unsigned int interpolationDerivativeIndex;
+        for( int i = 0; i < numberOfMidPoints; i++ )
+        {
+            interpolationDerivativeIndex = ( order_ - 1 ) * ( order_ - 1 ) + i;
+            interpolationStateIndex = interpolationDerivativeIndex - order_ + 1;
+
+            interpolatedState_.noalias( ) =
+                    history_.getRange( 0, order_, 1, 0, stateSize_ ) *
+                    getCoefficients( interpolationCoefficientTable, interpolationStateIndex, 0, order_ );
+            interpolatedState_.noalias( ) +=
+                    ( stepSize * history_.getRange( 0, order_, 1, stateSize_, stateSize_ ) ) *
+                    getCoefficients( interpolationCoefficientTable, interpolationStateIndex, order_, order_ );
+            interpolatedDerivative_.noalias( ) =
+                    ( history_.getRange( 0, order_, 1, 0, stateSize_ ) / stepSize ) *
+                    getCoefficients( interpolationCoefficientTable, interpolationDerivativeIndex, 0, order_ );
+            interpolatedDerivative_.noalias( ) +=
+                    history_.getRange( 0, order_, 1, stateSize_, stateSize_ ) *
+                    getCoefficients( interpolationCoefficientTable, interpolationDerivativeIndex, order_, order_ );
+
+            history_.setSegment( firstMidPointEntry + i, 0, interpolatedState_ );
+            history_.setSegment( firstMidPointEntry + i, stateSize_, interpolatedDerivative_ );
+        }
+
+        // Spread existing entries over even entries, and fill odd entries with mid points.
+        for( int i = static_cast< int >( ( halvedHistorySize + 1 ) / 2 ) - 1; i > 0; i-- )
+        {
+            history_.copyEntry( i, 2 * i );
+        }
+        for( int i = 0; i < numberOfMidPoints; i++ )
+        {
+            history_.copyEntry( firstMidPointEntry + i, 2 * i + 1 );
+        }
+        history_.resize( static_cast< int >( halvedHistorySize ) );
+    }
+
+    //! Function to add a state and its derivative as most recent entry of the history.
+    /*!
+     * Function to add a state and its derivative as most recent entry of the history.
+     * \param state State that is to be added.
+     * \param stateDerivative State derivative that is to be added.
+     */
+    void addStateToHistory( const StateType& state, const StateDerivativeType& stateDerivative )
+    {
+        history_.pushFront( );
+        history_.setSegment( 0, 0, getFlatState( state ) );
+        history_.setSegment( 0, stateSize_, getFlatState( stateDerivative ) );
+    }
+
+    //! Function to retrieve a state (or state derivative) as a single column vector, without copying.
+    /*!
+     * Function to retrieve a state (or state derivative) as a single column vector, without copying.
+     * \param state State that is to be retrieved as column vector.
+     * \return Column vector view of state.
+     */
+    static Eigen::Map< const FlatStateType > getFlatState( const StateType& state )
+    {
+        return Eigen::Map< const FlatStateType >( state.data( ), state.size( ) );
+    }
+
+    //! Function to retrieve a state (or state derivative) as a single, modifiable, column vector, without copying.
+    /*!
+     * Function to retrieve a state (or state derivative) as a single, modifiable, column vector, without copying.
+     * \param state State that is to be retrieved as column vector.
+     * \return Column vector view of state.
+     */
+    static Eigen::Map< FlatStateType > getFlatState( StateType& state )
+    {
+        return Eigen::Map< FlatStateType >( state.data( ), state.size( ) );
+    }
+
+    //! Function to retrieve the extrapolation coefficients as a table in the scalar type of the state.
+    /*!
+     * Function to retrieve the extrapolation coefficients as a table in the scalar type of the state, which is created
+     * once for each state scalar type.
+     * \return Table of extrapolation coefficients.
+     */
+    static const CoefficientTable& getExtrapolationCoefficientTable( )
+    {
+        static const CoefficientTable extrapolationCoefficientTable =
+                Eigen::Map< const Eigen::Matrix< double, 24, 12, Eigen::RowMajor > >(
+                    &extrapolationCoefficients[ 0 ][ 0 ] ).template cast< StateScalarType >( );
+        return extrapolationCoefficientTable;
+    }
+
+    //! Function to retrieve the interpolation coefficients as a table in the scalar type of the state.
+    /*!
+     * Function to retrieve the interpolation coefficients as a table in the scalar type of the state, which is created
+     * once for each state scalar type.
+     * \return Table of interpolation coefficients.
+     */
+    static const CoefficientTable& getInterpolationCoefficientTable( )
+    {
+        static const CoefficientTable interpolationCoefficientTable =
+                Eigen::Map< const Eigen::Matrix< double, 132, 24, Eigen::RowMajor > >(
+                    &interpolationCoefficients[ 0 ][ 0 ] ).template cast< StateScalarType >( );
+        return interpolationCoefficientTable;
+    }
+
+    //! Function to retrieve (part of) a row of a coefficient table as a column vector, without copying.
+    /*!
+     * Function to retrieve (part of) a row of a coefficient table as a column vector, without copying.
+     * \param coefficientTable Table from which coefficients are to be retrieved.
+     * \param row Row of the table from which coefficients are to be retrieved.
+     * \param firstColumn Column of first coefficient that is to be retrieved.
+     * \param numberOfCoefficients Number of coefficients that is to be retrieved.
+     * \return Column vector view of the coefficients.
+     */
+    static Eigen::Map< const FlatStateType > getCoefficients(
+            const CoefficientTable& coefficientTable, const unsigned int row, const unsigned int firstColumn,
+            const unsigned int numberOfCoefficients )
+    {
+        return Eigen::Map< const FlatStateType >(
+                    coefficientTable.data( ) + row * coefficientTable.cols( ) + firstColumn, numberOfCoefficients );
+    }
 
     //! Last used step size.
     /*!
@@ -994,21 +1166,58 @@ protected:
      */
     StateDerivativeType predictedDerivative_;
 
-    //! State history.
+    //! Maximum number of entries in the history.
     /*!
-     * History of states, dynamic deque size depends on order.
+     * Maximum number of entries in the history. The history is truncated to twice the order at the start of each step,
+     * and may temporarily need room for the mid points (at most half the maximum order) when halving the step size.
      */
-    std::deque<StateType> stateHistory_;
+    static const int maximumHistorySize = 36;
+
+    //! Size of the state (number of entries in the state vector or matrix).
+    int stateSize_;
+
+    //! History of states and state derivatives.
+    /*!
+     * History of states and state derivatives, stored in a circular buffer with each entry consisting of a state
+     * (first stateSize_ rows) and its derivative (last stateSize_ rows), with the most recent entry at index 0.
+     * The number of entries depends on order.
+     */
+    MultistepHistoryBuffer< StateScalarType > history_;
+
+    //! Position of the most recent entry of the history before the last step (for rollback).
+    int lastHistoryHead_;
 
-    //! Derivative history.
+    //! Number of entries in the history before the last step (for rollback).
     /*!
-     * History of derivatives, dynamic deque size depends on order.
+     * Number of entries in the history before the last step (for rollback), zero if the history before the last step
+     * has been overwritten.
      */
-    std::deque<StateType> derivHistory_;
+    int lastHistorySize_;
+
+    //! Predicted state, as computed by performPredictorStep( ).
+    StateType predictedState_;
+
+    //! Corrected state, as computed by performCorrectorStep( ), to be used as state after the current step.
+    StateType correctedState_;
+
+    //! Corrected state, as computed by performCorrectorStep( ) for a step of twice the current step size.
+    StateType doubleStepCorrectedState_;
+
+    //! Absolute truncation error for order or step size different from current order and step size.
+    StateType predictorAbsoluteError_;
+
+    //! Relative truncation error for order or step size different from current order and step size.
+    StateType predictorRelativeError_;
+
+    //! State interpolated between two entries of the history, used when halving the step size.
+    FlatStateType interpolatedState_;
+
+    //! State derivative interpolated between two entries of the history, used when halving the step size.
+    FlatStateType interpolatedDerivative_;
 
     //! Last state.
     /*!
-     * Last state as computed by performIntegrationStep( ).
+     * State at the start of the last step, as computed by performIntegrationStep( ).
      */
     StateType lastState_;
 
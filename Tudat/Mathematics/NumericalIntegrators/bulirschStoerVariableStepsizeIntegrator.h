@@ -23,11 +23,13 @@
 #define TUDAT_BULIRSCH_STOER_VARIABLE_STEP_SIZE_INTEGRATOR_H
 
 #include <cmath>
+#include <future>
 
 #include <boost/assign/std/vector.hpp>
 
 #include <Eigen/Core>
 
+#include <Tudat/Basics/parallelization.h>
 #include <Tudat/Mathematics/NumericalIntegrators/numericalIntegrator.h>
 #include <Tudat/Mathematics/BasicMathematics/mathematicalConstants.h>
 
@@ -224,10 +226,6 @@ public:
      */
     virtual StateType performIntegrationStep( const TimeStepType stepSize )
     {
-        StateType stateAtFirstPoint_;
-        StateType stateAtCenterPoint_;
-        StateType stateAtLastPoint_;
-
         bool stepSuccessful = 0;
 
         // Compute sub steps to take.
@@ -237,35 +235,46 @@ public:
                         sequence_.at( p ) );
         }
 
-        double errorScaleTerm = TUDAT_NAN;
-        for ( unsigned int i = 0; i <= maximumStepIndex_; i++ )
+        // Compute state derivative at start of step, which is identical for all entries of the sequence.
+        const StateDerivativeType initialStateDerivative =
+                this->stateDerivativeFunction_( currentIndependentVariable_, currentState_ );
+
+        // Integrate over the step with the modified mid-point rule, for each entry of the sequence. These integrations are
+        // mutually independent, and are executed concurrently if additional state derivative functions are set. The
+        // calling thread integrates the last entry (with the largest number of sub steps), so that the state derivative
+        // function of this integrator is last evaluated at the same time and state as for the sequential evaluation. The
+        // other entries are distributed over the additional threads, starting with the largest number of sub steps.
+        if( additionalStateDerivativeFunctions_.size( ) > 0 )
         {
-            // Compute Euler step and set as state at center point for use with mid-point method.
-            stateAtCenterPoint_ = currentState_ + subSteps_.at( i )
-                    * this->stateDerivativeFunction_( currentIndependentVariable_, currentState_ );
-
-            // Apply modified mid-point rule.
-            stateAtFirstPoint_ = currentState_;
-            IndependentVariableType independentVariableAtFirstPoint_ = currentIndependentVariable_;
-            for ( unsigned int j = 0; j < sequence_.at( i ) - 1; j++ )
+            std::future< void > additionalThreadsResult = std::async( std::launch::async, [ & ]( )
             {
-                stateAtLastPoint_ = executeMidPointMethod(
-                            stateAtFirstPoint_, stateAtCenterPoint_,
-                            independentVariableAtFirstPoint_, subSteps_.at( i ) );
-
-                if ( j < sequence_.at( i ) - 2 )
+                utilities::executeParallelLoopWithWorkerIndex(
+                            maximumStepIndex_, additionalStateDerivativeFunctions_.size( ),
+                            [ & ]( const int iterationIndex, const int workerIndex )
                 {
-                    stateAtFirstPoint_ = stateAtCenterPoint_;
-                    stateAtCenterPoint_ = stateAtLastPoint_;
-                    independentVariableAtFirstPoint_ += subSteps_.at( i );
-                }
+                    const unsigned int sequenceIndex = maximumStepIndex_ - 1 - iterationIndex;
+                    integratedStates_[ sequenceIndex ][ 0 ] = executeModifiedMidPointMethod(
+                                sequenceIndex, stepSize, initialStateDerivative,
+                                additionalStateDerivativeFunctions_.at( workerIndex ) );
+                } );
+            } );
+            integratedStates_[ maximumStepIndex_ ][ 0 ] = executeModifiedMidPointMethod(
+                        maximumStepIndex_, stepSize, initialStateDerivative, this->stateDerivativeFunction_ );
+            additionalThreadsResult.get( );
+        }
+        else
+        {
+            for ( unsigned int i = 0; i <= maximumStepIndex_; i++ )
+            {
+                integratedStates_[ i ][ 0 ] = executeModifiedMidPointMethod(
+                            i, stepSize, initialStateDerivative, this->stateDerivativeFunction_ );
             }
+        }
 
-            // Apply end-point correction.
-            integratedStates_[ i ][ 0 ]
-                    = 0.5 * ( stateAtLastPoint_ + stateAtCenterPoint_+ subSteps_.at( i ) * this->stateDerivativeFunction_(
-                                  currentIndependentVariable_ + stepSize, stateAtLastPoint_ ) );
-
+        // Extrapolate results of modified mid-point method to zero sub step size.
+        double errorScaleTerm = TUDAT_NAN;
+        for ( unsigned int i = 0; i <= maximumStepIndex_; i++ )
+        {
             for ( unsigned int k = 1; k < i + 1; k++ )
             {
                 integratedStates_[ i ][ k ] =
@@ -363,6 +372,37 @@ public:
         return true;
     }
 
+    //! Function to set the state derivative functions used for parallel evaluation of the extrapolation sequence.
+    /*!
+     * Function to set the state derivative functions used for parallel evaluation of the extrapolation sequence. In each
+     * step, the integrations over the step with the different numbers of sub steps in the sequence are mutually
+     * independent, and are executed concurrently, using 1 + N threads, with N the number of additional functions. The
+     * calling thread uses the state derivative function of this integrator for the entry with the largest number of sub
+     * steps (which is also the last entry in the sequential evaluation), the other entries are integrated by the additional
+     * threads, where additional thread i uses the i-th function provided here. As a result, the functions must not share
+     * any data that is modified during their evaluation: for a propagation, each function must be bound to a separate copy
+     * of the dynamical model and environment (e.g. created with the same settings from a separate body map), which must be
+     * equivalent to that of this integrator. The integration result is then identical to that of the sequential evaluation,
+     * and the state derivative function of this integrator is last evaluated at the same time and state.
+     * \param additionalStateDerivativeFunctions State derivative functions used for the additional threads. An empty
+     * list reverts to the (default) sequential evaluation.
+     */
+    void setAdditionalStateDerivativeFunctions(
+            const std::vector< StateDerivativeFunction >& additionalStateDerivativeFunctions )
+    {
+        additionalStateDerivativeFunctions_ = additionalStateDerivativeFunctions;
+    }
+
+    //! Function to retrieve the number of threads used for the evaluation of the extrapolation sequence.
+    /*!
+     * Function to retrieve the number of threads used for the evaluation of the extrapolation sequence.
+     * \return Number of threads used for the evaluation of the extrapolation sequence.
+     */
+    unsigned int getNumberOfThreads( ) const
+    {
+        return additionalStateDerivativeFunctions_.size( ) + 1;
+    }
+
     //! Check if minimum step size constraint was violated.
     /*!
      * Returns true if the minimum step size constraint has been violated since this integrator
@@ -395,6 +435,24 @@ public:
         }
     }
 
+    //! Modify the state and time for the current step.
+    /*!
+     * Modify the state and time for the current step.
+     * \param newState The new state to set the current state to.
+     * \param newTime The time to set the current time to.
+     * \param allowRollback Boolean denoting whether roll-back should be allowed.
+     */
+    void modifyCurrentIntegrationVariables( const StateType& newState, const IndependentVariableType newTime,
+                                            const bool allowRollback = false )
+    {
+        currentState_ = newState;
+        currentIndependentVariable_ = newTime;
+        if ( !allowRollback )
+        {
+            this->lastIndependentVariable_ = currentIndependentVariable_;
+        }
+    }
+
 private:
 
     //! Last used step size.
@@ -493,15 +551,59 @@ private:
      * \param stateAtCenterPoint State at center point.
      * \param independentVariableAtFirstPoint Independent variable at first point.
      * \param subStepSize Sub step size between successive states used by mid-point method.
+     * \param stateDerivativeFunction State derivative function that is to be used.
      * \return Result of midpoint method
      */
-    StateType executeMidPointMethod( StateType stateAtFirstPoint, StateType stateAtCenterPoint,
+    StateType executeMidPointMethod( const StateType& stateAtFirstPoint, const StateType& stateAtCenterPoint,
                                      const IndependentVariableType independentVariableAtFirstPoint,
-                                     const IndependentVariableType subStepSize )
+                                     const IndependentVariableType subStepSize,
+                                     const StateDerivativeFunction& stateDerivativeFunction )
     {
         return stateAtFirstPoint + 2.0 * subStepSize
-                * this->stateDerivativeFunction_( independentVariableAtFirstPoint + subStepSize,
-                                                  stateAtCenterPoint );
+                * stateDerivativeFunction( independentVariableAtFirstPoint + subStepSize, stateAtCenterPoint );
+    }
+
+    //! Execute modified mid-point method over the full step, for a single entry of the sequence.
+    /*!
+     * Executes modified mid-point method over the full step, using the number of sub steps of a single entry of the
+     * sequence, including the end-point correction. Only local variables and the given state derivative function are
+     * modified, so that this function can be called concurrently for different entries of the sequence.
+     * \param sequenceIndex Index of the entry of the sequence that is to be used.
+     * \param stepSize Size of the full step.
+     * \param initialStateDerivative State derivative at the start of the step.
+     * \param stateDerivativeFunction State derivative function that is to be used.
+     * \return Result of modified mid-point method at the end of the step.
+     */
+    StateType executeModifiedMidPointMethod( const unsigned int sequenceIndex, const TimeStepType stepSize,
+                                             const StateDerivativeType& initialStateDerivative,
+                                             const StateDerivativeFunction& stateDerivativeFunction )
+    {
+        const double subStepSize = subSteps_.at( sequenceIndex );
+
+        // Compute Euler step and set as state at center point for use with mid-point method.
+        StateType stateAtCenterPoint = currentState_ + subStepSize * initialStateDerivative;
+
+        // Apply modified mid-point rule.
+        StateType stateAtFirstPoint = currentState_;
+        StateType stateAtLastPoint;
+        IndependentVariableType independentVariableAtFirstPoint = currentIndependentVariable_;
+        for ( unsigned int j = 0; j < sequence_.at( sequenceIndex ) - 1; j++ )
+        {
+            stateAtLastPoint = executeMidPointMethod(
+                        stateAtFirstPoint, stateAtCenterPoint, independentVariableAtFirstPoint, subStepSize,
+                        stateDerivativeFunction );
+
+            if ( j < sequence_.at( sequenceIndex ) - 2 )
+            {
+                stateAtFirstPoint = stateAtCenterPoint;
+                stateAtCenterPoint = stateAtLastPoint;
+                independentVariableAtFirstPoint += subStepSize;
+            }
+        }
+
+        // Apply end-point correction.
+        return 0.5 * ( stateAtLastPoint + stateAtCenterPoint + subStepSize * stateDerivativeFunction(
+                           currentIndependentVariable_ + stepSize, stateAtLastPoint ) );
     }
 
     std::vector< std::vector< StateType > > integratedStates_;
@@ -510,6 +612,9 @@ private:
 
     std::vector< double > subSteps_;
 
+    //! State derivative functions used by the additional threads for parallel evaluation of the extrapolation sequence.
+    std::vector< StateDerivativeFunction > additionalStateDerivativeFunctions_;
+
 };
 
 extern template class BulirschStoerVariableStepSizeIntegrator < double, Eigen::VectorXd, Eigen::VectorXd >;
@@ -14,6 +14,7 @@
 #include <boost/make_shared.hpp>
 #include <memory>
 #include <boost/lexical_cast.hpp>
+#include <vector>
 
 #include "Tudat/Basics/timeType.h"
 #include "Tudat/Mathematics/NumericalIntegrators/bulirschStoerVariableStepsizeIntegrator.h"
@@ -21,7 +22,10 @@
 #include "Tudat/Mathematics/NumericalIntegrators/rungeKutta4Integrator.h"
 #include "Tudat/Mathematics/NumericalIntegrators/euler.h"
 #include "Tudat/Mathematics/NumericalIntegrators/adamsBashforthMoultonIntegrator.h"
+#include "Tudat/Mathematics/NumericalIntegrators/gaussJacksonIntegrator.h"
+#include "Tudat/Mathematics/NumericalIntegrators/gaussLegendreIntegrator.h"
 #include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaVariableStepSizeIntegrator.h"
+#include "Tudat/Mathematics/NumericalIntegrators/yoshidaSymplecticIntegrator.h"
 
 #include "Tudat/Mathematics/NumericalIntegrators/createNumericalIntegrator.h"
 
@@ -38,7 +42,10 @@ enum AvailableIntegrators
     rungeKutta4,
     rungeKuttaVariableStepSize,
     bulirschStoer,
-    adamsBashforthMoulton
+    adamsBashforthMoulton,
+    gaussJackson,
+    yoshidaSymplectic,
+    gaussLegendre
 };
 
 //! Class to define settings of numerical integrator
@@ -80,6 +87,17 @@ public:
      */
     virtual ~IntegratorSettings( ) { }
 
+    //! Function to create a copy of the integrator settings.
+    /*!
+     *  Function to create a copy of the integrator settings (e.g. for use in a separate propagation, which may modify the
+     *  initial time of the settings).
+     *  \return Copy of the integrator settings
+     */
+    virtual std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
+    {
+        return std::make_shared< IntegratorSettings< IndependentVariableType > >( *this );
+    }
+
     //! Type of numerical integrator
     /*!
      *  Type of numerical integrator, from enum of available integrators.
@@ -115,6 +133,16 @@ public:
      */
     bool assessPropagationTerminationConditionDuringIntegrationSubsteps_;
 
+    //! Epochs at which the numerical integration result is to be saved (sorted in ascending order).
+    /*!
+     * Epochs (independent variable values) at which the numerical integration result is to be saved, sorted in
+     * ascending order. If empty (default), the result is saved every saveFrequency_ integration steps. If not empty,
+     * the result is saved only at these epochs (saveFrequency_ is then ignored), using the dense output of the
+     * integrator (see NumericalIntegrator::getDenseOutputState), so that the step size is not constrained by the output
+     * epochs. Currently only supported for the RKF78 and RK87 (Dormand-Prince) variable step-size integrators.
+     */
+    std::vector< IndependentVariableType > requestedOutputTimes_;
+
 };
 
 //! Base class to define settings of variable step RK numerical integrator.
@@ -310,6 +338,17 @@ public:
      */
     ~RungeKuttaVariableStepSizeSettingsScalarTolerances( ) { }
 
+    //! Function to create a copy of the integrator settings.
+    /*!
+     *  Function to create a copy of the integrator settings (e.g. for use in a separate propagation, which may modify the
+     *  initial time of the settings).
+     *  \return Copy of the integrator settings
+     */
+    std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
+    {
+        return std::make_shared< RungeKuttaVariableStepSizeSettingsScalarTolerances< IndependentVariableType > >( *this );
+    }
+
     //! Relative error tolerance for step size control.
     IndependentVariableType relativeErrorTolerance_;
 
@@ -376,6 +415,17 @@ public:
      */
     ~RungeKuttaVariableStepSizeSettingsVectorTolerances( ) { }
 
+    //! Function to create a copy of the integrator settings.
+    /*!
+     *  Function to create a copy of the integrator settings (e.g. for use in a separate propagation, which may modify the
+     *  initial time of the settings).
+     *  \return Copy of the integrator settings
+     */
+    std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
+    {
+        return std::make_shared< RungeKuttaVariableStepSizeSettingsVectorTolerances< IndependentVariableType, DependentVariableType > >( *this );
+    }
+
     //! Relative error tolerance for step size control.
     DependentVariableType relativeErrorTolerance_;
 
@@ -440,6 +490,17 @@ public:
      */
     ~BulirschStoerIntegratorSettings( ){ }
 
+    //! Function to create a copy of the integrator settings.
+    /*!
+     *  Function to create a copy of the integrator settings (e.g. for use in a separate propagation, which may modify the
+     *  initial time of the settings).
+     *  \return Copy of the integrator settings
+     */
+    std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
+    {
+        return std::make_shared< BulirschStoerIntegratorSettings< IndependentVariableType > >( *this );
+    }
+
     //! Type of sequence that is to be used for Bulirsch-Stoer integrator
     ExtrapolationMethodStepSequences extrapolationSequence_;
 
@@ -528,6 +589,17 @@ public:
      */
     ~AdamsBashforthMoultonSettings( ){ }
 
+    //! Function to create a copy of the integrator settings.
+    /*!
+     *  Function to create a copy of the integrator settings (e.g. for use in a separate propagation, which may modify the
+     *  initial time of the settings).
+     *  \return Copy of the integrator settings
+     */
+    std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
+    {
+        return std::make_shared< AdamsBashforthMoultonSettings< IndependentVariableType > >( *this );
+    }
+
     //! Minimum step size for integration.
     /*!
      *  Minimum step size for integration. Integration stops (exception thrown) if time step comes below this value.
@@ -554,12 +626,201 @@ public:
 
 };
 
+//! Class to define settings of fixed step Gauss-Jackson numerical integrator
+/*!
+ *  Class to define settings of fixed step Gauss-Jackson (summed Stormer-Cowell) numerical integrator, for use in
+ *  numerical integration of translational equations of motion in Cartesian elements (Cowell propagator), and the
+ *  associated variational equations.
+ */
+template< typename IndependentVariableType = double >
+class GaussJacksonIntegratorSettings: public IntegratorSettings< IndependentVariableType >
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor for Gauss-Jackson integrator settings.
+     *  \param initialTime Start time (independent variable) of numerical integration.
+     *  \param stepSize Time (independent variable) step used in numerical integration.
+     *  \param order Order of integrator, equal to the number of backward accelerations used minus one (default 8).
+     *  \param numberOfCorrectorIterations Number of evaluate-correct iterations (and state derivative evaluations)
+     *      per step (default 1).
+     *  \param saveFrequency Frequency at which to save the numerical integrated states (in units of i.e. per n integration
+     *      time steps, with n = saveFrequency).
+     *  \param assessPropagationTerminationConditionDuringIntegrationSubsteps Whether the propagation termination
+     *      conditions should be evaluated during the intermediate sub-steps of the integrator (`true`) or only at the end of
+     *      each integration step (`false`).
+     */
+    GaussJacksonIntegratorSettings(
+            const IndependentVariableType initialTime,
+            const IndependentVariableType stepSize,
+            const int order = 8,
+            const int numberOfCorrectorIterations = 1,
+            const int saveFrequency = 1,
+            const bool assessPropagationTerminationConditionDuringIntegrationSubsteps = false ):
+        IntegratorSettings< IndependentVariableType >(
+            gaussJackson, initialTime, stepSize, saveFrequency,
+            assessPropagationTerminationConditionDuringIntegrationSubsteps ),
+        order_( order ), numberOfCorrectorIterations_( numberOfCorrectorIterations ) { }
+
+    //! Destructor
+    /*!
+     *  Destructor
+     */
+    ~GaussJacksonIntegratorSettings( ){ }
+
+    //! Function to create a copy of the integrator settings.
+    /*!
+     *  Function to create a copy of the integrator settings (e.g. for use in a separate propagation, which may modify the
+     *  initial time of the settings).
+     *  \return Copy of the integrator settings
+     */
+    std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
+    {
+        return std::make_shared< GaussJacksonIntegratorSettings< IndependentVariableType > >( *this );
+    }
+
+    //! Order of integrator
+    int order_;
+
+    //! Number of evaluate-correct iterations per step
+    int numberOfCorrectorIterations_;
+
+};
+
+//! Class to define settings of fixed step Yoshida symplectic numerical integrator
+/*!
+ *  Class to define settings of fixed step symplectic numerical integrator composed of leapfrog steps (Yoshida), for use
+ *  in long-term numerical integration of translational equations of motion in Cartesian elements (Cowell propagator)
+ *  with conservative (position-dependent) accelerations.
+ */
+template< typename IndependentVariableType = double >
+class YoshidaSymplecticIntegratorSettings: public IntegratorSettings< IndependentVariableType >
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor for Yoshida symplectic integrator settings.
+     *  \param initialTime Start time (independent variable) of numerical integration.
+     *  \param stepSize Time (independent variable) step used in numerical integration.
+     *  \param order Order of integrator, 2, 4, 6 or 8 (default 6).
+     *  \param saveFrequency Frequency at which to save the numerical integrated states (in units of i.e. per n integration
+     *      time steps, with n = saveFrequency).
+     *  \param assessPropagationTerminationConditionDuringIntegrationSubsteps Whether the propagation termination
+     *      conditions should be evaluated during the intermediate sub-steps of the integrator (`true`) or only at the end of
+     *      each integration step (`false`).
+     */
+    YoshidaSymplecticIntegratorSettings(
+            const IndependentVariableType initialTime,
+            const IndependentVariableType stepSize,
+            const int order = 6,
+            const int saveFrequency = 1,
+            const bool assessPropagationTerminationConditionDuringIntegrationSubsteps = false ):
+        IntegratorSettings< IndependentVariableType >(
+            yoshidaSymplectic, initialTime, stepSize, saveFrequency,
+            assessPropagationTerminationConditionDuringIntegrationSubsteps ),
+        order_( order ) { }
+
+    //! Destructor
+    /*!
+     *  Destructor
+     */
+    ~YoshidaSymplecticIntegratorSettings( ){ }
+
+    //! Function to create a copy of the integrator settings.
+    /*!
+     *  Function to create a copy of the integrator settings (e.g. for use in a separate propagation, which may modify the
+     *  initial time of the settings).
+     *  \return Copy of the integrator settings
+     */
+    std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
+    {
+        return std::make_shared< YoshidaSymplecticIntegratorSettings< IndependentVariableType > >( *this );
+    }
+
+    //! Order of integrator
+    int order_;
+
+};
+
+//! Class to define settings of fixed step implicit Gauss-Legendre numerical integrator
+/*!
+ *  Class to define settings of fixed step implicit Runge-Kutta integrator of the Gauss-Legendre family, which is
+ *  symplectic and of order twice its number of stages, for use in long-term numerical integration.
+ */
+template< typename IndependentVariableType = double >
+class GaussLegendreIntegratorSettings: public IntegratorSettings< IndependentVariableType >
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor for Gauss-Legendre integrator settings.
+     *  \param initialTime Start time (independent variable) of numerical integration.
+     *  \param stepSize Time (independent variable) step used in numerical integration.
+     *  \param numberOfStages Number of stages, 1 to 6 (default 3, order 6).
+     *  \param maximumNumberOfIterations Maximum number of fixed-point iterations per step (default 50).
+     *  \param iterationTolerance Relative tolerance at which the fixed-point iteration is considered converged
+     *      (default 1.0E-15).
+     *  \param saveFrequency Frequency at which to save the numerical integrated states (in units of i.e. per n integration
+     *      time steps, with n = saveFrequency).
+     *  \param assessPropagationTerminationConditionDuringIntegrationSubsteps Whether the propagation termination
+     *      conditions should be evaluated during the intermediate sub-steps of the integrator (`true`) or only at the end of
+     *      each integration step (`false`).
+     */
+    GaussLegendreIntegratorSettings(
+            const IndependentVariableType initialTime,
+            const IndependentVariableType stepSize,
+            const int numberOfStages = 3,
+            const int maximumNumberOfIterations = 50,
+            const double iterationTolerance = 1.0E-15,
+            const int saveFrequency = 1,
+            const bool assessPropagationTerminationConditionDuringIntegrationSubsteps = false ):
+        IntegratorSettings< IndependentVariableType >(
+            gaussLegendre, initialTime, stepSize, saveFrequency,
+            assessPropagationTerminationConditionDuringIntegrationSubsteps ),
+        numberOfStages_( numberOfStages ), maximumNumberOfIterations_( maximumNumberOfIterations ),
+        iterationTolerance_( iterationTolerance ) { }
+
+    //! Destructor
+    /*!
+     *  Destructor
+     */
+    ~GaussLegendreIntegratorSettings( ){ }
+
+    //! Function to create a copy of the integrator settings.
+    /*!
+     *  Function to create a copy of the integrator settings (e.g. for use in a separate propagation, which may modify the
+     *  initial time of the settings).
+     *  \return Copy of the integrator settings
+     */
+    std::shared_ptr< IntegratorSettings< IndependentVariableType > > clone( ) const
+    {
+        return std::make_shared< GaussLegendreIntegratorSettings< IndependentVariableType > >( *this );
+    }
+
+    //! Number of stages
+    int numberOfStages_;
+
+    //! Maximum number of fixed-point iterations per step
+    int maximumNumberOfIterations_;
+
+    //! Relative tolerance of fixed-point iteration
+    double iterationTolerance_;
+
+};
+
 //! Function to create a numerical integrator.
 /*!
  *  Function to create a numerical integrator from given integrator settings, state derivative function and initial state.
  *  \param stateDerivativeFunction Function returning the state derivative from current time and state.
  *  \param initialState Initial state for numerical integration.
  *  \param integratorSettings Settings for numerical integrator.
+ *  \param additionalStateDerivativeFunctions State derivative functions, equivalent to stateDerivativeFunction, with
+ *  which the extrapolation sequence of a Bulirsch-Stoer integrator is evaluated concurrently (see
+ *  BulirschStoerVariableStepSizeIntegrator::setAdditionalStateDerivativeFunctions). Not supported for other integrators
+ *  (empty by default).
  *  \return Numerical integrator object.
  */
 template< typename IndependentVariableType, typename DependentVariableType,
@@ -569,12 +830,22 @@ DependentVariableType, IndependentVariableStepType > > createIntegrator(
         std::function< DependentVariableType(
             const IndependentVariableType, const DependentVariableType& ) > stateDerivativeFunction,
         const DependentVariableType initialState,
-        std::shared_ptr< IntegratorSettings< IndependentVariableType > > integratorSettings )
+        std::shared_ptr< IntegratorSettings< IndependentVariableType > > integratorSettings,
+        const std::vector< std::function< DependentVariableType(
+            const IndependentVariableType, const DependentVariableType& ) > >& additionalStateDerivativeFunctions =
+        std::vector< std::function< DependentVariableType(
+            const IndependentVariableType, const DependentVariableType& ) > >( ) )
 {
     // Declare eventual output
     std::shared_ptr< NumericalIntegrator
             < IndependentVariableType, DependentVariableType, DependentVariableType, IndependentVariableStepType > > integrator;
 
+    if( additionalStateDerivativeFunctions.size( ) > 0 && integratorSettings->integratorType_ != bulirschStoer )
+    {
+        throw std::runtime_error( "Error when creating integrator, concurrent evaluation with additional state derivative "
+                                  "functions is only supported for Bulirsch-Stoer integrator." );
+    }
+
     // Retrieve requested type of integrator
     switch( integratorSettings->integratorType_ )
     {
@@ -699,7 +970,9 @@ DependentVariableType, IndependentVariableStepType > > createIntegrator(
         }
         else
         {
-            integrator = std::make_shared< BulirschStoerVariableStepSizeIntegrator
+            std::shared_ptr< BulirschStoerVariableStepSizeIntegrator
+                    < IndependentVariableType, DependentVariableType, DependentVariableType, IndependentVariableStepType > >
+                    bulirschStoerIntegrator = std::make_shared< BulirschStoerVariableStepSizeIntegrator
                     < IndependentVariableType, DependentVariableType, DependentVariableType, IndependentVariableStepType > >
                     ( getBulirschStoerStepSequence( bulirschStoerIntegratorSettings->extrapolationSequence_,
                                                     bulirschStoerIntegratorSettings->maximumNumberOfSteps_ ),
@@ -711,6 +984,9 @@ DependentVariableType, IndependentVariableStepType > > createIntegrator(
                       static_cast< IndependentVariableStepType >( bulirschStoerIntegratorSettings->safetyFactorForNextStepSize_ ),
                       static_cast< IndependentVariableStepType >( bulirschStoerIntegratorSettings->maximumFactorIncreaseForNextStepSize_ ),
                       static_cast< IndependentVariableStepType >( bulirschStoerIntegratorSettings->minimumFactorDecreaseForNextStepSize_ ) );
+
+            bulirschStoerIntegrator->setAdditionalStateDerivativeFunctions( additionalStateDerivativeFunctions );
+            integrator = bulirschStoerIntegrator;
         }
         break;
     }
@@ -764,6 +1040,100 @@ DependentVariableType, IndependentVariableStepType > > createIntegrator(
         }
         break;
     }
+    case gaussJackson:
+    {
+        // Check input consistency
+        std::shared_ptr< GaussJacksonIntegratorSettings< IndependentVariableType > > gaussJacksonIntegratorSettings =
+                std::dynamic_pointer_cast< GaussJacksonIntegratorSettings< IndependentVariableType > >(
+                    integratorSettings );
+
+        // Check that integrator type has been cast properly
+        if ( gaussJacksonIntegratorSettings == nullptr )
+        {
+            throw std::runtime_error( "Error, type of integrator settings (GaussJacksonIntegratorSettings) not compatible with "
+                                      "selected integrator (derived class of IntegratorSettings must be "
+                                      "GaussJacksonIntegratorSettings for this type)." );
+        }
+        else if ( gaussJacksonIntegratorSettings->order_ < 0 ||
+                  gaussJacksonIntegratorSettings->numberOfCorrectorIterations_ < 1 )
+        {
+            throw std::runtime_error( "Error, order and number of corrector iterations of Gauss-Jackson integrator must be "
+                                      "positive." );
+        }
+        else
+        {
+            // Create integrator
+            integrator = std::make_shared< GaussJacksonIntegrator
+                    < IndependentVariableType, DependentVariableType, DependentVariableType, IndependentVariableStepType > >
+                    ( stateDerivativeFunction, integratorSettings->initialTime_, initialState,
+                      static_cast< IndependentVariableStepType >( integratorSettings->initialTimeStep_ ),
+                      static_cast< unsigned int >( gaussJacksonIntegratorSettings->order_ ),
+                      static_cast< unsigned int >( gaussJacksonIntegratorSettings->numberOfCorrectorIterations_ ) );
+        }
+        break;
+    }
+    case yoshidaSymplectic:
+    {
+        // Check input consistency
+        std::shared_ptr< YoshidaSymplecticIntegratorSettings< IndependentVariableType > > yoshidaIntegratorSettings =
+                std::dynamic_pointer_cast< YoshidaSymplecticIntegratorSettings< IndependentVariableType > >(
+                    integratorSettings );
+
+        // Check that integrator type has been cast properly
+        if ( yoshidaIntegratorSettings == nullptr )
+        {
+            throw std::runtime_error( "Error, type of integrator settings (YoshidaSymplecticIntegratorSettings) not "
+                                      "compatible with selected integrator (derived class of IntegratorSettings must be "
+                                      "YoshidaSymplecticIntegratorSettings for this type)." );
+        }
+        else if ( yoshidaIntegratorSettings->order_ < 0 )
+        {
+            throw std::runtime_error( "Error, order of Yoshida symplectic integrator must be positive." );
+        }
+        else
+        {
+            // Create integrator
+            integrator = std::make_shared< YoshidaSymplecticIntegrator
+                    < IndependentVariableType, DependentVariableType, DependentVariableType, IndependentVariableStepType > >
+                    ( stateDerivativeFunction, integratorSettings->initialTime_, initialState,
+                      static_cast< IndependentVariableStepType >( integratorSettings->initialTimeStep_ ),
+                      static_cast< unsigned int >( yoshidaIntegratorSettings->order_ ) );
+        }
+        break;
+    }
+    case gaussLegendre:
+    {
+        // Check input consistency
+        std::shared_ptr< GaussLegendreIntegratorSettings< IndependentVariableType > > gaussLegendreIntegratorSettings =
+                std::dynamic_pointer_cast< GaussLegendreIntegratorSettings< IndependentVariableType > >(
+                    integratorSettings );
+
+        // Check that integrator type has been cast properly
+        if ( gaussLegendreIntegratorSettings == nullptr )
+        {
+            throw std::runtime_error( "Error, type of integrator settings (GaussLegendreIntegratorSettings) not compatible "
+                                      "with selected integrator (derived class of IntegratorSettings must be "
+                                      "GaussLegendreIntegratorSettings for this type)." );
+        }
+        else if ( gaussLegendreIntegratorSettings->numberOfStages_ < 1 ||
+                  gaussLegendreIntegratorSettings->maximumNumberOfIterations_ < 1 )
+        {
+            throw std::runtime_error( "Error, number of stages and maximum number of iterations of Gauss-Legendre "
+                                      "integrator must be positive." );
+        }
+        else
+        {
+            // Create integrator
+            integrator = std::make_shared< GaussLegendreIntegrator
+                    < IndependentVariableType, DependentVariableType, DependentVariableType, IndependentVariableStepType > >
+                    ( stateDerivativeFunction, integratorSettings->initialTime_, initialState,
+                      static_cast< IndependentVariableStepType >( integratorSettings->initialTimeStep_ ),
+                      static_cast< unsigned int >( gaussLegendreIntegratorSettings->numberOfStages_ ),
+                      static_cast< unsigned int >( gaussLegendreIntegratorSettings->maximumNumberOfIterations_ ),
+                      gaussLegendreIntegratorSettings->iterationTolerance_ );
+        }
+        break;
+    }
     default:
         throw std::runtime_error( "Error, integrator " +  std::to_string( integratorSettings->integratorType_ ) + " not found." );
     }
@@ -782,24 +1152,30 @@ DependentVariableType, IndependentVariableStepType > > createIntegrator(
 extern template std::shared_ptr< numerical_integrators::NumericalIntegrator< double, Eigen::VectorXd,
 Eigen::VectorXd, double > > createIntegrator< double, Eigen::VectorXd, double >(
         std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > stateDerivativeFunction,
-        const Eigen::VectorXd initialState, std::shared_ptr< IntegratorSettings< double > > integratorSettings );
+        const Eigen::VectorXd initialState, std::shared_ptr< IntegratorSettings< double > > integratorSettings,
+        const std::vector< std::function< Eigen::VectorXd( const double, const Eigen::VectorXd& ) > >& additionalStateDerivativeFunctions );
 
 extern template std::shared_ptr< numerical_integrators::NumericalIntegrator< double, Eigen::Matrix< long double, Eigen::Dynamic, 1 >,
 Eigen::Matrix< long double, Eigen::Dynamic, 1 >, double > > createIntegrator< double, Eigen::Matrix< long double, Eigen::Dynamic, 1 >, double >(
         std::function< Eigen::Matrix< long double, Eigen::Dynamic, 1 >(
             const double, const Eigen::Matrix< long double, Eigen::Dynamic, 1 >& ) > stateDerivativeFunction,
-        const Eigen::Matrix< long double, Eigen::Dynamic, 1 > initialState, std::shared_ptr< IntegratorSettings< double > > integratorSettings );
+        const Eigen::Matrix< long double, Eigen::Dynamic, 1 > initialState, std::shared_ptr< IntegratorSettings< double > > integratorSettings,
+        const std::vector< std::function< Eigen::Matrix< long double, Eigen::Dynamic, 1 >(
+            const double, const Eigen::Matrix< long double, Eigen::Dynamic, 1 >& ) > >& additionalStateDerivativeFunctions );
 
 extern template std::shared_ptr< numerical_integrators::NumericalIntegrator< Time, Eigen::VectorXd,
 Eigen::VectorXd, long double > > createIntegrator< Time, Eigen::VectorXd, long double >(
         std::function< Eigen::VectorXd( const Time, const Eigen::VectorXd& ) > stateDerivativeFunction,
-        const Eigen::VectorXd initialState, std::shared_ptr< IntegratorSettings< Time > > integratorSettings );
+        const Eigen::VectorXd initialState, std::shared_ptr< IntegratorSettings< Time > > integratorSettings,
+        const std::vector< std::function< Eigen::VectorXd( const Time, const Eigen::VectorXd& ) > >& additionalStateDerivativeFunctions );
 
 extern template std::shared_ptr< numerical_integrators::NumericalIntegrator< Time, Eigen::Matrix< long double, Eigen::Dynamic, 1 >,
 Eigen::Matrix< long double, Eigen::Dynamic, 1 >, long double > > createIntegrator< Time, Eigen::Matrix< long double, Eigen::Dynamic, 1 >, long double >(
         std::function< Eigen::Matrix< long double, Eigen::Dynamic, 1 >(
             const Time, const Eigen::Matrix< long double, Eigen::Dynamic, 1 >& ) > stateDerivativeFunction,
-        const Eigen::Matrix< long double, Eigen::Dynamic, 1 > initialState, std::shared_ptr< IntegratorSettings< Time > > integratorSettings );
+        const Eigen::Matrix< long double, Eigen::Dynamic, 1 > initialState, std::shared_ptr< IntegratorSettings< Time > > integratorSettings,
+        const std::vector< std::function< Eigen::Matrix< long double, Eigen::Dynamic, 1 >(
+            const Time, const Eigen::Matrix< long double, Eigen::Dynamic, 1 >& ) > >& additionalStateDerivativeFunctions );
 } // namespace numerical_integrators
 
 } // namespace tudat
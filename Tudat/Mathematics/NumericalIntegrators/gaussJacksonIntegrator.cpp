@@ -0,0 +1,119 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Berry, M.M. and Healy, L.M., Implementation of Gauss-Jackson integration for orbit propagation,
+ *          The Journal of the Astronautical Sciences, 52(3), 2004.
+ *      Hairer, E., Norsett, S.P., Wanner, G. Solving Ordinary Differential Equations I, 2nd Edition, Springer, 1993.
+ *
+ */
+
+#include <vector>
+
+#include "Tudat/Mathematics/NumericalIntegrators/gaussJacksonIntegrator.h"
+
+namespace tudat
+{
+namespace numerical_integrators
+{
+
+//! Function to convert coefficients of a formula in backward difference form to ordinate form.
+/*!
+ * Function to convert coefficients of a formula in backward difference form, sum_q d_q nabla^q a_n (q = 0...order), to
+ * ordinate form, sum_j c_j a_{n-j} (j = 0...order).
+ * \param differenceCoefficients Coefficients d_q of formula in backward difference form.
+ * \return Coefficients c_j of formula in ordinate form.
+ */
+Eigen::VectorXd convertBackwardDifferenceToOrdinateCoefficients( const std::vector< double >& differenceCoefficients )
+{
+    const int order = static_cast< int >( differenceCoefficients.size( ) ) - 1;
+    Eigen::VectorXd ordinateCoefficients = Eigen::VectorXd::Zero( order + 1 );
+
+    // Use nabla^q a_n = sum_j (-1)^j binomial(q,j) a_{n-j}, with binomial coefficients from Pascal's triangle.
+    std::vector< double > binomialCoefficients( order + 1, 0.0 );
+    binomialCoefficients[ 0 ] = 1.0;
+    for( int q = 0; q <= order; q++ )
+    {
+        if( q > 0 )
+        {
+            for( int j = q; j > 0; j-- )
+            {
+                binomialCoefficients[ j ] += binomialCoefficients[ j - 1 ];
+            }
+        }
+
+        for( int j = 0; j <= q; j++ )
+        {
+            ordinateCoefficients( j ) += ( ( j % 2 == 0 ) ? 1.0 : -1.0 ) * binomialCoefficients[ j ] *
+                    differenceCoefficients[ q ];
+        }
+    }
+    return ordinateCoefficients;
+}
+
+//! Function to compute the coefficients of the Gauss-Jackson predictor and corrector formulas.
+GaussJacksonCoefficients computeGaussJacksonCoefficients( const unsigned int order )
+{
+    if( order < 2 || order > 14 )
+    {
+        throw std::runtime_error( "Error in Gauss-Jackson integrator, order " + std::to_string( order ) +
+                                  " is not supported, order must be in range [2, 14]." );
+    }
+
+    // Compute power series g(x) = x / ( -ln( 1 - x ) ), as the inverse of sum_k x^k / ( k + 1 ). The coefficients of
+    // g(x), g(x) / ( 1 - x ), g(x)^2 and g(x)^2 / ( 1 - x ) are the coefficients of the backward difference forms of
+    // the Adams-Moulton, Adams-Bashforth, Cowell and Stormer formulas, respectively (Hairer et al., 1993).
+    const int numberOfTerms = static_cast< int >( order ) + 3;
+    std::vector< double > adamsMoultonCoefficients( numberOfTerms, 0.0 );
+    adamsMoultonCoefficients[ 0 ] = 1.0;
+    for( int k = 1; k < numberOfTerms; k++ )
+    {
+        for( int j = 1; j <= k; j++ )
+        {
+            adamsMoultonCoefficients[ k ] -= adamsMoultonCoefficients[ k - j ] / static_cast< double >( j + 1 );
+        }
+    }
+
+    std::vector< double > adamsBashforthCoefficients( numberOfTerms, 0.0 );
+    std::vector< double > cowellCoefficients( numberOfTerms, 0.0 );
+    std::vector< double > stormerCoefficients( numberOfTerms, 0.0 );
+    for( int k = 0; k < numberOfTerms; k++ )
+    {
+        for( int j = 0; j <= k; j++ )
+        {
+            cowellCoefficients[ k ] += adamsMoultonCoefficients[ j ] * adamsMoultonCoefficients[ k - j ];
+        }
+        adamsBashforthCoefficients[ k ] = adamsMoultonCoefficients[ k ] +
+                ( ( k > 0 ) ? adamsBashforthCoefficients[ k - 1 ] : 0.0 );
+        stormerCoefficients[ k ] = cowellCoefficients[ k ] + ( ( k > 0 ) ? stormerCoefficients[ k - 1 ] : 0.0 );
+    }
+
+    // Summed forms: the zeroth (and, for positions, first) terms are absorbed in the first and second sums (the first
+    // Cowell coefficient is cancelled by the definition of the second sum, and the first Stormer coefficient is zero).
+    GaussJacksonCoefficients coefficients;
+    coefficients.velocityCorrectorCoefficients = convertBackwardDifferenceToOrdinateCoefficients(
+                std::vector< double >( adamsMoultonCoefficients.begin( ) + 1,
+                                       adamsMoultonCoefficients.begin( ) + order + 2 ) );
+    coefficients.velocityPredictorCoefficients = convertBackwardDifferenceToOrdinateCoefficients(
+                std::vector< double >( adamsBashforthCoefficients.begin( ) + 1,
+                                       adamsBashforthCoefficients.begin( ) + order + 2 ) );
+    coefficients.positionCorrectorCoefficients = convertBackwardDifferenceToOrdinateCoefficients(
+                std::vector< double >( cowellCoefficients.begin( ) + 2, cowellCoefficients.begin( ) + order + 3 ) );
+    coefficients.positionPredictorCoefficients = convertBackwardDifferenceToOrdinateCoefficients(
+                std::vector< double >( stormerCoefficients.begin( ) + 2, stormerCoefficients.begin( ) + order + 3 ) );
+
+    return coefficients;
+}
+
+template class GaussJacksonIntegrator < double, Eigen::VectorXd, Eigen::VectorXd >;
+template class GaussJacksonIntegrator < double, Eigen::Vector6d, Eigen::Vector6d >;
+template class GaussJacksonIntegrator < double, Eigen::MatrixXd, Eigen::MatrixXd >;
+
+} // namespace numerical_integrators
+} // namespace tudat
@@ -0,0 +1,610 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Berry, M.M. and Healy, L.M., Implementation of Gauss-Jackson integration for orbit propagation,
+ *          The Journal of the Astronautical Sciences, 52(3), 2004.
+ *      Hairer, E., Norsett, S.P., Wanner, G. Solving Ordinary Differential Equations I, 2nd Edition, Springer, 1993.
+ *
+ */
+
+#ifndef TUDAT_GAUSS_JACKSON_INTEGRATOR_H
+#define TUDAT_GAUSS_JACKSON_INTEGRATOR_H
+
+#include <cmath>
+#include <deque>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/basicTypedefs.h"
+#include "Tudat/Mathematics/NumericalIntegrators/reinitializableNumericalIntegrator.h"
+#include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaCoefficients.h"
+#include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaVariableStepSizeIntegrator.h"
+
+namespace tudat
+{
+namespace numerical_integrators
+{
+
+//! Coefficients of the summed (Gauss-Jackson) predictor and corrector formulas, in ordinate form.
+/*!
+ * Coefficients of the summed (Gauss-Jackson) predictor and corrector formulas, in ordinate form. For backward
+ * accelerations a_n, ..., a_{n-q} (with q the order), first sum s_n and second sum S_n (see GaussJacksonIntegrator),
+ * the predicted position and velocity at n+1 are h^2 ( S_{n+1} + sum_j P_j a_{n-j} ) and h ( s_n + sum_j p_j a_{n-j} ),
+ * and the corrected position and velocity at n+1 are h^2 ( S_{n+1} + sum_j C_j a_{n+1-j} ) and
+ * h ( s_{n+1} + sum_j c_j a_{n+1-j} ).
+ */
+struct GaussJacksonCoefficients
+{
+    //! Coefficients P_j of the (Stormer) position predictor.
+    Eigen::VectorXd positionPredictorCoefficients;
+
+    //! Coefficients p_j of the (summed Adams-Bashforth) velocity predictor.
+    Eigen::VectorXd velocityPredictorCoefficients;
+
+    //! Coefficients C_j of the (Cowell) position corrector.
+    Eigen::VectorXd positionCorrectorCoefficients;
+
+    //! Coefficients c_j of the (summed Adams-Moulton) velocity corrector.
+    Eigen::VectorXd velocityCorrectorCoefficients;
+};
+
+//! Function to compute the coefficients of the Gauss-Jackson predictor and corrector formulas.
+/*!
+ * Function to compute the coefficients of the Gauss-Jackson predictor and corrector formulas in ordinate form, from
+ * the power series of the backward difference forms (Hairer et al., 1993, Sections III.1 and III.10).
+ * \param order Order of the formulas, equal to the number of backward accelerations used minus one. Must be in the
+ *      range [2, 14].
+ * \return Coefficients of the predictor and corrector formulas.
+ */
+GaussJacksonCoefficients computeGaussJacksonCoefficients( const unsigned int order );
+
+//! Gauss-Jackson (summed Stormer-Cowell) fixed step size integrator, for second-order equations of motion.
+/*!
+ * Gauss-Jackson (summed Stormer-Cowell) fixed step size integrator, for second-order equations of motion. The
+ * integrator is implemented in predict-(evaluate-correct)^k mode (Berry and Healy, 2004), so that each step requires k
+ * (by default 1) evaluations of the state derivative. The integrator is started by taking steps with a Dormand-Prince
+ * 8(7) integrator (each subdivided in a number of sub-steps), until the history of backward accelerations is filled.
+ * The integrator is restarted when the step size is changed, or the state is modified.
+ *
+ * The state must consist of one or more blocks of six rows, each of which contains the Cartesian position (first three
+ * rows) and velocity (last three rows) of a body (as in a Cowell propagation of the translational state), so that the
+ * state derivative of the position rows is equal to the velocity rows. For a matrix state (e.g. the state transition
+ * matrix), this structure must hold for each column. This structure is verified whenever the integrator is (re)started.
+ * \tparam IndependentVariableType The type of the independent variable.
+ * \tparam StateType The type of the state (an Eigen matrix type).
+ * \tparam StateDerivativeType The type of the state derivative.
+ * \tparam TimeStepType The type of the time step.
+ * \sa NumericalIntegrator.
+ */
+template< typename IndependentVariableType = double, typename StateType = Eigen::VectorXd,
+          typename StateDerivativeType = Eigen::VectorXd, typename TimeStepType = IndependentVariableType >
+class GaussJacksonIntegrator
+        : public ReinitializableNumericalIntegrator<
+        IndependentVariableType, StateType, StateDerivativeType, TimeStepType >
+{
+public:
+
+    //! Typedef for the base class.
+    /*!
+     * Typedef of the base class with all template parameters filled in.
+     */
+    typedef ReinitializableNumericalIntegrator< IndependentVariableType, StateType,
+    StateDerivativeType, TimeStepType > ReinitializableNumericalIntegratorBase;
+
+    //! Typedef for the state derivative function.
+    /*!
+     * Typedef to the state derivative function inherited from the base class.
+     * \sa NumericalIntegrator::StateDerivativeFunction.
+     */
+    typedef typename ReinitializableNumericalIntegratorBase::NumericalIntegratorBase::
+    StateDerivativeFunction StateDerivativeFunction;
+
+    //! Typedef for the scalar type of the state.
+    typedef typename StateType::Scalar StateScalarType;
+
+    //! Typedef for the matrix type in which the position, velocity or acceleration rows of the state are stored.
+    typedef Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > SecondOrderStateMatrix;
+
+    //! Constructor.
+    /*!
+     * Constructor.
+     * \param stateDerivativeFunction State derivative function.
+     * \param intervalStart The start of the integration interval.
+     * \param initialState The initial state, consisting of blocks of Cartesian position and velocity (see class
+     *      description).
+     * \param stepSize Step size that is to be used (negative for backwards integration).
+     * \param order Order of the integrator, equal to the number of backward accelerations that is used minus one
+     *      (default 8). Must be in the range [2, 14].
+     * \param numberOfCorrectorIterations Number of evaluate-correct iterations per step (default 1).
+     */
+    GaussJacksonIntegrator(
+            const StateDerivativeFunction& stateDerivativeFunction,
+            const IndependentVariableType intervalStart,
+            const StateType& initialState,
+            const TimeStepType stepSize,
+            const unsigned int order = 8,
+            const unsigned int numberOfCorrectorIterations = 1 )
+        : ReinitializableNumericalIntegratorBase( stateDerivativeFunction ),
+          currentIndependentVariable_( intervalStart ),
+          currentState_( initialState ),
+          lastIndependentVariable_( intervalStart ),
+          lastState_( initialState ),
+          stepSize_( stepSize ),
+          lastStepSize_( stepSize ),
+          order_( order ),
+          numberOfCorrectorIterations_( numberOfCorrectorIterations ),
+          coefficients_( computeGaussJacksonCoefficients( order ) ),
+          numberOfBodies_( initialState.rows( ) / 6 ),
+          numberOfColumns_( initialState.cols( ) ),
+          startupIntegrator_( RungeKuttaCoefficients::get( RungeKuttaCoefficients::rungeKutta87DormandPrince ),
+                              stateDerivativeFunction, intervalStart, initialState,
+                              std::fabs( static_cast< double >( stepSize ) ),
+                              std::fabs( static_cast< double >( stepSize ) ),
+                              static_cast< StateScalarType >( 1.0 ), static_cast< StateScalarType >( 1.0 ) )
+    {
+        if( initialState.rows( ) == 0 || initialState.rows( ) % 6 != 0 )
+        {
+            throw std::runtime_error(
+                        "Error in Gauss-Jackson integrator, state must consist of blocks of Cartesian position and "
+                        "velocity, but has " + std::to_string( initialState.rows( ) ) + " rows." );
+        }
+        if( numberOfCorrectorIterations_ == 0 )
+        {
+            throw std::runtime_error( "Error in Gauss-Jackson integrator, at least one corrector iteration is required." );
+        }
+        if( !( static_cast< double >( stepSize ) != 0.0 ) )
+        {
+            throw std::runtime_error( "Error in Gauss-Jackson integrator, step size must be non-zero." );
+        }
+
+        startupIntegrator_.setStepSizeControl( false );
+        firstSum_.setZero( 3 * numberOfBodies_, numberOfColumns_ );
+        secondSum_.setZero( 3 * numberOfBodies_, numberOfColumns_ );
+        predictedState_ = currentState_;
+    }
+
+    //! Default destructor.
+    ~GaussJacksonIntegrator( ){ }
+
+    //! Get step size of the next step.
+    /*!
+     * Returns the step size of the next step, which is equal to the step size of the last step (fixed step size).
+     * \return Step size to be used for the next step.
+     */
+    virtual TimeStepType getNextStepSize( ) const { return stepSize_; }
+
+    //! Get current state.
+    /*!
+     * Returns the current state of the integrator.
+     * \return Current integrated state.
+     */
+    virtual StateType getCurrentState( ) const { return currentState_; }
+
+    //! Returns the current independent variable.
+    /*!
+     * Returns the current value of the independent variable of the integrator.
+     * \return Current independent variable.
+     */
+    virtual IndependentVariableType getCurrentIndependentVariable( ) const
+    {
+        return currentIndependentVariable_;
+    }
+
+    //! Get previous independent variable.
+    /*!
+     * Returns the previous value of the independent variable of the integrator.
+     * \return Previous independent variable.
+     */
+    virtual IndependentVariableType getPreviousIndependentVariable( )
+    {
+        return lastIndependentVariable_;
+    }
+
+    //! Get previous state value.
+    /*!
+     * Returns the previous value of the state.
+     * \return Previous state
+     */
+    virtual StateType getPreviousState( )
+    {
+        return lastState_;
+    }
+
+    //! Perform a single integration step.
+    /*!
+     * Perform a single integration step. If the step size differs from that of the previous step, the integrator is
+     * restarted (so that the history of backward accelerations is computed for the new step size). Until the history
+     * is filled, steps are taken with the start-up integrator.
+     * \param stepSize The step size to take.
+     * \return The state at the end of the interval.
+     */
+    virtual StateType performIntegrationStep( const TimeStepType stepSize )
+    {
+        // Store variables for rollback.
+        lastIndependentVariable_ = currentIndependentVariable_;
+        lastState_ = currentState_;
+        lastStepSize_ = stepSize_;
+        lastAccelerationHistory_ = accelerationHistory_;
+        lastFirstSum_ = firstSum_;
+        lastSecondSum_ = secondSum_;
+
+        // Restart integrator if step size has changed.
+        if( stepSize != stepSize_ )
+        {
+            stepSize_ = stepSize;
+            accelerationHistory_.clear( );
+        }
+
+        if( accelerationHistory_.size( ) < order_ + 1 )
+        {
+            performStartupStep( );
+        }
+        else
+        {
+            performGaussJacksonStep( );
+        }
+
+        return currentState_;
+    }
+
+    //! Rollback internal state to the last state.
+    /*!
+     * Performs rollback of internal state to the last state (including the history of backward accelerations). This
+     * function can only be called once after calling integrateTo( ) or performIntegrationStep( ).
+     * \return True if the rollback was successful.
+     */
+    virtual bool rollbackToPreviousState( )
+    {
+        if( currentIndependentVariable_ == lastIndependentVariable_ )
+        {
+            return false;
+        }
+
+        currentIndependentVariable_ = lastIndependentVariable_;
+        currentState_ = lastState_;
+        stepSize_ = lastStepSize_;
+        accelerationHistory_ = lastAccelerationHistory_;
+        firstSum_ = lastFirstSum_;
+        secondSum_ = lastSecondSum_;
+        return true;
+    }
+
+    //! Replace the state with a new value.
+    /*!
+     * Replace the state with a new value, after which the integrator is restarted.
+     * \param newState The value of the new state.
+     * \param allowRollback Boolean denoting whether roll-back should be allowed.
+     */
+    void modifyCurrentState( const StateType& newState, const bool allowRollback = false )
+    {
+        currentState_ = newState;
+        accelerationHistory_.clear( );
+        if ( !allowRollback )
+        {
+            lastIndependentVariable_ = currentIndependentVariable_;
+        }
+    }
+
+    //! Modify the state and time for the current step.
+    /*!
+     * Modify the state and time for the current step, after which the integrator is restarted.
+     * \param newState The new state to set the current state to.
+     * \param newTime The time to set the current time to.
+     * \param allowRollback Boolean denoting whether roll-back should be allowed.
+     */
+    void modifyCurrentIntegrationVariables( const StateType& newState, const IndependentVariableType newTime,
+                                            const bool allowRollback = false )
+    {
+        currentState_ = newState;
+        currentIndependentVariable_ = newTime;
+        accelerationHistory_.clear( );
+        if ( !allowRollback )
+        {
+            lastIndependentVariable_ = currentIndependentVariable_;
+        }
+    }
+
+    //! Function to write the internal state of the integrator to a binary stream.
+    /*!
+     * Function to write the internal state of the integrator to a binary stream, consisting of the current independent
+     * variable and state, the step size, the history of backward accelerations and the summed accelerations, so that the
+     * integration can be resumed with identical results.
+     * \param outputStream Stream to which the integrator state is to be written.
+     */
+    void writeStateToBinaryStream( std::ostream& outputStream )
+    {
+        utilities::writeToBinaryStream( outputStream, currentIndependentVariable_ );
+        utilities::writeToBinaryStream( outputStream, currentState_ );
+        utilities::writeToBinaryStream( outputStream, stepSize_ );
+        utilities::writeToBinaryStream( outputStream, std::vector< SecondOrderStateMatrix >(
+                                            accelerationHistory_.begin( ), accelerationHistory_.end( ) ) );
+        utilities::writeToBinaryStream( outputStream, firstSum_ );
+        utilities::writeToBinaryStream( outputStream, secondSum_ );
+    }
+
+    //! Function to read the internal state of the integrator from a binary stream.
+    /*!
+     * Function to read the internal state of the integrator from a binary stream, as written by
+     * writeStateToBinaryStream. The state cannot be rolled back after calling this function.
+     * \param inputStream Stream from which the integrator state is to be read.
+     */
+    void readStateFromBinaryStream( std::istream& inputStream )
+    {
+        utilities::readFromBinaryStream( inputStream, currentIndependentVariable_ );
+        utilities::readFromBinaryStream( inputStream, currentState_ );
+        utilities::readFromBinaryStream( inputStream, stepSize_ );
+
+        std::vector< SecondOrderStateMatrix > accelerationHistory;
+        utilities::readFromBinaryStream( inputStream, accelerationHistory );
+        if( accelerationHistory.size( ) > order_ + 1 )
+        {
+            throw std::runtime_error( "Error when reading Gauss-Jackson integrator state, history is incompatible with "
+                                      "integrator." );
+        }
+        accelerationHistory_.assign( accelerationHistory.begin( ), accelerationHistory.end( ) );
+
+        utilities::readFromBinaryStream( inputStream, firstSum_ );
+        utilities::readFromBinaryStream( inputStream, secondSum_ );
+        lastIndependentVariable_ = currentIndependentVariable_;
+    }
+
+    //! Function to retrieve the order of the integrator.
+    /*!
+     * Function to retrieve the order of the integrator.
+     * \return Order of the integrator.
+     */
+    unsigned int getOrder( ) const { return order_; }
+
+    //! Function to retrieve the number of evaluate-correct iterations per step.
+    /*!
+     * Function to retrieve the number of evaluate-correct iterations per step.
+     * \return Number of evaluate-correct iterations per step.
+     */
+    unsigned int getNumberOfCorrectorIterations( ) const { return numberOfCorrectorIterations_; }
+
+    //! Function to check whether the integrator is taking Gauss-Jackson steps (true), or is (re)starting (false).
+    /*!
+     * Function to check whether the integrator is taking Gauss-Jackson steps (true), or is (re)starting (false), i.e.
+     * whether the next step will be taken with the Gauss-Jackson formulas.
+     * \return True if the history of backward accelerations is complete.
+     */
+    bool isStartupCompleted( ) const { return accelerationHistory_.size( ) == order_ + 1; }
+
+    //! Number of sub-steps of the start-up integrator per step.
+    static const int numberOfStartupSubSteps = 4;
+
+protected:
+
+    //! Function to evaluate the state derivative, and store the acceleration rows in a matrix.
+    /*!
+     * Function to evaluate the state derivative, and store the acceleration rows in a matrix.
+     * \param independentVariable Independent variable at which to evaluate the state derivative.
+     * \param state State at which to evaluate the state derivative.
+     * \param acceleration Acceleration rows of state derivative (returned by reference).
+     * \param checkStructure Boolean denoting whether it is to be verified that the state derivative of the position
+     *      rows is equal to the velocity rows.
+     */
+    void evaluateAcceleration( const IndependentVariableType independentVariable, const StateType& state,
+                               SecondOrderStateMatrix& acceleration, const bool checkStructure = false )
+    {
+        const StateDerivativeType stateDerivative = this->stateDerivativeFunction_( independentVariable, state );
+
+        acceleration.resize( 3 * numberOfBodies_, numberOfColumns_ );
+        for( int i = 0; i < numberOfBodies_; i++ )
+        {
+            acceleration.block( 3 * i, 0, 3, numberOfColumns_ ) = stateDerivative.block( 6 * i + 3, 0, 3, numberOfColumns_ );
+
+            if( checkStructure )
+            {
+                const StateScalarType velocityDifference =
+                        ( stateDerivative.block( 6 * i, 0, 3, numberOfColumns_ ) -
+                          state.block( 6 * i + 3, 0, 3, numberOfColumns_ ) ).cwiseAbs( ).maxCoeff( );
+                const StateScalarType velocityMagnitude =
+                        state.block( 6 * i + 3, 0, 3, numberOfColumns_ ).cwiseAbs( ).maxCoeff( );
+                if( !( velocityDifference <= 1.0E-12 * velocityMagnitude ) )
+                {
+                    throw std::runtime_error(
+                                "Error in Gauss-Jackson integrator, derivative of position is not equal to velocity. The "
+                                "integrator can only be used for (Cowell) Cartesian position and velocity states." );
+                }
+            }
+        }
+    }
+
+    //! Function to perform a step with the start-up integrator, and add the acceleration at the end to the history.
+    void performStartupStep( )
+    {
+        // Add acceleration at current state if history is empty (integrator is (re)started).
+        if( accelerationHistory_.size( ) == 0 )
+        {
+            accelerationHistory_.push_front( SecondOrderStateMatrix( ) );
+            evaluateAcceleration( currentIndependentVariable_, currentState_, accelerationHistory_.front( ), true );
+        }
+
+        // Take step as a number of sub-steps with start-up integrator.
+        startupIntegrator_.modifyCurrentIntegrationVariables( currentState_, currentIndependentVariable_ );
+        const TimeStepType subStepSize = stepSize_ / static_cast< double >( numberOfStartupSubSteps );
+        for( int i = 0; i < numberOfStartupSubSteps; i++ )
+        {
+            startupIntegrator_.performIntegrationStep( subStepSize );
+        }
+        currentIndependentVariable_ = currentIndependentVariable_ + stepSize_;
+        currentState_ = startupIntegrator_.getCurrentState( );
+
+        // Add acceleration at end of step to history.
+        accelerationHistory_.push_front( SecondOrderStateMatrix( ) );
+        evaluateAcceleration( currentIndependentVariable_, currentState_, accelerationHistory_.front( ) );
+
+        // Initialize sums from current position and velocity, using the corrector formulas, once history is complete.
+        if( accelerationHistory_.size( ) == order_ + 1 )
+        {
+            const StateScalarType stepSize = static_cast< StateScalarType >( stepSize_ );
+            for( int i = 0; i < numberOfBodies_; i++ )
+            {
+                firstSum_.block( 3 * i, 0, 3, numberOfColumns_ ) =
+                        currentState_.block( 6 * i + 3, 0, 3, numberOfColumns_ ) / stepSize;
+                secondSum_.block( 3 * i, 0, 3, numberOfColumns_ ) =
+                        currentState_.block( 6 * i, 0, 3, numberOfColumns_ ) / ( stepSize * stepSize );
+            }
+            for( unsigned int j = 0; j <= order_; j++ )
+            {
+                firstSum_ -= static_cast< StateScalarType >( coefficients_.velocityCorrectorCoefficients( j ) ) *
+                        accelerationHistory_[ j ];
+                secondSum_ -= static_cast< StateScalarType >( coefficients_.positionCorrectorCoefficients( j ) ) *
+                        accelerationHistory_[ j ];
+            }
+        }
+    }
+
+    //! Function to perform a step with the Gauss-Jackson predictor and corrector formulas.
+    void performGaussJacksonStep( )
+    {
+        const StateScalarType stepSize = static_cast< StateScalarType >( stepSize_ );
+        const StateScalarType squaredStepSize = stepSize * stepSize;
+
+        // Predict position and velocity, using the accelerations up to the current epoch.
+        secondSum_ += firstSum_;
+        positionSum_ = secondSum_;
+        velocitySum_ = firstSum_;
+        for( unsigned int j = 0; j <= order_; j++ )
+        {
+            positionSum_ += static_cast< StateScalarType >( coefficients_.positionPredictorCoefficients( j ) ) *
+                    accelerationHistory_[ j ];
+            velocitySum_ += static_cast< StateScalarType >( coefficients_.velocityPredictorCoefficients( j ) ) *
+                    accelerationHistory_[ j ];
+        }
+        setPredictedState( squaredStepSize, stepSize );
+
+        // Shift history (reusing the storage of the oldest acceleration for the new one).
+        accelerationHistory_.push_front( std::move( accelerationHistory_.back( ) ) );
+        accelerationHistory_.pop_back( );
+
+        // Evaluate acceleration at predicted state, and correct position and velocity.
+        currentIndependentVariable_ = currentIndependentVariable_ + stepSize_;
+        for( unsigned int k = 0; k < numberOfCorrectorIterations_; k++ )
+        {
+            evaluateAcceleration( currentIndependentVariable_, predictedState_, accelerationHistory_.front( ) );
+
+            positionSum_ = secondSum_;
+            velocitySum_ = firstSum_ + accelerationHistory_.front( );
+            for( unsigned int j = 0; j <= order_; j++ )
+            {
+                positionSum_ += static_cast< StateScalarType >( coefficients_.positionCorrectorCoefficients( j ) ) *
+                        accelerationHistory_[ j ];
+                velocitySum_ += static_cast< StateScalarType >( coefficients_.velocityCorrectorCoefficients( j ) ) *
+                        accelerationHistory_[ j ];
+            }
+            setPredictedState( squaredStepSize, stepSize );
+        }
+
+        firstSum_ += accelerationHistory_.front( );
+        currentState_ = predictedState_;
+    }
+
+    //! Function to set the predicted state from the current position and velocity sums.
+    /*!
+     * Function to set the predicted state from the current position and velocity sums (positionSum_ and velocitySum_).
+     * \param squaredStepSize Square of the step size.
+     * \param stepSize Step size.
+     */
+    void setPredictedState( const StateScalarType squaredStepSize, const StateScalarType stepSize )
+    {
+        for( int i = 0; i < numberOfBodies_; i++ )
+        {
+            predictedState_.block( 6 * i, 0, 3, numberOfColumns_ ) =
+                    squaredStepSize * positionSum_.block( 3 * i, 0, 3, numberOfColumns_ );
+            predictedState_.block( 6 * i + 3, 0, 3, numberOfColumns_ ) =
+                    stepSize * velocitySum_.block( 3 * i, 0, 3, numberOfColumns_ );
+        }
+    }
+
+    //! Current independent variable.
+    IndependentVariableType currentIndependentVariable_;
+
+    //! Current state.
+    StateType currentState_;
+
+    //! Independent variable at start of last step.
+    IndependentVariableType lastIndependentVariable_;
+
+    //! State at start of last step.
+    StateType lastState_;
+
+    //! Step size of (next) step.
+    TimeStepType stepSize_;
+
+    //! Step size before last step (for rollback).
+    TimeStepType lastStepSize_;
+
+    //! Order of the integrator, equal to the number of backward accelerations that is used minus one.
+    unsigned int order_;
+
+    //! Number of evaluate-correct iterations per step.
+    unsigned int numberOfCorrectorIterations_;
+
+    //! Coefficients of the predictor and corrector formulas.
+    GaussJacksonCoefficients coefficients_;
+
+    //! Number of blocks of Cartesian position and velocity in the state.
+    int numberOfBodies_;
+
+    //! Number of columns of the state.
+    int numberOfColumns_;
+
+    //! History of backward accelerations (newest first).
+    std::deque< SecondOrderStateMatrix > accelerationHistory_;
+
+    //! First sum s_n of accelerations, such that s_n - s_{n-1} = a_n.
+    SecondOrderStateMatrix firstSum_;
+
+    //! Second sum S_n of accelerations, such that S_n - S_{n-1} = s_{n-1}.
+    SecondOrderStateMatrix secondSum_;
+
+    //! History of backward accelerations before last step (for rollback).
+    std::deque< SecondOrderStateMatrix > lastAccelerationHistory_;
+
+    //! First sum before last step (for rollback).
+    SecondOrderStateMatrix lastFirstSum_;
+
+    //! Second sum before last step (for rollback).
+    SecondOrderStateMatrix lastSecondSum_;
+
+    //! Pre-allocated matrix for the sum of which the position is computed (divided by square of step size).
+    SecondOrderStateMatrix positionSum_;
+
+    //! Pre-allocated matrix for the sum of which the velocity is computed (divided by step size).
+    SecondOrderStateMatrix velocitySum_;
+
+    //! Pre-allocated predicted (and corrected) state.
+    StateType predictedState_;
+
+    //! Integrator used to (re)start the integration.
+    RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >
+    startupIntegrator_;
+};
+
+extern template class GaussJacksonIntegrator < double, Eigen::VectorXd, Eigen::VectorXd >;
+extern template class GaussJacksonIntegrator < double, Eigen::Vector6d, Eigen::Vector6d >;
+extern template class GaussJacksonIntegrator < double, Eigen::MatrixXd, Eigen::MatrixXd >;
+
+//! Typedef of Gauss-Jackson integrator (state/state derivative = VectorXd, independent variable = double).
+typedef GaussJacksonIntegrator< > GaussJacksonIntegratorXd;
+
+//! Typedef of pointer to default Gauss-Jackson integrator.
+typedef std::shared_ptr< GaussJacksonIntegratorXd > GaussJacksonIntegratorXdPointer;
+
+} // namespace numerical_integrators
+
+} // namespace tudat
+
+#endif // TUDAT_GAUSS_JACKSON_INTEGRATOR_H
@@ -0,0 +1,123 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Hairer, E., Wanner, G. Solving Ordinary Differential Equations II, 2nd Edition, Springer, 1996.
+ *
+ */
+
+#include <cmath>
+
+#include <Eigen/LU>
+
+#include "Tudat/Mathematics/NumericalIntegrators/gaussLegendreIntegrator.h"
+
+namespace tudat
+{
+namespace numerical_integrators
+{
+
+//! Function to compute the coefficients of a Gauss-Legendre collocation method.
+GaussLegendreCoefficients computeGaussLegendreCoefficients( const unsigned int numberOfStages )
+{
+    if( numberOfStages < 1 || numberOfStages > 6 )
+    {
+        throw std::runtime_error( "Error in Gauss-Legendre integrator, number of stages " +
+                                  std::to_string( numberOfStages ) + " is not supported, must be in range [1, 6]." );
+    }
+
+    typedef Eigen::Matrix< long double, Eigen::Dynamic, Eigen::Dynamic > MatrixXld;
+    const int s = static_cast< int >( numberOfStages );
+    const long double pi = 3.141592653589793238462643383279502884L;
+
+    // Compute roots x_i of Legendre polynomial P_s on [-1, 1] by Newton iteration, using the three-term recurrence
+    // relation for P_s and the relation ( x^2 - 1 ) P_s'(x) = s ( x P_s(x) - P_{s-1}(x) ). The nodes are
+    // c_i = ( 1 - x_i ) / 2, in increasing order.
+    Eigen::Matrix< long double, Eigen::Dynamic, 1 > nodes( s );
+    for( int i = 0; i < s; i++ )
+    {
+        long double root = std::cos( pi * ( static_cast< long double >( i ) + 0.75L ) /
+                                     ( static_cast< long double >( s ) + 0.5L ) );
+        for( int iteration = 0; iteration < 100; iteration++ )
+        {
+            long double legendrePolynomial = root;
+            long double previousLegendrePolynomial = 1.0L;
+            for( int n = 1; n < s; n++ )
+            {
+                const long double nextLegendrePolynomial =
+                        ( static_cast< long double >( 2 * n + 1 ) * root * legendrePolynomial -
+                          static_cast< long double >( n ) * previousLegendrePolynomial ) /
+                        static_cast< long double >( n + 1 );
+                previousLegendrePolynomial = legendrePolynomial;
+                legendrePolynomial = nextLegendrePolynomial;
+            }
+            const long double derivative = static_cast< long double >( s ) *
+                    ( root * legendrePolynomial - previousLegendrePolynomial ) / ( root * root - 1.0L );
+            const long double correction = legendrePolynomial / derivative;
+            root -= correction;
+            if( std::fabs( correction ) <= 4.0L * std::numeric_limits< long double >::epsilon( ) )
+            {
+                break;
+            }
+        }
+        nodes( i ) = ( 1.0L - root ) / 2.0L;
+    }
+
+    // The coefficients of the Lagrange polynomials l_j(theta) = sum_m alpha_mj theta^m are the columns of the inverse
+    // of the Vandermonde matrix V_im = c_i^m, the integrated polynomials have coefficients alpha_mj / ( m + 1 ).
+    MatrixXld vandermondeMatrix( s, s );
+    for( int i = 0; i < s; i++ )
+    {
+        for( int m = 0; m < s; m++ )
+        {
+            vandermondeMatrix( i, m ) = std::pow( nodes( i ), static_cast< long double >( m ) );
+        }
+    }
+    MatrixXld integratedLagrangeCoefficients = vandermondeMatrix.fullPivLu( ).inverse( );
+    for( int m = 0; m < s; m++ )
+    {
+        integratedLagrangeCoefficients.row( m ) /= static_cast< long double >( m + 1 );
+    }
+
+    GaussLegendreCoefficients coefficients;
+    coefficients.nodes = nodes.cast< double >( );
+    coefficients.integratedLagrangeCoefficients = integratedLagrangeCoefficients.cast< double >( );
+    coefficients.aCoefficients = Eigen::MatrixXd::Zero( s, s );
+    coefficients.bCoefficients = Eigen::VectorXd::Zero( s );
+    for( int j = 0; j < s; j++ )
+    {
+        long double weight = 0.0L;
+        for( int m = 0; m < s; m++ )
+        {
+            weight += integratedLagrangeCoefficients( m, j );
+        }
+        coefficients.bCoefficients( j ) = static_cast< double >( weight );
+
+        for( int i = 0; i < s; i++ )
+        {
+            long double aCoefficient = 0.0L;
+            long double nodePower = nodes( i );
+            for( int m = 0; m < s; m++ )
+            {
+                aCoefficient += integratedLagrangeCoefficients( m, j ) * nodePower;
+                nodePower *= nodes( i );
+            }
+            coefficients.aCoefficients( i, j ) = static_cast< double >( aCoefficient );
+        }
+    }
+
+    return coefficients;
+}
+
+template class GaussLegendreIntegrator < double, Eigen::VectorXd, Eigen::VectorXd >;
+template class GaussLegendreIntegrator < double, Eigen::Vector6d, Eigen::Vector6d >;
+template class GaussLegendreIntegrator < double, Eigen::MatrixXd, Eigen::MatrixXd >;
+
+} // namespace numerical_integrators
+} // namespace tudat
@@ -0,0 +1,467 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Hairer, E., Lubich, C., Wanner, G. Geometric Numerical Integration, 2nd Edition, Springer, 2006.
+ *      Hairer, E., Wanner, G. Solving Ordinary Differential Equations II, 2nd Edition, Springer, 1996.
+ *
+ */
+
+#ifndef TUDAT_GAUSS_LEGENDRE_INTEGRATOR_H
+#define TUDAT_GAUSS_LEGENDRE_INTEGRATOR_H
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/basicTypedefs.h"
+#include "Tudat/Mathematics/NumericalIntegrators/reinitializableNumericalIntegrator.h"
+
+namespace tudat
+{
+namespace numerical_integrators
+{
+
+//! Coefficients of a Gauss-Legendre collocation method.
+/*!
+ * Coefficients of a Gauss-Legendre collocation (implicit Runge-Kutta) method with s stages. The collocation polynomial
+ * of a step from t_n with step size h is u(t_n + theta h) = y_n + h sum_j L_j(theta) k_j, with k_j the stage
+ * derivatives and L_j(theta) = sum_m P_mj theta^(m+1) the integral from 0 to theta of the Lagrange polynomial of node
+ * c_j. The Butcher coefficients are a_ij = L_j(c_i) and b_j = L_j(1).
+ */
+struct GaussLegendreCoefficients
+{
+    //! Nodes c_i (roots of the shifted Legendre polynomial of degree s, in increasing order).
+    Eigen::VectorXd nodes;
+
+    //! Butcher coefficients a_ij.
+    Eigen::MatrixXd aCoefficients;
+
+    //! Weights b_j.
+    Eigen::VectorXd bCoefficients;
+
+    //! Coefficients P_mj of the integrated Lagrange polynomials (row m: coefficient of theta^(m+1)).
+    Eigen::MatrixXd integratedLagrangeCoefficients;
+};
+
+//! Function to compute the coefficients of a Gauss-Legendre collocation method.
+/*!
+ * Function to compute the coefficients of a Gauss-Legendre collocation method, of order 2 s.
+ * \param numberOfStages Number of stages s (1 to 6).
+ * \return Coefficients of the method.
+ */
+GaussLegendreCoefficients computeGaussLegendreCoefficients( const unsigned int numberOfStages );
+
+//! Fixed step size implicit Gauss-Legendre Runge-Kutta integrator.
+/*!
+ * Fixed step size implicit Runge-Kutta integrator of the Gauss-Legendre family, with s stages and order 2 s. The
+ * method is symplectic and symmetric, so that the energy error for conservative systems remains bounded over long
+ * integration arcs, and it can be applied to any first-order system (including velocity-dependent accelerations).
+ * The implicit stage equations are solved by fixed-point iteration, which does not require the Jacobian of the state
+ * derivative function. The initial guess of the stage values is obtained by extrapolation of the collocation
+ * polynomial of the previous step, which typically reduces the number of iterations per step to a few. The iteration
+ * is stopped when the relative stage increment (each element scaled by |y| + |h k_1|) is below the tolerance, or when
+ * it stagnates at round-off level. An exception is thrown if the iteration does not converge, which indicates that the
+ * step size is too large.
+ * \tparam IndependentVariableType The type of the independent variable.
+ * \tparam StateType The type of the state (an Eigen matrix type).
+ * \tparam StateDerivativeType The type of the state derivative.
+ * \tparam TimeStepType The type of the time step.
+ * \sa NumericalIntegrator.
+ */
+template< typename IndependentVariableType = double, typename StateType = Eigen::VectorXd,
+          typename StateDerivativeType = Eigen::VectorXd, typename TimeStepType = IndependentVariableType >
+class GaussLegendreIntegrator
+        : public ReinitializableNumericalIntegrator<
+        IndependentVariableType, StateType, StateDerivativeType, TimeStepType >
+{
+public:
+
+    //! Typedef for the base class.
+    /*!
+     * Typedef of the base class with all template parameters filled in.
+     */
+    typedef ReinitializableNumericalIntegrator< IndependentVariableType, StateType,
+    StateDerivativeType, TimeStepType > ReinitializableNumericalIntegratorBase;
+
+    //! Typedef for the state derivative function.
+    /*!
+     * Typedef to the state derivative function inherited from the base class.
+     * \sa NumericalIntegrator::StateDerivativeFunction.
+     */
+    typedef typename ReinitializableNumericalIntegratorBase::NumericalIntegratorBase::
+    StateDerivativeFunction StateDerivativeFunction;
+
+    //! Typedef for the scalar type of the state.
+    typedef typename StateType::Scalar StateScalarType;
+
+    //! Constructor.
+    /*!
+     * Constructor.
+     * \param stateDerivativeFunction State derivative function.
+     * \param intervalStart The start of the integration interval.
+     * \param initialState The initial state.
+     * \param stepSize Step size that is to be used (negative for backwards integration).
+     * \param numberOfStages Number of stages s (1 to 6), the order of the integrator is 2 s (default 3).
+     * \param maximumNumberOfIterations Maximum number of fixed-point iterations per step (default 50).
+     * \param iterationTolerance Relative tolerance of the stage increment at which the fixed-point iteration is
+     *      considered converged (default 1.0E-15).
+     */
+    GaussLegendreIntegrator(
+            const StateDerivativeFunction& stateDerivativeFunction,
+            const IndependentVariableType intervalStart,
+            const StateType& initialState,
+            const TimeStepType stepSize,
+            const unsigned int numberOfStages = 3,
+            const unsigned int maximumNumberOfIterations = 50,
+            const double iterationTolerance = 1.0E-15 )
+        : ReinitializableNumericalIntegratorBase( stateDerivativeFunction ),
+          currentIndependentVariable_( intervalStart ),
+          currentState_( initialState ),
+          lastIndependentVariable_( intervalStart ),
+          lastState_( initialState ),
+          stepSize_( stepSize ),
+          coefficients_( computeGaussLegendreCoefficients( numberOfStages ) ),
+          numberOfStages_( static_cast< int >( numberOfStages ) ),
+          maximumNumberOfIterations_( maximumNumberOfIterations ),
+          iterationTolerance_( iterationTolerance ),
+          stageStates_( numberOfStages, initialState ),
+          stageDerivatives_( numberOfStages, StateDerivativeType::Zero( initialState.rows( ), initialState.cols( ) ) ),
+          newStageState_( initialState ),
+          incrementScale_( initialState ),
+          previousStepSize_( stepSize ),
+          isExtrapolationAvailable_( false ),
+          numberOfIterationsOfLastStep_( 0 )
+    {
+        if( !( static_cast< double >( stepSize ) != 0.0 ) )
+        {
+            throw std::runtime_error( "Error in Gauss-Legendre integrator, step size must be non-zero." );
+        }
+        if( maximumNumberOfIterations < 1 || !( iterationTolerance > 0.0 ) )
+        {
+            throw std::runtime_error( "Error in Gauss-Legendre integrator, maximum number of iterations and iteration "
+                                      "tolerance must be positive." );
+        }
+    }
+
+    //! Default destructor.
+    ~GaussLegendreIntegrator( ){ }
+
+    //! Get step size of the next step.
+    /*!
+     * Returns the step size of the next step, which is equal to the step size of the last step (fixed step size).
+     * \return Step size to be used for the next step.
+     */
+    virtual TimeStepType getNextStepSize( ) const { return stepSize_; }
+
+    //! Get current state.
+    /*!
+     * Returns the current state of the integrator.
+     * \return Current integrated state.
+     */
+    virtual StateType getCurrentState( ) const { return currentState_; }
+
+    //! Returns the current independent variable.
+    /*!
+     * Returns the current value of the independent variable of the integrator.
+     * \return Current independent variable.
+     */
+    virtual IndependentVariableType getCurrentIndependentVariable( ) const
+    {
+        return currentIndependentVariable_;
+    }
+
+    //! Get previous independent variable.
+    /*!
+     * Returns the previous value of the independent variable of the integrator.
+     * \return Previous independent variable.
+     */
+    virtual IndependentVariableType getPreviousIndependentVariable( )
+    {
+        return lastIndependentVariable_;
+    }
+
+    //! Get previous state value.
+    /*!
+     * Returns the previous value of the state.
+     * \return Previous state
+     */
+    virtual StateType getPreviousState( )
+    {
+        return lastState_;
+    }
+
+    //! Perform a single integration step.
+    /*!
+     * Perform a single integration step, solving the implicit stage equations by fixed-point iteration.
+     * \param stepSize The step size to take.
+     * \return The state at the end of the interval.
+     */
+    virtual StateType performIntegrationStep( const TimeStepType stepSize )
+    {
+        computeInitialStageStates( stepSize );
+
+        // Store variables for rollback.
+        lastIndependentVariable_ = currentIndependentVariable_;
+        lastState_ = currentState_;
+        stepSize_ = stepSize;
+
+        const StateScalarType scalarStepSize = static_cast< StateScalarType >( stepSize );
+        StateScalarType previousIncrement = std::numeric_limits< StateScalarType >::max( );
+        for( unsigned int iteration = 1; ; iteration++ )
+        {
+            for( int j = 0; j < numberOfStages_; j++ )
+            {
+                stageDerivatives_[ j ] = this->stateDerivativeFunction_(
+                            currentIndependentVariable_ +
+                            static_cast< TimeStepType >( coefficients_.nodes( j ) ) * stepSize, stageStates_[ j ] );
+            }
+
+            // Scale of the increment of each element, zero scales are replaced by the smallest positive number, so that
+            // any non-zero increment of such an element prevents convergence.
+            if( iteration == 1 )
+            {
+                incrementScale_ = ( currentState_.array( ).abs( ) +
+                                    std::fabs( scalarStepSize ) * stageDerivatives_[ 0 ].array( ).abs( ) ).max(
+                            std::numeric_limits< StateScalarType >::min( ) ).matrix( );
+            }
+
+            StateScalarType increment = 0.0;
+            for( int i = 0; i < numberOfStages_; i++ )
+            {
+                newStageState_ = currentState_;
+                for( int j = 0; j < numberOfStages_; j++ )
+                {
+                    newStageState_ += ( static_cast< StateScalarType >( coefficients_.aCoefficients( i, j ) ) *
+                                        scalarStepSize ) * stageDerivatives_[ j ];
+                }
+                increment = std::max( increment, ( ( newStageState_ - stageStates_[ i ] ).array( ).abs( ) /
+                                                   incrementScale_.array( ) ).maxCoeff( ) );
+                stageStates_[ i ] = newStageState_;
+            }
+
+            // Stop when converged, or when the increment no longer decreases close to the tolerance (round-off level
+            // reached). The increment need not decrease monotonically before that (e.g. for oscillatory motion).
+            if( increment <= iterationTolerance_ ||
+                    ( increment <= 1000.0 * iterationTolerance_ && !( increment < previousIncrement ) ) )
+            {
+                numberOfIterationsOfLastStep_ = iteration;
+                break;
+            }
+            else if( iteration >= maximumNumberOfIterations_ )
+            {
+                throw std::runtime_error(
+                            "Error in Gauss-Legendre integrator, fixed-point iteration did not converge in " +
+                            std::to_string( iteration ) + " iterations (relative increment " +
+                            std::to_string( static_cast< double >( increment ) ) + "), step size is too large." );
+            }
+            previousIncrement = increment;
+        }
+
+        for( int j = 0; j < numberOfStages_; j++ )
+        {
+            currentState_ += ( static_cast< StateScalarType >( coefficients_.bCoefficients( j ) ) * scalarStepSize ) *
+                    stageDerivatives_[ j ];
+        }
+        currentIndependentVariable_ = currentIndependentVariable_ + stepSize;
+
+        previousStepSize_ = stepSize;
+        isExtrapolationAvailable_ = true;
+        return currentState_;
+    }
+
+    //! Rollback internal state to the last state.
+    /*!
+     * Performs rollback of internal state to the last state. This function can only be called once after calling
+     * integrateTo( ) or performIntegrationStep( ).
+     * \return True if the rollback was successful.
+     */
+    virtual bool rollbackToPreviousState( )
+    {
+        if( currentIndependentVariable_ == lastIndependentVariable_ )
+        {
+            return false;
+        }
+
+        currentIndependentVariable_ = lastIndependentVariable_;
+        currentState_ = lastState_;
+        isExtrapolationAvailable_ = false;
+        return true;
+    }
+
+    //! Replace the state with a new value.
+    /*!
+     * Replace the state with a new value.
+     * \param newState The value of the new state.
+     * \param allowRollback Boolean denoting whether roll-back should be allowed.
+     */
+    void modifyCurrentState( const StateType& newState, const bool allowRollback = false )
+    {
+        currentState_ = newState;
+        isExtrapolationAvailable_ = false;
+        if ( !allowRollback )
+        {
+            lastIndependentVariable_ = currentIndependentVariable_;
+        }
+    }
+
+    //! Modify the state and time for the current step.
+    /*!
+     * Modify the state and time for the current step.
+     * \param newState The new state to set the current state to.
+     * \param newTime The time to set the current time to.
+     * \param allowRollback Boolean denoting whether roll-back should be allowed.
+     */
+    void modifyCurrentIntegrationVariables( const StateType& newState, const IndependentVariableType newTime,
+                                            const bool allowRollback = false )
+    {
+        currentState_ = newState;
+        currentIndependentVariable_ = newTime;
+        isExtrapolationAvailable_ = false;
+        if ( !allowRollback )
+        {
+            lastIndependentVariable_ = currentIndependentVariable_;
+        }
+    }
+
+    //! Function to retrieve the order of the integrator.
+    /*!
+     * Function to retrieve the order of the integrator.
+     * \return Order of the integrator (twice the number of stages).
+     */
+    unsigned int getOrder( ) const { return 2 * static_cast< unsigned int >( numberOfStages_ ); }
+
+    //! Function to retrieve the number of fixed-point iterations of the last step.
+    /*!
+     * Function to retrieve the number of fixed-point iterations of the last step. The number of state derivative
+     * evaluations of the step is the number of iterations times the number of stages.
+     * \return Number of fixed-point iterations of the last step.
+     */
+    unsigned int getNumberOfIterationsOfLastStep( ) const { return numberOfIterationsOfLastStep_; }
+
+    //! Function to retrieve the coefficients of the method.
+    /*!
+     * Function to retrieve the coefficients of the method.
+     * \return Coefficients of the method.
+     */
+    const GaussLegendreCoefficients& getCoefficients( ) const { return coefficients_; }
+
+protected:
+
+    //! Function to set the initial guess of the stage values of the next step.
+    /*!
+     * Function to set the initial guess of the stage values of the next step, by extrapolation of the collocation
+     * polynomial of the last step (if the current state is the end of the last step), or equal to the current state.
+     * Must be called before the current state and step size are stored as the last state and step size.
+     * \param stepSize Step size of the next step.
+     */
+    void computeInitialStageStates( const TimeStepType stepSize )
+    {
+        if( !isExtrapolationAvailable_ )
+        {
+            for( int i = 0; i < numberOfStages_; i++ )
+            {
+                stageStates_[ i ] = currentState_;
+            }
+            return;
+        }
+
+        // Stage i of the next step is at theta = 1 + r c_i of the last step, with u(1) equal to the current state.
+        const double stepSizeRatio = static_cast< double >( stepSize ) / static_cast< double >( previousStepSize_ );
+        const StateScalarType scalarPreviousStepSize = static_cast< StateScalarType >( previousStepSize_ );
+        for( int i = 0; i < numberOfStages_; i++ )
+        {
+            const double theta = 1.0 + stepSizeRatio * coefficients_.nodes( i );
+            double thetaPower = theta;
+            Eigen::VectorXd integratedLagrangePolynomials = Eigen::VectorXd::Zero( numberOfStages_ );
+            for( int m = 0; m < numberOfStages_; m++ )
+            {
+                integratedLagrangePolynomials += thetaPower *
+                        coefficients_.integratedLagrangeCoefficients.row( m ).transpose( );
+                thetaPower *= theta;
+            }
+
+            stageStates_[ i ] = currentState_;
+            for( int j = 0; j < numberOfStages_; j++ )
+            {
+                stageStates_[ i ] += ( static_cast< StateScalarType >(
+                                           integratedLagrangePolynomials( j ) - coefficients_.bCoefficients( j ) ) *
+                                       scalarPreviousStepSize ) * stageDerivatives_[ j ];
+            }
+        }
+    }
+
+    //! Current independent variable.
+    IndependentVariableType currentIndependentVariable_;
+
+    //! Current state.
+    StateType currentState_;
+
+    //! Independent variable at start of last step.
+    IndependentVariableType lastIndependentVariable_;
+
+    //! State at start of last step.
+    StateType lastState_;
+
+    //! Step size of (next) step.
+    TimeStepType stepSize_;
+
+    //! Coefficients of the method.
+    GaussLegendreCoefficients coefficients_;
+
+    //! Number of stages.
+    int numberOfStages_;
+
+    //! Maximum number of fixed-point iterations per step.
+    unsigned int maximumNumberOfIterations_;
+
+    //! Relative tolerance of the stage increment at which the fixed-point iteration is considered converged.
+    double iterationTolerance_;
+
+    //! Stage values (of current iteration).
+    std::vector< StateType > stageStates_;
+
+    //! Stage derivatives (of current iteration, and of the last step after it has been completed).
+    std::vector< StateDerivativeType > stageDerivatives_;
+
+    //! Work state for the update of the stage values.
+    StateType newStageState_;
+
+    //! Scale of the increment of each element of the stage values.
+    StateType incrementScale_;
+
+    //! Step size of the last step (for the extrapolation of its collocation polynomial).
+    TimeStepType previousStepSize_;
+
+    //! Boolean denoting whether the stage derivatives of the last step can be used for extrapolation.
+    bool isExtrapolationAvailable_;
+
+    //! Number of fixed-point iterations of the last step.
+    unsigned int numberOfIterationsOfLastStep_;
+};
+
+extern template class GaussLegendreIntegrator < double, Eigen::VectorXd, Eigen::VectorXd >;
+extern template class GaussLegendreIntegrator < double, Eigen::Vector6d, Eigen::Vector6d >;
+extern template class GaussLegendreIntegrator < double, Eigen::MatrixXd, Eigen::MatrixXd >;
+
+//! Typedef of Gauss-Legendre integrator (state/state derivative = VectorXd, independent variable = double).
+typedef GaussLegendreIntegrator< > GaussLegendreIntegratorXd;
+
+//! Typedef of pointer to default Gauss-Legendre integrator.
+typedef std::shared_ptr< GaussLegendreIntegratorXd > GaussLegendreIntegratorXdPointer;
+
+} // namespace numerical_integrators
+
+} // namespace tudat
+
+#endif // TUDAT_GAUSS_LEGENDRE_INTEGRATOR_H
@@ -0,0 +1,241 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ */
+
+#ifndef TUDAT_MULTISTEP_HISTORY_BUFFER_H
+#define TUDAT_MULTISTEP_HISTORY_BUFFER_H
+
+#include <stdexcept>
+
+#include <Eigen/Core>
+
+namespace tudat
+{
+
+namespace numerical_integrators
+{
+
+//! Circular buffer storing the history of a multi-step integrator in a single matrix.
+/*!
+ * Circular buffer storing the history of a multi-step integrator (e.g. states and state derivatives at previous
+ * steps), with each entry stored as a column of a single, preallocated, matrix. Entries are indexed from the most
+ * recent (index 0) to the oldest (index getSize( ) - 1). Each entry is stored twice (in column i and i + capacity),
+ * so that any range of entries is contiguous in memory, and can be retrieved as a single (strided) matrix block
+ * without copying. Adding and removing entries at either end does not move any data.
+ * \tparam ScalarType Scalar type of the entries.
+ */
+template< typename ScalarType >
+class MultistepHistoryBuffer
+{
+public:
+
+    //! Typedef for matrix in which history is stored.
+    typedef Eigen::Matrix< ScalarType, Eigen::Dynamic, Eigen::Dynamic > HistoryMatrix;
+
+    //! Typedef for a (strided) range of entries of the history.
+    typedef Eigen::Map< const HistoryMatrix, 0, Eigen::OuterStride< > > HistoryRange;
+
+    //! Constructor.
+    /*!
+     * Constructor, allocates the buffer.
+     * \param entrySize Number of rows of each entry.
+     * \param capacity Maximum number of entries in the buffer. When adding an entry to a full buffer, the oldest entry
+     * is discarded.
+     */
+    MultistepHistoryBuffer( const int entrySize = 0, const int capacity = 1 ):
+        historyMatrix_( HistoryMatrix::Zero( entrySize, 2 * capacity ) ),
+        capacity_( capacity ), head_( 0 ), size_( 0 )
+    {
+        if( capacity < 1 )
+        {
+            throw std::runtime_error( "Error when creating multi-step history buffer, capacity must be positive." );
+        }
+    }
+
+    //! Function to retrieve the number of entries currently in the buffer.
+    /*!
+     * Function to retrieve the number of entries currently in the buffer.
+     * \return Number of entries currently in the buffer.
+     */
+    int getSize( ) const { return size_; }
+
+    //! Function to retrieve the maximum number of entries in the buffer.
+    /*!
+     * Function to retrieve the maximum number of entries in the buffer.
+     * \return Maximum number of entries in the buffer.
+     */
+    int getCapacity( ) const { return capacity_; }
+
+    //! Function to retrieve a segment of an entry.
+    /*!
+     * Function to retrieve a segment of an entry.
+     * \param entryIndex Index of the entry (0 for most recent entry).
+     * \param startRow First row of the segment.
+     * \param numberOfRows Number of rows of the segment.
+     * \return Segment of the entry.
+     */
+    Eigen::Block< const HistoryMatrix, Eigen::Dynamic, 1 > getSegment(
+            const int entryIndex, const int startRow, const int numberOfRows ) const
+    {
+        return Eigen::Block< const HistoryMatrix, Eigen::Dynamic, 1 >(
+                    historyMatrix_, startRow, head_ + entryIndex, numberOfRows, 1 );
+    }
+
+    //! Function to retrieve a segment of a (strided) range of entries, as a single matrix block.
+    /*!
+     * Function to retrieve a segment of a (strided) range of entries, as a single matrix block. Column j of the returned
+     * block is the segment of entry firstEntryIndex + j * entryStride.
+     * \param firstEntryIndex Index of the first entry in the range.
+     * \param numberOfEntries Number of entries in the range.
+     * \param entryStride Difference in index between subsequent entries in the range.
+     * \param startRow First row of the segment.
+     * \param numberOfRows Number of rows of the segment.
+     * \return Segment of the range of entries (without copying data).
+     */
+    HistoryRange getRange( const int firstEntryIndex, const int numberOfEntries, const int entryStride,
+                           const int startRow, const int numberOfRows ) const
+    {
+        return HistoryRange( historyMatrix_.data( ) + ( head_ + firstEntryIndex ) * historyMatrix_.rows( ) + startRow,
+                             numberOfRows, numberOfEntries, Eigen::OuterStride< >( entryStride * historyMatrix_.rows( ) ) );
+    }
+
+    //! Function to set a segment of an entry.
+    /*!
+     * Function to set a segment of an entry.
+     * \param entryIndex Index of the entry (0 for most recent entry).
+     * \param startRow First row of the segment.
+     * \param values New values of the segment (column vector).
+     */
+    template< typename Derived >
+    void setSegment( const int entryIndex, const int startRow, const Eigen::MatrixBase< Derived >& values )
+    {
+        const int column = head_ + entryIndex;
+        historyMatrix_.block( startRow, column, values.rows( ), 1 ) = values;
+        historyMatrix_.block( startRow, getMirroredColumn( column ), values.rows( ), 1 ) =
+                historyMatrix_.block( startRow, column, values.rows( ), 1 );
+    }
+
+    //! Function to copy an entry to another position in the buffer.
+    /*!
+     * Function to copy an entry to another position in the buffer.
+     * \param originIndex Index of the entry that is to be copied.
+     * \param targetIndex Index of the entry that is to be overwritten.
+     */
+    void copyEntry( const int originIndex, const int targetIndex )
+    {
+        const int targetColumn = head_ + targetIndex;
+        historyMatrix_.col( targetColumn ) = historyMatrix_.col( head_ + originIndex );
+        historyMatrix_.col( getMirroredColumn( targetColumn ) ) = historyMatrix_.col( targetColumn );
+    }
+
+    //! Function to add an (uninitialized) entry as most recent entry.
+    /*!
+     * Function to add an (uninitialized) entry as most recent entry, which is to be set by setSegment. If the buffer is
+     * full, the oldest entry is discarded.
+     */
+    void pushFront( )
+    {
+        head_ = ( head_ == 0 ) ? capacity_ - 1 : head_ - 1;
+        if( size_ < capacity_ )
+        {
+            size_++;
+        }
+    }
+
+    //! Function to add an (uninitialized) entry as oldest entry.
+    /*!
+     * Function to add an (uninitialized) entry as oldest entry, which is to be set by setSegment.
+     */
+    void pushBack( )
+    {
+        if( size_ == capacity_ )
+        {
+            throw std::runtime_error( "Error when adding entry to back of multi-step history buffer, buffer is full." );
+        }
+        size_++;
+    }
+
+    //! Function to remove the most recent entry.
+    void popFront( )
+    {
+        head_ = ( head_ == capacity_ - 1 ) ? 0 : head_ + 1;
+        size_--;
+    }
+
+    //! Function to remove all entries beyond a given number.
+    /*!
+     * Function to remove all entries beyond a given number (no data is moved or deallocated).
+     * \param numberOfEntries Number of (most recent) entries to retain.
+     */
+    void truncate( const int numberOfEntries )
+    {
+        if( numberOfEntries < size_ )
+        {
+            size_ = numberOfEntries;
+        }
+    }
+
+    //! Function to set the number of entries in the buffer.
+    /*!
+     * Function to set the number of entries in the buffer. Any new entries (if the size is increased) are uninitialized.
+     * \param numberOfEntries New number of entries in the buffer.
+     */
+    void resize( const int numberOfEntries )
+    {
+        if( numberOfEntries > capacity_ )
+        {
+            throw std::runtime_error( "Error when resizing multi-step history buffer, capacity is exceeded." );
+        }
+        size_ = numberOfEntries;
+    }
+
+    //! Function to retrieve the position of the most recent entry, to restore the buffer by restoreLayout.
+    int getHead( ) const { return head_; }
+
+    //! Function to restore the layout of the buffer to a previous configuration.
+    /*!
+     * Function to restore the layout of the buffer to a previous configuration, as retrieved by getHead and getSize. The
+     * restored entries are only valid if they have not been overwritten since (i.e. if fewer entries were added than the
+     * capacity minus the restored size, and the entries have not been modified).
+     * \param head Position of most recent entry.
+     * \param size Number of entries.
+     */
+    void restoreLayout( const int head, const int size )
+    {
+        head_ = head;
+        size_ = size;
+    }
+
+private:
+
+    //! Function to get the column in which the copy of an entry is stored.
+    int getMirroredColumn( const int column ) const
+    {
+        return ( column < capacity_ ) ? column + capacity_ : column - capacity_;
+    }
+
+    //! Matrix in which history is stored, with each entry stored in two columns.
+    HistoryMatrix historyMatrix_;
+
+    //! Maximum number of entries in the buffer.
+    int capacity_;
+
+    //! Column (in range [0, capacity_) ) of the most recent entry.
+    int head_;
+
+    //! Number of entries in the buffer.
+    int size_;
+};
+
+} // namespace numerical_integrators
+
+} // namespace tudat
+
+#endif // TUDAT_MULTISTEP_HISTORY_BUFFER_H
@@ -21,6 +21,7 @@
 #include <Eigen/Core>
 
 #include "Tudat/Basics/basicTypedefs.h"
+#include "Tudat/Basics/binarySerialization.h"
 #include "Tudat/Basics/timeType.h"
 #include "Tudat/Basics/utilityMacros.h"
 #include "Tudat/Mathematics/BasicMathematics/mathematicalConstants.h"
@@ -158,6 +159,32 @@ public:
      */
     virtual StateType performIntegrationStep( const TimeStepType stepSize ) = 0;
 
+    //! Function to check whether the integrator can interpolate the state within the last step (dense output).
+    /*!
+     * Function to check whether the integrator can interpolate the state within the last step (dense output), using the
+     * getDenseOutputState function. Derived classes that provide dense output should override this function.
+     * \return True if dense output is available.
+     */
+    virtual bool isDenseOutputAvailable( ) const
+    {
+        return false;
+    }
+
+    //! Function to compute the state at an independent variable value within the last step (dense output).
+    /*!
+     * Function to compute the state at an independent variable value within the last step (between the previous and
+     * current independent variable), without modifying the integration itself. Derived classes that provide dense
+     * output should override this function. If not implemented, throws error.
+     * \param independentVariable Independent variable value at which the state is to be computed.
+     * \return State at requested independent variable value.
+     */
+    virtual StateType getDenseOutputState( const IndependentVariableType independentVariable )
+    {
+        TUDAT_UNUSED_PARAMETER( independentVariable );
+        throw std::runtime_error( "Error in numerical integrator. Dense output has not been implemented in this "
+                                  "integrator." );
+    }
+
     //! Function to return the function that computes and returns the state derivative
     /*!
      * Function to return the function that computes and returns the state derivative
@@ -233,6 +260,36 @@ public:
                                   "been implemented in this integrator." );
     }
 
+    //! Function to write the internal state of the integrator to a binary stream.
+    /*!
+     * Function to write the internal state of the integrator to a binary stream, so that the integration can be resumed
+     * from this point (using readStateFromBinaryStream) by an integrator created with the same settings. By default, the
+     * current independent variable and state are written. Integrators that retain more information between steps
+     * (e.g. multi-step methods) should override this function, as well as readStateFromBinaryStream.
+     * \param outputStream Stream to which the integrator state is to be written.
+     */
+    virtual void writeStateToBinaryStream( std::ostream& outputStream )
+    {
+        utilities::writeToBinaryStream( outputStream, getCurrentIndependentVariable( ) );
+        utilities::writeToBinaryStream( outputStream, getCurrentState( ) );
+    }
+
+    //! Function to read the internal state of the integrator from a binary stream.
+    /*!
+     * Function to read the internal state of the integrator from a binary stream, as written by
+     * writeStateToBinaryStream, and continue the integration from this point. The state cannot be rolled back after
+     * calling this function.
+     * \param inputStream Stream from which the integrator state is to be read.
+     */
+    virtual void readStateFromBinaryStream( std::istream& inputStream )
+    {
+        IndependentVariableType currentIndependentVariable;
+        StateType currentState;
+        utilities::readFromBinaryStream( inputStream, currentIndependentVariable );
+        utilities::readFromBinaryStream( inputStream, currentState );
+        modifyCurrentIntegrationVariables( currentState, currentIndependentVariable );
+    }
+
 protected:
 
     //! Function that returns the state derivative.
@@ -12,13 +12,23 @@
  *      Fehlberg, E. Classical Fifth-, Sixth-, Seventh-, and Eighth-Order Runge-Kutta Formulas With
  *          Stepsize Control, Marshall Spaceflight Center, NASA TR R-278, 1968.
  *      Montenbruck, O., Gill, E. Satellite Orbits: Models, Methods, Applications, Springer, 2005.
+ *      Hairer, E., Norsett, S.P., Wanner, G. Solving Ordinary Differential Equations I, 2nd Edition, Springer, 1993.
+ *      Enright, W.H., et al. Interpolants for Runge-Kutta formulas, ACM Transactions on Mathematical Software 12(3),
+ *          1986.
  *
  *    Notes
  *      The naming of the coefficient sets follows (Montenbruck and Gill, 2005).
  *
  */
 
+#include <cmath>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
 #include <Eigen/Core>
+#include <Eigen/QR>
 
 #include "Tudat/Mathematics/NumericalIntegrators/rungeKuttaCoefficients.h"
 
@@ -27,6 +37,240 @@ namespace tudat
 namespace numerical_integrators
 {
 
+//! Rooted tree, used to define the order conditions of a Runge-Kutta method (Hairer et al., 1993).
+struct RootedTree
+{
+    //! Order of the tree (number of nodes).
+    unsigned int order;
+
+    //! Density of the tree.
+    double density;
+
+    //! Indices (in list of trees) of the subtrees attached to the root.
+    std::vector< int > subtrees;
+};
+
+//! Function to generate all rooted trees up to a given order.
+/*!
+ * Function to generate all rooted trees up to a given order, sorted by order. Each tree is generated once, as the root
+ * with a non-decreasing (by index) list of previously generated subtrees.
+ * \param maximumOrder Maximum order of the trees.
+ * \return List of all rooted trees up to given order.
+ */
+std::vector< RootedTree > generateRootedTrees( const unsigned int maximumOrder )
+{
+    std::vector< RootedTree > rootedTrees;
+    rootedTrees.push_back( RootedTree{ 1, 1.0, std::vector< int >( ) } );
+
+    for( unsigned int currentOrder = 2; currentOrder <= maximumOrder; currentOrder++ )
+    {
+        const int numberOfLowerOrderTrees = static_cast< int >( rootedTrees.size( ) );
+
+        // Add all combinations of subtrees with total order currentOrder - 1.
+        std::vector< int > subtrees;
+        std::function< void( const unsigned int, const int ) > addSubtrees =
+                [ & ]( const unsigned int remainingOrder, const int minimumSubtreeIndex )
+        {
+            if( remainingOrder == 0 )
+            {
+                double density = static_cast< double >( currentOrder );
+                for( unsigned int i = 0; i < subtrees.size( ); i++ )
+                {
+                    density *= rootedTrees.at( subtrees.at( i ) ).density;
+                }
+                rootedTrees.push_back( RootedTree{ currentOrder, density, subtrees } );
+                return;
+            }
+
+            for( int i = minimumSubtreeIndex; i < numberOfLowerOrderTrees; i++ )
+            {
+                if( rootedTrees.at( i ).order <= remainingOrder )
+                {
+                    subtrees.push_back( i );
+                    addSubtrees( remainingOrder - rootedTrees.at( i ).order, i );
+                    subtrees.pop_back( );
+                }
+            }
+        };
+        addSubtrees( currentOrder - 1, 0 );
+    }
+
+    return rootedTrees;
+}
+
+//! Function to compute the elementary weights of all stages of a Runge-Kutta method, for a list of rooted trees.
+/*!
+ * Function to compute the elementary weights of all stages of a Runge-Kutta method, for a list of rooted trees.
+ * \param aCoefficients Square, strictly lower triangular, main table of the Butcher tableau.
+ * \param rootedTrees List of rooted trees, as generated by generateRootedTrees.
+ * \return Elementary weights, with one row per stage, and one column per tree.
+ */
+Eigen::MatrixXd computeElementaryWeights( const Eigen::MatrixXd& aCoefficients,
+                                          const std::vector< RootedTree >& rootedTrees )
+{
+    Eigen::MatrixXd elementaryWeights = Eigen::MatrixXd::Ones( aCoefficients.rows( ), rootedTrees.size( ) );
+    for( unsigned int i = 0; i < rootedTrees.size( ); i++ )
+    {
+        for( unsigned int j = 0; j < rootedTrees.at( i ).subtrees.size( ); j++ )
+        {
+            elementaryWeights.col( i ).array( ) *=
+                    ( aCoefficients * elementaryWeights.col( rootedTrees.at( i ).subtrees.at( j ) ) ).array( );
+        }
+    }
+    return elementaryWeights;
+}
+
+//! Function to compute the (minimum-norm) weights of a continuous extension of given order, if possible.
+/*!
+ * Function to compute the (minimum-norm) weights of a continuous extension of given order, if possible. The polynomial
+ * weights are of degree order + 2, and are constrained such that the interpolated state, and its derivative, are
+ * equal to the propagated state, and the state derivative (stage endPointStageIndex), at the end of the step.
+ * \param aCoefficients Square, strictly lower triangular, main table of the Butcher tableau (including additional stages).
+ * \param propagatedWeights Weights of propagated solution (zero for additional stages).
+ * \param endPointStageIndex Index of stage that evaluates the state derivative at the end of the step.
+ * \param rootedTrees List of rooted trees, as generated by generateRootedTrees (at least up to order).
+ * \param order Order of the continuous extension.
+ * \param polynomialWeights Polynomial coefficients of the weights (returned by reference, see
+ * RungeKuttaCoefficients::denseOutputBCoefficients).
+ * \return True if the order conditions could be satisfied.
+ */
+bool computeContinuousExtensionWeights( const Eigen::MatrixXd& aCoefficients,
+                                        const Eigen::VectorXd& propagatedWeights,
+                                        const int endPointStageIndex,
+                                        const std::vector< RootedTree >& rootedTrees,
+                                        const unsigned int order,
+                                        Eigen::MatrixXd& polynomialWeights )
+{
+    const int numberOfStages = static_cast< int >( aCoefficients.rows( ) );
+    const int polynomialDegree = static_cast< int >( order ) + 2;
+
+    int numberOfTrees = 0;
+    while( numberOfTrees < static_cast< int >( rootedTrees.size( ) ) &&
+           rootedTrees.at( numberOfTrees ).order <= order )
+    {
+        numberOfTrees++;
+    }
+    const Eigen::MatrixXd elementaryWeights = computeElementaryWeights( aCoefficients, rootedTrees ).leftCols(
+                numberOfTrees );
+
+    // Set up order conditions for each power of theta (unknowns ordered by power), and end point conditions.
+    const int numberOfUnknowns = numberOfStages * polynomialDegree;
+    Eigen::MatrixXd conditionMatrix = Eigen::MatrixXd::Zero(
+                numberOfTrees * polynomialDegree + 2 * numberOfStages, numberOfUnknowns );
+    Eigen::VectorXd conditionValues = Eigen::VectorXd::Zero( conditionMatrix.rows( ) );
+    for( int power = 1; power <= polynomialDegree; power++ )
+    {
+        conditionMatrix.block( ( power - 1 ) * numberOfTrees, ( power - 1 ) * numberOfStages,
+                               numberOfTrees, numberOfStages ) = elementaryWeights.transpose( );
+        for( int i = 0; i < numberOfTrees; i++ )
+        {
+            if( static_cast< int >( rootedTrees.at( i ).order ) == power )
+            {
+                conditionValues( ( power - 1 ) * numberOfTrees + i ) = 1.0 / rootedTrees.at( i ).density;
+            }
+        }
+
+        conditionMatrix.block( numberOfTrees * polynomialDegree, ( power - 1 ) * numberOfStages,
+                               numberOfStages, numberOfStages ).setIdentity( );
+        conditionMatrix.block( numberOfTrees * polynomialDegree + numberOfStages, ( power - 1 ) * numberOfStages,
+                               numberOfStages, numberOfStages ) =
+                static_cast< double >( power ) * Eigen::MatrixXd::Identity( numberOfStages, numberOfStages );
+    }
+    conditionValues.segment( numberOfTrees * polynomialDegree, numberOfStages ) = propagatedWeights;
+    conditionValues( numberOfTrees * polynomialDegree + numberOfStages + endPointStageIndex ) = 1.0;
+
+    // Compute minimum-norm solution, and check whether conditions are satisfied.
+    const Eigen::VectorXd solution = conditionMatrix.completeOrthogonalDecomposition( ).solve( conditionValues );
+    if( ( conditionMatrix * solution - conditionValues ).cwiseAbs( ).maxCoeff( ) > 1.0E-10 )
+    {
+        return false;
+    }
+
+    polynomialWeights = Eigen::Map< const Eigen::MatrixXd >( solution.data( ), numberOfStages, polynomialDegree );
+    return true;
+}
+
+//! Function to compute a continuous extension (dense output) for a set of Runge-Kutta coefficients.
+void computeContinuousExtension( RungeKuttaCoefficients& coefficients,
+                                 const unsigned int denseOutputOrder )
+{
+    // Nodes of additional (bootstrapping) stages, in order of use.
+    static const std::vector< double > bootstrapNodes =
+    { 1.0 / 2.0, 1.0 / 3.0, 2.0 / 3.0, 1.0 / 4.0, 3.0 / 4.0, 1.0 / 5.0, 4.0 / 5.0, 1.0 / 6.0, 5.0 / 6.0 };
+
+    const unsigned int propagatedOrder = ( coefficients.orderEstimateToIntegrate == RungeKuttaCoefficients::lower ) ?
+                coefficients.lowerOrder : coefficients.higherOrder;
+    if( denseOutputOrder < 1 || denseOutputOrder > propagatedOrder )
+    {
+        throw std::runtime_error( "Error when computing Runge-Kutta continuous extension, order " +
+                                  std::to_string( denseOutputOrder ) + " is not supported." );
+    }
+
+    const std::vector< RootedTree > rootedTrees = generateRootedTrees( denseOutputOrder );
+
+    // Set square Butcher tableau, with first additional stage evaluating the state derivative at the end of the step.
+    const int numberOfRegularStages = static_cast< int >( coefficients.cCoefficients.rows( ) );
+    const Eigen::VectorXd propagatedWeights = coefficients.bCoefficients.row(
+                ( coefficients.orderEstimateToIntegrate == RungeKuttaCoefficients::lower ) ? 0 : 1 ).transpose( );
+
+    int numberOfStages = numberOfRegularStages + 1;
+    Eigen::MatrixXd aCoefficients = Eigen::MatrixXd::Zero( numberOfStages, numberOfStages );
+    aCoefficients.block( 0, 0, numberOfRegularStages, coefficients.aCoefficients.cols( ) ) = coefficients.aCoefficients;
+    aCoefficients.block( numberOfRegularStages, 0, 1, numberOfRegularStages ) = propagatedWeights.transpose( );
+    std::vector< double > additionalNodes = { 1.0 };
+
+    // Find highest order that can be reached with current stages.
+    Eigen::MatrixXd polynomialWeights;
+    unsigned int currentOrder = 0;
+    while( currentOrder < denseOutputOrder )
+    {
+        Eigen::VectorXd extendedPropagatedWeights = Eigen::VectorXd::Zero( numberOfStages );
+        extendedPropagatedWeights.head( numberOfRegularStages ) = propagatedWeights;
+
+        Eigen::MatrixXd trialPolynomialWeights;
+        if( computeContinuousExtensionWeights(
+                    aCoefficients, extendedPropagatedWeights, numberOfRegularStages, rootedTrees, currentOrder + 1,
+                    trialPolynomialWeights ) )
+        {
+            polynomialWeights = trialPolynomialWeights;
+            currentOrder++;
+        }
+        else
+        {
+            // Add stage evaluated at the interpolated state of the current order.
+            const unsigned int numberOfBootstrapStages = additionalNodes.size( ) - 1;
+            if( currentOrder == 0 || numberOfBootstrapStages >= bootstrapNodes.size( ) )
+            {
+                throw std::runtime_error( "Error when computing Runge-Kutta continuous extension, order " +
+                                          std::to_string( denseOutputOrder ) + " could not be reached." );
+            }
+            const double newNode = bootstrapNodes.at( numberOfBootstrapStages );
+
+            // Weights of new stage are those of the current continuous extension, evaluated at the new node.
+            Eigen::VectorXd newStageWeights = Eigen::VectorXd::Zero( numberOfStages );
+            for( int j = polynomialWeights.cols( ) - 1; j >= 0; j-- )
+            {
+                newStageWeights.head( polynomialWeights.rows( ) ) += polynomialWeights.col( j );
+                newStageWeights *= newNode;
+            }
+
+            aCoefficients.conservativeResize( numberOfStages + 1, numberOfStages + 1 );
+            aCoefficients.row( numberOfStages ).setZero( );
+            aCoefficients.col( numberOfStages ).setZero( );
+            aCoefficients.block( numberOfStages, 0, 1, numberOfStages ) = newStageWeights.transpose( );
+            additionalNodes.push_back( newNode );
+            numberOfStages++;
+        }
+    }
+
+    // Set continuous extension in coefficients.
+    coefficients.denseOutputACoefficients = aCoefficients.bottomRows( numberOfStages - numberOfRegularStages );
+    coefficients.denseOutputCCoefficients = Eigen::Map< const Eigen::VectorXd >(
+                additionalNodes.data( ), additionalNodes.size( ) );
+    coefficients.denseOutputBCoefficients = polynomialWeights;
+    coefficients.denseOutputOrder = denseOutputOrder;
+}
+
 //! Initialize RKF45 coefficients.
 void initializeRungeKuttaFehlberg45Coefficients( RungeKuttaCoefficients&
                                                  rungeKuttaFehlberg45Coefficients )
@@ -281,6 +525,9 @@ void initializeRungeKuttaFehlberg78Coefficients( RungeKuttaCoefficients&
     rungeKuttaFehlberg78Coefficients.bCoefficients( 1, 11 ) = 41.0 / 840.0;
     rungeKuttaFehlberg78Coefficients.bCoefficients( 1, 12 ) =
             rungeKuttaFehlberg78Coefficients.bCoefficients( 1, 11 );
+
+    // Compute continuous extension of same order as propagated solution.
+    computeContinuousExtension( rungeKuttaFehlberg78Coefficients, 7 );
 }
 
 //! Initialize RK87 (Dormand and Prince) coefficients.
@@ -409,6 +656,9 @@ void initializerungeKutta87DormandPrinceCoefficients(
     rungeKutta87DormandPrinceCoefficients.bCoefficients( 1, 10 ) = 118820643.0 / 751138087.0;
     rungeKutta87DormandPrinceCoefficients.bCoefficients( 1, 11 ) = -528747749.0 / 2220607170.0;
     rungeKutta87DormandPrinceCoefficients.bCoefficients( 1, 12 ) = 1.0 / 4.0;
+
+    // Compute continuous extension (one order lower than propagated solution, see computeContinuousExtension).
+    computeContinuousExtension( rungeKutta87DormandPrinceCoefficients, 7 );
 }
 
 //! Get coefficients for a specified coefficient set
@@ -444,7 +694,7 @@ const RungeKuttaCoefficients& RungeKuttaCoefficients::get(
         return rungeKuttaFehlberg78Coefficients;
 
     case rungeKutta87DormandPrince:
-        if ( rungeKutta87DormandPrinceCoefficients.higherOrder != 7 )
+        if ( rungeKutta87DormandPrinceCoefficients.higherOrder != 8 )
         {
             initializerungeKutta87DormandPrinceCoefficients(
                         rungeKutta87DormandPrinceCoefficients );
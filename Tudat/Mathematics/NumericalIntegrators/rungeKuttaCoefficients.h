@@ -9,6 +9,9 @@
  *
  *    References
  *      Burden, R.L., Faires, J.D. Numerical Analysis, 7th Edition, Books/Cole, 2001.
+ *      Hairer, E., Norsett, S.P., Wanner, G. Solving Ordinary Differential Equations I, 2nd Edition, Springer, 1993.
+ *      Enright, W.H., et al. Interpolants for Runge-Kutta formulas, ACM Transactions on Mathematical Software 12(3),
+ *          1986.
  *
  */
 
@@ -51,6 +54,28 @@ struct RungeKuttaCoefficients
     //! Order estimate to integrate.
     OrderEstimateToIntegrate orderEstimateToIntegrate;
 
+    //! Main table of the Butcher tableau of the additional stages required for dense output.
+    /*!
+     * Main table of the Butcher tableau of the additional stages required for dense output (continuous extension). Each
+     * row defines one additional stage, and may use all regular stages, as well as preceding additional stages (in that
+     * order). Empty if no dense output is available.
+     */
+    Eigen::MatrixXd denseOutputACoefficients;
+
+    //! First column of the Butcher tableau of the additional stages required for dense output.
+    Eigen::VectorXd denseOutputCCoefficients;
+
+    //! Polynomial coefficients of the weights of the continuous extension.
+    /*!
+     * Polynomial coefficients of the weights of the continuous extension, such that the state at a fraction theta of the
+     * step is given by x_n + h * sum_i b_i( theta ) k_i, with b_i( theta ) = sum_j denseOutputBCoefficients( i, j ) *
+     * theta^( j + 1 ). The rows correspond to the regular stages, followed by the additional stages.
+     */
+    Eigen::MatrixXd denseOutputBCoefficients;
+
+    //! Order of the continuous extension (0 if no dense output is available).
+    unsigned int denseOutputOrder;
+
     //! Default constructor.
     /*!
      * Default constructor that initializes coefficients to 0.
@@ -61,7 +86,8 @@ struct RungeKuttaCoefficients
         cCoefficients( ),
         higherOrder( 0 ),
         lowerOrder( 0 ),
-        orderEstimateToIntegrate( lower )
+        orderEstimateToIntegrate( lower ),
+        denseOutputOrder( 0 )
     { }
 
     //! Constructor.
@@ -86,9 +112,20 @@ struct RungeKuttaCoefficients
         cCoefficients( cCoefficients_ ),
         higherOrder( higherOrder_ ),
         lowerOrder( lowerOrder_ ),
-        orderEstimateToIntegrate( order )
+        orderEstimateToIntegrate( order ),
+        denseOutputOrder( 0 )
     { }
 
+    //! Function to check whether a continuous extension (dense output) is available for this coefficient set.
+    /*!
+     * Function to check whether a continuous extension (dense output) is available for this coefficient set.
+     * \return True if dense output is available.
+     */
+    bool hasDenseOutput( ) const
+    {
+        return ( denseOutputOrder > 0 );
+    }
+
     //! Enum of predefined coefficient sets.
     enum CoefficientSets
     {
@@ -108,6 +145,23 @@ struct RungeKuttaCoefficients
     static const RungeKuttaCoefficients& get( CoefficientSets coefficientSet );
 };
 
+//! Function to compute a continuous extension (dense output) for a set of Runge-Kutta coefficients.
+/*!
+ * Function to compute a continuous extension (dense output) for a set of Runge-Kutta coefficients, and set it in the
+ * dense output members of the coefficients. The weights of the continuous extension are obtained as the minimum-norm
+ * solution of the order conditions of the continuous method (one for each rooted tree up to the requested order;
+ * Hairer et al., 1993, Section II.6), such that the interpolated state is continuously differentiable between steps.
+ * The first additional stage is the state derivative at the end of the step. If the requested order can not be
+ * attained with the available stages, additional stages are added, each of which evaluates the state derivative at the
+ * interpolated state of the highest order that is attainable with the preceding stages (bootstrapping; Enright et al.,
+ * 1986), until the requested order is reached.
+ * \param coefficients Runge-Kutta coefficients for which the continuous extension is to be computed (modified by
+ * reference).
+ * \param denseOutputOrder Requested order of the continuous extension (at most the order of the propagated solution).
+ */
+void computeContinuousExtension( RungeKuttaCoefficients& coefficients,
+                                 const unsigned int denseOutputOrder );
+
 //! Typedef for shared-pointer to RungeKuttaCoefficients object.
 typedef std::shared_ptr< RungeKuttaCoefficients > RungeKuttaCoefficientsPointer;
 
@@ -271,9 +271,33 @@ public:
 
         this->currentIndependentVariable_ = this->lastIndependentVariable_;
         this->currentState_ = this->lastState_;
+        isDenseOutputStepValid_ = false;
         return true;
     }
 
+    //! Function to check whether the integrator can interpolate the state within the last step (dense output).
+    /*!
+     * Function to check whether the integrator can interpolate the state within the last step (dense output), which is
+     * the case if the Runge-Kutta coefficients define a continuous extension.
+     * \return True if dense output is available.
+     */
+    virtual bool isDenseOutputAvailable( ) const
+    {
+        return coefficients_.hasDenseOutput( );
+    }
+
+    //! Function to compute the state at an independent variable value within the last step (dense output).
+    /*!
+     * Function to compute the state at an independent variable value within the last accepted step, using the
+     * continuous extension defined by the Runge-Kutta coefficients. The additional stages required by the continuous
+     * extension are computed at the first call for a given step, and reused for subsequent calls within the same step.
+     * Dense output is not available after the current state has been modified, or rolled back.
+     * \param independentVariable Independent variable value at which the state is to be computed, must be between the
+     * previous and current independent variable.
+     * \return State at requested independent variable value.
+     */
+    virtual StateType getDenseOutputState( const IndependentVariableType independentVariable );
+
     //! Get previous independent variable.
     /*!
      * Returns the previoius value of the independent variable of the integrator.
@@ -307,6 +331,7 @@ public:
     void modifyCurrentState( const StateType& newState, const bool allowRollback = false )
     {
         currentState_ = newState;
+        isDenseOutputStepValid_ = false;
         if ( !allowRollback )
         {
             this->lastIndependentVariable_ = currentIndependentVariable_;
@@ -325,6 +350,7 @@ public:
     {
         currentState_ = newState;
         currentIndependentVariable_ = newTime;
+        isDenseOutputStepValid_ = false;
         if ( !allowRollback )
         {
             this->lastIndependentVariable_ = currentIndependentVariable_;
@@ -483,6 +509,23 @@ protected:
     //! Boolean denoting whether step size control is to be used
     bool useStepSizeControl_;
 
+    //! Step size of last accepted step.
+    TimeStepType lastAcceptedStepSize_ = 0.0;
+
+    //! Boolean denoting whether the last step can be used for dense output.
+    /*!
+     * Boolean denoting whether the last step can be used for dense output, i.e. whether lastState_,
+     * lastIndependentVariable_, lastAcceptedStepSize_ and currentStateDerivatives_ define the last accepted step.
+     */
+    bool isDenseOutputStepValid_ = false;
+
+    //! State derivatives of the additional stages required for dense output of the last step.
+    /*!
+     * State derivatives of the additional stages required for dense output of the last step (empty if not yet computed
+     * for the last step).
+     */
+    std::vector< StateDerivativeType > denseOutputStateDerivatives_;
+
 };
 
 extern template class RungeKuttaVariableStepSizeIntegrator < double, Eigen::VectorXd, Eigen::VectorXd >;
@@ -497,6 +540,8 @@ RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateD
 ::performIntegrationStep( const TimeStepType stepSize )
 {
     // Define and allocated vector for the number of stages.
+    isDenseOutputStepValid_ = false;
+    denseOutputStateDerivatives_.clear( );
     currentStateDerivatives_.clear( );
     currentStateDerivatives_.reserve( this->coefficients_.cCoefficients.rows( ) );
 
@@ -545,6 +590,8 @@ RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateD
         this->lastIndependentVariable_ = this->currentIndependentVariable_;
         this->lastState_ = this->currentState_;
         this->currentIndependentVariable_ += stepSize;
+        lastAcceptedStepSize_ = stepSize;
+        isDenseOutputStepValid_ = true;
 
         switch ( this->coefficients_.orderEstimateToIntegrate )
         {
@@ -567,6 +614,72 @@ RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateD
     }
 }
 
+//! Function to compute the state at an independent variable value within the last step (dense output).
+template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
+StateType
+RungeKuttaVariableStepSizeIntegrator< IndependentVariableType, StateType, StateDerivativeType, TimeStepType >
+::getDenseOutputState( const IndependentVariableType independentVariable )
+{
+    if( !coefficients_.hasDenseOutput( ) )
+    {
+        throw std::runtime_error( "Error in Runge-Kutta integrator, dense output requested, but not available for "
+                                  "current coefficient set." );
+    }
+    else if( !isDenseOutputStepValid_ )
+    {
+        throw std::runtime_error( "Error in Runge-Kutta integrator, dense output requested, but no valid step is "
+                                  "available." );
+    }
+
+    // Compute fraction of step at which state is requested.
+    const TimeStepType stepFraction =
+            static_cast< TimeStepType >( independentVariable - this->lastIndependentVariable_ ) /
+            lastAcceptedStepSize_;
+    if( stepFraction < -1.0E-12 || stepFraction > 1.0 + 1.0E-12 )
+    {
+        throw std::runtime_error( "Error in Runge-Kutta integrator, dense output requested outside of last step." );
+    }
+
+    // Compute additional stages, if not yet done for this step.
+    const int numberOfRegularStages = static_cast< int >( currentStateDerivatives_.size( ) );
+    if( denseOutputStateDerivatives_.size( ) == 0 )
+    {
+        denseOutputStateDerivatives_.reserve( this->coefficients_.denseOutputCCoefficients.rows( ) );
+        for( int stage = 0; stage < this->coefficients_.denseOutputCCoefficients.rows( ); stage++ )
+        {
+            StateType intermediateState( this->lastState_ );
+            for ( int column = 0; column < numberOfRegularStages + stage; column++ )
+            {
+                intermediateState += lastAcceptedStepSize_ * this->coefficients_.denseOutputACoefficients( stage, column ) *
+                        ( ( column < numberOfRegularStages ) ? currentStateDerivatives_[ column ] :
+                                                               denseOutputStateDerivatives_[ column - numberOfRegularStages ] );
+            }
+
+            const IndependentVariableType time = this->lastIndependentVariable_ +
+                    this->coefficients_.denseOutputCCoefficients( stage ) * lastAcceptedStepSize_;
+            denseOutputStateDerivatives_.push_back( this->stateDerivativeFunction_( time, intermediateState ) );
+        }
+    }
+
+    // Evaluate weights of continuous extension, and compute state.
+    Eigen::VectorXd stepFractionPowers( this->coefficients_.denseOutputBCoefficients.cols( ) );
+    stepFractionPowers( 0 ) = static_cast< double >( stepFraction );
+    for( int power = 1; power < stepFractionPowers.rows( ); power++ )
+    {
+        stepFractionPowers( power ) = stepFractionPowers( power - 1 ) * static_cast< double >( stepFraction );
+    }
+    const Eigen::VectorXd stageWeights = this->coefficients_.denseOutputBCoefficients * stepFractionPowers;
+
+    StateType interpolatedState( this->lastState_ );
+    for( int stage = 0; stage < stageWeights.rows( ); stage++ )
+    {
+        interpolatedState += lastAcceptedStepSize_ * stageWeights( stage ) *
+                ( ( stage < numberOfRegularStages ) ? currentStateDerivatives_[ stage ] :
+                                                      denseOutputStateDerivatives_[ stage - numberOfRegularStages ] );
+    }
+    return interpolatedState;
+}
+
 //! Compute the next step size and validate the result.
 template< typename IndependentVariableType, typename StateType, typename StateDerivativeType, typename TimeStepType >
 bool
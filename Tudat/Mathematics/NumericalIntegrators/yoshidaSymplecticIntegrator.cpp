@@ -0,0 +1,73 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Yoshida, H., Construction of higher order symplectic integrators, Physics Letters A, 150(5-7), 1990.
+ *
+ */
+
+#include <cmath>
+#include <vector>
+
+#include "Tudat/Mathematics/NumericalIntegrators/yoshidaSymplecticIntegrator.h"
+
+namespace tudat
+{
+namespace numerical_integrators
+{
+
+//! Function to retrieve the step size fractions of the leapfrog steps of which a Yoshida integrator is composed.
+Eigen::VectorXd getYoshidaCompositionCoefficients( const unsigned int order )
+{
+    // Outer step size fractions w_m, ..., w_1 of the symmetric composition; w_0 follows from the sum being one.
+    std::vector< double > outerCoefficients;
+    switch( order )
+    {
+    case 2:
+        break;
+    case 4:
+    {
+        const double cubeRootOfTwo = std::cbrt( 2.0 );
+        outerCoefficients = { 1.0 / ( 2.0 - cubeRootOfTwo ) };
+        break;
+    }
+    case 6:
+        // Solution A of Yoshida (1990).
+        outerCoefficients = { 0.784513610477560E0, 0.235573213359357E0, -0.117767998417887E1 };
+        break;
+    case 8:
+        // Solution D of Yoshida (1990).
+        outerCoefficients = { 0.914844246229740E0, 0.253693336566229E0, -0.144485223686048E1, -0.158240635368243E0,
+                              0.193813913762276E1, -0.196061023297549E1, 0.102799849391985E0 };
+        break;
+    default:
+        throw std::runtime_error( "Error in Yoshida symplectic integrator, order " + std::to_string( order ) +
+                                  " is not supported, order must be 2, 4, 6 or 8." );
+    }
+
+    const int numberOfOuterCoefficients = static_cast< int >( outerCoefficients.size( ) );
+    Eigen::VectorXd compositionCoefficients = Eigen::VectorXd::Zero( 2 * numberOfOuterCoefficients + 1 );
+    double centralCoefficient = 1.0;
+    for( int i = 0; i < numberOfOuterCoefficients; i++ )
+    {
+        compositionCoefficients( i ) = outerCoefficients[ i ];
+        compositionCoefficients( 2 * numberOfOuterCoefficients - i ) = outerCoefficients[ i ];
+        centralCoefficient -= 2.0 * outerCoefficients[ i ];
+    }
+    compositionCoefficients( numberOfOuterCoefficients ) = centralCoefficient;
+
+    return compositionCoefficients;
+}
+
+template class YoshidaSymplecticIntegrator < double, Eigen::VectorXd, Eigen::VectorXd >;
+template class YoshidaSymplecticIntegrator < double, Eigen::Vector6d, Eigen::Vector6d >;
+template class YoshidaSymplecticIntegrator < double, Eigen::MatrixXd, Eigen::MatrixXd >;
+
+} // namespace numerical_integrators
+} // namespace tudat
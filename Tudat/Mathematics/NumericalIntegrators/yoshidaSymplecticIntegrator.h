@@ -0,0 +1,392 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ *
+ *    References
+ *      Yoshida, H., Construction of higher order symplectic integrators, Physics Letters A, 150(5-7), 1990.
+ *      Hairer, E., Lubich, C., Wanner, G. Geometric Numerical Integration, 2nd Edition, Springer, 2006.
+ *
+ */
+
+#ifndef TUDAT_YOSHIDA_SYMPLECTIC_INTEGRATOR_H
+#define TUDAT_YOSHIDA_SYMPLECTIC_INTEGRATOR_H
+
+#include <stdexcept>
+#include <string>
+
+#include <Eigen/Core>
+
+#include "Tudat/Basics/basicTypedefs.h"
+#include "Tudat/Mathematics/NumericalIntegrators/reinitializableNumericalIntegrator.h"
+
+namespace tudat
+{
+namespace numerical_integrators
+{
+
+//! Function to retrieve the step size fractions of the leapfrog steps of which a Yoshida integrator is composed.
+/*!
+ * Function to retrieve the step size fractions w_k of the leapfrog (Stormer-Verlet) steps of which a symmetric Yoshida
+ * integrator of given order is composed (Yoshida, 1990; solutions A and D of Table 1 for orders 6 and 8).
+ * \param order Order of the integrator (2, 4, 6 or 8).
+ * \return Step size fractions of the leapfrog steps (sum equal to one).
+ */
+Eigen::VectorXd getYoshidaCompositionCoefficients( const unsigned int order );
+
+//! Fixed step size symplectic integrator, composed of leapfrog steps (Yoshida, 1990), for second-order equations of
+//! motion.
+/*!
+ * Fixed step size symplectic integrator, composed of leapfrog (Stormer-Verlet, drift-kick-drift) steps with step size
+ * fractions chosen such that the composition is of order 2, 4, 6 or 8 (Yoshida, 1990). The number of state derivative
+ * evaluations per step is 1, 3, 7 or 15, respectively. For conservative (position-dependent) accelerations, such as
+ * the mutual point-mass gravity of a set of bodies, the integrator is symplectic, so that the energy error remains
+ * bounded and does not drift over long integration arcs. Accelerations that depend on the velocity (e.g. aerodynamic
+ * drag) are evaluated with the velocity at the start of each kick, for which the integrator is neither symplectic nor
+ * of the nominal order.
+ *
+ * The state must consist of one or more blocks of six rows, each of which contains the Cartesian position (first three
+ * rows) and velocity (last three rows) of a body (as in a Cowell propagation of the translational state), so that the
+ * state derivative of the position rows is equal to the velocity rows. For a matrix state (e.g. the state transition
+ * matrix), this structure must hold for each column. This structure is verified at the first step.
+ * \tparam IndependentVariableType The type of the independent variable.
+ * \tparam StateType The type of the state (an Eigen matrix type).
+ * \tparam StateDerivativeType The type of the state derivative.
+ * \tparam TimeStepType The type of the time step.
+ * \sa NumericalIntegrator.
+ */
+template< typename IndependentVariableType = double, typename StateType = Eigen::VectorXd,
+          typename StateDerivativeType = Eigen::VectorXd, typename TimeStepType = IndependentVariableType >
+class YoshidaSymplecticIntegrator
+        : public ReinitializableNumericalIntegrator<
+        IndependentVariableType, StateType, StateDerivativeType, TimeStepType >
+{
+public:
+
+    //! Typedef for the base class.
+    /*!
+     * Typedef of the base class with all template parameters filled in.
+     */
+    typedef ReinitializableNumericalIntegrator< IndependentVariableType, StateType,
+    StateDerivativeType, TimeStepType > ReinitializableNumericalIntegratorBase;
+
+    //! Typedef for the state derivative function.
+    /*!
+     * Typedef to the state derivative function inherited from the base class.
+     * \sa NumericalIntegrator::StateDerivativeFunction.
+     */
+    typedef typename ReinitializableNumericalIntegratorBase::NumericalIntegratorBase::
+    StateDerivativeFunction StateDerivativeFunction;
+
+    //! Typedef for the scalar type of the state.
+    typedef typename StateType::Scalar StateScalarType;
+
+    //! Constructor.
+    /*!
+     * Constructor.
+     * \param stateDerivativeFunction State derivative function.
+     * \param intervalStart The start of the integration interval.
+     * \param initialState The initial state, consisting of blocks of Cartesian position and velocity (see class
+     *      description).
+     * \param stepSize Step size that is to be used (negative for backwards integration).
+     * \param order Order of the integrator (2, 4, 6 or 8; default 6).
+     */
+    YoshidaSymplecticIntegrator(
+            const StateDerivativeFunction& stateDerivativeFunction,
+            const IndependentVariableType intervalStart,
+            const StateType& initialState,
+            const TimeStepType stepSize,
+            const unsigned int order = 6 )
+        : ReinitializableNumericalIntegratorBase( stateDerivativeFunction ),
+          currentIndependentVariable_( intervalStart ),
+          currentState_( initialState ),
+          lastIndependentVariable_( intervalStart ),
+          lastState_( initialState ),
+          stepSize_( stepSize ),
+          order_( order ),
+          numberOfBodies_( initialState.rows( ) / 6 ),
+          numberOfColumns_( initialState.cols( ) ),
+          isStructureVerified_( false )
+    {
+        if( initialState.rows( ) == 0 || initialState.rows( ) % 6 != 0 )
+        {
+            throw std::runtime_error(
+                        "Error in Yoshida symplectic integrator, state must consist of blocks of Cartesian position and "
+                        "velocity, but has " + std::to_string( initialState.rows( ) ) + " rows." );
+        }
+        if( !( static_cast< double >( stepSize ) != 0.0 ) )
+        {
+            throw std::runtime_error( "Error in Yoshida symplectic integrator, step size must be non-zero." );
+        }
+
+        // Compute drift coefficients c_k (merging the half drifts of subsequent leapfrog steps) and kick coefficients
+        // d_k = w_k, so that a step consists of drift( c_0 ), kick( d_0 ), ..., kick( d_{n-1} ), drift( c_n ).
+        const Eigen::VectorXd compositionCoefficients = getYoshidaCompositionCoefficients( order );
+        const int numberOfStages = static_cast< int >( compositionCoefficients.rows( ) );
+        kickCoefficients_ = compositionCoefficients;
+        driftCoefficients_ = Eigen::VectorXd::Zero( numberOfStages + 1 );
+        for( int i = 0; i < numberOfStages; i++ )
+        {
+            driftCoefficients_( i ) += 0.5 * compositionCoefficients( i );
+            driftCoefficients_( i + 1 ) += 0.5 * compositionCoefficients( i );
+        }
+    }
+
+    //! Default destructor.
+    ~YoshidaSymplecticIntegrator( ){ }
+
+    //! Get step size of the next step.
+    /*!
+     * Returns the step size of the next step, which is equal to the step size of the last step (fixed step size).
+     * \return Step size to be used for the next step.
+     */
+    virtual TimeStepType getNextStepSize( ) const { return stepSize_; }
+
+    //! Get current state.
+    /*!
+     * Returns the current state of the integrator.
+     * \return Current integrated state.
+     */
+    virtual StateType getCurrentState( ) const { return currentState_; }
+
+    //! Returns the current independent variable.
+    /*!
+     * Returns the current value of the independent variable of the integrator.
+     * \return Current independent variable.
+     */
+    virtual IndependentVariableType getCurrentIndependentVariable( ) const
+    {
+        return currentIndependentVariable_;
+    }
+
+    //! Get previous independent variable.
+    /*!
+     * Returns the previous value of the independent variable of the integrator.
+     * \return Previous independent variable.
+     */
+    virtual IndependentVariableType getPreviousIndependentVariable( )
+    {
+        return lastIndependentVariable_;
+    }
+
+    //! Get previous state value.
+    /*!
+     * Returns the previous value of the state.
+     * \return Previous state
+     */
+    virtual StateType getPreviousState( )
+    {
+        return lastState_;
+    }
+
+    //! Perform a single integration step.
+    /*!
+     * Perform a single integration step, consisting of a sequence of drifts (update of position with velocity) and
+     * kicks (update of velocity with acceleration).
+     * \param stepSize The step size to take.
+     * \return The state at the end of the interval.
+     */
+    virtual StateType performIntegrationStep( const TimeStepType stepSize )
+    {
+        // Store variables for rollback.
+        lastIndependentVariable_ = currentIndependentVariable_;
+        lastState_ = currentState_;
+        stepSize_ = stepSize;
+
+        const StateScalarType scalarStepSize = static_cast< StateScalarType >( stepSize );
+        TimeStepType stageTimeOffset = static_cast< TimeStepType >( 0.0 );
+        for( int k = 0; k < kickCoefficients_.rows( ); k++ )
+        {
+            performDrift( static_cast< StateScalarType >( driftCoefficients_( k ) ) * scalarStepSize );
+            stageTimeOffset += static_cast< TimeStepType >( driftCoefficients_( k ) ) * stepSize;
+            performKick( currentIndependentVariable_ + stageTimeOffset,
+                         static_cast< StateScalarType >( kickCoefficients_( k ) ) * scalarStepSize );
+        }
+        performDrift( static_cast< StateScalarType >( driftCoefficients_( kickCoefficients_.rows( ) ) ) *
+                      scalarStepSize );
+
+        currentIndependentVariable_ = currentIndependentVariable_ + stepSize;
+        return currentState_;
+    }
+
+    //! Rollback internal state to the last state.
+    /*!
+     * Performs rollback of internal state to the last state. This function can only be called once after calling
+     * integrateTo( ) or performIntegrationStep( ).
+     * \return True if the rollback was successful.
+     */
+    virtual bool rollbackToPreviousState( )
+    {
+        if( currentIndependentVariable_ == lastIndependentVariable_ )
+        {
+            return false;
+        }
+
+        currentIndependentVariable_ = lastIndependentVariable_;
+        currentState_ = lastState_;
+        return true;
+    }
+
+    //! Replace the state with a new value.
+    /*!
+     * Replace the state with a new value.
+     * \param newState The value of the new state.
+     * \param allowRollback Boolean denoting whether roll-back should be allowed.
+     */
+    void modifyCurrentState( const StateType& newState, const bool allowRollback = false )
+    {
+        currentState_ = newState;
+        if ( !allowRollback )
+        {
+            lastIndependentVariable_ = currentIndependentVariable_;
+        }
+    }
+
+    //! Modify the state and time for the current step.
+    /*!
+     * Modify the state and time for the current step.
+     * \param newState The new state to set the current state to.
+     * \param newTime The time to set the current time to.
+     * \param allowRollback Boolean denoting whether roll-back should be allowed.
+     */
+    void modifyCurrentIntegrationVariables( const StateType& newState, const IndependentVariableType newTime,
+                                            const bool allowRollback = false )
+    {
+        currentState_ = newState;
+        currentIndependentVariable_ = newTime;
+        if ( !allowRollback )
+        {
+            lastIndependentVariable_ = currentIndependentVariable_;
+        }
+    }
+
+    //! Function to retrieve the order of the integrator.
+    /*!
+     * Function to retrieve the order of the integrator.
+     * \return Order of the integrator.
+     */
+    unsigned int getOrder( ) const { return order_; }
+
+    //! Function to retrieve the number of state derivative evaluations per step.
+    /*!
+     * Function to retrieve the number of state derivative evaluations per step.
+     * \return Number of state derivative evaluations per step.
+     */
+    int getNumberOfStages( ) const { return static_cast< int >( kickCoefficients_.rows( ) ); }
+
+protected:
+
+    //! Function to update the positions with the current velocities.
+    /*!
+     * Function to update the positions with the current velocities.
+     * \param stepSize Step size of the drift.
+     */
+    void performDrift( const StateScalarType stepSize )
+    {
+        for( int i = 0; i < numberOfBodies_; i++ )
+        {
+            currentState_.block( 6 * i, 0, 3, numberOfColumns_ ) +=
+                    stepSize * currentState_.block( 6 * i + 3, 0, 3, numberOfColumns_ );
+        }
+    }
+
+    //! Function to update the velocities with the accelerations at the current state.
+    /*!
+     * Function to update the velocities with the accelerations at the current state.
+     * \param independentVariable Independent variable at which to evaluate the state derivative.
+     * \param stepSize Step size of the kick.
+     */
+    void performKick( const IndependentVariableType independentVariable, const StateScalarType stepSize )
+    {
+        const StateDerivativeType stateDerivative =
+                this->stateDerivativeFunction_( independentVariable, currentState_ );
+        if( !isStructureVerified_ )
+        {
+            verifyStateStructure( stateDerivative );
+        }
+
+        for( int i = 0; i < numberOfBodies_; i++ )
+        {
+            currentState_.block( 6 * i + 3, 0, 3, numberOfColumns_ ) +=
+                    stepSize * stateDerivative.block( 6 * i + 3, 0, 3, numberOfColumns_ );
+        }
+    }
+
+    //! Function to verify that the state derivative of the position rows is equal to the velocity rows.
+    /*!
+     * Function to verify that the state derivative of the position rows is equal to the velocity rows, throws an
+     * exception if this is not the case.
+     * \param stateDerivative State derivative at the current state.
+     */
+    void verifyStateStructure( const StateDerivativeType& stateDerivative )
+    {
+        for( int i = 0; i < numberOfBodies_; i++ )
+        {
+            const StateScalarType velocityDifference =
+                    ( stateDerivative.block( 6 * i, 0, 3, numberOfColumns_ ) -
+                      currentState_.block( 6 * i + 3, 0, 3, numberOfColumns_ ) ).cwiseAbs( ).maxCoeff( );
+            const StateScalarType velocityMagnitude =
+                    currentState_.block( 6 * i + 3, 0, 3, numberOfColumns_ ).cwiseAbs( ).maxCoeff( );
+            if( !( velocityDifference <= 1.0E-12 * velocityMagnitude ) )
+            {
+                throw std::runtime_error(
+                            "Error in Yoshida symplectic integrator, derivative of position is not equal to velocity. "
+                            "The integrator can only be used for (Cowell) Cartesian position and velocity states." );
+            }
+        }
+        isStructureVerified_ = true;
+    }
+
+    //! Current independent variable.
+    IndependentVariableType currentIndependentVariable_;
+
+    //! Current state.
+    StateType currentState_;
+
+    //! Independent variable at start of last step.
+    IndependentVariableType lastIndependentVariable_;
+
+    //! State at start of last step.
+    StateType lastState_;
+
+    //! Step size of (next) step.
+    TimeStepType stepSize_;
+
+    //! Order of the integrator.
+    unsigned int order_;
+
+    //! Step size fractions of the drifts.
+    Eigen::VectorXd driftCoefficients_;
+
+    //! Step size fractions of the kicks.
+    Eigen::VectorXd kickCoefficients_;
+
+    //! Number of blocks of Cartesian position and velocity in the state.
+    int numberOfBodies_;
+
+    //! Number of columns of the state.
+    int numberOfColumns_;
+
+    //! Boolean denoting whether the structure of the state has been verified.
+    bool isStructureVerified_;
+};
+
+extern template class YoshidaSymplecticIntegrator < double, Eigen::VectorXd, Eigen::VectorXd >;
+extern template class YoshidaSymplecticIntegrator < double, Eigen::Vector6d, Eigen::Vector6d >;
+extern template class YoshidaSymplecticIntegrator < double, Eigen::MatrixXd, Eigen::MatrixXd >;
+
+//! Typedef of Yoshida symplectic integrator (state/state derivative = VectorXd, independent variable = double).
+typedef YoshidaSymplecticIntegrator< > YoshidaSymplecticIntegratorXd;
+
+//! Typedef of pointer to default Yoshida symplectic integrator.
+typedef std::shared_ptr< YoshidaSymplecticIntegratorXd > YoshidaSymplecticIntegratorXdPointer;
+
+} // namespace numerical_integrators
+
+} // namespace tudat
+
+#endif // TUDAT_YOSHIDA_SYMPLECTIC_INTEGRATOR_H
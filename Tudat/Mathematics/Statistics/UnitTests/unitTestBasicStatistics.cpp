@@ -84,6 +84,54 @@ BOOST_AUTO_TEST_CASE( testSampleVariance )
                                 std::numeric_limits< double >::epsilon( ) );
 }
 
+//! Test if sample covariance and percentiles of vector data are computed correctly.
+BOOST_AUTO_TEST_CASE( testSampleCovarianceAndPercentile )
+{
+    // Create vector samples from data of testSampleVariance (in shuffled order), with second entry linearly dependent on first.
+    std::vector< double > scalarData = { 8.9, 15.0, 2.5, 12.7, 6.4 };
+    std::vector< Eigen::VectorXd > sampleData;
+    for( unsigned int i = 0; i < scalarData.size( ); i++ )
+    {
+        sampleData.push_back( ( Eigen::VectorXd( 2 ) << scalarData.at( i ), 2.0 * scalarData.at( i ) + 1.0 ).finished( ) );
+    }
+
+    // Check covariance against scalar variance (Microsoft Excel VAR( ) function)
+    double expectedSampleVariance = 24.665;
+    Eigen::MatrixXd computedSampleCovariance = statistics::computeSampleCovariance( sampleData );
+    BOOST_CHECK_CLOSE_FRACTION( computedSampleCovariance( 0, 0 ), expectedSampleVariance,
+                                10.0 * std::numeric_limits< double >::epsilon( ) );
+    BOOST_CHECK_CLOSE_FRACTION( computedSampleCovariance( 1, 0 ), 2.0 * expectedSampleVariance,
+                                10.0 * std::numeric_limits< double >::epsilon( ) );
+    BOOST_CHECK_CLOSE_FRACTION( computedSampleCovariance( 0, 1 ), 2.0 * expectedSampleVariance,
+                                10.0 * std::numeric_limits< double >::epsilon( ) );
+    BOOST_CHECK_CLOSE_FRACTION( computedSampleCovariance( 1, 1 ), 4.0 * expectedSampleVariance,
+                                10.0 * std::numeric_limits< double >::epsilon( ) );
+
+    // Check diagonal against vector variance
+    Eigen::VectorXd computedSampleVariance = statistics::computeSampleVariance( sampleData );
+    for( int i = 0; i < 2; i++ )
+    {
+        BOOST_CHECK_CLOSE_FRACTION( computedSampleCovariance( i, i ), computedSampleVariance( i ),
+                                    10.0 * std::numeric_limits< double >::epsilon( ) );
+    }
+
+    // Check percentiles (exact ranks and interpolated)
+    Eigen::VectorXd computedMedian = statistics::computeSamplePercentile( sampleData, 50.0 );
+    BOOST_CHECK_CLOSE_FRACTION( computedMedian( 0 ), statistics::computeSampleMedian( scalarData ),
+                                std::numeric_limits< double >::epsilon( ) );
+    BOOST_CHECK_CLOSE_FRACTION( computedMedian( 1 ), 18.8, std::numeric_limits< double >::epsilon( ) );
+
+    Eigen::VectorXd computedPercentile = statistics::computeSamplePercentile( sampleData, 0.0 );
+    BOOST_CHECK_CLOSE_FRACTION( computedPercentile( 0 ), 2.5, std::numeric_limits< double >::epsilon( ) );
+    computedPercentile = statistics::computeSamplePercentile( sampleData, 100.0 );
+    BOOST_CHECK_CLOSE_FRACTION( computedPercentile( 0 ), 15.0, std::numeric_limits< double >::epsilon( ) );
+    computedPercentile = statistics::computeSamplePercentile( sampleData, 90.0 );
+    BOOST_CHECK_CLOSE_FRACTION( computedPercentile( 0 ), 14.08, 10.0 * std::numeric_limits< double >::epsilon( ) );
+    BOOST_CHECK_CLOSE_FRACTION( computedPercentile( 1 ), 29.16, 10.0 * std::numeric_limits< double >::epsilon( ) );
+
+    BOOST_CHECK_THROW( statistics::computeSamplePercentile( sampleData, 101.0 ), std::runtime_error );
+}
+
 //! Test if moving average is computed correctly. Results compared with MATLAB movmean function.
 BOOST_AUTO_TEST_CASE( testMovingAverage )
 {
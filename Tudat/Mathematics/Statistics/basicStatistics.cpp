@@ -9,8 +9,11 @@
  *
  */
 
+#include <algorithm>
 #include <cmath>
 #include <numeric>
+#include <stdexcept>
+#include <string>
 
 #include "Tudat/Mathematics/Statistics/basicStatistics.h"
 #include "Tudat/Mathematics/BasicMathematics/basicMathematicsFunctions.h"
@@ -134,6 +137,62 @@ Eigen::VectorXd computeSampleVariance( const std::vector< Eigen::VectorXd >& sam
     return 1.0 / ( static_cast< double >( sampleData.size( ) ) - 1.0 ) * sumOfResidualsSquared;
 }
 
+//! Compute sample covariance for a sample of VectorXd.
+Eigen::MatrixXd computeSampleCovariance( const std::vector< Eigen::VectorXd >& sampleData )
+{
+    // Declare and compute sample mean.
+    Eigen::VectorXd sampleMean = computeSampleMean( sampleData );
+
+    // Compute sum of outer products of residuals of sample data.
+    Eigen::MatrixXd sumOfResidualProducts = Eigen::MatrixXd::Zero( sampleMean.rows( ), sampleMean.rows( ) );
+    for ( unsigned int i = 0; i < sampleData.size( ); i++ )
+    {
+        sumOfResidualProducts.selfadjointView< Eigen::Lower >( ).rankUpdate( sampleData.at( i ) - sampleMean );
+    }
+    sumOfResidualProducts.triangularView< Eigen::StrictlyUpper >( ) =
+            sumOfResidualProducts.transpose( ).triangularView< Eigen::StrictlyUpper >( );
+
+    // Return sample covariance.
+    return 1.0 / ( static_cast< double >( sampleData.size( ) ) - 1.0 ) * sumOfResidualProducts;
+}
+
+//! Compute sample percentile for a sample of VectorXd.
+Eigen::VectorXd computeSamplePercentile( const std::vector< Eigen::VectorXd >& sampleData, const double percentile )
+{
+    if( sampleData.size( ) == 0 )
+    {
+        throw std::runtime_error( "Error when computing sample percentile, no data provided." );
+    }
+    else if( percentile < 0.0 || percentile > 100.0 )
+    {
+        throw std::runtime_error( "Error when computing sample percentile, percentile " +
+                                  std::to_string( percentile ) + " is not in range [0, 100]." );
+    }
+
+    // Determine (fractional) index of percentile in sorted data
+    double fractionalIndex = percentile / 100.0 * static_cast< double >( sampleData.size( ) - 1 );
+    unsigned int lowerIndex = static_cast< unsigned int >( std::floor( fractionalIndex ) );
+    unsigned int upperIndex = std::min( lowerIndex + 1, static_cast< unsigned int >( sampleData.size( ) - 1 ) );
+    double interpolationFraction = fractionalIndex - static_cast< double >( lowerIndex );
+
+    // Compute percentile for each entry
+    Eigen::VectorXd samplePercentile = Eigen::VectorXd::Zero( sampleData.at( 0 ).rows( ) );
+    std::vector< double > sortedEntries( sampleData.size( ) );
+    for( int i = 0; i < samplePercentile.rows( ); i++ )
+    {
+        for( unsigned int j = 0; j < sampleData.size( ); j++ )
+        {
+            sortedEntries[ j ] = sampleData.at( j )( i );
+        }
+        std::sort( sortedEntries.begin( ), sortedEntries.end( ) );
+
+        samplePercentile( i ) = sortedEntries.at( lowerIndex ) +
+                interpolationFraction * ( sortedEntries.at( upperIndex ) - sortedEntries.at( lowerIndex ) );
+    }
+
+    return samplePercentile;
+}
+
 //! Compute moving average of an Eigen vector.
 Eigen::VectorXd computeMovingAverage( const Eigen::VectorXd& sampleData, const unsigned int numberOfAveragingPoints )
 {
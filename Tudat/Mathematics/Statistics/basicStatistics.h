@@ -109,6 +109,32 @@ double computeSampleMedian( std::vector< double > sampleData );
  */
 Eigen::VectorXd computeSampleVariance( const std::vector< Eigen::VectorXd >& sampleData );
 
+//! Compute sample covariance for a sample of VectorXd.
+/*!
+ * Computes sample covariance matrix for a sample of VectorXd based on the following unbiased estimator:
+ * \f[
+ *      C_{s} = \frac{ 1 }{ N - 1 } * \sum_{i=1}^{N} ( X_{i} - \bar{ X } )( X_{i} - \bar{ X } )^{T}
+ * \f]
+ * where \f$ C_{s} \f$ is the unbiased estimate of the sample covariance,
+ * \f$ N \f$ is the number of samples, \f$ X \f$ is the sample value, and
+ * \f$ \bar{ X } \f$ is the sample mean. The diagonal of the result is equal to the output of computeSampleVariance.
+ * \param sampleData Vector containing sample data.
+ * \return Sample covariance.
+ */
+Eigen::MatrixXd computeSampleCovariance( const std::vector< Eigen::VectorXd >& sampleData );
+
+//! Compute sample percentile for a sample of VectorXd.
+/*!
+ * Computes the given percentile of a sample of VectorXd, separately for each entry of the vector. The percentile is
+ * computed by linear interpolation between the two closest ranks of the sorted data, such that the percentile p
+ * corresponds to (fractional) index p / 100 * ( N - 1 ) in the sorted sample of size N (so that the 50th percentile is
+ * the median, see computeSampleMedian).
+ * \param sampleData Vector containing sample data.
+ * \param percentile Percentile that is to be computed (in range [0, 100])
+ * \return Sample percentile of each vector entry.
+ */
+Eigen::VectorXd computeSamplePercentile( const std::vector< Eigen::VectorXd >& sampleData, const double percentile );
+
 //! Compute moving average of vector.
 /*!
  *  Compute moving average of vector, where the moving average is computed by sliding a window of
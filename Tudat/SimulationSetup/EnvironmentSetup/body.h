@@ -408,6 +408,57 @@ public:
         }
     }
 
+    //! Templated function to compute the state of the body from its ephemeris and global-to-ephemeris-frame function,
+    //! without modifying the current state of the body.
+    /*!
+     * Templated function to compute the state of the body from its ephemeris and global-to-ephemeris-frame function.
+     * As opposed to getStateInBaseFrameFromEphemeris, the currentState_/currentLongState_ variables are neither used
+     * nor modified, so that this function may be called concurrently (e.g. when computing observations in multiple
+     * threads), provided that the ephemeris models themselves support concurrent evaluation.
+     * \param time Time at which to evaluate states.
+     * \return State at requested time
+     */
+    template< typename StateScalarType = double, typename TimeType = double >
+    Eigen::Matrix< StateScalarType, 6, 1 > computeStateInBaseFrameFromEphemeris( const TimeType time ) const
+    {
+        // If body is not global frame origin, compute state.
+        if( bodyIsGlobalFrameOrigin_ == 0 )
+        {
+            return bodyEphemeris_->getTemplatedStateFromEphemeris< StateScalarType, TimeType >( time ) +
+                    ephemerisFrameToBaseFrame_->getBaseFrameState< TimeType, StateScalarType >( time );
+        }
+        // If body is global frame origin, state is zero by definition.
+        else if( bodyIsGlobalFrameOrigin_ == 1 )
+        {
+            return Eigen::Matrix< StateScalarType, 6, 1 >::Zero( );
+        }
+        else
+        {
+            throw std::runtime_error( "Error when computing body state, global origin not yet defined." );
+        }
+    }
+
+    //! Templated function to compute the barycentric state of the body from its ephemeris and
+    //! global-to-ephemeris-frame function, without modifying the current state of the body.
+    /*!
+     * Templated function to compute the barycentric state of the body from its global-to-ephemeris-frame function. As
+     * opposed to getGlobalFrameOriginBarycentricStateFromEphemeris, the currentBarycentricState_ /
+     * currentBarycentricLongState_ variables are neither used nor modified. This function can ONLY be called if this body
+     * is the global frame origin, otherwise an exception is thrown
+     * \param time Time at which to evaluate states.
+     * \return Barycentric State at requested time
+     */
+    template< typename StateScalarType = double, typename TimeType = double >
+    Eigen::Matrix< StateScalarType, 6, 1 > computeGlobalFrameOriginBarycentricStateFromEphemeris( const TimeType time ) const
+    {
+        if( bodyIsGlobalFrameOrigin_ != 1 )
+        {
+            throw std::runtime_error( "Error, calling global frame origin barycentric state on body that is not global frame origin" );
+        }
+
+        return ephemerisFrameToBaseFrame_->getBaseFrameState< TimeType, StateScalarType >( time );
+    }
+
     //! Get current state.
     /*!
      * Returns the internally stored current state vector.
@@ -197,7 +197,7 @@ void setGlobalFrameBodyEphemerides( const NamedBodyMap& bodyMap,
                     else
                     {
                         std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > stateFunction =
-                                std::bind( &Body::getStateInBaseFrameFromEphemeris< StateScalarType, TimeType >,
+                                std::bind( &Body::computeStateInBaseFrameFromEphemeris< StateScalarType, TimeType >,
                                              bodyMap.at( ephemerisFrameOrigin ), std::placeholders::_1 );
                         std::shared_ptr< BaseStateInterface > baseStateInterface =
                                 std::make_shared< BaseStateInterfaceImplementation< TimeType, StateScalarType > >(
@@ -230,7 +230,7 @@ void setGlobalFrameBodyEphemerides( const NamedBodyMap& bodyMap,
                     {
 
                         std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > stateFunction =
-                               std::bind( &Body::getGlobalFrameOriginBarycentricStateFromEphemeris< StateScalarType, TimeType >,
+                               std::bind( &Body::computeGlobalFrameOriginBarycentricStateFromEphemeris< StateScalarType, TimeType >,
                                              bodyMap.at( globalFrameOrigin ), std::placeholders::_1 );
                         std::shared_ptr< BaseStateInterface > baseStateInterface =
                                 std::make_shared< BaseStateInterfaceImplementation< TimeType, StateScalarType > >(
@@ -251,7 +251,7 @@ void setGlobalFrameBodyEphemerides( const NamedBodyMap& bodyMap,
                         {
                             // Set correction function from ephemeris origin to global frame origin
                             std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType ) > stateFunction =
-                                    std::bind( &Body::getStateInBaseFrameFromEphemeris< StateScalarType, TimeType >,
+                                    std::bind( &Body::computeStateInBaseFrameFromEphemeris< StateScalarType, TimeType >,
                                                  bodyMap.at( ephemerisFrameOrigin ), std::placeholders::_1 );
                             std::shared_ptr< BaseStateInterface > baseStateInterface =
                                     std::make_shared< BaseStateInterfaceImplementation< TimeType, StateScalarType > >(
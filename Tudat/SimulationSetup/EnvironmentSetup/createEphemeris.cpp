@@ -8,6 +8,9 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include <cmath>
+
+#include <boost/filesystem.hpp>
 #include <boost/lambda/lambda.hpp>
 #if USE_CSPICE
 #include "Tudat/External/SpiceInterface/spiceEphemeris.h"
@@ -31,6 +34,23 @@ namespace simulation_setup
 
 using namespace ephemerides;
 
+//! Function to check whether a Chebyshev ephemeris is consistent with the settings for a Chebyshev ephemeris.
+bool isChebyshevEphemerisConsistentWithSettings(
+        const std::shared_ptr< ChebyshevEphemeris > chebyshevEphemeris,
+        const std::shared_ptr< ChebyshevEphemerisSettings > chebyshevEphemerisSettings )
+{
+    // End time is computed from segment length, and is only checked up to rounding errors.
+    const double intervalLength = chebyshevEphemerisSettings->getFinalTime( ) - chebyshevEphemerisSettings->getInitialTime( );
+    return ( chebyshevEphemeris->getStartTime( ) == chebyshevEphemerisSettings->getInitialTime( ) ) &&
+            ( std::fabs( chebyshevEphemeris->getEndTime( ) - chebyshevEphemerisSettings->getFinalTime( ) ) <=
+              1.0E-12 * std::fabs( intervalLength ) ) &&
+            ( chebyshevEphemeris->getPolynomialDegree( ) == chebyshevEphemerisSettings->getPolynomialDegree( ) ) &&
+            ( chebyshevEphemeris->getReferenceFrameOrigin( ) == chebyshevEphemerisSettings->getFrameOrigin( ) ) &&
+            ( chebyshevEphemeris->getReferenceFrameOrientation( ) == chebyshevEphemerisSettings->getFrameOrientation( ) ) &&
+            ( chebyshevEphemeris->getPositionTolerance( ) <= chebyshevEphemerisSettings->getPositionTolerance( ) ) &&
+            ( chebyshevEphemeris->getVelocityTolerance( ) <= chebyshevEphemerisSettings->getVelocityTolerance( ) );
+}
+
 //! Function to create a ephemeris model.
 std::shared_ptr< ephemerides::Ephemeris > createBodyEphemeris(
         const std::shared_ptr< EphemerisSettings > ephemerisSettings,
@@ -137,6 +157,28 @@ std::shared_ptr< ephemerides::Ephemeris > createBodyEphemeris(
             }
             break;
         }
+        case spice_snapshot_ephemeris:
+        {
+            // Check consistency of type and class.
+            std::shared_ptr< SpiceSnapshotEphemerisSettings > snapshotEphemerisSettings =
+                    std::dynamic_pointer_cast< SpiceSnapshotEphemerisSettings >( ephemerisSettings );
+            if( snapshotEphemerisSettings == nullptr )
+            {
+                throw std::runtime_error( "Error, expected Spice snapshot ephemeris settings for body " + bodyName );
+            }
+            else if( snapshotEphemerisSettings->getSpiceSnapshot( ) == nullptr )
+            {
+                throw std::runtime_error( "Error, no Spice snapshot provided for ephemeris of body " + bodyName );
+            }
+            else
+            {
+                // Retrieve ephemeris stored in snapshot (exception is thrown if not available).
+                ephemeris = snapshotEphemerisSettings->getSpiceSnapshot( )->getBodyStateEphemeris(
+                            bodyName, snapshotEphemerisSettings->getFrameOrigin( ),
+                            snapshotEphemerisSettings->getFrameOrientation( ) );
+            }
+            break;
+        }
 #endif
         case tabulated_ephemeris:
         {
@@ -302,6 +344,58 @@ std::shared_ptr< ephemerides::Ephemeris > createBodyEphemeris(
             }
             break;
         }
+        case chebyshev_ephemeris:
+        {
+            // Check consistency of type and class.
+            std::shared_ptr< ChebyshevEphemerisSettings > chebyshevEphemerisSettings =
+                    std::dynamic_pointer_cast< ChebyshevEphemerisSettings >( ephemerisSettings );
+            if( chebyshevEphemerisSettings == nullptr )
+            {
+                throw std::runtime_error( "Error, expected Chebyshev ephemeris settings for " + bodyName );
+            }
+            else
+            {
+                // Read previously fitted ephemeris, if it is consistent with the current settings.
+                const std::string fileName = chebyshevEphemerisSettings->getFileName( );
+                if( fileName != "" && boost::filesystem::exists( fileName ) )
+                {
+                    std::shared_ptr< ChebyshevEphemeris > chebyshevEphemeris;
+                    try
+                    {
+                        chebyshevEphemeris = readChebyshevEphemerisFromBinaryFile( fileName );
+                    }
+                    catch( const std::runtime_error& )
+                    {
+                        // File is invalid, or written in incompatible format: ephemeris is refitted.
+                    }
+
+                    if( chebyshevEphemeris != nullptr &&
+                            isChebyshevEphemerisConsistentWithSettings( chebyshevEphemeris, chebyshevEphemerisSettings ) )
+                    {
+                        ephemeris = chebyshevEphemeris;
+                    }
+                }
+
+                if( ephemeris == nullptr )
+                {
+                    // Create and fit original ephemeris
+                    std::shared_ptr< ChebyshevEphemeris > chebyshevEphemeris = fitChebyshevEphemeris(
+                                createBodyEphemeris( chebyshevEphemerisSettings->getOriginalEphemerisSettings( ),
+                                                     bodyName ),
+                                chebyshevEphemerisSettings->getInitialTime( ),
+                                chebyshevEphemerisSettings->getFinalTime( ),
+                                chebyshevEphemerisSettings->getPositionTolerance( ),
+                                chebyshevEphemerisSettings->getVelocityTolerance( ),
+                                chebyshevEphemerisSettings->getPolynomialDegree( ) );
+                    if( fileName != "" )
+                    {
+                        writeChebyshevEphemerisToBinaryFile( chebyshevEphemeris, fileName );
+                    }
+                    ephemeris = chebyshevEphemeris;
+                }
+            }
+            break;
+        }
         default:
         {
             throw std::runtime_error(
@@ -326,6 +420,14 @@ std::pair< double, double > getSafeInterpolationInterval( const std::shared_ptr<
     {
         safeInterval = getTabulatedEphemerisSafeInterval( ephemerisModel );
     }
+    // Check if model is Chebyshev ephemeris, and retrieve interval on which it is defined.
+    else if( std::dynamic_pointer_cast< ephemerides::ChebyshevEphemeris >( ephemerisModel ) != nullptr )
+    {
+        std::shared_ptr< ephemerides::ChebyshevEphemeris > chebyshevEphemerisModel =
+                std::dynamic_pointer_cast< ephemerides::ChebyshevEphemeris >( ephemerisModel );
+        safeInterval = std::make_pair( chebyshevEphemerisModel->getStartTime( ),
+                                       chebyshevEphemerisModel->getEndTime( ) );
+    }
     // Check if model is multi-arc, and retrieve safe intervals from first and last arc.
     else if( std::dynamic_pointer_cast< ephemerides::MultiArcEphemeris >( ephemerisModel ) != nullptr )
     {
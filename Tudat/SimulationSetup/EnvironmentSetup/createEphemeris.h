@@ -18,12 +18,14 @@
 
 #include "Tudat/InputOutput/matrixTextFileReader.h"
 #include "Tudat/Astrodynamics/Ephemerides/ephemeris.h"
+#include "Tudat/Astrodynamics/Ephemerides/chebyshevEphemeris.h"
 #include "Tudat/Astrodynamics/Ephemerides/tabulatedEphemeris.h"
 #include "Tudat/Astrodynamics/Ephemerides/approximatePlanetPositionsBase.h"
 #include "Tudat/Mathematics/Interpolators/createInterpolator.h"
 
 #if USE_CSPICE
 #include "Tudat/External/SpiceInterface/spiceInterface.h"
+#include "Tudat/External/SpiceInterface/spiceSnapshot.h"
 #endif
 
 namespace tudat
@@ -45,7 +47,9 @@ enum EphemerisType
     interpolated_spice,
     constant_ephemeris,
     kepler_ephemeris,
-    custom_ephemeris
+    custom_ephemeris,
+    chebyshev_ephemeris,
+    spice_snapshot_ephemeris
 };
 
 //! Class for providing settings for ephemeris model.
@@ -325,6 +329,48 @@ private:
     bool useLongDoubleStates_;
 };
 
+#if USE_CSPICE
+//! EphemerisSettings derived class for defining settings of an ephemeris read from a snapshot of Spice data.
+/*!
+ *  EphemerisSettings derived class for defining settings of an ephemeris read from a snapshot of Spice data (see
+ *  SpiceSnapshot). The created ephemeris is the Chebyshev ephemeris stored in the snapshot for the body, frame origin and
+ *  frame orientation. As opposed to the ephemeris created from DirectSpiceEphemerisSettings, it does not call the Spice
+ *  toolkit, so that it may be evaluated concurrently (e.g. in parallel propagations or estimations) without locking.
+ *  The state of the body must have been added to the snapshot before the ephemeris is created.
+ */
+class SpiceSnapshotEphemerisSettings: public EphemerisSettings
+{
+public:
+
+    //! Constructor.
+    /*!
+     * Constructor, sets the snapshot from which the ephemeris is to be retrieved.
+     * \param spiceSnapshot Snapshot of Spice data from which the ephemeris is to be retrieved.
+     * \param frameOrigin Name of body relative to which the ephemeris is to be calculated
+     *        (optional "SSB" by default).
+     * \param frameOrientation Orientation of the reference frame in which the ephemeris is to be
+     *          calculated (optional "ECLIPJ2000" by default).
+     */
+    SpiceSnapshotEphemerisSettings( const std::shared_ptr< spice_interface::SpiceSnapshot > spiceSnapshot,
+                                    const std::string frameOrigin = "SSB",
+                                    const std::string frameOrientation = "ECLIPJ2000" ):
+        EphemerisSettings( spice_snapshot_ephemeris, frameOrigin, frameOrientation ),
+        spiceSnapshot_( spiceSnapshot ){ }
+
+    //! Function to return snapshot of Spice data from which the ephemeris is to be retrieved.
+    /*!
+     *  Function to return snapshot of Spice data from which the ephemeris is to be retrieved.
+     *  \return Snapshot of Spice data from which the ephemeris is to be retrieved.
+     */
+    std::shared_ptr< spice_interface::SpiceSnapshot > getSpiceSnapshot( ){ return spiceSnapshot_; }
+
+private:
+
+    //! Snapshot of Spice data from which the ephemeris is to be retrieved.
+    std::shared_ptr< spice_interface::SpiceSnapshot > spiceSnapshot_;
+};
+#endif
+
 //! EphemerisSettings derived class for defining settings of an approximate ephemeris for major
 //! planets.
 /*!
@@ -458,6 +504,113 @@ private:
     std::function< Eigen::Vector6d( const double ) > customStateFunction_;
 };
 
+//! EphemerisSettings derived class for defining settings of an ephemeris that is fitted with piecewise Chebyshev
+//! polynomials to an ephemeris defined by other settings (e.g. to replace direct Spice calls during propagation).
+class ChebyshevEphemerisSettings: public EphemerisSettings
+{
+public:
+
+    //! Constructor
+    /*!
+     * Constructor. The frame origin and orientation are taken from the settings of the original ephemeris.
+     * \param originalEphemerisSettings Settings of ephemeris that is to be fitted.
+     * \param initialTime Start of time interval on which the ephemeris is to be fitted.
+     * \param finalTime End of time interval on which the ephemeris is to be fitted.
+     * \param positionTolerance Maximum allowed position difference w.r.t. original ephemeris.
+     * \param velocityTolerance Maximum allowed velocity difference w.r.t. original ephemeris.
+     * \param polynomialDegree Degree of the Chebyshev series of each segment.
+     * \param fileName Name of binary file in which the fitted ephemeris is stored. If the file exists, and the ephemeris
+     * it contains is consistent with these settings (see isChebyshevEphemerisConsistentWithSettings), the ephemeris is
+     * read from it (without evaluating the original ephemeris); if not, the ephemeris is fitted and written to the file
+     * (replacing any existing file). No file is used if empty (default).
+     */
+    ChebyshevEphemerisSettings( const std::shared_ptr< EphemerisSettings > originalEphemerisSettings,
+                                const double initialTime,
+                                const double finalTime,
+                                const double positionTolerance,
+                                const double velocityTolerance,
+                                const int polynomialDegree = 12,
+                                const std::string& fileName = "" ):
+        EphemerisSettings( chebyshev_ephemeris,
+                           originalEphemerisSettings->getFrameOrigin( ),
+                           originalEphemerisSettings->getFrameOrientation( ) ),
+        originalEphemerisSettings_( originalEphemerisSettings ), initialTime_( initialTime ), finalTime_( finalTime ),
+        positionTolerance_( positionTolerance ), velocityTolerance_( velocityTolerance ),
+        polynomialDegree_( polynomialDegree ), fileName_( fileName ){ }
+
+    //! Function to return settings of ephemeris that is to be fitted.
+    /*!
+     *  Function to return settings of ephemeris that is to be fitted.
+     *  \return Settings of ephemeris that is to be fitted.
+     */
+    std::shared_ptr< EphemerisSettings > getOriginalEphemerisSettings( ){ return originalEphemerisSettings_; }
+
+    //! Function to return start of time interval on which the ephemeris is to be fitted.
+    /*!
+     *  Function to return start of time interval on which the ephemeris is to be fitted.
+     *  \return Start of time interval on which the ephemeris is to be fitted.
+     */
+    double getInitialTime( ){ return initialTime_; }
+
+    //! Function to return end of time interval on which the ephemeris is to be fitted.
+    /*!
+     *  Function to return end of time interval on which the ephemeris is to be fitted.
+     *  \return End of time interval on which the ephemeris is to be fitted.
+     */
+    double getFinalTime( ){ return finalTime_; }
+
+    //! Function to return maximum allowed position difference w.r.t. original ephemeris.
+    /*!
+     *  Function to return maximum allowed position difference w.r.t. original ephemeris.
+     *  \return Maximum allowed position difference w.r.t. original ephemeris.
+     */
+    double getPositionTolerance( ){ return positionTolerance_; }
+
+    //! Function to return maximum allowed velocity difference w.r.t. original ephemeris.
+    /*!
+     *  Function to return maximum allowed velocity difference w.r.t. original ephemeris.
+     *  \return Maximum allowed velocity difference w.r.t. original ephemeris.
+     */
+    double getVelocityTolerance( ){ return velocityTolerance_; }
+
+    //! Function to return degree of the Chebyshev series of each segment.
+    /*!
+     *  Function to return degree of the Chebyshev series of each segment.
+     *  \return Degree of the Chebyshev series of each segment.
+     */
+    int getPolynomialDegree( ){ return polynomialDegree_; }
+
+    //! Function to return name of binary file in which the fitted ephemeris is stored.
+    /*!
+     *  Function to return name of binary file in which the fitted ephemeris is stored (empty if none).
+     *  \return Name of binary file in which the fitted ephemeris is stored.
+     */
+    std::string getFileName( ){ return fileName_; }
+
+private:
+
+    //! Settings of ephemeris that is to be fitted.
+    std::shared_ptr< EphemerisSettings > originalEphemerisSettings_;
+
+    //! Start of time interval on which the ephemeris is to be fitted.
+    double initialTime_;
+
+    //! End of time interval on which the ephemeris is to be fitted.
+    double finalTime_;
+
+    //! Maximum allowed position difference w.r.t. original ephemeris.
+    double positionTolerance_;
+
+    //! Maximum allowed velocity difference w.r.t. original ephemeris.
+    double velocityTolerance_;
+
+    //! Degree of the Chebyshev series of each segment.
+    int polynomialDegree_;
+
+    //! Name of binary file in which the fitted ephemeris is stored (empty if none).
+    std::string fileName_;
+};
+
 //! EphemerisSettings derived class for defining settings of an ephemeris representing an ideal
 //! Kepler orbit.
 class KeplerEphemerisSettings: public EphemerisSettings
@@ -683,6 +836,19 @@ std::shared_ptr< ephemerides::Ephemeris > createTabulatedEphemerisFromSpice(
 }
 #endif
 
+//! Function to check whether a Chebyshev ephemeris is consistent with the settings for a Chebyshev ephemeris.
+/*!
+ *  Function to check whether a Chebyshev ephemeris (e.g. read from a file) is consistent with the settings for a Chebyshev
+ *  ephemeris, i.e. whether it is defined on the same time interval, in the same frame and with the same polynomial
+ *  degree, and was fitted with tolerances that are at least as strict as those in the settings.
+ *  \param chebyshevEphemeris Chebyshev ephemeris that is to be checked.
+ *  \param chebyshevEphemerisSettings Settings with which the ephemeris is to be consistent.
+ *  \return True if the ephemeris is consistent with the settings, false otherwise.
+ */
+bool isChebyshevEphemerisConsistentWithSettings(
+        const std::shared_ptr< ephemerides::ChebyshevEphemeris > chebyshevEphemeris,
+        const std::shared_ptr< ChebyshevEphemerisSettings > chebyshevEphemerisSettings );
+
 //! Function to create a ephemeris model.
 /*!
  *  Function to create a ephemeris model based on model-specific settings for the ephemeris.
@@ -42,7 +42,7 @@ std::shared_ptr< ephemerides::Ephemeris > createReferencePointEphemeris(
 
     // Create list of state/rotation functions that are to be used
     std::map< int, std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType& ) > > stationEphemerisVector;
-    stationEphemerisVector[ 2 ] = std::bind( &simulation_setup::Body::getStateInBaseFrameFromEphemeris
+    stationEphemerisVector[ 2 ] = std::bind( &simulation_setup::Body::computeStateInBaseFrameFromEphemeris
                                                < StateScalarType, TimeType >, bodyWithReferencePoint, std::placeholders::_1 );
     stationEphemerisVector[ 0 ] = referencePointStateFunction;
 
@@ -97,7 +97,7 @@ std::function< Eigen::Matrix< StateScalarType, 6, 1 >( const TimeType& ) > getLi
     {
         // Create function to calculate state of transmitting ground station.
         linkEndCompleteEphemerisFunction =
-                std::bind( &simulation_setup::Body::getStateInBaseFrameFromEphemeris< StateScalarType, TimeType >,
+                std::bind( &simulation_setup::Body::computeStateInBaseFrameFromEphemeris< StateScalarType, TimeType >,
                                                         bodyWithLinkEnd, std::placeholders::_1 );
     }
     return linkEndCompleteEphemerisFunction;
@@ -61,7 +61,7 @@ std::shared_ptr< LightTimeCorrection > createLightTimeCorrections(
                 {
                     // Set state function.
                     perturbingBodyStateFunctions.push_back(
-                                std::bind( &simulation_setup::Body::getStateInBaseFrameFromEphemeris< double, double >,
+                                std::bind( &simulation_setup::Body::computeStateInBaseFrameFromEphemeris< double, double >,
                                                                          bodyMap.at( perturbingBodies[ i ] ), std::placeholders::_1 ) );
 
                     // Set gravitational parameter function.
@@ -350,7 +350,7 @@ std::shared_ptr< BodyAvoidanceAngleCalculator > createBodyAvoidanceAngleCalculat
 
     // Create state function of body to be avoided.
     std::function< Eigen::Vector6d( const double ) > stateFunctionOfBodyToAvoid =
-            std::bind( &simulation_setup::Body::getStateInBaseFrameFromEphemeris< double, double >,
+            std::bind( &simulation_setup::Body::computeStateInBaseFrameFromEphemeris< double, double >,
                          bodyMap.at( observationViabilitySettings->getStringParameter( ) ), std::placeholders::_1 );
 
     // Create check object
@@ -381,7 +381,7 @@ std::shared_ptr< OccultationCalculator > createOccultationCalculator(
 
     // Create state function of occulting body.
     std::function< Eigen::Vector6d( const double ) > stateOfOccultingBody =
-            std::bind( &simulation_setup::Body::getStateInBaseFrameFromEphemeris< double, double >,
+            std::bind( &simulation_setup::Body::computeStateInBaseFrameFromEphemeris< double, double >,
                          bodyMap.at( observationViabilitySettings->getStringParameter( ) ), std::placeholders::_1 );
 
     // Create check object
@@ -1283,7 +1283,7 @@ public:
             // Create observation model
             observationModel = std::make_shared< PositionObservationModel<
                     ObservationScalarType, TimeType > >(
-                        std::bind( &simulation_setup::Body::getStateInBaseFrameFromEphemeris<
+                        std::bind( &simulation_setup::Body::computeStateInBaseFrameFromEphemeris<
                                    ObservationScalarType, TimeType >,
                                    bodyMap.at( linkEnds.at( observed_body ).first ), std::placeholders::_1 ),
                         observationBias );
@@ -1381,7 +1381,7 @@ public:
             // Create observation model
             observationModel = std::make_shared< VelocityObservationModel<
                     ObservationScalarType, TimeType > >(
-                        std::bind( &simulation_setup::Body::getStateInBaseFrameFromEphemeris<
+                        std::bind( &simulation_setup::Body::computeStateInBaseFrameFromEphemeris<
                                      ObservationScalarType, TimeType >,
                                      bodyMap.at( linkEnds.at( observed_body ).first ), std::placeholders::_1 ),
                         observationBias );
@@ -12,14 +12,20 @@
 #define TUDAT_ORBITDETERMINATIONMANAGER_H
 
 #include <algorithm>
+#include <functional>
+#include <map>
+#include <tuple>
 
 #include <boost/make_shared.hpp>
 
+#include "Tudat/Basics/parallelization.h"
 #include "Tudat/InputOutput/basicInputOutput.h"
 #include "Tudat/Mathematics/BasicMathematics/leastSquaresEstimation.h"
 #include "Tudat/Astrodynamics/ObservationModels/observationManager.h"
 #include "Tudat/Astrodynamics/OrbitDetermination/podInputOutputTypes.h"
+#include "Tudat/Astrodynamics/OrbitDetermination/EstimatableParameters/empiricalAccelerationCoefficients.h"
 #include "Tudat/Astrodynamics/OrbitDetermination/EstimatableParameters/initialTranslationalState.h"
+#include "Tudat/Astrodynamics/OrbitDetermination/EstimatableParameters/observationBiasParameter.h"
 #include "Tudat/SimulationSetup/EstimationSetup/variationalEquationsSolver.h"
 #include "Tudat/SimulationSetup/EstimationSetup/createObservationManager.h"
 #include "Tudat/SimulationSetup/EstimationSetup/createNumericalSimulator.h"
@@ -76,6 +82,92 @@ Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > getConcatenatedWeights
     return concatenatedWeights;
 }
 
+//! Function to retrieve the indices of the arc-wise estimated parameters, per arc of each parameter
+/*!
+ *  Function to retrieve the indices (in the full estimated parameter vector) of the arc-wise estimated parameters, per arc
+ *  of each parameter. Multi-arc initial states, arc-wise drag/radiation pressure/empirical acceleration coefficients and
+ *  arc-wise observation biases are included. The entries of each of these parameters are ordered per arc, so that each arc
+ *  is represented by a contiguous set of indices. The arcs of different parameters are returned as separate lists, even when
+ *  they are defined over the same time interval.
+ *  \param parametersToEstimate Set of estimated parameters
+ *  \return List of indices of arc-wise estimated parameters, per arc of each parameter
+ */
+template< typename InitialStateParameterType = double >
+std::vector< std::vector< int > > getArcWiseParameterBlockIndices(
+        const std::shared_ptr< estimatable_parameters::EstimatableParameterSet< InitialStateParameterType > >
+        parametersToEstimate )
+{
+    using namespace estimatable_parameters;
+
+    // Retrieve start index, number of arcs and size of parameter per arc, for each arc-wise parameter
+    std::vector< std::tuple< int, int, int > > arcWiseParameterSizes;
+    std::map< int, std::shared_ptr< EstimatableParameter< Eigen::Matrix< InitialStateParameterType, Eigen::Dynamic, 1 > > > >
+            multiArcStateParameters = parametersToEstimate->getInitialMultiArcStateParameters( );
+    for( auto parameterIterator = multiArcStateParameters.begin( ); parameterIterator != multiArcStateParameters.end( );
+         parameterIterator++ )
+    {
+        if( parameterIterator->second->getParameterName( ).first == arc_wise_initial_body_state )
+        {
+            arcWiseParameterSizes.push_back(
+                        std::make_tuple( parameterIterator->first, parameterIterator->second->getParameterSize( ) / 6, 6 ) );
+        }
+    }
+
+    std::map< int, std::shared_ptr< EstimatableParameter< Eigen::VectorXd > > > vectorParameters =
+            parametersToEstimate->getVectorParameters( );
+    for( auto parameterIterator = vectorParameters.begin( ); parameterIterator != vectorParameters.end( );
+         parameterIterator++ )
+    {
+        int parameterSize = parameterIterator->second->getParameterSize( );
+        switch( parameterIterator->second->getParameterName( ).first )
+        {
+        case arc_wise_constant_drag_coefficient:
+        case arc_wise_radiation_pressure_coefficient:
+            arcWiseParameterSizes.push_back( std::make_tuple( parameterIterator->first, parameterSize, 1 ) );
+            break;
+        case arc_wise_empirical_acceleration_coefficients:
+        {
+            int singleArcParameterSize = std::dynamic_pointer_cast< ArcWiseEmpiricalAccelerationCoefficientsParameter >(
+                        parameterIterator->second )->getSingleArcParameterSize( );
+            arcWiseParameterSizes.push_back(
+                        std::make_tuple( parameterIterator->first, parameterSize / singleArcParameterSize,
+                                         singleArcParameterSize ) );
+            break;
+        }
+        case arcwise_constant_additive_observation_bias:
+        case arcwise_constant_relative_observation_bias:
+        {
+            int numberOfArcs = std::dynamic_pointer_cast< ArcWiseObservationBiasParameter >(
+                        parameterIterator->second )->getArcStartTimes( ).size( );
+            arcWiseParameterSizes.push_back(
+                        std::make_tuple( parameterIterator->first, numberOfArcs, parameterSize / numberOfArcs ) );
+            break;
+        }
+        default:
+            break;
+        }
+    }
+
+    // Create list of indices per arc
+    std::vector< std::vector< int > > arcWiseParameterBlockIndices;
+    for( unsigned int i = 0; i < arcWiseParameterSizes.size( ); i++ )
+    {
+        int startIndex = std::get< 0 >( arcWiseParameterSizes.at( i ) );
+        int singleArcParameterSize = std::get< 2 >( arcWiseParameterSizes.at( i ) );
+        for( int j = 0; j < std::get< 1 >( arcWiseParameterSizes.at( i ) ); j++ )
+        {
+            std::vector< int > currentArcIndices;
+            for( int k = 0; k < singleArcParameterSize; k++ )
+            {
+                currentArcIndices.push_back( startIndex + j * singleArcParameterSize + k );
+            }
+            arcWiseParameterBlockIndices.push_back( currentArcIndices );
+        }
+    }
+
+    return arcWiseParameterBlockIndices;
+}
+
 //! Top-level class for performing orbit determination.
 /*!
  *  Top-level class for performing orbit determination. All required propagation/estimation settings are provided to
@@ -129,7 +221,7 @@ public:
             const std::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > integratorSettings,
             const std::shared_ptr< propagators::PropagatorSettings< ObservationScalarType > > propagatorSettings,
             const bool propagateOnCreation = true ):
-        parametersToEstimate_( parametersToEstimate )
+        parametersToEstimate_( parametersToEstimate ), numberOfThreads_( 1 )
     {
         initializeOrbitDeterminationManager( bodyMap, observationSettingsMap, integratorSettings, propagatorSettings,
                                              propagateOnCreation );
@@ -156,7 +248,7 @@ public:
             const std::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > integratorSettings,
             const std::shared_ptr< propagators::PropagatorSettings< ObservationScalarType > > propagatorSettings,
             const bool propagateOnCreation = true ):
-        parametersToEstimate_( parametersToEstimate )
+        parametersToEstimate_( parametersToEstimate ), numberOfThreads_( 1 )
     {
         initializeOrbitDeterminationManager( bodyMap, observation_models::convertUnsortedToSortedObservationSettingsMap(
                                                  observationSettingsMap ), integratorSettings, propagatorSettings,
@@ -266,7 +358,9 @@ public:
     /*!
      *  This function calculates the observation partials matrix and residuals, based on the state transition matrix,
      *  sensitivity matrix and body states resulting from the previous numerical integration iteration.
-     *  Partials and observations are calculated by the observationManagers_.
+     *  Partials and observations are calculated by the observationManagers_. The blocks of observations for each
+     *  combination of observable type and link ends are computed concurrently if more than one thread has been set by
+     *  setNumberOfThreads; the result is identical to that of a serial computation.
      *  \param observationsAndTimes Observable values and associated time tags, per observable type and set of link ends.
      *  \param parameterVectorSize Length of the vector of estimated parameters
      *  \param totalObservationSize Total number of observations in observationsAndTimes map.
@@ -281,51 +375,277 @@ public:
         residualsAndPartials.second = Eigen::MatrixXd::Zero( totalObservationSize, parameterVectorSize );
         residualsAndPartials.first = Eigen::VectorXd::Zero( totalObservationSize );
 
-        // Declare variable denoting current index in vector of all observations.
-        int startIndex = 0;
+        // Retrieve all blocks of observations (each block writes to separate rows of the output)
+        std::vector< ObservationBlock > observationBlocks = getObservationBlocks( observationsAndTimes );
 
-        // Iterate over all observable types in observationsAndTimes
-        std::vector< TimeType > simulationInputTime;
-        for( typename PodInputType::const_iterator observablesIterator = observationsAndTimes.begin( );
-             observablesIterator != observationsAndTimes.end( ); observablesIterator++ )
+        // Compute observations and partials per block
+        utilities::executeParallelLoop(
+                    observationBlocks.size( ), numberOfThreads_, [ & ]( const int blockIndex )
         {
-            int observableStartIndex = startIndex;
+            const ObservationBlock& currentBlock = observationBlocks.at( blockIndex );
+            int currentNumberOfObservations = currentBlock.numberOfObservations;
 
-            // Iterate over all link ends for current observable type in observationsAndTimes
-            for( typename SingleObservablePodInputType::const_iterator dataIterator = observablesIterator->second.begin( );
-                 dataIterator != observablesIterator->second.end( ); dataIterator++  )
+            // Compute estimated ranges and range partials from current parameter estimate.
+            std::pair< ObservationVectorType, Eigen::MatrixXd > observationsWithPartials =
+                    computeObservationBlock( currentBlock );
+
+            // Compute residuals for current link ends and observabel type.
+            residualsAndPartials.first.segment( currentBlock.startIndex, currentNumberOfObservations ) =
+                    ( currentBlock.dataIterator->second.first.segment(
+                          currentBlock.startIndexInLinkEnds, currentNumberOfObservations ) -
+                      observationsWithPartials.first ).template cast< double >( );
+
+            // Set current observation partials in matrix of all partials
+            residualsAndPartials.second.block( currentBlock.startIndex, 0, currentNumberOfObservations, parameterVectorSize ) =
+                    observationsWithPartials.second;
+        } );
+
+        checkResidualDiscontinuities( observationsAndTimes, residualsAndPartials.first );
+    }
+
+    //! Function to calculate the (unnormalized) normal equations and residuals, without storing the full partials matrix
+    /*!
+     *  This function calculates the normal equations (H^T*W*H and H^T*W*y) and residuals, based on the state transition
+     *  matrix, sensitivity matrix and body states resulting from the previous numerical integration iteration. The partials
+     *  are computed and added to the normal equations per observable type and set of link ends, so that the memory
+     *  requirement of the partials scales with the number of parameters squared, instead of with the number of
+     *  observations (see processObservationBlocks).
+     *  \param observationsAndTimes Observable values and associated time tags, per observable type and set of link ends.
+     *  \param weightsMatrixDiagonals Weight matrix diagonals, sorted by observable type and link ends
+     *  \param parameterVectorSize Length of the vector of estimated parameters
+     *  \param totalObservationSize Total number of observations in observationsAndTimes map.
+     *  \param residuals Residuals of computed w.r.t. input observable values (return by reference).
+     *  \param normalMatrix Normal matrix H^T*W*H (return by reference).
+     *  \param rightHandSide Right-hand side of normal equations H^T*W*y (return by reference).
+     *  \return Vector with scaling values to be used for normalization, equal to the values that normalizeObservationMatrix
+     *  would compute from the full partials matrix.
+     */
+    Eigen::VectorXd calculateNormalEquationsAndResiduals(
+            const PodInputType& observationsAndTimes,
+            const std::map< observation_models::ObservableType,
+            std::map< observation_models::LinkEnds, Eigen::VectorXd > >& weightsMatrixDiagonals,
+            const int parameterVectorSize, const int totalObservationSize,
+            Eigen::VectorXd& residuals, Eigen::MatrixXd& normalMatrix, Eigen::VectorXd& rightHandSide )
+    {
+        // Initialize return data.
+        normalMatrix = Eigen::MatrixXd::Zero( parameterVectorSize, parameterVectorSize );
+        rightHandSide = Eigen::VectorXd::Zero( parameterVectorSize );
+
+        // Add each block of partials to normal equations
+        return processObservationBlocks(
+                    observationsAndTimes, getObservationBlocks( observationsAndTimes, true ), parameterVectorSize,
+                    totalObservationSize, residuals,
+                    [ & ]( const ObservationBlock& currentBlock, const Eigen::MatrixXd& currentPartials )
+        {
+            linear_algebra::addObservationBlockToNormalEquations(
+                        currentPartials, residuals.segment( currentBlock.startIndex, currentPartials.rows( ) ),
+                        weightsMatrixDiagonals.at( currentBlock.observablesIterator->first ).at(
+                            currentBlock.dataIterator->first ).segment(
+                            currentBlock.startIndexInLinkEnds, currentPartials.rows( ) ), normalMatrix, rightHandSide );
+        } );
+    }
+
+    //! Function to calculate the (unnormalized) square-root information matrix and residuals
+    /*!
+     *  This function calculates the residuals, and adds the partials of the observations to a Householder least squares
+     *  solver sequentially in time, without storing the full partials matrix (see processObservationBlocks). The observations
+     *  are split into blocks per time interval between consecutive time update epochs (see getTimeOrderedObservationBlocks),
+     *  which are processed in order of the time intervals. Before the first block after a time update epoch is added, the
+     *  time updates at that epoch (and any earlier epoch that has not yet been processed) are applied to the solver, in the
+     *  order in which they are stored. Any time updates after the last observation are applied after all observations.
+     *  \param observationsAndTimes Observable values and associated time tags, per observable type and set of link ends.
+     *  \param weightsMatrixDiagonals Weight matrix diagonals, sorted by observable type and link ends
+     *  \param timeUpdates Time updates to be applied to the solver, with the epoch at which they are applied as key.
+     *  \param parameterVectorSize Length of the vector of estimated parameters
+     *  \param totalObservationSize Total number of observations in observationsAndTimes map.
+     *  \param residuals Residuals of computed w.r.t. input observable values (return by reference).
+     *  \param householderLeastSquaresSolver Solver to which the observations are added (modified by this function)
+     *  \return Vector with scaling values to be used for normalization, equal to the values that normalizeObservationMatrix
+     *  would compute from the full partials matrix.
+     */
+    Eigen::VectorXd calculateSquareRootInformationAndResiduals(
+            const PodInputType& observationsAndTimes,
+            const std::map< observation_models::ObservableType,
+            std::map< observation_models::LinkEnds, Eigen::VectorXd > >& weightsMatrixDiagonals,
+            const std::multimap< double, std::function< void( linear_algebra::HouseholderLeastSquaresSolver& ) > >&
+            timeUpdates,
+            const int parameterVectorSize, const int totalObservationSize,
+            Eigen::VectorXd& residuals, linear_algebra::HouseholderLeastSquaresSolver& householderLeastSquaresSolver )
+    {
+        // Retrieve epochs at which time updates are applied
+        std::vector< double > timeUpdateEpochs;
+        for( const auto& timeUpdateIterator : timeUpdates )
+        {
+            if( timeUpdateEpochs.size( ) == 0 || timeUpdateIterator.first != timeUpdateEpochs.back( ) )
             {
-                simulationInputTime.clear( );
-                simulationInputTime = dataIterator->second.second.first;
+                timeUpdateEpochs.push_back( timeUpdateIterator.first );
+            }
+        }
 
-                // Compute estimated ranges and range partials from current parameter estimate.
-                std::pair< ObservationVectorType, Eigen::MatrixXd > observationsWithPartials;
-                observationsWithPartials = observationManagers_[ observablesIterator->first ]->
-                        computeObservationsWithPartials(
-                            simulationInputTime, dataIterator->first, dataIterator->second.second.second );
+        // Apply all time updates before the time interval with given index
+        int numberOfAppliedTimeUpdateEpochs = 0;
+        auto applyTimeUpdates = [ & ]( const int timeIntervalIndex )
+        {
+            while( numberOfAppliedTimeUpdateEpochs < timeIntervalIndex )
+            {
+                auto epochTimeUpdates = timeUpdates.equal_range( timeUpdateEpochs.at( numberOfAppliedTimeUpdateEpochs ) );
+                for( auto timeUpdateIterator = epochTimeUpdates.first; timeUpdateIterator != epochTimeUpdates.second;
+                     timeUpdateIterator++ )
+                {
+                    timeUpdateIterator->second( householderLeastSquaresSolver );
+                }
+                numberOfAppliedTimeUpdateEpochs++;
+            }
+        };
 
-                // Compute residuals for current link ends and observabel type.
-                residualsAndPartials.first.segment( startIndex, dataIterator->second.first.size( ) ) =
-                        ( dataIterator->second.first - observationsWithPartials.first ).template cast< double >( );
+        // Add each block of partials to solver, in time order
+        Eigen::VectorXd normalizationTerms = processObservationBlocks(
+                    observationsAndTimes, getTimeOrderedObservationBlocks( observationsAndTimes, timeUpdateEpochs ),
+                    parameterVectorSize, totalObservationSize, residuals,
+                    [ & ]( const ObservationBlock& currentBlock, const Eigen::MatrixXd& currentPartials )
+        {
+            applyTimeUpdates( currentBlock.timeIntervalIndex );
+            householderLeastSquaresSolver.addObservationBlock(
+                        currentPartials, residuals.segment( currentBlock.startIndex, currentPartials.rows( ) ),
+                        weightsMatrixDiagonals.at( currentBlock.observablesIterator->first ).at(
+                            currentBlock.dataIterator->first ).segment(
+                            currentBlock.startIndexInLinkEnds, currentPartials.rows( ) ) );
+        } );
+        applyTimeUpdates( timeUpdateEpochs.size( ) );
 
-                // Set current observation partials in matrix of all partials
-                residualsAndPartials.second.block( startIndex, 0, dataIterator->second.first.size( ), parameterVectorSize ) =
-                        observationsWithPartials.second;
+        return normalizationTerms;
+    }
 
-                // Increment current index of observation.
-                startIndex += dataIterator->second.first.size( );
+    //! Function to create the time updates of a Householder least squares solver
+    /*!
+     *  Function to create the time updates of a Householder least squares solver, as used by
+     *  calculateSquareRootInformationAndResiduals. The process noise on arc-wise parameters (empirical accelerations and
+     *  observation biases) is added at the start time of each arc (except the first), as pseudo-observations relating the
+     *  parameter values in the arc to those in the preceding arc (see ArcWiseProcessNoiseSettings). The pseudo-observations
+     *  are applied to the current parameter values. At each of the additional time update epochs, the time update function
+     *  is called (after any process noise at the same epoch has been added).
+     *  \param arcWiseProcessNoiseSettings Settings for process noise, per parameter type
+     *  \param timeUpdateEpochs Additional epochs at which the timeUpdateFunction is to be called
+     *  \param timeUpdateFunction Function to be called at the additional time update epochs, with the epoch and solver as input
+     *  \return Time updates to be applied to the solver, with the epoch at which they are applied as key.
+     */
+    std::multimap< double, std::function< void( linear_algebra::HouseholderLeastSquaresSolver& ) > > createTimeUpdates(
+            const std::map< estimatable_parameters::EstimatebleParametersEnum,
+            std::shared_ptr< ArcWiseProcessNoiseSettings > >& arcWiseProcessNoiseSettings,
+            const std::vector< double >& timeUpdateEpochs,
+            const std::function< void( const double, linear_algebra::HouseholderLeastSquaresSolver& ) >& timeUpdateFunction )
+    {
+        using namespace estimatable_parameters;
 
+        std::multimap< double, std::function< void( linear_algebra::HouseholderLeastSquaresSolver& ) > > timeUpdates;
+
+        int parameterVectorSize = parametersToEstimate_->getParameterSetSize( );
+        std::map< EstimatebleParametersEnum, bool > isParameterTypeFound;
+        std::map< int, std::shared_ptr< EstimatableParameter< Eigen::VectorXd > > > vectorParameters =
+                parametersToEstimate_->getVectorParameters( );
+        for( const auto& parameterIterator : vectorParameters )
+        {
+            EstimatebleParametersEnum parameterType = parameterIterator.second->getParameterName( ).first;
+            if( arcWiseProcessNoiseSettings.count( parameterType ) == 0 )
+            {
+                continue;
             }
+            isParameterTypeFound[ parameterType ] = true;
 
-            int currentObservableSize = startIndex - observableStartIndex;
-            observation_models::checkObservationResidualDiscontinuities(
-                        residualsAndPartials.first.block( observableStartIndex, 0, currentObservableSize, 1 ),
-                        observablesIterator->first );
+            // Retrieve arc start times of parameter
+            std::vector< double > arcStartTimes;
+            if( parameterType == arc_wise_empirical_acceleration_coefficients )
+            {
+                arcStartTimes = std::dynamic_pointer_cast< ArcWiseEmpiricalAccelerationCoefficientsParameter >(
+                            parameterIterator.second )->getArcStartTimes( );
+            }
+            else if( parameterType == arcwise_constant_additive_observation_bias ||
+                     parameterType == arcwise_constant_relative_observation_bias )
+            {
+                arcStartTimes = std::dynamic_pointer_cast< ArcWiseObservationBiasParameter >(
+                            parameterIterator.second )->getArcStartTimes( );
+            }
+            else
+            {
+                throw std::runtime_error( "Error when adding arc-wise process noise, parameter type " +
+                                          std::to_string( parameterType ) + " not supported" );
+            }
+
+            // Add pseudo-observation relating each pair of consecutive arcs
+            int numberOfArcs = arcStartTimes.size( );
+            int singleArcParameterSize = parameterIterator.second->getParameterSize( ) / numberOfArcs;
+            Eigen::VectorXd parameterValue = parameterIterator.second->getParameterValue( );
+            double standardDeviation = arcWiseProcessNoiseSettings.at( parameterType )->getStandardDeviation( );
+            double correlationTime = arcWiseProcessNoiseSettings.at( parameterType )->getCorrelationTime( );
+            for( int i = 0; i < numberOfArcs - 1; i++ )
+            {
+                double correlation = std::exp( -( arcStartTimes.at( i + 1 ) - arcStartTimes.at( i ) ) / correlationTime );
+                double noiseVariance = standardDeviation * standardDeviation * ( 1.0 - correlation * correlation );
+
+                Eigen::MatrixXd pseudoObservationPartials =
+                        Eigen::MatrixXd::Zero( singleArcParameterSize, parameterVectorSize );
+                int currentArcStartIndex = parameterIterator.first + i * singleArcParameterSize;
+                pseudoObservationPartials.block( 0, currentArcStartIndex, singleArcParameterSize, singleArcParameterSize ) =
+                        -correlation * Eigen::MatrixXd::Identity( singleArcParameterSize, singleArcParameterSize );
+                pseudoObservationPartials.block(
+                            0, currentArcStartIndex + singleArcParameterSize, singleArcParameterSize, singleArcParameterSize ) =
+                        Eigen::MatrixXd::Identity( singleArcParameterSize, singleArcParameterSize );
+
+                Eigen::VectorXd pseudoObservationResiduals = -pseudoObservationPartials.block(
+                            0, parameterIterator.first, singleArcParameterSize, parameterValue.rows( ) ) * parameterValue;
+                Eigen::VectorXd pseudoObservationWeights =
+                        Eigen::VectorXd::Constant( singleArcParameterSize, 1.0 / noiseVariance );
+                timeUpdates.insert(
+                            std::make_pair( arcStartTimes.at( i + 1 ),
+                                            [ = ]( linear_algebra::HouseholderLeastSquaresSolver& householderLeastSquaresSolver )
+                {
+                    householderLeastSquaresSolver.addObservationBlock(
+                                pseudoObservationPartials, pseudoObservationResiduals, pseudoObservationWeights );
+                } ) );
+            }
         }
 
-    }
+        for( const auto& settingsIterator : arcWiseProcessNoiseSettings )
+        {
+            if( isParameterTypeFound.count( settingsIterator.first ) == 0 )
+            {
+                throw std::runtime_error( "Error when adding arc-wise process noise, no parameter of type " +
+                                          std::to_string( settingsIterator.first ) + " is estimated" );
+            }
+        }
 
+        // Add time updates by user-defined function
+        for( unsigned int i = 0; i < timeUpdateEpochs.size( ); i++ )
+        {
+            double currentEpoch = timeUpdateEpochs.at( i );
+            timeUpdates.insert(
+                        std::make_pair( currentEpoch,
+                                        [ = ]( linear_algebra::HouseholderLeastSquaresSolver& householderLeastSquaresSolver )
+            {
+                timeUpdateFunction( currentEpoch, householderLeastSquaresSolver );
+            } ) );
+        }
 
+        return timeUpdates;
+    }
+
+    //! Function to normalize a set of normal equations, using the normalization of the associated partials matrix
+    /*!
+     * Function to normalize a set of normal equations, such that they are equal to the normal equations that would be
+     * obtained from a partials matrix normalized by normalizeObservationMatrix.
+     * \param normalizationTerms Vector with scaling values used for normalization of each column of the partials matrix
+     * \param normalMatrix Normal matrix H^T*W*H. Matrix modified by this function, and normalized matrix is returned by
+     * reference
+     * \param rightHandSide Right-hand side of normal equations H^T*W*y. Vector modified by this function, and normalized vector
+     * is returned by reference
+     */
+    void normalizeNormalEquations( const Eigen::VectorXd& normalizationTerms,
+                                   Eigen::MatrixXd& normalMatrix, Eigen::VectorXd& rightHandSide )
+    {
+        Eigen::VectorXd inverseNormalizationTerms = normalizationTerms.cwiseInverse( );
+        normalMatrix = inverseNormalizationTerms.asDiagonal( ) * normalMatrix * inverseNormalizationTerms.asDiagonal( );
+        rightHandSide = rightHandSide.cwiseProduct( inverseNormalizationTerms );
+    }
 
     //! Function to normalize the matrix of partial derivatives so that each column is in the range [-1,1]
     /*!
@@ -418,10 +738,26 @@ public:
         ParameterVectorType bestParameterEstimate = ParameterVectorType::Constant( parameterVectorSize, TUDAT_NAN );
         Eigen::VectorXd bestTransformationData = Eigen::VectorXd::Constant( parameterVectorSize, TUDAT_NAN );
         Eigen::VectorXd bestResiduals = Eigen::VectorXd::Constant( totalNumberOfObservations, TUDAT_NAN );
-        Eigen::MatrixXd bestInformationMatrix = Eigen::MatrixXd::Constant( totalNumberOfObservations, parameterVectorSize, TUDAT_NAN );
+
+        // Full partials matrix is only stored if requested; otherwise, the normal equations (or square-root information
+        // matrix) are accumulated block-wise
+        bool useHouseholderLeastSquares = podInput->getUseHouseholderLeastSquares( );
+        bool saveInformationMatrix = podInput->getSaveInformationMatrix( ) && !useHouseholderLeastSquares;
+        Eigen::MatrixXd bestInformationMatrix = saveInformationMatrix ?
+                    Eigen::MatrixXd::Constant( totalNumberOfObservations, parameterVectorSize, TUDAT_NAN ) :
+                    Eigen::MatrixXd::Zero( 0, 0 );
         Eigen::VectorXd bestWeightsMatrixDiagonal = Eigen::VectorXd::Constant( totalNumberOfObservations, TUDAT_NAN );
         Eigen::MatrixXd bestInverseNormalizedCovarianceMatrix = Eigen::MatrixXd::Constant( parameterVectorSize, parameterVectorSize, TUDAT_NAN );
 
+        // Retrieve arc-wise parameter blocks, if these are to be eliminated when solving the normal equations
+        bool exploitArcWiseBlockStructure = podInput->getExploitArcWiseBlockStructure( ) && !useHouseholderLeastSquares;
+        std::vector< std::vector< int > > arcWiseParameterBlockIndices;
+        if( exploitArcWiseBlockStructure )
+        {
+            arcWiseParameterBlockIndices = getArcWiseParameterBlockIndices( parametersToEstimate_ );
+        }
+        std::shared_ptr< linear_algebra::BlockArrowheadNormalEquationsSolver > bestNormalEquationsSolver;
+
         std::vector< Eigen::VectorXd > residualHistory;
         std::vector< Eigen::VectorXd > parameterHistory;
         std::vector< std::vector< std::map< TimeType, Eigen::Matrix< ObservationScalarType, Eigen::Dynamic, 1 > > > > dynamicsHistoryPerIteration;
@@ -440,6 +776,14 @@ public:
 
         int numberOfEstimatedParameters = parameterVectorSize;
 
+        // Create Householder least squares solver containing only a priori information (copied on each iteration)
+        std::shared_ptr< linear_algebra::HouseholderLeastSquaresSolver > aPrioriHouseholderLeastSquaresSolver;
+        if( useHouseholderLeastSquares )
+        {
+            aPrioriHouseholderLeastSquaresSolver = std::make_shared< linear_algebra::HouseholderLeastSquaresSolver >(
+                        podInput->getInverseOfAprioriCovariance( ) );
+        }
+
         bool exceptionDuringPropagation = false, exceptionDuringInversion = false;
         // Iterate until convergence (at least once)
         int numberOfIterations = 0;
@@ -475,12 +819,39 @@ public:
             {
                 std::cout << "Calculating residuals and partials " << totalNumberOfObservations << std::endl;
             }
-            // Calculate residuals and observation matrix for current parameter estimate.
+            // Calculate residuals and observation matrix (or normal equations) for current parameter estimate.
             std::pair< Eigen::VectorXd, Eigen::MatrixXd > residualsAndPartials;
-            calculateObservationMatrixAndResiduals(
-                        podInput->getObservationsAndTimes( ), parameterVectorSize, totalNumberOfObservations, residualsAndPartials );
-
-            Eigen::VectorXd transformationData = normalizeObservationMatrix( residualsAndPartials.second );
+            Eigen::MatrixXd normalMatrix;
+            Eigen::VectorXd normalEquationsRightHandSide;
+            Eigen::VectorXd transformationData;
+            std::shared_ptr< linear_algebra::HouseholderLeastSquaresSolver > householderLeastSquaresSolver;
+            if( useHouseholderLeastSquares )
+            {
+                householderLeastSquaresSolver = std::make_shared< linear_algebra::HouseholderLeastSquaresSolver >(
+                            *aPrioriHouseholderLeastSquaresSolver );
+                transformationData = calculateSquareRootInformationAndResiduals(
+                            podInput->getObservationsAndTimes( ), podInput->getWeightsMatrixDiagonals( ),
+                            createTimeUpdates( podInput->getArcWiseProcessNoiseSettings( ), podInput->getTimeUpdateEpochs( ),
+                                               podInput->getTimeUpdateFunction( ) ),
+                            parameterVectorSize, totalNumberOfObservations,
+                            residualsAndPartials.first, *householderLeastSquaresSolver );
+                householderLeastSquaresSolver->normalizeParameters( transformationData );
+            }
+            else if( saveInformationMatrix )
+            {
+                calculateObservationMatrixAndResiduals(
+                            podInput->getObservationsAndTimes( ), parameterVectorSize, totalNumberOfObservations,
+                            residualsAndPartials );
+                transformationData = normalizeObservationMatrix( residualsAndPartials.second );
+            }
+            else
+            {
+                transformationData = calculateNormalEquationsAndResiduals(
+                            podInput->getObservationsAndTimes( ), podInput->getWeightsMatrixDiagonals( ),
+                            parameterVectorSize, totalNumberOfObservations,
+                            residualsAndPartials.first, normalMatrix, normalEquationsRightHandSide );
+                normalizeNormalEquations( transformationData, normalMatrix, normalEquationsRightHandSide );
+            }
 
             Eigen::MatrixXd normalizedInverseAprioriCovarianceMatrix = Eigen::MatrixXd::Zero(
                         numberOfEstimatedParameters, numberOfEstimatedParameters );
@@ -497,16 +868,63 @@ public:
 
             // Perform least squares calculation for correction to parameter vector.
             std::pair< Eigen::VectorXd, Eigen::MatrixXd > leastSquaresOutput;
+            std::shared_ptr< linear_algebra::BlockArrowheadNormalEquationsSolver > normalEquationsSolver;
             try
             {
                 Eigen::MatrixXd constraintStateMultiplier;
                 Eigen::VectorXd constraintRightHandSide;
                 parametersToEstimate_->getConstraints( constraintStateMultiplier, constraintRightHandSide );
-                leastSquaresOutput =
-                        std::move( linear_algebra::performLeastSquaresAdjustmentFromInformationMatrix(
-                                       residualsAndPartials.second.block( 0, 0, residualsAndPartials.second.rows( ), numberOfEstimatedParameters ),
-                                       residualsAndPartials.first, getConcatenatedWeightsVector( podInput->getWeightsMatrixDiagonals( ) ),
-                                       normalizedInverseAprioriCovarianceMatrix, 1, 1.0E8, constraintStateMultiplier, constraintRightHandSide ) );
+                if( useHouseholderLeastSquares && constraintStateMultiplier.rows( ) == 0 )
+                {
+                    leastSquaresOutput = std::make_pair( householderLeastSquaresSolver->getSolution( 1, 1.0E8 ),
+                                                         householderLeastSquaresSolver->getInverseCovarianceMatrix( ) );
+                }
+                else if( useHouseholderLeastSquares )
+                {
+                    // Impose linear constraints on normal equations formed from square-root information matrix
+                    leastSquaresOutput =
+                            std::move( linear_algebra::performLeastSquaresAdjustmentFromNormalEquations(
+                                           householderLeastSquaresSolver->getInverseCovarianceMatrix( ),
+                                           householderLeastSquaresSolver->getSquareRootInformationMatrix( ).transpose( ) *
+                                           householderLeastSquaresSolver->getTransformedResiduals( ),
+                                           1, 1.0E8, constraintStateMultiplier, constraintRightHandSide ) );
+                }
+                else if( exploitArcWiseBlockStructure && constraintStateMultiplier.rows( ) == 0 )
+                {
+                    // Eliminate arc-wise parameters from normal equations, and solve for remaining parameters
+                    Eigen::MatrixXd inverseOfCovarianceMatrix;
+                    if( saveInformationMatrix )
+                    {
+                        Eigen::VectorXd weightsVector = getConcatenatedWeightsVector( podInput->getWeightsMatrixDiagonals( ) );
+                        inverseOfCovarianceMatrix = linear_algebra::calculateInverseOfUpdatedCovarianceMatrix(
+                                    residualsAndPartials.second, weightsVector, normalizedInverseAprioriCovarianceMatrix );
+                        normalEquationsRightHandSide = residualsAndPartials.second.transpose( ) *
+                                ( weightsVector.cwiseProduct( residualsAndPartials.first ) );
+                    }
+                    else
+                    {
+                        inverseOfCovarianceMatrix = normalMatrix + normalizedInverseAprioriCovarianceMatrix;
+                    }
+
+                    normalEquationsSolver = std::make_shared< linear_algebra::BlockArrowheadNormalEquationsSolver >(
+                                inverseOfCovarianceMatrix, normalEquationsRightHandSide, arcWiseParameterBlockIndices, 1, 1.0E8 );
+                    leastSquaresOutput = std::make_pair( normalEquationsSolver->getSolution( ), inverseOfCovarianceMatrix );
+                }
+                else if( saveInformationMatrix )
+                {
+                    leastSquaresOutput =
+                            std::move( linear_algebra::performLeastSquaresAdjustmentFromInformationMatrix(
+                                           residualsAndPartials.second.block( 0, 0, residualsAndPartials.second.rows( ), numberOfEstimatedParameters ),
+                                           residualsAndPartials.first, getConcatenatedWeightsVector( podInput->getWeightsMatrixDiagonals( ) ),
+                                           normalizedInverseAprioriCovarianceMatrix, 1, 1.0E8, constraintStateMultiplier, constraintRightHandSide ) );
+                }
+                else
+                {
+                    leastSquaresOutput =
+                            std::move( linear_algebra::performLeastSquaresAdjustmentFromNormalEquations(
+                                           normalMatrix + normalizedInverseAprioriCovarianceMatrix, normalEquationsRightHandSide,
+                                           1, 1.0E8, constraintStateMultiplier, constraintRightHandSide ) );
+                }
 
                 if( constraintStateMultiplier.rows( ) > 0 )
                 {
@@ -567,13 +985,14 @@ public:
                 bestResidual = residualRms;
                 bestParameterEstimate = std::move( oldParameterEstimate );
                 bestResiduals = std::move( residualsAndPartials.first );
-                if( podInput->getSaveInformationMatrix( ) )
+                if( saveInformationMatrix )
                 {
                     bestInformationMatrix = std::move( residualsAndPartials.second );
                 }
                 bestWeightsMatrixDiagonal = std::move( getConcatenatedWeightsVector( podInput->getWeightsMatrixDiagonals( ) ) );
                 bestTransformationData = std::move( transformationData );
                 bestInverseNormalizedCovarianceMatrix = std::move( leastSquaresOutput.second );
+                bestNormalEquationsSolver = normalEquationsSolver;
             }
 
 
@@ -595,6 +1014,11 @@ public:
                     bestInverseNormalizedCovarianceMatrix, bestResidual, residualHistory, parameterHistory, exceptionDuringInversion,
                     exceptionDuringPropagation );
 
+        if( bestNormalEquationsSolver != nullptr )
+        {
+            podOutput->setNormalEquationsSolver( bestNormalEquationsSolver );
+        }
+
         if( podInput->getSaveStateHistoryForEachIteration( ) )
         {
             podOutput->setStateHistories(
@@ -706,6 +1130,37 @@ public:
         return observationManagers_.at( observableType );
     }
 
+    //! Function to set the number of threads used to compute observations and partials during the estimation
+    /*!
+     *  Function to set the number of threads used to compute observations and partials during the estimation. The
+     *  observations of each combination of observable type and link ends are then computed concurrently, each by their own
+     *  observation model, light-time calculator and observation partial objects. The results are identical to those of a
+     *  serial computation (default, numberOfThreads = 1): the observation models retrieve the states of the link ends
+     *  through Body::computeStateInBaseFrameFromEphemeris, which does not modify the current state of the Body objects.
+     *  Note that the environment models that are used by the observation models (e.g. ephemerides and rotation models)
+     *  must support concurrent evaluation for this option to be used. Models that call the Spice toolkit directly may be
+     *  used, since these calls are serialized by spice_interface::getSpiceMutex (they are then not executed in parallel).
+     *  \param numberOfThreads Number of threads used to compute observations and partials
+     */
+    void setNumberOfThreads( const int numberOfThreads )
+    {
+        if( numberOfThreads < 1 )
+        {
+            throw std::runtime_error( "Error when setting number of threads of orbit determination, number must be at least 1" );
+        }
+        numberOfThreads_ = numberOfThreads;
+    }
+
+    //! Function to retrieve the number of threads used to compute observations and partials during the estimation
+    /*!
+     *  Function to retrieve the number of threads used to compute observations and partials during the estimation
+     *  \return Number of threads used to compute observations and partials during the estimation
+     */
+    int getNumberOfThreads( )
+    {
+        return numberOfThreads_;
+    }
+
     //! Function to retrieve the current paramater estimate.
     /*!
      *  Function to retrieve the current paramater estimate.
@@ -730,6 +1185,301 @@ public:
 
 protected:
 
+    //! Data structure defining a single block of observations (subsequent observations of single observable type and set
+    //! of link ends)
+    struct ObservationBlock
+    {
+        //! Iterator to observable type of block in PodInputType
+        typename PodInputType::const_iterator observablesIterator;
+
+        //! Iterator to link ends and data of block in SingleObservablePodInputType
+        typename SingleObservablePodInputType::const_iterator dataIterator;
+
+        //! Index of first observation of block in vector of all observations
+        int startIndex;
+
+        //! Index of first observation of block in vector of observations of its observable type and link ends
+        int startIndexInLinkEnds;
+
+        //! Number of observations in block
+        int numberOfObservations;
+
+        //! Index of first observation time of block in vector of observation times of its observable type and link ends
+        int timeStartIndex;
+
+        //! Number of observation times in block
+        int numberOfTimes;
+
+        //! Index of time interval (between time update epochs) in which the observations of the block lie
+        int timeIntervalIndex;
+    };
+
+    //! Function to retrieve the list of all blocks of observations, in the order of iteration over the observation data
+    /*!
+     *  Function to retrieve the list of all blocks of observations (one per observable type and set of link ends), in the order
+     *  of iteration over the observation data.
+     *  \param observationsAndTimes Observable values and associated time tags, per observable type and set of link ends.
+     *  \param skipEmptyBlocks Boolean denoting whether blocks without observations are to be omitted from the list
+     *  \return List of all blocks of observations
+     */
+    std::vector< ObservationBlock > getObservationBlocks( const PodInputType& observationsAndTimes,
+                                                          const bool skipEmptyBlocks = false )
+    {
+        std::vector< ObservationBlock > observationBlocks;
+        int startIndex = 0;
+        for( typename PodInputType::const_iterator observablesIterator = observationsAndTimes.begin( );
+             observablesIterator != observationsAndTimes.end( ); observablesIterator++ )
+        {
+            for( typename SingleObservablePodInputType::const_iterator dataIterator = observablesIterator->second.begin( );
+                 dataIterator != observablesIterator->second.end( ); dataIterator++  )
+            {
+                if( !skipEmptyBlocks || dataIterator->second.first.size( ) > 0 )
+                {
+                    ObservationBlock currentBlock;
+                    currentBlock.observablesIterator = observablesIterator;
+                    currentBlock.dataIterator = dataIterator;
+                    currentBlock.startIndex = startIndex;
+                    currentBlock.startIndexInLinkEnds = 0;
+                    currentBlock.numberOfObservations = dataIterator->second.first.size( );
+                    currentBlock.timeStartIndex = 0;
+                    currentBlock.numberOfTimes = dataIterator->second.second.first.size( );
+                    currentBlock.timeIntervalIndex = 0;
+                    observationBlocks.push_back( currentBlock );
+                }
+                startIndex += dataIterator->second.first.size( );
+            }
+        }
+        return observationBlocks;
+    }
+
+    //! Function to retrieve the list of all (non-empty) blocks of observations, sorted by time interval
+    /*!
+     *  Function to retrieve the list of all (non-empty) blocks of observations, sorted by the time intervals between
+     *  consecutive time update epochs. The observations of each observable type and set of link ends are split into blocks of
+     *  subsequent observations in the same time interval, where the time interval index of an observation is the number of
+     *  time update epochs that are smaller than or equal to its time. The blocks are then sorted by time interval index (with
+     *  the order of getObservationBlocks retained within a time interval).
+     *  \param observationsAndTimes Observable values and associated time tags, per observable type and set of link ends.
+     *  \param timeUpdateEpochs Epochs at which a time update is applied, in increasing order.
+     *  \return List of all blocks of observations, sorted by time interval
+     */
+    std::vector< ObservationBlock > getTimeOrderedObservationBlocks( const PodInputType& observationsAndTimes,
+                                                                     const std::vector< double >& timeUpdateEpochs )
+    {
+        std::vector< ObservationBlock > linkEndsObservationBlocks = getObservationBlocks( observationsAndTimes, true );
+        if( timeUpdateEpochs.size( ) == 0 )
+        {
+            return linkEndsObservationBlocks;
+        }
+
+        std::vector< ObservationBlock > observationBlocks;
+        for( const ObservationBlock& linkEndsBlock : linkEndsObservationBlocks )
+        {
+            const std::vector< TimeType >& observationTimes = linkEndsBlock.dataIterator->second.second.first;
+            int numberOfTimes = observationTimes.size( );
+            int observableSize = linkEndsBlock.numberOfObservations / numberOfTimes;
+
+            // Split observations into blocks of subsequent observations in same time interval
+            int currentTimeStartIndex = 0;
+            int currentTimeIntervalIndex = 0;
+            for( int i = 0; i <= numberOfTimes; i++ )
+            {
+                int timeIntervalIndex = -1;
+                if( i < numberOfTimes )
+                {
+                    timeIntervalIndex = std::distance(
+                                timeUpdateEpochs.begin( ), std::upper_bound(
+                                    timeUpdateEpochs.begin( ), timeUpdateEpochs.end( ),
+                                    static_cast< double >( observationTimes.at( i ) ) ) );
+                }
+
+                if( i == 0 )
+                {
+                    currentTimeIntervalIndex = timeIntervalIndex;
+                }
+                else if( timeIntervalIndex != currentTimeIntervalIndex )
+                {
+                    ObservationBlock currentBlock = linkEndsBlock;
+                    currentBlock.timeStartIndex = currentTimeStartIndex;
+                    currentBlock.numberOfTimes = i - currentTimeStartIndex;
+                    currentBlock.startIndexInLinkEnds = currentTimeStartIndex * observableSize;
+                    currentBlock.startIndex = linkEndsBlock.startIndex + currentBlock.startIndexInLinkEnds;
+                    currentBlock.numberOfObservations = currentBlock.numberOfTimes * observableSize;
+                    currentBlock.timeIntervalIndex = currentTimeIntervalIndex;
+                    observationBlocks.push_back( currentBlock );
+
+                    currentTimeStartIndex = i;
+                    currentTimeIntervalIndex = timeIntervalIndex;
+                }
+            }
+        }
+
+        std::stable_sort( observationBlocks.begin( ), observationBlocks.end( ),
+                          [ ]( const ObservationBlock& firstBlock, const ObservationBlock& secondBlock )
+        {
+            return firstBlock.timeIntervalIndex < secondBlock.timeIntervalIndex;
+        } );
+        return observationBlocks;
+    }
+
+    //! Function to compute the observations and partials of a single block of observations
+    /*!
+     *  Function to compute the observations and partials of a single block of observations, from current parameter estimate
+     *  \param observationBlock Block of observations for which observations and partials are to be computed.
+     *  \return Pair of observable values and partial matrix
+     */
+    std::pair< ObservationVectorType, Eigen::MatrixXd > computeObservationBlock( const ObservationBlock& observationBlock )
+    {
+        const std::vector< TimeType >& observationTimes = observationBlock.dataIterator->second.second.first;
+        if( observationBlock.numberOfTimes == static_cast< int >( observationTimes.size( ) ) )
+        {
+            return observationManagers_.at( observationBlock.observablesIterator->first )->computeObservationsWithPartials(
+                        observationTimes, observationBlock.dataIterator->first,
+                        observationBlock.dataIterator->second.second.second );
+        }
+        else
+        {
+            return observationManagers_.at( observationBlock.observablesIterator->first )->computeObservationsWithPartials(
+                        std::vector< TimeType >(
+                            observationTimes.begin( ) + observationBlock.timeStartIndex,
+                            observationTimes.begin( ) + observationBlock.timeStartIndex + observationBlock.numberOfTimes ),
+                        observationBlock.dataIterator->first, observationBlock.dataIterator->second.second.second );
+        }
+    }
+
+    //! Function to calculate the residuals and partials of a list of blocks of observations, and process the partials per block
+    /*!
+     *  Function to calculate the residuals and partials of a list of blocks of observations, based on the state transition
+     *  matrix, sensitivity matrix and body states resulting from the previous numerical integration iteration. The partials of
+     *  each block are provided to the processBlock function (e.g. to add them to the normal equations), after which they are
+     *  discarded, so that the full partials matrix is never stored. In addition, the entries of the partials that are
+     *  required for the column normalization (see normalizeObservationMatrix) are determined during the processing.
+     *  If more than one thread has been set by setNumberOfThreads, batches of (at most) that number of blocks are computed
+     *  concurrently, after which they are processed in the order of observationBlocks, so that the result is identical to
+     *  that of a serial computation.
+     *  \param observationsAndTimes Observable values and associated time tags, per observable type and set of link ends.
+     *  \param observationBlocks List of (non-empty) blocks of observations, in the order in which they are to be processed
+     *  \param parameterVectorSize Length of the vector of estimated parameters
+     *  \param totalObservationSize Total number of observations in observationsAndTimes map.
+     *  \param residuals Residuals of computed w.r.t. input observable values (return by reference).
+     *  \param processBlock Function processing the partials of a single block of observations, called for each block in
+     *  order, after the residuals of the block have been set.
+     *  \return Vector with scaling values to be used for normalization, equal to the values that normalizeObservationMatrix
+     *  would compute from the full partials matrix.
+     */
+    Eigen::VectorXd processObservationBlocks(
+            const PodInputType& observationsAndTimes, const std::vector< ObservationBlock >& observationBlocks,
+            const int parameterVectorSize, const int totalObservationSize, Eigen::VectorXd& residuals,
+            const std::function< void( const ObservationBlock&, const Eigen::MatrixXd& ) >& processBlock )
+    {
+        // Initialize return data.
+        residuals = Eigen::VectorXd::Zero( totalObservationSize );
+
+        // Initialize extreme values of columns of partials matrix
+        Eigen::VectorXd minimumPartials = Eigen::VectorXd::Zero( parameterVectorSize );
+        Eigen::VectorXd maximumPartials = Eigen::VectorXd::Zero( parameterVectorSize );
+        bool isFirstBlock = true;
+
+        // Process blocks in batches, limiting the number of partials blocks that is stored simultaneously
+        int numberOfBlocks = observationBlocks.size( );
+        int batchSize = std::max( numberOfThreads_, 1 );
+        std::vector< Eigen::MatrixXd > batchPartials( batchSize );
+        for( int batchStartIndex = 0; batchStartIndex < numberOfBlocks; batchStartIndex += batchSize )
+        {
+            int currentBatchSize = std::min( batchSize, numberOfBlocks - batchStartIndex );
+
+            // Compute observations and partials of current batch
+            utilities::executeParallelLoop(
+                        currentBatchSize, numberOfThreads_, [ & ]( const int indexInBatch )
+            {
+                const ObservationBlock& currentBlock = observationBlocks.at( batchStartIndex + indexInBatch );
+                int currentNumberOfObservations = currentBlock.numberOfObservations;
+
+                // Compute estimated observations and partials from current parameter estimate.
+                std::pair< ObservationVectorType, Eigen::MatrixXd > observationsWithPartials =
+                        computeObservationBlock( currentBlock );
+
+                // Compute residuals for current link ends and observabel type.
+                residuals.segment( currentBlock.startIndex, currentNumberOfObservations ) =
+                        ( currentBlock.dataIterator->second.first.segment(
+                              currentBlock.startIndexInLinkEnds, currentNumberOfObservations ) -
+                          observationsWithPartials.first ).template cast< double >( );
+                batchPartials[ indexInBatch ] = std::move( observationsWithPartials.second );
+            } );
+
+            // Process blocks of current batch, in fixed order
+            for( int indexInBatch = 0; indexInBatch < currentBatchSize; indexInBatch++ )
+            {
+                const ObservationBlock& currentBlock = observationBlocks.at( batchStartIndex + indexInBatch );
+                const Eigen::MatrixXd& currentPartials = batchPartials[ indexInBatch ];
+
+                // Update extreme values of partials, used for normalization
+                if( isFirstBlock )
+                {
+                    minimumPartials = currentPartials.colwise( ).minCoeff( ).transpose( );
+                    maximumPartials = currentPartials.colwise( ).maxCoeff( ).transpose( );
+                    isFirstBlock = false;
+                }
+                else
+                {
+                    minimumPartials = minimumPartials.cwiseMin( currentPartials.colwise( ).minCoeff( ).transpose( ) );
+                    maximumPartials = maximumPartials.cwiseMax( currentPartials.colwise( ).maxCoeff( ).transpose( ) );
+                }
+
+                processBlock( currentBlock, currentPartials );
+                batchPartials[ indexInBatch ].resize( 0, 0 );
+            }
+        }
+
+        checkResidualDiscontinuities( observationsAndTimes, residuals );
+
+        // Compute normalization terms in the same manner as normalizeObservationMatrix
+        Eigen::VectorXd normalizationTerms = Eigen::VectorXd( parameterVectorSize );
+        for( int i = 0; i < parameterVectorSize; i++ )
+        {
+            if( std::fabs( minimumPartials( i ) ) > maximumPartials( i ) )
+            {
+                normalizationTerms( i ) = minimumPartials( i );
+            }
+            else
+            {
+                normalizationTerms( i ) = maximumPartials( i );
+            }
+            if( normalizationTerms( i ) == 0.0 )
+            {
+                normalizationTerms( i ) = 1.0;
+            }
+        }
+
+        return normalizationTerms;
+    }
+
+    //! Function to check the residuals of each observable type for discontinuities
+    /*!
+     *  Function to check the residuals of each observable type for discontinuities (see
+     *  observation_models::checkObservationResidualDiscontinuities)
+     *  \param observationsAndTimes Observable values and associated time tags, per observable type and set of link ends.
+     *  \param residuals Residuals of all observations, in the order of iteration over observationsAndTimes
+     */
+    void checkResidualDiscontinuities( const PodInputType& observationsAndTimes, Eigen::VectorXd& residuals )
+    {
+        int startIndex = 0;
+        for( typename PodInputType::const_iterator observablesIterator = observationsAndTimes.begin( );
+             observablesIterator != observationsAndTimes.end( ); observablesIterator++ )
+        {
+            int currentObservableSize = 0;
+            for( typename SingleObservablePodInputType::const_iterator dataIterator = observablesIterator->second.begin( );
+                 dataIterator != observablesIterator->second.end( ); dataIterator++  )
+            {
+                currentObservableSize += dataIterator->second.first.size( );
+            }
+
+            observation_models::checkObservationResidualDiscontinuities(
+                        residuals.block( startIndex, 0, currentObservableSize, 1 ), observablesIterator->first );
+            startIndex += currentObservableSize;
+        }
+    }
+
     //! Function called by either constructor to initialize the object.
     /*!
      *  Function called by either constructor to initialize the object.
@@ -855,6 +1605,9 @@ protected:
     std::shared_ptr< propagators::CombinedStateTransitionAndSensitivityMatrixInterface >
     stateTransitionAndSensitivityMatrixInterface_;
 
+    //! Number of threads used to compute observations and partials during the estimation
+    int numberOfThreads_;
+
 };
 
 extern template class OrbitDeterminationManager< double, double >;
@@ -23,24 +23,32 @@ template std::pair< std::shared_ptr< PodOutput< double > >, Eigen::VectorXd > ex
         const int observableType,
         Eigen::VectorXd parameterPerturbation,
         Eigen::MatrixXd inverseAPrioriCovariance,
-        const double weight );
+        const double weight,
+        const bool saveInformationMatrix,
+        const int numberOfThreads );
 
 #if( BUILD_EXTENDED_PRECISION_PROPAGATION_TOOLS )
 template std::pair< std::shared_ptr< PodOutput< long double > >, Eigen::VectorXd > executePlanetaryParameterEstimation< double, long double >(
         const int observableType,
         Eigen::VectorXd parameterPerturbation,
         Eigen::MatrixXd inverseAPrioriCovariance,
-        const double weight );
+        const double weight,
+        const bool saveInformationMatrix,
+        const int numberOfThreads );
 template std::pair< std::shared_ptr< PodOutput< double, Time > >, Eigen::VectorXd > executePlanetaryParameterEstimation< Time, double >(
         const int observableType ,
         Eigen::VectorXd parameterPerturbation,
         Eigen::MatrixXd inverseAPrioriCovariance,
-        const double weight );
+        const double weight,
+        const bool saveInformationMatrix,
+        const int numberOfThreads );
 template std::pair< std::shared_ptr< PodOutput< long double, Time > >, Eigen::VectorXd > executePlanetaryParameterEstimation< Time, long double >(
         const int observableType,
         Eigen::VectorXd parameterPerturbation,
         Eigen::MatrixXd inverseAPrioriCovariance,
-        const double weight );
+        const double weight,
+        const bool saveInformationMatrix,
+        const int numberOfThreads );
 #endif
 
 template Eigen::VectorXd executeEarthOrbiterParameterEstimation< double, double >(
@@ -56,7 +64,12 @@ template std::pair< Eigen::VectorXd, bool > executeEarthOrbiterBiasEstimation< d
         const bool useSingleBiasModel,
         const bool estimateAbsoluteBiases,
         const bool omitRangeData,
-        const bool useMultiArcBiases );
+        const bool useMultiArcBiases,
+        const bool useHouseholderLeastSquares,
+        const std::map< EstimatebleParametersEnum, std::shared_ptr< ArcWiseProcessNoiseSettings > >& arcWiseProcessNoiseSettings,
+        std::shared_ptr< PodOutput< double > >* podOutputToReturn,
+        const std::vector< double >& timeUpdateEpochs,
+        const std::function< void( const double, linear_algebra::HouseholderLeastSquaresSolver& ) >& timeUpdateFunction );
 ;
 
 }
@@ -46,7 +46,9 @@ std::pair< std::shared_ptr< PodOutput< StateScalarType, TimeType > >, Eigen::Vec
         const int observableType = 1,
         Eigen::VectorXd parameterPerturbation = getDefaultInitialParameterPerturbation( ),
         Eigen::MatrixXd inverseAPrioriCovariance  = Eigen::MatrixXd::Zero( 7, 7 ),
-        const double weight = 1.0 )
+        const double weight = 1.0,
+        const bool saveInformationMatrix = false,
+        const int numberOfThreads = 1 )
 {
     //Load spice kernels.
     spice_interface::loadStandardSpiceKernels( );
@@ -193,7 +195,7 @@ std::pair< std::shared_ptr< PodOutput< StateScalarType, TimeType > >, Eigen::Vec
             OrbitDeterminationManager< StateScalarType, TimeType >(
                 bodyMap, parametersToEstimate, observationSettingsMap,
                 integratorSettings, propagatorSettings );
-
+    orbitDeterminationManager.setNumberOfThreads( numberOfThreads );
 
     // Define observation times.
     double observationTimeStep = 1000.0;
@@ -288,7 +290,7 @@ std::pair< std::shared_ptr< PodOutput< StateScalarType, TimeType > >, Eigen::Vec
     {
         podInput->setConstantWeightsMatrix( weight );
     }
-    podInput->defineEstimationSettings( true, true, false, false, false );
+    podInput->defineEstimationSettings( true, true, saveInformationMatrix, false, false );
 
     // Perform estimation
     std::shared_ptr< PodOutput< StateScalarType, TimeType > > podOutput = orbitDeterminationManager.estimateParameters(
@@ -304,24 +306,32 @@ extern template std::pair< std::shared_ptr< PodOutput< double > >, Eigen::Vector
         const int observableType,
         Eigen::VectorXd parameterPerturbation,
         Eigen::MatrixXd inverseAPrioriCovariance,
-        const double weight );
+        const double weight,
+        const bool saveInformationMatrix,
+        const int numberOfThreads );
 
 #if( BUILD_EXTENDED_PRECISION_PROPAGATION_TOOLS )
 extern template std::pair< std::shared_ptr< PodOutput< long double > >, Eigen::VectorXd > executePlanetaryParameterEstimation< double, long double >(
         const int observableType,
         Eigen::VectorXd parameterPerturbation,
         Eigen::MatrixXd inverseAPrioriCovariance,
-        const double weight );
+        const double weight,
+        const bool saveInformationMatrix,
+        const int numberOfThreads );
 extern template std::pair< std::shared_ptr< PodOutput< double, Time > >, Eigen::VectorXd > executePlanetaryParameterEstimation< Time, double >(
         const int observableType ,
         Eigen::VectorXd parameterPerturbation,
         Eigen::MatrixXd inverseAPrioriCovariance,
-        const double weight );
+        const double weight,
+        const bool saveInformationMatrix,
+        const int numberOfThreads );
 extern template std::pair< std::shared_ptr< PodOutput< long double, Time > >, Eigen::VectorXd > executePlanetaryParameterEstimation< Time, long double >(
         const int observableType,
         Eigen::VectorXd parameterPerturbation,
         Eigen::MatrixXd inverseAPrioriCovariance,
-        const double weight );
+        const double weight,
+        const bool saveInformationMatrix,
+        const int numberOfThreads );
 #endif
 
 
@@ -664,7 +674,14 @@ std::pair< Eigen::VectorXd, bool > executeEarthOrbiterBiasEstimation(
         const bool useSingleBiasModel = true,
         const bool estimateAbsoluteBiases = true,
         const bool omitRangeData = false,
-        const bool useMultiArcBiases = false )
+        const bool useMultiArcBiases = false,
+        const bool useHouseholderLeastSquares = false,
+        const std::map< EstimatebleParametersEnum, std::shared_ptr< ArcWiseProcessNoiseSettings > >& arcWiseProcessNoiseSettings =
+        std::map< EstimatebleParametersEnum, std::shared_ptr< ArcWiseProcessNoiseSettings > >( ),
+        std::shared_ptr< PodOutput< StateScalarType > >* podOutputToReturn = nullptr,
+        const std::vector< double >& timeUpdateEpochs = std::vector< double >( ),
+        const std::function< void( const double, linear_algebra::HouseholderLeastSquaresSolver& ) >& timeUpdateFunction =
+        std::function< void( const double, linear_algebra::HouseholderLeastSquaresSolver& ) >( ) )
 {
 
     const int numberOfDaysOfData = 1;
@@ -1088,10 +1105,16 @@ std::pair< Eigen::VectorXd, bool > executeEarthOrbiterBiasEstimation(
 
     podInput->setConstantPerObservableWeightsMatrix( weightPerObservable );
     podInput->defineEstimationSettings( true, false, false, true, false );
+    podInput->defineHouseholderLeastSquaresSettings(
+                useHouseholderLeastSquares, arcWiseProcessNoiseSettings, timeUpdateEpochs, timeUpdateFunction );
 
     // Perform estimation
     std::shared_ptr< PodOutput< StateScalarType > > podOutput = orbitDeterminationManager.estimateParameters(
                 podInput, std::make_shared< EstimationConvergenceChecker >( numberOfIterations ) );
+    if( podOutputToReturn != nullptr )
+    {
+        *podOutputToReturn = podOutput;
+    }
 
     Eigen::VectorXd estimationError = podOutput->parameterEstimate_ - truthParameters;
     std::cout <<"Estimation error: "<< ( estimationError ).transpose( ) << std::endl<< std::endl;
@@ -1107,7 +1130,12 @@ extern template std::pair< Eigen::VectorXd, bool > executeEarthOrbiterBiasEstima
         const bool useSingleBiasModel,
         const bool estimateAbsoluteBiases,
         const bool omitRangeData,
-        const bool useMultiArcBiases );
+        const bool useMultiArcBiases,
+        const bool useHouseholderLeastSquares,
+        const std::map< EstimatebleParametersEnum, std::shared_ptr< ArcWiseProcessNoiseSettings > >& arcWiseProcessNoiseSettings,
+        std::shared_ptr< PodOutput< double > >* podOutputToReturn,
+        const std::vector< double >& timeUpdateEpochs,
+        const std::function< void( const double, linear_algebra::HouseholderLeastSquaresSolver& ) >& timeUpdateFunction );
 
 }
 
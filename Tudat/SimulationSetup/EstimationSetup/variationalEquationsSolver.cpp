@@ -8,6 +8,7 @@
  *    http://tudat.tudelft.nl/LICENSE.
  */
 
+#include "Tudat/Mathematics/Interpolators/matrixHistoryLagrangeInterpolator.h"
 #include "Tudat/SimulationSetup/EstimationSetup/variationalEquationsSolver.h"
 
 namespace tudat
@@ -40,9 +41,7 @@ void createStateTransitionAndSensitivityMatrixInterpolator(
 {
     // Create interpolator for state transition matrix.
     stateTransitionMatrixInterpolator=
-            std::make_shared< interpolators::LagrangeInterpolator< double, Eigen::MatrixXd > >(
-                utilities::createVectorFromMapKeys< Eigen::MatrixXd, double >( variationalEquationsSolution[ 0 ] ),
-                utilities::createVectorFromMapValues< Eigen::MatrixXd, double >( variationalEquationsSolution[ 0 ] ), 4 );
+            std::make_shared< interpolators::MatrixHistoryLagrangeInterpolator >( variationalEquationsSolution[ 0 ], 4 );
     if( clearRawSolution )
     {
         variationalEquationsSolution[ 0 ].clear( );
@@ -53,9 +52,7 @@ void createStateTransitionAndSensitivityMatrixInterpolator(
 
     // Create interpolator for sensitivity matrix.
     sensitivityMatrixInterpolator =
-            std::make_shared< interpolators::LagrangeInterpolator< double, Eigen::MatrixXd > >(
-                utilities::createVectorFromMapKeys< Eigen::MatrixXd, double >( variationalEquationsSolution[ 1 ] ),
-                utilities::createVectorFromMapValues< Eigen::MatrixXd, double >( variationalEquationsSolution[ 1 ] ), 4 );
+            std::make_shared< interpolators::MatrixHistoryLagrangeInterpolator >( variationalEquationsSolution[ 1 ], 4 );
 
     //std::cout<<"State trans "<<stateTransitionMatrixInterpolator->interpolate( 20000.0 )<<std::endl;
 
@@ -16,6 +16,7 @@
 #include <boost/tuple/tuple_comparison.hpp>
 #include <boost/tuple/tuple_io.hpp>
 
+#include "Tudat/Basics/parallelization.h"
 #include "Tudat/Basics/utilities.h"
 
 #include "Tudat/Astrodynamics/BasicAstrodynamics/accelerationModel.h"
@@ -1081,19 +1082,13 @@ public:
 
         for( unsigned int i = 0; i < singleArcDynamicsSimulators.size( ); i++ )
         {
-            dynamicsStateDerivatives_.push_back( singleArcDynamicsSimulators.at( i )->getDynamicsStateDerivative( ) );
-            // Create variational equations objects.
-            std::map< IntegratedStateType, orbit_determination::StateDerivativePartialsMap > stateDerivativePartials =
-                    simulation_setup::createStateDerivativePartials< StateScalarType, TimeType >(
-                        dynamicsStateDerivatives_.at( i )->getStateDerivativeModels( ), bodyMap, parametersToEstimate );
-            std::shared_ptr< VariationalEquations > variationalEquationsObject_ =
-                    std::make_shared< VariationalEquations >(
-                        stateDerivativePartials, parametersToEstimate_, dynamicsStateDerivatives_.at( i )->getStateTypeStartIndices( ) );
-
-            dynamicsStateDerivatives_.at( i )->addVariationalEquations( variationalEquationsObject_ );
             arcStartTimes_.push_back( arcStartTimes.at( i ) );
         }
 
+        // Create variational equations objects.
+        arcParametersToEstimate_.push_back( parametersToEstimate );
+        createArcVariationalEquations( );
+
         numberOfArcs_ = dynamicsStateDerivatives_.size( );
         // Resize solution of variational equations to 2 (state transition and sensitivity matrices)
         variationalEquationsSolution_.resize( numberOfArcs_ );
@@ -1137,6 +1132,7 @@ public:
             dynamicsStateDerivatives_.at( i )->setPropagationSettings( std::vector< IntegratedStateType >( ), 1, 0 );
         }
 
+        synchronizeArcPropagationParameters( );
         dynamicsSimulator_->integrateEquationsOfMotion( initialStateEstimate );
     }
 
@@ -1155,6 +1151,7 @@ public:
             dynamicsStateDerivatives_.at( i )->setPropagationSettings( std::vector< IntegratedStateType >( ), 1, 0 );
         }
 
+        synchronizeArcPropagationParameters( );
         dynamicsSimulator_->integrateEquationsOfMotion( initialStateEstimate );
     }
 
@@ -1222,8 +1219,6 @@ public:
         if( integrateEquationsConcurrently )
         {
             // Allocate maps that stored numerical solution for equations of motion
-            std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >
-                    currentEquationsOfMotionNumericalSolutionsRaw;
             std::vector< std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > >
                     equationsOfMotionNumericalSolutions;
             std::vector< std::map< TimeType, Eigen::Matrix< double, Eigen::Dynamic, 1 > > >
@@ -1235,77 +1230,47 @@ public:
             dependentVariableHistorySolutions.resize( numberOfArcs_ );
             cumulativeComputationTimeHistorySolutions.resize( numberOfArcs_ );
 
-            // Integrate equations for all arcs.
-            for( int i = 0; i < numberOfArcs_; i++ )
+            // Integrate equations for all arcs, concurrently if possible.
+            synchronizeArcPropagationParameters( );
+            int numberOfEnvironments = dynamicsSimulator_->getNumberOfArcPropagationEnvironments( );
+            if( ( numberOfEnvironments > 1 ) && areArcInitialStatesIndependent( initialStateEstimate ) )
             {
-                // Retrieve integrator settings, and ensure correct initial time.
-                std::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > integratorSettings =
-                        singleArcDynamicsSimulators.at( i )->getIntegratorSettings( );
-                integratorSettings->initialTime_ = arcStartTimes_.at( i );
-
-                // Set state derivative model to propagate both variational equations and equations of motion
-                singleArcDynamicsSimulators.at( i )->getDynamicsStateDerivative( )->setPropagationSettings(
-                            std::vector< IntegratedStateType >( ), 1, 1 );
-
-
-                // Get arc initial state. If initial state is NaN, this signals that the initial state is to be taken from
-                // previous arc
-                VectorType currentArcInitialState;
-
-                if( ( i == 0 ) || ( !linear_algebra::doesMatrixHaveNanEntries( initialStateEstimate.at( i ) ) ) )
+                arcInitialStates = initialStateEstimate;
+                utilities::executeParallelLoop(
+                            numberOfEnvironments, numberOfEnvironments, [ & ]( const int environmentIndex )
                 {
-                    currentArcInitialState = initialStateEstimate.at( i );
-                }
-                else
+                    for( int i = environmentIndex; i < numberOfArcs_; i += numberOfEnvironments )
+                    {
+                        integrateArcVariationalAndDynamicalEquations(
+                                    i, arcInitialStates.at( i ), equationsOfMotionNumericalSolutions[ i ],
+                                    dependentVariableHistorySolutions[ i ], cumulativeComputationTimeHistorySolutions[ i ] );
+                    }
+                } );
+            }
+            else
+            {
+                for( int i = 0; i < numberOfArcs_; i++ )
                 {
-                    currentArcInitialState = getArcInitialStateFromPreviousArcResult(
-                                equationsOfMotionNumericalSolutions.at( i - 1 ), arcStartTimes_.at( i ) );
-                    updateInitialStates = true;
-                }
-                arcInitialStates.push_back( currentArcInitialState );
-
-                // Update state derivative model to (possible) update in state.
-                singleArcDynamicsSimulators.at( i )->getDynamicsStateDerivative( )->
-                        template updateStateDerivativeModelSettings( currentArcInitialState );
-
-                // Create initial state for combined variational/equations of motion.
-                MatrixType initialVariationalState = this->createInitialConditions(
-                            currentArcInitialState );
-
-
-                // Integrate variational and state equations.
-                dynamicsSimulator_->getDynamicsStateDerivative( ).at( i )->resetFunctionEvaluationCounter( );
-                std::map< TimeType, MatrixType > rawNumericalSolution;
-                EquationIntegrationInterface< MatrixType, TimeType >::integrateEquations(
-                            singleArcDynamicsSimulators.at( i )->getStateDerivativeFunction( ),
-                            rawNumericalSolution,
-                            initialVariationalState, integratorSettings,
-                            singleArcDynamicsSimulators.at( i )->getPropagationTerminationCondition( ),
-                            dependentVariableHistorySolutions.at( i ),
-                            cumulativeComputationTimeHistorySolutions.at( i ),
-                            singleArcDynamicsSimulators.at( i )->getDependentVariablesFunctions( ),
-                            std::bind(
-                                &DynamicsStateDerivativeModel< TimeType, StateScalarType >::postProcessStateAndVariationalEquations,
-                                singleArcDynamicsSimulators.at( i )->getDynamicsStateDerivative( ), std::placeholders::_1 ) );
-
-                // Extract solution of equations of motion.
-                utilities::createVectorBlockMatrixHistory(
-                            rawNumericalSolution, currentEquationsOfMotionNumericalSolutionsRaw,
-                            std::make_pair( 0, parameterVectorSize_ ), stateTransitionMatrixSize_ );
-
+                    // Get arc initial state. If initial state is NaN, this signals that the initial state is to be taken from
+                    // previous arc
+                    VectorType currentArcInitialState;
 
-                // Transform equations of motion solution to output formulation
-                convertNumericalStateSolutionsToOutputSolutions(
-                            equationsOfMotionNumericalSolutions[ i ], currentEquationsOfMotionNumericalSolutionsRaw,
-                            dynamicsStateDerivatives_.at( i ) );
-                arcStartTimes_[ i ] = equationsOfMotionNumericalSolutions[ i ].begin( )->first;
-
-                // Save state transition and sensitivity matrix solutions for current arc.
-                setVariationalEquationsSolution(
-                            rawNumericalSolution, variationalEquationsSolution_[ i ],
-                            std::make_pair( 0, 0 ), std::make_pair( 0, stateTransitionMatrixSize_ ),
-                            stateTransitionMatrixSize_, parameterVectorSize_ );
+                    if( ( i == 0 ) || ( !linear_algebra::doesMatrixHaveNanEntries( initialStateEstimate.at( i ) ) ) )
+                    {
+                        currentArcInitialState = initialStateEstimate.at( i );
+                    }
+                    else
+                    {
+                        currentArcInitialState = getArcInitialStateFromPreviousArcResult(
+                                    equationsOfMotionNumericalSolutions.at( i - 1 ), arcStartTimes_.at( i ) );
+                        updateInitialStates = true;
+                    }
+                    arcInitialStates.push_back( currentArcInitialState );
 
+                    integrateArcVariationalAndDynamicalEquations(
+                                i, currentArcInitialState, equationsOfMotionNumericalSolutions[ i ],
+                                dependentVariableHistorySolutions[ i ], cumulativeComputationTimeHistorySolutions[ i ] );
+                }
             }
 
             // Process numerical solution of equations of motion
@@ -1395,6 +1360,51 @@ public:
 
     }
 
+    //! Function to set the environments in which the arcs are to be propagated concurrently
+    /*!
+     *  Function to set the environments in which the arcs are to be propagated concurrently (see
+     *  MultiArcDynamicsSimulator::setArcPropagationEnvironments). For each additional environment, a set of estimated
+     *  parameters must be provided, which is created from the same settings as parametersToEstimate_, but for the
+     *  associated body map. These are used to create the variational equations of the arcs propagated in that
+     *  environment. Before each propagation, the values of these parameters are set to those in parametersToEstimate_.
+     *  The state transition and sensitivity matrix interface is populated from the results of all arcs, in order, after
+     *  all arcs have been propagated.
+     *  \param additionalBodyMaps Body maps, in addition to bodyMap_, in which arcs are to be propagated.
+     *  \param additionalPropagatorSettings Multi-arc propagator settings, created for each of the additionalBodyMaps
+     *  \param additionalParametersToEstimate Sets of estimated parameters, created for each of the additionalBodyMaps
+     */
+    void setArcPropagationEnvironments(
+            const std::vector< simulation_setup::NamedBodyMap >& additionalBodyMaps,
+            const std::vector< std::shared_ptr< PropagatorSettings< StateScalarType > > >& additionalPropagatorSettings,
+            const std::vector< std::shared_ptr< estimatable_parameters::EstimatableParameterSet< StateScalarType > > >&
+            additionalParametersToEstimate )
+    {
+        if( additionalBodyMaps.size( ) != additionalParametersToEstimate.size( ) )
+        {
+            throw std::runtime_error( "Error when setting multi-arc propagation environments, number of body maps (" +
+                                      std::to_string( additionalBodyMaps.size( ) ) + ") and parameter sets (" +
+                                      std::to_string( additionalParametersToEstimate.size( ) ) + ") are inconsistent." );
+        }
+
+        for( unsigned int i = 0; i < additionalParametersToEstimate.size( ); i++ )
+        {
+            if( additionalParametersToEstimate.at( i )->getParameterSetSize( ) != parametersToEstimate_->getParameterSetSize( ) )
+            {
+                throw std::runtime_error( "Error when setting multi-arc propagation environments, size of parameter set " +
+                                          std::to_string( i ) + " is inconsistent." );
+            }
+        }
+
+        // Recreate arc dynamics and variational equations in new environments.
+        dynamicsSimulator_->setArcPropagationEnvironments( additionalBodyMaps, additionalPropagatorSettings );
+
+        arcParametersToEstimate_.clear( );
+        arcParametersToEstimate_.push_back( parametersToEstimate_ );
+        arcParametersToEstimate_.insert( arcParametersToEstimate_.end( ), additionalParametersToEstimate.begin( ),
+                                         additionalParametersToEstimate.end( ) );
+        createArcVariationalEquations( );
+    }
+
     //! Function to return object used for numerically propagating and managing the solution of the equations of motion.
     /*!
      * Function to return object used for numerically propagating and managing the solution of the equations of motion.
@@ -1477,6 +1487,116 @@ protected:
 
 private:
 
+    //! Function to create the variational equations of each arc, and add them to the state derivative model of the arc
+    void createArcVariationalEquations( )
+    {
+        std::vector< std::shared_ptr< SingleArcDynamicsSimulator< StateScalarType, TimeType > > > singleArcDynamicsSimulators =
+                dynamicsSimulator_->getSingleArcDynamicsSimulators( );
+
+        dynamicsStateDerivatives_.clear( );
+        for( unsigned int i = 0; i < singleArcDynamicsSimulators.size( ); i++ )
+        {
+            std::shared_ptr< estimatable_parameters::EstimatableParameterSet< StateScalarType > > arcParametersToEstimate =
+                    arcParametersToEstimate_.at( i % arcParametersToEstimate_.size( ) );
+
+            dynamicsStateDerivatives_.push_back( singleArcDynamicsSimulators.at( i )->getDynamicsStateDerivative( ) );
+            // Create variational equations objects.
+            std::map< IntegratedStateType, orbit_determination::StateDerivativePartialsMap > stateDerivativePartials =
+                    simulation_setup::createStateDerivativePartials< StateScalarType, TimeType >(
+                        dynamicsStateDerivatives_.at( i )->getStateDerivativeModels( ),
+                        dynamicsSimulator_->getArcPropagationBodyMap( i ), arcParametersToEstimate );
+            std::shared_ptr< VariationalEquations > variationalEquationsObject_ =
+                    std::make_shared< VariationalEquations >(
+                        stateDerivativePartials, arcParametersToEstimate, dynamicsStateDerivatives_.at( i )->getStateTypeStartIndices( ) );
+
+            dynamicsStateDerivatives_.at( i )->addVariationalEquations( variationalEquationsObject_ );
+        }
+    }
+
+    //! Function to set the values of the parameters in the additional arc propagation environments to current estimate
+    void synchronizeArcPropagationParameters( )
+    {
+        if( arcParametersToEstimate_.size( ) > 1 )
+        {
+            Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > currentParameterValues =
+                    parametersToEstimate_->template getFullParameterValues< StateScalarType >( );
+            for( unsigned int i = 1; i < arcParametersToEstimate_.size( ); i++ )
+            {
+                arcParametersToEstimate_.at( i )->template resetParameterValues< StateScalarType >( currentParameterValues );
+            }
+        }
+    }
+
+    //! Function to integrate variational equations and equations of motion of a single arc
+    /*!
+     *  Function to integrate variational equations and equations of motion of a single arc. The variational equations
+     *  solution is stored in the variationalEquationsSolution_ entry of the arc, the dynamics solution is returned by
+     *  reference. Only the entries of the member variables associated with the given arc are modified.
+     *  \param arcIndex Index of arc that is to be propagated
+     *  \param arcInitialState Initial state of the arc
+     *  \param equationsOfMotionNumericalSolution Numerical solution of equations of motion (returned by reference)
+     *  \param dependentVariableHistory Dependent variable history of arc (returned by reference)
+     *  \param cumulativeComputationTimeHistory Cumulative computation time history of arc (returned by reference)
+     */
+    void integrateArcVariationalAndDynamicalEquations(
+            const int arcIndex, const VectorType& arcInitialState,
+            std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& equationsOfMotionNumericalSolution,
+            std::map< TimeType, Eigen::Matrix< double, Eigen::Dynamic, 1 > >& dependentVariableHistory,
+            std::map< TimeType, double >& cumulativeComputationTimeHistory )
+    {
+        std::shared_ptr< SingleArcDynamicsSimulator< StateScalarType, TimeType > > singleArcDynamicsSimulator =
+                dynamicsSimulator_->getSingleArcDynamicsSimulators( ).at( arcIndex );
+
+        // Retrieve integrator settings, and ensure correct initial time.
+        std::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > integratorSettings =
+                singleArcDynamicsSimulator->getIntegratorSettings( );
+        integratorSettings->initialTime_ = arcStartTimes_.at( arcIndex );
+
+        // Set state derivative model to propagate both variational equations and equations of motion
+        singleArcDynamicsSimulator->getDynamicsStateDerivative( )->setPropagationSettings(
+                    std::vector< IntegratedStateType >( ), 1, 1 );
+
+        // Update state derivative model to (possible) update in state.
+        singleArcDynamicsSimulator->getDynamicsStateDerivative( )->
+                template updateStateDerivativeModelSettings( arcInitialState );
+
+        // Create initial state for combined variational/equations of motion.
+        MatrixType initialVariationalState = this->createInitialConditions( arcInitialState );
+
+        // Integrate variational and state equations.
+        singleArcDynamicsSimulator->getDynamicsStateDerivative( )->resetFunctionEvaluationCounter( );
+        std::map< TimeType, MatrixType > rawNumericalSolution;
+        EquationIntegrationInterface< MatrixType, TimeType >::integrateEquations(
+                    singleArcDynamicsSimulator->getStateDerivativeFunction( ),
+                    rawNumericalSolution,
+                    initialVariationalState, integratorSettings,
+                    singleArcDynamicsSimulator->getPropagationTerminationCondition( ),
+                    dependentVariableHistory,
+                    cumulativeComputationTimeHistory,
+                    singleArcDynamicsSimulator->getDependentVariablesFunctions( ),
+                    std::bind(
+                        &DynamicsStateDerivativeModel< TimeType, StateScalarType >::postProcessStateAndVariationalEquations,
+                        singleArcDynamicsSimulator->getDynamicsStateDerivative( ), std::placeholders::_1 ) );
+
+        // Extract solution of equations of motion.
+        std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > equationsOfMotionNumericalSolutionRaw;
+        utilities::createVectorBlockMatrixHistory(
+                    rawNumericalSolution, equationsOfMotionNumericalSolutionRaw,
+                    std::make_pair( 0, parameterVectorSize_ ), stateTransitionMatrixSize_ );
+
+        // Transform equations of motion solution to output formulation
+        convertNumericalStateSolutionsToOutputSolutions(
+                    equationsOfMotionNumericalSolution, equationsOfMotionNumericalSolutionRaw,
+                    dynamicsStateDerivatives_.at( arcIndex ) );
+        arcStartTimes_[ arcIndex ] = equationsOfMotionNumericalSolution.begin( )->first;
+
+        // Save state transition and sensitivity matrix solutions for current arc.
+        setVariationalEquationsSolution(
+                    rawNumericalSolution, variationalEquationsSolution_[ arcIndex ],
+                    std::make_pair( 0, 0 ), std::make_pair( 0, stateTransitionMatrixSize_ ),
+                    stateTransitionMatrixSize_, parameterVectorSize_ );
+    }
+
     //! Reset solutions of variational equations.
     /*!
      *  Reset solutions of variational equations (stateTransitionMatrixInterpolator_ and sensitivityMatrixInterpolator_) for each
@@ -1551,6 +1671,10 @@ private:
     //! Boolean denoting whether to reset the multi-arc dynamics after propagation.
     const bool resetMultiArcDynamicsAfterPropagation_;
 
+    //! Sets of estimated parameters for each environment in which arcs are propagated (first entry is parametersToEstimate_)
+    std::vector< std::shared_ptr< estimatable_parameters::EstimatableParameterSet< StateScalarType > > >
+    arcParametersToEstimate_;
+
 };
 
 //! Class to manage and execute the numerical integration of variational equations of a dynamical system in a combination
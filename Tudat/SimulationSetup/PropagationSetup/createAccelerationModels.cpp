@@ -373,7 +373,12 @@ createSphericalHarmonicsGravityAcceleration(
                                    sphericalHarmonicsSettings->maximumOrder_ ),
                       std::bind( &Body::getPosition, bodyExertingAcceleration ),
                       std::bind( &Body::getCurrentRotationToGlobalFrame,
-                                   bodyExertingAcceleration ), useCentralBodyFixedFrame );
+                                   bodyExertingAcceleration ), useCentralBodyFixedFrame,
+                      sphericalHarmonicsGravityField->getBodyPairSphericalHarmonicsCache(
+                          nameOfBodyUndergoingAcceleration ),
+                      sphericalHarmonicsGravityField->getBodyPairAccelerationKernel(
+                          nameOfBodyUndergoingAcceleration, sphericalHarmonicsSettings->maximumDegree_,
+                          sphericalHarmonicsSettings->maximumOrder_ ) );
         }
     }
     return accelerationModel;
@@ -13,15 +13,25 @@
 
 #include <vector>
 #include <string>
+#include <algorithm>
 #include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <type_traits>
 
 #include <boost/make_shared.hpp>
 
 #include "Tudat/Basics/tudatTypeTraits.h"
 #include "Tudat/Basics/utilities.h"
+#include "Tudat/Basics/binarySerialization.h"
+#include "Tudat/Basics/profiling.h"
+#include "Tudat/Basics/stateHistory.h"
 #include "Tudat/Astrodynamics/Propagators/nBodyStateDerivative.h"
 #include "Tudat/Astrodynamics/Ephemerides/frameManager.h"
 #include "Tudat/SimulationSetup/PropagationSetup/propagationSettings.h"
+#include "Tudat/Basics/parallelization.h"
 #include "Tudat/SimulationSetup/PropagationSetup/setNumericallyIntegratedStates.h"
 #include "Tudat/Astrodynamics/Propagators/integrateEquations.h"
 #include "Tudat/SimulationSetup/PropagationSetup/createStateDerivativeModel.h"
@@ -355,6 +365,24 @@ protected:
     bool setIntegratedResult_;
 };
 
+//! Identifier at the start of a propagation checkpoint file (see SingleArcDynamicsSimulator::setCheckpointSettings).
+const char propagationCheckpointFileIdentifier[ 8 ] = { 'T', 'U', 'D', 'A', 'T', 'C', 'H', 'K' };
+
+//! Version of the format of propagation checkpoint files.
+const int propagationCheckpointFileVersion = 2;
+
+//! Function to retrieve the name of the file in which the histories of a propagation checkpoint are stored.
+/*!
+ *  Function to retrieve the name of the file in which the histories of a propagation checkpoint are stored (see
+ *  SingleArcDynamicsSimulator::setCheckpointSettings).
+ *  \param checkpointFileName Name of the checkpoint file.
+ *  \return Name of the file in which the histories of the checkpoint are stored.
+ */
+inline std::string getCheckpointHistoryFileName( const std::string& checkpointFileName )
+{
+    return checkpointFileName + ".history";
+}
+
 //! Class for performing full numerical integration of a dynamical system in a single arc.
 /*!
  *  Class for performing full numerical integration of a dynamical system in a single arc, i.e. the equations of motion
@@ -371,6 +399,9 @@ public:
     using DynamicsSimulator< StateScalarType, TimeType >::clearNumericalSolutions_;
     using DynamicsSimulator< StateScalarType, TimeType >::setIntegratedResult_;
 
+    //! Type of the time step of the numerical integrator (long double if the Time object is used as TimeType).
+    typedef typename std::conditional< std::is_same< TimeType, Time >::value, long double, TimeType >::type TimeStepType;
+
     //! Constructor of simulator.
     /*!
      *  Constructor of simulator, constructs integrator and object for calculating each time step of integration.
@@ -469,6 +500,24 @@ public:
             }
         }
 
+        // Set object in which the computation time of the components of the propagation is stored.
+        profilingData_ = std::make_shared< utilities::ProfilingData >( );
+#if( USE_PROFILING )
+        environmentUpdater_->setProfilingData( profilingData_ );
+        dynamicsStateDerivative_->setProfilingData( profilingData_ );
+        if( dependentVariablesFunctions_ != nullptr )
+        {
+            std::function< Eigen::VectorXd( ) > dependentVariablesFunctions = dependentVariablesFunctions_;
+            utilities::ProfilingEntry* dependentVariablesProfilingEntry =
+                    profilingData_->getEntry( "Dependent variables" );
+            dependentVariablesFunctions_ = [ = ]( )
+            {
+                TUDAT_PROFILE_SCOPE( dependentVariablesProfilingEntry );
+                return dependentVariablesFunctions( );
+            };
+        }
+#endif
+
         stateDerivativeFunction_ =
                 std::bind( &DynamicsStateDerivativeModel< TimeType, StateScalarType >::computeStateDerivative,
                              dynamicsStateDerivative_, std::placeholders::_1, std::placeholders::_2 );
@@ -502,52 +551,248 @@ public:
     void integrateEquationsOfMotion(
             const Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >& initialStates )
     {
+        performNumericalIntegration( initialStates, initialClockTime_ );
+    }
 
-        // Empty solution maps
-        equationsOfMotionNumericalSolution_.clear( );
-        equationsOfMotionNumericalSolutionRaw_.clear( );
+    //! Function to set the settings for storing checkpoints of the propagation, from which the propagation can be resumed.
+    /*!
+     *  Function to set the settings for storing checkpoints of the propagation (during subsequent calls to
+     *  integrateEquationsOfMotion or resumeIntegrationFromCheckpoint), from which the propagation can be resumed
+     *  using resumeIntegrationFromCheckpoint. A checkpoint consists of the internal state of the numerical integrator
+     *  (including the history of multi-step integrators and the step size), the histories of the (raw) numerical solution,
+     *  the dependent variables, the computation time and the number of function evaluations up to the current step, and
+     *  (optionally) the custom state set by setCheckpointCustomStateFunctions. The environment is not stored, as it is
+     *  updated from the current time and state at each evaluation of the state derivative.
+     *  The histories are stored incrementally: each checkpoint appends the entries added since the previous checkpoint to
+     *  a separate history file (see getCheckpointHistoryFileName). The checkpoint file itself contains only the current
+     *  state of the propagation and the size of the valid part of the history file, and is replaced by each checkpoint
+     *  (only once the new checkpoint has been written completely), so that data appended by an interrupted checkpoint is
+     *  ignored when resuming.
+     *  \param checkpointFileName Name of the file to which the checkpoints are written (checkpoints are no longer stored
+     *  if empty).
+     *  \param checkpointInterval Computation time (in seconds) between subsequent checkpoints.
+     */
+    void setCheckpointSettings( const std::string& checkpointFileName, const double checkpointInterval )
+    {
+        checkpointFileName_ = checkpointFileName;
+        checkpointInterval_ = checkpointInterval;
+    }
 
-        // Reset functions
-        dynamicsStateDerivative_->setPropagationSettings( std::vector< IntegratedStateType >( ), 1, 0 );
-        dynamicsStateDerivative_->resetFunctionEvaluationCounter( );
-        dynamicsStateDerivative_->resetCumulativeFunctionEvaluationCounter( );
+    //! Function to set the functions to store and restore the custom state of the simulation with a checkpoint.
+    /*!
+     *  Function to set the functions to store and restore the custom state of the simulation with a checkpoint (see
+     *  setCheckpointSettings), which is required if any of the environment or acceleration models retain a state that
+     *  depends on the history of the propagation (and not only on the current time and state).
+     *  \param customStateWriteFunction Function that writes the custom state to a binary stream.
+     *  \param customStateReadFunction Function that reads the custom state from a binary stream (as written by
+     *  customStateWriteFunction).
+     */
+    void setCheckpointCustomStateFunctions(
+            const std::function< void( std::ostream& ) > customStateWriteFunction,
+            const std::function< void( std::istream& ) > customStateReadFunction )
+    {
+        customStateWriteFunction_ = customStateWriteFunction;
+        customStateReadFunction_ = customStateReadFunction;
+    }
 
-        // Reset initial time to ensure consistency with multi-arc propagation.
-        integratorSettings_->initialTime_ = this->initialPropagationTime_;
+    //! Function to set the environments in which the Bulirsch-Stoer extrapolation sequence is evaluated concurrently
+    /*!
+     *  Function to set the environments in which the integrations of the extrapolation sequence of the Bulirsch-Stoer
+     *  integrator are evaluated concurrently, in addition to bodyMap_ (see
+     *  BulirschStoerVariableStepSizeIntegrator::setAdditionalStateDerivativeFunctions). A state derivative model is created
+     *  in each additional environment, and the extrapolation sequence is evaluated using 1 + N threads, with N the number of
+     *  additional environments. The propagation results are identical to those of the sequential evaluation.
+     *
+     *  Each additional body map must be an independent copy of bodyMap_ (e.g. created with the same settings by a separate
+     *  call to createBodies), which does not share any (environment) model with bodyMap_ or any of the other body maps.
+     *  Likewise, the associated propagator settings must be created in the same manner as those of this object, but with
+     *  the models (e.g. acceleration models) created from the associated body map. The termination conditions, dependent
+     *  variables and processing of the results use only bodyMap_, and the number of function evaluations and profiling
+     *  data include only the evaluations in bodyMap_. The additional environments are used by integrateEquationsOfMotion
+     *  and resumeIntegrationFromCheckpoint, the variational equations are propagated sequentially.
+     *  \param additionalBodyMaps Body maps, in addition to bodyMap_, in which the extrapolation sequence is evaluated. An
+     *  empty list reverts to the (default) sequential evaluation.
+     *  \param additionalPropagatorSettings Single-arc propagator settings, created for each of the additionalBodyMaps
+     */
+    void setExtrapolationSequenceEnvironments(
+            const std::vector< simulation_setup::NamedBodyMap >& additionalBodyMaps,
+            const std::vector< std::shared_ptr< PropagatorSettings< StateScalarType > > >& additionalPropagatorSettings )
+    {
+        if( additionalBodyMaps.size( ) != additionalPropagatorSettings.size( ) )
+        {
+            throw std::runtime_error( "Error when setting extrapolation sequence environments, number of body maps (" +
+                                      std::to_string( additionalBodyMaps.size( ) ) + ") and propagator settings (" +
+                                      std::to_string( additionalPropagatorSettings.size( ) ) + ") are inconsistent." );
+        }
+        else if( additionalBodyMaps.size( ) > 0 &&
+                 integratorSettings_->integratorType_ != numerical_integrators::bulirschStoer )
+        {
+            throw std::runtime_error( "Error when setting extrapolation sequence environments, integrator is not "
+                                      "Bulirsch-Stoer." );
+        }
 
-        // Integrate equations of motion numerically.
-        resetPropagationTerminationConditions( );
-        propagationTerminationReason_ =
-                EquationIntegrationInterface< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >, TimeType >::integrateEquations(
-                    stateDerivativeFunction_, equationsOfMotionNumericalSolutionRaw_,
-                    dynamicsStateDerivative_->convertFromOutputSolution(
-                        initialStates, this->initialPropagationTime_ ), integratorSettings_,
-                    propagationTerminationCondition_,
-                    dependentVariableHistory_,
-                    cumulativeComputationTimeHistory_,
-                    dependentVariablesFunctions_,
-                    statePostProcessingFunction_,
-                    propagatorSettings_->getPrintInterval( ),
-                    initialClockTime_ );
+        additionalDynamicsStateDerivatives_.clear( );
+        additionalStateDerivativeFunctions_.clear( );
+        for( unsigned int i = 0; i < additionalBodyMaps.size( ); i++ )
+        {
+            std::shared_ptr< SingleArcPropagatorSettings< StateScalarType > > currentPropagatorSettings =
+                    std::dynamic_pointer_cast< SingleArcPropagatorSettings< StateScalarType > >(
+                        additionalPropagatorSettings.at( i ) );
+            if( currentPropagatorSettings == nullptr )
+            {
+                throw std::runtime_error( "Error when setting extrapolation sequence environments, input is not single arc" );
+            }
+            else if( currentPropagatorSettings->getPropagatedStateSize( ) != propagatorSettings_->getPropagatedStateSize( ) )
+            {
+                throw std::runtime_error( "Error when setting extrapolation sequence environments, propagated state size is "
+                                          "inconsistent" );
+            }
 
-        // Convert numerical solution to conventional state
-        dynamicsStateDerivative_->convertNumericalStateSolutionsToOutputSolutions(
-                    equationsOfMotionNumericalSolution_, equationsOfMotionNumericalSolutionRaw_ );
+            // Create state derivative model in current environment.
+            std::shared_ptr< EnvironmentUpdater< StateScalarType, TimeType > > currentEnvironmentUpdater =
+                    createEnvironmentUpdaterForDynamicalEquations< StateScalarType, TimeType >(
+                        currentPropagatorSettings, additionalBodyMaps.at( i ) );
+            additionalDynamicsStateDerivatives_.push_back(
+                        std::make_shared< DynamicsStateDerivativeModel< TimeType, StateScalarType > >(
+                            createStateDerivativeModels< StateScalarType, TimeType >(
+                                currentPropagatorSettings, additionalBodyMaps.at( i ), initialPropagationTime_ ),
+                            std::bind( &EnvironmentUpdater< StateScalarType, TimeType >::updateEnvironment,
+                                       currentEnvironmentUpdater, std::placeholders::_1, std::placeholders::_2,
+                                       std::placeholders::_3 ) ) );
+            additionalStateDerivativeFunctions_.push_back(
+                        std::bind( &DynamicsStateDerivativeModel< TimeType, StateScalarType >::computeStateDerivative,
+                                   additionalDynamicsStateDerivatives_.back( ), std::placeholders::_1,
+                                   std::placeholders::_2 ) );
+        }
+    }
 
-        // Retrieve number of cumulative function evaluations
-        cumulativeNumberOfFunctionEvaluations_ = dynamicsStateDerivative_->getCumulativeNumberOfFunctionEvaluations( );
+    //! Function to resume the numerical integration of the equations of motion from a checkpoint.
+    /*!
+     *  Function to resume the numerical integration of the equations of motion from a checkpoint (see
+     *  setCheckpointSettings), which must have been stored by a simulator with identical settings. The full histories up to
+     *  the checkpoint are rebuilt from the history file of the checkpoint. After completion, the results of the simulator
+     *  are identical to those of an uninterrupted propagation, except for the computation time.
+     *  \param checkpointFileName Name of the file from which the checkpoint is read.
+     */
+    void resumeIntegrationFromCheckpoint( const std::string& checkpointFileName )
+    {
+        std::ifstream checkpointFile( checkpointFileName.c_str( ), std::ios::binary );
+        if( !checkpointFile.is_open( ) )
+        {
+            throw std::runtime_error( "Error when resuming propagation, could not open checkpoint file " +
+                                      checkpointFileName );
+        }
 
-        // Retrieve and print number of total function evaluations
-        if ( printNumberOfFunctionEvaluations_ )
+        // Read header and check whether checkpoint is compatible with simulator.
+        char fileIdentifier[ sizeof( propagationCheckpointFileIdentifier ) ];
+        int fileVersion;
+        int scalarSize, timeTypeSize, integratorType, stateSize;
+        checkpointFile.read( fileIdentifier, sizeof( propagationCheckpointFileIdentifier ) );
+        if( !checkpointFile || std::string( fileIdentifier, sizeof( propagationCheckpointFileIdentifier ) ) !=
+                std::string( propagationCheckpointFileIdentifier, sizeof( propagationCheckpointFileIdentifier ) ) )
         {
-            std::cout << "Total Number of Function Evaluations: "
-                      << dynamicsStateDerivative_->getNumberOfFunctionEvaluations( ) << std::endl;
+            throw std::runtime_error( "Error when resuming propagation, header of checkpoint file " +
+                                      checkpointFileName + " is invalid." );
+        }
+        utilities::readFromBinaryStream( checkpointFile, fileVersion );
+        utilities::readFromBinaryStream( checkpointFile, scalarSize );
+        utilities::readFromBinaryStream( checkpointFile, timeTypeSize );
+        utilities::readFromBinaryStream( checkpointFile, integratorType );
+        utilities::readFromBinaryStream( checkpointFile, stateSize );
+        if( fileVersion != propagationCheckpointFileVersion || scalarSize != static_cast< int >( sizeof( StateScalarType ) ) ||
+                timeTypeSize != static_cast< int >( sizeof( TimeType ) ) ||
+                integratorType != static_cast< int >( integratorSettings_->integratorType_ ) ||
+                stateSize != propagatorSettings_->getPropagatedStateSize( ) )
+        {
+            throw std::runtime_error( "Error when resuming propagation, checkpoint file " + checkpointFileName +
+                                      " is incompatible with simulation settings." );
         }
 
-        if( this->setIntegratedResult_ )
+        // Read state of integration loop, histories and custom state.
+        std::shared_ptr< IntegrationLoopState< TimeStepType > > loopState =
+                std::make_shared< IntegrationLoopState< TimeStepType > >( );
+        utilities::readFromBinaryStream( checkpointFile, loopState->timeStep );
+        utilities::readFromBinaryStream( checkpointFile, loopState->saveIndex );
+        utilities::readFromBinaryStream( checkpointFile, loopState->cumulativeComputationTime );
+        utilities::readFromBinaryStream( checkpointFile, loopState->integratorState );
+
+        unsigned int numberOfFunctionEvaluations;
+        std::string customState;
+        long long historyFileSize;
+        int numberOfSolutionEntries, numberOfDependentVariableEntries;
+        utilities::readFromBinaryStream( checkpointFile, numberOfFunctionEvaluations );
+        utilities::readFromBinaryStream( checkpointFile, customState );
+        utilities::readFromBinaryStream( checkpointFile, historyFileSize );
+        utilities::readFromBinaryStream( checkpointFile, numberOfSolutionEntries );
+        utilities::readFromBinaryStream( checkpointFile, numberOfDependentVariableEntries );
+        checkpointFile.close( );
+
+        if( customState.size( ) > 0 && customStateReadFunction_ == nullptr )
         {
-            processNumericalEquationsOfMotionSolution( );
+            throw std::runtime_error( "Error when resuming propagation, checkpoint file " + checkpointFileName +
+                                      " contains custom state, but no function to read it is defined." );
         }
+
+        // Rebuild histories from segments in history file (ignoring any data beyond the size stored in the checkpoint,
+        // which was written by an interrupted checkpoint).
+        const std::string historyFileName = getCheckpointHistoryFileName( checkpointFileName );
+        std::ifstream historyFile( historyFileName.c_str( ), std::ios::binary );
+        if( !historyFile.is_open( ) )
+        {
+            throw std::runtime_error( "Error when resuming propagation, could not open checkpoint history file " +
+                                      historyFileName );
+        }
+
+        utilities::StateHistory< TimeType, StateScalarType > numericalSolutionRaw;
+        utilities::StateHistory< TimeType, double > dependentVariableHistory;
+        std::map< TimeType, double > cumulativeComputationTimeHistory;
+        std::map< TimeType, unsigned int > cumulativeNumberOfFunctionEvaluations;
+        while( static_cast< long long >( historyFile.tellg( ) ) < historyFileSize )
+        {
+            utilities::appendFromBinaryStream( historyFile, numericalSolutionRaw );
+            utilities::appendFromBinaryStream( historyFile, dependentVariableHistory );
+            appendMapFromBinaryStream( historyFile, cumulativeComputationTimeHistory );
+            appendMapFromBinaryStream( historyFile, cumulativeNumberOfFunctionEvaluations );
+        }
+        if( static_cast< long long >( historyFile.tellg( ) ) != historyFileSize ||
+                numericalSolutionRaw.size( ) != numberOfSolutionEntries ||
+                dependentVariableHistory.size( ) != numberOfDependentVariableEntries )
+        {
+            throw std::runtime_error( "Error when resuming propagation, checkpoint history file " + historyFileName +
+                                      " is inconsistent with checkpoint file " + checkpointFileName );
+        }
+        historyFile.close( );
+
+        equationsOfMotionNumericalSolutionRaw_ = std::move( numericalSolutionRaw );
+        dependentVariableHistory_ = std::move( dependentVariableHistory );
+        cumulativeComputationTimeHistory_ = std::move( cumulativeComputationTimeHistory );
+
+        // Subsequent checkpoints (if written to the same file) append to the history file that was read.
+        checkpointedHistoryFileName_ = historyFileName;
+        checkpointedHistoryFileSize_ = historyFileSize;
+        numberOfCheckpointedSolutionEntries_ = numberOfSolutionEntries;
+        numberOfCheckpointedDependentVariableEntries_ = numberOfDependentVariableEntries;
+        checkpointedComputationTime_ = loopState->cumulativeComputationTime;
+        numberOfCheckpointedFunctionEvaluations_ = numberOfFunctionEvaluations;
+
+        // Restore function evaluation counters and custom state once the integrator has been created.
+        std::function< void( ) > resumeFunction = [ = ]( )
+        {
+            dynamicsStateDerivative_->setFunctionEvaluationCounters(
+                        numberOfFunctionEvaluations, cumulativeNumberOfFunctionEvaluations );
+            if( customState.size( ) > 0 )
+            {
+                std::istringstream customStateStream( customState );
+                customStateReadFunction_( customStateStream );
+            }
+        };
+
+        // Continue cumulative computation time from checkpoint.
+        performNumericalIntegration(
+                    propagatorSettings_->getInitialStates( ),
+                    std::chrono::steady_clock::now( ) - std::chrono::nanoseconds(
+                        static_cast< long long >( loopState->cumulativeComputationTime * 1.0E9 ) ),
+                    loopState, resumeFunction );
     }
 
     //! Function to return the map of state history of numerically integrated bodies.
@@ -557,7 +802,7 @@ public:
      */
     std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > getEquationsOfMotionNumericalSolution( )
     {
-        return equationsOfMotionNumericalSolution_;
+        return equationsOfMotionNumericalSolution_.getHistoryMap( );
     }
 
     //! Function to return the map of state history of numerically integrated bodies, in propagation coordinates.
@@ -567,7 +812,7 @@ public:
      */
     std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > getEquationsOfMotionNumericalSolutionRaw( )
     {
-        return equationsOfMotionNumericalSolutionRaw_;
+        return equationsOfMotionNumericalSolutionRaw_.getHistoryMap( );
     }
 
     //! Function to return the map of dependent variable history that was saved during numerical propagation.
@@ -576,6 +821,41 @@ public:
      * \return Map of dependent variable history that was saved during numerical propagation.
      */
     std::map< TimeType, Eigen::VectorXd > getDependentVariableHistory( )
+    {
+        return dependentVariableHistory_.getHistoryMap( );
+    }
+
+    //! Function to return the state history of numerically integrated bodies, stored in contiguous memory.
+    /*!
+     * Function to return the state history of numerically integrated bodies, stored in contiguous memory. Contrary to
+     * getEquationsOfMotionNumericalSolution, no copy of the history is made.
+     * \return State history of numerically integrated bodies, stored in contiguous memory.
+     */
+    const utilities::StateHistory< TimeType, StateScalarType >& getContiguousEquationsOfMotionNumericalSolution( )
+    {
+        return equationsOfMotionNumericalSolution_;
+    }
+
+    //! Function to return the state history of numerically integrated bodies in propagation coordinates, stored in
+    //! contiguous memory.
+    /*!
+     * Function to return the state history of numerically integrated bodies in propagation coordinates, stored in
+     * contiguous memory. Contrary to getEquationsOfMotionNumericalSolutionRaw, no copy of the history is made.
+     * \return State history of numerically integrated bodies in propagation coordinates, stored in contiguous memory.
+     */
+    const utilities::StateHistory< TimeType, StateScalarType >& getContiguousEquationsOfMotionNumericalSolutionRaw( )
+    {
+        return equationsOfMotionNumericalSolutionRaw_;
+    }
+
+    //! Function to return the dependent variable history that was saved during numerical propagation, stored in
+    //! contiguous memory.
+    /*!
+     * Function to return the dependent variable history that was saved during numerical propagation, stored in contiguous
+     * memory. Contrary to getDependentVariableHistory, no copy of the history is made.
+     * \return Dependent variable history that was saved during numerical propagation, stored in contiguous memory.
+     */
+    const utilities::StateHistory< TimeType, double >& getContiguousDependentVariableHistory( )
     {
         return dependentVariableHistory_;
     }
@@ -646,13 +926,14 @@ public:
             const std::map< TimeType, Eigen::VectorXd >& dependentVariableHistory,
             const bool processSolution = true )
     {
-        equationsOfMotionNumericalSolution_ = equationsOfMotionNumericalSolution;
+        equationsOfMotionNumericalSolution_ =
+                utilities::StateHistory< TimeType, StateScalarType >( equationsOfMotionNumericalSolution );
         if( processSolution )
         {
             processNumericalEquationsOfMotionSolution( );
         }
 
-        dependentVariableHistory_ = dependentVariableHistory;
+        dependentVariableHistory_ = utilities::StateHistory< TimeType, double >( dependentVariableHistory );
     }
 
     //! Function to get the settings for the numerical integrator.
@@ -719,6 +1000,36 @@ public:
         return dynamicsStateDerivative_;
     }
 
+    //! Function to retrieve the computation time summary of the components of the propagation.
+    /*!
+     * Function to retrieve the computation time summary of the components of the propagation (state derivative,
+     * environment update functions, acceleration models, variational equations and dependent variables), accumulated
+     * over all propagations since the creation of this object or the last call to resetProfilingData. The fraction of
+     * time of each component is given w.r.t. the total time spent in computing the state derivative. Timing is only
+     * performed if Tudat is built with USE_PROFILING, the summary is empty otherwise.
+     * \return Computation time summary of the components of the propagation, sorted by descending total time.
+     */
+    std::vector< utilities::ProfilingReportEntry > getProfilingReport( ) const
+    {
+        return profilingData_->getProfilingReport( "State derivative" );
+    }
+
+    //! Function to print the computation time summary of the components of the propagation.
+    /*!
+     * Function to print the computation time summary of the components of the propagation (see getProfilingReport).
+     * \param outputStream Stream to which the summary is written.
+     */
+    void printProfilingReport( std::ostream& outputStream = std::cout ) const
+    {
+        profilingData_->printProfilingReport( "State derivative", outputStream );
+    }
+
+    //! Function to reset the computation time of all components of the propagation to zero.
+    void resetProfilingData( )
+    {
+        profilingData_->reset( );
+    }
+
     //! Function to retrieve the object defining when the propagation is to be terminated.
     /*!
      * Function to retrieve the object defining when the propagation is to be terminated.
@@ -823,7 +1134,7 @@ public:
     void processNumericalEquationsOfMotionSolution( )
     {
         // Create and set interpolators for ephemerides
-        resetIntegratedStates( equationsOfMotionNumericalSolution_, integratedStateProcessors_ );
+        resetIntegratedStates( equationsOfMotionNumericalSolution_.getHistoryMap( ), integratedStateProcessors_ );
 
         // Clear numerical solution if so required.
         if( clearNumericalSolutions_ )
@@ -842,6 +1153,245 @@ public:
 
 protected:
 
+    //! Function to numerically integrate the equations of motion, from the initial state or from a checkpoint.
+    /*!
+     *  Function to numerically integrate the equations of motion, from the initial state or from a checkpoint (in which case
+     *  the histories up to the checkpoint must have been set before calling this function).
+     *  \param initialStates Initial state vector that is to be used for numerical integration (see
+     *  integrateEquationsOfMotion)
+     *  \param initialClockTime Initial clock time from which to determine cumulative computation time.
+     *  \param resumeLoopState State of the integration loop at the checkpoint from which the integration is resumed
+     *  (nullptr if integration is started from initial state).
+     *  \param resumeFunction Function that restores the state of the simulation at the checkpoint, to be called once the
+     *  integrator has been restored.
+     */
+    void performNumericalIntegration(
+            const Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic >& initialStates,
+            const std::chrono::steady_clock::time_point initialClockTime,
+            const std::shared_ptr< IntegrationLoopState< TimeStepType > > resumeLoopState = nullptr,
+            const std::function< void( ) > resumeFunction = std::function< void( ) >( ) )
+    {
+
+        // Empty solution maps
+        equationsOfMotionNumericalSolution_.clear( );
+        if( resumeLoopState == nullptr )
+        {
+            equationsOfMotionNumericalSolutionRaw_.clear( );
+            checkpointedHistoryFileName_.clear( );
+        }
+
+        // Reset functions
+        dynamicsStateDerivative_->setPropagationSettings( std::vector< IntegratedStateType >( ), 1, 0 );
+        dynamicsStateDerivative_->resetFunctionEvaluationCounter( );
+        dynamicsStateDerivative_->resetCumulativeFunctionEvaluationCounter( );
+
+        // Reset functions in additional environments, and set initial state (which may define the reference of the
+        // propagated state).
+        for( unsigned int i = 0; i < additionalDynamicsStateDerivatives_.size( ); i++ )
+        {
+            additionalDynamicsStateDerivatives_.at( i )->setPropagationSettings(
+                        std::vector< IntegratedStateType >( ), 1, 0 );
+            additionalDynamicsStateDerivatives_.at( i )->convertFromOutputSolution(
+                        initialStates, this->initialPropagationTime_ );
+        }
+
+        // Reset initial time to ensure consistency with multi-arc propagation.
+        integratorSettings_->initialTime_ = this->initialPropagationTime_;
+
+        // Set checkpoint settings, if any.
+        std::shared_ptr< PropagationCheckpointSettings< TimeStepType > > checkpointSettings;
+        if( checkpointFileName_ != "" || resumeLoopState != nullptr )
+        {
+            checkpointSettings = std::make_shared< PropagationCheckpointSettings< TimeStepType > >(
+                        ( checkpointFileName_ != "" ) ? checkpointInterval_ : TUDAT_NAN,
+                        std::bind( &SingleArcDynamicsSimulator< StateScalarType, TimeType >::writeCheckpoint, this,
+                                   std::placeholders::_1 ),
+                        resumeLoopState, resumeFunction );
+        }
+
+        // Integrate equations of motion numerically.
+        resetPropagationTerminationConditions( );
+        propagationTerminationReason_ =
+                EquationIntegrationInterface< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >, TimeType >::integrateEquations(
+                    stateDerivativeFunction_, equationsOfMotionNumericalSolutionRaw_,
+                    dynamicsStateDerivative_->convertFromOutputSolution(
+                        initialStates, this->initialPropagationTime_ ), integratorSettings_,
+                    propagationTerminationCondition_,
+                    dependentVariableHistory_,
+                    cumulativeComputationTimeHistory_,
+                    dependentVariablesFunctions_,
+                    statePostProcessingFunction_,
+                    propagatorSettings_->getPrintInterval( ),
+                    initialClockTime,
+                    checkpointSettings,
+                    additionalStateDerivativeFunctions_ );
+
+        // Convert numerical solution to conventional state
+        dynamicsStateDerivative_->convertNumericalStateSolutionsToOutputSolutions(
+                    equationsOfMotionNumericalSolution_, equationsOfMotionNumericalSolutionRaw_ );
+
+        // Retrieve number of cumulative function evaluations
+        cumulativeNumberOfFunctionEvaluations_ = dynamicsStateDerivative_->getCumulativeNumberOfFunctionEvaluations( );
+
+        // Retrieve and print number of total function evaluations
+        if ( printNumberOfFunctionEvaluations_ )
+        {
+            std::cout << "Total Number of Function Evaluations: "
+                      << dynamicsStateDerivative_->getNumberOfFunctionEvaluations( ) << std::endl;
+        }
+
+        if( this->setIntegratedResult_ )
+        {
+            processNumericalEquationsOfMotionSolution( );
+        }
+    }
+
+    //! Function to write a checkpoint of the propagation, from which it can be resumed.
+    /*!
+     *  Function to write a checkpoint of the propagation to the file set by setCheckpointSettings, from which it can be
+     *  resumed (see resumeIntegrationFromCheckpoint). The entries of the histories that were added since the previous
+     *  checkpoint are appended to the history file. The checkpoint is then written to a temporary file, which replaces the
+     *  previous checkpoint, so that a valid checkpoint is retained if the propagation is interrupted while writing.
+     *  \param loopState Current state of the integration loop.
+     */
+    void writeCheckpoint( const IntegrationLoopState< TimeStepType >& loopState )
+    {
+        // Append new entries of histories to history file, starting a new file if no previous checkpoint was written to it.
+        // The last entries that were previously stored are written again, as these may have been overwritten since.
+        const std::string historyFileName = getCheckpointHistoryFileName( checkpointFileName_ );
+        std::fstream historyFile;
+        if( checkpointedHistoryFileName_ != historyFileName )
+        {
+            historyFile.open( historyFileName.c_str( ), std::ios::out | std::ios::binary | std::ios::trunc );
+            checkpointedHistoryFileSize_ = 0;
+            numberOfCheckpointedSolutionEntries_ = 0;
+            numberOfCheckpointedDependentVariableEntries_ = 0;
+            checkpointedComputationTime_ = -std::numeric_limits< double >::infinity( );
+            numberOfCheckpointedFunctionEvaluations_ = 0;
+        }
+        else
+        {
+            historyFile.open( historyFileName.c_str( ), std::ios::in | std::ios::out | std::ios::binary );
+            historyFile.seekp( checkpointedHistoryFileSize_ );
+        }
+        if( !historyFile.is_open( ) )
+        {
+            throw std::runtime_error( "Error when writing propagation checkpoint, could not open file " + historyFileName );
+        }
+
+        utilities::writeToBinaryStream( historyFile, equationsOfMotionNumericalSolutionRaw_,
+                                        std::max( numberOfCheckpointedSolutionEntries_ - 1, 0 ) );
+        utilities::writeToBinaryStream( historyFile, dependentVariableHistory_,
+                                        std::max( numberOfCheckpointedDependentVariableEntries_ - 1, 0 ) );
+
+        std::map< TimeType, double > newCumulativeComputationTimes;
+        for( auto computationTimeIterator : cumulativeComputationTimeHistory_ )
+        {
+            if( computationTimeIterator.second >= checkpointedComputationTime_ )
+            {
+                newCumulativeComputationTimes.insert( newCumulativeComputationTimes.end( ), computationTimeIterator );
+            }
+        }
+        utilities::writeToBinaryStream( historyFile, newCumulativeComputationTimes );
+
+        std::map< TimeType, unsigned int > newCumulativeNumberOfFunctionEvaluations;
+        for( auto functionEvaluationIterator : dynamicsStateDerivative_->getCumulativeNumberOfFunctionEvaluations( ) )
+        {
+            if( functionEvaluationIterator.second > numberOfCheckpointedFunctionEvaluations_ )
+            {
+                newCumulativeNumberOfFunctionEvaluations.insert(
+                            newCumulativeNumberOfFunctionEvaluations.end( ), functionEvaluationIterator );
+            }
+        }
+        utilities::writeToBinaryStream( historyFile, newCumulativeNumberOfFunctionEvaluations );
+
+        const long long historyFileSize = static_cast< long long >( historyFile.tellp( ) );
+        historyFile.close( );
+        if( !historyFile )
+        {
+            throw std::runtime_error( "Error when writing propagation checkpoint to file " + historyFileName );
+        }
+
+        const std::string temporaryFileName = checkpointFileName_ + ".tmp";
+        std::ofstream checkpointFile( temporaryFileName.c_str( ), std::ios::binary | std::ios::trunc );
+        if( !checkpointFile.is_open( ) )
+        {
+            throw std::runtime_error( "Error when writing propagation checkpoint, could not open file " +
+                                      temporaryFileName );
+        }
+
+        // Write header, used to check whether checkpoint is compatible with simulator when resuming.
+        checkpointFile.write( propagationCheckpointFileIdentifier, sizeof( propagationCheckpointFileIdentifier ) );
+        utilities::writeToBinaryStream( checkpointFile, propagationCheckpointFileVersion );
+        utilities::writeToBinaryStream( checkpointFile, static_cast< int >( sizeof( StateScalarType ) ) );
+        utilities::writeToBinaryStream( checkpointFile, static_cast< int >( sizeof( TimeType ) ) );
+        utilities::writeToBinaryStream( checkpointFile, static_cast< int >( integratorSettings_->integratorType_ ) );
+        utilities::writeToBinaryStream( checkpointFile, propagatorSettings_->getPropagatedStateSize( ) );
+
+        // Write state of integration loop, histories and custom state.
+        utilities::writeToBinaryStream( checkpointFile, loopState.timeStep );
+        utilities::writeToBinaryStream( checkpointFile, loopState.saveIndex );
+        utilities::writeToBinaryStream( checkpointFile, loopState.cumulativeComputationTime );
+        utilities::writeToBinaryStream( checkpointFile, loopState.integratorState );
+        utilities::writeToBinaryStream( checkpointFile, dynamicsStateDerivative_->getNumberOfFunctionEvaluations( ) );
+
+        std::ostringstream customStateStream;
+        if( customStateWriteFunction_ != nullptr )
+        {
+            customStateWriteFunction_( customStateStream );
+        }
+        utilities::writeToBinaryStream( checkpointFile, customStateStream.str( ) );
+
+        // Write size of valid part of history file, and sizes of histories (to check consistency when resuming).
+        utilities::writeToBinaryStream( checkpointFile, historyFileSize );
+        utilities::writeToBinaryStream( checkpointFile, equationsOfMotionNumericalSolutionRaw_.size( ) );
+        utilities::writeToBinaryStream( checkpointFile, dependentVariableHistory_.size( ) );
+
+        checkpointFile.close( );
+        if( !checkpointFile )
+        {
+            throw std::runtime_error( "Error when writing propagation checkpoint to file " + temporaryFileName );
+        }
+
+        // Replace previous checkpoint (removing it first, for platforms on which rename does not overwrite files).
+        if( std::rename( temporaryFileName.c_str( ), checkpointFileName_.c_str( ) ) != 0 )
+        {
+            std::remove( checkpointFileName_.c_str( ) );
+            if( std::rename( temporaryFileName.c_str( ), checkpointFileName_.c_str( ) ) != 0 )
+            {
+                throw std::runtime_error( "Error when writing propagation checkpoint, could not replace file " +
+                                          checkpointFileName_ );
+            }
+        }
+
+        // Store which part of the histories is contained in the history file.
+        checkpointedHistoryFileName_ = historyFileName;
+        checkpointedHistoryFileSize_ = historyFileSize;
+        numberOfCheckpointedSolutionEntries_ = equationsOfMotionNumericalSolutionRaw_.size( );
+        numberOfCheckpointedDependentVariableEntries_ = dependentVariableHistory_.size( );
+        checkpointedComputationTime_ = loopState.cumulativeComputationTime;
+        numberOfCheckpointedFunctionEvaluations_ = dynamicsStateDerivative_->getNumberOfFunctionEvaluations( );
+    }
+
+    //! Function to read a map from a binary stream, and add its entries to an existing map.
+    /*!
+     *  Function to read a map from a binary stream, and add its entries to an existing map, overwriting entries with
+     *  identical keys (used to rebuild histories from the segments in a checkpoint history file).
+     *  \param inputStream Stream from which the map is read.
+     *  \param mapToExtend Map to which the entries are added (returned by reference).
+     */
+    template< typename ValueType >
+    static void appendMapFromBinaryStream( std::istream& inputStream, std::map< TimeType, ValueType >& mapToExtend )
+    {
+        std::map< TimeType, ValueType > mapSegment;
+        utilities::readFromBinaryStream( inputStream, mapSegment );
+        for( auto mapIterator : mapSegment )
+        {
+            mapToExtend[ mapIterator.first ] = mapIterator.second;
+        }
+    }
+
+
     //! List of object (per dynamics type) that process the integrated numerical solution by updating the environment
     std::map< IntegratedStateType, std::vector< std::shared_ptr<
     IntegratedStateProcessor< TimeType, StateScalarType > > > > integratedStateProcessors_;
@@ -874,6 +1424,14 @@ protected:
     std::function< Eigen::Matrix< double, Eigen::Dynamic, Eigen::Dynamic >
     ( const double, const Eigen::Matrix< double, Eigen::Dynamic, Eigen::Dynamic >& ) > doubleStateDerivativeFunction_;
 
+    //! Objects that return the state derivative in the additional environments (see setExtrapolationSequenceEnvironments).
+    std::vector< std::shared_ptr< DynamicsStateDerivativeModel< TimeType, StateScalarType > > >
+    additionalDynamicsStateDerivatives_;
+
+    //! Functions that perform a single state derivative function evaluation in the additional environments.
+    std::vector< std::function< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >
+    ( const TimeType, const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& ) > > additionalStateDerivativeFunctions_;
+
 
     //! Settings for numerical integrator.
     std::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > integratorSettings_;
@@ -896,26 +1454,26 @@ protected:
     //! Object for retrieving ephemerides for transformation of reference frame (origins)
     std::shared_ptr< ephemerides::ReferenceFrameManager > frameManager_;
 
-    //! Map of state history of numerically integrated bodies.
+    //! State history of numerically integrated bodies.
     /*!
-     *  Map of state history of numerically integrated bodies, i.e. the result of the numerical integration, transformed
-     *  into the 'conventional form' (\sa SingleStateTypeDerivative::convertToOutputSolution). Key of map denotes time,
-     *  values are concatenated vectors of integrated body states (order defined by propagatorSettings_).
-     *  NOTE: this map is empty if clearNumericalSolutions_ is set to true.
+     *  State history of numerically integrated bodies, i.e. the result of the numerical integration, transformed
+     *  into the 'conventional form' (\sa SingleStateTypeDerivative::convertToOutputSolution). Entries are
+     *  concatenated vectors of integrated body states (order defined by propagatorSettings_), stored in contiguous memory.
+     *  NOTE: this history is empty if clearNumericalSolutions_ is set to true.
      */
-    std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > equationsOfMotionNumericalSolution_;
+    utilities::StateHistory< TimeType, StateScalarType > equationsOfMotionNumericalSolution_;
 
-    //! Map of state history of numerically integrated bodies.
+    //! State history of numerically integrated bodies, in propagation coordinates.
     /*!
-    *  Map of state history of numerically integrated bodies, i.e. the result of the numerical integration, in the
-    *  original propagation coordinates. Key of map denotes time, values are concatenated vectors of integrated body
-    * states (order defined by propagatorSettings_).
-    *  NOTE: this map is empty if clearNumericalSolutions_ is set to true.
+    *  State history of numerically integrated bodies, i.e. the result of the numerical integration, in the
+    *  original propagation coordinates. Entries are concatenated vectors of integrated body
+    * states (order defined by propagatorSettings_), stored in contiguous memory.
+    *  NOTE: this history is empty if clearNumericalSolutions_ is set to true.
     */
-    std::map< TimeType, Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > equationsOfMotionNumericalSolutionRaw_;
+    utilities::StateHistory< TimeType, StateScalarType > equationsOfMotionNumericalSolutionRaw_;
 
-    //! Map of dependent variable history that was saved during numerical propagation.
-    std::map< TimeType, Eigen::VectorXd > dependentVariableHistory_;
+    //! Dependent variable history that was saved during numerical propagation, stored in contiguous memory.
+    utilities::StateHistory< TimeType, double > dependentVariableHistory_;
 
     //! Map of cumulative computation time history that was saved during numerical propagation.
     std::map< TimeType, double > cumulativeComputationTimeHistory_;
@@ -935,6 +1493,39 @@ protected:
     //! Event that triggered the termination of the propagation
     std::shared_ptr< PropagationTerminationDetails > propagationTerminationReason_;
 
+    //! Name of the file to which checkpoints of the propagation are written (none if empty).
+    std::string checkpointFileName_;
+
+    //! Computation time (in seconds) between subsequent checkpoints of the propagation.
+    double checkpointInterval_ = TUDAT_NAN;
+
+    //! Function that writes the custom state of the simulation to a binary stream, when writing a checkpoint.
+    std::function< void( std::ostream& ) > customStateWriteFunction_;
+
+    //! Function that reads the custom state of the simulation from a binary stream, when resuming from a checkpoint.
+    std::function< void( std::istream& ) > customStateReadFunction_;
+
+    //! Name of the history file to which the last checkpoint of the current propagation was written (empty if none).
+    std::string checkpointedHistoryFileName_;
+
+    //! Size (in bytes) of the part of the history file that is valid for the last checkpoint.
+    long long checkpointedHistoryFileSize_ = 0;
+
+    //! Number of entries of the (raw) numerical solution that were stored with the last checkpoint.
+    int numberOfCheckpointedSolutionEntries_ = 0;
+
+    //! Number of entries of the dependent variable history that were stored with the last checkpoint.
+    int numberOfCheckpointedDependentVariableEntries_ = 0;
+
+    //! Cumulative computation time (in seconds) at the last checkpoint.
+    double checkpointedComputationTime_ = 0.0;
+
+    //! Number of function evaluations at the last checkpoint.
+    unsigned int numberOfCheckpointedFunctionEvaluations_ = 0;
+
+    //! Object in which the computation time of the components of the propagation is stored.
+    std::shared_ptr< utilities::ProfilingData > profilingData_;
+
 };
 
 //! Function to get a vector of initial states from a vector of propagator settings
@@ -956,6 +1547,28 @@ std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1  > > getInitialSt
     return initialStatesList;
 }
 
+//! Function to check whether the initial states of all arcs are known before propagating any of the arcs
+/*!
+ *  Function to check whether the initial states of all arcs are known before propagating any of the arcs, i.e. whether
+ *  none of the arcs (except the first) takes its initial state from the previous arc (denoted by NaN entries in the initial
+ *  state of the arc).
+ *  \param initialStatesList List of initial states of all arcs
+ *  \return True if the arcs may be propagated independently of one another
+ */
+template< typename StateScalarType = double >
+bool areArcInitialStatesIndependent(
+        const std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > >& initialStatesList )
+{
+    for( unsigned int i = 1; i < initialStatesList.size( ); i++ )
+    {
+        if( linear_algebra::doesMatrixHaveNanEntries( initialStatesList.at( i ) ) )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 //! Function to get the initial state of a translational state arc from the previous state's numerical solution
 /*!
  *  Function to get the initial state of a translational state arc from the previous state's numerical solution
@@ -1084,6 +1697,8 @@ public:
                 singleArcDynamicsSimulators_[ i ]->resetSetIntegratedResult( false );
             }
 
+            arcPropagationBodyMaps_.push_back( bodyMap );
+
             equationsOfMotionNumericalSolution_.resize( arcStartTimes.size( ) );
             dependentVariableHistory_.resize( arcStartTimes.size( ) );
             cumulativeComputationTimeHistory_.resize( arcStartTimes.size( ) );
@@ -1147,6 +1762,8 @@ public:
                 singleArcDynamicsSimulators_[ i ]->resetSetIntegratedResult( false );
             }
 
+            arcPropagationBodyMaps_.push_back( bodyMap );
+
             equationsOfMotionNumericalSolution_.resize( singleArcSettings.size( ) );
             dependentVariableHistory_.resize( singleArcSettings.size( ) );
             cumulativeComputationTimeHistory_.resize( singleArcSettings.size( ) );
@@ -1222,6 +1839,26 @@ public:
         }
 
 
+        // Propagate arcs concurrently, if possible
+        if( ( arcPropagationBodyMaps_.size( ) > 1 ) && areArcInitialStatesIndependent( initialStatesList ) )
+        {
+            int numberOfEnvironments = arcPropagationBodyMaps_.size( );
+            utilities::executeParallelLoop(
+                        numberOfEnvironments, numberOfEnvironments, [ & ]( const int environmentIndex )
+            {
+                for( unsigned int i = environmentIndex; i < singleArcDynamicsSimulators_.size( ); i += numberOfEnvironments )
+                {
+                    integrateArcEquationsOfMotion( i, initialStatesList.at( i ) );
+                }
+            } );
+
+            if( this->setIntegratedResult_ )
+            {
+                processNumericalEquationsOfMotionSolution( );
+            }
+            return;
+        }
+
         Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > currentArcInitialState;
         std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > arcInitialStateList;
         bool updateInitialStates = false;
@@ -1247,15 +1884,7 @@ public:
             }
             arcInitialStateList.push_back( currentArcInitialState );
 
-            singleArcDynamicsSimulators_.at( i )->integrateEquationsOfMotion( currentArcInitialState );
-            equationsOfMotionNumericalSolution_[ i ] =
-                    std::move( singleArcDynamicsSimulators_.at( i )->getEquationsOfMotionNumericalSolution( ) );
-            dependentVariableHistory_[ i ] =
-                    std::move( singleArcDynamicsSimulators_.at( i )->getDependentVariableHistory( ) );
-            cumulativeComputationTimeHistory_[ i ] =
-                    std::move( singleArcDynamicsSimulators_.at( i )->getCumulativeComputationTimeHistory( ) );
-            propagationTerminationReasons_[ i ] = singleArcDynamicsSimulators_.at( i )->getPropagationTerminationReason( );
-            arcStartTimes_[ i ] = equationsOfMotionNumericalSolution_[ i ].begin( )->first;
+            integrateArcEquationsOfMotion( i, currentArcInitialState );
         }
 
         if( updateInitialStates )
@@ -1383,6 +2012,97 @@ public:
         return dynamicsStateDerivatives;
     }
 
+    //! Function to set the environments in which the arcs are to be propagated concurrently
+    /*!
+     *  Function to set the environments in which the arcs are to be propagated concurrently. The arcs are distributed over
+     *  the environments (with the environment of index 0 being the bodyMap_ member), such that arc i is propagated in
+     *  environment i % N, with N the total number of environments. The arcs that are propagated in different environments
+     *  are propagated concurrently, each in its own thread, so that N arcs are propagated simultaneously. The dynamics
+     *  simulators of all arcs are recreated by this function, using the propagator settings of the environment of the
+     *  arc. After the propagation, the propagated states are processed in each environment.
+     *
+     *  Each additional body map must be an independent copy of bodyMap_ (e.g. created with the same settings by a separate
+     *  call to createBodies), which does not share any (environment) model with bodyMap_ or any of the other body maps.
+     *  Likewise, the associated propagator settings must be created in the same manner as those of this object, but with
+     *  the models (e.g. acceleration models) created from the associated body map. Any physical parameters of the
+     *  environment that are modified after creation must be modified in all environments (for the estimation, this is
+     *  handled by the MultiArcVariationalEquationsSolver).
+     *  Arcs are only propagated concurrently if no arc initial state is taken from the preceding arc (as denoted by NaN
+     *  entries in the arc initial state); otherwise, all arcs are propagated sequentially.
+     *  \param additionalBodyMaps Body maps, in addition to bodyMap_, in which arcs are to be propagated. An empty list
+     *  reverts to the (default) sequential propagation of all arcs in bodyMap_.
+     *  \param additionalPropagatorSettings Multi-arc propagator settings, created for each of the additionalBodyMaps
+     */
+    void setArcPropagationEnvironments(
+            const std::vector< simulation_setup::NamedBodyMap >& additionalBodyMaps,
+            const std::vector< std::shared_ptr< PropagatorSettings< StateScalarType > > >& additionalPropagatorSettings )
+    {
+        if( additionalBodyMaps.size( ) != additionalPropagatorSettings.size( ) )
+        {
+            throw std::runtime_error( "Error when setting multi-arc propagation environments, number of body maps (" +
+                                      std::to_string( additionalBodyMaps.size( ) ) + ") and propagator settings (" +
+                                      std::to_string( additionalPropagatorSettings.size( ) ) + ") are inconsistent." );
+        }
+
+        // Retrieve single-arc propagator settings for each environment
+        std::vector< std::vector< std::shared_ptr< SingleArcPropagatorSettings< StateScalarType > > > > singleArcSettings;
+        singleArcSettings.push_back( multiArcPropagatorSettings_->getSingleArcSettings( ) );
+        for( unsigned int i = 0; i < additionalPropagatorSettings.size( ); i++ )
+        {
+            std::shared_ptr< MultiArcPropagatorSettings< StateScalarType > > currentPropagatorSettings =
+                    std::dynamic_pointer_cast< MultiArcPropagatorSettings< StateScalarType > >(
+                        additionalPropagatorSettings.at( i ) );
+            if( currentPropagatorSettings == nullptr )
+            {
+                throw std::runtime_error( "Error when setting multi-arc propagation environments, input is not multi arc" );
+            }
+            else if( currentPropagatorSettings->getSingleArcSettings( ).size( ) != singleArcDynamicsSimulators_.size( ) )
+            {
+                throw std::runtime_error( "Error when setting multi-arc propagation environments, number of arcs is inconsistent" );
+            }
+            singleArcSettings.push_back( currentPropagatorSettings->getSingleArcSettings( ) );
+        }
+
+        arcPropagationBodyMaps_.clear( );
+        arcPropagationBodyMaps_.push_back( bodyMap_ );
+        arcPropagationBodyMaps_.insert( arcPropagationBodyMaps_.end( ), additionalBodyMaps.begin( ), additionalBodyMaps.end( ) );
+
+        // Recreate dynamics simulators in environment of each arc, each with its own integrator settings object.
+        for( unsigned int i = 0; i < singleArcDynamicsSimulators_.size( ); i++ )
+        {
+            std::shared_ptr< numerical_integrators::IntegratorSettings< TimeType > > arcIntegratorSettings =
+                    singleArcDynamicsSimulators_.at( i )->getIntegratorSettings( )->clone( );
+            arcIntegratorSettings->initialTime_ = singleArcDynamicsSimulators_.at( i )->getInitialPropagationTime( );
+
+            singleArcDynamicsSimulators_[ i ] = std::make_shared< SingleArcDynamicsSimulator< StateScalarType, TimeType > >(
+                        getArcPropagationBodyMap( i ), arcIntegratorSettings,
+                        singleArcSettings.at( i % singleArcSettings.size( ) ).at( i ), false, false, true );
+            singleArcDynamicsSimulators_[ i ]->resetSetIntegratedResult( false );
+        }
+    }
+
+    //! Function to retrieve the environment in which a given arc is propagated
+    /*!
+     * Function to retrieve the environment in which a given arc is propagated (see setArcPropagationEnvironments)
+     * \param arcIndex Index of arc for which the environment is to be retrieved
+     * \return Body map in which the arc is propagated
+     */
+    simulation_setup::NamedBodyMap getArcPropagationBodyMap( const unsigned int arcIndex )
+    {
+        return arcPropagationBodyMaps_.at( arcIndex % arcPropagationBodyMaps_.size( ) );
+    }
+
+    //! Function to retrieve the number of environments in which the arcs are propagated concurrently
+    /*!
+     * Function to retrieve the number of environments in which the arcs are propagated concurrently
+     * (see setArcPropagationEnvironments)
+     * \return Number of environments in which the arcs are propagated concurrently
+     */
+    unsigned int getNumberOfArcPropagationEnvironments( )
+    {
+        return arcPropagationBodyMaps_.size( );
+    }
+
     //! Function to get the list of DynamicsSimulator objects used for each arc
     /*!
      * Function to get the list of DynamicsSimulator objects used for each arc
@@ -1433,6 +2153,14 @@ public:
                     equationsOfMotionNumericalSolution_,
                     singleArcDynamicsSimulators_.at( 0 )->getIntegratedStateProcessors( ), arcStartTimes_ );
 
+        // Process solution in additional environments used for concurrent propagation.
+        for( unsigned int i = 1; ( i < arcPropagationBodyMaps_.size( ) ) && ( i < singleArcDynamicsSimulators_.size( ) ); i++ )
+        {
+            resetIntegratedMultiArcStatesWithEqualArcDynamics(
+                        equationsOfMotionNumericalSolution_,
+                        singleArcDynamicsSimulators_.at( i )->getIntegratedStateProcessors( ), arcStartTimes_ );
+        }
+
         if( clearNumericalSolutions_ )
         {
             for( unsigned int i = 0; i < equationsOfMotionNumericalSolution_.size( ); i++ )
@@ -1445,6 +2173,28 @@ public:
 
 protected:
 
+    //! Function to propagate the dynamics of a single arc, and store the results in the member variables of this object
+    /*!
+     *  Function to propagate the dynamics of a single arc, and store the results in the member variables of this object.
+     *  Only the entries of the member variables associated with the given arc are modified.
+     *  \param arcIndex Index of arc that is to be propagated
+     *  \param arcInitialState Initial state of arc that is to be propagated
+     */
+    void integrateArcEquationsOfMotion(
+            const unsigned int arcIndex, const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& arcInitialState )
+    {
+        singleArcDynamicsSimulators_.at( arcIndex )->integrateEquationsOfMotion( arcInitialState );
+        equationsOfMotionNumericalSolution_[ arcIndex ] =
+                std::move( singleArcDynamicsSimulators_.at( arcIndex )->getEquationsOfMotionNumericalSolution( ) );
+        dependentVariableHistory_[ arcIndex ] =
+                std::move( singleArcDynamicsSimulators_.at( arcIndex )->getDependentVariableHistory( ) );
+        cumulativeComputationTimeHistory_[ arcIndex ] =
+                std::move( singleArcDynamicsSimulators_.at( arcIndex )->getCumulativeComputationTimeHistory( ) );
+        propagationTerminationReasons_[ arcIndex ] =
+                singleArcDynamicsSimulators_.at( arcIndex )->getPropagationTerminationReason( );
+        arcStartTimes_[ arcIndex ] = equationsOfMotionNumericalSolution_[ arcIndex ].begin( )->first;
+    }
+
     //! List of maps of state history of numerically integrated states.
     /*!
      *  List of maps of state history of numerically integrated states. Each entry in the list contains data on a single arc.
@@ -1468,6 +2218,9 @@ protected:
 
     //! Propagator settings used by this objec
     std::shared_ptr< MultiArcPropagatorSettings< StateScalarType > > multiArcPropagatorSettings_;
+
+    //! List of environments in which the arcs are propagated (see setArcPropagationEnvironments), first entry is bodyMap_
+    std::vector< simulation_setup::NamedBodyMap > arcPropagationBodyMaps_;
 };
 
 //! Class for performing full numerical integration of a dynamical system, with a compbination of single and multi-arc propagations
@@ -0,0 +1,29 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#include "Tudat/SimulationSetup/PropagationSetup/ensembleDynamicsSimulator.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+template class EnsembleDynamicsSimulator< double, double >;
+
+#if( BUILD_EXTENDED_PRECISION_PROPAGATION_TOOLS )
+template class EnsembleDynamicsSimulator< long double, double >;
+template class EnsembleDynamicsSimulator< double, Time >;
+template class EnsembleDynamicsSimulator< long double, Time >;
+#endif
+
+} // namespace propagators
+
+} // namespace tudat
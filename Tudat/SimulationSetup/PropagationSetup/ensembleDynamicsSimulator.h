@@ -0,0 +1,595 @@
+/*    Copyright (c) 2010-2018, Delft University of Technology
+ *    All rigths reserved
+ *
+ *    This file is part of the Tudat. Redistribution and use in source and
+ *    binary forms, with or without modification, are permitted exclusively
+ *    under the terms of the Modified BSD license. You should have received
+ *    a copy of the license with this file. If not, please or visit:
+ *    http://tudat.tudelft.nl/LICENSE.
+ */
+
+#ifndef TUDAT_ENSEMBLEDYNAMICSSIMULATOR_H
+#define TUDAT_ENSEMBLEDYNAMICSSIMULATOR_H
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <Eigen/Core>
+
+#if USE_GSL
+#include <boost/math/distributions/normal.hpp>
+#endif
+
+#include "Tudat/Basics/parallelization.h"
+#include "Tudat/Mathematics/Statistics/basicStatistics.h"
+#include "Tudat/Mathematics/Statistics/randomSampling.h"
+#include "Tudat/SimulationSetup/PropagationSetup/dynamicsSimulator.h"
+
+namespace tudat
+{
+
+namespace propagators
+{
+
+//! Class containing the objects that are used to propagate the members of an ensemble in a single thread
+/*!
+ *  Class containing the objects that are used to propagate the members of an ensemble in a single thread: a dynamics
+ *  simulator (which is reused for all members propagated by the thread), and an (optional) function to reset the values
+ *  of the physical parameters of the environment of this simulator. For each thread, a separate object of this type must be
+ *  created, with the dynamics simulator set up in its own environment (i.e. a separately created body map, with the
+ *  acceleration models and propagator settings created from that body map).
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+class EnsembleMemberSimulator
+{
+public:
+
+    //! Constructor
+    /*!
+     *  Constructor
+     *  \param dynamicsSimulator Dynamics simulator used to propagate the members of the ensemble (need not have been
+     *  propagated upon creation).
+     *  \param parameterResetFunction Function to reset the values of the physical parameters that are varied between the
+     *  members of the ensemble (for instance bound to EstimatableParameterSet::resetParameterValues for a parameter set
+     *  created from the same body map as the dynamics simulator). Empty by default, in which case only the initial state can
+     *  be varied between members.
+     */
+    EnsembleMemberSimulator(
+            const std::shared_ptr< SingleArcDynamicsSimulator< StateScalarType, TimeType > > dynamicsSimulator,
+            const std::function< void( const Eigen::VectorXd& ) > parameterResetFunction =
+            std::function< void( const Eigen::VectorXd& ) >( ) ):
+        dynamicsSimulator_( dynamicsSimulator ), parameterResetFunction_( parameterResetFunction ){ }
+
+    //! Dynamics simulator used to propagate the members of the ensemble
+    std::shared_ptr< SingleArcDynamicsSimulator< StateScalarType, TimeType > > dynamicsSimulator_;
+
+    //! Function to reset the values of the physical parameters that are varied between the members of the ensemble
+    std::function< void( const Eigen::VectorXd& ) > parameterResetFunction_;
+};
+
+//! Function to generate a list of initial states of ensemble members, normally distributed about a nominal state
+/*!
+ *  Function to generate a list of initial states of ensemble members, with each entry of the state independently normally
+ *  distributed about the nominal state (using statistics::generateGaussianRandomSample).
+ *  \param nominalState Nominal initial state (mean of the distribution)
+ *  \param standardDeviations Standard deviations of the entries of the initial state
+ *  \param numberOfMembers Number of members of the ensemble
+ *  \param seed Seed of the random number generator
+ *  \return Initial states of ensemble members
+ */
+template< typename StateScalarType = double >
+std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > generateGaussianEnsembleInitialStates(
+        const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& nominalState,
+        const Eigen::VectorXd& standardDeviations,
+        const int numberOfMembers,
+        const int seed = 0 )
+{
+    if( nominalState.rows( ) != standardDeviations.rows( ) )
+    {
+        throw std::runtime_error( "Error when generating ensemble initial states, size of nominal state (" +
+                                  std::to_string( nominalState.rows( ) ) + ") and standard deviations (" +
+                                  std::to_string( standardDeviations.rows( ) ) + ") are inconsistent" );
+    }
+
+    // Generate perturbations and add to nominal state
+    std::vector< Eigen::VectorXd > statePerturbations = statistics::generateGaussianRandomSample(
+                seed, numberOfMembers, Eigen::VectorXd::Zero( nominalState.rows( ) ), standardDeviations );
+
+    std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > initialStates;
+    for( int i = 0; i < numberOfMembers; i++ )
+    {
+        initialStates.push_back( nominalState + statePerturbations.at( i ).template cast< StateScalarType >( ) );
+    }
+    return initialStates;
+}
+
+#if USE_GSL
+//! Function to generate a list of initial states of ensemble members, normally distributed about a nominal state, from a
+//! Sobol sequence
+/*!
+ *  Function to generate a list of initial states of ensemble members, with each entry of the state independently normally
+ *  distributed about the nominal state. Instead of pseudo-random numbers (see generateGaussianEnsembleInitialStates), the
+ *  points of a Sobol (quasi-random) sequence are used (see statistics::generateVectorSobolSample), which are mapped to the
+ *  normal distribution by its inverse cumulative distribution function. The sample covers the distribution more evenly,
+ *  so that statistics of the ensemble typically converge faster with the number of members. The list is deterministic;
+ *  each list is the start of the next (larger) one.
+ *  \param nominalState Nominal initial state (mean of the distribution)
+ *  \param standardDeviations Standard deviations of the entries of the initial state
+ *  \param numberOfMembers Number of members of the ensemble
+ *  \return Initial states of ensemble members
+ */
+template< typename StateScalarType = double >
+std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > generateSobolGaussianEnsembleInitialStates(
+        const Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 >& nominalState,
+        const Eigen::VectorXd& standardDeviations,
+        const int numberOfMembers )
+{
+    if( nominalState.rows( ) != standardDeviations.rows( ) )
+    {
+        throw std::runtime_error( "Error when generating ensemble initial states, size of nominal state (" +
+                                  std::to_string( nominalState.rows( ) ) + ") and standard deviations (" +
+                                  std::to_string( standardDeviations.rows( ) ) + ") are inconsistent" );
+    }
+
+    // Generate points in unit hypercube, and map to standard normal distribution
+    std::vector< Eigen::VectorXd > sobolSample = statistics::generateVectorSobolSample(
+                nominalState.rows( ), numberOfMembers, 0.0, 1.0 );
+    boost::math::normal standardNormalDistribution( 0.0, 1.0 );
+
+    std::vector< Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > > initialStates;
+    for( int i = 0; i < numberOfMembers; i++ )
+    {
+        Eigen::VectorXd statePerturbation = Eigen::VectorXd( nominalState.rows( ) );
+        for( int j = 0; j < nominalState.rows( ); j++ )
+        {
+            if( !( sobolSample.at( i )( j ) > 0.0 && sobolSample.at( i )( j ) < 1.0 ) )
+            {
+                throw std::runtime_error( "Error when generating ensemble initial states, Sobol point not in open unit "
+                                          "interval" );
+            }
+            statePerturbation( j ) = standardDeviations( j ) *
+                    boost::math::quantile( standardNormalDistribution, sobolSample.at( i )( j ) );
+        }
+        initialStates.push_back( nominalState + statePerturbation.template cast< StateScalarType >( ) );
+    }
+    return initialStates;
+}
+#endif
+
+//! Class for the numerical propagation of an ensemble of dynamical systems (e.g. for Monte Carlo analyses)
+/*!
+ *  Class for the numerical propagation of an ensemble of dynamical systems, which differ only in their initial states and
+ *  (optionally) in the values of a set of physical parameters, for instance for Monte Carlo analyses. The dynamical model
+ *  is set up once per thread (see EnsembleMemberSimulator), after which all members are propagated by reusing these
+ *  objects, with the members distributed dynamically over the threads.
+ *  The full state history of each member is only retained until the member is processed: the states of each member are
+ *  stored only at a list of output epochs (or only the final state), in a single matrix per member. From these, the
+ *  statistics of the ensemble (mean, covariance, percentiles) can be computed, using at each epoch only the members that
+ *  reached it. Members that terminated before reaching all output epochs are reported explicitly (see
+ *  getIsOutputEpochReached and getIndicesOfIncompleteMembers). The results are independent of the number of threads
+ *  that is used.
+ */
+template< typename StateScalarType = double, typename TimeType = double >
+class EnsembleDynamicsSimulator
+{
+public:
+
+    //! Typedef for state vector of single member
+    typedef Eigen::Matrix< StateScalarType, Eigen::Dynamic, 1 > StateVectorType;
+
+    //! Typedef for states of single member at all output epochs
+    typedef Eigen::Matrix< StateScalarType, Eigen::Dynamic, Eigen::Dynamic > StateMatrixType;
+
+    //! Constructor
+    /*!
+     *  Constructor, creates the objects used to propagate the members in each thread. The creation function is called once
+     *  for each thread (from the calling thread, before any propagation is started), and must create a new environment and
+     *  dynamics simulator on each call.
+     *  \param memberSimulatorCreationFunction Function that creates the objects used to propagate the members of the
+     *  ensemble in a single thread.
+     *  \param numberOfThreads Number of threads used for the propagation of the ensemble (default 1).
+     */
+    EnsembleDynamicsSimulator(
+            const std::function< std::shared_ptr< EnsembleMemberSimulator< StateScalarType, TimeType > >( ) >
+            memberSimulatorCreationFunction,
+            const int numberOfThreads = 1 )
+    {
+        for( int i = 0; i < std::max( numberOfThreads, 1 ); i++ )
+        {
+            memberSimulators_.push_back( memberSimulatorCreationFunction( ) );
+            if( memberSimulators_.at( i ) == nullptr || memberSimulators_.at( i )->dynamicsSimulator_ == nullptr )
+            {
+                throw std::runtime_error( "Error when creating ensemble dynamics simulator, no dynamics simulator created" );
+            }
+            for( int j = 0; j < i; j++ )
+            {
+                if( memberSimulators_.at( i )->dynamicsSimulator_ == memberSimulators_.at( j )->dynamicsSimulator_ )
+                {
+                    throw std::runtime_error( "Error when creating ensemble dynamics simulator, same dynamics simulator "
+                                              "created for different threads" );
+                }
+            }
+
+            // Environment is not to be updated with the results of the individual members
+            memberSimulators_.at( i )->dynamicsSimulator_->resetSetIntegratedResult( false );
+        }
+    }
+
+    //! Function to propagate all members of the ensemble
+    /*!
+     *  Function to propagate all members of the ensemble. The states at the output epochs are stored, per member, in the
+     *  memberStates_ member variable. The states are saved by the integrator at exactly these epochs (see
+     *  IntegratorSettings::requestedOutputTimes_, which is set to the output epochs during this function), so that the
+     *  integrator must provide dense output if output epochs are given. If a member is not propagated up to an output epoch
+     *  (for instance due to a termination condition being reached), its state at that epoch is set to NaN, and the epoch is
+     *  marked as not reached (see getIsOutputEpochReached). Note that after this function, the physical parameters of each
+     *  environment are set to the values of the last member that was propagated in it.
+     *  \param initialStates Initial states of all members of the ensemble (in the conventional form for the propagator)
+     *  \param parameterValues Physical parameter values of all members of the ensemble (passed to the
+     *  parameterResetFunction_ of the EnsembleMemberSimulator before propagating the member). If empty (default), the
+     *  parameters are not modified.
+     *  \param outputEpochs Epochs at which the states of all members are stored, sorted in ascending order. If empty
+     *  (default), only the final state of each member is stored.
+     */
+    void propagateEnsemble(
+            const std::vector< StateVectorType >& initialStates,
+            const std::vector< Eigen::VectorXd >& parameterValues = std::vector< Eigen::VectorXd >( ),
+            const std::vector< TimeType >& outputEpochs = std::vector< TimeType >( ) )
+    {
+        int numberOfMembers = initialStates.size( );
+        if( parameterValues.size( ) > 0 )
+        {
+            if( static_cast< int >( parameterValues.size( ) ) != numberOfMembers )
+            {
+                throw std::runtime_error( "Error when propagating ensemble, number of initial states (" +
+                                          std::to_string( numberOfMembers ) + ") and parameter values (" +
+                                          std::to_string( parameterValues.size( ) ) + ") are inconsistent" );
+            }
+
+            for( unsigned int i = 0; i < memberSimulators_.size( ); i++ )
+            {
+                if( !memberSimulators_.at( i )->parameterResetFunction_ )
+                {
+                    throw std::runtime_error( "Error when propagating ensemble, parameter values provided, but no function "
+                                              "to reset parameters was defined" );
+                }
+            }
+        }
+
+        for( unsigned int i = 1; i < outputEpochs.size( ); i++ )
+        {
+            if( !( outputEpochs.at( i ) > outputEpochs.at( i - 1 ) ) )
+            {
+                throw std::runtime_error( "Error when propagating ensemble, output epochs are not sorted in ascending order" );
+            }
+        }
+
+        // Allocate output of all members
+        outputEpochs_ = outputEpochs;
+        memberStates_.clear( );
+        memberStates_.resize( numberOfMembers );
+        memberFinalTimes_.clear( );
+        memberFinalTimes_.resize( numberOfMembers );
+        propagationTerminationReasons_.clear( );
+        propagationTerminationReasons_.resize( numberOfMembers );
+        isOutputEpochReached_.clear( );
+        isOutputEpochReached_.resize( numberOfMembers );
+
+        // Save numerical solution of each member only at output epochs
+        std::vector< std::vector< TimeType > > originalRequestedOutputTimes;
+        for( unsigned int i = 0; i < memberSimulators_.size( ); i++ )
+        {
+            originalRequestedOutputTimes.push_back(
+                        memberSimulators_.at( i )->dynamicsSimulator_->getIntegratorSettings( )->requestedOutputTimes_ );
+        }
+        for( unsigned int i = 0; i < memberSimulators_.size( ); i++ )
+        {
+            memberSimulators_.at( i )->dynamicsSimulator_->getIntegratorSettings( )->requestedOutputTimes_ = outputEpochs_;
+        }
+
+        // Propagate members, each thread using its own simulator
+        utilities::executeParallelLoopWithWorkerIndex(
+                    numberOfMembers, memberSimulators_.size( ), [ & ]( const int memberIndex, const int workerIndex )
+        {
+            std::shared_ptr< EnsembleMemberSimulator< StateScalarType, TimeType > > memberSimulator =
+                    memberSimulators_.at( workerIndex );
+
+            if( parameterValues.size( ) > 0 )
+            {
+                memberSimulator->parameterResetFunction_( parameterValues.at( memberIndex ) );
+            }
+
+            memberSimulator->dynamicsSimulator_->integrateEquationsOfMotion( initialStates.at( memberIndex ) );
+            processMemberResult( memberIndex, memberSimulator->dynamicsSimulator_ );
+        } );
+
+        for( unsigned int i = 0; i < memberSimulators_.size( ); i++ )
+        {
+            memberSimulators_.at( i )->dynamicsSimulator_->getIntegratorSettings( )->requestedOutputTimes_ =
+                    originalRequestedOutputTimes.at( i );
+        }
+    }
+
+    //! Function to retrieve the number of members of the ensemble that was last propagated
+    /*!
+     *  Function to retrieve the number of members of the ensemble that was last propagated
+     *  \return Number of members of the ensemble that was last propagated
+     */
+    int getNumberOfMembers( )
+    {
+        return memberStates_.size( );
+    }
+
+    //! Function to retrieve the epochs at which the states of all members are stored
+    /*!
+     *  Function to retrieve the epochs at which the states of all members are stored (empty if only the final state is stored)
+     *  \return Epochs at which the states of all members are stored
+     */
+    std::vector< TimeType > getOutputEpochs( )
+    {
+        return outputEpochs_;
+    }
+
+    //! Function to retrieve the states of all members
+    /*!
+     *  Function to retrieve the states of all members. Each entry contains the states of a single member, with each column
+     *  containing the state at the associated entry of the output epochs (or a single column with the final state, if no
+     *  output epochs were provided).
+     *  \return States of all members
+     */
+    const std::vector< StateMatrixType >& getMemberStates( )
+    {
+        return memberStates_;
+    }
+
+    //! Function to retrieve the final propagation times of all members
+    /*!
+     *  Function to retrieve the final propagation times of all members, i.e. the epoch of the last integration step (or of
+     *  the exact termination condition)
+     *  \return Final propagation times of all members
+     */
+    std::vector< TimeType > getMemberFinalTimes( )
+    {
+        return memberFinalTimes_;
+    }
+
+    //! Function to retrieve the propagation termination reasons of all members
+    /*!
+     *  Function to retrieve the propagation termination reasons of all members
+     *  \return Propagation termination reasons of all members
+     */
+    std::vector< std::shared_ptr< PropagationTerminationDetails > > getPropagationTerminationReasons( )
+    {
+        return propagationTerminationReasons_;
+    }
+
+    //! Function to retrieve whether the members were propagated up to each of the output epochs
+    /*!
+     *  Function to retrieve whether the members were propagated up to each of the output epochs. If only the final states are
+     *  stored, the single entry of each member denotes whether the propagation of the member terminated nominally (i.e. with
+     *  termination reason termination_condition_reached).
+     *  \return List (per member) of flags denoting whether the member was propagated up to each output epoch
+     */
+    std::vector< std::vector< bool > > getIsOutputEpochReached( )
+    {
+        return isOutputEpochReached_;
+    }
+
+    //! Function to retrieve the indices of the members that were not propagated up to all output epochs
+    /*!
+     *  Function to retrieve the indices of the members that were not propagated up to all output epochs (or, if only the final
+     *  states are stored, for which the propagation did not terminate nominally), for instance due to a termination
+     *  condition being reached before the final output epoch.
+     *  \return Indices of the members that were not propagated up to all output epochs
+     */
+    std::vector< int > getIndicesOfIncompleteMembers( )
+    {
+        std::vector< int > indicesOfIncompleteMembers;
+        for( unsigned int i = 0; i < isOutputEpochReached_.size( ); i++ )
+        {
+            if( std::find( isOutputEpochReached_.at( i ).begin( ), isOutputEpochReached_.at( i ).end( ), false ) !=
+                    isOutputEpochReached_.at( i ).end( ) )
+            {
+                indicesOfIncompleteMembers.push_back( i );
+            }
+        }
+        return indicesOfIncompleteMembers;
+    }
+
+    //! Function to retrieve the objects used to propagate the members in each thread
+    /*!
+     *  Function to retrieve the objects used to propagate the members in each thread
+     *  \return Objects used to propagate the members in each thread
+     */
+    std::vector< std::shared_ptr< EnsembleMemberSimulator< StateScalarType, TimeType > > > getMemberSimulators( )
+    {
+        return memberSimulators_;
+    }
+
+    //! Function to retrieve the states of all members that reached a single output epoch
+    /*!
+     *  Function to retrieve the states of all members that reached a single output epoch (see getIsOutputEpochReached), in
+     *  order of member index. These states are used to compute the statistics of the ensemble at the output epoch.
+     *  \param outputEpochIndex Index of output epoch (0 if only final states are stored)
+     *  \return States of all members that reached the given output epoch
+     */
+    std::vector< Eigen::VectorXd > getMemberStatesAtOutputEpoch( const int outputEpochIndex )
+    {
+        std::vector< Eigen::VectorXd > memberStatesAtEpoch;
+        memberStatesAtEpoch.reserve( memberStates_.size( ) );
+        for( unsigned int i = 0; i < memberStates_.size( ); i++ )
+        {
+            if( isOutputEpochReached_.at( i ).at( outputEpochIndex ) )
+            {
+                memberStatesAtEpoch.push_back( memberStates_.at( i ).col( outputEpochIndex ).template cast< double >( ) );
+            }
+        }
+
+        if( memberStatesAtEpoch.size( ) == 0 )
+        {
+            throw std::runtime_error( "Error when retrieving ensemble states, no member reached output epoch " +
+                                      std::to_string( outputEpochIndex ) );
+        }
+        return memberStatesAtEpoch;
+    }
+
+    //! Function to compute the sample mean of the states of the members at each output epoch
+    /*!
+     *  Function to compute the sample mean of the states of the members at each output epoch
+     *  \return Sample mean of the states (one column per output epoch)
+     */
+    Eigen::MatrixXd getSampleMeanStates( )
+    {
+        Eigen::MatrixXd sampleMeanStates = Eigen::MatrixXd( getStateSize( ), getNumberOfStoredEpochs( ) );
+        for( int i = 0; i < sampleMeanStates.cols( ); i++ )
+        {
+            sampleMeanStates.col( i ) = statistics::computeSampleMean( getMemberStatesAtOutputEpoch( i ) );
+        }
+        return sampleMeanStates;
+    }
+
+    //! Function to compute the sample covariance of the states of the members at each output epoch
+    /*!
+     *  Function to compute the sample covariance of the states of the members at each output epoch
+     *  \return Sample covariance of the states (one entry per output epoch)
+     */
+    std::vector< Eigen::MatrixXd > getSampleStateCovariances( )
+    {
+        std::vector< Eigen::MatrixXd > sampleStateCovariances;
+        for( int i = 0; i < getNumberOfStoredEpochs( ); i++ )
+        {
+            sampleStateCovariances.push_back( statistics::computeSampleCovariance( getMemberStatesAtOutputEpoch( i ) ) );
+        }
+        return sampleStateCovariances;
+    }
+
+    //! Function to compute a sample percentile of the states of the members at each output epoch
+    /*!
+     *  Function to compute a sample percentile of the states of the members at each output epoch, separately for each
+     *  entry of the state (see statistics::computeSamplePercentile)
+     *  \param percentile Percentile that is to be computed (in range [0, 100])
+     *  \return Sample percentile of the states (one column per output epoch)
+     */
+    Eigen::MatrixXd getSampleStatePercentiles( const double percentile )
+    {
+        Eigen::MatrixXd sampleStatePercentiles = Eigen::MatrixXd( getStateSize( ), getNumberOfStoredEpochs( ) );
+        for( int i = 0; i < sampleStatePercentiles.cols( ); i++ )
+        {
+            sampleStatePercentiles.col( i ) = statistics::computeSamplePercentile(
+                        getMemberStatesAtOutputEpoch( i ), percentile );
+        }
+        return sampleStatePercentiles;
+    }
+
+private:
+
+    //! Function to retrieve the size of the stored states
+    int getStateSize( )
+    {
+        if( memberStates_.size( ) == 0 )
+        {
+            throw std::runtime_error( "Error when retrieving ensemble statistics, no members propagated" );
+        }
+        return memberStates_.at( 0 ).rows( );
+    }
+
+    //! Function to retrieve the number of epochs at which the states are stored
+    int getNumberOfStoredEpochs( )
+    {
+        return ( outputEpochs_.size( ) > 0 ) ? outputEpochs_.size( ) : 1;
+    }
+
+    //! Function to extract the states at the output epochs from the numerical solution of a single member
+    /*!
+     *  Function to extract the states at the output epochs from the numerical solution of a single member (saved at exactly
+     *  these epochs), and store them (and the propagation termination details) in the entries of the member variables
+     *  associated with the member.
+     *  \param memberIndex Index of member
+     *  \param dynamicsSimulator Dynamics simulator with which the member was propagated
+     */
+    void processMemberResult(
+            const int memberIndex,
+            const std::shared_ptr< SingleArcDynamicsSimulator< StateScalarType, TimeType > > dynamicsSimulator )
+    {
+        const utilities::StateHistory< TimeType, StateScalarType >& numericalSolution =
+                dynamicsSimulator->getContiguousEquationsOfMotionNumericalSolution( );
+        propagationTerminationReasons_[ memberIndex ] = dynamicsSimulator->getPropagationTerminationReason( );
+
+        if( outputEpochs_.size( ) == 0 )
+        {
+            memberStates_[ memberIndex ] = numericalSolution.getState( numericalSolution.size( ) - 1 );
+            memberFinalTimes_[ memberIndex ] = numericalSolution.getLastTime( );
+            isOutputEpochReached_[ memberIndex ] = std::vector< bool >(
+                        1, propagationTerminationReasons_.at( memberIndex )->getPropagationTerminationReason( ) ==
+                        termination_condition_reached );
+        }
+        else
+        {
+            memberStates_[ memberIndex ] = StateMatrixType::Constant(
+                        numericalSolution.getStateSize( ), outputEpochs_.size( ),
+                        std::numeric_limits< StateScalarType >::quiet_NaN( ) );
+            isOutputEpochReached_[ memberIndex ] = std::vector< bool >( outputEpochs_.size( ), false );
+
+            // Retrieve states at output epochs (solution may also contain the state at the exact termination condition)
+            for( int i = 0; i < numericalSolution.size( ); i++ )
+            {
+                typename std::vector< TimeType >::iterator epochIterator = std::lower_bound(
+                            outputEpochs_.begin( ), outputEpochs_.end( ), numericalSolution.getTime( i ) );
+                if( epochIterator != outputEpochs_.end( ) && *epochIterator == numericalSolution.getTime( i ) )
+                {
+                    int outputEpochIndex = std::distance( outputEpochs_.begin( ), epochIterator );
+                    memberStates_[ memberIndex ].col( outputEpochIndex ) = numericalSolution.getState( i );
+                    isOutputEpochReached_[ memberIndex ][ outputEpochIndex ] = true;
+                }
+            }
+
+            // Retrieve epoch of last integration step, or of exact termination condition
+            std::map< TimeType, double > computationTimeHistory = dynamicsSimulator->getCumulativeComputationTimeHistory( );
+            bool isPropagationForward = ( dynamicsSimulator->getIntegratorSettings( )->initialTimeStep_ > 0.0 );
+            TimeType lastStepTime = isPropagationForward ?
+                        computationTimeHistory.rbegin( )->first : computationTimeHistory.begin( )->first;
+            if( numericalSolution.size( ) > 0 && ( isPropagationForward ? ( numericalSolution.getLastTime( ) > lastStepTime ) :
+                                                   ( numericalSolution.getLastTime( ) < lastStepTime ) ) )
+            {
+                lastStepTime = numericalSolution.getLastTime( );
+            }
+            memberFinalTimes_[ memberIndex ] = lastStepTime;
+        }
+    }
+
+    //! Objects used to propagate the members, one per thread
+    std::vector< std::shared_ptr< EnsembleMemberSimulator< StateScalarType, TimeType > > > memberSimulators_;
+
+    //! Epochs at which the states of all members are stored (empty if only final state is stored)
+    std::vector< TimeType > outputEpochs_;
+
+    //! States of all members at output epochs (one column per output epoch)
+    std::vector< StateMatrixType > memberStates_;
+
+    //! Final propagation times of all members
+    std::vector< TimeType > memberFinalTimes_;
+
+    //! Propagation termination reasons of all members
+    std::vector< std::shared_ptr< PropagationTerminationDetails > > propagationTerminationReasons_;
+
+    //! List (per member) of flags denoting whether the member was propagated up to each output epoch
+    std::vector< std::vector< bool > > isOutputEpochReached_;
+};
+
+extern template class EnsembleDynamicsSimulator< double, double >;
+
+#if( BUILD_EXTENDED_PRECISION_PROPAGATION_TOOLS )
+extern template class EnsembleDynamicsSimulator< long double, double >;
+extern template class EnsembleDynamicsSimulator< double, Time >;
+extern template class EnsembleDynamicsSimulator< long double, Time >;
+#endif
+
+} // namespace propagators
+
+} // namespace tudat
+
+#endif // TUDAT_ENSEMBLEDYNAMICSSIMULATOR_H
@@ -21,6 +21,7 @@
 #include <boost/tuple/tuple_comparison.hpp>
 #include <boost/tuple/tuple_io.hpp>
 
+#include "Tudat/Basics/profiling.h"
 #include "Tudat/SimulationSetup/EnvironmentSetup/body.h"
 #include "Tudat/Astrodynamics/Gravitation/timeDependentSphericalHarmonicsGravityField.h"
 #include "Tudat/SimulationSetup/PropagationSetup/propagationSettings.h"
@@ -118,10 +119,29 @@ public:
         // determined by setUpdateFunctions
         for( unsigned int i = 0; i < updateFunctionVector_.size( ); i++ )
         {
+            TUDAT_PROFILE_SCOPE( updateFunctionProfilingEntries_[ i ] );
             updateFunctionVector_.at( i ).template get< 2 >( )( currentTime );
         }
     }
 
+    //! Function to set the object in which the computation time of the individual update functions is stored.
+    /*!
+     * Function to set the object in which the computation time of the individual update functions is stored, if Tudat
+     * is built with USE_PROFILING. Each environment model update is stored as a separate component.
+     * \param profilingData Object in which the computation time of the update functions is stored.
+     */
+    void setProfilingData( const std::shared_ptr< utilities::ProfilingData > profilingData )
+    {
+        profilingData_ = profilingData;
+        for( unsigned int i = 0; i < updateFunctionVector_.size( ); i++ )
+        {
+            updateFunctionProfilingEntries_[ i ] = ( profilingData_ == nullptr ) ? nullptr : profilingData_->getEntry(
+                        "Environment update: " + getEnvironmentUpdateTypeName(
+                            updateFunctionVector_.at( i ).template get< 0 >( ) ) +
+                        " of " + updateFunctionVector_.at( i ).template get< 1 >( ) );
+        }
+    }
+
 private:
 
     //! Function to set numerically integrated states in environment.
@@ -657,6 +677,8 @@ private:
 
         // Set update order of functions.
         setUpdateFunctionOrder( );
+
+        updateFunctionProfilingEntries_.assign( updateFunctionVector_.size( ), nullptr );
     }
 
     //! List of body objects, this list encompasses all environment object in the simulation.
@@ -682,6 +704,12 @@ private:
     //! time step).
     std::vector< boost::tuple< EnvironmentModelsToUpdate, std::string, std::function< void( ) > > > resetFunctionVector_;
 
+    //! Object in which the computation time of the update functions is stored (nullptr if not profiled).
+    std::shared_ptr< utilities::ProfilingData > profilingData_;
+
+    //! Profiling entries for each of the entries of updateFunctionVector_ (nullptr if not profiled).
+    std::vector< utilities::ProfilingEntry* > updateFunctionProfilingEntries_;
+
 
 
 
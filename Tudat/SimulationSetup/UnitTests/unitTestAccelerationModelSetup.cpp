@@ -260,6 +260,27 @@ BOOST_AUTO_TEST_CASE( test_shGravityModelSetup )
                 ( basic_astrodynamics::updateAndGetAcceleration( directAcceleration ) ),
                 std::numeric_limits< double >::epsilon( ) );
 
+    // Check that acceleration models of same field acting on same body share their cache and kernel.
+    AccelerationMap secondAccelerationsMap = createAccelerationModelsMap(
+                bodyMap, accelerationSettingsMap, centralBodies );
+    std::shared_ptr< gravitation::SphericalHarmonicsGravitationalAccelerationModel > firstSphericalHarmonicAcceleration =
+            std::dynamic_pointer_cast< gravitation::SphericalHarmonicsGravitationalAccelerationModel >(
+                directAcceleration );
+    std::shared_ptr< gravitation::SphericalHarmonicsGravitationalAccelerationModel > secondSphericalHarmonicAcceleration =
+            std::dynamic_pointer_cast< gravitation::SphericalHarmonicsGravitationalAccelerationModel >(
+                secondAccelerationsMap[ "Vehicle" ][ "Earth" ][ 0 ] );
+    BOOST_CHECK_EQUAL( firstSphericalHarmonicAcceleration->getSphericalHarmonicsCache( ),
+                       secondSphericalHarmonicAcceleration->getSphericalHarmonicsCache( ) );
+    BOOST_CHECK_EQUAL( firstSphericalHarmonicAcceleration->getAccelerationKernel( ),
+                       secondSphericalHarmonicAcceleration->getAccelerationKernel( ) );
+    BOOST_CHECK( firstSphericalHarmonicAcceleration->getSphericalHarmonicsCache( ) !=
+                 std::dynamic_pointer_cast< gravitation::SphericalHarmonicsGravitationalAccelerationModel >(
+                     manualAcceleration )->getSphericalHarmonicsCache( ) );
+    TUDAT_CHECK_MATRIX_CLOSE_FRACTION(
+                ( basic_astrodynamics::updateAndGetAcceleration( secondAccelerationsMap[ "Vehicle" ][ "Earth" ][ 0 ] ) ),
+                ( basic_astrodynamics::updateAndGetAcceleration( directAcceleration ) ),
+                std::numeric_limits< double >::epsilon( ) );
+
     // Set (unrealistically) a gravity field model on the Vehicle, to test its
     // influence on acceleration.
     bodyMap[ "Vehicle" ]->setGravityFieldModel( std::make_shared< gravitation::GravityFieldModel >(
@@ -10,8 +10,11 @@
 
 #define BOOST_TEST_MAIN
 
+#include <cstdio>
+#include <fstream>
 #include <limits>
 
+#include <boost/filesystem.hpp>
 #include <boost/test/unit_test.hpp>
 #include <boost/make_shared.hpp>
 
@@ -289,10 +292,152 @@ BOOST_AUTO_TEST_CASE( test_ephemerisSetup )
                     std::numeric_limits< double >::epsilon( ) );
     }
 
+    {
+        // Create snapshot of Spice data for lunar state
+        double snapshotStartTime = 1.0E7;
+        double snapshotEndTime = 1.0E7 + 10.0 * 86400.0;
+        std::shared_ptr< spice_interface::SpiceSnapshot > spiceSnapshot =
+                std::make_shared< spice_interface::SpiceSnapshot >( snapshotStartTime, snapshotEndTime );
+        spiceSnapshot->addBodyState( "Moon", "Earth", "J2000", 1.0E-3, 1.0E-6 );
+        spiceSnapshot->addBodyState( "Moon", "Earth", "ECLIPJ2000", 1.0E-3, 1.0E-6 );
+
+        // Create ephemeris from snapshot, and check that it is the ephemeris stored in the snapshot
+        std::shared_ptr< EphemerisSettings > snapshotEphemerisSettings =
+                std::make_shared< SpiceSnapshotEphemerisSettings >( spiceSnapshot, "Earth", "J2000" );
+        std::shared_ptr< ephemerides::Ephemeris > snapshotEphemeris =
+                createBodyEphemeris( snapshotEphemerisSettings, "Moon" );
+        BOOST_CHECK_EQUAL( snapshotEphemeris, spiceSnapshot->getBodyStateEphemeris( "Moon", "Earth", "J2000" ) );
+
+        // Create spice ephemeris.
+        std::shared_ptr< ephemerides::Ephemeris > spiceEphemeris =
+                createBodyEphemeris( std::make_shared< DirectSpiceEphemerisSettings >( "Earth", "J2000" ), "Moon" );
+
+        // Compare snapshot ephemeris against spice ephemeris.
+        for( int i = 0; i <= 100; i++ )
+        {
+            double testTime = snapshotStartTime + static_cast< double >( i ) / 100.0 * ( snapshotEndTime - snapshotStartTime );
+            Eigen::Vector6d stateDifference =
+                    snapshotEphemeris->getCartesianState( testTime ) - spiceEphemeris->getCartesianState( testTime );
+            BOOST_CHECK_SMALL( stateDifference.segment( 0, 3 ).norm( ), 2.0E-3 );
+            BOOST_CHECK_SMALL( stateDifference.segment( 3, 3 ).norm( ), 2.0E-6 );
+        }
+
+        // Check that ephemerides not in the snapshot cannot be created
+        BOOST_CHECK_THROW( createBodyEphemeris( snapshotEphemerisSettings, "Sun" ), std::runtime_error );
+        BOOST_CHECK_THROW( createBodyEphemeris( std::make_shared< SpiceSnapshotEphemerisSettings >(
+                                                    spiceSnapshot, "SSB", "J2000" ), "Moon" ), std::runtime_error );
+
+        // Create bodies, with lunar ephemeris from snapshot
+        std::map< std::string, std::shared_ptr< BodySettings > > bodySettings;
+        bodySettings[ "Earth" ] = getDefaultSingleBodySettings( "Earth", snapshotStartTime, snapshotEndTime );
+        bodySettings[ "Moon" ] = getDefaultSingleBodySettings( "Moon", snapshotStartTime, snapshotEndTime );
+        bodySettings[ "Earth" ]->ephemerisSettings = std::make_shared< DirectSpiceEphemerisSettings >( "SSB", "ECLIPJ2000" );
+        bodySettings[ "Moon" ]->ephemerisSettings =
+                std::make_shared< SpiceSnapshotEphemerisSettings >( spiceSnapshot, "Earth", "ECLIPJ2000" );
+        NamedBodyMap bodyMap = createBodies( bodySettings );
+        setGlobalFrameBodyEphemerides( bodyMap, "SSB", "ECLIPJ2000" );
+
+        BOOST_CHECK_EQUAL( bodyMap.at( "Moon" )->getEphemeris( ),
+                           spiceSnapshot->getBodyStateEphemeris( "Moon", "Earth", "ECLIPJ2000" ) );
 
+        // Compare barycentric lunar state from bodies against spice
+        for( int i = 0; i <= 10; i++ )
+        {
+            double testTime = snapshotStartTime + static_cast< double >( i ) / 10.0 * ( snapshotEndTime - snapshotStartTime );
+            Eigen::Vector6d stateDifference =
+                    bodyMap.at( "Moon" )->computeStateInBaseFrameFromEphemeris( testTime ) -
+                    spice_interface::getBodyCartesianStateAtEpoch( "Moon", "SSB", "ECLIPJ2000", "None", testTime );
+            BOOST_CHECK_SMALL( stateDifference.segment( 0, 3 ).norm( ), 2.0E-3 );
+            BOOST_CHECK_SMALL( stateDifference.segment( 3, 3 ).norm( ), 2.0E-6 );
+        }
+    }
 }
 #endif
 
+//! Test set up of Chebyshev ephemeris, and consistency checks of the file in which it is stored.
+BOOST_AUTO_TEST_CASE( test_chebyshevEphemerisSetup )
+{
+    using namespace ephemerides;
+
+    const std::string fileName =
+            ( boost::filesystem::temp_directory_path( ) / boost::filesystem::unique_path(
+                  "tudat_chebyshev_%%%%-%%%%.bin" ) ).string( );
+
+    // Create settings for Chebyshev ephemeris fitted to Kepler orbit, which is written to file.
+    const Eigen::Vector6d keplerElements = ( Eigen::Vector6d( ) << 7000.0E3, 0.01, 0.5, 0.1, 0.2, 0.3 ).finished( );
+    std::shared_ptr< EphemerisSettings > keplerEphemerisSettings = std::make_shared< KeplerEphemerisSettings >(
+                keplerElements, 0.0, 3.986004418E14, "Earth", "J2000" );
+    std::shared_ptr< ChebyshevEphemerisSettings > chebyshevEphemerisSettings =
+            std::make_shared< ChebyshevEphemerisSettings >(
+                keplerEphemerisSettings, 0.0, 86400.0, 1.0E-2, 1.0E-5, 12, fileName );
+    std::shared_ptr< ChebyshevEphemeris > fittedEphemeris = std::dynamic_pointer_cast< ChebyshevEphemeris >(
+                createBodyEphemeris( chebyshevEphemerisSettings, "Satellite" ) );
+    BOOST_CHECK( fittedEphemeris != nullptr );
+    BOOST_CHECK( boost::filesystem::exists( fileName ) );
+    BOOST_CHECK( isChebyshevEphemerisConsistentWithSettings( fittedEphemeris, chebyshevEphemerisSettings ) );
+
+    // Create ephemeris with consistent settings, but different original orbit: ephemeris is to be read from file.
+    std::shared_ptr< EphemerisSettings > modifiedKeplerEphemerisSettings = std::make_shared< KeplerEphemerisSettings >(
+                ( Eigen::Vector6d( ) << 7500.0E3, 0.01, 0.5, 0.1, 0.2, 0.3 ).finished( ), 0.0, 3.986004418E14,
+                "Earth", "J2000" );
+    std::shared_ptr< ChebyshevEphemeris > readEphemeris = std::dynamic_pointer_cast< ChebyshevEphemeris >(
+                createBodyEphemeris( std::make_shared< ChebyshevEphemerisSettings >(
+                                         modifiedKeplerEphemerisSettings, 0.0, 86400.0, 1.0E-2, 1.0E-5, 12, fileName ),
+                                     "Satellite" ) );
+    BOOST_CHECK( readEphemeris->getChebyshevCoefficients( ) == fittedEphemeris->getChebyshevCoefficients( ) );
+
+    // Create ephemerides with settings that are inconsistent with file: ephemeris is to be refitted, and file replaced.
+    std::vector< std::shared_ptr< ChebyshevEphemerisSettings > > inconsistentSettings;
+    inconsistentSettings.push_back( std::make_shared< ChebyshevEphemerisSettings >(
+                                        keplerEphemerisSettings, 0.0, 2.0 * 86400.0, 1.0E-2, 1.0E-5, 12, fileName ) );
+    inconsistentSettings.push_back( std::make_shared< ChebyshevEphemerisSettings >(
+                                        keplerEphemerisSettings, 3600.0, 2.0 * 86400.0, 1.0E-2, 1.0E-5, 12, fileName ) );
+    inconsistentSettings.push_back( std::make_shared< ChebyshevEphemerisSettings >(
+                                        std::make_shared< KeplerEphemerisSettings >(
+                                            keplerElements, 0.0, 3.986004418E14, "Moon", "J2000" ),
+                                        3600.0, 2.0 * 86400.0, 1.0E-2, 1.0E-5, 12, fileName ) );
+    inconsistentSettings.push_back( std::make_shared< ChebyshevEphemerisSettings >(
+                                        std::make_shared< KeplerEphemerisSettings >(
+                                            keplerElements, 0.0, 3.986004418E14, "Moon", "ECLIPJ2000" ),
+                                        3600.0, 2.0 * 86400.0, 1.0E-2, 1.0E-5, 12, fileName ) );
+    inconsistentSettings.push_back( std::make_shared< ChebyshevEphemerisSettings >(
+                                        std::make_shared< KeplerEphemerisSettings >(
+                                            keplerElements, 0.0, 3.986004418E14, "Moon", "ECLIPJ2000" ),
+                                        3600.0, 2.0 * 86400.0, 1.0E-2, 1.0E-5, 10, fileName ) );
+    inconsistentSettings.push_back( std::make_shared< ChebyshevEphemerisSettings >(
+                                        std::make_shared< KeplerEphemerisSettings >(
+                                            keplerElements, 0.0, 3.986004418E14, "Moon", "ECLIPJ2000" ),
+                                        3600.0, 2.0 * 86400.0, 1.0E-4, 1.0E-5, 10, fileName ) );
+    inconsistentSettings.push_back( std::make_shared< ChebyshevEphemerisSettings >(
+                                        std::make_shared< KeplerEphemerisSettings >(
+                                            keplerElements, 0.0, 3.986004418E14, "Moon", "ECLIPJ2000" ),
+                                        3600.0, 2.0 * 86400.0, 1.0E-4, 1.0E-7, 10, fileName ) );
+    for( unsigned int i = 0; i < inconsistentSettings.size( ); i++ )
+    {
+        BOOST_CHECK( !isChebyshevEphemerisConsistentWithSettings(
+                         readChebyshevEphemerisFromBinaryFile( fileName ), inconsistentSettings.at( i ) ) );
+
+        std::shared_ptr< ChebyshevEphemeris > refittedEphemeris = std::dynamic_pointer_cast< ChebyshevEphemeris >(
+                    createBodyEphemeris( inconsistentSettings.at( i ), "Satellite" ) );
+        BOOST_CHECK( isChebyshevEphemerisConsistentWithSettings( refittedEphemeris, inconsistentSettings.at( i ) ) );
+        BOOST_CHECK( isChebyshevEphemerisConsistentWithSettings(
+                         readChebyshevEphemerisFromBinaryFile( fileName ), inconsistentSettings.at( i ) ) );
+    }
+
+    // Check that invalid file is replaced by refitted ephemeris.
+    {
+        std::ofstream invalidFile( fileName.c_str( ), std::ios::binary | std::ios::trunc );
+        invalidFile << "invalid file";
+    }
+    std::shared_ptr< ChebyshevEphemeris > refittedEphemeris = std::dynamic_pointer_cast< ChebyshevEphemeris >(
+                createBodyEphemeris( chebyshevEphemerisSettings, "Satellite" ) );
+    BOOST_CHECK( refittedEphemeris->getChebyshevCoefficients( ) == fittedEphemeris->getChebyshevCoefficients( ) );
+    BOOST_CHECK( isChebyshevEphemerisConsistentWithSettings(
+                     readChebyshevEphemerisFromBinaryFile( fileName ), chebyshevEphemerisSettings ) );
+
+    std::remove( fileName.c_str( ) );
+}
+
 #if USE_CSPICE
 //! Test set up of gravity field model environment models.
 BOOST_AUTO_TEST_CASE( test_gravityFieldSetup )